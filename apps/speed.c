@@ -136,6 +136,7 @@ static int do_multi(int multi, int size_num);
 #endif
 
 static int domlock = 0;
+static int verify_batch = 0; /* Ed25519 signatures per batch verification */
 
 static const int lengths_list[] = {
     16, 64, 256, 1024, 8 * 1024, 16 * 1024
@@ -238,7 +239,8 @@ typedef enum OPTION_choice {
     OPT_COMMON,
     OPT_ELAPSED, OPT_EVP, OPT_HMAC, OPT_DECRYPT, OPT_ENGINE, OPT_MULTI,
     OPT_MR, OPT_MB, OPT_MISALIGN, OPT_ASYNCJOBS, OPT_R_ENUM, OPT_PROV_ENUM, OPT_CONFIG,
-    OPT_PRIMES, OPT_SECONDS, OPT_BYTES, OPT_AEAD, OPT_CMAC, OPT_MLOCK, OPT_KEM, OPT_SIG
+    OPT_PRIMES, OPT_SECONDS, OPT_BYTES, OPT_AEAD, OPT_CMAC, OPT_MLOCK, OPT_KEM, OPT_SIG,
+    OPT_BATCH
 } OPTION_CHOICE;
 
 const OPTIONS speed_options[] = {
@@ -264,6 +266,10 @@ const OPTIONS speed_options[] = {
     {"engine", OPT_ENGINE, 's', "Use engine, possibly a hardware device"},
 #endif
     {"primes", OPT_PRIMES, 'p', "Specify number of primes (for RSA only)"},
+#ifndef OPENSSL_NO_ECX
+    {"batch", OPT_BATCH, 'p',
+     "Verify signatures in batches of the specified size (for Ed25519 only)"},
+#endif
     {"mlock", OPT_MLOCK, '-', "Lock memory for better result determinism"},
     OPT_CONFIG_OPTION,
 
@@ -537,6 +543,12 @@ typedef struct loopargs_st {
 #ifndef OPENSSL_NO_ECX
     EVP_MD_CTX *eddsa_ctx[EdDSA_NUM];
     EVP_MD_CTX *eddsa_ctx2[EdDSA_NUM];
+    /* Ed25519 batch verification: signatures, messages and their lengths */
+    unsigned char *eddsa_batch_buf;
+    const unsigned char **eddsa_batch_sig;
+    const unsigned char **eddsa_batch_tbs;
+    size_t *eddsa_batch_siglen;
+    size_t *eddsa_batch_tbslen;
 #endif /* OPENSSL_NO_ECX */
 #ifndef OPENSSL_NO_SM2
     EVP_MD_CTX *sm2_ctx[SM2_NUM];
@@ -1217,6 +1229,88 @@ static int EdDSA_verify_loop(void *args)
     }
     return count;
 }
+
+static int EdDSA_verify_batch_loop(void *args)
+{
+    loopargs_t *tempargs = *(loopargs_t **) args;
+    EVP_MD_CTX **edctx = tempargs->eddsa_ctx2;
+    int ret, count;
+
+    for (count = 0; COND(eddsa_c[testnum][1]); count += verify_batch) {
+        ret = EVP_DigestVerifyInit(edctx[testnum], NULL, NULL, NULL, NULL);
+        if (ret == 0) {
+            BIO_printf(bio_err, "EdDSA verify init failure\n");
+            ERR_print_errors(bio_err);
+            count = -1;
+            break;
+        }
+        ret = EVP_DigestVerifyBatch(edctx[testnum], tempargs->eddsa_batch_sig,
+                                    tempargs->eddsa_batch_siglen,
+                                    tempargs->eddsa_batch_tbs,
+                                    tempargs->eddsa_batch_tbslen,
+                                    verify_batch, NULL);
+        if (ret != 1) {
+            BIO_printf(bio_err, "EdDSA batch verify failure\n");
+            ERR_print_errors(bio_err);
+            count = -1;
+            break;
+        }
+    }
+    return count;
+}
+
+/*
+ * Sign |verify_batch| distinct messages for the Ed25519 batch verification
+ * benchmark. Each message is the 20 byte test input with its first bytes
+ * replaced by the message index.
+ */
+static int EdDSA_batch_setup(loopargs_t *tempargs)
+{
+    EVP_MD_CTX *signctx = tempargs->eddsa_ctx[R_EC_Ed25519];
+    size_t sigsize = tempargs->sigsize;
+    unsigned char *sig, *tbs;
+    int j;
+
+    tempargs->eddsa_batch_buf =
+        app_malloc(verify_batch * (sigsize + 20), "batch buffer");
+    tempargs->eddsa_batch_sig =
+        app_malloc(verify_batch * sizeof(*tempargs->eddsa_batch_sig),
+                   "batch signatures");
+    tempargs->eddsa_batch_tbs =
+        app_malloc(verify_batch * sizeof(*tempargs->eddsa_batch_tbs),
+                   "batch messages");
+    tempargs->eddsa_batch_siglen =
+        app_malloc(verify_batch * sizeof(*tempargs->eddsa_batch_siglen),
+                   "batch signature lengths");
+    tempargs->eddsa_batch_tbslen =
+        app_malloc(verify_batch * sizeof(*tempargs->eddsa_batch_tbslen),
+                   "batch message lengths");
+
+    for (j = 0; j < verify_batch; j++) {
+        sig = tempargs->eddsa_batch_buf + j * (sigsize + 20);
+        tbs = sig + sigsize;
+        memcpy(tbs, tempargs->buf, 20);
+        memcpy(tbs, &j, sizeof(j));
+        tempargs->eddsa_batch_sig[j] = sig;
+        tempargs->eddsa_batch_tbs[j] = tbs;
+        tempargs->eddsa_batch_siglen[j] = sigsize;
+        tempargs->eddsa_batch_tbslen[j] = 20;
+        if (EVP_DigestSignInit(signctx, NULL, NULL, NULL, NULL) <= 0
+                || EVP_DigestSign(signctx, sig,
+                                  &tempargs->eddsa_batch_siglen[j],
+                                  tbs, 20) <= 0)
+            return 0;
+    }
+    if (EVP_DigestVerifyInit(tempargs->eddsa_ctx2[R_EC_Ed25519],
+                             NULL, NULL, NULL, NULL) <= 0)
+        return 0;
+    return EVP_DigestVerifyBatch(tempargs->eddsa_ctx2[R_EC_Ed25519],
+                                 tempargs->eddsa_batch_sig,
+                                 tempargs->eddsa_batch_siglen,
+                                 tempargs->eddsa_batch_tbs,
+                                 tempargs->eddsa_batch_tbslen,
+                                 verify_batch, NULL) == 1;
+}
 #endif /* OPENSSL_NO_ECX */
 
 #ifndef OPENSSL_NO_SM2
@@ -1458,6 +1552,9 @@ static int run_benchmark(int async_jobs,
         int select_result = 0;
         OSSL_ASYNC_FD max_fd = 0;
         fd_set waitfdset;
+        /* Jobs that paused without a wait fd are ready to be resumed */
+        int num_ready_jobs = 0;
+        struct timeval no_wait = { 0, 0 };
 
         FD_ZERO(&waitfdset);
 
@@ -1473,6 +1570,10 @@ static int run_benchmark(int async_jobs,
                 error = 1;
                 break;
             }
+            if (num_job_fds == 0) {
+                num_ready_jobs++;
+                continue;
+            }
             ASYNC_WAIT_CTX_get_all_fds(loopargs[i].wait_ctx, &job_fd,
                                        &num_job_fds);
             FD_SET(job_fd, &waitfdset);
@@ -1490,7 +1591,8 @@ static int run_benchmark(int async_jobs,
             break;
         }
 
-        select_result = select(max_fd + 1, &waitfdset, NULL, NULL, NULL);
+        select_result = select(max_fd + 1, &waitfdset, NULL, NULL,
+                               num_ready_jobs > 0 ? &no_wait : NULL);
         if (select_result == -1 && errno == EINTR)
             continue;
 
@@ -1501,7 +1603,7 @@ static int run_benchmark(int async_jobs,
             break;
         }
 
-        if (select_result == 0)
+        if (select_result == 0 && num_ready_jobs == 0)
             continue;
 #endif
 
@@ -2023,6 +2125,9 @@ int speed_main(int argc, char **argv)
         case OPT_PRIMES:
             primes = opt_int_arg();
             break;
+        case OPT_BATCH:
+            verify_batch = opt_int_arg();
+            break;
         case OPT_SECONDS:
             seconds.sym = seconds.rsa = seconds.dsa = seconds.ecdsa
                         = seconds.ecdh = seconds.eddsa
@@ -3415,11 +3520,28 @@ int speed_main(int argc, char **argv)
                 if (st != 1)
                     break;
             }
+            if (st == 1 && verify_batch > 1 && testnum == R_EC_Ed25519) {
+                for (i = 0; st == 1 && i < loopargs_len; i++)
+                    st = EdDSA_batch_setup(&loopargs[i]);
+            }
             if (st != 1) {
                 BIO_printf(bio_err,
                            "EdDSA verify failure.  No EdDSA verify will be done.\n");
                 ERR_print_errors(bio_err);
                 eddsa_doit[testnum] = 0;
+            } else if (verify_batch > 1 && testnum == R_EC_Ed25519) {
+                pkey_print_message("batch verify", ed_curves[testnum].name,
+                                   ed_curves[testnum].bits, seconds.eddsa);
+                Time_F(START);
+                count = run_benchmark(async_jobs, EdDSA_verify_batch_loop,
+                                      loopargs);
+                d = Time_F(STOP);
+                BIO_printf(bio_err,
+                           mr ? "+R11:%ld:%u:%s:%.2f\n"
+                           : "%ld %u bits %s verify ops in %.2fs\n",
+                           count, ed_curves[testnum].bits,
+                           ed_curves[testnum].name, d);
+                eddsa_results[testnum][1] = (double)count / d;
             } else {
                 pkey_print_message("verify", ed_curves[testnum].name,
                                    ed_curves[testnum].bits, seconds.eddsa);
@@ -4393,6 +4515,11 @@ int speed_main(int argc, char **argv)
             EVP_MD_CTX_free(loopargs[i].eddsa_ctx[k]);
             EVP_MD_CTX_free(loopargs[i].eddsa_ctx2[k]);
         }
+        OPENSSL_free(loopargs[i].eddsa_batch_buf);
+        OPENSSL_free(loopargs[i].eddsa_batch_sig);
+        OPENSSL_free(loopargs[i].eddsa_batch_tbs);
+        OPENSSL_free(loopargs[i].eddsa_batch_siglen);
+        OPENSSL_free(loopargs[i].eddsa_batch_tbslen);
 #endif /* OPENSSL_NO_ECX */
 #ifndef OPENSSL_NO_SM2
         for (k = 0; k < SM2_NUM; k++) {
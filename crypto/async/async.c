@@ -312,6 +312,99 @@ int ASYNC_pause_job(void)
     return 1;
 }
 
+#ifdef ASYNC_ARCH
+static const char async_wake_id[] = "async wake";
+
+static void async_wake_cleanup(ASYNC_WAIT_CTX *ctx, const void *key,
+                               OSSL_ASYNC_FD readfd, void *custom_data)
+{
+    OSSL_ASYNC_FD *writefd = custom_data;
+
+# if defined(ASYNC_WIN)
+    CloseHandle(readfd);
+    CloseHandle(*writefd);
+# else
+    close(readfd);
+    close(*writefd);
+# endif
+    OPENSSL_free(writefd);
+}
+#endif
+
+/*
+ * Pauses the current job and tells the caller to resume it straight away:
+ * the ASYNC_WAIT_CTX callback is called or, if there is none, a wait fd is
+ * made readable. This is for code which pauses only to give the caller the
+ * chance to start other jobs first, and which has nothing of its own to
+ * wait for. Returns 1 on success or 0 on error, in which case the job may
+ * not have been paused.
+ */
+int ossl_async_pause_job_woken(void)
+{
+#ifdef ASYNC_ARCH
+    async_ctx *ctx = async_get_ctx();
+    ASYNC_WAIT_CTX *waitctx;
+    ASYNC_callback_fn callback;
+    void *callback_arg;
+    OSSL_ASYNC_FD fds[2], *writefd;
+    char buf = 0;
+# if defined(ASYNC_WIN)
+    DWORD n;
+# endif
+
+    if (ctx == NULL
+            || ctx->currjob == NULL
+            || ctx->blocked
+            || (waitctx = ctx->currjob->waitctx) == NULL)
+        return 0;
+
+    if (ASYNC_WAIT_CTX_get_callback(waitctx, &callback, &callback_arg)) {
+        callback(callback_arg);
+        return ASYNC_pause_job();
+    }
+
+    if (!ASYNC_WAIT_CTX_get_fd(waitctx, async_wake_id, &fds[0],
+                               (void **)&writefd)) {
+        if ((writefd = OPENSSL_malloc(sizeof(*writefd))) == NULL)
+            return 0;
+# if defined(ASYNC_WIN)
+        if (!CreatePipe(&fds[0], &fds[1], NULL, 256)) {
+# else
+        if (pipe(fds) != 0) {
+# endif
+            OPENSSL_free(writefd);
+            return 0;
+        }
+        *writefd = fds[1];
+        if (!ASYNC_WAIT_CTX_set_wait_fd(waitctx, async_wake_id, fds[0],
+                                        writefd, async_wake_cleanup)) {
+            async_wake_cleanup(waitctx, async_wake_id, fds[0], writefd);
+            return 0;
+        }
+    }
+
+# if defined(ASYNC_WIN)
+    if (!WriteFile(*writefd, &buf, 1, &n, NULL) || n != 1)
+        return 0;
+    if (!ASYNC_pause_job())
+        return 0;
+    /* Clear the wake signal */
+    ReadFile(fds[0], &buf, 1, &n, NULL);
+# else
+    if (write(*writefd, &buf, 1) != 1)
+        return 0;
+    if (!ASYNC_pause_job())
+        return 0;
+    /* Clear the wake signal */
+    if (read(fds[0], &buf, 1) != 1)
+        return 0;
+# endif
+    return 1;
+#else
+    return 0;
+#endif
+}
+
 static void async_empty_pool(async_pool *pool)
 {
     ASYNC_JOB *job;
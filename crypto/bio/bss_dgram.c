@@ -101,6 +101,12 @@
 # if   M_METHOD == M_METHOD_RECVMMSG   \
     || M_METHOD == M_METHOD_RECVMSG    \
     || M_METHOD == M_METHOD_WSARECVMSG
+#  if defined(OPENSSL_SYS_LINUX) && M_METHOD != M_METHOD_WSARECVMSG
+#   include <netinet/udp.h>
+#   if defined(UDP_SEGMENT) && defined(UDP_GRO)
+#    define SUPPORT_SEGMENT_OFFLOAD
+#   endif
+#  endif
 #  if defined(__APPLE__)
     /*
      * CMSG_SPACE is not a constant expression on OSX even though POSIX
@@ -123,10 +129,17 @@
 #   else
 #     define BIO_CMSG_ALLOC_LEN_3   0
 #   endif
+#   if defined(SUPPORT_SEGMENT_OFFLOAD)
+     /* A UDP_SEGMENT or UDP_GRO message may follow the address */
+#     define BIO_CMSG_ALLOC_LEN_4   BIO_CMSG_SPACE(sizeof(int))
+#   else
+#     define BIO_CMSG_ALLOC_LEN_4   0
+#   endif
 #   define BIO_MAX(X,Y) ((X) > (Y) ? (X) : (Y))
 #   define BIO_CMSG_ALLOC_LEN                                        \
-        BIO_MAX(BIO_CMSG_ALLOC_LEN_1,                                \
-                BIO_MAX(BIO_CMSG_ALLOC_LEN_2, BIO_CMSG_ALLOC_LEN_3))
+        (BIO_MAX(BIO_CMSG_ALLOC_LEN_1,                               \
+                 BIO_MAX(BIO_CMSG_ALLOC_LEN_2, BIO_CMSG_ALLOC_LEN_3)) \
+         + BIO_CMSG_ALLOC_LEN_4)
 #  endif
 #  if (defined(IP_PKTINFO) || defined(IP_RECVDSTADDR)) && defined(IPV6_RECVPKTINFO)
 #   define SUPPORT_LOCAL_ADDR
@@ -212,6 +225,7 @@ typedef struct bio_dgram_data_st {
     OSSL_TIME socket_timeout;
     unsigned int peekmode;
     char local_addr_enabled;
+    uint32_t segment_offload;   /* BIO_DGRAM_SEGMENT_OFFLOAD_* enabled */
 } bio_dgram_data;
 
 # ifndef OPENSSL_NO_SCTP
@@ -540,6 +554,51 @@ static int enable_local_addr(BIO *b, int enable) {
 }
 # endif
 
+/*
+ * Determines which kinds of segmentation offload the socket supports. The UDP
+ * GSO and GRO options only exist for UDP sockets on kernels supporting them.
+ */
+static uint32_t dgram_get_segment_offload_cap(BIO *b)
+{
+    uint32_t ret = 0;
+# if defined(SUPPORT_SEGMENT_OFFLOAD)
+    int val;
+    socklen_t len = sizeof(val);
+
+    if (getsockopt(b->num, IPPROTO_UDP, UDP_SEGMENT, (void *)&val, &len) == 0)
+        ret |= BIO_DGRAM_SEGMENT_OFFLOAD_TX;
+
+    len = sizeof(val);
+    if (getsockopt(b->num, IPPROTO_UDP, UDP_GRO, (void *)&val, &len) == 0)
+        ret |= BIO_DGRAM_SEGMENT_OFFLOAD_RX;
+# endif
+
+    return ret;
+}
+
+/* Enables the given kinds of segmentation offload, disabling any others. */
+static int dgram_set_segment_offload(BIO *b, uint32_t offload)
+{
+    bio_dgram_data *data = (bio_dgram_data *)b->ptr;
+# if defined(SUPPORT_SEGMENT_OFFLOAD)
+    int gro = (offload & BIO_DGRAM_SEGMENT_OFFLOAD_RX) != 0;
+# endif
+
+    if ((offload & ~dgram_get_segment_offload_cap(b)) != 0)
+        return 0;
+
+# if defined(SUPPORT_SEGMENT_OFFLOAD)
+    /* GSO is requested per message, only GRO is a socket option */
+    if (gro != ((data->segment_offload & BIO_DGRAM_SEGMENT_OFFLOAD_RX) != 0)
+            && setsockopt(b->num, IPPROTO_UDP, UDP_GRO,
+                          (void *)&gro, sizeof(gro)) < 0)
+        return 0;
+# endif
+
+    data->segment_offload = offload;
+    return 1;
+}
+
 static long dgram_ctrl(BIO *b, int cmd, long num, void *ptr)
 {
     long ret = 1;
@@ -989,6 +1048,18 @@ static long dgram_ctrl(BIO *b, int cmd, long num, void *ptr)
         *(int *)ptr = data->local_addr_enabled;
         break;
 
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD_CAP:
+        ret = (long)dgram_get_segment_offload_cap(b);
+        break;
+
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD:
+        ret = (long)data->segment_offload;
+        break;
+
+    case BIO_CTRL_DGRAM_SET_SEGMENT_OFFLOAD:
+        ret = dgram_set_segment_offload(b, (uint32_t)num);
+        break;
+
     case BIO_CTRL_DGRAM_GET_EFFECTIVE_CAPS:
         ret = (long)(BIO_DGRAM_CAP_HANDLES_DST_ADDR
                      | BIO_DGRAM_CAP_HANDLES_SRC_ADDR
@@ -1282,6 +1353,67 @@ static int pack_local(BIO *b, MSGHDR_TYPE *mh, const BIO_ADDR *local) {
 }
 # endif
 
+# if defined(SUPPORT_SEGMENT_OFFLOAD)
+/*
+ * Returns the segment size to send a BIO_MSG with, or 0 if it is to be sent as
+ * a single datagram. The segment_size field is only present if the caller's
+ * stride covers it.
+ */
+static size_t msg_segment_size(BIO *b, const BIO_MSG *msg, size_t stride)
+{
+    bio_dgram_data *data = b->ptr;
+
+    if ((data->segment_offload & BIO_DGRAM_SEGMENT_OFFLOAD_TX) == 0
+            || stride < sizeof(BIO_MSG)
+            || msg->segment_size == 0
+            || msg->segment_size >= msg->data_len
+            || msg->segment_size > 0xffff)
+        return 0;
+
+    return msg->segment_size;
+}
+
+/*
+ * Appends a UDP_SEGMENT message to the control buffer, after the local address
+ * if there is one, so that the kernel splits the data into datagrams of
+ * segment_size bytes, the last of which may be shorter.
+ */
+static void pack_segment_size(struct msghdr *mh, unsigned char *control,
+                              size_t segment_size)
+{
+    struct cmsghdr *cmsg;
+    uint16_t val = (uint16_t)segment_size;
+
+    mh->msg_control     = control;
+    cmsg = (struct cmsghdr *)(control + mh->msg_controllen);
+    cmsg->cmsg_len      = CMSG_LEN(sizeof(val));
+    cmsg->cmsg_level    = IPPROTO_UDP;
+    cmsg->cmsg_type     = UDP_SEGMENT;
+    memcpy(CMSG_DATA(cmsg), &val, sizeof(val));
+    mh->msg_controllen += CMSG_SPACE(sizeof(val));
+}
+
+/*
+ * Returns the size of the datagrams coalesced into a received message, or 0 if
+ * the message holds a single datagram.
+ */
+static size_t extract_segment_size(struct msghdr *mh)
+{
+    struct cmsghdr *cmsg;
+    int val;
+
+    for (cmsg = CMSG_FIRSTHDR(mh); cmsg != NULL; cmsg = CMSG_NXTHDR(mh, cmsg)) {
+        if (cmsg->cmsg_level != IPPROTO_UDP || cmsg->cmsg_type != UDP_GRO)
+            continue;
+
+        memcpy(&val, CMSG_DATA(cmsg), sizeof(val));
+        return val > 0 ? (size_t)val : 0;
+    }
+
+    return 0;
+}
+# endif
+
 /*
  * Converts flags passed to BIO_sendmmsg or BIO_recvmmsg to syscall flags. You
  * should mask out any system flags returned by this function you cannot support
@@ -1308,6 +1440,9 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
     struct iovec iov[BIO_MAX_MSGS_PER_CALL];
     unsigned char control[BIO_MAX_MSGS_PER_CALL][BIO_CMSG_ALLOC_LEN];
     int have_local_enabled = data->local_addr_enabled;
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    size_t segment_size;
+#  endif
 # elif M_METHOD == M_METHOD_RECVMSG
     int sysflags;
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
@@ -1316,6 +1451,9 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
     struct iovec iov;
     unsigned char control[BIO_CMSG_ALLOC_LEN];
     int have_local_enabled = data->local_addr_enabled;
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    size_t segment_size;
+#  endif
 # elif M_METHOD == M_METHOD_WSARECVMSG
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
     int have_local_enabled = data->local_addr_enabled;
@@ -1370,6 +1508,12 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
                 return 0;
             }
         }
+
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+        segment_size = msg_segment_size(b, &BIO_MSG_N(msg, stride, i), stride);
+        if (segment_size > 0)
+            pack_segment_size(&mh[i].msg_hdr, control[i], segment_size);
+#  endif
     }
 
     /* Do the batch */
@@ -1408,6 +1552,12 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
         }
     }
 
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    segment_size = msg_segment_size(b, msg, stride);
+    if (segment_size > 0)
+        pack_segment_size(&mh, control, segment_size);
+#  endif
+
     l = sendmsg(b->num, &mh, sysflags);
     if (l < 0) {
         ERR_raise(ERR_LIB_SYS, get_last_socket_error());
@@ -1509,6 +1659,9 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
     struct iovec iov[BIO_MAX_MSGS_PER_CALL];
     unsigned char control[BIO_MAX_MSGS_PER_CALL][BIO_CMSG_ALLOC_LEN];
     int have_local_enabled = data->local_addr_enabled;
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    int have_gro = (data->segment_offload & BIO_DGRAM_SEGMENT_OFFLOAD_RX) != 0;
+#  endif
 # elif M_METHOD == M_METHOD_RECVMSG
     int sysflags;
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
@@ -1517,6 +1670,9 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
     struct iovec iov;
     unsigned char control[BIO_CMSG_ALLOC_LEN];
     int have_local_enabled = data->local_addr_enabled;
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    int have_gro = (data->segment_offload & BIO_DGRAM_SEGMENT_OFFLOAD_RX) != 0;
+#  endif
 # elif M_METHOD == M_METHOD_WSARECVMSG
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
     int have_local_enabled = data->local_addr_enabled;
@@ -1542,6 +1698,18 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
     sysflags = translate_flags(flags);
 # endif
 
+# if defined(SUPPORT_SEGMENT_OFFLOAD)
+    /*
+     * With GRO a message may hold several datagrams, which the caller cannot
+     * tell apart without the segment_size field.
+     */
+    if (have_gro && stride < sizeof(BIO_MSG)) {
+        ERR_raise(ERR_LIB_BIO, ERR_R_PASSED_INVALID_ARGUMENT);
+        *num_processed = 0;
+        return 0;
+    }
+# endif
+
 # if M_METHOD == M_METHOD_RECVMMSG
     /*
      * In the sendmmsg/recvmmsg case, we need to allocate our translated struct
@@ -1563,6 +1731,14 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
             *num_processed = 0;
             return 0;
         }
+
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+        /* The segment size of coalesced datagrams comes as control data */
+        if (have_gro) {
+            mh[i].msg_hdr.msg_control    = control[i];
+            mh[i].msg_hdr.msg_controllen = BIO_CMSG_ALLOC_LEN;
+        }
+#  endif
     }
 
     /* Do the batch */
@@ -1590,6 +1766,12 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
                  * (see below).
                  */
                 BIO_ADDR_clear(msg->local);
+
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+        if (have_gro)
+            BIO_MSG_N(msg, stride, i).segment_size
+                = extract_segment_size(&mh[i].msg_hdr);
+#  endif
     }
 
     *num_processed = (size_t)ret;
@@ -1612,6 +1794,13 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
         return 0;
     }
 
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    if (have_gro) {
+        mh.msg_control    = control;
+        mh.msg_controllen = BIO_CMSG_ALLOC_LEN;
+    }
+#  endif
+
     l = recvmsg(b->num, &mh, sysflags);
     if (l < 0) {
         ERR_raise(ERR_LIB_SYS, get_last_socket_error());
@@ -1647,6 +1836,11 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
              */
             BIO_ADDR_clear(msg->local);
 
+#  if defined(SUPPORT_SEGMENT_OFFLOAD)
+    if (have_gro)
+        msg->segment_size = extract_segment_size(&mh);
+#  endif
+
     *num_processed = 1;
     return 1;
 
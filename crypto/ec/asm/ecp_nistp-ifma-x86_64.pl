@@ -0,0 +1,413 @@
+#! /usr/bin/env perl
+# Copyright 2024 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+######################################################################
+# 8-way arithmetic modulo the P-384 and P-521 primes for processors with
+# AVX-512 IFMA.
+#
+# Eight independent field elements are processed at once, one per 64-bit
+# lane of 512-bit registers. Elements are kept in radix 2^52, with eight
+# limbs for P-384 and eleven for P-521, and limb j of all eight elements
+# is stored in one 64-byte row:
+#
+#	typedef uint64_t p384_fe52x8[8][8];
+#	typedef uint64_t p521_fe52x8[11][8];
+#
+# Multiplication is Montgomery multiplication with R = 2^(52*limbs),
+# i.e. 2^416 and 2^572. Inputs and outputs of all subroutines are
+# "normalized", i.e. every limb but the top one is less than 2^52, and
+# lazily reduced: values are in [0, 2*p). As R > 4*p, the Montgomery
+# product of two such values is in [0, 2*p) without final subtraction.
+#
+# The product is reduced while it is computed, one limb of the second
+# operand at a time, so that only limbs+1 accumulators are live. The
+# first operand is read from memory. Only %zmm0-5 and %zmm16-31 are
+# used, so that nothing has to be saved on Win64.
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+$avx512ifma=0;
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+        =~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+    $avx512ifma = ($1>=2.26);
+}
+
+if (!$avx512ifma && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+       `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)(?:\.([0-9]+))?/) {
+    $avx512ifma = ($1==2.11 && $2>=8) + ($1>=2.12);
+}
+
+if (!$avx512ifma && `$ENV{CC} -v 2>&1`
+    =~ /(Apple)?\s*((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)\.([0-9]+)?/) {
+    my $ver = $3 + $4/100.0 + $5/10000.0; # 3.1.0->3.01, 3.10.1->3.1001
+    if ($1) {
+        # Apple conditions, they use a different version series, see
+        # https://en.wikipedia.org/wiki/Xcode#Xcode_7.0_-_10.x_(since_Free_On-Device_Development)_2
+        # clang 7.0.0 is Apple clang 10.0.1
+        $avx512ifma = ($ver>=10.0001)
+    } else {
+        $avx512ifma = ($ver>=7.0);
+    }
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+# The moduli in radix 2^52. -p^-1 mod 2^52 is 2^32+1 for P-384 and 1 for
+# P-521.
+my %curves = (
+    nistp384 => [ 0xffffffff, 0xff00000000000, 0xffffffeffffff,
+                  0xfffffffffffff, 0xfffffffffffff, 0xfffffffffffff,
+                  0xfffffffffffff, 0xfffff ],
+    nistp521 => [ (0xfffffffffffff) x 10, 0x1 ],
+);
+my @funcs = ("mul_mont", "sqr_mont", "add", "sub", "div_by_2", "gather16");
+
+if ($avx512ifma>0) {{{
+
+my ($rp, $ap, $bp) = ("%rdi", "%rsi", "%rdx");
+
+my ($T0, $T1, $M) = ("%zmm0", "%zmm1", "%zmm2");
+my $MASK52 = "%zmm3";
+my @pool = (map("%zmm$_", (4, 5)), map("%zmm$_", (16..31)));
+
+my ($curve, $n, @poly, @P, @acc);
+
+# Address of limb $j of the element vector at $ptr
+sub limb { my ($ptr, $j) = @_; return (64 * $j)."($ptr)"; }
+
+# Limbs of the modulus equal to 2^52-1 share the mask register, the
+# others get one each from the pool, and the remaining registers of the
+# pool are accumulators.
+sub setup {
+    my %reg;
+    my $k = 0;
+
+    ($curve) = @_;
+    @poly = @{$curves{$curve}};
+    $n = scalar(@poly);
+    @P = ();
+    foreach (@poly) {
+	if ($_ == 0xfffffffffffff) {
+	    push @P, $MASK52;
+	} else {
+	    $reg{$_} = $pool[$k++] if (!defined($reg{$_}));
+	    push @P, $reg{$_};
+	}
+    }
+    @acc = @pool[$k..$#pool];
+    die "out of registers" if (scalar(@acc) < $n + 1);
+}
+
+sub load_constants {
+    my %done;
+
+    $code.="\tvpbroadcastq	.Lmask52(%rip), $MASK52\n";
+    for (my $i = 0; $i < $n; $i++) {
+	next if ($P[$i] eq $MASK52 || $done{$P[$i]}++);
+	$code.="\tvpbroadcastq	.L${curve}_poly+8*$i(%rip), $P[$i]\n";
+    }
+}
+
+sub prologue {
+    my ($func, $nargs) = @_;
+
+    $code.=<<___;
+
+.globl	ecp_${curve}_ifma_$func
+.type	ecp_${curve}_ifma_$func,\@function,$nargs
+.align	32
+ecp_${curve}_ifma_$func:
+.cfi_startproc
+	endbranch
+___
+}
+
+sub epilogue {
+    my ($func) = @_;
+
+    $code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_${curve}_ifma_$func,.-ecp_${curve}_ifma_$func
+___
+}
+
+# Propagate carries through @_[0..n-1]. With $signed the limbs may be
+# negative on input and the top limb carries the sign on output.
+sub carry {
+    my ($signed, @l) = @_;
+    my $shift = $signed ? "vpsraq" : "vpsrlq";
+
+    for (my $j = 0; $j < $n - 1; $j++) {
+	$code.=<<___;
+	$shift		\$52, $l[$j], $T1
+	vpandq		$MASK52, $l[$j], $l[$j]
+	vpaddq		$T1, $l[$j+1], $l[$j+1]
+___
+    }
+}
+
+# Given normalized s in [0, 4*p) in @acc[0..n-1], store s or s - 2*p,
+# whichever is in [0, 2*p), to ($rp).
+sub reduce_2p_store {
+    for (my $j = 0; $j < $n; $j++) {
+	$code.=<<___;
+	vmovdqu64	$acc[$j], @{[limb($rp, $j)]}
+	vpaddq		$P[$j], $P[$j], $T0
+	vpsubq		$T0, $acc[$j], $acc[$j]
+___
+    }
+    &carry(1, @acc);
+    $code.=<<___;
+	vpsraq		\$63, $acc[$n-1], $T1
+	vptestnmq	$T1, $T1, %k2
+___
+    for (my $j = 0; $j < $n; $j++) {
+	$code.="\tvmovdqu64	$acc[$j], ".limb($rp, $j)."\{%k2\}\n";
+    }
+}
+
+# r = a * b * R^-1, with the product of a[] and b[j] and the multiple of
+# p that clears the lowest limb accumulated one j at a time
+sub mul_mont {
+    my ($bp) = @_;
+    my @a = @acc[0..$n];
+
+    for (my $k = 0; $k <= $n; $k++) {
+	$code.="\tvpxorq		$a[$k], $a[$k], $a[$k]\n";
+    }
+    for (my $j = 0; $j < $n; $j++) {
+	$code.="\tvmovdqu64	".limb($bp, $j).", $T0\n";
+	for (my $i = 0; $i < $n; $i++) {
+	    $code.=<<___;
+	vpmadd52luq	@{[limb($ap, $i)]}, $T0, $a[$i]
+	vpmadd52huq	@{[limb($ap, $i)]}, $T0, $a[$i+1]
+___
+	}
+	if ($poly[0] == 0xfffffffffffff) {
+	    $code.="\tvpandq		$MASK52, $a[0], $M\n";
+	} else {	# P-384, multiply by 2^32+1
+	    $code.=<<___;
+	vpsllq		\$32, $a[0], $M
+	vpaddq		$a[0], $M, $M
+	vpandq		$MASK52, $M, $M
+___
+	}
+	for (my $i = 0; $i < $n; $i++) {
+	    if ($poly[$i] == 1) {
+		$code.="\tvpaddq		$M, $a[$i], $a[$i]\n";
+		next;
+	    }
+	    $code.=<<___;
+	vpmadd52luq	$P[$i], $M, $a[$i]
+	vpmadd52huq	$P[$i], $M, $a[$i+1]
+___
+	}
+	$code.=<<___;
+	vpsrlq		\$52, $a[0], $T1
+	vpaddq		$T1, $a[1], $a[1]
+___
+	# the lowest limb is now zero, it becomes the new top limb
+	push @a, shift @a;
+	$code.="\tvpxorq		$a[$n], $a[$n], $a[$n]\n" if ($j < $n - 1);
+    }
+    &carry(0, @a);
+    for (my $j = 0; $j < $n; $j++) {
+	$code.="\tvmovdqu64	$a[$j], ".limb($rp, $j)."\n";
+    }
+}
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+.globl	ecp_nistp_ifma_eligible
+.type	ecp_nistp_ifma_eligible,\@abi-omnipotent
+.align	32
+ecp_nistp_ifma_eligible:
+	mov	OPENSSL_ia32cap_P+8(%rip), %ecx
+	xor	%eax, %eax
+	and	\$`1<<21|1<<16`, %ecx		# avx512ifma + avx512f
+	cmp	\$`1<<21|1<<16`, %ecx
+	cmove	%ecx, %eax
+	ret
+.size	ecp_nistp_ifma_eligible,.-ecp_nistp_ifma_eligible
+
+___
+
+foreach $curve (sort keys %curves) {
+    &setup($curve);
+
+######################################################################
+# void ecp_nistpNNN_ifma_mul_mont(fe52x8 r, const fe52x8 a,
+#                                 const fe52x8 b);
+#
+# r = a * b * R^-1 mod p
+&prologue("mul_mont", 3);
+&load_constants();
+&mul_mont($bp);
+&epilogue("mul_mont");
+
+######################################################################
+# void ecp_nistpNNN_ifma_sqr_mont(fe52x8 r, const fe52x8 a);
+#
+# r = a^2 * R^-1 mod p
+&prologue("sqr_mont", 2);
+&load_constants();
+&mul_mont($ap);
+&epilogue("sqr_mont");
+
+######################################################################
+# void ecp_nistpNNN_ifma_add(fe52x8 r, const fe52x8 a, const fe52x8 b);
+#
+# r = a + b mod p
+&prologue("add", 3);
+&load_constants();
+for (my $j = 0; $j < $n; $j++) {
+    $code.=<<___;
+	vmovdqu64	@{[limb($ap, $j)]}, $acc[$j]
+	vpaddq		@{[limb($bp, $j)]}, $acc[$j], $acc[$j]
+___
+}
+&carry(0, @acc);
+&reduce_2p_store();
+&epilogue("add");
+
+######################################################################
+# void ecp_nistpNNN_ifma_sub(fe52x8 r, const fe52x8 a, const fe52x8 b);
+#
+# r = a - b mod p, computed as a + 2*p - b to keep the result positive
+&prologue("sub", 3);
+&load_constants();
+for (my $j = 0; $j < $n; $j++) {
+    $code.=<<___;
+	vmovdqu64	@{[limb($ap, $j)]}, $acc[$j]
+	vpsubq		@{[limb($bp, $j)]}, $acc[$j], $acc[$j]
+	vpaddq		$P[$j], $acc[$j], $acc[$j]
+	vpaddq		$P[$j], $acc[$j], $acc[$j]
+___
+}
+&carry(1, @acc);
+&reduce_2p_store();
+&epilogue("sub");
+
+######################################################################
+# void ecp_nistpNNN_ifma_div_by_2(fe52x8 r, const fe52x8 a);
+#
+# r = a / 2 mod p, computed as (a + p) / 2 in lanes where a is odd
+&prologue("div_by_2", 2);
+&load_constants();
+for (my $j = 0; $j < $n; $j++) {
+    $code.="\tvmovdqu64	".limb($ap, $j).", $acc[$j]\n";
+}
+$code.=<<___;
+	vpsllq		\$63, $acc[0], $T0
+	vptestmq	$T0, $T0, %k1
+___
+for (my $j = 0; $j < $n; $j++) {
+    $code.="\tvpaddq		$P[$j], $acc[$j], $acc[$j]\{%k1\}\n";
+}
+&carry(0, @acc);
+for (my $j = 0; $j < $n; $j++) {
+    $code.="\tvpsrlq		\$1, $acc[$j], $acc[$j]\n";
+    $code.=<<___ if ($j < $n - 1);
+	vpsllq		\$51, $acc[$j+1], $T0
+	vpandq		$MASK52, $T0, $T0
+	vporq		$T0, $acc[$j], $acc[$j]
+___
+    $code.="\tvmovdqu64	$acc[$j], ".limb($rp, $j)."\n";
+}
+&epilogue("div_by_2");
+
+######################################################################
+# void ecp_nistpNNN_ifma_gather16(fe52x8 x, fe52x8 y,
+#                                 const uint64_t in_t[2][][16],
+#                                 const uint64_t idx[8]);
+#
+# Constant-time gather of point idx[k] of a table of 16 affine points
+# into lane k of x and y. The table is stored limb by limb, with limb j of
+# the 16 x coordinates in in_t[0][j] and of the y coordinates in
+# in_t[1][j], and each row is picked by VPERMI2Q.
+{
+my ($xp, $yp, $tbl, $idx) = ("%rdi", "%rsi", "%rdx", "%rcx");
+my $IDX = $M;
+
+&prologue("gather16", 4);
+$code.="\tvmovdqu64	($idx), $IDX\n";
+for (my $j = 0; $j < 2 * $n; $j++) {
+    my $out = $j < $n ? limb($xp, $j) : limb($yp, $j - $n);
+
+    $code.=<<___;
+	vmovdqa64	$IDX, $T0
+	vmovdqu64	128*$j($tbl), $T1
+	vpermi2q	128*$j+64($tbl), $T1, $T0
+	vmovdqu64	$T0, $out
+___
+}
+&epilogue("gather16");
+}
+}
+
+$code.=<<___;
+
+.data
+.align	64
+.Lmask52:
+	.quad	0xfffffffffffff
+___
+foreach $curve (sort keys %curves) {
+    $code.=".L${curve}_poly:\n";
+    $code.="\t.quad	".join(",", map(sprintf("0x%x", $_), @{$curves{$curve}}))."\n";
+}
+$code.=<<___;
+.asciz	"P-384/P-521 8-way AVX-512 IFMA field arithmetic, CRYPTOGAMS by <appro\@openssl.org>"
+___
+
+}}} else {{{		# fallback for old assembler
+$code.=<<___;
+.text
+
+.globl	ecp_nistp_ifma_eligible
+.type	ecp_nistp_ifma_eligible,\@abi-omnipotent
+ecp_nistp_ifma_eligible:
+	xor	%eax,%eax
+	ret
+.size	ecp_nistp_ifma_eligible,.-ecp_nistp_ifma_eligible
+___
+foreach $curve (sort keys %curves) {
+    foreach (@funcs) {
+	$code.=".globl	ecp_${curve}_ifma_$_\n";
+    }
+    $code.=".type	ecp_${curve}_ifma_mul_mont,\@abi-omnipotent\n";
+    foreach (@funcs) {
+	$code.="ecp_${curve}_ifma_$_:\n";
+    }
+    $code.=<<___;
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	ecp_${curve}_ifma_mul_mont,.-ecp_${curve}_ifma_mul_mont
+___
+}
+}}}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -0,0 +1,486 @@
+#! /usr/bin/env perl
+# Copyright 2024 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+######################################################################
+# 8-way arithmetic modulo the P-256 prime for processors with AVX-512
+# IFMA.
+#
+# Eight independent field elements are processed at once, one per 64-bit
+# lane of 512-bit registers. Elements are kept in radix 2^52 with five
+# limbs, and limb j of all eight elements is stored in one 64-byte row:
+#
+#	typedef uint64_t p256_fe52x8[5][8];
+#
+# Multiplication is Montgomery multiplication with R = 2^260. Inputs and
+# outputs of all subroutines are "normalized", i.e. every limb is less
+# than 2^52, and lazily reduced: values are in [0, 2*p). As 2^260 > 4*p,
+# the Montgomery product of two such values is in [0, 2*p) without final
+# subtraction.
+#
+# Only %zmm0-5 and %zmm16-31 are used, so that nothing has to be saved
+# on Win64.
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+$avx512ifma=0;
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+        =~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+    $avx512ifma = ($1>=2.26);
+}
+
+if (!$avx512ifma && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+       `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)(?:\.([0-9]+))?/) {
+    $avx512ifma = ($1==2.11 && $2>=8) + ($1>=2.12);
+}
+
+if (!$avx512ifma && `$ENV{CC} -v 2>&1`
+    =~ /(Apple)?\s*((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)\.([0-9]+)?/) {
+    my $ver = $3 + $4/100.0 + $5/10000.0; # 3.1.0->3.01, 3.10.1->3.1001
+    if ($1) {
+        # Apple conditions, they use a different version series, see
+        # https://en.wikipedia.org/wiki/Xcode#Xcode_7.0_-_10.x_(since_Free_On-Device_Development)_2
+        # clang 7.0.0 is Apple clang 10.0.1
+        $avx512ifma = ($ver>=10.0001)
+    } else {
+        $avx512ifma = ($ver>=7.0);
+    }
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+if ($avx512ifma>0) {{{
+
+my ($rp, $ap, $bp) = ("%rdi", "%rsi", "%rdx");
+
+my @acc = map("%zmm$_", (16..25));	# column accumulators
+my @a = map("%zmm$_", (0..4));		# limbs of the first operand
+my ($T0, $T1) = ("%zmm5", "%zmm26");
+my ($MASK52, $P0, $P1, $P3, $P4) = map("%zmm$_", (27..31));
+my @P = ($P0, $P1, undef, $P3, $P4);	# limb 2 of the modulus is zero
+
+# Address of limb $j of the element vector at $ptr
+sub limb { my ($ptr, $j) = @_; return (64 * $j)."($ptr)"; }
+
+sub load_constants {
+    $code.=<<___;
+	vpbroadcastq	.Lmask52(%rip), $MASK52
+	vpbroadcastq	.Lpoly+8*0(%rip), $P0
+	vpbroadcastq	.Lpoly+8*1(%rip), $P1
+	vpbroadcastq	.Lpoly+8*3(%rip), $P3
+	vpbroadcastq	.Lpoly+8*4(%rip), $P4
+___
+}
+
+# Montgomery reduction of the ten column sums of a product. As the lowest
+# limb of the modulus is 2^52-1, -p^-1 mod 2^52 is 1 and the multiplier of
+# each step is simply the low limb of the accumulator. The result ends up
+# in accumulators 5..9, which are normalized and stored to ($rp).
+sub mont_reduce_store {
+    for (my $k = 0; $k < 5; $k++) {
+	$code.="\tvpandq		$MASK52, $acc[$k], $T0\n";
+	for (my $i = 0; $i < 5; $i++) {
+	    next if ($i == 2);
+	    $code.="\tvpmadd52luq	$P[$i], $T0, $acc[$k+$i]\n";
+	    $code.="\tvpmadd52huq	$P[$i], $T0, $acc[$k+$i+1]\n";
+	}
+	$code.=<<___;
+	vpsrlq		\$52, $acc[$k], $T1
+	vpaddq		$T1, $acc[$k+1], $acc[$k+1]
+___
+    }
+    for (my $k = 5; $k < 9; $k++) {
+	$code.=<<___;
+	vpsrlq		\$52, $acc[$k], $T1
+	vpandq		$MASK52, $acc[$k], $acc[$k]
+	vpaddq		$T1, $acc[$k+1], $acc[$k+1]
+___
+    }
+    for (my $j = 0; $j < 5; $j++) {
+	$code.="\tvmovdqu64	$acc[$j+5], ".limb($rp, $j)."\n";
+    }
+}
+
+# Propagate carries through @_[0..4]. With $signed the limbs may be
+# negative on input and the top limb carries the sign on output.
+sub carry {
+    my ($signed, @l) = @_;
+    my $shift = $signed ? "vpsraq" : "vpsrlq";
+
+    for (my $j = 0; $j < 4; $j++) {
+	$code.=<<___;
+	$shift		\$52, $l[$j], $T1
+	vpandq		$MASK52, $l[$j], $l[$j]
+	vpaddq		$T1, $l[$j+1], $l[$j+1]
+___
+    }
+}
+
+# Given s in [0, 4*p) in @acc[0..4], store s or s - 2*p, whichever is in
+# [0, 2*p), to ($rp).
+sub reduce_2p_store {
+    for (my $j = 0; $j < 5; $j++) {
+	if ($j == 2) {
+	    $code.="\tvmovdqa64	$acc[$j], $acc[$j+5]\n";
+	    next;
+	}
+	$code.=<<___;
+	vpaddq		$P[$j], $P[$j], $T0
+	vpsubq		$T0, $acc[$j], $acc[$j+5]
+___
+    }
+    &carry(1, @acc[5..9]);
+    $code.=<<___;
+	vpsraq		\$63, $acc[9], $T1
+	vptestmq	$T1, $T1, %k2
+___
+    for (my $j = 0; $j < 5; $j++) {
+	$code.=<<___;
+	vpblendmq	$acc[$j], $acc[$j+5], $acc[$j+5]\{%k2\}
+	vmovdqu64	$acc[$j+5], @{[limb($rp, $j)]}
+___
+    }
+}
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+.globl	ecp_nistz256_ifma_eligible
+.type	ecp_nistz256_ifma_eligible,\@abi-omnipotent
+.align	32
+ecp_nistz256_ifma_eligible:
+	mov	OPENSSL_ia32cap_P+8(%rip), %ecx
+	xor	%eax, %eax
+	and	\$`1<<21|1<<16`, %ecx		# avx512ifma + avx512f
+	cmp	\$`1<<21|1<<16`, %ecx
+	cmove	%ecx, %eax
+	ret
+.size	ecp_nistz256_ifma_eligible,.-ecp_nistz256_ifma_eligible
+___
+
+######################################################################
+# void ecp_nistz256_ifma_mul_mont(p256_fe52x8 r, const p256_fe52x8 a,
+#                                 const p256_fe52x8 b);
+#
+# r = a * b * 2^-260 mod p
+$code.=<<___;
+
+.globl	ecp_nistz256_ifma_mul_mont
+.type	ecp_nistz256_ifma_mul_mont,\@function,3
+.align	32
+ecp_nistz256_ifma_mul_mont:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+for (my $i = 0; $i < 5; $i++) {
+    $code.="\tvmovdqu64	".limb($ap, $i).", $a[$i]\n";
+}
+for (my $k = 0; $k < 10; $k++) {
+    $code.="\tvpxorq		$acc[$k], $acc[$k], $acc[$k]\n";
+}
+for (my $j = 0; $j < 5; $j++) {
+    $code.="\tvmovdqu64	".limb($bp, $j).", $T0\n";
+    for (my $i = 0; $i < 5; $i++) {
+	$code.=<<___;
+	vpmadd52luq	$T0, $a[$i], $acc[$i+$j]
+	vpmadd52huq	$T0, $a[$i], $acc[$i+$j+1]
+___
+    }
+}
+&mont_reduce_store();
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_nistz256_ifma_mul_mont,.-ecp_nistz256_ifma_mul_mont
+___
+
+######################################################################
+# void ecp_nistz256_ifma_sqr_mont(p256_fe52x8 r, const p256_fe52x8 a);
+#
+# r = a^2 * 2^-260 mod p
+$code.=<<___;
+
+.globl	ecp_nistz256_ifma_sqr_mont
+.type	ecp_nistz256_ifma_sqr_mont,\@function,2
+.align	32
+ecp_nistz256_ifma_sqr_mont:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+for (my $i = 0; $i < 5; $i++) {
+    $code.="\tvmovdqu64	".limb($ap, $i).", $a[$i]\n";
+}
+for (my $k = 0; $k < 10; $k++) {
+    $code.="\tvpxorq		$acc[$k], $acc[$k], $acc[$k]\n";
+}
+# cross products, doubled below
+for (my $i = 0; $i < 5; $i++) {
+    for (my $j = $i + 1; $j < 5; $j++) {
+	$code.=<<___;
+	vpmadd52luq	$a[$j], $a[$i], $acc[$i+$j]
+	vpmadd52huq	$a[$j], $a[$i], $acc[$i+$j+1]
+___
+    }
+}
+for (my $k = 1; $k < 9; $k++) {
+    $code.="\tvpaddq		$acc[$k], $acc[$k], $acc[$k]\n";
+}
+for (my $i = 0; $i < 5; $i++) {
+    $code.=<<___;
+	vpmadd52luq	$a[$i], $a[$i], $acc[2*$i]
+	vpmadd52huq	$a[$i], $a[$i], $acc[2*$i+1]
+___
+}
+&mont_reduce_store();
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_nistz256_ifma_sqr_mont,.-ecp_nistz256_ifma_sqr_mont
+___
+
+######################################################################
+# void ecp_nistz256_ifma_add(p256_fe52x8 r, const p256_fe52x8 a,
+#                            const p256_fe52x8 b);
+#
+# r = a + b mod p
+$code.=<<___;
+
+.globl	ecp_nistz256_ifma_add
+.type	ecp_nistz256_ifma_add,\@function,3
+.align	32
+ecp_nistz256_ifma_add:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+for (my $j = 0; $j < 5; $j++) {
+    $code.=<<___;
+	vmovdqu64	@{[limb($ap, $j)]}, $acc[$j]
+	vpaddq		@{[limb($bp, $j)]}, $acc[$j], $acc[$j]
+___
+}
+&carry(0, @acc[0..4]);
+&reduce_2p_store();
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_nistz256_ifma_add,.-ecp_nistz256_ifma_add
+___
+
+######################################################################
+# void ecp_nistz256_ifma_sub(p256_fe52x8 r, const p256_fe52x8 a,
+#                            const p256_fe52x8 b);
+#
+# r = a - b mod p, computed as a + 2*p - b to keep the result positive
+$code.=<<___;
+
+.globl	ecp_nistz256_ifma_sub
+.type	ecp_nistz256_ifma_sub,\@function,3
+.align	32
+ecp_nistz256_ifma_sub:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+for (my $j = 0; $j < 5; $j++) {
+    $code.=<<___;
+	vmovdqu64	@{[limb($ap, $j)]}, $acc[$j]
+	vpsubq		@{[limb($bp, $j)]}, $acc[$j], $acc[$j]
+___
+    $code.=<<___ if ($j != 2);
+	vpaddq		$P[$j], $acc[$j], $acc[$j]
+	vpaddq		$P[$j], $acc[$j], $acc[$j]
+___
+}
+&carry(1, @acc[0..4]);
+&reduce_2p_store();
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_nistz256_ifma_sub,.-ecp_nistz256_ifma_sub
+___
+
+######################################################################
+# void ecp_nistz256_ifma_div_by_2(p256_fe52x8 r, const p256_fe52x8 a);
+#
+# r = a / 2 mod p, computed as (a + p) / 2 in lanes where a is odd
+$code.=<<___;
+
+.globl	ecp_nistz256_ifma_div_by_2
+.type	ecp_nistz256_ifma_div_by_2,\@function,2
+.align	32
+ecp_nistz256_ifma_div_by_2:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+for (my $j = 0; $j < 5; $j++) {
+    $code.="\tvmovdqu64	".limb($ap, $j).", $acc[$j]\n";
+}
+$code.=<<___;
+	vpsllq		\$63, $acc[0], $T0
+	vptestmq	$T0, $T0, %k1
+___
+for (my $j = 0; $j < 5; $j++) {
+    next if ($j == 2);
+    $code.="\tvpaddq		$P[$j], $acc[$j], $acc[$j]\{%k1\}\n";
+}
+&carry(0, @acc[0..4]);
+for (my $j = 0; $j < 5; $j++) {
+    $code.="\tvpsrlq		\$1, $acc[$j], $acc[$j]\n";
+    $code.=<<___ if ($j < 4);
+	vpsllq		\$51, $acc[$j+1], $T0
+	vpandq		$MASK52, $T0, $T0
+	vporq		$T0, $acc[$j], $acc[$j]
+___
+    $code.="\tvmovdqu64	$acc[$j], ".limb($rp, $j)."\n";
+}
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_nistz256_ifma_div_by_2,.-ecp_nistz256_ifma_div_by_2
+___
+
+######################################################################
+# void ecp_nistz256_ifma_gather_w7(p256_fe52x8 r[2],
+#                                  const P256_POINT_AFFINE in_t[64],
+#                                  const uint64_t idx[8]);
+#
+# Constant-time gather of affine point idx[k] from a row of 64 points in
+# the 4x64-bit format of ecp_nistz256-x86_64.pl into lane k of r[0] (X)
+# and r[1] (Y), converted to radix 2^52. Index 0 selects (0,0).
+{
+my ($tbl, $idx) = ($ap, $bp);
+my @row = map("%zmm$_", (16..23));
+my ($IDX, $CUR, $ONE) = map("%zmm$_", (24..26));
+
+$code.=<<___;
+
+.globl	ecp_nistz256_ifma_gather_w7
+.type	ecp_nistz256_ifma_gather_w7,\@function,3
+.align	32
+ecp_nistz256_ifma_gather_w7:
+.cfi_startproc
+	endbranch
+	vpbroadcastq	.Lmask52(%rip), $MASK52
+	vpbroadcastq	.Lone(%rip), $ONE
+	vmovdqu64	($idx), $IDX
+	vpxorq		$CUR, $CUR, $CUR
+___
+for (my $m = 0; $m < 8; $m++) {
+    $code.="\tvpxorq		$row[$m], $row[$m], $row[$m]\n";
+}
+$code.=<<___;
+	mov	\$64, %eax
+.Lgather_w7_loop:
+	vpaddq		$ONE, $CUR, $CUR
+	vpcmpeqq	$CUR, $IDX, %k1
+___
+for (my $m = 0; $m < 8; $m++) {
+    $code.="\tvpbroadcastq	8*$m($tbl), $row[$m]\{%k1\}\n";
+}
+$code.=<<___;
+	lea	64($tbl), $tbl
+	dec	%eax
+	jnz	.Lgather_w7_loop
+___
+# convert X in rows 0..3 and Y in rows 4..7 to radix 2^52
+for (my $c = 0; $c < 2; $c++) {
+    my @w = @row[4*$c..4*$c+3];
+    my $o = 320 * $c;
+
+    $code.=<<___;
+	vpandq		$MASK52, $w[0], $T0
+	vmovdqu64	$T0, $o+64*0($rp)
+___
+    for (my $j = 1; $j < 4; $j++) {
+	$code.=<<___;
+	vpsrlq		\$@{[64 - 12 * $j]}, $w[$j-1], $T0
+	vpsllq		\$@{[12 * $j]}, $w[$j], $T1
+	vporq		$T1, $T0, $T0
+	vpandq		$MASK52, $T0, $T0
+	vmovdqu64	$T0, $o+64*$j($rp)
+___
+    }
+    $code.=<<___;
+	vpsrlq		\$16, $w[3], $T0
+	vmovdqu64	$T0, $o+64*4($rp)
+___
+}
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	ecp_nistz256_ifma_gather_w7,.-ecp_nistz256_ifma_gather_w7
+___
+}
+
+$code.=<<___;
+.data
+.align	64
+.Lpoly:		# the P-256 prime in radix 2^52
+	.quad	0xfffffffffffff,0xfffffffffff,0,0x1000000000,0xffffffff0000
+.Lmask52:
+	.quad	0xfffffffffffff
+.Lone:
+	.quad	1
+.asciz	"P-256 8-way AVX-512 IFMA field arithmetic, CRYPTOGAMS by <appro\@openssl.org>"
+___
+
+}}} else {{{		# fallback for old assembler
+$code.=<<___;
+.text
+
+.globl	ecp_nistz256_ifma_eligible
+.type	ecp_nistz256_ifma_eligible,\@abi-omnipotent
+ecp_nistz256_ifma_eligible:
+	xor	%eax,%eax
+	ret
+.size	ecp_nistz256_ifma_eligible,.-ecp_nistz256_ifma_eligible
+
+.globl	ecp_nistz256_ifma_mul_mont
+.globl	ecp_nistz256_ifma_sqr_mont
+.globl	ecp_nistz256_ifma_add
+.globl	ecp_nistz256_ifma_sub
+.globl	ecp_nistz256_ifma_div_by_2
+.globl	ecp_nistz256_ifma_gather_w7
+.type	ecp_nistz256_ifma_mul_mont,\@abi-omnipotent
+ecp_nistz256_ifma_mul_mont:
+ecp_nistz256_ifma_sqr_mont:
+ecp_nistz256_ifma_add:
+ecp_nistz256_ifma_sub:
+ecp_nistz256_ifma_div_by_2:
+ecp_nistz256_ifma_gather_w7:
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	ecp_nistz256_ifma_mul_mont,.-ecp_nistz256_ifma_mul_mont
+___
+}}}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -0,0 +1,428 @@
+#! /usr/bin/env perl
+# Copyright 2024 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+######################################################################
+# 8-way X25519 for processors with AVX-512 IFMA.
+#
+# Eight independent Montgomery ladders are computed at once, one per
+# 64-bit lane of 512-bit registers. Field elements are kept in radix
+# 2^52 with five limbs, and limb j of all eight elements is stored in
+# one 64-byte row, i.e. an element vector is 5x8 qwords:
+#
+#	typedef uint64_t fe52x8[5][8];
+#
+# Unless noted otherwise subroutine inputs and outputs are "normalized":
+# limbs 0..3 are less than 2^52 and limb 4 is less than 2^48. Values
+# are only partially reduced modulo 2^255-19, full reduction is left to
+# the caller.
+#
+# Only %zmm0-5 and %zmm16-31 are used, so that nothing has to be saved
+# on Win64.
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+$avx512ifma=0;
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+        =~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+    $avx512ifma = ($1>=2.26);
+}
+
+if (!$avx512ifma && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+       `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)(?:\.([0-9]+))?/) {
+    $avx512ifma = ($1==2.11 && $2>=8) + ($1>=2.12);
+}
+
+if (!$avx512ifma && `$ENV{CC} -v 2>&1`
+    =~ /(Apple)?\s*((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)\.([0-9]+)?/) {
+    my $ver = $3 + $4/100.0 + $5/10000.0; # 3.1.0->3.01, 3.10.1->3.1001
+    if ($1) {
+        # Apple conditions, they use a different version series, see
+        # https://en.wikipedia.org/wiki/Xcode#Xcode_7.0_-_10.x_(since_Free_On-Device_Development)_2
+        # clang 7.0.0 is Apple clang 10.0.1
+        $avx512ifma = ($ver>=10.0001)
+    } else {
+        $avx512ifma = ($ver>=7.0);
+    }
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+if ($avx512ifma>0) {{{
+
+my @acc = map("%zmm$_", (16..25));	# column accumulators
+my @f = map("%zmm$_", (0..4));		# limbs of the first operand
+my ($T0, $T1) = ("%zmm5", "%zmm26");
+my ($MASK52, $MASK47, $C19, $C608, $C121666) = map("%zmm$_", (27..31));
+
+# Address of limb $j of the element vector at $off($ptr)
+sub limb { my ($ptr, $off, $j) = @_; return ($off + 64 * $j)."($ptr)"; }
+
+# Reduce accumulators 0..4, each less than 2^62, to normalized form:
+# fold the bits above 2^255 into limb 0 and propagate the carries.
+sub normalize {
+    $code.=<<___;
+	vpsrlq		\$47, $acc[4], $T1
+	vpandq		$MASK47, $acc[4], $acc[4]
+	vpmadd52luq	$C19, $T1, $acc[0]
+___
+    for (my $k = 0; $k < 4; $k++) {
+	$code.=<<___;
+	vpsrlq		\$52, $acc[$k], $T1
+	vpandq		$MASK52, $acc[$k], $acc[$k]
+	vpaddq		$T1, $acc[$k+1], $acc[$k+1]
+___
+    }
+}
+
+# Reduce the ten column sums of a product, each less than 2^57, to
+# normalized form. Columns 5..9 are carried into 52-bit limbs and folded
+# into columns 0..4 using 2^260 = 608 mod 2^255-19.
+sub reduce {
+    for (my $k = 0; $k < 9; $k++) {
+	$code.=<<___;
+	vpsrlq		\$52, $acc[$k], $T1
+	vpandq		$MASK52, $acc[$k], $acc[$k]
+	vpaddq		$T1, $acc[$k+1], $acc[$k+1]
+___
+    }
+    $code.=<<___;
+	vpxorq		$T1, $T1, $T1
+	vpmadd52huq	$C608, $acc[9], $T1
+___
+    for (my $k = 5; $k < 10; $k++) {
+	$code.=<<___;
+	vpmadd52luq	$C608, $acc[$k], $acc[$k-5]
+___
+	$code.=<<___ if ($k < 9);
+	vpmadd52huq	$C608, $acc[$k], $acc[$k-4]
+___
+    }
+    $code.=<<___;
+	vpmadd52luq	$C608, $T1, $acc[0]
+___
+    &normalize();
+}
+
+sub store {
+    my ($hp, $ho) = @_;
+
+    for (my $j = 0; $j < 5; $j++) {
+	$code.="\tvmovdqu64	$acc[$j], ".limb($hp, $ho, $j)."\n";
+    }
+}
+
+# h = f * g
+sub fe_mul {
+    my ($hp, $ho, $fp, $fo, $gp, $go) = @_;
+
+    for (my $i = 0; $i < 5; $i++) {
+	$code.="\tvmovdqu64	".limb($fp, $fo, $i).", $f[$i]\n";
+    }
+    for (my $k = 0; $k < 10; $k++) {
+	$code.="\tvpxorq		$acc[$k], $acc[$k], $acc[$k]\n";
+    }
+    for (my $j = 0; $j < 5; $j++) {
+	$code.="\tvmovdqu64	".limb($gp, $go, $j).", $T0\n";
+	for (my $i = 0; $i < 5; $i++) {
+	    $code.=<<___;
+	vpmadd52luq	$T0, $f[$i], $acc[$i+$j]
+	vpmadd52huq	$T0, $f[$i], $acc[$i+$j+1]
+___
+	}
+    }
+    &reduce();
+    &store($hp, $ho);
+}
+
+# h = f^2
+sub fe_sqr {
+    my ($hp, $ho, $fp, $fo) = @_;
+
+    for (my $i = 0; $i < 5; $i++) {
+	$code.="\tvmovdqu64	".limb($fp, $fo, $i).", $f[$i]\n";
+    }
+    for (my $k = 0; $k < 10; $k++) {
+	$code.="\tvpxorq		$acc[$k], $acc[$k], $acc[$k]\n";
+    }
+    # cross products, doubled below
+    for (my $i = 0; $i < 5; $i++) {
+	for (my $j = $i + 1; $j < 5; $j++) {
+	    $code.=<<___;
+	vpmadd52luq	$f[$j], $f[$i], $acc[$i+$j]
+	vpmadd52huq	$f[$j], $f[$i], $acc[$i+$j+1]
+___
+	}
+    }
+    for (my $k = 1; $k < 9; $k++) {
+	$code.="\tvpaddq		$acc[$k], $acc[$k], $acc[$k]\n";
+    }
+    for (my $i = 0; $i < 5; $i++) {
+	$code.=<<___;
+	vpmadd52luq	$f[$i], $f[$i], $acc[2*$i]
+	vpmadd52huq	$f[$i], $f[$i], $acc[2*$i+1]
+___
+    }
+    &reduce();
+    &store($hp, $ho);
+}
+
+# h = f + g
+sub fe_add {
+    my ($hp, $ho, $fp, $fo, $gp, $go) = @_;
+
+    for (my $j = 0; $j < 5; $j++) {
+	$code.=<<___;
+	vmovdqu64	@{[limb($fp, $fo, $j)]}, $acc[$j]
+	vpaddq		@{[limb($gp, $go, $j)]}, $acc[$j], $acc[$j]
+___
+    }
+    &normalize();
+    &store($hp, $ho);
+}
+
+# h = f - g, computed as f + 8*p - g to keep the limbs positive
+sub fe_sub {
+    my ($hp, $ho, $fp, $fo, $gp, $go) = @_;
+
+    for (my $j = 0; $j < 5; $j++) {
+	$code.=<<___;
+	vmovdqu64	@{[limb($fp, $fo, $j)]}, $acc[$j]
+	vpaddq		.Lp8x8+64*$j(%rip), $acc[$j], $acc[$j]
+	vpsubq		@{[limb($gp, $go, $j)]}, $acc[$j], $acc[$j]
+___
+    }
+    &normalize();
+    &store($hp, $ho);
+}
+
+# h = 121666 * f
+sub fe_mul121666 {
+    my ($hp, $ho, $fp, $fo) = @_;
+
+    for (my $k = 0; $k < 6; $k++) {
+	$code.="\tvpxorq		$acc[$k], $acc[$k], $acc[$k]\n";
+    }
+    for (my $j = 0; $j < 5; $j++) {
+	$code.=<<___;
+	vmovdqu64	@{[limb($fp, $fo, $j)]}, $T0
+	vpmadd52luq	$C121666, $T0, $acc[$j]
+	vpmadd52huq	$C121666, $T0, $acc[$j+1]
+___
+    }
+    $code.=<<___;
+	vpmadd52luq	$C608, $acc[5], $acc[0]
+___
+    &normalize();
+    &store($hp, $ho);
+}
+
+# Constant-time swap of the element vectors at $ao and $bo in the lanes
+# selected by %k1.
+sub fe_cswap {
+    my ($p, $ao, $bo) = @_;
+
+    for (my $j = 0; $j < 5; $j++) {
+	$code.=<<___;
+	vmovdqu64	@{[limb($p, $ao, $j)]}, $T0
+	vmovdqu64	@{[limb($p, $bo, $j)]}, $T1
+	vpblendmq	$T1, $T0, $acc[0]\{%k1\}
+	vpblendmq	$T0, $T1, $acc[1]\{%k1\}
+	vmovdqu64	$acc[0], @{[limb($p, $ao, $j)]}
+	vmovdqu64	$acc[1], @{[limb($p, $bo, $j)]}
+___
+    }
+}
+
+sub load_constants {
+    $code.=<<___;
+	vpbroadcastq	.Lmask52(%rip), $MASK52
+	vpbroadcastq	.Lmask47(%rip), $MASK47
+	vpbroadcastq	.Lc19(%rip), $C19
+	vpbroadcastq	.Lc608(%rip), $C608
+	vpbroadcastq	.Lc121666(%rip), $C121666
+___
+}
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+.globl	x25519_ifma_eligible
+.type	x25519_ifma_eligible,\@abi-omnipotent
+.align	32
+x25519_ifma_eligible:
+	mov	OPENSSL_ia32cap_P+8(%rip), %ecx
+	xor	%eax, %eax
+	and	\$`1<<21|1<<16`, %ecx		# avx512ifma + avx512f
+	cmp	\$`1<<21|1<<16`, %ecx
+	cmove	%ecx, %eax
+	ret
+.size	x25519_ifma_eligible,.-x25519_ifma_eligible
+___
+
+{
+my ($h, $f, $g) = ("%rdi", "%rsi", "%rdx");
+
+$code.=<<___;
+
+.globl	x25519_fe52x8_mul
+.type	x25519_fe52x8_mul,\@function,3
+.align	32
+x25519_fe52x8_mul:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+&fe_mul($h, 0, $f, 0, $g, 0);
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	x25519_fe52x8_mul,.-x25519_fe52x8_mul
+
+.globl	x25519_fe52x8_sqr
+.type	x25519_fe52x8_sqr,\@function,2
+.align	32
+x25519_fe52x8_sqr:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+&fe_sqr($h, 0, $f, 0);
+$code.=<<___;
+	vzeroupper
+	ret
+.cfi_endproc
+.size	x25519_fe52x8_sqr,.-x25519_fe52x8_sqr
+___
+}
+
+######################################################################
+# void x25519_fe52x8_ladder(fe52x8 vars[7], const uint8_t swaps[255]);
+#
+# Runs the 255 Montgomery ladder steps of RFC 7748 on all lanes. |vars|
+# holds x1, x2, z2, x3, z3 and two temporaries, in that order, with x2,
+# z2, x3 and z3 initialized by the caller. Bit k of swaps[i] is set if
+# lane k swaps (x2, z2) and (x3, z3) before processing scalar bit i.
+{
+my ($vars, $swaps, $pos) = ("%rdi", "%rsi", "%rdx");
+my ($x1, $x2, $z2, $x3, $z3, $t0, $t1) = map(320 * $_, (0..6));
+
+$code.=<<___;
+
+.globl	x25519_fe52x8_ladder
+.type	x25519_fe52x8_ladder,\@function,2
+.align	32
+x25519_fe52x8_ladder:
+.cfi_startproc
+	endbranch
+___
+&load_constants();
+$code.=<<___;
+	mov	\$254, $pos
+.Lladder_loop:
+	movzbl	($swaps,$pos), %eax
+	kmovw	%eax, %k1
+___
+&fe_cswap($vars, $x2, $x3);
+&fe_cswap($vars, $z2, $z3);
+&fe_sub($vars, $t0, $vars, $x3, $vars, $z3);
+&fe_sub($vars, $t1, $vars, $x2, $vars, $z2);
+&fe_add($vars, $x2, $vars, $x2, $vars, $z2);
+&fe_add($vars, $z2, $vars, $x3, $vars, $z3);
+&fe_mul($vars, $z3, $vars, $x2, $vars, $t0);
+&fe_mul($vars, $z2, $vars, $z2, $vars, $t1);
+&fe_sqr($vars, $t0, $vars, $t1);
+&fe_sqr($vars, $t1, $vars, $x2);
+&fe_add($vars, $x3, $vars, $z3, $vars, $z2);
+&fe_sub($vars, $z2, $vars, $z3, $vars, $z2);
+&fe_mul($vars, $x2, $vars, $t1, $vars, $t0);
+&fe_sub($vars, $t1, $vars, $t1, $vars, $t0);
+&fe_sqr($vars, $z2, $vars, $z2);
+&fe_mul121666($vars, $z3, $vars, $t1);
+&fe_sqr($vars, $x3, $vars, $x3);
+&fe_add($vars, $t0, $vars, $t0, $vars, $z3);
+&fe_mul($vars, $z3, $vars, $x1, $vars, $z2);
+&fe_mul($vars, $z2, $vars, $t1, $vars, $t0);
+$code.=<<___;
+	sub	\$1, $pos
+	jnc	.Lladder_loop
+
+	vzeroupper
+	ret
+.cfi_endproc
+.size	x25519_fe52x8_ladder,.-x25519_fe52x8_ladder
+___
+}
+
+$code.=<<___;
+.data
+.align	64
+.Lp8x8:		# 8*(2^255-19) with limbs 0..3 of at least 2^52
+	.quad	0x1fffffffffff68,0x1fffffffffff68,0x1fffffffffff68,0x1fffffffffff68
+	.quad	0x1fffffffffff68,0x1fffffffffff68,0x1fffffffffff68,0x1fffffffffff68
+	.quad	0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe
+	.quad	0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe
+	.quad	0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe
+	.quad	0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe
+	.quad	0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe
+	.quad	0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe,0x1ffffffffffffe
+	.quad	0x3fffffffffffe,0x3fffffffffffe,0x3fffffffffffe,0x3fffffffffffe
+	.quad	0x3fffffffffffe,0x3fffffffffffe,0x3fffffffffffe,0x3fffffffffffe
+.Lmask52:
+	.quad	0xfffffffffffff
+.Lmask47:
+	.quad	0x7fffffffffff
+.Lc19:
+	.quad	19
+.Lc608:
+	.quad	608
+.Lc121666:
+	.quad	121666
+.asciz	"X25519 8-way AVX-512 IFMA, CRYPTOGAMS by <appro\@openssl.org>"
+___
+
+}}} else {{{		# fallback for old assembler
+$code.=<<___;
+.text
+
+.globl	x25519_ifma_eligible
+.type	x25519_ifma_eligible,\@abi-omnipotent
+x25519_ifma_eligible:
+	xor	%eax,%eax
+	ret
+.size	x25519_ifma_eligible,.-x25519_ifma_eligible
+
+.globl	x25519_fe52x8_mul
+.globl	x25519_fe52x8_sqr
+.globl	x25519_fe52x8_ladder
+.type	x25519_fe52x8_mul,\@abi-omnipotent
+x25519_fe52x8_mul:
+x25519_fe52x8_sqr:
+x25519_fe52x8_ladder:
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	x25519_fe52x8_mul,.-x25519_fe52x8_mul
+___
+}}}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -17,6 +17,7 @@
 #include "crypto/ecx.h"
 #include "ec_local.h"
 #include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/sha.h>
 
 #include "internal/numbers.h"
@@ -259,6 +260,176 @@ static void x25519_scalar_mulx(uint8_t out[32], const uint8_t scalar[32],
 
     OPENSSL_cleanse(e, sizeof(e));
 }
+
+/*
+ * 8-way X25519 for processors with AVX-512 IFMA. Field elements of eight
+ * independent computations are kept in radix 2^52, with limb j of all
+ * eight elements in row j. Subroutines return limbs 0..3 below 2^52 and
+ * limb 4 below 2^48, i.e. values that are only partially reduced modulo
+ * 2^255-19, full reduction is performed by fe52x8_tobytes.
+ */
+# define MULTI_IMPLEMENTED
+# define X25519_MULTI_LANES 8
+
+typedef uint64_t fe52x8[5][X25519_MULTI_LANES];
+
+int x25519_ifma_eligible(void);
+void x25519_fe52x8_mul(fe52x8 h, fe52x8 f, fe52x8 g);
+void x25519_fe52x8_sqr(fe52x8 h, fe52x8 f);
+void x25519_fe52x8_ladder(fe52x8 vars[7], const uint8_t swaps[255]);
+# define fe52x8_mul x25519_fe52x8_mul
+# define fe52x8_sqr x25519_fe52x8_sqr
+
+static const uint64_t MASK52 = 0xfffffffffffff;
+
+static void fe52x8_frombytes(fe52x8 h, size_t lane, const uint8_t *s)
+{
+    uint64_t w0 = load_8(s);
+    uint64_t w1 = load_8(s + 8);
+    uint64_t w2 = load_8(s + 16);
+    uint64_t w3 = load_8(s + 24) & 0x7fffffffffffffff;
+
+    h[0][lane] = w0 & MASK52;
+    h[1][lane] = ((w0 >> 52) | (w1 << 12)) & MASK52;
+    h[2][lane] = ((w1 >> 40) | (w2 << 24)) & MASK52;
+    h[3][lane] = ((w2 >> 28) | (w3 << 36)) & MASK52;
+    h[4][lane] = w3 >> 16;
+}
+
+static void fe52x8_tobytes(uint8_t *s, fe52x8 f, size_t lane)
+{
+    uint64_t h[5], t[5], mask;
+    int i, j;
+
+    for (i = 0; i < 5; i++)
+        h[i] = f[i][lane];
+
+    /* fold bits above 2^255 until the value is below 2^255 */
+    for (j = 0; j < 2; j++) {
+        h[0] += 19 * (h[4] >> 47);
+        h[4] &= 0x7fffffffffff;
+        for (i = 0; i < 4; i++) {
+            h[i + 1] += h[i] >> 52;
+            h[i] &= MASK52;
+        }
+    }
+
+    /* subtract the modulus if h + 19 reaches 2^255 */
+    t[0] = h[0] + 19;
+    for (i = 0; i < 4; i++) {
+        t[i + 1] = h[i + 1] + (t[i] >> 52);
+        t[i] &= MASK52;
+    }
+    mask = 0 - (t[4] >> 47);
+    t[4] &= 0x7fffffffffff;
+    for (i = 0; i < 5; i++)
+        h[i] = (h[i] & ~mask) | (t[i] & mask);
+
+    h[0] |= h[1] << 52;
+    h[1] = (h[1] >> 12) | (h[2] << 40);
+    h[2] = (h[2] >> 24) | (h[3] << 28);
+    h[3] = (h[3] >> 36) | (h[4] << 16);
+
+    for (i = 0; i < 4; i++)
+        for (j = 0; j < 8; j++)
+            s[8 * i + j] = (uint8_t)(h[i] >> (8 * j));
+}
+
+static void fe52x8_invert(fe52x8 out, fe52x8 z)
+{
+    fe52x8 t0;
+    fe52x8 t1;
+    fe52x8 t2;
+    fe52x8 t3;
+    int i;
+
+    /* Same addition chain as in fe64_invert */
+    fe52x8_sqr(t0, z);
+    fe52x8_sqr(t1, t0);
+    fe52x8_sqr(t1, t1);
+    fe52x8_mul(t1, z, t1);
+    fe52x8_mul(t0, t0, t1);
+    fe52x8_sqr(t2, t0);
+    fe52x8_mul(t1, t1, t2);
+    fe52x8_sqr(t2, t1);
+    for (i = 1; i < 5; ++i)
+        fe52x8_sqr(t2, t2);
+    fe52x8_mul(t1, t2, t1);
+    fe52x8_sqr(t2, t1);
+    for (i = 1; i < 10; ++i)
+        fe52x8_sqr(t2, t2);
+    fe52x8_mul(t2, t2, t1);
+    fe52x8_sqr(t3, t2);
+    for (i = 1; i < 20; ++i)
+        fe52x8_sqr(t3, t3);
+    fe52x8_mul(t2, t3, t2);
+    for (i = 0; i < 10; ++i)
+        fe52x8_sqr(t2, t2);
+    fe52x8_mul(t1, t2, t1);
+    fe52x8_sqr(t2, t1);
+    for (i = 1; i < 50; ++i)
+        fe52x8_sqr(t2, t2);
+    fe52x8_mul(t2, t2, t1);
+    fe52x8_sqr(t3, t2);
+    for (i = 1; i < 100; ++i)
+        fe52x8_sqr(t3, t3);
+    fe52x8_mul(t2, t3, t2);
+    for (i = 0; i < 50; ++i)
+        fe52x8_sqr(t2, t2);
+    fe52x8_mul(t1, t2, t1);
+    for (i = 0; i < 5; ++i)
+        fe52x8_sqr(t1, t1);
+    fe52x8_mul(out, t1, t0);
+}
+
+/*
+ * Computes up to X25519_MULTI_LANES scalar multiplications at once.
+ * Unused lanes are computed with an all-zero input and discarded.
+ */
+static void x25519_scalar_mult8(uint8_t *const out[],
+                                const uint8_t *const scalar[],
+                                const uint8_t *const point[], size_t num)
+{
+    fe52x8 v[7];
+    uint8_t swaps[255], e[32];
+    unsigned int b, prev[X25519_MULTI_LANES] = { 0 };
+    size_t lane;
+    int pos, i;
+
+    memset(v, 0, sizeof(v));
+    memset(swaps, 0, sizeof(swaps));
+    for (lane = 0; lane < num; lane++) {
+        memcpy(e, scalar[lane], 32);
+        e[0]  &= 0xf8;
+        e[31] &= 0x7f;
+        e[31] |= 0x40;
+        for (pos = 254; pos >= 0; --pos) {
+            b = 1 & (e[pos / 8] >> (pos & 7));
+            swaps[pos] |= (uint8_t)((prev[lane] ^ b) << lane);
+            prev[lane] = b;
+        }
+        fe52x8_frombytes(v[0], lane, point[lane]);
+    }
+    /* x2 = 1, z2 = 0, x3 = x1, z3 = 1 */
+    for (lane = 0; lane < X25519_MULTI_LANES; lane++) {
+        v[1][0][lane] = 1;
+        v[4][0][lane] = 1;
+        for (i = 0; i < 5; i++)
+            v[3][i][lane] = v[0][i][lane];
+    }
+
+    x25519_fe52x8_ladder(v, swaps);
+
+    fe52x8_invert(v[2], v[2]);
+    fe52x8_mul(v[1], v[1], v[2]);
+    for (lane = 0; lane < num; lane++)
+        fe52x8_tobytes(out[lane], v[1], lane);
+
+    OPENSSL_cleanse(v, sizeof(v));
+    OPENSSL_cleanse(swaps, sizeof(swaps));
+    OPENSSL_cleanse(prev, sizeof(prev));
+    OPENSSL_cleanse(e, sizeof(e));
+}
 #endif
 
 #if defined(X25519_ASM) \
@@ -4605,6 +4776,141 @@ static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
     }
 }
 
+/*
+ * Recode the 256-bit little-endian scalar |a| into |nwin| signed digits of
+ * |c| bits each, out[j] in [-2^(c-1), 2^(c-1)], such that
+ * a = out[0] + 2^c*out[1] + ... + 2^(c*(nwin-1))*out[nwin-1].
+ * The top byte of |a| must be at most 0x1f, as is the case for any value
+ * reduced mod l.
+ */
+static void sc_signed_windows(signed char *out, const uint8_t *a, int c,
+                              int nwin)
+{
+    int carry = 0;
+    int j, k, bit, w;
+
+    for (j = 0; j < nwin; j++) {
+        w = 0;
+        for (k = 0; k < c; k++) {
+            bit = j * c + k;
+            if (bit >= 256)
+                break;
+            w |= ((a[bit >> 3] >> (bit & 7)) & 1) << k;
+        }
+        w += carry;
+        if (w > (1 << (c - 1))) {
+            w -= 1 << c;
+            carry = 1;
+        } else {
+            carry = 0;
+        }
+        out[j] = (signed char)w;
+    }
+}
+
+/*
+ * r = a[0] * P[0] + a[1] * P[1] + ... + a[n-1] * P[n-1]
+ *
+ * Variable time multi-scalar multiplication using Pippenger's bucket method
+ * with signed digits. Only to be used with public inputs. Returns 0 on
+ * allocation failure.
+ */
+static int ge_multi_scalarmult_vartime(ge_p3 *r, const ge_cached *P,
+                                       uint8_t (*a)[32], size_t n)
+{
+    signed char *digits = NULL;
+    ge_p3 *buckets = NULL;
+    uint8_t *used = NULL;
+    ge_p3 running, acc;
+    ge_cached tmp;
+    ge_p1p1 t;
+    size_t i;
+    int c, nwin, nbuckets, j, b, k, have_running, ret = 0;
+
+    if (n < 16)
+        c = 3;
+    else if (n < 64)
+        c = 4;
+    else if (n < 192)
+        c = 5;
+    else if (n < 640)
+        c = 6;
+    else
+        c = 7;
+    nwin = (256 + c - 1) / c;
+    nbuckets = 1 << (c - 1);
+
+    digits = OPENSSL_malloc(n * nwin);
+    buckets = OPENSSL_malloc(nbuckets * sizeof(*buckets));
+    used = OPENSSL_malloc(nbuckets);
+    if (digits == NULL || buckets == NULL || used == NULL)
+        goto err;
+
+    for (i = 0; i < n; i++)
+        sc_signed_windows(digits + i * nwin, a[i], c, nwin);
+
+    ge_p3_0(r);
+    for (j = nwin - 1; j >= 0; j--) {
+        if (j != nwin - 1) {
+            for (k = 0; k < c; k++) {
+                ge_p3_dbl(&t, r);
+                ge_p1p1_to_p3(r, &t);
+            }
+        }
+
+        memset(used, 0, nbuckets);
+        for (i = 0; i < n; i++) {
+            int dig = digits[i * nwin + j];
+
+            if (dig == 0)
+                continue;
+            b = (dig > 0 ? dig : -dig) - 1;
+            if (!used[b]) {
+                ge_p3_0(&buckets[b]);
+                used[b] = 1;
+            }
+            if (dig > 0)
+                ge_add(&t, &buckets[b], &P[i]);
+            else
+                ge_sub(&t, &buckets[b], &P[i]);
+            ge_p1p1_to_p3(&buckets[b], &t);
+        }
+
+        /*
+         * sum_b (b + 1) * bucket[b], computed as a running sum of running
+         * sums from the top bucket down.
+         */
+        ge_p3_0(&running);
+        ge_p3_0(&acc);
+        have_running = 0;
+        for (b = nbuckets - 1; b >= 0; b--) {
+            if (used[b]) {
+                ge_p3_to_cached(&tmp, &buckets[b]);
+                ge_add(&t, &running, &tmp);
+                ge_p1p1_to_p3(&running, &t);
+                have_running = 1;
+            }
+            if (have_running) {
+                ge_p3_to_cached(&tmp, &running);
+                ge_add(&t, &acc, &tmp);
+                ge_p1p1_to_p3(&acc, &t);
+            }
+        }
+        if (have_running) {
+            ge_p3_to_cached(&tmp, &acc);
+            ge_add(&t, r, &tmp);
+            ge_p1p1_to_p3(r, &t);
+        }
+    }
+    ret = 1;
+
+ err:
+    OPENSSL_free(digits);
+    OPENSSL_free(buckets);
+    OPENSSL_free(used);
+    return ret;
+}
+
 /*
  * The set of scalars is \Z/l
  * where l = 2^252 + 27742317777372353535851937790883648493.
@@ -5540,6 +5846,43 @@ err:
 
 static const char allzeroes[15];
 
+/*
+ * Check 0 <= s < L where L = 2^252 + 27742317777372353535851937790883648493
+ *
+ * If not the signature is publicly invalid. Since it's public we can do the
+ * check in variable time.
+ */
+static int sc_is_canonical(const uint8_t *s)
+{
+    /* 27742317777372353535851937790883648493 in little endian format */
+    static const uint8_t l_low[16] = {
+        0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2,
+        0xDE, 0xF9, 0xDE, 0x14
+    };
+    int i;
+
+    /* First check the most significant byte */
+    if (s[31] > 0x10)
+        return 0;
+    if (s[31] == 0x10) {
+        /*
+         * Most significant byte indicates a value close to 2^252 so check the
+         * rest
+         */
+        if (memcmp(s + 16, allzeroes, sizeof(allzeroes)) != 0)
+            return 0;
+        for (i = 15; i >= 0; i--) {
+            if (s[i] < l_low[i])
+                break;
+            if (s[i] > l_low[i])
+                return 0;
+        }
+        if (i < 0)
+            return 0;
+    }
+    return 1;
+}
+
 int
 ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
                     const uint8_t signature[64], const uint8_t public_key[32],
@@ -5547,7 +5890,6 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
                     const uint8_t *context, size_t context_len,
                     OSSL_LIB_CTX *libctx, const char *propq)
 {
-    int i;
     ge_p3 A;
     const uint8_t *r, *s;
     EVP_MD *sha512;
@@ -5557,11 +5899,6 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
     ge_p2 R;
     uint8_t rcheck[32];
     uint8_t h[SHA512_DIGEST_LENGTH];
-    /* 27742317777372353535851937790883648493 in little endian format */
-    const uint8_t l_low[16] = {
-        0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2,
-        0xDE, 0xF9, 0xDE, 0x14
-    };
 
     if (context == NULL)
         context_len = 0;
@@ -5577,32 +5914,8 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
     r = signature;
     s = signature + 32;
 
-    /*
-     * Check 0 <= s < L where L = 2^252 + 27742317777372353535851937790883648493
-     *
-     * If not the signature is publicly invalid. Since it's public we can do the
-     * check in variable time.
-     *
-     * First check the most significant byte
-     */
-    if (s[31] > 0x10)
+    if (!sc_is_canonical(s))
         return 0;
-    if (s[31] == 0x10) {
-        /*
-         * Most significant byte indicates a value close to 2^252 so check the
-         * rest
-         */
-        if (memcmp(s + 16, allzeroes, sizeof(allzeroes)) != 0)
-            return 0;
-        for (i = 15; i >= 0; i--) {
-            if (s[i] < l_low[i])
-                break;
-            if (s[i] > l_low[i])
-                return 0;
-        }
-        if (i < 0)
-            return 0;
-    }
 
     if (ge_frombytes_vartime(&A, public_key) != 0) {
         return 0;
@@ -5646,6 +5959,247 @@ err:
     return res;
 }
 
+/* Maximum number of signatures combined into one multi-scalar multiplication */
+#define ED25519_BATCH_MAX 256
+
+/*
+ * Returns 1 if |P| is in the subgroup of prime order l, i.e. [l]P is the
+ * neutral element, and 0 if it has a small order component. Variable time.
+ */
+static int ge_is_torsion_free_vartime(const ge_p3 *P)
+{
+    /* l = 2^252 + 27742317777372353535851937790883648493 in little endian */
+    static const uint8_t l[32] = {
+        0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2,
+        0xDE, 0xF9, 0xDE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    static const uint8_t zero[32] = { 0 };
+    ge_p2 lP;
+    fe yz;
+
+    ge_double_scalarmult_vartime(&lP, l, P, zero);
+    fe_sub(yz, lP.Y, lP.Z);
+    return !fe_isnonzero(lP.X) && !fe_isnonzero(yz);
+}
+
+/*
+ * Verify |num| signatures at once. On return results[i] (if |results| is not
+ * NULL) is 1 if the i-th signature is valid and 0 otherwise. Returns 1 if all
+ * signatures are valid and 0 otherwise.
+ *
+ * Signatures are checked in groups of up to ED25519_BATCH_MAX with the
+ * randomized batch equation
+ *
+ *     [8]([sum z_i*s_i]B - sum [z_i](R_i) - sum [z_i*h_i](A_i)) == 0
+ *
+ * where the z_i are random 128-bit scalars, evaluated with a single
+ * multi-scalar multiplication. Consecutive signatures under the same public
+ * key share one A_i term. If the equation does not hold for a group, or the
+ * batch cannot be evaluated, the signatures of that group are verified one at
+ * a time with ossl_ed25519_verify() to find the invalid ones.
+ *
+ * The cofactored batch equation ignores small order components of R_i and
+ * A_i, which the cofactorless ossl_ed25519_verify() does not. So that the
+ * result for a signature does not depend on the batch, a signature is only
+ * batched if R_i and A_i are both in the prime order subgroup, for which the
+ * two equations agree. Other signatures, which no honest signer produces, are
+ * verified on their own with ossl_ed25519_verify().
+ */
+int
+ossl_ed25519_verify_batch(const uint8_t *const *tbs, const size_t *tbs_len,
+                          const uint8_t *const *signatures,
+                          const size_t *siglens,
+                          const uint8_t *const *public_keys, size_t num,
+                          int *results,
+                          const uint8_t dom2flag, const uint8_t phflag,
+                          const uint8_t csflag,
+                          const uint8_t *context, size_t context_len,
+                          OSSL_LIB_CTX *libctx, const char *propq)
+{
+    EVP_MD *sha512 = NULL;
+    EVP_MD_CTX *hash_ctx = NULL;
+    ge_cached *pts = NULL;
+    uint8_t (*sc)[32] = NULL;
+    uint8_t *z = NULL;
+    size_t *idx = NULL;
+    const uint8_t *pk, *last_pk, *r, *s;
+    size_t off, n, i, j, m, nkeys, chunk;
+    ge_p3 A, R, sum, sB;
+    ge_cached tmp;
+    ge_p1p1 t;
+    fe yz;
+    uint8_t enc[32], h[SHA512_DIGEST_LENGTH], s_sum[32], zs[32];
+    unsigned int sz;
+    int all_ok = 1, batch_ok, nobatch = 0, key_solo = 0;
+
+    if (num == 0)
+        return 1;
+
+    if (context == NULL)
+        context_len = 0;
+
+    /* Context string requirements as in ossl_ed25519_verify() */
+    if ((csflag && context_len == 0) || (!dom2flag && context_len > 0)) {
+        if (results != NULL)
+            for (i = 0; i < num; i++)
+                results[i] = 0;
+        return 0;
+    }
+
+    chunk = num < ED25519_BATCH_MAX ? num : ED25519_BATCH_MAX;
+    sha512 = EVP_MD_fetch(libctx, SN_sha512, propq);
+    hash_ctx = EVP_MD_CTX_new();
+    pts = OPENSSL_malloc(2 * chunk * sizeof(*pts));
+    sc = OPENSSL_malloc(2 * chunk * sizeof(*sc));
+    z = OPENSSL_malloc(16 * chunk);
+    idx = OPENSSL_malloc(chunk * sizeof(*idx));
+    if (sha512 == NULL || hash_ctx == NULL || pts == NULL || sc == NULL
+            || z == NULL || idx == NULL)
+        chunk = 0;
+
+    for (off = 0; off < num; off += n) {
+        n = num - off;
+        if (chunk == 0 || RAND_bytes_ex(libctx, z, 16 * chunk, 0) <= 0) {
+            /* No batching possible, verify the remainder one by one */
+            nobatch = 1;
+            batch_ok = 0;
+            m = n;
+            goto individual;
+        }
+        if (n > chunk)
+            n = chunk;
+
+        /*
+         * The -R_i are placed at pts[0..m), the -A_i at pts[chunk..) and moved
+         * down behind the R_i once all signatures of the group are processed.
+         */
+        m = nkeys = 0;
+        last_pk = NULL;
+        memset(s_sum, 0, sizeof(s_sum));
+        for (i = off; i < off + n; i++) {
+            pk = public_keys[i];
+            r = signatures[i];
+            s = signatures[i] + 32;
+
+            if (siglens[i] != ED25519_SIGSIZE || !sc_is_canonical(s))
+                goto bad;
+
+            if (last_pk == NULL || memcmp(pk, last_pk, 32) != 0) {
+                last_pk = NULL;
+                if (ge_frombytes_vartime(&A, pk) != 0)
+                    goto bad;
+                last_pk = pk;
+                key_solo = !ge_is_torsion_free_vartime(&A);
+                if (!key_solo) {
+                    fe_neg(A.X, A.X);
+                    fe_neg(A.T, A.T);
+                    ge_p3_to_cached(&pts[chunk + nkeys], &A);
+                    memset(sc[chunk + nkeys], 0, 32);
+                    nkeys++;
+                }
+            }
+            if (key_solo)
+                goto solo;
+
+            /*
+             * R must be a canonical encoding, ossl_ed25519_verify() compares
+             * the encoding of the recomputed point with it.
+             */
+            if (ge_frombytes_vartime(&R, r) != 0)
+                goto bad;
+            fe_tobytes(enc, R.Y);
+            enc[31] ^= fe_isnegative(R.X) << 7;
+            if (memcmp(enc, r, 32) != 0)
+                goto bad;
+            if (!ge_is_torsion_free_vartime(&R))
+                goto solo;
+
+            if (!hash_init_with_dom(hash_ctx, sha512, dom2flag, phflag,
+                                    context, context_len)
+                || !EVP_DigestUpdate(hash_ctx, r, 32)
+                || !EVP_DigestUpdate(hash_ctx, pk, 32)
+                || !EVP_DigestUpdate(hash_ctx, tbs[i], tbs_len[i])
+                || !EVP_DigestFinal_ex(hash_ctx, h, &sz))
+                goto bad;
+            x25519_sc_reduce(h);
+
+            memset(zs, 0, sizeof(zs));
+            memcpy(zs, z + 16 * m, 16);
+
+            fe_neg(R.X, R.X);
+            fe_neg(R.T, R.T);
+            ge_p3_to_cached(&pts[m], &R);
+            memcpy(sc[m], zs, 32);
+            sc_muladd(sc[chunk + nkeys - 1], zs, h, sc[chunk + nkeys - 1]);
+            sc_muladd(s_sum, zs, s, s_sum);
+            idx[m++] = i;
+            continue;
+
+ solo:
+            if (ossl_ed25519_verify(tbs[i], tbs_len[i], r, pk, dom2flag,
+                                    phflag, csflag, context, context_len,
+                                    libctx, propq)) {
+                if (results != NULL)
+                    results[i] = 1;
+                continue;
+            }
+ bad:
+            all_ok = 0;
+            if (results == NULL)
+                goto end;
+            results[i] = 0;
+        }
+        if (m == 0)
+            continue;
+
+        memmove(pts + m, pts + chunk, nkeys * sizeof(*pts));
+        memmove(sc + m, sc + chunk, nkeys * sizeof(*sc));
+        batch_ok = ge_multi_scalarmult_vartime(&sum, pts, sc, m + nkeys);
+        if (batch_ok) {
+            ge_scalarmult_base(&sB, s_sum);
+            ge_p3_to_cached(&tmp, &sB);
+            ge_add(&t, &sum, &tmp);
+            ge_p1p1_to_p3(&sum, &t);
+            for (j = 0; j < 3; j++) {
+                ge_p3_dbl(&t, &sum);
+                ge_p1p1_to_p3(&sum, &t);
+            }
+            /* The neutral element is (0:1:1:0) in extended coordinates */
+            fe_sub(yz, sum.Y, sum.Z);
+            batch_ok = !fe_isnonzero(sum.X) && !fe_isnonzero(yz);
+        }
+
+ individual:
+        for (j = 0; j < m; j++) {
+            i = nobatch ? off + j : idx[j];
+            if (!batch_ok
+                    && (siglens[i] != ED25519_SIGSIZE
+                        || !ossl_ed25519_verify(tbs[i], tbs_len[i],
+                                                signatures[i], public_keys[i],
+                                                dom2flag, phflag, csflag,
+                                                context, context_len,
+                                                libctx, propq))) {
+                all_ok = 0;
+                if (results == NULL)
+                    goto end;
+                results[i] = 0;
+            } else if (results != NULL) {
+                results[i] = 1;
+            }
+        }
+    }
+
+ end:
+    EVP_MD_free(sha512);
+    EVP_MD_CTX_free(hash_ctx);
+    OPENSSL_free(pts);
+    OPENSSL_free(sc);
+    OPENSSL_free(z);
+    OPENSSL_free(idx);
+    return all_ok;
+}
+
 int
 ossl_ed25519_public_from_private(OSSL_LIB_CTX *ctx, uint8_t out_public_key[32],
                                  const uint8_t private_key[32],
@@ -5687,6 +6241,59 @@ ossl_x25519(uint8_t out_shared_key[32], const uint8_t private_key[32],
     return CRYPTO_memcmp(kZeros, out_shared_key, 32) != 0;
 }
 
+/*
+ * Returns the number of X25519 computations that ossl_x25519_multi()
+ * performs at the cost of roughly one, or 1 if there is no multi-buffer
+ * implementation for this processor.
+ */
+size_t ossl_x25519_multi_lanes(void)
+{
+#ifdef MULTI_IMPLEMENTED
+    if (x25519_ifma_eligible())
+        return X25519_MULTI_LANES;
+#endif
+    return 1;
+}
+
+/*
+ * Computes |num| independent X25519 shared secrets. |results| receives
+ * the per-item outcome of ossl_x25519(), the return value is 1 if all of
+ * them succeeded and 0 otherwise.
+ */
+int
+ossl_x25519_multi(uint8_t *const out_shared_key[],
+                  const uint8_t *const private_key[],
+                  const uint8_t *const peer_public_value[], size_t num,
+                  int *results)
+{
+    size_t i = 0;
+    int ret = 1;
+
+#ifdef MULTI_IMPLEMENTED
+    if (x25519_ifma_eligible()) {
+        static const uint8_t kZeros[32] = {0};
+        size_t n;
+
+        for (; i < num; i += n) {
+            n = num - i < X25519_MULTI_LANES ? num - i : X25519_MULTI_LANES;
+            x25519_scalar_mult8(out_shared_key + i, private_key + i,
+                                peer_public_value + i, n);
+        }
+        for (i = 0; i < num; i++) {
+            results[i] = CRYPTO_memcmp(kZeros, out_shared_key[i], 32) != 0;
+            ret &= results[i];
+        }
+        return ret;
+    }
+#endif
+    for (; i < num; i++) {
+        results[i] = ossl_x25519(out_shared_key[i], private_key[i],
+                                 peer_public_value[i]);
+        ret &= results[i];
+    }
+    return ret;
+}
+
 void
 ossl_x25519_public_from_private(uint8_t out_public_value[32],
                                 const uint8_t private_key[32])
@@ -224,7 +224,28 @@ static ossl_inline void constant_time_lookup_niels(niels_s * RESTRICT ni,
                                                    const niels_t *table,
                                                    int nelts, int idx)
 {
-    constant_time_lookup(ni, table, sizeof(niels_s), nelts, idx);
+    /*
+     * Select whole words rather than bytes as constant_time_lookup() does:
+     * this is the inner loop of the fixed-base scalar multiplication, and
+     * the masked accumulation below is easily vectorized.
+     */
+    const word_t *tab = (const word_t *)table;
+    word_t *out = (word_t *)ni;
+    const size_t nwords = sizeof(niels_s) / sizeof(word_t);
+    mask_t mask;
+    size_t j;
+    int i;
+
+    memset(ni, 0, sizeof(niels_s));
+    for (i = 0; i < nelts; i++, tab += nwords) {
+#if ARCH_WORD_BITS == 32
+        mask = value_barrier_32(word_is_zero((word_t)(i ^ idx)));
+#else
+        mask = value_barrier_64(word_is_zero((word_t)(i ^ idx)));
+#endif
+        for (j = 0; j < nwords; j++)
+            out[j] |= tab[j] & mask;
+    }
 }
 
 void
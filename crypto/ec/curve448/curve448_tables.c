@@ -16,1045 +16,2085 @@
 static const curve448_precomputed_s curve448_precomputed_base_table = {
     {
         {{
-            {FIELD_LITERAL(0x00cc3b062366f4ccULL, 0x003d6e34e314aa3cULL,
-                           0x00d51c0a7521774dULL, 0x0094e060eec6ab8bULL,
-                           0x00d21291b4d80082ULL, 0x00befed12b55ef1eULL,
-                           0x00c3dd2df5c94518ULL, 0x00e0a7b112b8d4e6ULL)},
-            {FIELD_LITERAL(0x0019eb5608d8723aULL, 0x00d1bab52fb3aedbULL,
-                           0x00270a7311ebc90cULL, 0x0037c12b91be7f13ULL,
-                           0x005be16cd8b5c704ULL, 0x003e181acda888e1ULL,
-                           0x00bc1f00fc3fc6d0ULL, 0x00d3839bfa319e20ULL)},
-            {FIELD_LITERAL(0x003caeb88611909fULL, 0x00ea8b378c4df3d4ULL,
-                           0x00b3295b95a5a19aULL, 0x00a65f97514bdfb5ULL,
-                           0x00b39efba743cab1ULL, 0x0016ba98b862fd2dULL,
-                           0x0001508812ee71d7ULL, 0x000a75740eea114aULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00ebcf0eb649f823ULL, 0x00166d332e98ea03ULL,
-                           0x0059ddf64f5cd5f6ULL, 0x0047763123d9471bULL,
-                           0x00a64065c53ef62fULL, 0x00978e44c480153dULL,
-                           0x000b5b2a0265f194ULL, 0x0046a24b9f32965aULL)},
-            {FIELD_LITERAL(0x00b9eef787034df0ULL, 0x0020bc24de3390cdULL,
-                           0x000022160bae99bbULL, 0x00ae66e886e97946ULL,
-                           0x0048d4bbe02cbb8bULL, 0x0072ba97b34e38d4ULL,
-                           0x00eae7ec8f03e85aULL, 0x005ba92ecf808b2cULL)},
-            {FIELD_LITERAL(0x00c9cfbbe74258fdULL, 0x00843a979ea9eaa7ULL,
-                           0x000cbb4371cfbe90ULL, 0x0059bac8f7f0a628ULL,
-                           0x004b3dff882ff530ULL, 0x0011869df4d90733ULL,
-                           0x00595aa71f4abfc2ULL, 0x0070e2d38990c2e6ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00de2010c0a01733ULL, 0x00c739a612e24297ULL,
-                           0x00a7212643141d7cULL, 0x00f88444f6b67c11ULL,
-                           0x00484b7b16ec28f2ULL, 0x009c1b8856af9c68ULL,
-                           0x00ff4669591fe9d6ULL, 0x0054974be08a32c8ULL)},
-            {FIELD_LITERAL(0x0010de3fd682ceedULL, 0x008c07642d83ca4eULL,
-                           0x0013bb064e00a1ccULL, 0x009411ae27870e11ULL,
-                           0x00ea8e5b4d531223ULL, 0x0032fe7d2aaece2eULL,
-                           0x00d989e243e7bb41ULL, 0x000fe79a508e9b8bULL)},
-            {FIELD_LITERAL(0x005e0426b9bfc5b1ULL, 0x0041a5b1d29ee4faULL,
-                           0x0015b0def7774391ULL, 0x00bc164f1f51af01ULL,
-                           0x00d543b0942797b9ULL, 0x003c129b6398099cULL,
-                           0x002b114c6e5adf18ULL, 0x00b4e630e4018a7bULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00d490afc95f8420ULL, 0x00b096bf50c1d9b9ULL,
-                           0x00799fd707679866ULL, 0x007c74d9334afbeaULL,
-                           0x00efaa8be80ff4edULL, 0x0075c4943bb81694ULL,
-                           0x00c21c2fca161f36ULL, 0x00e77035d492bfeeULL)},
-            {FIELD_LITERAL(0x006658a190dd6661ULL, 0x00e0e9bab38609a6ULL,
-                           0x0028895c802237edULL, 0x006a0229c494f587ULL,
-                           0x002dcde96c9916b7ULL, 0x00d158822de16218ULL,
-                           0x00173b917a06856fULL, 0x00ca78a79ae07326ULL)},
-            {FIELD_LITERAL(0x00e35bfc79caced4ULL, 0x0087238a3e1fe3bbULL,
-                           0x00bcbf0ff4ceff5bULL, 0x00a19c1c94099b91ULL,
-                           0x0071e102b49db976ULL, 0x0059e3d004eada1eULL,
-                           0x008da78afa58a47eULL, 0x00579c8ebf269187ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00a16c2905eee75fULL, 0x009d4bcaea2c7e1dULL,
-                           0x00d3bd79bfad19dfULL, 0x0050da745193342cULL,
-                           0x006abdb8f6b29ab1ULL, 0x00a24fe0a4fef7efULL,
-                           0x0063730da1057dfbULL, 0x00a08c312c8eb108ULL)},
-            {FIELD_LITERAL(0x00b583be005375beULL, 0x00a40c8f8a4e3df4ULL,
-                           0x003fac4a8f5bdbf7ULL, 0x00d4481d872cd718ULL,
-                           0x004dc8749cdbaefeULL, 0x00cce740d5e5c975ULL,
-                           0x000b1c1f4241fd21ULL, 0x00a76de1b4e1cd07ULL)},
-            {FIELD_LITERAL(0x007a076500d30b62ULL, 0x000a6e117b7f090fULL,
-                           0x00c8712ae7eebd9aULL, 0x000fbd6c1d5f6ff7ULL,
-                           0x003a7977246ebf11ULL, 0x00166ed969c6600eULL,
-                           0x00aa42e469c98becULL, 0x00dc58f307cf0666ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x004b491f65a9a28bULL, 0x006a10309e8a55b7ULL,
-                           0x00b67210185187efULL, 0x00cf6497b12d9b8fULL,
-                           0x0085778c56e2b1baULL, 0x0015b4c07a814d85ULL,
-                           0x00686479e62da561ULL, 0x008de5d88f114916ULL)},
-            {FIELD_LITERAL(0x00e37c88d6bba7b1ULL, 0x003e4577e1b8d433ULL,
-                           0x0050d8ea5f510ec0ULL, 0x0042fc9f2da9ef59ULL,
-                           0x003bd074c1141420ULL, 0x00561b8b7b68774eULL,
-                           0x00232e5e5d1013a3ULL, 0x006b7f2cb3d7e73fULL)},
-            {FIELD_LITERAL(0x004bdd0f0b41e6a0ULL, 0x001773057c405d24ULL,
-                           0x006029f99915bd97ULL, 0x006a5ba70a17fe2fULL,
-                           0x0046111977df7e08ULL, 0x004d8124c89fb6b7ULL,
-                           0x00580983b2bb2724ULL, 0x00207bf330d6f3feULL)},
-        }}, {{
-            {FIELD_LITERAL(0x007efdc93972a48bULL, 0x002f5e50e78d5feeULL,
-                           0x0080dc11d61c7fe5ULL, 0x0065aa598707245bULL,
-                           0x009abba2300641beULL, 0x000c68787656543aULL,
-                           0x00ffe0fef2dc0a17ULL, 0x00007ffbd6cb4f3aULL)},
-            {FIELD_LITERAL(0x0036012f2b836efcULL, 0x00458c126d6b5fbcULL,
-                           0x00a34436d719ad1eULL, 0x0097be6167117deaULL,
-                           0x0009c219c879cff3ULL, 0x0065564493e60755ULL,
-                           0x00993ac94a8cdec0ULL, 0x002d4885a4d0dbafULL)},
-            {FIELD_LITERAL(0x00598b60b4c068baULL, 0x00c547a0be7f1afdULL,
-                           0x009582164acf12afULL, 0x00af4acac4fbbe40ULL,
-                           0x005f6ca7c539121aULL, 0x003b6e752ebf9d66ULL,
-                           0x00f08a30d5cac5d4ULL, 0x00e399bb5f97c5a9ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x007445a0409c0a66ULL, 0x00a65c369f3829c0ULL,
-                           0x0031d248a4f74826ULL, 0x006817f34defbe8eULL,
-                           0x00649741d95ebf2eULL, 0x00d46466ab16b397ULL,
-                           0x00fdc35703bee414ULL, 0x00343b43334525f8ULL)},
-            {FIELD_LITERAL(0x001796bea93f6401ULL, 0x00090c5a42e85269ULL,
-                           0x00672412ba1252edULL, 0x001201d47b6de7deULL,
-                           0x006877bccfe66497ULL, 0x00b554fd97a4c161ULL,
-                           0x009753f42dbac3cfULL, 0x00e983e3e378270aULL)},
-            {FIELD_LITERAL(0x00ac3eff18849872ULL, 0x00f0eea3bff05690ULL,
-                           0x00a6d72c21dd505dULL, 0x001b832642424169ULL,
-                           0x00a6813017b540e5ULL, 0x00a744bd71b385cdULL,
-                           0x0022a7d089130a7bULL, 0x004edeec9a133486ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00b2d6729196e8a9ULL, 0x0088a9bb2031cef4ULL,
-                           0x00579e7787dc1567ULL, 0x0030f49feb059190ULL,
-                           0x00a0b1d69c7f7d8fULL, 0x0040bdcc6d9d806fULL,
-                           0x00d76c4037edd095ULL, 0x00bbf24376415dd7ULL)},
-            {FIELD_LITERAL(0x00240465ff5a7197ULL, 0x00bb97e76caf27d0ULL,
-                           0x004b4edbf8116d39ULL, 0x001d8586f708cbaaULL,
-                           0x000f8ee8ff8e4a50ULL, 0x00dde5a1945dd622ULL,
-                           0x00e6fc1c0957e07cULL, 0x0041c9cdabfd88a0ULL)},
-            {FIELD_LITERAL(0x005344b0bf5b548cULL, 0x002957d0b705cc99ULL,
-                           0x00f586a70390553dULL, 0x0075b3229f583cc3ULL,
-                           0x00a1aa78227490e4ULL, 0x001bf09cf7957717ULL,
-                           0x00cf6bf344325f52ULL, 0x0065bd1c23ca3ecfULL)},
-        }}, {{
-            {FIELD_LITERAL(0x009bff3b3239363cULL, 0x00e17368796ef7c0ULL,
-                           0x00528b0fe0971f3aULL, 0x0008014fc8d4a095ULL,
-                           0x00d09f2e8a521ec4ULL, 0x006713ab5dde5987ULL,
-                           0x0003015758e0dbb1ULL, 0x00215999f1ba212dULL)},
-            {FIELD_LITERAL(0x002c88e93527da0eULL, 0x0077c78f3456aad5ULL,
-                           0x0071087a0a389d1cULL, 0x00934dac1fb96dbdULL,
-                           0x008470e801162697ULL, 0x005bc2196cd4ad49ULL,
-                           0x00e535601d5087c3ULL, 0x00769888700f497fULL)},
-            {FIELD_LITERAL(0x00da7a4b557298adULL, 0x0019d2589ea5df76ULL,
-                           0x00ef3e38be0c6497ULL, 0x00a9644e1312609aULL,
-                           0x004592f61b2558daULL, 0x0082c1df510d7e46ULL,
-                           0x0042809a535c0023ULL, 0x00215bcb5afd7757ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x002b9df55a1a4213ULL, 0x00dcfc3b464a26beULL,
-                           0x00c4f9e07a8144d5ULL, 0x00c8e0617a92b602ULL,
-                           0x008e3c93accafae0ULL, 0x00bf1bcb95b2ca60ULL,
-                           0x004ce2426a613bf3ULL, 0x00266cac58e40921ULL)},
-            {FIELD_LITERAL(0x008456d5db76e8f0ULL, 0x0032ca9cab2ce163ULL,
-                           0x0059f2b8bf91abcfULL, 0x0063c2a021712788ULL,
-                           0x00f86155af22f72dULL, 0x00db98b2a6c005a0ULL,
-                           0x00ac6e416a693ac4ULL, 0x007a93572af53226ULL)},
-            {FIELD_LITERAL(0x0087767520f0de22ULL, 0x0091f64012279fb5ULL,
-                           0x001050f1f0644999ULL, 0x004f097a2477ad3cULL,
-                           0x006b37913a9947bdULL, 0x001a3d78645af241ULL,
-                           0x0057832bbb3008a7ULL, 0x002c1d902b80dc20ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x001a6002bf178877ULL, 0x009bce168aa5af50ULL,
-                           0x005fc318ff04a7f5ULL, 0x0052818f55c36461ULL,
-                           0x008768f5d4b24afbULL, 0x0037ffbae7b69c85ULL,
-                           0x0018195a4b61edc0ULL, 0x001e12ea088434b2ULL)},
-            {FIELD_LITERAL(0x0047d3f804e7ab07ULL, 0x00a809ab5f905260ULL,
-                           0x00b3ffc7cdaf306dULL, 0x00746e8ec2d6e509ULL,
-                           0x00d0dade8887a645ULL, 0x00acceeebde0dd37ULL,
-                           0x009bc2579054686bULL, 0x0023804f97f1c2bfULL)},
-            {FIELD_LITERAL(0x0043e2e2e50b80d7ULL, 0x00143aafe4427e0fULL,
-                           0x005594aaecab855bULL, 0x008b12ccaaecbc01ULL,
-                           0x002deeb091082bc3ULL, 0x009cca4be2ae7514ULL,
-                           0x00142b96e696d047ULL, 0x00ad2a2b1c05256aULL)},
-        }}, {{
-            {FIELD_LITERAL(0x003914f2f144b78bULL, 0x007a95dd8bee6f68ULL,
-                           0x00c7f4384d61c8e6ULL, 0x004e51eb60f1bdb2ULL,
-                           0x00f64be7aa4621d8ULL, 0x006797bfec2f0ac0ULL,
-                           0x007d17aab3c75900ULL, 0x001893e73cac8bc5ULL)},
-            {FIELD_LITERAL(0x00140360b768665bULL, 0x00b68aca4967f977ULL,
-                           0x0001089b66195ae4ULL, 0x00fe71122185e725ULL,
-                           0x000bca2618d49637ULL, 0x00a54f0557d7e98aULL,
-                           0x00cdcd2f91d6f417ULL, 0x00ab8c13741fd793ULL)},
-            {FIELD_LITERAL(0x00725ee6b1e549e0ULL, 0x007124a0769777faULL,
-                           0x000b68fdad07ae42ULL, 0x0085b909cd4952dfULL,
-                           0x0092d2e3c81606f4ULL, 0x009f22f6cac099a0ULL,
-                           0x00f59da57f2799a8ULL, 0x00f06c090122f777ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00ce0bed0a3532bcULL, 0x001a5048a22df16bULL,
-                           0x00e31db4cbad8bf1ULL, 0x00e89292120cf00eULL,
-                           0x007d1dd1a9b00034ULL, 0x00e2a9041ff8f680ULL,
-                           0x006a4c837ae596e7ULL, 0x00713af1068070b3ULL)},
-            {FIELD_LITERAL(0x00c4fe64ce66d04bULL, 0x00b095d52e09b3d7ULL,
-                           0x00758bbecb1a3a8eULL, 0x00f35cce8d0650c0ULL,
-                           0x002b878aa5984473ULL, 0x0062e0a3b7544ddcULL,
-                           0x00b25b290ed116feULL, 0x007b0f6abe0bebf2ULL)},
-            {FIELD_LITERAL(0x0081d4e3addae0a8ULL, 0x003410c836c7ffccULL,
-                           0x00c8129ad89e4314ULL, 0x000e3d5a23922dcdULL,
-                           0x00d91e46f29c31f3ULL, 0x006c728cde8c5947ULL,
-                           0x002bc655ba2566c0ULL, 0x002ca94721533108ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0051e4b3f764d8a9ULL, 0x0019792d46e904a0ULL,
-                           0x00853bc13dbc8227ULL, 0x000840208179f12dULL,
-                           0x0068243474879235ULL, 0x0013856fbfe374d0ULL,
-                           0x00bda12fe8676424ULL, 0x00bbb43635926eb2ULL)},
-            {FIELD_LITERAL(0x0012cdc880a93982ULL, 0x003c495b21cd1b58ULL,
-                           0x00b7e5c93f22a26eULL, 0x0044aa82dfb99458ULL,
-                           0x009ba092cdffe9c0ULL, 0x00a14b3ab2083b73ULL,
-                           0x000271c2f70e1c4bULL, 0x00eea9cac0f66eb8ULL)},
-            {FIELD_LITERAL(0x001a1847c4ac5480ULL, 0x00b1b412935bb03aULL,
-                           0x00f74285983bf2b2ULL, 0x00624138b5b5d0f1ULL,
-                           0x008820c0b03d38bfULL, 0x00b94e50a18c1572ULL,
-                           0x0060f6934841798fULL, 0x00c52f5d66d6ebe2ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00da23d59f9bcea6ULL, 0x00e0f27007a06a4bULL,
-                           0x00128b5b43a6758cULL, 0x000cf50190fa8b56ULL,
-                           0x00fc877aba2b2d72ULL, 0x00623bef52edf53fULL,
-                           0x00e6af6b819669e2ULL, 0x00e314dc34fcaa4fULL)},
-            {FIELD_LITERAL(0x0066e5eddd164d1eULL, 0x00418a7c6fe28238ULL,
-                           0x0002e2f37e962c25ULL, 0x00f01f56b5975306ULL,
-                           0x0048842fa503875cULL, 0x0057b0e968078143ULL,
-                           0x00ff683024f3d134ULL, 0x0082ae28fcad12e4ULL)},
-            {FIELD_LITERAL(0x0011ddfd21260e42ULL, 0x00d05b0319a76892ULL,
-                           0x00183ea4368e9b8fULL, 0x00b0815662affc96ULL,
-                           0x00b466a5e7ce7c88ULL, 0x00db93b07506e6eeULL,
-                           0x0033885f82f62401ULL, 0x0086f9090ec9b419ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00d95d1c5fcb435aULL, 0x0016d1ed6b5086f9ULL,
-                           0x00792aa0b7e54d71ULL, 0x0067b65715f1925dULL,
-                           0x00a219755ec6176bULL, 0x00bc3f026b12c28fULL,
-                           0x00700c897ffeb93eULL, 0x0089b83f6ec50b46ULL)},
-            {FIELD_LITERAL(0x003c97e6384da36eULL, 0x00423d53eac81a09ULL,
-                           0x00b70d68f3cdce35ULL, 0x00ee7959b354b92cULL,
-                           0x00f4e9718819c8caULL, 0x009349f12acbffe9ULL,
-                           0x005aee7b62cb7da6ULL, 0x00d97764154ffc86ULL)},
-            {FIELD_LITERAL(0x00526324babb46dcULL, 0x002ee99b38d7bf9eULL,
-                           0x007ea51794706ef4ULL, 0x00abeb04da6e3c39ULL,
-                           0x006b457c1d281060ULL, 0x00fe243e9a66c793ULL,
-                           0x00378de0fb6c6ee4ULL, 0x003e4194b9c3cb93ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00fed3cd80ca2292ULL, 0x0015b043a73ca613ULL,
-                           0x000a9fd7bf9be227ULL, 0x003b5e03de2db983ULL,
-                           0x005af72d46904ef7ULL, 0x00c0f1b5c49faa99ULL,
-                           0x00dc86fc3bd305e1ULL, 0x00c92f08c1cb1797ULL)},
-            {FIELD_LITERAL(0x0079680ce111ed3bULL, 0x001a1ed82806122cULL,
-                           0x000c2e7466d15df3ULL, 0x002c407f6f7150fdULL,
-                           0x00c5e7c96b1b0ce3ULL, 0x009aa44626863ff9ULL,
-                           0x00887b8b5b80be42ULL, 0x00b6023cec964825ULL)},
-            {FIELD_LITERAL(0x00e4a8e1048970c8ULL, 0x0062887b7830a302ULL,
-                           0x00bcf1c8cd81402bULL, 0x0056dbb81a68f5beULL,
-                           0x0014eced83f12452ULL, 0x00139e1a510150dfULL,
-                           0x00bb81140a82d1a3ULL, 0x000febcc1aaf1aa7ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00a7527958238159ULL, 0x0013ec9537a84cd6ULL,
-                           0x001d7fee7d562525ULL, 0x00b9eefa6191d5e5ULL,
-                           0x00dbc97db70bcb8aULL, 0x00481affc7a4d395ULL,
-                           0x006f73d3e70c31bbULL, 0x00183f324ed96a61ULL)},
-            {FIELD_LITERAL(0x0039dd7ce7fc6860ULL, 0x00d64f6425653da1ULL,
-                           0x003e037c7f57d0afULL, 0x0063477a06e2bcf2ULL,
-                           0x001727dbb7ac67e6ULL, 0x0049589f5efafe2eULL,
-                           0x00fc0fef2e813d54ULL, 0x008baa5d087fb50dULL)},
-            {FIELD_LITERAL(0x0024fb59d9b457c7ULL, 0x00a7d4e060223e4cULL,
-                           0x00c118d1b555fd80ULL, 0x0082e216c732f22aULL,
-                           0x00cd2a2993089504ULL, 0x003638e836a3e13dULL,
-                           0x000d855ee89b4729ULL, 0x008ec5b7d4810c91ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x001bf51f7d65cdfdULL, 0x00d14cdafa16a97dULL,
-                           0x002c38e60fcd10e7ULL, 0x00a27446e393efbdULL,
-                           0x000b5d8946a71fddULL, 0x0063df2cde128f2fULL,
-                           0x006c8679569b1888ULL, 0x0059ffc4925d732dULL)},
-            {FIELD_LITERAL(0x00ece96f95f2b66fULL, 0x00ece7952813a27bULL,
-                           0x0026fc36592e489eULL, 0x007157d1a2de0f66ULL,
-                           0x00759dc111d86ddfULL, 0x0012881e5780bb0fULL,
-                           0x00c8ccc83ad29496ULL, 0x0012b9bd1929eb71ULL)},
-            {FIELD_LITERAL(0x000fa15a20da5df0ULL, 0x00349ddb1a46cd31ULL,
-                           0x002c512ad1d8e726ULL, 0x00047611f669318dULL,
-                           0x009e68fba591e17eULL, 0x004320dffa803906ULL,
-                           0x00a640874951a3d3ULL, 0x00b6353478baa24fULL)},
-        }}, {{
-            {FIELD_LITERAL(0x009696510000d333ULL, 0x00ec2f788bc04826ULL,
-                           0x000e4d02b1f67ba5ULL, 0x00659aa8dace08b6ULL,
-                           0x00d7a38a3a3ae533ULL, 0x008856defa8c746bULL,
-                           0x004d7a4402d3da1aULL, 0x00ea82e06229260fULL)},
-            {FIELD_LITERAL(0x006a15bb20f75c0cULL, 0x0079a144027a5d0cULL,
-                           0x00d19116ce0b4d70ULL, 0x0059b83bcb0b268eULL,
-                           0x005f58f63f16c127ULL, 0x0079958318ee2c37ULL,
-                           0x00defbb063d07f82ULL, 0x00f1f0b931d2d446ULL)},
-            {FIELD_LITERAL(0x00cb5e4c3c35d422ULL, 0x008df885ca43577fULL,
-                           0x00fa50b16ca3e471ULL, 0x005a0e58e17488c8ULL,
-                           0x00b2ceccd6d34d19ULL, 0x00f01d5d235e36e9ULL,
-                           0x00db2e7e4be6ca44ULL, 0x00260ab77f35fccdULL)},
-        }}, {{
-            {FIELD_LITERAL(0x006f6fd9baac61d5ULL, 0x002a7710a020a895ULL,
-                           0x009de0db7fc03d4dULL, 0x00cdedcb1875f40bULL,
-                           0x00050caf9b6b1e22ULL, 0x005e3a6654456ab0ULL,
-                           0x00775fdf8c4423d4ULL, 0x0028701ea5738b5dULL)},
-            {FIELD_LITERAL(0x009ffd90abfeae96ULL, 0x00cba3c2b624a516ULL,
-                           0x005ef08bcee46c91ULL, 0x00e6fde30afb6185ULL,
-                           0x00f0b4db4f818ce4ULL, 0x006c54f45d2127f5ULL,
-                           0x00040125035854c7ULL, 0x00372658a3287e13ULL)},
-            {FIELD_LITERAL(0x00d7070fb1beb2abULL, 0x0078fc845a93896bULL,
-                           0x006894a4b2f224a6ULL, 0x005bdd8192b9dbdeULL,
-                           0x00b38839874b3a9eULL, 0x00f93618b04b7a57ULL,
-                           0x003e3ec75fd2c67eULL, 0x00bf5e6bfc29494aULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00f19224ebba2aa5ULL, 0x0074f89d358e694dULL,
-                           0x00eea486597135adULL, 0x0081579a4555c7e1ULL,
-                           0x0010b9b872930a9dULL, 0x00f002e87a30ecc0ULL,
-                           0x009b9d66b6de56e2ULL, 0x00a3c4f45e8004ebULL)},
-            {FIELD_LITERAL(0x0045e8dda9400888ULL, 0x002ff12e5fc05db7ULL,
-                           0x00a7098d54afe69cULL, 0x00cdbe846a500585ULL,
-                           0x00879c1593ca1882ULL, 0x003f7a7fea76c8b0ULL,
-                           0x002cd73dd0c8e0a1ULL, 0x00645d6ce96f51feULL)},
-            {FIELD_LITERAL(0x002b7e83e123d6d6ULL, 0x00398346f7419c80ULL,
-                           0x0042922e55940163ULL, 0x005e7fc5601886a3ULL,
-                           0x00e88f2cee1d3103ULL, 0x00e7fab135f2e377ULL,
-                           0x00b059984dbf0dedULL, 0x0009ce080faa5bb8ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0085e78af7758979ULL, 0x00275a4ee1631a3aULL,
-                           0x00d26bc0ed78b683ULL, 0x004f8355ea21064fULL,
-                           0x00d618e1a32696e5ULL, 0x008d8d7b150e5680ULL,
-                           0x00a74cd854b278d2ULL, 0x001dd62702203ea0ULL)},
-            {FIELD_LITERAL(0x00f89335c2a59286ULL, 0x00a0f5c905d55141ULL,
-                           0x00b41fb836ee9382ULL, 0x00e235d51730ca43ULL,
-                           0x00a5cb37b5c0a69aULL, 0x009b966ffe136c45ULL,
-                           0x00cb2ea10bf80ed1ULL, 0x00fb2b370b40dc35ULL)},
-            {FIELD_LITERAL(0x00d687d16d4ee8baULL, 0x0071520bdd069dffULL,
-                           0x00de85c60d32355dULL, 0x0087d2e3565102f4ULL,
-                           0x00cde391b8dfc9aaULL, 0x00e18d69efdfefe5ULL,
-                           0x004a9d0591954e91ULL, 0x00fa36dd8b50eee5ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x002e788749a865f7ULL, 0x006e4dc3116861eaULL,
-                           0x009f1428c37276e6ULL, 0x00e7d2e0fc1e1226ULL,
-                           0x003aeebc6b6c45f6ULL, 0x0071a8073bf500c9ULL,
-                           0x004b22ad986b530cULL, 0x00f439e63c0d79d4ULL)},
-            {FIELD_LITERAL(0x006bc3d53011f470ULL, 0x00032d6e692b83e8ULL,
-                           0x00059722f497cd0bULL, 0x0009b4e6f0c497ccULL,
-                           0x0058a804b7cce6c0ULL, 0x002b71d3302bbd5dULL,
-                           0x00e2f82a36765fceULL, 0x008dded99524c703ULL)},
-            {FIELD_LITERAL(0x004d058953747d64ULL, 0x00701940fe79aa6fULL,
-                           0x00a620ac71c760bfULL, 0x009532b611158b75ULL,
-                           0x00547ed7f466f300ULL, 0x003cb5ab53a8401aULL,
-                           0x00c7763168ce3120ULL, 0x007e48e33e4b9ab2ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x001b2fc57bf3c738ULL, 0x006a3f918993fb80ULL,
-                           0x0026f7a14fdec288ULL, 0x0075a2cdccef08dbULL,
-                           0x00d3ecbc9eecdbf1ULL, 0x0048c40f06e5bf7fULL,
-                           0x00d63e423009896bULL, 0x000598bc99c056a8ULL)},
-            {FIELD_LITERAL(0x002f194eaafa46dcULL, 0x008e38f57fe87613ULL,
-                           0x00dc8e5ae25f4ab2ULL, 0x000a17809575e6bdULL,
-                           0x00d3ec7923ba366aULL, 0x003a7e72e0ad75e3ULL,
-                           0x0010024b88436e0aULL, 0x00ed3c5444b64051ULL)},
-            {FIELD_LITERAL(0x00831fc1340af342ULL, 0x00c9645669466d35ULL,
-                           0x007692b4cc5a080fULL, 0x009fd4a47ac9259fULL,
-                           0x001eeddf7d45928bULL, 0x003c0446fc45f28bULL,
-                           0x002c0713aa3e2507ULL, 0x0095706935f0f41eULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00766ae4190ec6d8ULL, 0x0065768cabc71380ULL,
-                           0x00b902598416cdc2ULL, 0x00380021ad38df52ULL,
-                           0x008f0b89d6551134ULL, 0x004254d4cc62c5a5ULL,
-                           0x000d79f4484b9b94ULL, 0x00b516732ae3c50eULL)},
-            {FIELD_LITERAL(0x001fb73475c45509ULL, 0x00d2b2e5ea43345aULL,
-                           0x00cb3c3842077bd1ULL, 0x0029f90ad820946eULL,
-                           0x007c11b2380778aaULL, 0x009e54ece62c1704ULL,
-                           0x004bc60c41ca01c3ULL, 0x004525679a5a0b03ULL)},
-            {FIELD_LITERAL(0x00c64fbddbed87b3ULL, 0x0040601d11731faaULL,
-                           0x009c22475b6f9d67ULL, 0x0024b79dae875f15ULL,
-                           0x00616fed3f02c3b0ULL, 0x0000cf39f6af2d3bULL,
-                           0x00c46bac0aa9a688ULL, 0x00ab23e2800da204ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x000b3a37617632b0ULL, 0x00597199fe1cfb6cULL,
-                           0x0042a7ccdfeafdd6ULL, 0x004cc9f15ebcea17ULL,
-                           0x00f436e596a6b4a4ULL, 0x00168861142df0d8ULL,
-                           0x000753edfec26af5ULL, 0x000c495d7e388116ULL)},
-            {FIELD_LITERAL(0x0017085f4a346148ULL, 0x00c7cf7a37f62272ULL,
-                           0x001776e129bc5c30ULL, 0x009955134c9eef2aULL,
-                           0x001ba5bdf1df07beULL, 0x00ec39497103a55cULL,
-                           0x006578354fda6cfbULL, 0x005f02719d4f15eeULL)},
-            {FIELD_LITERAL(0x0052b9d9b5d9655dULL, 0x00d4ec7ba1b461c3ULL,
-                           0x00f95df4974f280bULL, 0x003d8e5ca11aeb51ULL,
-                           0x00d4981eb5a70b26ULL, 0x000af9a4f6659f29ULL,
-                           0x004598c846faeb43ULL, 0x0049d9a183a47670ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x000a72d23dcb3f1fULL, 0x00a3737f84011727ULL,
-                           0x00f870c0fbbf4a47ULL, 0x00a7aadd04b5c9caULL,
-                           0x000c7715c67bd072ULL, 0x00015a136afcd74eULL,
-                           0x0080d5caea499634ULL, 0x0026b448ec7514b7ULL)},
-            {FIELD_LITERAL(0x00b60167d9e7d065ULL, 0x00e60ba0d07381e8ULL,
-                           0x003a4f17b725c2d4ULL, 0x006c19fe176b64faULL,
-                           0x003b57b31af86ccbULL, 0x0021047c286180fdULL,
-                           0x00bdc8fb00c6dbb6ULL, 0x00fe4a9f4bab4f3fULL)},
-            {FIELD_LITERAL(0x0088ffc3a16111f7ULL, 0x009155e4245d0bc8ULL,
-                           0x00851d68220572d5ULL, 0x00557ace1e514d29ULL,
-                           0x0031d7c339d91022ULL, 0x00101d0ae2eaceeaULL,
-                           0x00246ab3f837b66aULL, 0x00d5216d381ff530ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0057e7ea35f36daeULL, 0x00f47d7ad15de22eULL,
-                           0x00d757ea4b105115ULL, 0x008311457d579d7eULL,
-                           0x00b49b75b1edd4ebULL, 0x0081c7ff742fd63aULL,
-                           0x00ddda3187433df6ULL, 0x00475727d55f9c66ULL)},
-            {FIELD_LITERAL(0x00a6295218dc136aULL, 0x00563b3af0e9c012ULL,
-                           0x00d3753b0145db1bULL, 0x004550389c043dc1ULL,
-                           0x00ea94ae27401bdfULL, 0x002b0b949f2b7956ULL,
-                           0x00c63f780ad8e23cULL, 0x00e591c47d6bab15ULL)},
-            {FIELD_LITERAL(0x00416c582b058eb6ULL, 0x004107da5b2cc695ULL,
-                           0x00b3cd2556aeec64ULL, 0x00c0b418267e57a1ULL,
-                           0x001799293579bd2eULL, 0x0046ed44590e4d07ULL,
-                           0x001d7459b3630a1eULL, 0x00c6afba8b6696aaULL)},
-        }}, {{
-            {FIELD_LITERAL(0x008d6009b26da3f8ULL, 0x00898e88ca06b1caULL,
-                           0x00edb22b2ed7fe62ULL, 0x00fbc93516aabe80ULL,
-                           0x008b4b470c42ce0dULL, 0x00e0032ba7d0dcbbULL,
-                           0x00d76da3a956ecc8ULL, 0x007f20fe74e3852aULL)},
-            {FIELD_LITERAL(0x002419222c607674ULL, 0x00a7f23af89188b3ULL,
-                           0x00ad127284e73d1cULL, 0x008bba582fae1c51ULL,
-                           0x00fc6aa7ca9ecab1ULL, 0x003df5319eb6c2baULL,
-                           0x002a05af8a8b199aULL, 0x004bf8354558407cULL)},
-            {FIELD_LITERAL(0x00ce7d4a30f0fcbfULL, 0x00d02c272629f03dULL,
-                           0x0048c001f7400bc2ULL, 0x002c21368011958dULL,
-                           0x0098a550391e96b5ULL, 0x002d80b66390f379ULL,
-                           0x001fa878760cc785ULL, 0x001adfce54b613d5ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x001ed4dc71fa2523ULL, 0x005d0bff19bf9b5cULL,
-                           0x00c3801cee065a64ULL, 0x001ed0b504323fbfULL,
-                           0x0003ab9fdcbbc593ULL, 0x00df82070178b8d2ULL,
-                           0x00a2bcaa9c251f85ULL, 0x00c628a3674bd02eULL)},
-            {FIELD_LITERAL(0x006b7a0674f9f8deULL, 0x00a742414e5c7cffULL,
-                           0x0041cbf3c6e13221ULL, 0x00e3a64fd207af24ULL,
-                           0x0087c05f15fbe8d1ULL, 0x004c50936d9e8a33ULL,
-                           0x001306ec21042b6dULL, 0x00a4f4137d1141c2ULL)},
-            {FIELD_LITERAL(0x0009e6fb921568b0ULL, 0x00b3c60120219118ULL,
-                           0x002a6c3460dd503aULL, 0x009db1ef11654b54ULL,
-                           0x0063e4bf0be79601ULL, 0x00670d34bb2592b9ULL,
-                           0x00dcee2f6c4130ceULL, 0x00b2682e88e77f54ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x000d5b4b3da135abULL, 0x00838f3e5064d81dULL,
-                           0x00d44eb50f6d94edULL, 0x0008931ab502ac6dULL,
-                           0x00debe01ca3d3586ULL, 0x0025c206775f0641ULL,
-                           0x005ad4b6ae912763ULL, 0x007e2c318ad8f247ULL)},
-            {FIELD_LITERAL(0x00ddbe0750dd1addULL, 0x004b3c7b885844b8ULL,
-                           0x00363e7ecf12f1aeULL, 0x0062e953e6438f9dULL,
-                           0x0023cc73b076afe9ULL, 0x00b09fa083b4da32ULL,
-                           0x00c7c3d2456c541dULL, 0x005b591ec6b694d4ULL)},
-            {FIELD_LITERAL(0x0028656e19d62fcfULL, 0x0052a4af03df148dULL,
-                           0x00122765ddd14e42ULL, 0x00f2252904f67157ULL,
-                           0x004741965b636f3aULL, 0x006441d296132cb9ULL,
-                           0x005e2106f956a5b7ULL, 0x00247029592d335cULL)},
-        }}, {{
-            {FIELD_LITERAL(0x003fe038eb92f894ULL, 0x000e6da1b72e8e32ULL,
-                           0x003a1411bfcbe0faULL, 0x00b55d473164a9e4ULL,
-                           0x00b9a775ac2df48dULL, 0x0002ddf350659e21ULL,
-                           0x00a279a69eb19cb3ULL, 0x00f844eab25cba44ULL)},
-            {FIELD_LITERAL(0x00c41d1f9c1f1ac1ULL, 0x007b2df4e9f19146ULL,
-                           0x00b469355fd5ba7aULL, 0x00b5e1965afc852aULL,
-                           0x00388d5f1e2d8217ULL, 0x0022079e4c09ae93ULL,
-                           0x0014268acd4ef518ULL, 0x00c1dd8d9640464cULL)},
-            {FIELD_LITERAL(0x0038526adeed0c55ULL, 0x00dd68c607e3fe85ULL,
-                           0x00f746ddd48a5d57ULL, 0x0042f2952b963b7cULL,
-                           0x001cbbd6876d5ec2ULL, 0x005e341470bca5c2ULL,
-                           0x00871d41e085f413ULL, 0x00e53ab098f45732ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x004d51124797c831ULL, 0x008f5ae3750347adULL,
-                           0x0070ced94c1a0c8eULL, 0x00f6db2043898e64ULL,
-                           0x000d00c9a5750cd0ULL, 0x000741ec59bad712ULL,
-                           0x003c9d11aab37b7fULL, 0x00a67ba169807714ULL)},
-            {FIELD_LITERAL(0x00adb2c1566e8b8fULL, 0x0096c68a35771a9aULL,
-                           0x00869933356f334aULL, 0x00ba9c93459f5962ULL,
-                           0x009ec73fb6e8ca4bULL, 0x003c3802c27202e1ULL,
-                           0x0031f5b733e0c008ULL, 0x00f9058c19611fa9ULL)},
-            {FIELD_LITERAL(0x00238f01814a3421ULL, 0x00c325a44b6cce28ULL,
-                           0x002136f97aeb0e73ULL, 0x000cac8268a4afe2ULL,
-                           0x0022fd218da471b3ULL, 0x009dcd8dfff8def9ULL,
-                           0x00cb9f8181d999bbULL, 0x00143ae56edea349ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0000623bf87622c5ULL, 0x00a1966fdd069496ULL,
-                           0x00c315b7b812f9fcULL, 0x00bdf5efcd128b97ULL,
-                           0x001d464f532e3e16ULL, 0x003cd94f081bfd7eULL,
-                           0x00ed9dae12ce4009ULL, 0x002756f5736eee70ULL)},
-            {FIELD_LITERAL(0x00a5187e6ee7341bULL, 0x00e6d52e82d83b6eULL,
-                           0x00df3c41323094a7ULL, 0x00b3324f444e9de9ULL,
-                           0x00689eb21a35bfe5ULL, 0x00f16363becd548dULL,
-                           0x00e187cc98e7f60fULL, 0x00127d9062f0ccabULL)},
-            {FIELD_LITERAL(0x004ad71b31c29e40ULL, 0x00a5fcace12fae29ULL,
-                           0x004425b5597280edULL, 0x00e7ef5d716c3346ULL,
-                           0x0010b53ada410ac8ULL, 0x0092310226060c9bULL,
-                           0x0091c26128729c7eULL, 0x0088b42900f8ec3bULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00f1e26e9762d4a8ULL, 0x00d9d74082183414ULL,
-                           0x00ffec9bd57a0282ULL, 0x000919e128fd497aULL,
-                           0x00ab7ae7d00fe5f8ULL, 0x0054dc442851ff68ULL,
-                           0x00c9ebeb3b861687ULL, 0x00507f7cab8b698fULL)},
-            {FIELD_LITERAL(0x00c13c5aae3ae341ULL, 0x009c6c9ed98373e7ULL,
-                           0x00098f26864577a8ULL, 0x0015b886e9488b45ULL,
-                           0x0037692c42aadba5ULL, 0x00b83170b8e7791cULL,
-                           0x001670952ece1b44ULL, 0x00fd932a39276da2ULL)},
-            {FIELD_LITERAL(0x0081a3259bef3398ULL, 0x005480fff416107bULL,
-                           0x00ce4f607d21be98ULL, 0x003ffc084b41df9bULL,
-                           0x0043d0bb100502d1ULL, 0x00ec35f575ba3261ULL,
-                           0x00ca18f677300ef3ULL, 0x00e8bb0a827d8548ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00df76b3328ada72ULL, 0x002e20621604a7c2ULL,
-                           0x00f910638a105b09ULL, 0x00ef4724d96ef2cdULL,
-                           0x00377d83d6b8a2f7ULL, 0x00b4f48805ade324ULL,
-                           0x001cd5da8b152018ULL, 0x0045af671a20ca7fULL)},
-            {FIELD_LITERAL(0x009ae3b93a56c404ULL, 0x004a410b7a456699ULL,
-                           0x00023a619355e6b2ULL, 0x009cdc7297387257ULL,
-                           0x0055b94d4ae70d04ULL, 0x002cbd607f65b005ULL,
-                           0x003208b489697166ULL, 0x00ea2aa058867370ULL)},
-            {FIELD_LITERAL(0x00f29d2598ee3f32ULL, 0x00b4ac5385d82adcULL,
-                           0x007633eaf04df19bULL, 0x00aa2d3d77ceab01ULL,
-                           0x004a2302fcbb778aULL, 0x00927f225d5afa34ULL,
-                           0x004a8e9d5047f237ULL, 0x008224ae9dbce530ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x001cf640859b02f8ULL, 0x00758d1d5d5ce427ULL,
-                           0x00763c784ef4604cULL, 0x005fa81aee205270ULL,
-                           0x00ac537bfdfc44cbULL, 0x004b919bd342d670ULL,
-                           0x00238508d9bf4b7aULL, 0x00154888795644f3ULL)},
-            {FIELD_LITERAL(0x00c845923c084294ULL, 0x00072419a201bc25ULL,
-                           0x0045f408b5f8e669ULL, 0x00e9d6a186b74dfeULL,
-                           0x00e19108c68fa075ULL, 0x0017b91d874177b7ULL,
-                           0x002f0ca2c7912c5aULL, 0x009400aa385a90a2ULL)},
-            {FIELD_LITERAL(0x0071110b01482184ULL, 0x00cfed0044f2bef8ULL,
-                           0x0034f2901cf4662eULL, 0x003b4ae2a67f9834ULL,
-                           0x00cca9b96fe94810ULL, 0x00522507ae77abd0ULL,
-                           0x00bac7422721e73eULL, 0x0066622b0f3a62b0ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00f8ac5cf4705b6aULL, 0x00867d82dcb457e3ULL,
-                           0x007e13ab2ccc2ce9ULL, 0x009ee9a018d3930eULL,
-                           0x008370f8ecb42df8ULL, 0x002d9f019add263eULL,
-                           0x003302385b92d196ULL, 0x00a15654536e2c0cULL)},
-            {FIELD_LITERAL(0x0026ef1614e160afULL, 0x00c023f9edfc9c76ULL,
-                           0x00cff090da5f57baULL, 0x0076db7a66643ae9ULL,
-                           0x0019462f8c646999ULL, 0x008fec00b3854b22ULL,
-                           0x00d55041692a0a1cULL, 0x0065db894215ca00ULL)},
-            {FIELD_LITERAL(0x00a925036e0a451cULL, 0x002a0390c36b6cc1ULL,
-                           0x00f27020d90894f4ULL, 0x008d90d52cbd3d7fULL,
-                           0x00e1d0137392f3b8ULL, 0x00f017c158b51a8fULL,
-                           0x00cac313d3ed7dbcULL, 0x00b99a81e3eb42d3ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00b54850275fe626ULL, 0x0053a3fd1ec71140ULL,
-                           0x00e3d2d7dbe096faULL, 0x00e4ac7b595cce4cULL,
-                           0x0077bad449c0a494ULL, 0x00b7c98814afd5b3ULL,
-                           0x0057226f58486cf9ULL, 0x00b1557154f0cc57ULL)},
-            {FIELD_LITERAL(0x008cc9cd236315c0ULL, 0x0031d9c5b39fda54ULL,
-                           0x00a5713ef37e1171ULL, 0x00293d5ae2886325ULL,
-                           0x00c4aba3e05015e1ULL, 0x0003f35ef78e4fc6ULL,
-                           0x0039d6bd3ac1527bULL, 0x0019d7c3afb77106ULL)},
-            {FIELD_LITERAL(0x007b162931a985afULL, 0x00ad40a2e0daa713ULL,
-                           0x006df27c4009f118ULL, 0x00503e9f4e2e8becULL,
-                           0x00751a77c82c182dULL, 0x000298937769245bULL,
-                           0x00ffb1e8fabf9ee5ULL, 0x0008334706e09abeULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00dbca4e98a7dcd9ULL, 0x00ee29cfc78bde99ULL,
-                           0x00e4a3b6995f52e9ULL, 0x0045d70189ae8096ULL,
-                           0x00fd2a8a3b9b0d1bULL, 0x00af1793b107d8e1ULL,
-                           0x00dbf92cbe4afa20ULL, 0x00da60f798e3681dULL)},
-            {FIELD_LITERAL(0x004246bfcecc627aULL, 0x004ba431246c03a4ULL,
-                           0x00bd1d101872d497ULL, 0x003b73d3f185ee16ULL,
-                           0x001feb2e2678c0e3ULL, 0x00ff13c5a89dec76ULL,
-                           0x00ed06042e771d8fULL, 0x00a4fd2a897a83ddULL)},
-            {FIELD_LITERAL(0x009a4a3be50d6597ULL, 0x00de3165fc5a1096ULL,
-                           0x004f3f56e345b0c7ULL, 0x00f7bf721d5ab8bcULL,
-                           0x004313e47b098c50ULL, 0x00e4c7d5c0e1adbbULL,
-                           0x002e3e3db365051eULL, 0x00a480c2cd6a96fbULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00417fa30a7119edULL, 0x00af257758419751ULL,
-                           0x00d358a487b463d4ULL, 0x0089703cc720b00dULL,
-                           0x00ce56314ff7f271ULL, 0x0064db171ade62c1ULL,
-                           0x00640b36d4a22fedULL, 0x00424eb88696d23fULL)},
-            {FIELD_LITERAL(0x004ede34af2813f3ULL, 0x00d4a8e11c9e8216ULL,
-                           0x004796d5041de8a5ULL, 0x00c4c6b4d21cc987ULL,
-                           0x00e8a433ee07fa1eULL, 0x0055720b5abcc5a1ULL,
-                           0x008873ea9c74b080ULL, 0x005b3fec1ab65d48ULL)},
-            {FIELD_LITERAL(0x0047e5277db70ec5ULL, 0x000a096c66db7d6bULL,
-                           0x00b4164cc1730159ULL, 0x004a9f783fe720feULL,
-                           0x00a8177b94449dbcULL, 0x0095a24ff49a599fULL,
-                           0x0069c1c578250cbcULL, 0x00452019213debf4ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0021ce99e09ebda3ULL, 0x00fcbd9f91875ad0ULL,
-                           0x009bbf6b7b7a0b5fULL, 0x00388886a69b1940ULL,
-                           0x00926a56d0f81f12ULL, 0x00e12903c3358d46ULL,
-                           0x005dfce4e8e1ce9dULL, 0x0044cfa94e2f7e23ULL)},
-            {FIELD_LITERAL(0x001bd59c09e982eaULL, 0x00f72daeb937b289ULL,
-                           0x0018b76dca908e0eULL, 0x00edb498512384adULL,
-                           0x00ce0243b6cc9538ULL, 0x00f96ff690cb4e70ULL,
-                           0x007c77bf9f673c8dULL, 0x005bf704c088a528ULL)},
-            {FIELD_LITERAL(0x0093d4628dcb33beULL, 0x0095263d51d42582ULL,
-                           0x0049b3222458fe06ULL, 0x00e7fce73b653a7fULL,
-                           0x003ca2ebce60b369ULL, 0x00c5de239a32bea4ULL,
-                           0x0063b8b3d71fb6bfULL, 0x0039aeeb78a1a839ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x007dc52da400336cULL, 0x001fded1e15b9457ULL,
-                           0x00902e00f5568e3aULL, 0x00219bef40456d2dULL,
-                           0x005684161fb3dbc9ULL, 0x004a4e9be49a76eaULL,
-                           0x006e685ae88b78ffULL, 0x0021c42f13042d3cULL)},
-            {FIELD_LITERAL(0x00fb22bb5fd3ce50ULL, 0x0017b48aada7ae54ULL,
-                           0x00fd5c44ad19a536ULL, 0x000ccc4e4e55e45cULL,
-                           0x00fd637d45b4c3f5ULL, 0x0038914e023c37cfULL,
-                           0x00ac1881d6a8d898ULL, 0x00611ed8d3d943a8ULL)},
-            {FIELD_LITERAL(0x0056e2259d113d2bULL, 0x00594819b284ec16ULL,
-                           0x00c7bf794bb36696ULL, 0x00721ee75097cdc6ULL,
-                           0x00f71be9047a2892ULL, 0x00df6ba142564edfULL,
-                           0x0069580b7a184e8dULL, 0x00f056e38fca0feeULL)},
-        }}, {{
-            {FIELD_LITERAL(0x009df98566a18c6dULL, 0x00cf3a200968f219ULL,
-                           0x0044ba60da6d9086ULL, 0x00dbc9c0e344da03ULL,
-                           0x000f9401c4466855ULL, 0x00d46a57c5b0a8d1ULL,
-                           0x00875a635d7ac7c6ULL, 0x00ef4a933b7e0ae6ULL)},
-            {FIELD_LITERAL(0x005e8694077a1535ULL, 0x008bef75f71c8f1dULL,
-                           0x000a7c1316423511ULL, 0x00906e1d70604320ULL,
-                           0x003fc46c1a2ffbd6ULL, 0x00d1d5022e68f360ULL,
-                           0x002515fba37bbf46ULL, 0x00ca16234e023b44ULL)},
-            {FIELD_LITERAL(0x00787c99561f4690ULL, 0x00a857a8c1561f27ULL,
-                           0x00a10df9223c09feULL, 0x00b98a9562e3b154ULL,
-                           0x004330b8744c3ed2ULL, 0x00e06812807ec5c4ULL,
-                           0x00e4cf6a7db9f1e3ULL, 0x00d95b089f132a34ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x002922b39ca33eecULL, 0x0090d12a5f3ab194ULL,
-                           0x00ab60c02fb5f8edULL, 0x00188d292abba1cfULL,
-                           0x00e10edec9698f6eULL, 0x0069a4d9934133c8ULL,
-                           0x0024aac40e6d3d06ULL, 0x001702c2177661b0ULL)},
-            {FIELD_LITERAL(0x00139078397030bdULL, 0x000e3c447e859a00ULL,
-                           0x0064a5b334c82393ULL, 0x00b8aabeb7358093ULL,
-                           0x00020778bb9ae73bULL, 0x0032ee94c7892a18ULL,
-                           0x008215253cb41bdaULL, 0x005e2797593517aeULL)},
-            {FIELD_LITERAL(0x0083765a5f855d4aULL, 0x0051b6d1351b8ee2ULL,
-                           0x00116de548b0f7bbULL, 0x0087bd88703affa0ULL,
-                           0x0095b2cc34d7fdd2ULL, 0x0084cd81b53f0bc8ULL,
-                           0x008562fc995350edULL, 0x00a39abb193651e3ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0019e23f0474b114ULL, 0x00eb94c2ad3b437eULL,
-                           0x006ddb34683b75acULL, 0x00391f9209b564c6ULL,
-                           0x00083b3bb3bff7aaULL, 0x00eedcd0f6dceefcULL,
-                           0x00b50817f794fe01ULL, 0x0036474deaaa75c9ULL)},
-            {FIELD_LITERAL(0x0091868594265aa2ULL, 0x00797accae98ca6dULL,
-                           0x0008d8c5f0f8a184ULL, 0x00d1f4f1c2b2fe6eULL,
-                           0x0036783dfb48a006ULL, 0x008c165120503527ULL,
-                           0x0025fd780058ce9bULL, 0x0068beb007be7d27ULL)},
-            {FIELD_LITERAL(0x00d0ff88aa7c90c2ULL, 0x00b2c60dacf53394ULL,
-                           0x0094a7284d9666d6ULL, 0x00bed9022ce7a19dULL,
-                           0x00c51553f0cd7682ULL, 0x00c3fb870b124992ULL,
-                           0x008d0bc539956c9bULL, 0x00fc8cf258bb8885ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x003667bf998406f8ULL, 0x0000115c43a12975ULL,
-                           0x001e662f3b20e8fdULL, 0x0019ffa534cb24ebULL,
-                           0x00016be0dc8efb45ULL, 0x00ff76a8b26243f5ULL,
-                           0x00ae20d241a541e3ULL, 0x0069bd6af13cd430ULL)},
-            {FIELD_LITERAL(0x0045fdc16487cda3ULL, 0x00b2d8e844cf2ed7ULL,
-                           0x00612c50e88c1607ULL, 0x00a08aabc66c1672ULL,
-                           0x006031fdcbb24d97ULL, 0x001b639525744b93ULL,
-                           0x004409d62639ab17ULL, 0x00a1853d0347ab1dULL)},
-            {FIELD_LITERAL(0x0075a1a56ebf5c21ULL, 0x00a3e72be9ac53edULL,
-                           0x00efcde1629170c2ULL, 0x0004225fe91ef535ULL,
-                           0x0088049fc73dfda7ULL, 0x004abc74857e1288ULL,
-                           0x0024e2434657317cULL, 0x00d98cb3d3e5543cULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00b4b53eab6bdb19ULL, 0x009b22d8b43711d0ULL,
-                           0x00d948b9d961785dULL, 0x00cb167b6f279eadULL,
-                           0x00191de3a678e1c9ULL, 0x00d9dd9511095c2eULL,
-                           0x00f284324cd43067ULL, 0x00ed74fa535151ddULL)},
-            {FIELD_LITERAL(0x007e32c049b5c477ULL, 0x009d2bfdbd9bcfd8ULL,
-                           0x00636e93045938c6ULL, 0x007fde4af7687298ULL,
-                           0x0046a5184fafa5d3ULL, 0x0079b1e7f13a359bULL,
-                           0x00875adf1fb927d6ULL, 0x00333e21c61bcad2ULL)},
-            {FIELD_LITERAL(0x00048014f73d8b8dULL, 0x0075684aa0966388ULL,
-                           0x0092be7df06dc47cULL, 0x0097cebcd0f5568aULL,
-                           0x005a7004d9c4c6a9ULL, 0x00b0ecbb659924c7ULL,
-                           0x00d90332dd492a7cULL, 0x0057fc14df11493dULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0008ed8ea0ad95beULL, 0x0041d324b9709645ULL,
-                           0x00e25412257a19b4ULL, 0x0058df9f3423d8d2ULL,
-                           0x00a9ab20def71304ULL, 0x009ae0dbf8ac4a81ULL,
-                           0x00c9565977e4392aULL, 0x003c9269444baf55ULL)},
-            {FIELD_LITERAL(0x007df6cbb926830bULL, 0x00d336058ae37865ULL,
-                           0x007af47dac696423ULL, 0x0048d3011ec64ac8ULL,
-                           0x006b87666e40049fULL, 0x0036a2e0e51303d7ULL,
-                           0x00ba319bd79dbc55ULL, 0x003e2737ecc94f53ULL)},
-            {FIELD_LITERAL(0x00d296ff726272d9ULL, 0x00f6d097928fcf57ULL,
-                           0x00e0e616a55d7013ULL, 0x00deaf454ed9eac7ULL,
-                           0x0073a56bedef4d92ULL, 0x006ccfdf6fc92e19ULL,
-                           0x009d1ee1371a7218ULL, 0x00ee3c2ee4462d80ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00437bce9bccdf9dULL, 0x00e0c8e2f85dc0a3ULL,
-                           0x00c91a7073995a19ULL, 0x00856ec9fe294559ULL,
-                           0x009e4b33394b156eULL, 0x00e245b0dc497e5cULL,
-                           0x006a54e687eeaeffULL, 0x00f1cd1cd00fdb7cULL)},
-            {FIELD_LITERAL(0x008132ae5c5d8cd1ULL, 0x00121d68324a1d9fULL,
-                           0x00d6be9dafcb8c76ULL, 0x00684d9070edf745ULL,
-                           0x00519fbc96d7448eULL, 0x00388182fdc1f27eULL,
-                           0x000235baed41f158ULL, 0x00bf6cf6f1a1796aULL)},
-            {FIELD_LITERAL(0x002adc4b4d148219ULL, 0x003084ada0d3a90aULL,
-                           0x0046de8aab0f2e4eULL, 0x00452d342a67b5fdULL,
-                           0x00d4b50f01d4de21ULL, 0x00db6d9fc0cefb79ULL,
-                           0x008c184c86a462cdULL, 0x00e17c83764d42daULL)},
-        }}, {{
-            {FIELD_LITERAL(0x007b2743b9a1e01aULL, 0x007847ffd42688c4ULL,
-                           0x006c7844d610a316ULL, 0x00f0cb8b250aa4b0ULL,
-                           0x00a19060143b3ae6ULL, 0x0014eb10b77cfd80ULL,
-                           0x000170905729dd06ULL, 0x00063b5b9cd72477ULL)},
-            {FIELD_LITERAL(0x00ce382dc7993d92ULL, 0x00021153e938b4c8ULL,
-                           0x00096f7567f48f51ULL, 0x0058f81ddfe4b0d5ULL,
-                           0x00cc379a56b355c7ULL, 0x002c760770d3e819ULL,
-                           0x00ee22d1d26e5a40ULL, 0x00de6d93d5b082d7ULL)},
-            {FIELD_LITERAL(0x000a91a42c52e056ULL, 0x00185f6b77fce7eaULL,
-                           0x000803c51962f6b5ULL, 0x0022528582ba563dULL,
-                           0x0043f8040e9856d6ULL, 0x0085a29ec81fb860ULL,
-                           0x005f9a611549f5ffULL, 0x00c1f974ecbd4b06ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x005b64c6fd65ec97ULL, 0x00c1fdd7f877bc7fULL,
-                           0x000d9cc6c89f841cULL, 0x005c97b7f1aff9adULL,
-                           0x0075e3c61475d47eULL, 0x001ecb1ba8153011ULL,
-                           0x00fe7f1c8d71d40dULL, 0x003fa9757a229832ULL)},
-            {FIELD_LITERAL(0x00ffc5c89d2b0cbaULL, 0x00d363d42e3e6fc3ULL,
-                           0x0019a1a0118e2e8aULL, 0x00f7baeff48882e1ULL,
-                           0x001bd5af28c6b514ULL, 0x0055476ca2253cb2ULL,
-                           0x00d8eb1977e2ddf3ULL, 0x00b173b1adb228a1ULL)},
-            {FIELD_LITERAL(0x00f2cb99dd0ad707ULL, 0x00e1e08b6859ddd8ULL,
-                           0x000008f2d0650bccULL, 0x00d7ed392f8615c3ULL,
-                           0x00976750a94da27fULL, 0x003e83bb0ecb69baULL,
-                           0x00df8e8d15c14ac6ULL, 0x00f9f7174295d9c2ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00f11cc8e0e70bcbULL, 0x00e5dc689974e7ddULL,
-                           0x0014e409f9ee5870ULL, 0x00826e6689acbd63ULL,
-                           0x008a6f4e3d895d88ULL, 0x00b26a8da41fd4adULL,
-                           0x000fb7723f83efd7ULL, 0x009c749db0a5f6c3ULL)},
-            {FIELD_LITERAL(0x002389319450f9baULL, 0x003677f31aa1250aULL,
-                           0x0092c3db642f38cbULL, 0x00f8b64c0dfc9773ULL,
-                           0x00cd49fe3505b795ULL, 0x0068105a4090a510ULL,
-                           0x00df0ba2072a8bb6ULL, 0x00eb396143afd8beULL)},
-            {FIELD_LITERAL(0x00a0d4ecfb24cdffULL, 0x00ddaf8008ba6479ULL,
-                           0x00f0b3e36d4b0f44ULL, 0x003734bd3af1f146ULL,
-                           0x00b87e2efc75527eULL, 0x00d230df55ddab50ULL,
-                           0x002613257ae56c1dULL, 0x00bc0946d135934dULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00468711bd994651ULL, 0x0033108fa67561bfULL,
-                           0x0089d760192a54b4ULL, 0x00adc433de9f1871ULL,
-                           0x000467d05f36e050ULL, 0x007847e0f0579f7fULL,
-                           0x00a2314ad320052dULL, 0x00b3a93649f0b243ULL)},
-            {FIELD_LITERAL(0x0067f8f0c4fe26c9ULL, 0x0079c4a3cc8f67b9ULL,
-                           0x0082b1e62f23550dULL, 0x00f2d409caefd7f5ULL,
-                           0x0080e67dcdb26e81ULL, 0x0087ae993ea1f98aULL,
-                           0x00aa108becf61d03ULL, 0x001acf11efb608a3ULL)},
-            {FIELD_LITERAL(0x008225febbab50d9ULL, 0x00f3b605e4dd2083ULL,
-                           0x00a32b28189e23d2ULL, 0x00d507e5e5eb4c97ULL,
-                           0x005a1a84e302821fULL, 0x0006f54c1c5f08c7ULL,
-                           0x00a347c8cb2843f0ULL, 0x0009f73e9544bfa5ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x006c59c9ae744185ULL, 0x009fc32f1b4282cdULL,
-                           0x004d6348ca59b1acULL, 0x00105376881be067ULL,
-                           0x00af4096013147dcULL, 0x004abfb5a5cb3124ULL,
-                           0x000d2a7f8626c354ULL, 0x009c6ed568e07431ULL)},
-            {FIELD_LITERAL(0x00e828333c297f8bULL, 0x009ef3cf8c3f7e1fULL,
-                           0x00ab45f8fff31cb9ULL, 0x00c8b4178cb0b013ULL,
-                           0x00d0c50dd3260a3fULL, 0x0097126ac257f5bcULL,
-                           0x0042376cc90c705aULL, 0x001d96fdb4a1071eULL)},
-            {FIELD_LITERAL(0x00542d44d89ee1a8ULL, 0x00306642e0442d98ULL,
-                           0x0090853872b87338ULL, 0x002362cbf22dc044ULL,
-                           0x002c222adff663b8ULL, 0x0067c924495fcb79ULL,
-                           0x000e621d983c977cULL, 0x00df77a9eccb66fbULL)},
-        }}, {{
-            {FIELD_LITERAL(0x002809e4bbf1814aULL, 0x00b9e854f9fafb32ULL,
-                           0x00d35e67c10f7a67ULL, 0x008f1bcb76e748cfULL,
-                           0x004224d9515687d2ULL, 0x005ba0b774e620c4ULL,
-                           0x00b5e57db5d54119ULL, 0x00e15babe5683282ULL)},
-            {FIELD_LITERAL(0x00832d02369b482cULL, 0x00cba52ff0d93450ULL,
-                           0x003fa9c908d554dbULL, 0x008d1e357b54122fULL,
-                           0x00abd91c2dc950c6ULL, 0x007eff1df4c0ec69ULL,
-                           0x003f6aeb13fb2d31ULL, 0x00002d6179fc5b2cULL)},
-            {FIELD_LITERAL(0x0046c9eda81c9c89ULL, 0x00b60cb71c8f62fcULL,
-                           0x0022f5a683baa558ULL, 0x00f87319fccdf997ULL,
-                           0x009ca09b51ce6a22ULL, 0x005b12baf4af7d77ULL,
-                           0x008a46524a1e33e2ULL, 0x00035a77e988be0dULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00a7efe46a7dbe2fULL, 0x002f66fd55014fe7ULL,
-                           0x006a428afa1ff026ULL, 0x0056caaa9604ab72ULL,
-                           0x0033f3bcd7fac8aeULL, 0x00ccb1aa01c86764ULL,
-                           0x00158d1edf13bf40ULL, 0x009848ee76fcf3b4ULL)},
-            {FIELD_LITERAL(0x00a9e7730a819691ULL, 0x00d9cc73c4992b70ULL,
-                           0x00e299bde067de5aULL, 0x008c314eb705192aULL,
-                           0x00e7226f17e8a3ccULL, 0x0029dfd956e65a47ULL,
-                           0x0053a8e839073b12ULL, 0x006f942b2ab1597eULL)},
-            {FIELD_LITERAL(0x001c3d780ecd5e39ULL, 0x0094f247fbdcc5feULL,
-                           0x00d5c786fd527764ULL, 0x00b6f4da74f0db2aULL,
-                           0x0080f1f8badcd5fcULL, 0x00f36a373ad2e23bULL,
-                           0x00f804f9f4343bf2ULL, 0x00d1af40ec623982ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0082aeace5f1b144ULL, 0x00f68b3108cf4dd3ULL,
-                           0x00634af01dde3020ULL, 0x000beab5df5c2355ULL,
-                           0x00e8b790d1b49b0bULL, 0x00e48d15854e36f4ULL,
-                           0x0040ab2d95f3db9fULL, 0x002711c4ed9e899aULL)},
-            {FIELD_LITERAL(0x0039343746531ebeULL, 0x00c8509d835d429dULL,
-                           0x00e79eceff6b0018ULL, 0x004abfd31e8efce5ULL,
-                           0x007bbfaaa1e20210ULL, 0x00e3be89c193e179ULL,
-                           0x001c420f4c31d585ULL, 0x00f414a315bef5aeULL)},
-            {FIELD_LITERAL(0x007c296a24990df8ULL, 0x00d5d07525a75588ULL,
-                           0x00dd8e113e94b7e7ULL, 0x007bbc58febe0cc8ULL,
-                           0x0029f51af9bfcad3ULL, 0x007e9311ec7ab6f3ULL,
-                           0x009a884de1676343ULL, 0x0050d5f2dce84be9ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x005fa020cca2450aULL, 0x00491c29db6416d8ULL,
-                           0x0037cefe3f9f9a85ULL, 0x003d405230647066ULL,
-                           0x0049e835f0fdbe89ULL, 0x00feb78ac1a0815cULL,
-                           0x00828e4b32dc9724ULL, 0x00db84f2dc8d6fd4ULL)},
-            {FIELD_LITERAL(0x0098cddc8b39549aULL, 0x006da37e3b05d22cULL,
-                           0x00ce633cfd4eb3cbULL, 0x00fda288ef526acdULL,
-                           0x0025338878c5d30aULL, 0x00f34438c4e5a1b4ULL,
-                           0x00584efea7c310f1ULL, 0x0041a551f1b660adULL)},
-            {FIELD_LITERAL(0x00d7f7a8fbd6437aULL, 0x0062872413bf3753ULL,
-                           0x00ad4bbcb43c584bULL, 0x007fe49be601d7e3ULL,
-                           0x0077c659789babf4ULL, 0x00eb45fcb06a741bULL,
-                           0x005ce244913f9708ULL, 0x0088426401736326ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x007bf562ca768d7cULL, 0x006c1f3a174e387cULL,
-                           0x00f024b447fee939ULL, 0x007e7af75f01143fULL,
-                           0x003adb70b4eed89dULL, 0x00e43544021ad79aULL,
-                           0x0091f7f7042011f6ULL, 0x0093c1a1ee3a0ddcULL)},
-            {FIELD_LITERAL(0x00a0b68ec1eb72d2ULL, 0x002c03235c0d45a0ULL,
-                           0x00553627323fe8c5ULL, 0x006186e94b17af94ULL,
-                           0x00a9906196e29f14ULL, 0x0025b3aee6567733ULL,
-                           0x007e0dd840080517ULL, 0x0018eb5801a4ba93ULL)},
-            {FIELD_LITERAL(0x00d7fe7017bf6a40ULL, 0x006e3f0624be0c42ULL,
-                           0x00ffbba205358245ULL, 0x00f9fc2cf8194239ULL,
-                           0x008d93b37bf15b4eULL, 0x006ddf2e38be8e95ULL,
-                           0x002b6e79bf5fcff9ULL, 0x00ab355da425e2deULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00938f97e20be973ULL, 0x0099141a36aaf306ULL,
-                           0x0057b0ca29e545a1ULL, 0x0085db571f9fbc13ULL,
-                           0x008b333c554b4693ULL, 0x0043ab6ef3e241cbULL,
-                           0x0054fb20aa1e5c70ULL, 0x00be0ff852760adfULL)},
-            {FIELD_LITERAL(0x003973d8938971d6ULL, 0x002aca26fa80c1f5ULL,
-                           0x00108af1faa6b513ULL, 0x00daae275d7924e6ULL,
-                           0x0053634ced721308ULL, 0x00d2355fe0bbd443ULL,
-                           0x00357612b2d22095ULL, 0x00f9bb9dd4136cf3ULL)},
-            {FIELD_LITERAL(0x002bff12cf5e03a5ULL, 0x001bdb1fa8a19cf8ULL,
-                           0x00c91c6793f84d39ULL, 0x00f869f1b2eba9afULL,
-                           0x0059bc547dc3236bULL, 0x00d91611d6d38689ULL,
-                           0x00e062daaa2c0214ULL, 0x00ed3c047cc2bc82ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x000050d70c32b31aULL, 0x001939d576d437b3ULL,
-                           0x00d709e598bf9fe6ULL, 0x00a885b34bd2ee9eULL,
-                           0x00dd4b5c08ab1a50ULL, 0x0091bebd50b55639ULL,
-                           0x00cf79ff64acdbc6ULL, 0x006067a39d826336ULL)},
-            {FIELD_LITERAL(0x0062dd0fb31be374ULL, 0x00fcc96b84c8e727ULL,
-                           0x003f64f1375e6ae3ULL, 0x0057d9b6dd1af004ULL,
-                           0x00d6a167b1103c7bULL, 0x00dd28f3180fb537ULL,
-                           0x004ff27ad7167128ULL, 0x008934c33461f2acULL)},
-            {FIELD_LITERAL(0x0065b472b7900043ULL, 0x00ba7efd2ff1064bULL,
-                           0x000b67d6c4c3020fULL, 0x0012d28469f4e46dULL,
-                           0x0031c32939703ec7ULL, 0x00b49f0bce133066ULL,
-                           0x00f7e10416181d47ULL, 0x005c90f51867eeccULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0051207abd179101ULL, 0x00fc2a5c20d9c5daULL,
-                           0x00fb9d5f2701b6dfULL, 0x002dd040fdea82b8ULL,
-                           0x00f163b0738442ffULL, 0x00d9736bd68855b8ULL,
-                           0x00e0d8e93005e61cULL, 0x00df5a40b3988570ULL)},
-            {FIELD_LITERAL(0x0006918f5dfce6dcULL, 0x00d4bf1c793c57fbULL,
-                           0x0069a3f649435364ULL, 0x00e89a50e5b0cd6eULL,
-                           0x00b9f6a237e973afULL, 0x006d4ed8b104e41dULL,
-                           0x00498946a3924cd2ULL, 0x00c136ec5ac9d4f7ULL)},
-            {FIELD_LITERAL(0x0011a9c290ac5336ULL, 0x002b9a2d4a6a6533ULL,
-                           0x009a8a68c445d937ULL, 0x00361b27b07e5e5cULL,
-                           0x003c043b1755b974ULL, 0x00b7eb66cf1155eeULL,
-                           0x0077af5909eefff2ULL, 0x0098f609877cc806ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00ab13af436bf8f4ULL, 0x000bcf0a0dac8574ULL,
-                           0x00d50c864f705045ULL, 0x00c40e611debc842ULL,
-                           0x0085010489bd5caaULL, 0x007c5050acec026fULL,
-                           0x00f67d943c8da6d1ULL, 0x00de1da0278074c6ULL)},
-            {FIELD_LITERAL(0x00b373076597455fULL, 0x00e83f1af53ac0f5ULL,
-                           0x0041f63c01dc6840ULL, 0x0097dea19b0c6f4bULL,
-                           0x007f9d63b4c1572cULL, 0x00e692d492d0f5f0ULL,
-                           0x00cbcb392e83b4adULL, 0x0069c0f39ed9b1a8ULL)},
-            {FIELD_LITERAL(0x00861030012707c9ULL, 0x009fbbdc7fd4aafbULL,
-                           0x008f591d6b554822ULL, 0x00df08a41ea18adeULL,
-                           0x009d7d83e642abeaULL, 0x0098c71bda3b78ffULL,
-                           0x0022c89e7021f005ULL, 0x0044d29a3fe1e3c4ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00e748cd7b5c52f2ULL, 0x00ea9df883f89cc3ULL,
-                           0x0018970df156b6c7ULL, 0x00c5a46c2a33a847ULL,
-                           0x00cbde395e32aa09ULL, 0x0072474ebb423140ULL,
-                           0x00fb00053086a23dULL, 0x001dafcfe22d4e1fULL)},
-            {FIELD_LITERAL(0x00c903ee6d825540ULL, 0x00add6c4cf98473eULL,
-                           0x007636efed4227f1ULL, 0x00905124ae55e772ULL,
-                           0x00e6b38fab12ed53ULL, 0x0045e132b863fe55ULL,
-                           0x003974662edb366aULL, 0x00b1787052be8208ULL)},
-            {FIELD_LITERAL(0x00a614b00d775c7cULL, 0x00d7c78941cc7754ULL,
-                           0x00422dd68b5dabc4ULL, 0x00a6110f0167d28bULL,
-                           0x00685a309c252886ULL, 0x00b439ffd5143660ULL,
-                           0x003656e29ee7396fULL, 0x00c7c9b9ed5ad854ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0040f7e7c5b37bf2ULL, 0x0064e4dc81181bbaULL,
-                           0x00a8767ae2a366b6ULL, 0x001496b4f90546f2ULL,
-                           0x002a28493f860441ULL, 0x0021f59513049a3aULL,
-                           0x00852d369a8b7ee3ULL, 0x00dd2e7d8b7d30a9ULL)},
-            {FIELD_LITERAL(0x00006e34a35d9fbcULL, 0x00eee4e48b2f019aULL,
-                           0x006b344743003a5fULL, 0x00541d514f04a7e3ULL,
-                           0x00e81f9ee7647455ULL, 0x005e2b916c438f81ULL,
-                           0x00116f8137b7eff0ULL, 0x009bd3decc7039d1ULL)},
-            {FIELD_LITERAL(0x0005d226f434110dULL, 0x00af8288b8ef21d5ULL,
-                           0x004a7a52ef181c8cULL, 0x00be0b781b4b06deULL,
-                           0x00e6e3627ded07e1ULL, 0x00e43aa342272b8bULL,
-                           0x00e86ab424577d84ULL, 0x00fb292c566e35bbULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00334f5303ea1222ULL, 0x00dfb3dbeb0a5d3eULL,
-                           0x002940d9592335c1ULL, 0x00706a7a63e8938aULL,
-                           0x005a533558bc4cafULL, 0x00558e33192022a9ULL,
-                           0x00970d9faf74c133ULL, 0x002979fcb63493caULL)},
-            {FIELD_LITERAL(0x00e38abece3c82abULL, 0x005a51f18a2c7a86ULL,
-                           0x009dafa2e86d592eULL, 0x00495a62eb688678ULL,
-                           0x00b79df74c0eb212ULL, 0x0023e8cc78b75982ULL,
-                           0x005998cb91075e13ULL, 0x00735aa9ba61bc76ULL)},
-            {FIELD_LITERAL(0x00d9f7a82ddbe628ULL, 0x00a1fc782889ae0fULL,
-                           0x0071ffda12d14b66ULL, 0x0037cf4eca7fb3d5ULL,
-                           0x00c80bc242c58808ULL, 0x0075bf8c2d08c863ULL,
-                           0x008d41f31afc52a7ULL, 0x00197962ecf38741ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x006e9f475cccf2eeULL, 0x00454b9cd506430cULL,
-                           0x00224a4fb79ee479ULL, 0x0062e3347ef0b5e2ULL,
-                           0x0034fd2a3512232aULL, 0x00b8b3cb0f457046ULL,
-                           0x00eb20165daa38ecULL, 0x00128eebc2d9c0f7ULL)},
-            {FIELD_LITERAL(0x00bfc5fa1e4ea21fULL, 0x00c21d7b6bb892e6ULL,
-                           0x00cf043f3acf0291ULL, 0x00c13f2f849b3c90ULL,
-                           0x00d1a97ebef10891ULL, 0x0061e130a445e7feULL,
-                           0x0019513fdedbf22bULL, 0x001d60c813bff841ULL)},
-            {FIELD_LITERAL(0x0019561c7fcf0213ULL, 0x00e3dca6843ebd77ULL,
-                           0x0068ea95b9ca920eULL, 0x009bdfb70f253595ULL,
-                           0x00c68f59186aa02aULL, 0x005aee1cca1c3039ULL,
-                           0x00ab79a8a937a1ceULL, 0x00b9a0e549959e6fULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00c79e0b6d97dfbdULL, 0x00917c71fd2bc6e8ULL,
-                           0x00db7529ccfb63d8ULL, 0x00be5be957f17866ULL,
-                           0x00a9e11fdc2cdac1ULL, 0x007b91a8e1f44443ULL,
-                           0x00a3065e4057d80fULL, 0x004825f5b8d5f6d4ULL)},
-            {FIELD_LITERAL(0x003e4964fa8a8fc8ULL, 0x00f6a1cdbcf41689ULL,
-                           0x00943cb18fe7fda7ULL, 0x00606dafbf34440aULL,
-                           0x005d37a86399c789ULL, 0x00e79a2a69417403ULL,
-                           0x00fe34f7e68b8866ULL, 0x0011f448ed2df10eULL)},
-            {FIELD_LITERAL(0x00f1f57efcc1fcc4ULL, 0x00513679117de154ULL,
-                           0x002e5b5b7c86d8c3ULL, 0x009f6486561f9cfbULL,
-                           0x00169e74b0170cf7ULL, 0x00900205af4af696ULL,
-                           0x006acfddb77853f3ULL, 0x00df184c90f31068ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00b37396c3320791ULL, 0x00fc7b67175c5783ULL,
-                           0x00c36d2cd73ecc38ULL, 0x0080ebcc0b328fc5ULL,
-                           0x0043a5b22b35d35dULL, 0x00466c9f1713c9daULL,
-                           0x0026ad346dcaa8daULL, 0x007c684e701183a6ULL)},
-            {FIELD_LITERAL(0x00fd579ffb691713ULL, 0x00b76af4f81c412dULL,
-                           0x00f239de96110f82ULL, 0x00e965fb437f0306ULL,
-                           0x00ca7e9436900921ULL, 0x00e487f1325fa24aULL,
-                           0x00633907de476380ULL, 0x00721c62ac5b8ea0ULL)},
-            {FIELD_LITERAL(0x00c0d54e542eb4f9ULL, 0x004ed657171c8dcfULL,
-                           0x00b743a4f7c2a39bULL, 0x00fd9f93ed6cc567ULL,
-                           0x00307fae3113e58bULL, 0x0058aa577c93c319ULL,
-                           0x00d254556f35b346ULL, 0x00491aada2203f0dULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00dff3103786ff34ULL, 0x000144553b1f20c3ULL,
-                           0x0095613baeb930e4ULL, 0x00098058275ea5d4ULL,
-                           0x007cd1402b046756ULL, 0x0074d74e4d58aee3ULL,
-                           0x005f93fc343ff69bULL, 0x00873df17296b3b0ULL)},
-            {FIELD_LITERAL(0x00c4a1fb48635413ULL, 0x00b5dd54423ad59fULL,
-                           0x009ff5d53fd24a88ULL, 0x003c98d267fc06a7ULL,
-                           0x002db7cb20013641ULL, 0x00bd1d6716e191f2ULL,
-                           0x006dbc8b29094241ULL, 0x0044bbf233dafa2cULL)},
-            {FIELD_LITERAL(0x0055838d41f531e6ULL, 0x00bf6a2dd03c81b2ULL,
-                           0x005827a061c4839eULL, 0x0000de2cbb36aac3ULL,
-                           0x002efa29d9717478ULL, 0x00f9e928cc8a77baULL,
-                           0x00c134b458def9efULL, 0x00958a182223fc48ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x000a9ee23c06881fULL, 0x002c727d3d871945ULL,
-                           0x00f47d971512d24aULL, 0x00671e816f9ef31aULL,
-                           0x00883af2cfaad673ULL, 0x00601f98583d6c9aULL,
-                           0x00b435f5adc79655ULL, 0x00ad87b71c04bff2ULL)},
-            {FIELD_LITERAL(0x007860d99db787cfULL, 0x00fda8983018f4a8ULL,
-                           0x008c8866bac4743cULL, 0x00ef471f84c82a3fULL,
-                           0x00abea5976d3b8e7ULL, 0x00714882896cd015ULL,
-                           0x00b49fae584ddac5ULL, 0x008e33a1a0b69c81ULL)},
-            {FIELD_LITERAL(0x007b6ee2c9e8a9ecULL, 0x002455dbbd89d622ULL,
-                           0x006490cf4eaab038ULL, 0x00d925f6c3081561ULL,
-                           0x00153b3047de7382ULL, 0x003b421f8bdceb6fULL,
-                           0x00761a4a5049da78ULL, 0x00980348c5202433ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x007f8a43da97dd5cULL, 0x00058539c800fc7bULL,
-                           0x0040f3cf5a28414aULL, 0x00d68dd0d95283d6ULL,
-                           0x004adce9da90146eULL, 0x00befa41c7d4f908ULL,
-                           0x007603bc2e3c3060ULL, 0x00bdf360ab3545dbULL)},
-            {FIELD_LITERAL(0x00eebfd4e2312cc3ULL, 0x00474b2564e4fc8cULL,
-                           0x003303ef14b1da9bULL, 0x003c93e0e66beb1dULL,
-                           0x0013619b0566925aULL, 0x008817c24d901bf3ULL,
-                           0x00b62bd8898d218bULL, 0x0075a7716f1e88a2ULL)},
-            {FIELD_LITERAL(0x0009218da1e6890fULL, 0x0026907f5fd02575ULL,
-                           0x004dabed5f19d605ULL, 0x003abf181870249dULL,
-                           0x00b52fd048cc92c4ULL, 0x00b6dd51e415a5c5ULL,
-                           0x00d9eb82bd2b4014ULL, 0x002c865a43b46b43ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0070047189452f4cULL, 0x00f7ad12e1ce78d5ULL,
-                           0x00af1ba51ec44a8bULL, 0x005f39f63e667cd6ULL,
-                           0x00058eac4648425eULL, 0x00d7fdab42bea03bULL,
-                           0x0028576a5688de15ULL, 0x00af973209e77c10ULL)},
-            {FIELD_LITERAL(0x00c338b915d8fef0ULL, 0x00a893292045c39aULL,
-                           0x0028ab4f2eba6887ULL, 0x0060743cb519fd61ULL,
-                           0x0006213964093ac0ULL, 0x007c0b7a43f6266dULL,
-                           0x008e3557c4fa5bdaULL, 0x002da976de7b8d9dULL)},
-            {FIELD_LITERAL(0x0048729f8a8b6dcdULL, 0x00fe23b85cc4d323ULL,
-                           0x00e7384d16e4db0eULL, 0x004a423970678942ULL,
-                           0x00ec0b763345d4baULL, 0x00c477b9f99ed721ULL,
-                           0x00c29dad3777b230ULL, 0x001c517b466f7df6ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x006366c380f7b574ULL, 0x001c7d1f09ff0438ULL,
-                           0x003e20a7301f5b22ULL, 0x00d3efb1916d28f6ULL,
-                           0x0049f4f81060ce83ULL, 0x00c69d91ea43ced1ULL,
-                           0x002b6f3e5cd269edULL, 0x005b0fb22ce9ec65ULL)},
-            {FIELD_LITERAL(0x00aa2261022d883fULL, 0x00ebcca4548010acULL,
-                           0x002528512e28a437ULL, 0x0070ca7676b66082ULL,
-                           0x0084bda170f7c6d3ULL, 0x00581b4747c9b8bbULL,
-                           0x005c96a01061c7e2ULL, 0x00fb7c4a362b5273ULL)},
-            {FIELD_LITERAL(0x00c30020eb512d02ULL, 0x0060f288283a4d26ULL,
-                           0x00b7ed13becde260ULL, 0x0075ebb74220f6e9ULL,
-                           0x00701079fcfe8a1fULL, 0x001c28fcdff58938ULL,
-                           0x002e4544b8f4df6bULL, 0x0060c5bc4f1a7d73ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x00ae307cf069f701ULL, 0x005859f222dd618bULL,
-                           0x00212d6c46ec0b0dULL, 0x00a0fe4642afb62dULL,
-                           0x00420d8e4a0a8903ULL, 0x00a80ff639bdf7b0ULL,
-                           0x0019bee1490b5d8eULL, 0x007439e4b9c27a86ULL)},
-            {FIELD_LITERAL(0x00a94700032a093fULL, 0x0076e96c225216e7ULL,
-                           0x00a63a4316e45f91ULL, 0x007d8bbb4645d3b2ULL,
-                           0x00340a6ff22793ebULL, 0x006f935d4572aeb7ULL,
-                           0x00b1fb69f00afa28ULL, 0x009e8f3423161ed3ULL)},
-            {FIELD_LITERAL(0x009ef49c6b5ced17ULL, 0x00a555e6269e9f0aULL,
-                           0x007e6f1d79ec73b5ULL, 0x009ac78695a32ac4ULL,
-                           0x0001d77fbbcd5682ULL, 0x008cea1fee0aaeedULL,
-                           0x00f42bea82a53462ULL, 0x002e46ab96cafcc9ULL)},
-        }}, {{
-            {FIELD_LITERAL(0x0051cfcc5885377aULL, 0x00dce566cb1803caULL,
-                           0x00430c7643f2c7d4ULL, 0x00dce1a1337bdcc0ULL,
-                           0x0010d5bd7283c128ULL, 0x003b1b547f9b46feULL,
-                           0x000f245e37e770abULL, 0x007b72511f022b37ULL)},
-            {FIELD_LITERAL(0x0060db815bc4786cULL, 0x006fab25beedc434ULL,
-                           0x00c610d06084797cULL, 0x000c48f08537bec0ULL,
-                           0x0031aba51c5b93daULL, 0x007968fa6e01f347ULL,
-                           0x0030070da52840c6ULL, 0x00c043c225a4837fULL)},
-            {FIELD_LITERAL(0x001bcfd00649ee93ULL, 0x006dceb47e2a0fd5ULL,
-                           0x00f2cebda0cf8fd0ULL, 0x00b6b9d9d1fbdec3ULL,
-                           0x00815262e6490611ULL, 0x00ef7f5ce3176760ULL,
-                           0x00e49cd0c998d58bULL, 0x005fc6cc269ba57cULL)},
-        }}, {{
-            {FIELD_LITERAL(0x008940211aa0d633ULL, 0x00addae28136571dULL,
-                           0x00d68fdbba20d673ULL, 0x003bc6129bc9e21aULL,
-                           0x000346cf184ebe9aULL, 0x0068774d741ebc7fULL,
-                           0x0019d5e9e6966557ULL, 0x0003cbd7f981b651ULL)},
-            {FIELD_LITERAL(0x004a2902926f8d3fULL, 0x00ad79b42637ab75ULL,
-                           0x0088f60b90f2d4e8ULL, 0x0030f54ef0e398c4ULL,
-                           0x00021dc9bf99681eULL, 0x007ebf66fde74ee3ULL,
-                           0x004ade654386e9a4ULL, 0x00e7485066be4c27ULL)},
-            {FIELD_LITERAL(0x00445f1263983be0ULL, 0x004cf371dda45e6aULL,
-                           0x00744a89d5a310e7ULL, 0x001f20ce4f904833ULL,
-                           0x00e746edebe66e29ULL, 0x000912ab1f6c153dULL,
-                           0x00f61d77d9b2444cULL, 0x0001499cd6647610ULL)},
+            {FIELD_LITERAL(0x00d0f905d4b553cfULL, 0x00d26b95e831da36ULL,
+                           0x00f59477f1d2d66dULL, 0x0030f62ee435b478ULL,
+                           0x0030e676def62376ULL, 0x00ca4337ce9d7e5aULL,
+                           0x007c3e256b60f1d2ULL, 0x006a0150a8fd92b8ULL)},
+            {FIELD_LITERAL(0x001f634ea14fc90fULL, 0x003a4475ab27bb2cULL,
+                           0x00d516a070be9770ULL, 0x007f2c7ffd1d21a6ULL,
+                           0x00bc2b27ebb8b297ULL, 0x002540870061d384ULL,
+                           0x0073e3c85ff5a248ULL, 0x0059ef524b8845f2ULL)},
+            {FIELD_LITERAL(0x00b9aaf19898c35bULL, 0x00054af1ae3ee189ULL,
+                           0x006610928b9b6c9fULL, 0x00bc39cb490ed244ULL,
+                           0x000494d0ff5b2f91ULL, 0x00ca5dd6e040bb9bULL,
+                           0x00059ff485d8cf16ULL, 0x00ce367b9ce37bfcULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f9b3d5e0cb09c9ULL, 0x00b7a4165c317743ULL,
+                           0x0006a7f803c4494eULL, 0x008d061ef0b58a96ULL,
+                           0x0067d796b0a60294ULL, 0x001e28c6d7a2f1daULL,
+                           0x0019032cc99a9878ULL, 0x0052e06be54ea22eULL)},
+            {FIELD_LITERAL(0x0003fd0c59f7d452ULL, 0x00719692a8e05448ULL,
+                           0x0051c3575ea6ead7ULL, 0x00f7e556a0ec71d2ULL,
+                           0x0018f607b563ffeaULL, 0x004997dfa3c42af9ULL,
+                           0x00f6f93e84493d5eULL, 0x007d3e06709f88baULL)},
+            {FIELD_LITERAL(0x00a16dda5d11ed6cULL, 0x00d9c61ade91fdc9ULL,
+                           0x00d4eac89e945871ULL, 0x0072db32d13b413fULL,
+                           0x00a3ce1d34c8b561ULL, 0x008a34983a222b55ULL,
+                           0x002be11fc2d97024ULL, 0x00ff0f41d9cc4647ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00dd722b3ce69cf7ULL, 0x0021a00b3f498723ULL,
+                           0x007218d302a42159ULL, 0x0049aaf32748797aULL,
+                           0x0026060263f0acb6ULL, 0x0081ad13abadcec7ULL,
+                           0x00217729720750d7ULL, 0x007e68c295999718ULL)},
+            {FIELD_LITERAL(0x0080a4eb3acc8a59ULL, 0x00db9eb2f2e81a1fULL,
+                           0x0036f7398bc4a7beULL, 0x0000f57a12152fadULL,
+                           0x007f79e3b79d2b76ULL, 0x004c1dc8d7860c70ULL,
+                           0x00d985133ed688deULL, 0x0017b0a76117d77eULL)},
+            {FIELD_LITERAL(0x0003d8c75e8b2cbfULL, 0x00b210b642034cf2ULL,
+                           0x006aaef7e3e37cafULL, 0x00862322711d93acULL,
+                           0x003e98dfe08ce9f7ULL, 0x00a0dc3cc80433f7ULL,
+                           0x00726f4fa0972afbULL, 0x0077d08446db3ce2ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00ead10e8ad34184ULL, 0x003a78c746098c37ULL,
+                           0x00246da85257d6ecULL, 0x007c469efe828a6eULL,
+                           0x0018c363c27622e8ULL, 0x00924fda5a3b20a8ULL,
+                           0x00255b58c5d5cb76ULL, 0x005797909ea85610ULL)},
+            {FIELD_LITERAL(0x009598396e446858ULL, 0x0099a652c2999af6ULL,
+                           0x00ba01bbb50fca2cULL, 0x0002b9c0b9d67984ULL,
+                           0x000fbf382f43176aULL, 0x0001180cf467ca4dULL,
+                           0x002ca1e69ca2ebf8ULL, 0x00963d1d234e14d0ULL)},
+            {FIELD_LITERAL(0x009599fe03bc4633ULL, 0x004f25f448e56d6fULL,
+                           0x00e856cfc42d6ae7ULL, 0x008bfc9aa8df6208ULL,
+                           0x00a79d7c44a9204bULL, 0x00e3a518572dd04bULL,
+                           0x00b282d10a575ad3ULL, 0x00ffd24c9a4b9d8dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00bbe28fdf991112ULL, 0x004074c2339562b9ULL,
+                           0x009697878ad169bbULL, 0x002e6346f30c6374ULL,
+                           0x0058857bad752dbcULL, 0x004e4f37c1d5e528ULL,
+                           0x007a0d40699836f6ULL, 0x004cfd8606bab0bdULL)},
+            {FIELD_LITERAL(0x00ad6fed0e912b73ULL, 0x00b74f1385db94b8ULL,
+                           0x00663b18fe1a8127ULL, 0x00de1678274048ddULL,
+                           0x009cf388dfc0c649ULL, 0x004f62fadc057becULL,
+                           0x00c23a36702d9dc3ULL, 0x0095f7dc2578b7c9ULL)},
+            {FIELD_LITERAL(0x00251d4bfa48e883ULL, 0x00f53aa81f0110d6ULL,
+                           0x0083f1aedb688f23ULL, 0x0073704d0b67e720ULL,
+                           0x008ab32639892177ULL, 0x00ae42b7a9832221ULL,
+                           0x00361ceb1a107656ULL, 0x008b485a2565e110ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00bdc600188ffb1dULL, 0x001abbaaf6698645ULL,
+                           0x005ecb99ce4ed50dULL, 0x00224c5e77cdf736ULL,
+                           0x0048de8b6c15644eULL, 0x00fbf0341cf13f49ULL,
+                           0x0001d050825d5d4eULL, 0x002fff0eb2891888ULL)},
+            {FIELD_LITERAL(0x00493e2519702725ULL, 0x00c2ab1605f79700ULL,
+                           0x0018557b23c88789ULL, 0x006a422b0f239c2aULL,
+                           0x00cd24b57161d226ULL, 0x004643630ba59053ULL,
+                           0x00e53f99345f4c83ULL, 0x00fa048c6cce5828ULL)},
+            {FIELD_LITERAL(0x0080446ee6613510ULL, 0x007151918d37b3f7ULL,
+                           0x00b330ee202408e9ULL, 0x00bebcec5df19d11ULL,
+                           0x00b65169501a8315ULL, 0x008496ca12a1fbacULL,
+                           0x00861df7f58f6498ULL, 0x00bd6f4d404625a3ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00beee6fa09ef53bULL, 0x0028a41b233c7942ULL,
+                           0x003e0ba502aac134ULL, 0x006cb55fdf9f6294ULL,
+                           0x008d3839f432be42ULL, 0x00627c0f206ae96fULL,
+                           0x00bc74cf97e53c89ULL, 0x000d186472c3c7ccULL)},
+            {FIELD_LITERAL(0x00413e8e681b5567ULL, 0x00fbabecc07cc71dULL,
+                           0x00e051faf10a4cafULL, 0x005f674e952c6311ULL,
+                           0x00a2defe3f4fcd43ULL, 0x004525c2904aaf75ULL,
+                           0x0073015420bf6714ULL, 0x00696bf74d709a25ULL)},
+            {FIELD_LITERAL(0x00adf8ffc3e4d746ULL, 0x0080f083e92b1500ULL,
+                           0x0007e04c4dc8c740ULL, 0x007c331376f70204ULL,
+                           0x009242d57a9ffa17ULL, 0x000eb7dcb14609d8ULL,
+                           0x0085426f88b4feecULL, 0x009c9a6c59ab62f5ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006178ce98aa264eULL, 0x00d69a1cea624096ULL,
+                           0x008f3a843f35f060ULL, 0x00fb347093e344a5ULL,
+                           0x00c40ae779821218ULL, 0x001ebf4f60e5d90dULL,
+                           0x0076535b1815d8cdULL, 0x003d5583a88f15f0ULL)},
+            {FIELD_LITERAL(0x00b97fbf6030bf05ULL, 0x00c132ac67bb524eULL,
+                           0x0029e55205e36393ULL, 0x00431e3fb40d9d64ULL,
+                           0x009552685dbe4648ULL, 0x00a8f91c322d5165ULL,
+                           0x0081d77aef8bc286ULL, 0x00291dda4742cf16ULL)},
+            {FIELD_LITERAL(0x002c3b2ea925d155ULL, 0x00fa1fe3ef8d8b5fULL,
+                           0x000b8e3103d0ed9cULL, 0x00fc9c26acf02ce4ULL,
+                           0x004d4daf2a6c087bULL, 0x00dab57ea6d601a0ULL,
+                           0x00e4d564703d061bULL, 0x005b6935c6680e75ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00933a50e99f505bULL, 0x006736dfd093b324ULL,
+                           0x0065271879bfecd7ULL, 0x002921e9e2c87019ULL,
+                           0x000dfdfafc4bde4aULL, 0x0026887fa5d7d228ULL,
+                           0x00ee9c45b09e8963ULL, 0x004dc19739432410ULL)},
+            {FIELD_LITERAL(0x00ed86357d10d2e5ULL, 0x009cf26dc56fa199ULL,
+                           0x00ee8b0080b6c673ULL, 0x00e8bfac037c03c2ULL,
+                           0x00c37a5b53915431ULL, 0x00850f9a341c158bULL,
+                           0x00736e5ff748cf95ULL, 0x00575f4cbaa36956ULL)},
+            {FIELD_LITERAL(0x007a76ab027bf838ULL, 0x00e012fb31b062b4ULL,
+                           0x00ca836989705ea6ULL, 0x007aec0fa673386cULL,
+                           0x0020858c73782a7cULL, 0x0068ae7c10e9a16eULL,
+                           0x00f8e61c4713e97fULL, 0x009e114ae2ae5713ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003d57c3ad2c38e2ULL, 0x00f80e74dc1fa915ULL,
+                           0x000bff0b5e7ddeb7ULL, 0x00e47ec7628094c6ULL,
+                           0x009a9e164cfff3f2ULL, 0x002c0b1aedae41dcULL,
+                           0x00b7677afd6cd327ULL, 0x0075035cc5030c83ULL)},
+            {FIELD_LITERAL(0x009cfc0d5b057401ULL, 0x00d18d695307858aULL,
+                           0x00871d01c441a564ULL, 0x00017121a86fb1eeULL,
+                           0x00d9be6821ff9378ULL, 0x0078d57b90ca3826ULL,
+                           0x001ac7d397200bdbULL, 0x0008f70c1cf6db57ULL)},
+            {FIELD_LITERAL(0x00f01b1b6f2ba104ULL, 0x00698c02776b5ca8ULL,
+                           0x00a17c7f4f7e1879ULL, 0x007cf570b86fc3f6ULL,
+                           0x00f6cb3b90d81e71ULL, 0x00dac8aa5bf9f436ULL,
+                           0x0071a65faca6a41aULL, 0x0085e90cf0b681dfULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0003ef50899a5268ULL, 0x00b45d9aee93452bULL,
+                           0x004cecc3fd722f49ULL, 0x00cf524c2deea0a8ULL,
+                           0x00efdc42fc12ddf4ULL, 0x00a7b5cfdd9775e2ULL,
+                           0x005c4c93fcc50af7ULL, 0x003d088782a173daULL)},
+            {FIELD_LITERAL(0x00512761fbed008aULL, 0x00436b36a1e5dd9aULL,
+                           0x00b9a2665f351624ULL, 0x00945aca686df887ULL,
+                           0x00b1e97200f1fff5ULL, 0x00860ee2c6e6ba04ULL,
+                           0x00de1dc9eb518cfcULL, 0x00db2e14d7a7c5c3ULL)},
+            {FIELD_LITERAL(0x0041800e4b05c51dULL, 0x00cfd85e6df72c4aULL,
+                           0x0098922523b34c8fULL, 0x0082ef0fa004cc3aULL,
+                           0x008a9de4c9cec757ULL, 0x00ebcd24017b2c9cULL,
+                           0x0021288fd399b719ULL, 0x00456ba19365050cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x009b3053f786784aULL, 0x004e5af5e49fe896ULL,
+                           0x009c58a99dd59180ULL, 0x00b752322b01aa1cULL,
+                           0x008659f38a1f4106ULL, 0x00821654c7b8695aULL,
+                           0x00df666e81bc68d2ULL, 0x003514f8d77ae81fULL)},
+            {FIELD_LITERAL(0x00d7375b0c6cd8f2ULL, 0x007a4f9f238c97d2ULL,
+                           0x00b926642e9d3b75ULL, 0x004e357246070962ULL,
+                           0x00f045151f3c2c42ULL, 0x00ecffe68520808aULL,
+                           0x004d788f8a508c20ULL, 0x00eb34279a2e2777ULL)},
+            {FIELD_LITERAL(0x00ef1fe14738d78cULL, 0x00922677911591baULL,
+                           0x00ef4ecb50114a8aULL, 0x0099a4778529a496ULL,
+                           0x002a6ba7e24e3441ULL, 0x00fce9b2b8563dc4ULL,
+                           0x0062a11476c0958cULL, 0x001392fd8a176917ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005a51ca84e71ecbULL, 0x00c12a1e6413c12fULL,
+                           0x0004b1cfe9b48f82ULL, 0x00ca38e6552aaf82ULL,
+                           0x00840185c97716b5ULL, 0x00a40642b7e42084ULL,
+                           0x0078f4ad04389d8bULL, 0x0000539d5bba155fULL)},
+            {FIELD_LITERAL(0x0073f3c96efd7b06ULL, 0x0000c1d769adc263ULL,
+                           0x00e00ae57592ab07ULL, 0x00679482a47886a3ULL,
+                           0x00e3784dab74ff09ULL, 0x004499004218c1a5ULL,
+                           0x003c7d2994d1d357ULL, 0x00476fd411a27b06ULL)},
+            {FIELD_LITERAL(0x00f440d1b1df9585ULL, 0x0034408d411e21fdULL,
+                           0x00ca4fc3a5523b79ULL, 0x00c770ba19f6a417ULL,
+                           0x008d585f5dcef090ULL, 0x00090872b21fca09ULL,
+                           0x005bbe5bb4b0a904ULL, 0x008b76861c917c56ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x004d9f9eb48bdcb5ULL, 0x0076853d5d039724ULL,
+                           0x00fa5df3a1a2ac00ULL, 0x00f32f176912687fULL,
+                           0x00da8fd540289183ULL, 0x0067967fc15f47f3ULL,
+                           0x00dd84b2c249791aULL, 0x00edd1b9772e8d75ULL)},
+            {FIELD_LITERAL(0x006c1a37b4ae9135ULL, 0x00cfa12f7daacf28ULL,
+                           0x005b86b02841e305ULL, 0x00e267c1f8a342daULL,
+                           0x00c7cb1a2ecc9e9cULL, 0x003ba4b2794ed8c7ULL,
+                           0x00f6a3baec2676afULL, 0x003368533869a031ULL)},
+            {FIELD_LITERAL(0x00be02605c044080ULL, 0x00f4b79052183cd5ULL,
+                           0x00154d978bd2c858ULL, 0x00f11a350cc0555aULL,
+                           0x004db1466ef9514bULL, 0x0054027ba8f4a18dULL,
+                           0x0051fd3e3d225c0eULL, 0x00bdc0297a1457fcULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b0e6af176c641aULL, 0x00ef1862e910380fULL,
+                           0x00a075349429ca42ULL, 0x00cf4198ec1303e2ULL,
+                           0x00ad29a8e1266491ULL, 0x002c2ce0a29e1b5bULL,
+                           0x00dffda18a1b03acULL, 0x0095b25636742809ULL)},
+            {FIELD_LITERAL(0x00c1e8d738fbcd3dULL, 0x00d3c1dc9789ef30ULL,
+                           0x0060d88305fda900ULL, 0x00d70c77e24e7821ULL,
+                           0x0076b8f854b900f8ULL, 0x007a5ac4e2c48c04ULL,
+                           0x007a5a9eccd3a9b2ULL, 0x006465df28616e0fULL)},
+            {FIELD_LITERAL(0x00eecd820f857a58ULL, 0x00b505320e58b8b2ULL,
+                           0x0039ec60690d2ec1ULL, 0x00938151a2a11cf6ULL,
+                           0x005028aa122d2dcaULL, 0x0066d96f26c9a1e0ULL,
+                           0x004a98779aa3dad6ULL, 0x00674028a86fca59ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00ffefeac2ca4ac3ULL, 0x00472ade607bb21bULL,
+                           0x0045061913dad44dULL, 0x000fbcf566cbf1e6ULL,
+                           0x00085d9a8810567eULL, 0x00e69f42ddc923e7ULL,
+                           0x003871f5ca4fe496ULL, 0x00ac4bad756eaf9aULL)},
+            {FIELD_LITERAL(0x002e773ad64ddf55ULL, 0x0079dec052ae0724ULL,
+                           0x0052ad4a94ba2c09ULL, 0x0086f52e221f4fadULL,
+                           0x00c2128623b17af8ULL, 0x00830a7ff8270c27ULL,
+                           0x001fd03aced5b039ULL, 0x003dedc5da844fadULL)},
+            {FIELD_LITERAL(0x00ee9c54636e7265ULL, 0x002824a724db7202ULL,
+                           0x001d3e80d9a56ddfULL, 0x0008af2934ec6e19ULL,
+                           0x00b5e0bd3a73b95bULL, 0x00526c62aac034e6ULL,
+                           0x0033ef99565078faULL, 0x0091ebf2a36ab1d9ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003d91dd75d16046ULL, 0x0074578e5fc0522cULL,
+                           0x00e4b3f556cd2a78ULL, 0x004b790e241ba8beULL,
+                           0x00a47fd538681867ULL, 0x001ea6eb8d273b24ULL,
+                           0x00b0fabde4d7ddb0ULL, 0x005f0f13662d424eULL)},
+            {FIELD_LITERAL(0x009868c62bbbcd78ULL, 0x005244a86dc8c3ddULL,
+                           0x0043bc535edc425aULL, 0x006970baaaaec1b6ULL,
+                           0x00d87f5abf4f2290ULL, 0x007fabbff507283cULL,
+                           0x00b62e1e7a94b49eULL, 0x00802ea62820b93fULL)},
+            {FIELD_LITERAL(0x00c6f68874590942ULL, 0x00f0e51dbd774523ULL,
+                           0x00e3a0d3faffa00dULL, 0x00ec4acbff1ac926ULL,
+                           0x00114f0666bfbf28ULL, 0x00b45498b54fbb1aULL,
+                           0x00575dc86dfeff3cULL, 0x0021a9f2fb3d922aULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d865f5b4e8a16bULL, 0x004a2128efe3012cULL,
+                           0x00b1e7d61f3a9e25ULL, 0x00fda4f3f1af1a69ULL,
+                           0x0032ae875a459348ULL, 0x0023e6c893ed39a7ULL,
+                           0x001738b57d6356c4ULL, 0x000ba3e1b62d9a55ULL)},
+            {FIELD_LITERAL(0x0068e28eaea17780ULL, 0x000594375caf0d2bULL,
+                           0x0014c9866bb7d642ULL, 0x00fc38b3e6b8528aULL,
+                           0x00624f23da0b39e1ULL, 0x0087c9ecbf313f8eULL,
+                           0x0076d1faa9038353ULL, 0x004953b90be9d48eULL)},
+            {FIELD_LITERAL(0x00439d05fb7ab2f3ULL, 0x00d0003f703eeba0ULL,
+                           0x00b0baf8318767b5ULL, 0x004d19317d504977ULL,
+                           0x00f034e54a3557cbULL, 0x00df2a452113a508ULL,
+                           0x0007d0699bfb1c44ULL, 0x0003a97eb4ee5921ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00cdf8c35eb5f1a5ULL, 0x0053fa7aa4902385ULL,
+                           0x00ce15a69c376cf4ULL, 0x005b38d3bf70df33ULL,
+                           0x00afa04eb953603bULL, 0x00c001011534074fULL,
+                           0x00d6295a53839d34ULL, 0x007b5871ee1a1d7dULL)},
+            {FIELD_LITERAL(0x00141618def196bbULL, 0x0001812852615559ULL,
+                           0x000b6128efa1564cULL, 0x0032387bd13cd7adULL,
+                           0x00525dba1b51149bULL, 0x00d6c199f756522cULL,
+                           0x00d90eaade1ce93cULL, 0x0042138d3215106eULL)},
+            {FIELD_LITERAL(0x0039561903658e67ULL, 0x00ab2e89c392d748ULL,
+                           0x002105972330b30bULL, 0x00b9cc7defb462c4ULL,
+                           0x00b5ec087db29343ULL, 0x003d8d0f30abf386ULL,
+                           0x0042d7eb99ee9dd1ULL, 0x00658cb534ecd6f4ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00df055d683093f7ULL, 0x001c9cdfab3823e0ULL,
+                           0x00432e6ad05161f3ULL, 0x0000dc5e086dfd23ULL,
+                           0x00054da29284a33cULL, 0x0040bcd4b392be03ULL,
+                           0x006d4be1ddf2fde4ULL, 0x004e873ef837a0e5ULL)},
+            {FIELD_LITERAL(0x006b770eeeb155eaULL, 0x007b4ce0c12385f6ULL,
+                           0x00dacd348d8f67fdULL, 0x00c7e8f144dbaefeULL,
+                           0x000dbc48ba3717b9ULL, 0x00a2d2de8bb838bdULL,
+                           0x00c81956bbdd4597ULL, 0x003420ef9b4f08d0ULL)},
+            {FIELD_LITERAL(0x00df729901fb60dcULL, 0x00f9b03b1070bb62ULL,
+                           0x0069aadcac22225cULL, 0x001a1aab389555afULL,
+                           0x009dda60cb03dd7fULL, 0x00e5c7c134f3ae0aULL,
+                           0x0009731315ee1acaULL, 0x0016634460d0d7f5ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x008014a2d7b8be2fULL, 0x0014c51b60768178ULL,
+                           0x00ab8409ca35fd44ULL, 0x004983bc3630a5b5ULL,
+                           0x00f61b5782067101ULL, 0x00fe4df37c96dfa1ULL,
+                           0x0026293b97da7d5dULL, 0x002fb3f247302da7ULL)},
+            {FIELD_LITERAL(0x0074de02be131be4ULL, 0x004dc2e1b615076fULL,
+                           0x00c136b9a39fbb66ULL, 0x00ffeca747cc11abULL,
+                           0x00ec1a6889c005a8ULL, 0x006084d940d6ea80ULL,
+                           0x0023561a6726b535ULL, 0x00775dc739615289ULL)},
+            {FIELD_LITERAL(0x00c123712ef5f574ULL, 0x002b8b7540cef983ULL,
+                           0x0080ab87f4b78e12ULL, 0x000bf400a82d44bfULL,
+                           0x00d5ebd70029ec7dULL, 0x00763c0a46d21e7bULL,
+                           0x007c3454c87c1369ULL, 0x001a7451b1a4fb78ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d96950c061bb1cULL, 0x00f3b20ff2ebc185ULL,
+                           0x00dc5708baa1ce84ULL, 0x008b9954157a3a3fULL,
+                           0x00ceb8aeddd167c0ULL, 0x004b0456b0d68633ULL,
+                           0x004b7210d46f67cfULL, 0x0028fcdc03cb380dULL)},
+            {FIELD_LITERAL(0x0049f7da398e363eULL, 0x0088fe0bdcdb3451ULL,
+                           0x0070fe21d9c98b38ULL, 0x00b7c1745d0a1165ULL,
+                           0x00caf6b5110d07f1ULL, 0x0063f76e6fa7e526ULL,
+                           0x00e99f462995fea1ULL, 0x008111202758edcdULL)},
+            {FIELD_LITERAL(0x005e3b2675204d42ULL, 0x00965b7938db3a19ULL,
+                           0x006cf0a6245ca6a4ULL, 0x0056efda8d3ff509ULL,
+                           0x0073313c5240d68eULL, 0x009abea6b2443f73ULL,
+                           0x008c2fd7108ca3dfULL, 0x00fac30cc0383c13ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00dcaa869ac57d71ULL, 0x0001019f73ca5bc8ULL,
+                           0x002f9218d8a6adcfULL, 0x005bc22a02e9b342ULL,
+                           0x008f86352a52fd27ULL, 0x005aef070a2f9193ULL,
+                           0x00ca30e20acd2297ULL, 0x002973b37f807a46ULL)},
+            {FIELD_LITERAL(0x00878145cd1032faULL, 0x002c3bfa4670cabfULL,
+                           0x00e803e6049bd060ULL, 0x00a3fea8520ea4e6ULL,
+                           0x00b44e3fc5f68debULL, 0x005d37cf5046325bULL,
+                           0x0029eab877550be8ULL, 0x0016a5bc0498d7ebULL)},
+            {FIELD_LITERAL(0x00ef70c7110a3834ULL, 0x006f30a31d709901ULL,
+                           0x005e8c05ebafa497ULL, 0x00cb5452ad344c3cULL,
+                           0x00a5001f158bf12cULL, 0x00167d194b568636ULL,
+                           0x008ecfb3b39770d1ULL, 0x00d581d3245cf8aeULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f2ac73248a858fULL, 0x0069c8abea90fe30ULL,
+                           0x008b9c5924b05b94ULL, 0x0071015ad6a939d6ULL,
+                           0x00d875cc5cb11474ULL, 0x00cda8df809acf2aULL,
+                           0x0096d337d48ad75bULL, 0x00348c5d1fbd496dULL)},
+            {FIELD_LITERAL(0x00293640c4dc9067ULL, 0x00615746776d6526ULL,
+                           0x00a535b7ebc729b1ULL, 0x0060a680fbc4be97ULL,
+                           0x000e0d47fcf211c6ULL, 0x00328b6ded3de1e3ULL,
+                           0x00b3dfedf632d2f6ULL, 0x00f86ac6ff0d17f8ULL)},
+            {FIELD_LITERAL(0x00aafbb871012787ULL, 0x0071b0fff4ad6e1bULL,
+                           0x0092c0213471c19bULL, 0x0066313cfd82f4cdULL,
+                           0x0099aa2f0b85df09ULL, 0x0013bef398e8ba55ULL,
+                           0x008633092e65ee58ULL, 0x00e5110928dddaedULL)},
+        }}, {{
+            {FIELD_LITERAL(0x007fcd256fbdbd2aULL, 0x00d418970ae49139ULL,
+                           0x00d8e2c53af93223ULL, 0x00ebe6b71dbfb7f9ULL,
+                           0x00d72e5d1ac5b372ULL, 0x0086530ade98ce8cULL,
+                           0x009e53ec4597de05ULL, 0x005bf0d846dec10fULL)},
+            {FIELD_LITERAL(0x00656153508321ceULL, 0x00d58e46a1038c18ULL,
+                           0x005d137b292d44c5ULL, 0x00d2fe5e18433d4dULL,
+                           0x00275321319b80f0ULL, 0x002e32738049e41bULL,
+                           0x007a052c4403918eULL, 0x00c48198c9f46e64ULL)},
+            {FIELD_LITERAL(0x004f5cb95d8504c2ULL, 0x00645381c2d1684eULL,
+                           0x00abac24c126f77eULL, 0x00715cc23ee78906ULL,
+                           0x0009b8cf17eb6167ULL, 0x002cc90a93f60edcULL,
+                           0x00f4c07e9e7d3073ULL, 0x00a604db7e0bb37dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0025c96b3e7fe329ULL, 0x00e8c80351b91232ULL,
+                           0x009d14aa5a359317ULL, 0x004fb8e26f676409ULL,
+                           0x0040a05e6465257dULL, 0x0019de3d1fd8a697ULL,
+                           0x00a7b00266ac0875ULL, 0x006a3a966ffc176fULL)},
+            {FIELD_LITERAL(0x00b83111b773f59aULL, 0x000944ad82713b44ULL,
+                           0x00ed1378751f5ec3ULL, 0x00a0193797fe20eaULL,
+                           0x0029f166c877d4f2ULL, 0x00d0115f928a3523ULL,
+                           0x005d9820c272a153ULL, 0x00f0dba8ae28c65eULL)},
+            {FIELD_LITERAL(0x00dae8945cfafdb6ULL, 0x003a01491377fc61ULL,
+                           0x0006023d5d82c116ULL, 0x006303729e027a62ULL,
+                           0x00e8f47cd4ee1535ULL, 0x00a7db00dd9f6ef6ULL,
+                           0x0024f4770266819bULL, 0x006900530e91d936ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00659ffe5e2dfccfULL, 0x006b884ea3476734ULL,
+                           0x00e313623c1ff233ULL, 0x007f469435bf0200ULL,
+                           0x008095c2ddb6bf92ULL, 0x00764ff8dadb052aULL,
+                           0x000cb65410813101ULL, 0x003fb594a7bf3dfcULL)},
+            {FIELD_LITERAL(0x002d44762f9c0222ULL, 0x00594563c6800f7dULL,
+                           0x002e909f53b733deULL, 0x009d699c1d1bfe5cULL,
+                           0x00ad0faabf8bca68ULL, 0x000771a64a4d65fcULL,
+                           0x00f180827ac4016dULL, 0x00e20d8f8b52852dULL)},
+            {FIELD_LITERAL(0x00d1c4dd5d869d74ULL, 0x00c943d3c3e79e5cULL,
+                           0x001044efaf52f62aULL, 0x00e5761bc67a86e6ULL,
+                           0x00f5fb9fd36954a7ULL, 0x00726714b1a0189aULL,
+                           0x004405f1260076e7ULL, 0x00a60a4b137ad89bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x002691dc3cb60a03ULL, 0x00ae787689eae1d0ULL,
+                           0x000bdd6f8ce6db6aULL, 0x00e9ee0af5361a69ULL,
+                           0x00cb9eb40a3655a1ULL, 0x00bed6e02ab5985fULL,
+                           0x002b567d9cee93c3ULL, 0x009ca67cf3b9b433ULL)},
+            {FIELD_LITERAL(0x009ba29909e51728ULL, 0x00c72889bc9c64ddULL,
+                           0x000764327857ee1fULL, 0x00a39e1a7b591f6eULL,
+                           0x00f07954a795315fULL, 0x004d2d51ca93c8c0ULL,
+                           0x00e754cb42335693ULL, 0x009d94502c977c5bULL)},
+            {FIELD_LITERAL(0x00f9bef64e224f33ULL, 0x00a77912e8df0a71ULL,
+                           0x00a47147e6719fb5ULL, 0x00b164bbccefe239ULL,
+                           0x00d4c946ec8e93e1ULL, 0x008e63239da04555ULL,
+                           0x00b6cf4931167949ULL, 0x000e8b5e32a1c5eeULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001ec581d4a9c09fULL, 0x00be2e2620af443eULL,
+                           0x004871d705f959d3ULL, 0x00bcbb5608941234ULL,
+                           0x00572d86de9c9dabULL, 0x004ac07141896be0ULL,
+                           0x00ac8f8b0ac29d54ULL, 0x0038a42326b0ada6ULL)},
+            {FIELD_LITERAL(0x002d7367480992c8ULL, 0x001fad3d84b37118ULL,
+                           0x00bd63c2b6da21deULL, 0x003c0c12c3f24c09ULL,
+                           0x0034cd55145dfd31ULL, 0x00e0e56b57316526ULL,
+                           0x002fdad6994721f2ULL, 0x0079011c654bda39ULL)},
+            {FIELD_LITERAL(0x003c85b86c831c05ULL, 0x0028e82afb30b684ULL,
+                           0x000107ecfbf4bf1bULL, 0x0019c12bc954fda3ULL,
+                           0x00763afa1f63f4eeULL, 0x003e4da3b1a587ddULL,
+                           0x00806e9c4c24817eULL, 0x00b6977cf70712e7ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00c811f0d3e7fe61ULL, 0x001fbf24003efa6aULL,
+                           0x00018989999d5e40ULL, 0x00fa9e2b319e2839ULL,
+                           0x001537caf32c3311ULL, 0x00b3c10cd47e6fe8ULL,
+                           0x00bc8646354486edULL, 0x00f35284914b41dbULL)},
+            {FIELD_LITERAL(0x000137e194ec8e37ULL, 0x0078ec6d11344c4bULL,
+                           0x0046ef88e5ea05f0ULL, 0x001fb0415cfec098ULL,
+                           0x0066aa3db06fe7aaULL, 0x00710bf49cd9c1fcULL,
+                           0x0089ad9917075596ULL, 0x00c5053a96884e03ULL)},
+            {FIELD_LITERAL(0x003dba4da7aefb39ULL, 0x0053cc251635ad8cULL,
+                           0x0098fcc90171f414ULL, 0x004c0bb9e39561d3ULL,
+                           0x00b1e1d4f7b0c0b0ULL, 0x00477ce1e94e4db5ULL,
+                           0x0059a270245d5d0bULL, 0x00eb99edd762f967ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00177d961d62fad6ULL, 0x00076e76676ea762ULL,
+                           0x007ec74f444bb42bULL, 0x00f2fb0b68b1bfa0ULL,
+                           0x002fcb712dc65b79ULL, 0x001afecf34610db4ULL,
+                           0x005271cfc976bb7dULL, 0x0056d40fc59fb84cULL)},
+            {FIELD_LITERAL(0x00fec6f0bcc7102eULL, 0x00ece204ddc2120dULL,
+                           0x00e3ade5b1f0d77fULL, 0x00dfc39f86603521ULL,
+                           0x00beee5dd7986d44ULL, 0x0001814683f8957fULL,
+                           0x003a6f4f79ff267fULL, 0x009061e70e1b654bULL)},
+            {FIELD_LITERAL(0x00701756043899a9ULL, 0x00b8ff5e0e38b23aULL,
+                           0x00e5639b3faa6661ULL, 0x0052d1ce2e8b5adfULL,
+                           0x003438af5e588b55ULL, 0x0036e37714f8df4fULL,
+                           0x00235b93936031b0ULL, 0x00715c82c6a5c800ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0004036d8b7a8bb4ULL, 0x00f33c9ef5c302a7ULL,
+                           0x00e9a60bdcc4b9a2ULL, 0x008d7b873f67b9c9ULL,
+                           0x00d3a20d04fecbb3ULL, 0x00e716a923221d41ULL,
+                           0x00526d7a078917f2ULL, 0x000a154a6cc6c972ULL)},
+            {FIELD_LITERAL(0x005b0975f8290d6aULL, 0x0015d717f6dfd355ULL,
+                           0x0046a7409ba7de6fULL, 0x00a32f9ac1c1e2f7ULL,
+                           0x00a79abd1e170a57ULL, 0x000abe40324592b6ULL,
+                           0x007852ff8d008d85ULL, 0x00be8633ca0c9d1aULL)},
+            {FIELD_LITERAL(0x00c114d003f5866fULL, 0x00921b92b72055b0ULL,
+                           0x008a6141491ab9d8ULL, 0x007150fe1e461fbdULL,
+                           0x0051188cda55adc1ULL, 0x00551577025d4542ULL,
+                           0x00ba217d55b8e7b1ULL, 0x00a9801fd5de9e11ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0025df8f5a2b620dULL, 0x009e28fa39331305ULL,
+                           0x00cc6df71a0b7515ULL, 0x0095b46ae7ba4742ULL,
+                           0x00a5c1d6f45c24ecULL, 0x007dbadba1a34657ULL,
+                           0x00297a6b6665f974ULL, 0x003dd77a535cf231ULL)},
+            {FIELD_LITERAL(0x0079d7f854cdd722ULL, 0x0064cd431f82eebcULL,
+                           0x00f45a1a2b934c0bULL, 0x0046ada137684b9dULL,
+                           0x00acf835455d0ae0ULL, 0x00504d5d41451698ULL,
+                           0x002f07d6e28ae07eULL, 0x00569423c455e504ULL)},
+            {FIELD_LITERAL(0x0058ad6f0fc5af53ULL, 0x0066573719c6cf0bULL,
+                           0x006c5371c60cbb49ULL, 0x003b4962f06e1926ULL,
+                           0x007cd1620e04cb47ULL, 0x00e56b9cb1b753e0ULL,
+                           0x0077b4e7187272b4ULL, 0x002a745f250177f7ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00ee34b58da29b24ULL, 0x0032afe0a129c8b1ULL,
+                           0x0053d81c38306125ULL, 0x00df0c51c25877e3ULL,
+                           0x00c823e693745795ULL, 0x006bb26b1b791132ULL,
+                           0x008da3cedbed0690ULL, 0x008c87a9e89bd12dULL)},
+            {FIELD_LITERAL(0x007fca91a821cfceULL, 0x00d8bdd16afa4577ULL,
+                           0x00529c6186cf87d6ULL, 0x0085013741f4fff2ULL,
+                           0x00c795675bb7a22bULL, 0x0037e6b3736d5b0eULL,
+                           0x006e133ea65b4ef5ULL, 0x0094bfad35c2c7c7ULL)},
+            {FIELD_LITERAL(0x0038642cb7ed4a36ULL, 0x00b1839502aab9abULL,
+                           0x00fd6420c26cc14dULL, 0x00a32d7e271477aeULL,
+                           0x00f75b607a385980ULL, 0x0048ca446cc5c743ULL,
+                           0x007bdf238633ac4cULL, 0x0066fcc1acaa67fcULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00fa3d24ddb3a382ULL, 0x00a3aabab33d32ceULL,
+                           0x00b49a391fd85f31ULL, 0x00924528f37aa528ULL,
+                           0x0016069e5755bb07ULL, 0x0089773aebd52046ULL,
+                           0x00dc818aa57b5c23ULL, 0x004ba9df0f572267ULL)},
+            {FIELD_LITERAL(0x0079ef09abb1e470ULL, 0x009766eda82a41f6ULL,
+                           0x0058d630f90ea870ULL, 0x0042eed40066ec0fULL,
+                           0x00e0782bdb1c77a1ULL, 0x006ff2fa13b7e26eULL,
+                           0x00d494885fef5322ULL, 0x008013b889afb517ULL)},
+            {FIELD_LITERAL(0x001fae8e4d7a2015ULL, 0x00c432fd8fab75e0ULL,
+                           0x000b795528b0d2f6ULL, 0x00def86603af243dULL,
+                           0x00a265ecfbc47f2dULL, 0x006f2cb3fcc89da5ULL,
+                           0x00acc44d46e3c7b3ULL, 0x00e1101a60177224ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005308733a9f33ecULL, 0x007407302f933f2bULL,
+                           0x003e8fbe6dc8818eULL, 0x00c8eeaea2558cc7ULL,
+                           0x00dd6e45dc9c9fb1ULL, 0x004bf6b7603cf01aULL,
+                           0x00825c15117c1133ULL, 0x00f5d858db0b244bULL)},
+            {FIELD_LITERAL(0x00d0275678b8ee98ULL, 0x00b9a9a20984ad03ULL,
+                           0x0075ed0cc465acafULL, 0x00bee93b089a0770ULL,
+                           0x006498659b0139e7ULL, 0x00ee3186a864923aULL,
+                           0x005a895741395427ULL, 0x005a871a706cb8b7ULL)},
+            {FIELD_LITERAL(0x00e68a8682dc8a50ULL, 0x00d1eba667f0d8d8ULL,
+                           0x00d9ce8bc1dd7464ULL, 0x00e31d71d6901c04ULL,
+                           0x0099583f600c6bfaULL, 0x00cb0df6bd3d318aULL,
+                           0x00427bb0e94e9fc0ULL, 0x00d35f526ef362f9ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0016278da27d5247ULL, 0x00c6d2dc2dc77bd0ULL,
+                           0x00cd6e16bb2aa442ULL, 0x0060e205413819c7ULL,
+                           0x0002f581375bca23ULL, 0x001853327bef19e9ULL,
+                           0x0074c64501acb212ULL, 0x00f792e474c33de8ULL)},
+            {FIELD_LITERAL(0x004d6c95f8b16391ULL, 0x00782c7f89d22effULL,
+                           0x005a886d33804a7bULL, 0x00094100a0edc4e0ULL,
+                           0x0057f01470b9b98bULL, 0x00ebe877e7b13f92ULL,
+                           0x0019e7f00ad41f52ULL, 0x0036debb6f7aefeaULL)},
+            {FIELD_LITERAL(0x00508cbec707a635ULL, 0x0007b396b3a4b38fULL,
+                           0x00bb9137c2e7dcddULL, 0x0030aadee01e19c5ULL,
+                           0x00264d6610d7817dULL, 0x00ca83a565c3a478ULL,
+                           0x000404d89e877867ULL, 0x00ca964e45c8b677ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00fedd9ff42d9433ULL, 0x008828592f6b9ae2ULL,
+                           0x00afd92379ec17eeULL, 0x00c64d083d69116bULL,
+                           0x00d985d8ecbc71edULL, 0x00f8bd140f923393ULL,
+                           0x002850094df6f03dULL, 0x004c01737798cbfeULL)},
+            {FIELD_LITERAL(0x002d4b608c271643ULL, 0x00e541fa785f938fULL,
+                           0x00919c6917222aaeULL, 0x00df6c5cbb43d0b7ULL,
+                           0x0092f16202dc36ceULL, 0x00ae4d56426581c1ULL,
+                           0x00146a7fc8c0d59aULL, 0x0042248b1b89cb84ULL)},
+            {FIELD_LITERAL(0x00b5612af892e9faULL, 0x00616e870fb03ae8ULL,
+                           0x0007a8487d8149c0ULL, 0x00e6770c2cb9ada9ULL,
+                           0x00b68c721357fd8bULL, 0x00d16c9665630afeULL,
+                           0x00c3e551e5445353ULL, 0x00a356e2fb93f394ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001f69ca39467560ULL, 0x0026b6d6267c4c66ULL,
+                           0x00a9543f0a7d505cULL, 0x001ad5cc1b85c1b1ULL,
+                           0x00573292a968a3cbULL, 0x003b411ac2c7ab2aULL,
+                           0x00e215632dab9477ULL, 0x00c4917f682be2edULL)},
+            {FIELD_LITERAL(0x00efe5705342adf7ULL, 0x000e95a7babd4053ULL,
+                           0x0062bb645523fa11ULL, 0x001d8872d27a2d64ULL,
+                           0x009e22ee4d900733ULL, 0x00ec4104679ecfddULL,
+                           0x007d8f59ea8fef74ULL, 0x001d0b32d01b6993ULL)},
+            {FIELD_LITERAL(0x00462ff2a24bc4bdULL, 0x0084eeb45cfde39eULL,
+                           0x00cf527cac9e4bbbULL, 0x00283856990511e7ULL,
+                           0x00f2827091f1f447ULL, 0x007cc8f79c39cd0cULL,
+                           0x007c298bf3322c32ULL, 0x00282064c0f73396ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x008452d78c6f25eaULL, 0x0096ec6cd95b59f3ULL,
+                           0x005695ea67112b15ULL, 0x00c83d7ce277b8d3ULL,
+                           0x001c2025a77fc46dULL, 0x0031e72b1db2362aULL,
+                           0x00dcdedbd296e1d0ULL, 0x00fb4377bf47eb6eULL)},
+            {FIELD_LITERAL(0x00c3dd24d122ed9aULL, 0x001356a197622d7aULL,
+                           0x002c5e09d91b87ecULL, 0x009bfbeff89380caULL,
+                           0x0004aca558dbf270ULL, 0x00aa75a6ff6fbd0dULL,
+                           0x00ccdbd982227237ULL, 0x004cc79ff6adc812ULL)},
+            {FIELD_LITERAL(0x0075e7b2a3a05636ULL, 0x004b26e3c0020bb3ULL,
+                           0x001b05a87d5c19e4ULL, 0x00fcd6f2e2359125ULL,
+                           0x0080ac9eb901762dULL, 0x0072b8afdf872395ULL,
+                           0x00837bc5c580fdfeULL, 0x00af886fae1ae414ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0011d339c4dcda80ULL, 0x00f105dad9606159ULL,
+                           0x00b284e2849fc57fULL, 0x00365ff6bb281c78ULL,
+                           0x0035719918d0aa5dULL, 0x0026286b29173f1dULL,
+                           0x007fd3cfc75c84cdULL, 0x00137b6df193f035ULL)},
+            {FIELD_LITERAL(0x00ed9be09d221f48ULL, 0x00f436f0c4a21d93ULL,
+                           0x007064d37e07b539ULL, 0x006f3d9ea63d52c6ULL,
+                           0x000b08395a630966ULL, 0x00d4ce1ab6257c90ULL,
+                           0x005292aec444cc96ULL, 0x00aa3e08659f59d5ULL)},
+            {FIELD_LITERAL(0x00b043b65373a645ULL, 0x0057e5030affa8a1ULL,
+                           0x00590157ba99b4ccULL, 0x009ba9a8da99131fULL,
+                           0x00f0c1deef34588bULL, 0x008ca8a271146f60ULL,
+                           0x00350e366f521d66ULL, 0x00b0f9870f77096dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003b0c8c7712cabaULL, 0x00cb54e09ba4ee5dULL,
+                           0x00ae1221e9b96a06ULL, 0x002d5d66959a3fcfULL,
+                           0x00324b156920720dULL, 0x0098c2b5bea19d2eULL,
+                           0x005fe08e6d7e26c0ULL, 0x00a9153cfe13e10aULL)},
+            {FIELD_LITERAL(0x005aa4db63e532f6ULL, 0x0099eecd7e8cc314ULL,
+                           0x008c1148fab93deaULL, 0x00450d6323ae6840ULL,
+                           0x003dca8c8658f0caULL, 0x00657f546c715ae9ULL,
+                           0x0049978fc2b89a8cULL, 0x00e3acef24dcead9ULL)},
+            {FIELD_LITERAL(0x00d2c31d655b3a9eULL, 0x00bdc6d49da7085cULL,
+                           0x0017b357cae21219ULL, 0x005a89005968b011ULL,
+                           0x0076adca8306da9aULL, 0x00aa9050be5cc7d8ULL,
+                           0x0091800cacf980aaULL, 0x00e17e5d4f7b892aULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00636e3841d78b71ULL, 0x007e0b493bb81960ULL,
+                           0x0014c69009746e44ULL, 0x004e70d3e6093caaULL,
+                           0x0062e1a9916157d4ULL, 0x00121e6de653909fULL,
+                           0x0054caad9b72eb29ULL, 0x0010b25fd5570a71ULL)},
+            {FIELD_LITERAL(0x007a679fe033d26cULL, 0x00093a38517a7c9cULL,
+                           0x00eb5c0b2928d5ecULL, 0x00d9b9161b1fb80cULL,
+                           0x003f853d9479bb79ULL, 0x00c864db0724e443ULL,
+                           0x0012466382261b04ULL, 0x00298978329f458fULL)},
+            {FIELD_LITERAL(0x00096e212f1c9e8cULL, 0x009ea9a298b172d3ULL,
+                           0x00486a731d9d2be3ULL, 0x00b98a042ce989deULL,
+                           0x0088e10f82e20ac0ULL, 0x00113ccf6a3bf1f1ULL,
+                           0x00cd396eb8eccc64ULL, 0x0049f1d8df82f766ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003c694f328f8ed5ULL, 0x00b0cad99224dd3cULL,
+                           0x00a1c8dacefa9a0dULL, 0x006e8f88fafaa774ULL,
+                           0x004721e56f2c7d93ULL, 0x003169b43496775dULL,
+                           0x007666d049a86defULL, 0x00bdf5f189577dbdULL)},
+            {FIELD_LITERAL(0x0062aaf916d350aaULL, 0x00d929c4c33213fdULL,
+                           0x002f965c13b4d96aULL, 0x009717d9e7865042ULL,
+                           0x002a6684aed6ef7dULL, 0x00fa9131ca589b44ULL,
+                           0x001bda0d7b811a30ULL, 0x00f16d9dde8bdf2cULL)},
+            {FIELD_LITERAL(0x00625df65d3009a7ULL, 0x00dd48b6fc051ad4ULL,
+                           0x000c3f429989e2aaULL, 0x00f64c084d499551ULL,
+                           0x007c9d758d376f91ULL, 0x004f3516d8191bc5ULL,
+                           0x0002d3aa8893b360ULL, 0x006cc9dae9f92d92ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00ef072f65a586a7ULL, 0x006392b2d1095e07ULL,
+                           0x003a16f3ae03cdedULL, 0x00bc6763ddf4d3caULL,
+                           0x003a2aea3474a3c6ULL, 0x00b0a3b15eca9742ULL,
+                           0x00dbfcc6841b3916ULL, 0x00c179eda4804507ULL)},
+            {FIELD_LITERAL(0x0081f69b7afee9c9ULL, 0x003c666a59e5c8eeULL,
+                           0x0063d96805d93cf8ULL, 0x007c219f815d0037ULL,
+                           0x00c5d77d33e71085ULL, 0x001cbfcd0821743dULL,
+                           0x00e504b11d282848ULL, 0x0007cc3990a985dfULL)},
+            {FIELD_LITERAL(0x0018401ca0622956ULL, 0x00be360355a5c663ULL,
+                           0x002cc0c042d59102ULL, 0x00f493fa61942ac9ULL,
+                           0x0072cf202f47176eULL, 0x0035b4cff86a26d8ULL,
+                           0x00757a95f34b18cbULL, 0x00b04bf1202df712ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003a6e60b4a184aaULL, 0x0041cd140b0043b6ULL,
+                           0x0044bc8ee32b929bULL, 0x00ea87a39bf6648eULL,
+                           0x003a56a4695c6065ULL, 0x00799e95ea8ba649ULL,
+                           0x00460330d016b361ULL, 0x00a9506904ea85aeULL)},
+            {FIELD_LITERAL(0x004561653f7843caULL, 0x00983725171ff4abULL,
+                           0x008330516ddca4b1ULL, 0x00410d20632530a5ULL,
+                           0x00301ede4afb442aULL, 0x00cf561bc67a45d6ULL,
+                           0x009f561af7a4391dULL, 0x00a4ced58978c87dULL)},
+            {FIELD_LITERAL(0x006da8af2df7d6b2ULL, 0x00dedafd974a7422ULL,
+                           0x0002ea6e1b011e94ULL, 0x006058c7b65ffcf4ULL,
+                           0x00159c81cf28365fULL, 0x0036b498e2eb594fULL,
+                           0x0028040ab3b02ff1ULL, 0x00ac54985e15d3a5ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b10b3c415fac9eULL, 0x00574755b84d8e03ULL,
+                           0x00dd40b147b88b65ULL, 0x0032bcc9c0c53b9dULL,
+                           0x00a51fd7ab1bd23dULL, 0x001e6608fcbdea93ULL,
+                           0x008996b392ce6272ULL, 0x002795ea01dcbe6bULL)},
+            {FIELD_LITERAL(0x00a997e05f96a9aaULL, 0x0042e530c0f10e70ULL,
+                           0x00e56437f45d0bb1ULL, 0x00c2f42db1b2a684ULL,
+                           0x00a0c1713e3cf9dbULL, 0x006cc7bdbd32ab6dULL,
+                           0x00997be35e8017eeULL, 0x003f4723bc7b0370ULL)},
+            {FIELD_LITERAL(0x00f29398e607dda0ULL, 0x00acfdea918c10c7ULL,
+                           0x00b293867d14da60ULL, 0x002085f0ea058622ULL,
+                           0x00e556103864e98eULL, 0x0022f90b93a09615ULL,
+                           0x00704ff011750c06ULL, 0x0093c42bd2221465ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003b0ef5ffbe4846ULL, 0x00f3efa061c7f444ULL,
+                           0x000d482faf043489ULL, 0x00070bc7363d7808ULL,
+                           0x00b951706aec6488ULL, 0x00a11dbcc2113787ULL,
+                           0x00eb1a77044fb708ULL, 0x00db763c86c2c417ULL)},
+            {FIELD_LITERAL(0x00c34ceaeec640bfULL, 0x002377e18895c132ULL,
+                           0x0002a881375b5388ULL, 0x002bf7cc008bde62ULL,
+                           0x00fa1b07bac237a6ULL, 0x007cefde9765a1cdULL,
+                           0x00af6f0e5948281bULL, 0x004750f65b7cbb94ULL)},
+            {FIELD_LITERAL(0x00c6b879b1055ab4ULL, 0x007aa365dc10855aULL,
+                           0x00773ae03e0b6939ULL, 0x004a5022d61387eaULL,
+                           0x00cf7529515a0c2aULL, 0x00fbc8791a79f2acULL,
+                           0x00f705fc43fa888aULL, 0x0049e1bcdc64df19ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x004027c069b5254cULL, 0x008387634c06ddfaULL,
+                           0x0066393a4a033efaULL, 0x00ec65b1e35a943cULL,
+                           0x0053c5ef67e9c3f3ULL, 0x0082195035670f25ULL,
+                           0x00e6058233fd4cf1ULL, 0x0001fd04130c50d4ULL)},
+            {FIELD_LITERAL(0x0000f25cc63fde18ULL, 0x00436593e32a2272ULL,
+                           0x00e83f5d7cf594d1ULL, 0x000049b3832f6651ULL,
+                           0x00f6c92a5d68f6fbULL, 0x00a536799ba83b0bULL,
+                           0x009bf5b5bd0de971ULL, 0x00ef50061f4234f2ULL)},
+            {FIELD_LITERAL(0x00c2199100123360ULL, 0x00700c503254f3e9ULL,
+                           0x00e4c75582eef52aULL, 0x0002a4d1b995e478ULL,
+                           0x000c8f0bb54a25e5ULL, 0x00a11671bfbb1952ULL,
+                           0x00aa53088aa1fae2ULL, 0x003128f05b13e8b5ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x008000914df6d37fULL, 0x00841a778285a531ULL,
+                           0x008b725d212842f3ULL, 0x0032be7a52f9fd90ULL,
+                           0x00c1bf67db04ff23ULL, 0x001407319e863538ULL,
+                           0x00ea83dc4f95499bULL, 0x0097a3a33efe0accULL)},
+            {FIELD_LITERAL(0x00863e6022f60c77ULL, 0x005f6449abe04723ULL,
+                           0x008eb21991722595ULL, 0x00c0ef37ace83a8dULL,
+                           0x00a217089d8050b3ULL, 0x00c6cb6e8ff1145cULL,
+                           0x00b43b87346ad646ULL, 0x00f492a601f59f9fULL)},
+            {FIELD_LITERAL(0x00d96b17542a19d8ULL, 0x00cdff9ea493efc2ULL,
+                           0x00c38552d65beb3eULL, 0x004feefc86635c7fULL,
+                           0x00ff9303d5634c89ULL, 0x00b78d36a961c46cULL,
+                           0x00cd68f32d68512eULL, 0x00658759c18b059fULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d4efa3083a4917ULL, 0x00ec3713dfca2259ULL,
+                           0x007ca1cd57ae2fcaULL, 0x004543e5a294a867ULL,
+                           0x0071a9215d3df22cULL, 0x001f02a121a3b245ULL,
+                           0x00b131fd05c8ffdeULL, 0x001bbe74fc1eeae2ULL)},
+            {FIELD_LITERAL(0x00b554baf5e07ea4ULL, 0x00149ab3190e79ceULL,
+                           0x00ed5cba21bf1684ULL, 0x00cc64b63d71e9c1ULL,
+                           0x00e71bf359f90888ULL, 0x00fce1eb657cd5e4ULL,
+                           0x001d955fe9203448ULL, 0x00c44efddbd64752ULL)},
+            {FIELD_LITERAL(0x00d8e95f580ec7e2ULL, 0x00c8a7e626183beeULL,
+                           0x006b5037f6e64992ULL, 0x00f2cf1022e9948dULL,
+                           0x0017784e3704dd4fULL, 0x003f6d4cc5f83170ULL,
+                           0x006eb56266bf3422ULL, 0x00234568da69bf5bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00233bf0ebabca19ULL, 0x00582188453cc8b4ULL,
+                           0x00d4ca7100565b75ULL, 0x0039466d38e746d6ULL,
+                           0x00982a0c87a34c1cULL, 0x00bf878e07e731d7ULL,
+                           0x002ba17377ea2d61ULL, 0x00336fed9d9a4d71ULL)},
+            {FIELD_LITERAL(0x00706977939c3ad4ULL, 0x0098f53fc6b98cafULL,
+                           0x00a6fb42eb489100ULL, 0x00071c19df26c0a4ULL,
+                           0x004c329586c778e5ULL, 0x004c50ef63919822ULL,
+                           0x00b76e9e31cee089ULL, 0x00a5d89aa64ddc7cULL)},
+            {FIELD_LITERAL(0x00ebeab634eb1fb1ULL, 0x00d9c00a18a73f4fULL,
+                           0x00acff6433c42c2eULL, 0x00409f2d7a7672ceULL,
+                           0x008dc967d1395b2dULL, 0x00d2a0059c7ec26fULL,
+                           0x00dcbc130a719962ULL, 0x001ed3f434d450afULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00fc61e7e10ed115ULL, 0x00a4e316b263290eULL,
+                           0x00b49581e43ff71fULL, 0x005e803d2498340aULL,
+                           0x00a042b620222552ULL, 0x009d08f6846c882bULL,
+                           0x0030d8dc6edc4338ULL, 0x0086cabcd4d9f5b9ULL)},
+            {FIELD_LITERAL(0x00e86af4afd32920ULL, 0x005af9927f3c41bdULL,
+                           0x0060607411f942fdULL, 0x0054152f12508befULL,
+                           0x00850d96a0d466e4ULL, 0x0064c768d4df25feULL,
+                           0x008f56a154671f96ULL, 0x00796b9eee3c4010ULL)},
+            {FIELD_LITERAL(0x009263ceacb07db4ULL, 0x00385dd765c28e93ULL,
+                           0x00e3df7b3670f7e6ULL, 0x0063c0e3d00f36d0ULL,
+                           0x00321de3f95983acULL, 0x007826a2ad51ff4eULL,
+                           0x009a0807253965d2ULL, 0x003e9df2c8242e61ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001e6c322a9cfe38ULL, 0x000a25fdd7db2cfeULL,
+                           0x00be9825f8ae8dc5ULL, 0x006ff077f08ef2faULL,
+                           0x003ee23f01769bc7ULL, 0x00a821c28d10c852ULL,
+                           0x00dde2b410c6fee9ULL, 0x00b714644da16d5aULL)},
+            {FIELD_LITERAL(0x00158f4887922333ULL, 0x0030c6bf582df504ULL,
+                           0x00219e6999ac6156ULL, 0x00ac3552f243b3edULL,
+                           0x00c6ebb4a4ee60a6ULL, 0x00add5d168f4b5dfULL,
+                           0x00b534faad491953ULL, 0x000714717795adcaULL)},
+            {FIELD_LITERAL(0x00c0b3336de91ba0ULL, 0x00bd337643347db4ULL,
+                           0x00dd16368e8fba9aULL, 0x000ae7f9d9ded322ULL,
+                           0x000fd2299578623eULL, 0x002d371c048c7857ULL,
+                           0x008d66f2dde544d0ULL, 0x0052bdbdce3bb067ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0072af91a30770d2ULL, 0x002499122aad5fd3ULL,
+                           0x004983f46b04e77dULL, 0x0077b8ad4a67558aULL,
+                           0x000f576cdff2d778ULL, 0x00e5b3a7908927a5ULL,
+                           0x0024a2f4edd1f557ULL, 0x00890eed65619cd6ULL)},
+            {FIELD_LITERAL(0x0074fe62f02a5516ULL, 0x005be1f705eb2c5eULL,
+                           0x0037098361e10293ULL, 0x001429818cba0240ULL,
+                           0x00a9a5f3b8a3e69eULL, 0x00727b21c40d0923ULL,
+                           0x00b286e33d556eb0ULL, 0x007a91e94bc9e7c1ULL)},
+            {FIELD_LITERAL(0x007fed1291c93710ULL, 0x00e04abe594eeb29ULL,
+                           0x00c471f47ae1fcbbULL, 0x00b142644f03bd94ULL,
+                           0x001e60368394fa15ULL, 0x001dcf2474deff9cULL,
+                           0x0080ec0349cb5bc4ULL, 0x0023897d058c288bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0091eef6fc68c513ULL, 0x00392367ab1bb4c6ULL,
+                           0x0050b8b5be76af46ULL, 0x003a30fccc8f23a1ULL,
+                           0x00d230b13f3249beULL, 0x00ba24a512a52205ULL,
+                           0x0093e1577af56bb3ULL, 0x003c2727bf7d0c28ULL)},
+            {FIELD_LITERAL(0x00b72f4fe1337778ULL, 0x0081f5ed8fa1f4ecULL,
+                           0x007387ed8baa03b0ULL, 0x00488f98ae8376b3ULL,
+                           0x007f4f815d844e3aULL, 0x003f8270659da1a2ULL,
+                           0x00aa918d82e44ccbULL, 0x00a2ffa27577ee88ULL)},
+            {FIELD_LITERAL(0x00d89997d962ab16ULL, 0x0052b1fc6e1a258aULL,
+                           0x00d9d2fb56d4308aULL, 0x00e2958bf169d43cULL,
+                           0x008852ee2abcb7dfULL, 0x000e83b7456ebbe3ULL,
+                           0x0073c4af854d94f4ULL, 0x0071fabe5c7956e1ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0040ecafd17a1398ULL, 0x002aa090620d1a51ULL,
+                           0x00c65843c7407f77ULL, 0x00a39f2536a80f0aULL,
+                           0x00e8619aa1495921ULL, 0x00cd07a4419837dbULL,
+                           0x00b48db19c6fd4a6ULL, 0x00e2f397507034d9ULL)},
+            {FIELD_LITERAL(0x00867cb65cc66499ULL, 0x00f01f22fbc26b89ULL,
+                           0x00e92ae6ea7a0210ULL, 0x00c57091ffa60fccULL,
+                           0x00c7fa43ced5890cULL, 0x009ed3847a4b9f89ULL,
+                           0x007e5b43feaa10c3ULL, 0x00b646199608cc5aULL)},
+            {FIELD_LITERAL(0x0061ecc3f34d870dULL, 0x0014a6da8fbc9451ULL,
+                           0x00cb5f7ad445439dULL, 0x00db98435f965ceaULL,
+                           0x00c96ab7c657a3a8ULL, 0x009e122cfb7fdc21ULL,
+                           0x002fb7a8aa1cf19fULL, 0x0065846b7192d973ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00db9a3b64bbd153ULL, 0x00e71f5681934813ULL,
+                           0x00e3f92ccc177460ULL, 0x005494ad8ce6abb6ULL,
+                           0x007cc56230ee64aaULL, 0x00bfe527a4130f75ULL,
+                           0x002a2b0dc0e08ff2ULL, 0x00109ce6952b6750ULL)},
+            {FIELD_LITERAL(0x00b2bf1aa1c52a93ULL, 0x001e441a3c43a946ULL,
+                           0x005efaa082658fd4ULL, 0x00f876c56cfe0719ULL,
+                           0x00f183f662cd99eaULL, 0x004ef55356f34cc5ULL,
+                           0x00535bd8d14ff9b5ULL, 0x008ec4904d4c7a50ULL)},
+            {FIELD_LITERAL(0x00759058d52fff72ULL, 0x00e2a8ca14da0a53ULL,
+                           0x0082b7757214d825ULL, 0x008a2f94ff19ea43ULL,
+                           0x00bfefadd286cd45ULL, 0x002f2d87ff50f4efULL,
+                           0x001a0d2e4d923d24ULL, 0x0088e6799b598e3fULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0052fe61f0392a71ULL, 0x00dfa64a34365fc8ULL,
+                           0x000c142ae8c17ab9ULL, 0x0055f3cfb6475770ULL,
+                           0x0039ab869e0c2901ULL, 0x00424f71e7eb2921ULL,
+                           0x009000f3a8015f80ULL, 0x00ab1490b7bea5a6ULL)},
+            {FIELD_LITERAL(0x00a5609a637ccf9fULL, 0x0076cc4c87158e8bULL,
+                           0x00cf7341b858aa25ULL, 0x00d95ddc6cfaf1f1ULL,
+                           0x00b864b77e6da299ULL, 0x0001ddfe3609ce72ULL,
+                           0x00d4b0ccd46e2120ULL, 0x007a53cb1995a6b8ULL)},
+            {FIELD_LITERAL(0x003b32877c440d84ULL, 0x0097f4db634e8ddaULL,
+                           0x00570f9687be0b0dULL, 0x0056b81772a909eeULL,
+                           0x00e4e9f713551292ULL, 0x00820cbe91b7e551ULL,
+                           0x00a5ad917e30409aULL, 0x0087082fb36d3548ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b8d32fc93357c7ULL, 0x0014dcff155f9b26ULL,
+                           0x00c07216a056a258ULL, 0x0044d98beddbb40cULL,
+                           0x0091eacf52393b6dULL, 0x007b61f88337302fULL,
+                           0x003a4645349ffeaeULL, 0x00902840144723f5ULL)},
+            {FIELD_LITERAL(0x00335103269c8ae8ULL, 0x00385a5a9d03c427ULL,
+                           0x0059b0d5ec25b991ULL, 0x0089d7f123358bcaULL,
+                           0x00d54ac86d1a988bULL, 0x0054a13e749427beULL,
+                           0x0071a205d62013ebULL, 0x0047e076796fe4d6ULL)},
+            {FIELD_LITERAL(0x00aa1eafcc5ffbc4ULL, 0x0039b291c6012655ULL,
+                           0x004b2082f127a030ULL, 0x0076fab0a810192bULL,
+                           0x007e209ed45e4a75ULL, 0x0082acfad2f1290bULL,
+                           0x00ca53a3b4586198ULL, 0x0013df50da23846eULL)},
+        }}, {{
+            {FIELD_LITERAL(0x007e2d6d0f0eb7a6ULL, 0x0005e9150b091da8ULL,
+                           0x007143cea48a1e30ULL, 0x00e115436a6935acULL,
+                           0x002f99d08a1d2755ULL, 0x00884b6c93a65315ULL,
+                           0x006bd52199191ff8ULL, 0x006b995dbea2a12cULL)},
+            {FIELD_LITERAL(0x00690db9d5c25b62ULL, 0x002b2a1128417de6ULL,
+                           0x00538188271a382bULL, 0x00b9cf318b61a6ddULL,
+                           0x007e274d3dea880fULL, 0x00a87d536ce4c97dULL,
+                           0x00d4d3d08a751b15ULL, 0x00f39d736ecf8bf6ULL)},
+            {FIELD_LITERAL(0x00f40f94dac9d809ULL, 0x00d5cf1121816fcfULL,
+                           0x0046bc515108d299ULL, 0x00e6e87fb45096b0ULL,
+                           0x00efc6d682af5bb4ULL, 0x0050cd871e30cb65ULL,
+                           0x0046b92f5389e46cULL, 0x0011f8cffbd9fecfULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d4c1d59e5bca58ULL, 0x0000092905c2c297ULL,
+                           0x008d57d7c5317b86ULL, 0x00742e55f62af52eULL,
+                           0x00b794d926ac4a6dULL, 0x00612b15df4f35a4ULL,
+                           0x0052ea959f2a6e7eULL, 0x0059c7af6060e5a4ULL)},
+            {FIELD_LITERAL(0x00f81dad28a8ec72ULL, 0x00b526a004be0d6bULL,
+                           0x00a89c28941b5630ULL, 0x007fbdc03686d104ULL,
+                           0x00e41a5c9c6c86c2ULL, 0x00d9f06d372886f0ULL,
+                           0x000b2f3d24af50a6ULL, 0x0078517d0ff22cd2ULL)},
+            {FIELD_LITERAL(0x00094a0abe917f7fULL, 0x00a6053c467a30b6ULL,
+                           0x00d0e05a9073cb88ULL, 0x0094ea34212de2c4ULL,
+                           0x00da0b5ea7304698ULL, 0x007016327af72e94ULL,
+                           0x00f8d5c853b4ca59ULL, 0x00cf24e0769a8145ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00cfe7c16e315aafULL, 0x00b03ebc4e8c14e8ULL,
+                           0x0043b8a13c39e43cULL, 0x00943923fa3d94fbULL,
+                           0x0019acc9609b885cULL, 0x00334f924d0a6728ULL,
+                           0x00c42d9ba597d488ULL, 0x00b744990b623e27ULL)},
+            {FIELD_LITERAL(0x00cbc43c67ed763dULL, 0x006a8ee97650a0a5ULL,
+                           0x00e75528252d95d4ULL, 0x00810be823374b7dULL,
+                           0x00ed4c0cdb3742ccULL, 0x00fee3dd577f3791ULL,
+                           0x005ee952323a68e1ULL, 0x00f630ab09156712ULL)},
+            {FIELD_LITERAL(0x00c48a68f4733901ULL, 0x00486ac0b16b7fd9ULL,
+                           0x006575a8bb82e9a5ULL, 0x00244601c4dfb377ULL,
+                           0x008ae37e9f4a9707ULL, 0x008c1b24e5054caaULL,
+                           0x00783fd8b4639985ULL, 0x00a0d61bcff6dbe8ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x008e7c823b0d29fdULL, 0x002f39ecc7b9f2acULL,
+                           0x0064925aae3a7c71ULL, 0x00f8e265e99449b0ULL,
+                           0x000d440626d86473ULL, 0x00db9e29cd63f538ULL,
+                           0x0036e3fe792c4f01ULL, 0x00b303971172d5f6ULL)},
+            {FIELD_LITERAL(0x006edd38f4a3e18fULL, 0x00f007ae65437ab2ULL,
+                           0x0003e9d6d7ea2b0fULL, 0x00735a4a35a28e50ULL,
+                           0x0027985da758f4a8ULL, 0x00afc64805cb5a21ULL,
+                           0x00bde7a81d6f1c59ULL, 0x00197ba25e0dddd3ULL)},
+            {FIELD_LITERAL(0x00ed2b93378dbe90ULL, 0x00ef312248c8d8b7ULL,
+                           0x0041b08e908e8529ULL, 0x00c16abff13a4121ULL,
+                           0x003c63620f2da554ULL, 0x0049aba4d2e5090bULL,
+                           0x00e6ec8008fd7671ULL, 0x0072fded84453c8dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0043ff865af83354ULL, 0x007a7d9382962779ULL,
+                           0x00a9a6f0f21c2cbbULL, 0x00341ab5f933d835ULL,
+                           0x00948a20730db8c6ULL, 0x0071d49318ef65e6ULL,
+                           0x000b16bf04c9c954ULL, 0x0028932c295e0bd3ULL)},
+            {FIELD_LITERAL(0x003df27b0a6f1395ULL, 0x00474e502e6ee0f9ULL,
+                           0x006fc9bdff79048aULL, 0x00045abec68fa165ULL,
+                           0x005d761d0edaa112ULL, 0x00a237ec1db0d0a8ULL,
+                           0x005bf44f97d68aeeULL, 0x00a2c770d9dfca35ULL)},
+            {FIELD_LITERAL(0x00e87b8a569d867bULL, 0x0099034b63915cddULL,
+                           0x00ef83de1d889a47ULL, 0x00d3e4b5678fdb0aULL,
+                           0x00bc42be686ca266ULL, 0x0046edc86eacd8baULL,
+                           0x00a2918073a55755ULL, 0x001941d17227886cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0010f8aa328e41f7ULL, 0x007cbfba6606b222ULL,
+                           0x00765c28a9f341a2ULL, 0x00ceacb14aa018eaULL,
+                           0x00f0d2cddf9cd65eULL, 0x0009062a95a83527ULL,
+                           0x00bdbcdc6786adb8ULL, 0x004e294d26c38824ULL)},
+            {FIELD_LITERAL(0x0065fbeb6d361d19ULL, 0x00d792d1ef6fe98aULL,
+                           0x00618edd7c9f57a8ULL, 0x0009eea37713fdeeULL,
+                           0x00aedd55a7a7ac10ULL, 0x00a93808045ac53cULL,
+                           0x0045eeaf72ff6e47ULL, 0x00d262cd49823521ULL)},
+            {FIELD_LITERAL(0x00e20a075338342cULL, 0x00a0af745cd5f675ULL,
+                           0x00ad7bea4be7fc39ULL, 0x00777d10ce63ebd6ULL,
+                           0x00a98950dffb5ba8ULL, 0x0032026150b4a2d1ULL,
+                           0x00f76985040384ebULL, 0x00f82a332d974f17ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005294f0e98f956fULL, 0x00042baa86540cb5ULL,
+                           0x009c8543bf8c1696ULL, 0x00aad6e9e0202d43ULL,
+                           0x002a36c45ee9e1f3ULL, 0x00026e54062d154bULL,
+                           0x0027f91b7b6c70afULL, 0x004bd9527d26ae97ULL)},
+            {FIELD_LITERAL(0x006d2fcdc58fdc11ULL, 0x005d0ff550cbbf43ULL,
+                           0x006681f59a5c1745ULL, 0x00a574b6b333aa84ULL,
+                           0x0090e41fdce795dbULL, 0x006be41deae233a3ULL,
+                           0x0060776f4ca4b4a6ULL, 0x00cc5c82e51965c5ULL)},
+            {FIELD_LITERAL(0x009beb3bdd7eccbbULL, 0x00a875a93781223bULL,
+                           0x00e9bd7b145ae240ULL, 0x00acc36f7860cd10ULL,
+                           0x009bf8b0f8f5a813ULL, 0x00199230947a9330ULL,
+                           0x009d8ecd1b746a1eULL, 0x0004c1907938e17cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x002aff6c3d81ac99ULL, 0x00a45d2218021c9fULL,
+                           0x00049693cfd92a9eULL, 0x00804f2c2046dd73ULL,
+                           0x00c167cc252b14a3ULL, 0x00cf8b00162b0ab9ULL,
+                           0x00168a666a194a86ULL, 0x0085c272d787de92ULL)},
+            {FIELD_LITERAL(0x002bacc39cefc320ULL, 0x0087b85c89695963ULL,
+                           0x004539b1f8e40289ULL, 0x00489dcd1b513ac3ULL,
+                           0x0037684fc8b34dbdULL, 0x003addf6ee8dca59ULL,
+                           0x00270a97d4439209ULL, 0x003e5cc3c6a1de4fULL)},
+            {FIELD_LITERAL(0x002f9986a9e94804ULL, 0x00e3b3a8c306e5a2ULL,
+                           0x005986984fde4396ULL, 0x008751ba444f1777ULL,
+                           0x00681f9eb6e280dfULL, 0x007c4116fabb5d91ULL,
+                           0x004de039de1e7385ULL, 0x00b6d8386c09bf67ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00a1735a5b02e2b6ULL, 0x002cd6e4a5c72ff6ULL,
+                           0x00b6ba840dd31471ULL, 0x00577a37b36b6284ULL,
+                           0x0007327d1b35699cULL, 0x00b9e862bd07f71aULL,
+                           0x00cb6ba3bbf388dbULL, 0x007078fac4c3d789ULL)},
+            {FIELD_LITERAL(0x00580f04603ae906ULL, 0x00d5085cd14950c6ULL,
+                           0x00df263cfc55b75eULL, 0x00d28241bbc45a6bULL,
+                           0x00ce089d1b1b9adeULL, 0x00040316c8320fadULL,
+                           0x009071b0b00c7b68ULL, 0x009e470ce360415eULL)},
+            {FIELD_LITERAL(0x0086e0f3d6c96defULL, 0x003d5a3a66c89876ULL,
+                           0x003daeab2723782bULL, 0x005ea887ebacca17ULL,
+                           0x00bbf0e5b0836496ULL, 0x00680ec15fdb67c8ULL,
+                           0x00017536c4854749ULL, 0x00845a18961a99beULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00e5ec2d280ad563ULL, 0x0041bf827de492dcULL,
+                           0x00ad8046f5620333ULL, 0x00f6fc7cdd142fc3ULL,
+                           0x00225e95ca294154ULL, 0x005842d911f49db2ULL,
+                           0x0088ada6fc6df7abULL, 0x00ebeaf6c1b28a9eULL)},
+            {FIELD_LITERAL(0x00d2d839747cbb73ULL, 0x004a2f845af39c9dULL,
+                           0x003c1753819a16b5ULL, 0x00560845d1421441ULL,
+                           0x000282410ccdb70eULL, 0x000e50d3fc9460d0ULL,
+                           0x0059b6cb5f0a9081ULL, 0x003eff3e01c33604ULL)},
+            {FIELD_LITERAL(0x00bb4ba1e6ea084fULL, 0x0014b0a0ec2b8520ULL,
+                           0x002598fe383800beULL, 0x00428424f7ecfe65ULL,
+                           0x00f3eedc66aed028ULL, 0x0032ea73178865ffULL,
+                           0x00c40abfa255455dULL, 0x0053a0c1f22f8aaeULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0019362d9db8c76fULL, 0x002ccfa84ca35f89ULL,
+                           0x004e335ede890c39ULL, 0x00981849f0966155ULL,
+                           0x00bd166702d21601ULL, 0x0059dac8c0a46437ULL,
+                           0x00215b792592a037ULL, 0x000765535432cf3dULL)},
+            {FIELD_LITERAL(0x0071b4399e10ce63ULL, 0x00df4c16a3fc027aULL,
+                           0x0062ca08fcd3ef6fULL, 0x00ed5b1464eb2518ULL,
+                           0x00baa8ab978e5ce4ULL, 0x00e20ddf76d474adULL,
+                           0x00ed2a75f1042353ULL, 0x0080e5df178e7ddeULL)},
+            {FIELD_LITERAL(0x00b25b96c05ed32eULL, 0x00405d0fa9ccc420ULL,
+                           0x0025b56ddab138c5ULL, 0x00ec3f27ec07d8ecULL,
+                           0x00203e9d31c3579bULL, 0x0090c24618f202a4ULL,
+                           0x00894256e2413f3aULL, 0x006d4257ac7a2293ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00aedf6cb2baad36ULL, 0x0003b54c297ac445ULL,
+                           0x0041af2c0846b67bULL, 0x0051330131434314ULL,
+                           0x009dfb5fccaa5f8bULL, 0x00fb2949ba366676ULL,
+                           0x00cf56075cb83f19ULL, 0x008840b207320315ULL)},
+            {FIELD_LITERAL(0x00451b38075dcd16ULL, 0x0047a83d5356291cULL,
+                           0x002ea1d2b67a1d0bULL, 0x00175d9fa2ea9be1ULL,
+                           0x00bab294e0a946baULL, 0x00f1df0bf22d8285ULL,
+                           0x008990d0ca89701eULL, 0x0067b7b204c0aba0ULL)},
+            {FIELD_LITERAL(0x001c484ce13414b8ULL, 0x006bfd020334c792ULL,
+                           0x000a697f1b7f1569ULL, 0x00c8be6be0f7cf88ULL,
+                           0x003225427613937cULL, 0x001e49ddcd9b5193ULL,
+                           0x005cc933400ab683ULL, 0x00937c21f00de22bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00c32989c18eb20cULL, 0x0051776e118e9466ULL,
+                           0x0008f2bf30d40b83ULL, 0x001bd939cb659c7eULL,
+                           0x0093a560e6d56f67ULL, 0x003acfc5353151baULL,
+                           0x008af034fbe10ee0ULL, 0x003385621de7311bULL)},
+            {FIELD_LITERAL(0x0010bd0ca8b347f6ULL, 0x0064157587b4b481ULL,
+                           0x00721529f7bd6d23ULL, 0x006024ce12dd989aULL,
+                           0x00982dbc39e13be6ULL, 0x00ca6a9f4334451cULL,
+                           0x00c5be795bf811d9ULL, 0x00108c41119de18fULL)},
+            {FIELD_LITERAL(0x00b5fc70f4244381ULL, 0x0037be4169f156ebULL,
+                           0x006cbb67f8c96314ULL, 0x00ff50ec8bc0a080ULL,
+                           0x00188bd469a72c36ULL, 0x00a9308ea068950cULL,
+                           0x00cfcbc72f7eae4bULL, 0x00ad2f357727ed6bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b89548b3ab4978ULL, 0x00bf4b91a4d5c548ULL,
+                           0x005d068d36d74af2ULL, 0x002426e4abb453f0ULL,
+                           0x00cf2b2c7131dbbbULL, 0x00c9bdcad60c1619ULL,
+                           0x0016ee7234946d72ULL, 0x00de76941ea0eaedULL)},
+            {FIELD_LITERAL(0x0004e8fb126cd324ULL, 0x00ab92bad28dedc0ULL,
+                           0x002348128775915aULL, 0x001f063455a8ed45ULL,
+                           0x00987fc71dfddc8aULL, 0x0033bda3df4b2045ULL,
+                           0x0066982839e90e62ULL, 0x00c4f547b032bc7cULL)},
+            {FIELD_LITERAL(0x00ff1f964d74ca95ULL, 0x00b511993270d3bbULL,
+                           0x00131414da475946ULL, 0x00716878b2d063bfULL,
+                           0x00ddf8a9a36a1f98ULL, 0x00d66a887c660130ULL,
+                           0x00e59de0123da51eULL, 0x009b82edbc829f06ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0064f2ff99afd39aULL, 0x003664c0eeb11c47ULL,
+                           0x0006768f50bfecf7ULL, 0x00aee3ff68c4041dULL,
+                           0x008fc48da134cc6aULL, 0x008a3bd0c6b1f3e3ULL,
+                           0x006285c91f9873c5ULL, 0x00f220d805448fdeULL)},
+            {FIELD_LITERAL(0x0081bd9c9f429bd3ULL, 0x00b860d6bf05c8a3ULL,
+                           0x000f4d08bfb29be8ULL, 0x003f132bc8dcdbd4ULL,
+                           0x00915ce6756da5b7ULL, 0x004d623a1314c6d6ULL,
+                           0x007dbf2798c37353ULL, 0x009867706da67724ULL)},
+            {FIELD_LITERAL(0x00aad1a275a19247ULL, 0x008f1aec774fd7dbULL,
+                           0x0066aa645514ef4aULL, 0x00be3885e7332eb1ULL,
+                           0x005a3d490a9ead70ULL, 0x001afc3b533eff4eULL,
+                           0x006f1a4e36c1363eULL, 0x0015641ceb6279a6ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d6ffd27ba7936cULL, 0x00379895e4d50362ULL,
+                           0x00b465fa26b877deULL, 0x00d4485630bf8edbULL,
+                           0x00f9b3464225c3ebULL, 0x00641dc0c2e6dac8ULL,
+                           0x00c2a349c79ed2feULL, 0x002885e2516ab763ULL)},
+            {FIELD_LITERAL(0x00b5e65fae6917c6ULL, 0x00f2f123de8f63f8ULL,
+                           0x00cf21ae24d989ceULL, 0x00f322dabf8644a3ULL,
+                           0x001b0ea15e6bd6c9ULL, 0x0078eb90080ad6efULL,
+                           0x001745a908f43613ULL, 0x00fc9e841eb729f5ULL)},
+            {FIELD_LITERAL(0x00df02ab79cb1b42ULL, 0x00562da10dd4e537ULL,
+                           0x0065a7201cc01553ULL, 0x004b1186c1568748ULL,
+                           0x00ca85a9c0f8c9e1ULL, 0x006626b5e9194f25ULL,
+                           0x00f6a403d0306c42ULL, 0x00706b2e9eec68adULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b4bd1d4c011502ULL, 0x0023d85a6c2f5502ULL,
+                           0x00b7fb07a4031836ULL, 0x00747ee3f4cde602ULL,
+                           0x003e0ca3a1376f93ULL, 0x00836822ef7b87c6ULL,
+                           0x00454e577bd90e87ULL, 0x005e69826c0f18c5ULL)},
+            {FIELD_LITERAL(0x009e6c425c9eefd2ULL, 0x0085f2346860dab6ULL,
+                           0x001585574c80d186ULL, 0x00afbb39f9c3e691ULL,
+                           0x00951d05aefff6fbULL, 0x0090393f83fb99ceULL,
+                           0x00e46bd8e823d258ULL, 0x002107d6ec0530e6ULL)},
+            {FIELD_LITERAL(0x00a012d13bf3059dULL, 0x00ac6fd6fec83d4bULL,
+                           0x00208f1adb8c991dULL, 0x00abe42a10ada39eULL,
+                           0x00f287e4b1ee5b15ULL, 0x00af278230bbc937ULL,
+                           0x00f85c0428476e9eULL, 0x0088ca4bc505d55dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006e51af15c87ca0ULL, 0x004107a21c9de7f1ULL,
+                           0x0080ac9ebe7585d8ULL, 0x00c2b070c4e54a89ULL,
+                           0x0067794e8c20dd82ULL, 0x006e313f1e858c53ULL,
+                           0x00f95cd3d3671083ULL, 0x000f12a5bb13ef16ULL)},
+            {FIELD_LITERAL(0x00448e8a61b44aadULL, 0x00b9e94e70b4d04dULL,
+                           0x00e9869f8820c0ccULL, 0x000461522728d464ULL,
+                           0x0031b2f86837d830ULL, 0x002cf509e61b7e9eULL,
+                           0x009084617e483795ULL, 0x009fc0c754f5b176ULL)},
+            {FIELD_LITERAL(0x0081c5c9ef9425fdULL, 0x004a28c2a4d49773ULL,
+                           0x008b44fcba6516f0ULL, 0x00f6d44cf6db8f6bULL,
+                           0x00e6d9b5d69e3171ULL, 0x00a997f71b35425dULL,
+                           0x0018ace519d30066ULL, 0x00ee782874898283ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0051eec8a9fd122bULL, 0x00ce266802debb17ULL,
+                           0x00a1edd942067810ULL, 0x00af84d3432f4754ULL,
+                           0x00b258851e485c3eULL, 0x007f165ce5aa47dfULL,
+                           0x00f90a21ac93143fULL, 0x003472dc0df342efULL)},
+            {FIELD_LITERAL(0x00e5fd55e1cf5028ULL, 0x00b9d2eab728dac1ULL,
+                           0x00424a367e065995ULL, 0x00b8640f2ca4509eULL,
+                           0x0095387e39dd2748ULL, 0x00db013d2fed6805ULL,
+                           0x00218bfcc88d42a8ULL, 0x0043ebbe09f136d1ULL)},
+            {FIELD_LITERAL(0x004f01eb9fca71f7ULL, 0x00944c7dd1392c42ULL,
+                           0x00cfbfbe00b679a9ULL, 0x00f16ff197f87af7ULL,
+                           0x00a62629e700b971ULL, 0x006ba88cc2c94826ULL,
+                           0x004a62cb8ffc408bULL, 0x004589e144d66ebbULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00c78942f5e52204ULL, 0x000dd4655bb16354ULL,
+                           0x008441e12f8f2be3ULL, 0x002667a733562b68ULL,
+                           0x005ddcf8a52581fdULL, 0x00f18906e4e5884eULL,
+                           0x000cda517c386f1bULL, 0x006b77b4fb9fccabULL)},
+            {FIELD_LITERAL(0x00be1243b4e04ffdULL, 0x00c727daf182c3f4ULL,
+                           0x00e8f7523efaacfbULL, 0x00da7d7f633c7c04ULL,
+                           0x000a0231bd88f3b3ULL, 0x00f17ac3c4b7d376ULL,
+                           0x007649c956d7736aULL, 0x00eaacafd584013fULL)},
+            {FIELD_LITERAL(0x009af4345ea30de5ULL, 0x002f0e57574ee05aULL,
+                           0x00dadb3a601a186bULL, 0x00bae1bb2aaf5c78ULL,
+                           0x00141e5888a9c46dULL, 0x0099284aa20463aeULL,
+                           0x007f5ce039050b8aULL, 0x008b4d639841e506ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0032b6b93dcbc138ULL, 0x0096dd25fb18f8fbULL,
+                           0x006c24ff9eda7cd9ULL, 0x007eeb3a941f0324ULL,
+                           0x007ea75af5acc73dULL, 0x00d49b2fcd5816acULL,
+                           0x002044e9ddfc4e7bULL, 0x00b17ea2255629abULL)},
+            {FIELD_LITERAL(0x0055fac16e4618ddULL, 0x007367e668b56310ULL,
+                           0x00f6ad55ac415636ULL, 0x0083aea0cd8a6d42ULL,
+                           0x00be932d3cea5282ULL, 0x00302d73dc93095aULL,
+                           0x00f887499a26573bULL, 0x004fd7a5d87fd581ULL)},
+            {FIELD_LITERAL(0x0008a919a9980b9dULL, 0x007e84dad0722537ULL,
+                           0x00fb58563438e85fULL, 0x00f80216a5195914ULL,
+                           0x005f180fe67d99eaULL, 0x007a23aa6013d1aeULL,
+                           0x0049477849d77387ULL, 0x00541d0aff9df6d8ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005d499c26c4b106ULL, 0x0016900292b46354ULL,
+                           0x00fefe63ca775903ULL, 0x00c676e5fa6024b2ULL,
+                           0x00c3f16b4c030773ULL, 0x0002e974edbe78afULL,
+                           0x00c6778b9b003316ULL, 0x00a225754c6cf42aULL)},
+            {FIELD_LITERAL(0x00ead5509ceaab93ULL, 0x003579eb718e8d20ULL,
+                           0x004009d8a2036fe7ULL, 0x00c8d6a32b10e4c1ULL,
+                           0x002fbe243f56ad36ULL, 0x009e8cad26b28d09ULL,
+                           0x009dd77b41dea9daULL, 0x00034472b652f67fULL)},
+            {FIELD_LITERAL(0x001b7c8da5f42cafULL, 0x006d007460cf9b94ULL,
+                           0x00287054aec1da12ULL, 0x001d49c7d5273d89ULL,
+                           0x00584bdfa865ccddULL, 0x0037de4701ed4081ULL,
+                           0x0086f52fec624fafULL, 0x003924ecf51a07dcULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005c8e6d07e1edbdULL, 0x005ec4435ea857a0ULL,
+                           0x00953cf10f240c07ULL, 0x00bdf1cf42c16cd5ULL,
+                           0x00bd83965b3cddf2ULL, 0x00f791058cc0ce4fULL,
+                           0x006f0961726193f8ULL, 0x002c5d90f53b6e8eULL)},
+            {FIELD_LITERAL(0x00ebd9638efadf53ULL, 0x00f1452a2b304911ULL,
+                           0x002d568a871a1f83ULL, 0x00fd808bc75381c3ULL,
+                           0x00a5c26685e77c58ULL, 0x00a0a75d13945744ULL,
+                           0x00610f327efe101aULL, 0x009cac92cbd5cd03ULL)},
+            {FIELD_LITERAL(0x001ed1148e5cdd65ULL, 0x001fb962c59a8739ULL,
+                           0x00dd047a1062192cULL, 0x007f169c88c91155ULL,
+                           0x0075d691856fbbbaULL, 0x00919018857365d2ULL,
+                           0x00df990c7c7c3cebULL, 0x00f7f6751fc34b85ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x008ef9542ef34234ULL, 0x00d77fb1192f55a8ULL,
+                           0x002f02531c2c4cadULL, 0x0066f50d97c90774ULL,
+                           0x00c8a8aa59f1dcf6ULL, 0x0037449f345b6e6cULL,
+                           0x006d3adba75731faULL, 0x00d5f6d58b2c3b47ULL)},
+            {FIELD_LITERAL(0x00fd17ad2ba1dd7dULL, 0x005f05715d1afee3ULL,
+                           0x0057fd5cf38f0830ULL, 0x008307c4ea864e47ULL,
+                           0x00fb6d3f07f2f0e7ULL, 0x0067c115f0e47963ULL,
+                           0x00fc39d87690dae2ULL, 0x00f7bafca3db982eULL)},
+            {FIELD_LITERAL(0x00af803161af792cULL, 0x00d927f2e67bd292ULL,
+                           0x008909d537bd711bULL, 0x0034f3214451a324ULL,
+                           0x002fa677fff3ed28ULL, 0x00f1ca9cf4e1cbfbULL,
+                           0x00df23d66330c574ULL, 0x005135891dfbf078ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00702b67be52c0e1ULL, 0x00a32b5a56c6eaeeULL,
+                           0x00654f432770c18fULL, 0x00483ee0fec97375ULL,
+                           0x00d95f80df653ee0ULL, 0x009c7fccbabeee4dULL,
+                           0x006f840ca24fadaaULL, 0x00a1c36c9c4d807eULL)},
+            {FIELD_LITERAL(0x009f4c12c41d0dd6ULL, 0x009d298c53a8359aULL,
+                           0x006c94570f3660a6ULL, 0x00979df4b00eacbbULL,
+                           0x0096d204664c61e9ULL, 0x00675bfcba833d17ULL,
+                           0x0016d942608663a1ULL, 0x005f914a9c26161dULL)},
+            {FIELD_LITERAL(0x0060330916f26a88ULL, 0x00908799518886d8ULL,
+                           0x00a26682b15440e2ULL, 0x00f2b34238b39e5fULL,
+                           0x00bda78a61748c53ULL, 0x003dff99e39522e8ULL,
+                           0x00d0b0ac60c8aaa4ULL, 0x000401335bc00e76ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001ab898621187ccULL, 0x00b44511e6a703e8ULL,
+                           0x00818d08fde6c7a2ULL, 0x0008226083e4d254ULL,
+                           0x0041516eecedaba2ULL, 0x00bf8b28311fbe7cULL,
+                           0x004c5d943920c4ffULL, 0x0031409924be7e4dULL)},
+            {FIELD_LITERAL(0x00b98459d83aa614ULL, 0x00476006bfe2b0edULL,
+                           0x00bcdd0fc0e54ca3ULL, 0x0097eb3aec3b335cULL,
+                           0x00829d0ecbadcd82ULL, 0x0022b1ab73080a9aULL,
+                           0x003d733e1246fa17ULL, 0x0058d851bd519d68ULL)},
+            {FIELD_LITERAL(0x0031934b3b7f4626ULL, 0x009c3c1513f6c985ULL,
+                           0x00086ebf7593d958ULL, 0x009c0cf0b92d52c4ULL,
+                           0x00e45b1553825f1cULL, 0x000f84a66e1748baULL,
+                           0x00ac30bed48470fbULL, 0x00f1771aaa137ee8ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0060c94116b76952ULL, 0x0060796e925c06feULL,
+                           0x00da6d86f4660b94ULL, 0x00a9e950651fb3d1ULL,
+                           0x002d0462ef6ec74cULL, 0x00e4719f396e9cb9ULL,
+                           0x00ca8c73b445d38dULL, 0x005f7cc28493562cULL)},
+            {FIELD_LITERAL(0x00f9c22629925e32ULL, 0x00f16803333527d9ULL,
+                           0x00b1d9846e9a58ccULL, 0x0047e2a7bce5caa6ULL,
+                           0x009209d44fd5b976ULL, 0x00a9b7d43b12f1acULL,
+                           0x002ca208c2bd2c97ULL, 0x001d2a43e8194440ULL)},
+            {FIELD_LITERAL(0x0012697ce0ab195bULL, 0x00c45f7dc3e8499dULL,
+                           0x00adbed872dbe06dULL, 0x00770b075114a38aULL,
+                           0x0039735337d89f6cULL, 0x0025b681dca3dab1ULL,
+                           0x006caaa98150671aULL, 0x00bfb2eb068c2934ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f77489badc9fb4ULL, 0x006e4db3b382cf6eULL,
+                           0x00c1952c5c3f700bULL, 0x00b7c3917485551fULL,
+                           0x0088e0475e98478cULL, 0x00d44d83833a3506ULL,
+                           0x00133b202a04e592ULL, 0x007c79bb55a1fc9eULL)},
+            {FIELD_LITERAL(0x008d6dd90be6dddeULL, 0x000ed1f17584c04dULL,
+                           0x00eb8a81197ef815ULL, 0x0099c2fcb8ce8272ULL,
+                           0x00f42dae55d7a9fdULL, 0x00ded9aa3589a301ULL,
+                           0x0049562a690d6363ULL, 0x007fddf633543036ULL)},
+            {FIELD_LITERAL(0x0087b8644d793befULL, 0x0087b8d228e13ebcULL,
+                           0x00c9471a55d3a1caULL, 0x00f7693438daefe4ULL,
+                           0x00eabf5c94a18951ULL, 0x0087339ee28f5e8bULL,
+                           0x00995951bc50c3d8ULL, 0x0020a4d768995d7fULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00c695b7eee901e3ULL, 0x0098f2430b3e6b5aULL,
+                           0x00308302566fbab2ULL, 0x008cdbf0bdc98b21ULL,
+                           0x00e156ace02c660cULL, 0x0047c7cc27ae805bULL,
+                           0x00ec703d8db5f8ebULL, 0x000a52e723e513f6ULL)},
+            {FIELD_LITERAL(0x005a14e819ba55beULL, 0x00928aaf174f0f5dULL,
+                           0x00122182a6ea634eULL, 0x000dabf659b61348ULL,
+                           0x00910426e4a20254ULL, 0x006fa404e059d49aULL,
+                           0x00abfb50d15e68dcULL, 0x00843d81e53b78c2ULL)},
+            {FIELD_LITERAL(0x0081ee80d7c34541ULL, 0x0070048c09dc0668ULL,
+                           0x0084c2ac42266908ULL, 0x00d65698b0b881ffULL,
+                           0x008906618f432687ULL, 0x00ab094884a76ddfULL,
+                           0x00c96c4fcc89f3beULL, 0x001941c7ae2382b6ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001a68fcf7d225ceULL, 0x00b1621091f983d9ULL,
+                           0x001801f98f4d995dULL, 0x005a3a13acd65ca3ULL,
+                           0x00ea07b30007e5c7ULL, 0x002df8e39a5674feULL,
+                           0x00c9c967445eba8dULL, 0x006417b7a5b63080ULL)},
+            {FIELD_LITERAL(0x001cc3081c706d22ULL, 0x00ffb50a2fab605bULL,
+                           0x00aea29015876fa9ULL, 0x0025458c6c9b8ce0ULL,
+                           0x00f589a2c8bdebc7ULL, 0x00c055dc05447adeULL,
+                           0x003fbc95288457b5ULL, 0x00795500042eb70dULL)},
+            {FIELD_LITERAL(0x00293b5f93961dd7ULL, 0x0030fc1ba2faa7daULL,
+                           0x00e2dbf20b8162eeULL, 0x002155db081ee4a3ULL,
+                           0x009b2f1aaea81650ULL, 0x0036ffe2cb46e42cULL,
+                           0x001f3b9624e4065bULL, 0x00862ce658779888ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00c6900a09b96108ULL, 0x0004fd09ee920e2cULL,
+                           0x00ab4e6eff8f85ddULL, 0x0037f7d1f5931b61ULL,
+                           0x00acf6b6d1a056e9ULL, 0x00a2e005feaf12b6ULL,
+                           0x00e46f77c2fc1405ULL, 0x0035a71b19785c67ULL)},
+            {FIELD_LITERAL(0x003f56460e28a827ULL, 0x0013ed9a1f496d26ULL,
+                           0x009d6b3b63b6218bULL, 0x00252548053d58f7ULL,
+                           0x00d78ebbc1529b41ULL, 0x00c050c2aa9a5e89ULL,
+                           0x00e7696f35e3e3f5ULL, 0x00e06b85d1217668ULL)},
+            {FIELD_LITERAL(0x004b7b874b7281adULL, 0x00a8c6f595d36c98ULL,
+                           0x0062b95b4c774c85ULL, 0x0069eb3b803cd380ULL,
+                           0x00957f7de793a433ULL, 0x0000ed2439de8880ULL,
+                           0x0002a8f7a480b3eeULL, 0x00a91f82844b1129ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001c17c653686803ULL, 0x0007427440a99a7dULL,
+                           0x00f17de7c756e599ULL, 0x00833953db78ce42ULL,
+                           0x00fdffbca55f1985ULL, 0x00cd6324627baa91ULL,
+                           0x00a3d66347bb8d21ULL, 0x006df855ab07cc6bULL)},
+            {FIELD_LITERAL(0x00797e23dd26302cULL, 0x00b0aa6b43fbb374ULL,
+                           0x003c6e5be2dee3c8ULL, 0x00d1607fdcb421e8ULL,
+                           0x00aaf248a099921cULL, 0x00b662eee136fb45ULL,
+                           0x006d29a688c0d37aULL, 0x007ec153eaf164b3ULL)},
+            {FIELD_LITERAL(0x00ecbb4beae030f8ULL, 0x009dada5c16361beULL,
+                           0x0029544b26c78873ULL, 0x007bbdd94adc374fULL,
+                           0x0003546c7dee254cULL, 0x00cb37f4256a934cULL,
+                           0x00906165f16cd5afULL, 0x007c7af8e6ef6f98ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005275944281dc44ULL, 0x00c98b02cbd33b6fULL,
+                           0x008809c9d6703a52ULL, 0x00cb5ba1a34e68ceULL,
+                           0x00b21feb2208b640ULL, 0x00a6bef455131db8ULL,
+                           0x00f4c6c1cc28d789ULL, 0x00fb94d9fd8a79c5ULL)},
+            {FIELD_LITERAL(0x009160f2c0caea0eULL, 0x0045efad1f330423ULL,
+                           0x00dc29b18520e014ULL, 0x004a35d2bff64ff5ULL,
+                           0x005053a91ff7d1d3ULL, 0x00ee2301839a82f5ULL,
+                           0x00f9fdf8481ce0b1ULL, 0x00776206448f55e5ULL)},
+            {FIELD_LITERAL(0x00be552fb4f36689ULL, 0x00de3d3f5f5988f9ULL,
+                           0x000977f7119c9494ULL, 0x003ad1c0e3d7f37fULL,
+                           0x0049b542b5b6ef8fULL, 0x00a6a7b9fdc65738ULL,
+                           0x00d5fa8103dbc4c2ULL, 0x00e6aa05f36514b6ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00e8b2c623b9caa9ULL, 0x00e3f43dfa801e92ULL,
+                           0x00ea9e69963ae1a4ULL, 0x0016587856197f9cULL,
+                           0x009500411cab9a0aULL, 0x0027bc406c44abc5ULL,
+                           0x0002295355e47f52ULL, 0x00dea8ccc26cf2a4ULL)},
+            {FIELD_LITERAL(0x0067bff7b19e5061ULL, 0x00b58a6b85ada742ULL,
+                           0x002268f42326b0cfULL, 0x007808edae4deae9ULL,
+                           0x002649fe403a2f78ULL, 0x00c00605e2e0d65eULL,
+                           0x0006495276bddfedULL, 0x005251633da34ddaULL)},
+            {FIELD_LITERAL(0x00081591c8dcd040ULL, 0x00cc0c7f29a96c94ULL,
+                           0x0003901586ebb043ULL, 0x003c307adc7a29bcULL,
+                           0x00d2293534be5cd1ULL, 0x00e6bc7f642a7275ULL,
+                           0x006364a19009f27fULL, 0x00c8d9bdab9b8e43ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0047ebed588bf495ULL, 0x00bec70fd9279f31ULL,
+                           0x00693298706789dbULL, 0x00f71a270f663df7ULL,
+                           0x00477105523b8132ULL, 0x00c4aab888f5a58dULL,
+                           0x0075652a44e02ecbULL, 0x00223c3ab9cab5b0ULL)},
+            {FIELD_LITERAL(0x00abb1fb6fe9d175ULL, 0x00f45f87f7d4c138ULL,
+                           0x000a639a63890894ULL, 0x00b7c2569e1c9712ULL,
+                           0x00e88b7554066967ULL, 0x00c71bae1f0e3944ULL,
+                           0x00b2ffe1d4fcd305ULL, 0x0077fb6ca5bec13cULL)},
+            {FIELD_LITERAL(0x0071c472e098faeaULL, 0x0005da49562f4aa4ULL,
+                           0x004659b697f231d4ULL, 0x0014e25069bda2f5ULL,
+                           0x00b0744b08614022ULL, 0x007388ec1a4102e3ULL,
+                           0x004c42f7ee155f82ULL, 0x0038af67e8e40042ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b7e748741eb98dULL, 0x00e6795f9bd4e203ULL,
+                           0x001c05cb28edf3deULL, 0x009718e04cf13d65ULL,
+                           0x00c4073d256afa3dULL, 0x00c4c8906d625874ULL,
+                           0x0076906660bbcf33ULL, 0x00d8bda589977f0dULL)},
+            {FIELD_LITERAL(0x00f59ac53a7583f5ULL, 0x00e48c153e784081ULL,
+                           0x00d0b779da397bdeULL, 0x0044298cd7e861adULL,
+                           0x006304fcc6c12084ULL, 0x00107caa88f53eccULL,
+                           0x007892ee6e50e04bULL, 0x001c6ee6ead2c6e8ULL)},
+            {FIELD_LITERAL(0x0061b4ad05a6323eULL, 0x0034158d9cae7f67ULL,
+                           0x00631ccf04f4350cULL, 0x00457deb494f930bULL,
+                           0x00d23e82334e9f50ULL, 0x0001c8fc1be6de61ULL,
+                           0x002196b5db60f78eULL, 0x001ea9505cf7a443ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006895b91a214ea3ULL, 0x00fddf78250baadeULL,
+                           0x00a03bc744e343b4ULL, 0x004bbb0c50494712ULL,
+                           0x00bba2b577770384ULL, 0x00fec28134dc3841ULL,
+                           0x00ae14efea32110dULL, 0x00048b980e04431dULL)},
+            {FIELD_LITERAL(0x007169b4bf50d25cULL, 0x00559df5e7efe4a1ULL,
+                           0x0075b4fe31811cecULL, 0x00553cd9a2c2b398ULL,
+                           0x004620a2d1cd4461ULL, 0x00d9667c25b1907bULL,
+                           0x007f7309f65a4926ULL, 0x000a04c4a4ab500dULL)},
+            {FIELD_LITERAL(0x008ed73c06da7828ULL, 0x00ef16f5ff45afd8ULL,
+                           0x00483e9e0c1171ecULL, 0x002f83983d0913f5ULL,
+                           0x007255401bec4a5aULL, 0x009ed5060dcf79b3ULL,
+                           0x00694559c37d9847ULL, 0x00b71777f0589ee0ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00b049b0e75ee2baULL, 0x0084b11f5aa83a2aULL,
+                           0x00c65047deb0e099ULL, 0x00f1c77927706531ULL,
+                           0x0006e97153e975aeULL, 0x002365a64513ed54ULL,
+                           0x0082584cb93ce7c1ULL, 0x00b5f73f2a697f8bULL)},
+            {FIELD_LITERAL(0x00f5833269a9918eULL, 0x00e395b46405228cULL,
+                           0x00a3fb2b39c3e290ULL, 0x00f6a234885597feULL,
+                           0x00e88f9699614763ULL, 0x002bccc971fc6c1fULL,
+                           0x0032676b31e85e7cULL, 0x00212af32e730df3ULL)},
+            {FIELD_LITERAL(0x006199dcc4b6a35bULL, 0x0011f5a609afb2b6ULL,
+                           0x0002ca1a6f0baae3ULL, 0x0003edb54bddfbf5ULL,
+                           0x00681314b75b6a63ULL, 0x00147c5b45ae5640ULL,
+                           0x00e3358dae119451ULL, 0x006a858208bf17c0ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f5bc4b22c59716ULL, 0x009ca80f54d8f1e0ULL,
+                           0x00d018ed3334830eULL, 0x00b4735c25d5f55dULL,
+                           0x009cd2ecd2b40252ULL, 0x008822c78a7625f3ULL,
+                           0x0074847f935cffd3ULL, 0x00b443e0215c38d4ULL)},
+            {FIELD_LITERAL(0x0025d92962cbfa39ULL, 0x00dffdcadbb39c50ULL,
+                           0x00b264d3612e17ddULL, 0x00d67b2d2d4c4af4ULL,
+                           0x00cb0c3b19d97ed5ULL, 0x0006e67ad89fad8bULL,
+                           0x00680add37a91e8dULL, 0x00edc092f2c9d1b3ULL)},
+            {FIELD_LITERAL(0x00f88418ae6c2d9fULL, 0x001386452449de9aULL,
+                           0x002c2d31acfbaccdULL, 0x001232b1101d64daULL,
+                           0x00fa2943be6d0c12ULL, 0x00d78745b3357cf5ULL,
+                           0x006c173b9780b2daULL, 0x004204bfb7e17e36ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005335849f039fa5ULL, 0x0000ae454db3cf6bULL,
+                           0x00bf6feb9f3826d1ULL, 0x0077faa5740a422cULL,
+                           0x00bf7e7ca4075469ULL, 0x00d273046dc791caULL,
+                           0x00cfe03f648135ecULL, 0x00df7add0dea8b32ULL)},
+            {FIELD_LITERAL(0x007bac7bc34a2058ULL, 0x00ded7e4ab869b64ULL,
+                           0x009165dde0feb261ULL, 0x00862f748d7580f0ULL,
+                           0x005a5f2f715b24f8ULL, 0x00c7a88834beb236ULL,
+                           0x000bcca933555cd2ULL, 0x0021fc04ebab1484ULL)},
+            {FIELD_LITERAL(0x0014247aab153890ULL, 0x00291fed450c12f7ULL,
+                           0x006b5bb98d94d1ceULL, 0x00591724079355bfULL,
+                           0x0097f78f91a8750bULL, 0x00c62ead2c2a5e62ULL,
+                           0x00825b1d4472372cULL, 0x00649c072c5b31e3ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00eb31971d1fe41bULL, 0x003df334284ddd32ULL,
+                           0x009aab1960ebe1f2ULL, 0x002845ba4452b7dbULL,
+                           0x00ab420812f16f79ULL, 0x00f88d5bdb0930f7ULL,
+                           0x00a22938e9d43affULL, 0x00d999acec1cdd70ULL)},
+            {FIELD_LITERAL(0x0042a9355004ce79ULL, 0x008a8b24f5674c2eULL,
+                           0x00121e995545174dULL, 0x00940a80a553a01eULL,
+                           0x0032fbebf51caa05ULL, 0x0007b630569b4ddaULL,
+                           0x0029fd7c6a7c113aULL, 0x001ec83096bbf1b5ULL)},
+            {FIELD_LITERAL(0x00d43efb0f287626ULL, 0x00b36279eddd8b76ULL,
+                           0x00858ac7acd2dc4bULL, 0x00017b84d5dd3768ULL,
+                           0x00caa1239bce1d28ULL, 0x0047f095f00b8d0dULL,
+                           0x00e6b3551c942f44ULL, 0x002bdceaf55eb50aULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00cd0f6d0ad1430fULL, 0x009255b5d62f7a3aULL,
+                           0x00b7b616a4c2ad92ULL, 0x0040b81d64931026ULL,
+                           0x00647a7a543f8862ULL, 0x00c75c829606be82ULL,
+                           0x00b3709d3be24d31ULL, 0x00a776075f152080ULL)},
+            {FIELD_LITERAL(0x0086d842e7519d04ULL, 0x00fedc52db732bfeULL,
+                           0x009be94b4fba7cdfULL, 0x00b041ed2c48be48ULL,
+                           0x002ea1ac08ff4b7dULL, 0x0073ef01b56eb6cfULL,
+                           0x0018619970984ab7ULL, 0x0059b22364974102ULL)},
+            {FIELD_LITERAL(0x00b0cf3134fcd2f2ULL, 0x00614d13f635c8d9ULL,
+                           0x00d17c1e9d8196a8ULL, 0x003a1b08d77f5d1aULL,
+                           0x00b07ed21748ae4bULL, 0x002854b49d80595cULL,
+                           0x004678474c62d7e1ULL, 0x00c547ec71bff49fULL)},
+        }}, {{
+            {FIELD_LITERAL(0x009a60888154e6c8ULL, 0x00b14d22f6c3bb68ULL,
+                           0x0031fee44604e5f4ULL, 0x00ad3e2cbbe19c4aULL,
+                           0x007bf8a6424e42b4ULL, 0x00151319729b91eaULL,
+                           0x007c5bd8d8e05adcULL, 0x002a88cc2f7a7483ULL)},
+            {FIELD_LITERAL(0x00333df2ffca994cULL, 0x00622c3c3d1350e9ULL,
+                           0x00a51bfc006cd97bULL, 0x00f30eb09340cde0ULL,
+                           0x0038feccf7646407ULL, 0x0084c94fbc6d841dULL,
+                           0x004bd40476adfd17ULL, 0x006396655709e609ULL)},
+            {FIELD_LITERAL(0x001bbd83a1ac7e2fULL, 0x00f97d8c561fdd5fULL,
+                           0x0056c0d4ab8cbfc2ULL, 0x008e5efa4ab427f4ULL,
+                           0x00630d362692f593ULL, 0x0005889c70fa1dadULL,
+                           0x00157ad8a5bdba1dULL, 0x005dd0285717bca1ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00374d7fb8f87abaULL, 0x00491c8876f5b2c7ULL,
+                           0x002218b025acb496ULL, 0x00f42db426c6a8abULL,
+                           0x002748a471d02b2fULL, 0x00e6e6d8193c3141ULL,
+                           0x0021255f0d7d1133ULL, 0x00769800fe7e6409ULL)},
+            {FIELD_LITERAL(0x005fd83764c04c45ULL, 0x00601900bd2ceae9ULL,
+                           0x000b2b5981d7eaa4ULL, 0x009642bf1e62b4d4ULL,
+                           0x00b9f174da77a182ULL, 0x00137d572035f7e9ULL,
+                           0x00935a026a50991fULL, 0x00371d7a548f8a2eULL)},
+            {FIELD_LITERAL(0x0034bcf59c679ca6ULL, 0x00d9649cd0ecdffeULL,
+                           0x0091653c50a63f5aULL, 0x004f5eac7cdfc077ULL,
+                           0x008730be513ef661ULL, 0x00f1392d7b4f7ba1ULL,
+                           0x0016f3fa7df94471ULL, 0x00041f3d53f0a2bbULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0012d872dbdd199cULL, 0x00b37177ee6df73eULL,
+                           0x00e640a67b50a816ULL, 0x00ba2b2b388a5aeeULL,
+                           0x00eec5d6432a6e6fULL, 0x00b21a256011c1a1ULL,
+                           0x00d48cbe5b4cb6caULL, 0x00165af091cef9caULL)},
+            {FIELD_LITERAL(0x0008a80ecb5fa104ULL, 0x001ff93503b4e712ULL,
+                           0x00ea2c72bec0b22fULL, 0x00c43bf2347edf7cULL,
+                           0x0024e3b9e37a1f33ULL, 0x00745b5cf7c07565ULL,
+                           0x00f744afc1c54dabULL, 0x0091658c531d28cdULL)},
+            {FIELD_LITERAL(0x003a9090edb84a27ULL, 0x003363436aa15765ULL,
+                           0x00d4eb680efdc5cbULL, 0x000a6e45b5ebeb4bULL,
+                           0x00693eef00807704ULL, 0x0011ca69354897e6ULL,
+                           0x00983c4c7a52b124ULL, 0x0034adc4c9af3c8bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006b166ce7ded3d6ULL, 0x0015182186536741ULL,
+                           0x002fa0afce15838aULL, 0x007824e7746445f6ULL,
+                           0x00452a912ccaca88ULL, 0x0020d229b283d671ULL,
+                           0x002d4797b86fbd90ULL, 0x00831875f7026570ULL)},
+            {FIELD_LITERAL(0x00367f20693db97cULL, 0x000084a8541f74b7ULL,
+                           0x00459597d9d4c871ULL, 0x00e3c6380f0d4270ULL,
+                           0x0089b29a1787de6cULL, 0x0056a929df6c056dULL,
+                           0x009effce14620c6fULL, 0x0059e0c8071ba52fULL)},
+            {FIELD_LITERAL(0x00ee3e571318a826ULL, 0x005bab4c442423cdULL,
+                           0x00737fba678779f1ULL, 0x000b516734909c28ULL,
+                           0x00020a0789658a98ULL, 0x00cc003914ba5ebbULL,
+                           0x00b4565923a37542ULL, 0x006a18d585a77208ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x009ed95ebf136a8dULL, 0x00e16a252a4f7760ULL,
+                           0x0095e809a7852013ULL, 0x00b6e182e3ffb812ULL,
+                           0x00c3581aae630b8dULL, 0x00a588ea1aec26b6ULL,
+                           0x00230c704b27727eULL, 0x00072d169772b0e7ULL)},
+            {FIELD_LITERAL(0x00941bc29cd11d2eULL, 0x00b8ac629de5d9e8ULL,
+                           0x00daad9f3e2159deULL, 0x00b6bd3b22c0622cULL,
+                           0x00d4c2978b803526ULL, 0x006c6ffd35574550ULL,
+                           0x00011a6af7cf500cULL, 0x00ae48f53aaf5090ULL)},
+            {FIELD_LITERAL(0x001b329fbdefefb1ULL, 0x00423ca1e2818dd4ULL,
+                           0x00daa9a3fd56077dULL, 0x0043da6b22f027caULL,
+                           0x006410047565d4a3ULL, 0x002b7e23c8702ff4ULL,
+                           0x00db6b89632bcd72ULL, 0x005be4f16dd396efULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005a8f4c6398512fULL, 0x00f78d5e82a69c24ULL,
+                           0x002cd426fb6f42edULL, 0x004ae26fc0f4bd4aULL,
+                           0x00f48de909f3f2e2ULL, 0x00c80836ca6ee6e4ULL,
+                           0x0006a51fb46d07b6ULL, 0x004c9498735fa27dULL)},
+            {FIELD_LITERAL(0x0025d40a1e64f4fdULL, 0x003950a4a3bacbabULL,
+                           0x000e14cae157e075ULL, 0x002acf42fa4cbac1ULL,
+                           0x0006dded1325e90cULL, 0x00fdbaada8db9878ULL,
+                           0x0071be9b563efe60ULL, 0x00bc2ea8daeb9a01ULL)},
+            {FIELD_LITERAL(0x00d87c34a72616f5ULL, 0x002e13d08c90699fULL,
+                           0x00b8a20f1d35bb9eULL, 0x00ba745593dce0abULL,
+                           0x0077d20569a2c1bcULL, 0x00aa5b2b7a4c4fb1ULL,
+                           0x003276325ce917b3ULL, 0x00137f4ed941b83fULL)},
+        }}, {{
+            {FIELD_LITERAL(0x008bf407119baf67ULL, 0x0057cf028a4564baULL,
+                           0x00543529d8bb01a1ULL, 0x00510b2e249772b7ULL,
+                           0x002fc3d0cfc9f537ULL, 0x007f5f9c2422e01eULL,
+                           0x0078d2f161addcaaULL, 0x00b6fd31e953bd30ULL)},
+            {FIELD_LITERAL(0x00961e44bdde7a1dULL, 0x007c4afd0bf31e87ULL,
+                           0x00b1595c822b7427ULL, 0x00ad8002eceed871ULL,
+                           0x00bf3e689994ee50ULL, 0x00bd731a825d590eULL,
+                           0x001cbe4c4ae3084eULL, 0x009267f9d5e39f5eULL)},
+            {FIELD_LITERAL(0x000db0226c44f7b3ULL, 0x002ab5f67f670fc3ULL,
+                           0x0039992fc4b95c81ULL, 0x0069af8acc381095ULL,
+                           0x002e8a9054989fa6ULL, 0x00888c6da4f9bf88ULL,
+                           0x004a69e63eb71726ULL, 0x006424c31cd6e628ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f718dfaaabcebaULL, 0x0070e3c2988b7a04ULL,
+                           0x00f67799da6de817ULL, 0x0027cbb11cbd6da3ULL,
+                           0x00a2a61b1cfa530cULL, 0x00afcf56185fd139ULL,
+                           0x00499dd16140e991ULL, 0x00238575264cfabbULL)},
+            {FIELD_LITERAL(0x00cd676fb68bf7c9ULL, 0x00eae79caa5e48b8ULL,
+                           0x00074b017fe05104ULL, 0x005b4b04c98a261dULL,
+                           0x006ad64cae2dc6c2ULL, 0x00774fa79e8bae61ULL,
+                           0x00b3caee99f38595ULL, 0x0043a231b5f49978ULL)},
+            {FIELD_LITERAL(0x0062fa9692ecf5dcULL, 0x008b853a3eb8461fULL,
+                           0x0014147115ef0a26ULL, 0x00a6d8cfca2079dcULL,
+                           0x00eada40f37af0aaULL, 0x0018e625b10be707ULL,
+                           0x001357856b49ac02ULL, 0x000018b70cb341e3ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00fddf8b008e6d0fULL, 0x0025beb607dff394ULL,
+                           0x00f7fd89124aaecbULL, 0x00b622f4d390f849ULL,
+                           0x00d1b35dedd43d68ULL, 0x003e40e6e43ddce6ULL,
+                           0x004e93af773456e7ULL, 0x001663933c29df5dULL)},
+            {FIELD_LITERAL(0x008ec439852ea337ULL, 0x0008fee44df49643ULL,
+                           0x008c917e0810ea48ULL, 0x005333134395bfedULL,
+                           0x00592907860ca764ULL, 0x00b4faa26f98f514ULL,
+                           0x008676e4f6390a0aULL, 0x0025c3918e6840d5ULL)},
+            {FIELD_LITERAL(0x002b5d2985cb3252ULL, 0x006449fcf2d103f3ULL,
+                           0x003689f23f12a00aULL, 0x006db24b4fba0a23ULL,
+                           0x00bd2104de9a49ceULL, 0x00d6d9625c75087dULL,
+                           0x007cf6c33827fef4ULL, 0x002f9b2af5aee968ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x009713c0b42b28bdULL, 0x00b21a05d3fc87e2ULL,
+                           0x003d73286b8bf6e4ULL, 0x001a5752a63c78c5ULL,
+                           0x0024607e9ea99c4cULL, 0x00eb95af65247dd0ULL,
+                           0x0028d46f5f5a2831ULL, 0x00b49fe7caf6dc01ULL)},
+            {FIELD_LITERAL(0x00caa8758c98122dULL, 0x00ab0392b0f6cbc6ULL,
+                           0x002f7dcfa16f0cf6ULL, 0x00df5c330260326aULL,
+                           0x0029f37cdb825b57ULL, 0x00a9fc371323b79aULL,
+                           0x0015761fe7b99419ULL, 0x00604e7248235580ULL)},
+            {FIELD_LITERAL(0x00af7a24fb59ac44ULL, 0x00da2d2c53abdbc3ULL,
+                           0x002ab9e272f80d72ULL, 0x004c67b76c951e1aULL,
+                           0x00ba00c71f3c8359ULL, 0x0085cb79f2db5b6eULL,
+                           0x000349b470e07283ULL, 0x00432795652b90b2ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0033c482a7075a6eULL, 0x00fa9536e2a9cacdULL,
+                           0x0083869b6035d39cULL, 0x00ca53850b2469f7ULL,
+                           0x0064f5dc7166a5d6ULL, 0x00df51bbf97ed12aULL,
+                           0x008f2be16dd5922fULL, 0x00b508673156a575ULL)},
+            {FIELD_LITERAL(0x0063c3e26e4c16ebULL, 0x0064800d99b40ef1ULL,
+                           0x008d562cd09242a9ULL, 0x00fd5f358fba6d67ULL,
+                           0x00b8549cba4f025dULL, 0x00872ca790a352ccULL,
+                           0x0038763677a34f3bULL, 0x00c0ea2f25e0d7ffULL)},
+            {FIELD_LITERAL(0x00b91fa03b4ab967ULL, 0x00d3aa27ca59a06fULL,
+                           0x00233cf6981d8157ULL, 0x009e5608c0198e13ULL,
+                           0x006daefb79a343b9ULL, 0x0087f8c6342da29dULL,
+                           0x0068f99f83925ec8ULL, 0x0094db2ba17b8341ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00353bb224ac2e28ULL, 0x0058692c751d2904ULL,
+                           0x00abde6c63b2113cULL, 0x0061983685916207ULL,
+                           0x004901b7afa38e77ULL, 0x00ff613765129887ULL,
+                           0x000d40eb9455c322ULL, 0x00e0ec14be3b7fd6ULL)},
+            {FIELD_LITERAL(0x00c6d2e70d348a6bULL, 0x00c6699b54f2a7a3ULL,
+                           0x0030b0e6d13f43caULL, 0x008699f34dfce7ebULL,
+                           0x00aee244326805d9ULL, 0x00152fb0e04aa865ULL,
+                           0x00c760910f045023ULL, 0x0001fe66dbca45d1ULL)},
+            {FIELD_LITERAL(0x005ad2e0d2e79314ULL, 0x000ee4a835babd89ULL,
+                           0x0093c2830d8e906aULL, 0x00c3386f6687cd5aULL,
+                           0x0072144cea3b77b0ULL, 0x00e02fc023193c98ULL,
+                           0x00dc1bfb5000ee86ULL, 0x002700d08fd014bcULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00454b0e46141a26ULL, 0x008f07ab545335c8ULL,
+                           0x0028fb3eb12dbf2fULL, 0x000fb424675dc240ULL,
+                           0x00842665a9c63a0dULL, 0x0051ce52d7bcd411ULL,
+                           0x001fe85563f3bca8ULL, 0x00ee8c87a8cc285eULL)},
+            {FIELD_LITERAL(0x00a5a19e1ad182b1ULL, 0x0039aa60caa6e8e9ULL,
+                           0x00be90760e024c14ULL, 0x00b1a29727010206ULL,
+                           0x00ffa2ff9dd7d536ULL, 0x00887d3ff284eadaULL,
+                           0x00647fd09b072f75ULL, 0x0069cc7f0b5ac553ULL)},
+            {FIELD_LITERAL(0x00ee4e32aa7e4d6aULL, 0x006266b65f74b98dULL,
+                           0x0038e1815078645bULL, 0x00e378cf14b80eabULL,
+                           0x0034074fb3a79b78ULL, 0x009aef9ef33b43c2ULL,
+                           0x00f0b6af36143f7dULL, 0x000e1e39d69fa011ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x000389ae61e9ab0dULL, 0x000ab6193e58ea83ULL,
+                           0x003c838a477f9db9ULL, 0x00f796526d34eef7ULL,
+                           0x00803167ac94a66bULL, 0x004c09a5ce6997feULL,
+                           0x0031764dd7206f1eULL, 0x009367e731d23287ULL)},
+            {FIELD_LITERAL(0x0059d537a3a4d7f5ULL, 0x0011b8e8a51a0a3aULL,
+                           0x00579b73163e22ffULL, 0x007d029bc427c1d3ULL,
+                           0x0055a5354b925b1aULL, 0x001049ca044f66a5ULL,
+                           0x006c91dc71751558ULL, 0x00ec85b777043538ULL)},
+            {FIELD_LITERAL(0x00de8227dbfbf1e0ULL, 0x00c4f775853ad8edULL,
+                           0x00b5ac1fc2895cdaULL, 0x00523b903f8da938ULL,
+                           0x00b13515461829c1ULL, 0x0093c8e34bb7150fULL,
+                           0x00ff9e377023f9d4ULL, 0x00b127fad8f321f9ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00485dfba0c96b28ULL, 0x008aa7e862017f16ULL,
+                           0x00a284294105a530ULL, 0x00c6807ef5d98b38ULL,
+                           0x009d10418223825bULL, 0x002df5d40ea1cc0cULL,
+                           0x0090ca35f5249e98ULL, 0x005eeb185e59fceaULL)},
+            {FIELD_LITERAL(0x006ad9ff29b62569ULL, 0x00426d7310601a62ULL,
+                           0x0037276f80f5c2a2ULL, 0x00404a0d95b42f21ULL,
+                           0x000de46d6e3cd532ULL, 0x000bf838760fb0ebULL,
+                           0x0028139c486bbdc8ULL, 0x00e03001562d4001ULL)},
+            {FIELD_LITERAL(0x000e608b113b039eULL, 0x00ef3de159883e91ULL,
+                           0x00f3ff865111c40fULL, 0x00029b6ec87b7f7fULL,
+                           0x00d916777ebf5405ULL, 0x001ba20224491663ULL,
+                           0x00f297759bc8eb21ULL, 0x00f8dfbc2cadd62bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00cb4267f7b15acdULL, 0x004266b03971fa21ULL,
+                           0x00983491cb4cab9cULL, 0x00520aeeba971335ULL,
+                           0x0024bdfa88dc923aULL, 0x009a9b73de7d782fULL,
+                           0x0026b70f0afd48bfULL, 0x0041b36a303963d2ULL)},
+            {FIELD_LITERAL(0x00c0839e695b0e23ULL, 0x0099f3c9c6752cf0ULL,
+                           0x0076feb7fc1afa28ULL, 0x00670c452c3b16b1ULL,
+                           0x00beb5f95b043579ULL, 0x009608c74e9557bcULL,
+                           0x00f9b20f1b7925d5ULL, 0x000988375e56ec23ULL)},
+            {FIELD_LITERAL(0x0059b3e3aecfe0bbULL, 0x0031993d8fe95de0ULL,
+                           0x00f990e8f4fe4166ULL, 0x006cd8698588fab5ULL,
+                           0x00e2f5cb7357284bULL, 0x00ae2516667b3c35ULL,
+                           0x00de4cd5b16681a4ULL, 0x0017be2bc3905c64ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x009700e6e7a20b2fULL, 0x004b5928f8ecd04cULL,
+                           0x00abb32dd1621d23ULL, 0x002e21fe300a63b2ULL,
+                           0x008f28f1d4145e16ULL, 0x00ff526a7b3ec757ULL,
+                           0x004254507938e422ULL, 0x005c83ac4518bee1ULL)},
+            {FIELD_LITERAL(0x000d9ce3e553bc75ULL, 0x00fe6eb09011f7e0ULL,
+                           0x00bf187b29e10046ULL, 0x0016d1a41d5cea01ULL,
+                           0x00c5e4489f63101bULL, 0x006266d09624cf7cULL,
+                           0x0059b14d121d6935ULL, 0x0073b50a83cd6978ULL)},
+            {FIELD_LITERAL(0x00ac4f8f02ec807aULL, 0x0050c4939fc88b7dULL,
+                           0x007dbe3c0ba310f4ULL, 0x0075a2708fada011ULL,
+                           0x0021104b5b5c6987ULL, 0x0006474e8590e33dULL,
+                           0x00a23d0e0a52761fULL, 0x000ebfc23162ff7cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f9a1457289f735ULL, 0x00b5a35f505bac43ULL,
+                           0x00242330ee104d17ULL, 0x00d1d14439b45020ULL,
+                           0x000a693a8770dcf3ULL, 0x00bd0c16bf86f94dULL,
+                           0x00986c06e43b3f19ULL, 0x00e453731ca15efeULL)},
+            {FIELD_LITERAL(0x0023fd16b02c8a13ULL, 0x00169f6360eac320ULL,
+                           0x000de3acda8bfdbaULL, 0x0032a192597c816cULL,
+                           0x00dbfbfa5955b3c3ULL, 0x008982a3cd98bc41ULL,
+                           0x00d35d56d5280b09ULL, 0x00e0bda55f80d96aULL)},
+            {FIELD_LITERAL(0x0095b499193a514bULL, 0x00887a8d63f60f20ULL,
+                           0x00056d02054c3f67ULL, 0x0028027f0bdb204cULL,
+                           0x00ffb9e690059b79ULL, 0x00052699811f481bULL,
+                           0x0010e58cd9f8e094ULL, 0x009a28c59fda2384ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x002760a17b482dfaULL, 0x001d5eb699e37e1dULL,
+                           0x003d9904e3064892ULL, 0x00bf68db03af3e11ULL,
+                           0x00de5cf278ae45e3ULL, 0x0082d2291df0489cULL,
+                           0x00c3b40bd2e92829ULL, 0x002cdd862711da19ULL)},
+            {FIELD_LITERAL(0x00aeefd37e836779ULL, 0x00e95f078d163091ULL,
+                           0x001d81cff94ad39fULL, 0x001b285daad52d00ULL,
+                           0x008325ebc69bb3c5ULL, 0x00ce9fe9d97c9194ULL,
+                           0x00d352b840125f60ULL, 0x00c6ef0a50289310ULL)},
+            {FIELD_LITERAL(0x00463829b45dff46ULL, 0x00994921042d17a9ULL,
+                           0x007c07c6d235478aULL, 0x00958ba885163474ULL,
+                           0x001c656e2983ea14ULL, 0x001160811d909014ULL,
+                           0x00edea5ccabb98a1ULL, 0x00875bb914072bfeULL)},
+        }}, {{
+            {FIELD_LITERAL(0x002d064b2fda381fULL, 0x00ef523b2ee8308fULL,
+                           0x00cc5e2ad5fbbceaULL, 0x00c08573681b0211ULL,
+                           0x0035c5bc1e92dc40ULL, 0x000cef537e797910ULL,
+                           0x00ef7c01c5c9efeeULL, 0x00d63755a0062771ULL)},
+            {FIELD_LITERAL(0x00c945518c3b525cULL, 0x00dfc598c967661cULL,
+                           0x00144e2ff34b7f49ULL, 0x00ec4827a6c236bfULL,
+                           0x004d60efadb2b29bULL, 0x0051e8f3e3e8f497ULL,
+                           0x000fdfe31e86fe11ULL, 0x00a387e6ea01ac2fULL)},
+            {FIELD_LITERAL(0x00de265845b3cdbbULL, 0x00f23953f6c77785ULL,
+                           0x000213bd65f997e5ULL, 0x00415657397f6db7ULL,
+                           0x00378c6f65312c76ULL, 0x00f522d2db0d5909ULL,
+                           0x0006757151db4258ULL, 0x00ec22e7aea08373ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006760a9569cb446ULL, 0x00167ce6f0dd4a1eULL,
+                           0x006ccbe7f0576c6bULL, 0x003ec3889b9f38c8ULL,
+                           0x00a8e0658c393b72ULL, 0x0038cf3324e9e780ULL,
+                           0x00a1e3a0ba0e42dcULL, 0x00d92751661ff6b2ULL)},
+            {FIELD_LITERAL(0x002af0eac8633d51ULL, 0x006f55bcc72c169eULL,
+                           0x00bcb45bbdedb769ULL, 0x00ed28437a78a365ULL,
+                           0x00092730fb713e45ULL, 0x0024d2039f020f49ULL,
+                           0x00e562b8e752bd04ULL, 0x004c7811519f1869ULL)},
+            {FIELD_LITERAL(0x007ce0a040e4793aULL, 0x00529314d793d8d0ULL,
+                           0x00580673f39f1e33ULL, 0x00d9a6be5c9c983bULL,
+                           0x0059bd0bd88eca66ULL, 0x00a7781e2e79cd63ULL,
+                           0x00352590130319cbULL, 0x0042d678787d3f1dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006cd499881346c2ULL, 0x0054430d21587ec7ULL,
+                           0x009669f38fc5d57fULL, 0x00ecfc0f570c89ebULL,
+                           0x005b9cf12ca716efULL, 0x0041dd98a075298aULL,
+                           0x0027c18120080518ULL, 0x00639177ad0319afULL)},
+            {FIELD_LITERAL(0x0030799133336796ULL, 0x00030fd5ede8f27eULL,
+                           0x00b49a0b0888494eULL, 0x00b188d19604faf1ULL,
+                           0x005244791489abfbULL, 0x004f4c5629600a9eULL,
+                           0x00413d146e1f2c07ULL, 0x0055c15cc1412b8aULL)},
+            {FIELD_LITERAL(0x00bdac28c1622b72ULL, 0x003fb92837931c75ULL,
+                           0x00d3e80251ca85f1ULL, 0x00a4f152c12a6d2cULL,
+                           0x007f39aa9108f9bfULL, 0x00a4976469f466d4ULL,
+                           0x00fc643deeee6c25ULL, 0x00e95602fca1d3c0ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00a89f717d6c7323ULL, 0x00265648ad20d0c8ULL,
+                           0x003864d8deb8840fULL, 0x007dc0cb8e806441ULL,
+                           0x0059d681d4bb1fb0ULL, 0x00ef79c674216dfcULL,
+                           0x003d0772692e1946ULL, 0x0030bb5b5d2afd84ULL)},
+            {FIELD_LITERAL(0x00ffebd334506c21ULL, 0x00c102d4d746f40cULL,
+                           0x0047180ea01d04ebULL, 0x00c4fd78ec4439fbULL,
+                           0x00f803522fab1071ULL, 0x003a5da6c0d04123ULL,
+                           0x002948aa81f89097ULL, 0x00c89af82320c8ecULL)},
+            {FIELD_LITERAL(0x002e4553f053a217ULL, 0x00284b7e94cb1de2ULL,
+                           0x00f151b856a2bb1cULL, 0x00a445f40aefc1a4ULL,
+                           0x00d4265b6d38da96ULL, 0x002dc15f27b69e6dULL,
+                           0x009a8e82b0b34040ULL, 0x00d9239d2fd126bfULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00a65b2c7e601156ULL, 0x008154f70b12dc2eULL,
+                           0x0064dd254a2f5d34ULL, 0x00a61f4fd7f2ef2fULL,
+                           0x00fd0735c12ecaa3ULL, 0x00f717e7e4eb19eeULL,
+                           0x002e419429fe4924ULL, 0x008d32850824d5aeULL)},
+            {FIELD_LITERAL(0x00772453b69e6adcULL, 0x007391e110cd2ed0ULL,
+                           0x00074be4b7fe9b36ULL, 0x00a19b77eb0e6f8dULL,
+                           0x0035f495113bf39cULL, 0x00bd39cbc50edcd5ULL,
+                           0x00a3c52b0f4ae6edULL, 0x00e8f383d48b5846ULL)},
+            {FIELD_LITERAL(0x0068e2e3a320c877ULL, 0x007a9941c7b53462ULL,
+                           0x00e541ba1f80faf9ULL, 0x00fbbbe009c3ca1bULL,
+                           0x007d8fae2a79673dULL, 0x0035a6296f6d938aULL,
+                           0x0026b1457d87ea6fULL, 0x000306647cb33a25ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0045c34f68409c33ULL, 0x00e3c40dcf10cd9cULL,
+                           0x001b48bff072793dULL, 0x00d1c3e0009467c5ULL,
+                           0x00a409436d2d3cfaULL, 0x009e51f5e82bff6bULL,
+                           0x00cb099775ac4fc3ULL, 0x004b0784a35b7cbbULL)},
+            {FIELD_LITERAL(0x00246b725f2df5f0ULL, 0x00b5ef4452591cb9ULL,
+                           0x007775448abc4032ULL, 0x00e91d35847edc43ULL,
+                           0x00da3ae23e1c9234ULL, 0x00030b5225a34491ULL,
+                           0x003b292bef69f8c5ULL, 0x00524b5a4ad39817ULL)},
+            {FIELD_LITERAL(0x003285e9f6d6300aULL, 0x00d6b3912b672a10ULL,
+                           0x003499cc5dab1bbbULL, 0x00c979bb4e9dc427ULL,
+                           0x00d970aca6349178ULL, 0x00769324e61a036cULL,
+                           0x0022e313fac1dadcULL, 0x00c6c6e9d4111d0aULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0067dde673363a07ULL, 0x00827afccac5c5f5ULL,
+                           0x0058eb0bba40301bULL, 0x008fc89988b27983ULL,
+                           0x0048df7692194bf8ULL, 0x004ab39f2951d689ULL,
+                           0x00b6a12118472216ULL, 0x00cd3e1b80d4a33eULL)},
+            {FIELD_LITERAL(0x0074a890c9068126ULL, 0x00c45d8c161e7e9cULL,
+                           0x0064bb7cccfce643ULL, 0x003b5428be74464aULL,
+                           0x00a91d55b0454054ULL, 0x000752f3cd6b0b6eULL,
+                           0x0022fb979f3b3390ULL, 0x007ea6c2c434e230ULL)},
+            {FIELD_LITERAL(0x00d65200c014bbd8ULL, 0x007ea01143931dfaULL,
+                           0x0050fba280aaee6dULL, 0x000b6a86c8e843a6ULL,
+                           0x00c18d6e9211054bULL, 0x005b95f3d5d4fedaULL,
+                           0x00e8b3a36d79b153ULL, 0x0027d1150f621136ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00499e8b08c406fdULL, 0x009fd6b2b867119aULL,
+                           0x00e57d4714b1c5e4ULL, 0x00914b9602ed9f45ULL,
+                           0x006e68a0ee2ad8a9ULL, 0x0058df15c265066bULL,
+                           0x00f2077f5e5d965cULL, 0x008394b811a63350ULL)},
+            {FIELD_LITERAL(0x0073de6db602091cULL, 0x00691ef5c23a93edULL,
+                           0x0051f4f8841f4d80ULL, 0x0045d9bdb142be74ULL,
+                           0x0092727dc24bfbe8ULL, 0x006193614923c6f6ULL,
+                           0x0073db471855361dULL, 0x002db2b65022cfc8ULL)},
+            {FIELD_LITERAL(0x004a5797ff087a24ULL, 0x0070fad2eb1cde43ULL,
+                           0x0063728967aa39b9ULL, 0x0019429cb56a41d5ULL,
+                           0x000b06b4eaf02c61ULL, 0x00954e24e02bc3aaULL,
+                           0x001b255e8ee657c4ULL, 0x00d5803fa30d9002ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0043f7053dc00254ULL, 0x00d79fb366d9b95dULL,
+                           0x00fc588cb99caf23ULL, 0x006b3505d569f1aeULL,
+                           0x0078bf69c86b6972ULL, 0x0002950ffeda56efULL,
+                           0x00fa84630f616b3dULL, 0x000683a6b1272358ULL)},
+            {FIELD_LITERAL(0x0056dde8008c6d13ULL, 0x004ec764a0c7011dULL,
+                           0x00e0fc1388431192ULL, 0x000e81c17bc19727ULL,
+                           0x0079343cfc784bb7ULL, 0x00ab60e52f21c01bULL,
+                           0x004bcc3eff920b7fULL, 0x00113f841f094345ULL)},
+            {FIELD_LITERAL(0x00fef63508437028ULL, 0x00867b81acb9b715ULL,
+                           0x0033eb99f2545770ULL, 0x005af7379d56803cULL,
+                           0x00413e7f7d677d29ULL, 0x0067f7d84c9210b9ULL,
+                           0x00a4145cda9b673dULL, 0x0046d5a68c014e2eULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00ef25f5858709bdULL, 0x00eaaf9fadecb13aULL,
+                           0x00ef65ed755a942fULL, 0x00be9dd17e67cd37ULL,
+                           0x00520a938ac40e2bULL, 0x0071787fa185d8beULL,
+                           0x00ca45e57f2d1488ULL, 0x00e8af08cc2645acULL)},
+            {FIELD_LITERAL(0x005224ab8b33a5bdULL, 0x0041a86ab4a0f6ccULL,
+                           0x00d0123c4cd26be5ULL, 0x00976db3d2d36194ULL,
+                           0x00ada427c4ee9cbeULL, 0x00681a5b19ce82b9ULL,
+                           0x00faef1e1f90075bULL, 0x0092916176a0842aULL)},
+            {FIELD_LITERAL(0x00cf0a5ac8a8cdf2ULL, 0x00873a5626c8248bULL,
+                           0x00f452b458a65b1eULL, 0x00a713176fce32e0ULL,
+                           0x00c4082484d325d9ULL, 0x00417687e8d34096ULL,
+                           0x00ec107c1ee277d8ULL, 0x00a8dd51e0bbced6ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005dee3b393c4ab5ULL, 0x00f8789ad62531b2ULL,
+                           0x0085471a2dd9f059ULL, 0x00eca3c3b1ef3ed0ULL,
+                           0x0016170ad7ec5cbfULL, 0x00c32662584bdd87ULL,
+                           0x00dfd26cb23ff539ULL, 0x0059a8e92436f518ULL)},
+            {FIELD_LITERAL(0x00e4bcf57c13f018ULL, 0x00b1378795fcff9dULL,
+                           0x000c5d1f519f3ff4ULL, 0x001c9d91bfb0eae5ULL,
+                           0x00240950a1776f30ULL, 0x00dda3c603c5f876ULL,
+                           0x00894baaa1d29465ULL, 0x0087823d6aa830bbULL)},
+            {FIELD_LITERAL(0x00caca3682902b2eULL, 0x00ba7cffc333c752ULL,
+                           0x00bea41172504e93ULL, 0x009d632eedf43d02ULL,
+                           0x00517e20a4b227fcULL, 0x00f842a7aa3f054eULL,
+                           0x00101cd24ce3a892ULL, 0x00a99c0d8d3fc11cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x004e8426585909c3ULL, 0x00875f0fd3949ffdULL,
+                           0x005aff8b67b261c1ULL, 0x0027f34b6f531fc0ULL,
+                           0x00765b1bf637cff7ULL, 0x0087ff9370494a15ULL,
+                           0x00c8ccbae9996611ULL, 0x004dcafd9604b15bULL)},
+            {FIELD_LITERAL(0x00fcd721189c2a56ULL, 0x00ccf4ccec4262feULL,
+                           0x00a1c461fd2f13a6ULL, 0x0026134eb593734bULL,
+                           0x00dfbf37c8bf2312ULL, 0x008826d1ff5625fcULL,
+                           0x005c1da9f13eef8eULL, 0x0075f3c14a594ab2ULL)},
+            {FIELD_LITERAL(0x008333f02c3ee4f2ULL, 0x0055c7b5b13a35c3ULL,
+                           0x005e9bb6c8f7552aULL, 0x00bd29d79021c69dULL,
+                           0x00eea63e39555707ULL, 0x0065759f22fd0d74ULL,
+                           0x00574dc73c0bd375ULL, 0x005b856b37726d37ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d8757a2b5794c7ULL, 0x009c68ac77a6e598ULL,
+                           0x00db5db4882454bbULL, 0x0033807ebe8cf0eeULL,
+                           0x00ad42ba750d15abULL, 0x0026407cf0ffa3f0ULL,
+                           0x00c1413b9bbfd3c4ULL, 0x00fb4c86d5d14d79ULL)},
+            {FIELD_LITERAL(0x0055cf34f37d1d55ULL, 0x005f0f490b4635b3ULL,
+                           0x00673d6a8547c7c6ULL, 0x00129c8506000568ULL,
+                           0x00d16b68eb136c43ULL, 0x00611a1cb7236338ULL,
+                           0x0006b19bd9fe25dcULL, 0x003bcca82b8cb67fULL)},
+            {FIELD_LITERAL(0x003118850394e07cULL, 0x001bcd363f248d20ULL,
+                           0x0087448bda2a0eabULL, 0x00058ad81a25be45ULL,
+                           0x00aaa9e63a72d2bcULL, 0x002bbd36a6e6edb2ULL,
+                           0x00ff17f40fca2818ULL, 0x009aa45d25b1c5eaULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00965670a05d66d9ULL, 0x00245f09b87a34a7ULL,
+                           0x000db2689cafcb2bULL, 0x007a54ba4c0b1577ULL,
+                           0x00884aa3369de74eULL, 0x00b5f4e683290aebULL,
+                           0x0064478e42f0f6caULL, 0x00c19da3ebd700abULL)},
+            {FIELD_LITERAL(0x008be93f1ca50493ULL, 0x0026d80fdc6a5f75ULL,
+                           0x00eb3592fcb0f9a2ULL, 0x008f8ed5e7d772b8ULL,
+                           0x00ed59dccc394a0cULL, 0x00c67c4b351da4b4ULL,
+                           0x00a43c98d1329f94ULL, 0x00413515af0eb442ULL)},
+            {FIELD_LITERAL(0x00d96d6b57b5b423ULL, 0x00e68004aebef38bULL,
+                           0x008d7925ebb64cfcULL, 0x00e9b0d9157248ddULL,
+                           0x00949d0bdec6e5f6ULL, 0x005ebeaf82817db6ULL,
+                           0x002fa06612bae6a4ULL, 0x00be56339a5081e6ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x009c365b0a3fb36aULL, 0x00872776eea68a44ULL,
+                           0x00e5b10d31d0c0d7ULL, 0x007632ac9c811518ULL,
+                           0x0086980e6d86b9efULL, 0x00c4d5b830553b4dULL,
+                           0x0039d9ded0ddd4a4ULL, 0x00c13c74c5db8611ULL)},
+            {FIELD_LITERAL(0x0055a3aa47c86e42ULL, 0x00dcb7006d317d6aULL,
+                           0x006c0df5fcd1ff87ULL, 0x0082d27955ecec57ULL,
+                           0x00cb94d129ef95ddULL, 0x001674688c23417dULL,
+                           0x0082784a4fb534c5ULL, 0x002f41a0016a6760ULL)},
+            {FIELD_LITERAL(0x00ea0691db77177cULL, 0x00cf4581a1ca6979ULL,
+                           0x005f2eb0ad49d4fdULL, 0x0052a52f10297a52ULL,
+                           0x0072667290889965ULL, 0x006b2ca20a0fc079ULL,
+                           0x00c04eaeb2e88467ULL, 0x00ca8ce140019c8dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00d04c1bc74ff85eULL, 0x0099d8058441b7abULL,
+                           0x00fcaff9b97af489ULL, 0x000e749b6d85df74ULL,
+                           0x0000652cb503e3f4ULL, 0x005acdccbff74b06ULL,
+                           0x003f6407af00f25dULL, 0x00dc05eda39a42d8ULL)},
+            {FIELD_LITERAL(0x00944ad522635d9cULL, 0x006ef2146e5ae842ULL,
+                           0x000303d113d4a3efULL, 0x0066e83855bb42dfULL,
+                           0x00e088e5aea577bcULL, 0x00b089e375029422ULL,
+                           0x00974c2336bae41cULL, 0x00fc93db6e08b837ULL)},
+            {FIELD_LITERAL(0x00f9215371fc03c0ULL, 0x009d77a7058a9078ULL,
+                           0x0062fcc71129b0aaULL, 0x005252836376f951ULL,
+                           0x007617a4b9535005ULL, 0x007061bf16c84db9ULL,
+                           0x00added013b3f2c1ULL, 0x00a1c9ee6bf242a4ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00a90cb102977688ULL, 0x00ca11e52e7fbb86ULL,
+                           0x002afa3e8b285ad2ULL, 0x0086a3bb7206112dULL,
+                           0x002563fc84bb71b6ULL, 0x00fda82a5c50dedeULL,
+                           0x0069bf3323315483ULL, 0x00f812b5041de9c3ULL)},
+            {FIELD_LITERAL(0x0066f495a24481e1ULL, 0x00d18f47b656d687ULL,
+                           0x007b671a049d9453ULL, 0x00d3840c87fc9115ULL,
+                           0x00120f82c15edf19ULL, 0x0032e680a2f9a48bULL,
+                           0x00e8a7c030422b38ULL, 0x00147a6a4bc413efULL)},
+            {FIELD_LITERAL(0x0039aad6474609eeULL, 0x00d0f824782633efULL,
+                           0x0095f3623143c02bULL, 0x00ee627b27939609ULL,
+                           0x0016bea67715d7ecULL, 0x0099b9707eb59659ULL,
+                           0x0084413796c70bf7ULL, 0x00638b5dedb28c6bULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0012f129202754a3ULL, 0x004b17566df9acdaULL,
+                           0x0031495302db5759ULL, 0x00217b649eefa911ULL,
+                           0x000c4cd8657f857eULL, 0x004acf2bcfc778f0ULL,
+                           0x000e8dafb2ba5744ULL, 0x0022c6aa3e52f63bULL)},
+            {FIELD_LITERAL(0x00d87d6a25cb215aULL, 0x00e5b68bbed60a3dULL,
+                           0x00882500240ccac8ULL, 0x005582c1007d9ba7ULL,
+                           0x00e966c4b2807110ULL, 0x0051095849e2c79bULL,
+                           0x00eff2bf8c1f579bULL, 0x00b19d098c9c090bULL)},
+            {FIELD_LITERAL(0x00aa2d9039a02370ULL, 0x00cbab15fbba5a84ULL,
+                           0x00dd992f8f7e78caULL, 0x007908e196933f52ULL,
+                           0x0037bf1e51c53bf4ULL, 0x00d74949f6683a3eULL,
+                           0x00fb2ea7e305a76fULL, 0x000f57c603526bcfULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00734ea3b6f27c34ULL, 0x00997925ec5438dbULL,
+                           0x00f2b96b8a833e05ULL, 0x005d1919f5d901b6ULL,
+                           0x00f6ca25dfbc03bfULL, 0x005284d0cdc189d6ULL,
+                           0x007c0fb5f5ed1c49ULL, 0x00a5975aa6c458c8ULL)},
+            {FIELD_LITERAL(0x00bf775671f0849fULL, 0x00aa91ca57aea2baULL,
+                           0x00fe47fdea00ca37ULL, 0x00e7eacc1b7c074dULL,
+                           0x00532591f1da0bd5ULL, 0x00279fbb6df33c37ULL,
+                           0x00586ccb3865d3caULL, 0x0080e0b4e2005158ULL)},
+            {FIELD_LITERAL(0x0029a262d11b8321ULL, 0x004757a671a32ae2ULL,
+                           0x00eac616d7746177ULL, 0x001cd36709c453caULL,
+                           0x008c605e10e172a9ULL, 0x00ef1c5fcd0ed227ULL,
+                           0x008265d906df08b0ULL, 0x0029e80fca76900cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x005f89ccd01ca2e4ULL, 0x002c44cc58680f73ULL,
+                           0x00b6bb4e4b625ef6ULL, 0x0054e2cdab6f9c2aULL,
+                           0x00a30f1fd44eacc1ULL, 0x0030c8309eaa9223ULL,
+                           0x0014fc8b7d58124aULL, 0x00ad8c89d9252412ULL)},
+            {FIELD_LITERAL(0x00766a7c8d761ebbULL, 0x00ededfe636da525ULL,
+                           0x00d123dd0bfa642aULL, 0x00c551eb1528dea5ULL,
+                           0x0090cfefa37bd416ULL, 0x00ecfdb898636c8bULL,
+                           0x00ec2984eaea77caULL, 0x0002f73501cd62deULL)},
+            {FIELD_LITERAL(0x00e71f7ae6f849c5ULL, 0x00647087e74d039cULL,
+                           0x005b407dfb297160ULL, 0x005afaf0e1627458ULL,
+                           0x00db5bfcd24d53d3ULL, 0x0074506d09650c7fULL,
+                           0x00e7ffb721cc68c0ULL, 0x00f1e2c9e8454b72ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00c210179a236633ULL, 0x00d737a26ae52d0fULL,
+                           0x0091f46acc0f1d72ULL, 0x00668a46d1d734bdULL,
+                           0x00f240e2c4e2286eULL, 0x00bbb7ec85b5ebd5ULL,
+                           0x005187305327c3f1ULL, 0x0048fa926093bad6ULL)},
+            {FIELD_LITERAL(0x00e737e8c00c8d01ULL, 0x0066f9d579265315ULL,
+                           0x00b7fbed4ed81a64ULL, 0x00760465d83d97f1ULL,
+                           0x00aa3831ed0371f1ULL, 0x002c776a1fa1f48eULL,
+                           0x0000a2fe43e396b7ULL, 0x00478cd1c710c0e2ULL)},
+            {FIELD_LITERAL(0x00c7a09558da8b84ULL, 0x0039cb37c9593d70ULL,
+                           0x0064e222f6e3a172ULL, 0x00d5738e30b30ff6ULL,
+                           0x0097743ee49c0615ULL, 0x00d6bfa38dc1e5a7ULL,
+                           0x00e50e4e8aec6c69ULL, 0x00114d7e7ebcd587ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003aabf6986a3fbeULL, 0x00c74d10cd0dfc70ULL,
+                           0x00f2e85618657dc4ULL, 0x001c6c95e1a0bac4ULL,
+                           0x000affa1c2128fcaULL, 0x00e64af1d0eedaa8ULL,
+                           0x005dedaeb0fd6dd9ULL, 0x00863f9bafdde6e4ULL)},
+            {FIELD_LITERAL(0x00ef54f50d12bf9eULL, 0x008170252bb36c32ULL,
+                           0x00ad8bc420504b5bULL, 0x007ce1b5644f9202ULL,
+                           0x00826ec58ab11e1dULL, 0x002846b4788cf093ULL,
+                           0x00b62646ec84f0d9ULL, 0x0003d0d464f2a20eULL)},
+            {FIELD_LITERAL(0x0094e8ad3fc7d492ULL, 0x0000c3ab6e396b93ULL,
+                           0x00de6e58352ce4a3ULL, 0x00d589f03432386dULL,
+                           0x0031fd31a78ff9a7ULL, 0x00b98d13195ae0aeULL,
+                           0x00a831244e90b1f7ULL, 0x00d80268b97d71c5ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00051ca7d5488a2cULL, 0x005d7384863f3e66ULL,
+                           0x00a5417db8f4b650ULL, 0x00b521b08893c325ULL,
+                           0x0046cd86fc3b078dULL, 0x0023dee66e418580ULL,
+                           0x00434aa2f3b5d6deULL, 0x00a2aaf680482b73ULL)},
+            {FIELD_LITERAL(0x000852e2bdffbe95ULL, 0x00c4e5ccb5acbed9ULL,
+                           0x00a03f641d8375ddULL, 0x00496be4e9e7f90cULL,
+                           0x004cb6f06b0547d5ULL, 0x0073dd5ade351b30ULL,
+                           0x002f7bc21951d8e4ULL, 0x00b42518b81bde86ULL)},
+            {FIELD_LITERAL(0x00e345345eedb8c5ULL, 0x0032bd143e823bb5ULL,
+                           0x0037677929672eacULL, 0x00700fa8a3848644ULL,
+                           0x00fc03ee82c7f45aULL, 0x00d8994ffc818597ULL,
+                           0x006097201a657cdeULL, 0x00e12dba857321faULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00aa4de95743f3cfULL, 0x001d9419bc577084ULL,
+                           0x005d44186c4d94ddULL, 0x009d89e160ba7c2cULL,
+                           0x000bc65a55091e05ULL, 0x00ebd9c9cd7a18c2ULL,
+                           0x0018aff6cc0ee5acULL, 0x008a60bda8a84072ULL)},
+            {FIELD_LITERAL(0x001bba483e861cf6ULL, 0x00d8ac5e7c777ab7ULL,
+                           0x00c05afcd15922c1ULL, 0x00ca6021c9ad7c22ULL,
+                           0x00d2a11d0398e1e5ULL, 0x00de259721f92c58ULL,
+                           0x00946db7b5999b38ULL, 0x00fa770121c72c22ULL)},
+            {FIELD_LITERAL(0x003676feee1c5275ULL, 0x00cb66fdc8652758ULL,
+                           0x0002400b371f2370ULL, 0x00fe6aa28657ce3bULL,
+                           0x000fd7669afcb8d6ULL, 0x00bbc459f8acb1fbULL,
+                           0x00bb1cd422225a47ULL, 0x0006d681df1c3fbaULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00864d34a30b9c8cULL, 0x00f14b64a730c357ULL,
+                           0x003b1f5eaeb91f1fULL, 0x00d1be70b87a2cddULL,
+                           0x003d7358020151a3ULL, 0x0092496af625c81dULL,
+                           0x0033a554e6f1a6a8ULL, 0x002d184836b903bbULL)},
+            {FIELD_LITERAL(0x006ac56ab51186ebULL, 0x00a5643451bc14b5ULL,
+                           0x00a4c730c50f58bcULL, 0x00d61198d2850450ULL,
+                           0x005ccd15b935ef97ULL, 0x00efa9f225962817ULL,
+                           0x001ea367faab8037ULL, 0x0049f691b7bbf772ULL)},
+            {FIELD_LITERAL(0x00ec9e957a149816ULL, 0x007e3b264718e5d9ULL,
+                           0x0080df27bd398401ULL, 0x005b67c79ec7f838ULL,
+                           0x0042dc8031f35ab9ULL, 0x002c541254498d11ULL,
+                           0x0040b19ff612c630ULL, 0x0049d73a6ea26419ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0062b5a32b3e38bfULL, 0x0013e5921bcee4ebULL,
+                           0x002083bb0fde7651ULL, 0x0093978a4b0f6258ULL,
+                           0x0097cb2780f132f8ULL, 0x0080da5568a04705ULL,
+                           0x00ff687c85ca9a96ULL, 0x0011703bbf6860ddULL)},
+            {FIELD_LITERAL(0x00b3ed36c167f04cULL, 0x00dc918773ab8063ULL,
+                           0x0061f571f4b1ea30ULL, 0x00ba3bbf2532a9beULL,
+                           0x000a9eb975995373ULL, 0x001e53a0027b3effULL,
+                           0x0021253a07601fb4ULL, 0x0074affc68a3a70dULL)},
+            {FIELD_LITERAL(0x0003b979ef7be64dULL, 0x00a62a1b02e842a0ULL,
+                           0x0064499a769bd070ULL, 0x00c897142f4764f4ULL,
+                           0x005bec0a1fdafcc9ULL, 0x00d7f48f4a60139fULL,
+                           0x001585779859fcf7ULL, 0x0032791b4b2746f7ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00191112cb493789ULL, 0x000aff75a953df82ULL,
+                           0x0023f852a2dd27e4ULL, 0x00a8221193ceeb12ULL,
+                           0x0005fc0d471453caULL, 0x00d34a46f7e1d342ULL,
+                           0x00e66df111ce05cfULL, 0x00a768e657b9fa09ULL)},
+            {FIELD_LITERAL(0x00650d98aee6499cULL, 0x00110f02279c4bc1ULL,
+                           0x001187d70ecc49b3ULL, 0x002dfd5769cb2193ULL,
+                           0x00a4134226442777ULL, 0x005ddb876a91ad8aULL,
+                           0x001e35d8e956f7feULL, 0x009a21bc61b2702cULL)},
+            {FIELD_LITERAL(0x00c83c0393c29bf1ULL, 0x00ae608afa927f21ULL,
+                           0x0042c01c933c5c48ULL, 0x00fcec04c0341a69ULL,
+                           0x00158b4f3be05a34ULL, 0x00aba08df43cf805ULL,
+                           0x00ec4d9dd6c13f58ULL, 0x00b8000ab46085faULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f2bc7dc3e64b2dULL, 0x00e7d631fc8b9ec7ULL,
+                           0x0048ec9a1cb39195ULL, 0x00fc9bcb8c7f8e5eULL,
+                           0x00b6654dfa7c753fULL, 0x00c27d50c90ffe3dULL,
+                           0x00e4827cc1cbb162ULL, 0x0049ac336749cf17ULL)},
+            {FIELD_LITERAL(0x0008188e510c3b5fULL, 0x00f9be0fd692bd5cULL,
+                           0x007ad68fe89ffaa4ULL, 0x004287955e71dfe1ULL,
+                           0x00427101482af964ULL, 0x0065e4b6119ed299ULL,
+                           0x005ce4783cac4857ULL, 0x003589a5fcc0402bULL)},
+            {FIELD_LITERAL(0x00c0895c5d7df63bULL, 0x007d0f28f98d5cffULL,
+                           0x00b91448e6be04a2ULL, 0x00d9c13d1dde44a7ULL,
+                           0x003d52bdae51561fULL, 0x000932f5f4001274ULL,
+                           0x00d8fc80e81ed956ULL, 0x005372c8fb2f3303ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00367ac2ffefa611ULL, 0x008fc07c2a9b9eecULL,
+                           0x00eaa4494628f260ULL, 0x006319eeb2511ea5ULL,
+                           0x00daf570d03805adULL, 0x0071fd09e575aaf4ULL,
+                           0x009e5ec69e3f5c6cULL, 0x001e7f33a04315faULL)},
+            {FIELD_LITERAL(0x000307203e2087e6ULL, 0x002cebbd8301302eULL,
+                           0x00fee99220d4f335ULL, 0x001c0d588207224eULL,
+                           0x0033c0b2cc46f044ULL, 0x009653df6e6367aaULL,
+                           0x00274a1d9fceeee4ULL, 0x00cdbe455c74de82ULL)},
+            {FIELD_LITERAL(0x001e1f974a5bd9fcULL, 0x0044720ad0443189ULL,
+                           0x00e52fec27c394dcULL, 0x0018d81be665df23ULL,
+                           0x00651fe95eaffc52ULL, 0x0007f465b9140c15ULL,
+                           0x0087391378dd33f1ULL, 0x00dd6114140c8f7dULL)},
+        }}, {{
+            {FIELD_LITERAL(0x001759a4f20f0553ULL, 0x009aa987d476188cULL,
+                           0x006e408c866e4e0aULL, 0x0092d1a2b0681c38ULL,
+                           0x00a6300227aa1bb7ULL, 0x00005e8b35b311c3ULL,
+                           0x00a5edfbe7222d32ULL, 0x00c541d200124075ULL)},
+            {FIELD_LITERAL(0x00d0c8354a862f75ULL, 0x0066d032b6d7ce1dULL,
+                           0x00770e2b6f2ea427ULL, 0x00208c5d2fc11277ULL,
+                           0x0074029b9bd3b090ULL, 0x00317c5e7a13214fULL,
+                           0x00e16f4389645929ULL, 0x00c1ca8ae3c4d9ebULL)},
+            {FIELD_LITERAL(0x00cf3579ad11e06eULL, 0x00b8e44a78257a16ULL,
+                           0x0093d16bba0d8e8aULL, 0x00e15b0f7783a040ULL,
+                           0x003c0beb0cdfef04ULL, 0x00f772d9efe96cd1ULL,
+                           0x00b9ae7c56d4bf01ULL, 0x00f69b3e6a1a641cULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0038a3506e2dc0e4ULL, 0x00c7aedf1a610efbULL,
+                           0x004ea51ba4c8aa77ULL, 0x00728e53d1034b25ULL,
+                           0x00d3c4ae47d27602ULL, 0x008136d5165278a9ULL,
+                           0x009431b08d9603b6ULL, 0x005c36b209d39a9fULL)},
+            {FIELD_LITERAL(0x009f8498a287ca76ULL, 0x007dbc4c58ba9e0bULL,
+                           0x004a2f9b35534465ULL, 0x00c3f5103a674650ULL,
+                           0x00a5e526613ea7f7ULL, 0x00ee4d062099bb7dULL,
+                           0x000fb0ff3b898d18ULL, 0x0079ef45ac338a19ULL)},
+            {FIELD_LITERAL(0x00b40433d48f0166ULL, 0x003f0432ce8180e1ULL,
+                           0x0019928cc9c10e6dULL, 0x006f72329263f6d9ULL,
+                           0x00669c9960c60e6fULL, 0x008cdf3507c7e68bULL,
+                           0x009e805e0b03d323ULL, 0x00f611274ce35440ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x003b63cf86a4c642ULL, 0x006ee61093fe044fULL,
+                           0x00418e8a6068c903ULL, 0x00db2e1f5f80262eULL,
+                           0x00e2497159fe21d1ULL, 0x004a00b723cc99d2ULL,
+                           0x008faa974870f62dULL, 0x008b2c65da9736bdULL)},
+            {FIELD_LITERAL(0x003ba48ed86e4bb7ULL, 0x003ee376f4662e07ULL,
+                           0x00a462eae92d8d5cULL, 0x00cd8d086c599f6dULL,
+                           0x0096cb2e8619b4fcULL, 0x003428240ea67185ULL,
+                           0x00f6ecb7cddb01dfULL, 0x005482a5030c407dULL)},
+            {FIELD_LITERAL(0x004e2ccaa9a9c96cULL, 0x003ca5e4752ef4c1ULL,
+                           0x000edbff0a826f62ULL, 0x006229bc21ae6720ULL,
+                           0x00b89a70de469d9cULL, 0x0031547113f50b34ULL,
+                           0x0012546c1736f3f6ULL, 0x002df347fecc0daaULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00a02b610f96c3a3ULL, 0x002609ec60282bb8ULL,
+                           0x00b42e8cf0f1a9ccULL, 0x00f0a4f70b1dbe4eULL,
+                           0x0016241a6055a6d7ULL, 0x0092edf23c1329c3ULL,
+                           0x00cfff16f7fe721eULL, 0x008d10de1a94b9dbULL)},
+            {FIELD_LITERAL(0x00f607eefd4480ccULL, 0x00b77181fb3420c5ULL,
+                           0x00aa2c7b5f705d5aULL, 0x00c19c33af9e46d3ULL,
+                           0x00b3f11017f17f21ULL, 0x00eb4e7bfe0016d5ULL,
+                           0x00bcc00ad466f69bULL, 0x0007f87ab6130449ULL)},
+            {FIELD_LITERAL(0x0072d9abb856c363ULL, 0x00b65fdd8002ca17ULL,
+                           0x0091b0d754295a23ULL, 0x005b909f9a335823ULL,
+                           0x0041179a6640c092ULL, 0x00a9803c72027dcbULL,
+                           0x001ca60301388bfaULL, 0x002225ad7be64849ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x007411bdacf0ffa7ULL, 0x0007940edbc41e62ULL,
+                           0x0010f21456d5d47cULL, 0x00135ef65e3917e8ULL,
+                           0x00773240abae0b33ULL, 0x00b4eee9773edcf8ULL,
+                           0x00f6f6187f6e0f99ULL, 0x0076221f366cadd2ULL)},
+            {FIELD_LITERAL(0x00c5054244cf7f32ULL, 0x00b2a33abce7cd3bULL,
+                           0x009ebc80642db678ULL, 0x00fa9df30d14d3dfULL,
+                           0x00942918bdaa81cbULL, 0x00a75592a5d607ffULL,
+                           0x002f970a37d02177ULL, 0x00150804582c433eULL)},
+            {FIELD_LITERAL(0x0012f89259ec2d2dULL, 0x0066dbafe76a151cULL,
+                           0x004d22abf7125886ULL, 0x006cf50a5c2612feULL,
+                           0x00ee4a08c896056fULL, 0x00ece1de93b80e61ULL,
+                           0x006ce1ffa1b425a2ULL, 0x0000a8ac021a04fbULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00f90674f42131f4ULL, 0x00fcec7831bd5ebbULL,
+                           0x005a6b144ec22c3cULL, 0x00852876956b8539ULL,
+                           0x008cd1cc6b6972d1ULL, 0x0004bc3068999cfcULL,
+                           0x00198325727d452bULL, 0x00b117145ae28827ULL)},
+            {FIELD_LITERAL(0x0072a53de5ec2956ULL, 0x00ba239f17b249f8ULL,
+                           0x00644d9429fe7822ULL, 0x00b41d1edcb1ac64ULL,
+                           0x009690d2df9823eeULL, 0x0085078b836c40c4ULL,
+                           0x009f79f33c236bfaULL, 0x00ae74b3f8e5eb5aULL)},
+            {FIELD_LITERAL(0x0082d62bdb20912cULL, 0x001d8410ebc93f7fULL,
+                           0x003432c860d96aadULL, 0x00269062ad3c839bULL,
+                           0x00d615b9522f79d7ULL, 0x008422bd84748e11ULL,
+                           0x009e2924099b9733ULL, 0x00fe606112cf5b19ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x006d0cd35b9a51d2ULL, 0x00bb2a9f2114d1c8ULL,
+                           0x00a6d3bad203d6dcULL, 0x002a90c18a1ad6ecULL,
+                           0x008781eb8773f5f7ULL, 0x00423997fa1e71c6ULL,
+                           0x0056a04825c938e8ULL, 0x00ae40b35c7b6fd7ULL)},
+            {FIELD_LITERAL(0x00a8e2986070933aULL, 0x000d937b639f35edULL,
+                           0x00c548f05ac3e6d1ULL, 0x002583ad86820f89ULL,
+                           0x00d3ed16e1c2e6bfULL, 0x001ed782ef0dd5ccULL,
+                           0x000d271ab1bb48afULL, 0x00e159ef4d49bb68ULL)},
+            {FIELD_LITERAL(0x0045d60b066d2615ULL, 0x00438edf2e3f4b0eULL,
+                           0x005cb3c000bb9ab5ULL, 0x00bbd2db644e3946ULL,
+                           0x00b10092c32fecd8ULL, 0x0024fc1063228d3bULL,
+                           0x00500992ba625990ULL, 0x00c2a04ba6f06105ULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00704d8ea8aed6eaULL, 0x00fef539b3102659ULL,
+                           0x00b304a17a835b42ULL, 0x009eac836e6e8c5aULL,
+                           0x0049152f0197258fULL, 0x00bed7d5ff3cf444ULL,
+                           0x00ab3e31f83ca1d9ULL, 0x00a562a5be4d1148ULL)},
+            {FIELD_LITERAL(0x00607a7fcb08ff9dULL, 0x006f466bf8bdbc6eULL,
+                           0x0041d6dc0cba73c5ULL, 0x00c5ea4ff244a9a4ULL,
+                           0x0022cd6ab528cc7cULL, 0x001bc284d25b992bULL,
+                           0x000bc2ce236c0fd0ULL, 0x00b335576f8cb286ULL)},
+            {FIELD_LITERAL(0x00e25080537074ebULL, 0x009620faa2c2c30cULL,
+                           0x00a4785d97e335beULL, 0x00d2d17bb7b43910ULL,
+                           0x004869c485170105ULL, 0x005a5dcdad5f4331ULL,
+                           0x00c0f4fdbc859057ULL, 0x007722a4ca9e34fbULL)},
+        }}, {{
+            {FIELD_LITERAL(0x0010d6b99003f9dfULL, 0x0027681e6e6523a8ULL,
+                           0x005f2dd90aa13796ULL, 0x001f2a3c0c80ad45ULL,
+                           0x00e41536f9685842ULL, 0x009cb9d6f56e7b42ULL,
+                           0x003e2e9b338a0b82ULL, 0x00969308c863d1f8ULL)},
+            {FIELD_LITERAL(0x0078152af8eaa777ULL, 0x00a0838835e0864aULL,
+                           0x00a7a1605c607e56ULL, 0x006a5535a7711e8aULL,
+                           0x00c0b73d872c0482ULL, 0x00a50731c8f22692ULL,
+                           0x001c8298a8df4fceULL, 0x002df50beca773c0ULL)},
+            {FIELD_LITERAL(0x0041340efc3ef6cbULL, 0x0071ffbf091d3d53ULL,
+                           0x006496f2c476adacULL, 0x00f924c2572fda50ULL,
+                           0x008ee5bf29b84bc1ULL, 0x003c193af2a18a1aULL,
+                           0x0019ac93decf65f3ULL, 0x00871e28faee71eeULL)},
+        }}, {{
+            {FIELD_LITERAL(0x00272e7a518d6e15ULL, 0x000f83234ab8049fULL,
+                           0x00ec9a1e504dba16ULL, 0x009bf293be20027aULL,
+                           0x006bc24a662254f8ULL, 0x0032877ba2efc54aULL,
+                           0x00502f3c17dfa2b6ULL, 0x00c85d41beb184f3ULL)},
+            {FIELD_LITERAL(0x00aef16e02ef5b20ULL, 0x00b441bd13180dd4ULL,
+                           0x00a6642b3a62b5aeULL, 0x0090139da04a0bdbULL,
+                           0x00392bac0c5b420fULL, 0x004bae99b5774bd0ULL,
+                           0x00a60d615d187c42ULL, 0x004ff41fb99d8bbbULL)},
+            {FIELD_LITERAL(0x00ac9893ae850b28ULL, 0x00c3d82d5cbb910aULL,
+                           0x00fba94306cf78d1ULL, 0x00c0985b99d0a97bULL,
+                           0x006229a6e241df8aULL, 0x00b0cad5a289de3dULL,
+                           0x003b34d95f189aabULL, 0x00dd7d97c59a771cULL)},
         }}
     }
 };
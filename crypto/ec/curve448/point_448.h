@@ -18,8 +18,8 @@
 
 /* Comb config: number of combs, n, t, s. */
 #define COMBS_N 5
-#define COMBS_T 5
-#define COMBS_S 18
+#define COMBS_T 6
+#define COMBS_S 15
 
 /* Projective Niels coordinates */
 typedef struct {
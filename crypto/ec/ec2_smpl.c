@@ -994,7 +994,9 @@ const EC_METHOD *EC_GF2m_simple_method(void)
         0, /* blind_coordinates */
         ec_GF2m_simple_ladder_pre,
         ec_GF2m_simple_ladder_step,
-        ec_GF2m_simple_ladder_post
+        ec_GF2m_simple_ladder_post,
+        0, /* mul_multi_lanes */
+        0  /* points_mul_multi */
     };
 
     return &ret;
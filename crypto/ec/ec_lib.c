@@ -1318,6 +1318,77 @@ int ossl_ec_point_blind_coordinates(const EC_GROUP *group, EC_POINT *p,
     return group->meth->blind_coordinates(group, p, ctx);
 }
 
+/*-
+ * Multi-buffer scalar multiplication.
+ *
+ * ossl_ec_group_mul_multi_lanes() returns the number of independent
+ * multiplications that ossl_ec_points_mul_multi() computes at roughly the
+ * cost of one, or 1 if the underlying EC_METHOD has no such support.
+ *
+ * ossl_ec_points_mul_multi() computes
+ *          r[i] = g_scalars[i] * generator + p_scalars[i] * points[i]
+ * for 0 <= i < num. If |points| is NULL only the generator multiples are
+ * computed, and the computation is constant time with respect to
+ * |g_scalars|. Otherwise it is not, and all arguments must be public.
+ *
+ * Returns 1 on success, 0 otherwise.
+ */
+size_t ossl_ec_group_mul_multi_lanes(const EC_GROUP *group)
+{
+    if (group->meth->mul_multi_lanes == NULL)
+        return 1;
+
+    return group->meth->mul_multi_lanes(group);
+}
+
+int ossl_ec_points_mul_multi(const EC_GROUP *group, EC_POINT *r[],
+                             const BIGNUM *const g_scalars[],
+                             const EC_POINT *const points[],
+                             const BIGNUM *const p_scalars[], size_t num,
+                             BN_CTX *ctx)
+{
+    int ret = 0;
+    size_t i;
+#ifndef FIPS_MODULE
+    BN_CTX *new_ctx = NULL;
+#endif
+
+    if (ossl_ec_group_mul_multi_lanes(group) <= 1) {
+        for (i = 0; i < num; i++) {
+            if (!EC_POINT_mul(group, r[i], g_scalars[i],
+                              points != NULL ? points[i] : NULL,
+                              points != NULL ? p_scalars[i] : NULL, ctx))
+                return 0;
+        }
+        return 1;
+    }
+
+    for (i = 0; i < num; i++) {
+        if (!ec_point_is_compat(r[i], group)
+            || (points != NULL && !ec_point_is_compat(points[i], group))) {
+            ERR_raise(ERR_LIB_EC, EC_R_INCOMPATIBLE_OBJECTS);
+            return 0;
+        }
+    }
+
+#ifndef FIPS_MODULE
+    if (ctx == NULL)
+        ctx = new_ctx = BN_CTX_secure_new();
+#endif
+    if (ctx == NULL) {
+        ERR_raise(ERR_LIB_EC, ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+
+    ret = group->meth->points_mul_multi(group, r, g_scalars, points,
+                                        p_scalars, num, ctx);
+
+#ifndef FIPS_MODULE
+    BN_CTX_free(new_ctx);
+#endif
+    return ret;
+}
+
 int EC_GROUP_get_basis_type(const EC_GROUP *group)
 {
     int i;
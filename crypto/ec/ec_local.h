@@ -196,6 +196,21 @@ struct ec_method_st {
     int (*ladder_post)(const EC_GROUP *group,
                        EC_POINT *r, EC_POINT *s,
                        EC_POINT *p, BN_CTX *ctx);
+    /*
+     * Multi-buffer scalar multiplication: 'mul_multi_lanes' returns the
+     * number of independent multiplications that 'points_mul_multi'
+     * computes at roughly the cost of one, or 1 if it can't be used for
+     * this group. 'points_mul_multi' computes
+     * r[i] = g_scalars[i] * generator + p_scalars[i] * points[i] for each i
+     * below num; if 'points' is NULL only the generator multiples are
+     * computed, in constant time.
+     */
+    size_t (*mul_multi_lanes)(const EC_GROUP *group);
+    int (*points_mul_multi)(const EC_GROUP *group, EC_POINT *r[],
+                            const BIGNUM *const g_scalars[],
+                            const EC_POINT *const points[],
+                            const BIGNUM *const p_scalars[], size_t num,
+                            BN_CTX *ctx);
 };
 
 /*
@@ -761,6 +776,21 @@ int ossl_ec_scalar_mul_ladder(const EC_GROUP *group, EC_POINT *r,
 
 int ossl_ec_point_blind_coordinates(const EC_GROUP *group, EC_POINT *p,
                                     BN_CTX *ctx);
+size_t ossl_ec_group_mul_multi_lanes(const EC_GROUP *group);
+int ossl_ec_points_mul_multi(const EC_GROUP *group, EC_POINT *r[],
+                             const BIGNUM *const g_scalars[],
+                             const EC_POINT *const points[],
+                             const BIGNUM *const p_scalars[], size_t num,
+                             BN_CTX *ctx);
+#ifdef ECP_NISTP_IFMA
+size_t ossl_ec_GFp_nistp_ifma_mul_multi_lanes(const EC_GROUP *group);
+int ossl_ec_GFp_nistp_ifma_points_mul_multi(const EC_GROUP *group,
+                                            EC_POINT *r[],
+                                            const BIGNUM *const g_scalars[],
+                                            const EC_POINT *const points[],
+                                            const BIGNUM *const p_scalars[],
+                                            size_t num, BN_CTX *ctx);
+#endif
 
 static ossl_inline int ec_point_ladder_pre(const EC_GROUP *group,
                                            EC_POINT *r, EC_POINT *s,
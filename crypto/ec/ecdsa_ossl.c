@@ -388,44 +388,126 @@ ECDSA_SIG *ossl_ecdsa_simple_sign_sig(const unsigned char *dgst, int dgst_len,
     return ret;
 }
 
-/*-
- * returns
- *      1: correct signature
- *      0: incorrect signature
- *     -1: error
+/*
+ * Decodes a DER encoded signature, rejecting any other encoding of it and
+ * trailing garbage.
  */
-int ossl_ecdsa_verify(int type, const unsigned char *dgst, int dgst_len,
-                      const unsigned char *sigbuf, int sig_len, EC_KEY *eckey)
+static ECDSA_SIG *ecdsa_sig_decode(const unsigned char *sigbuf, int sig_len)
 {
     ECDSA_SIG *s;
     const unsigned char *p = sigbuf;
     unsigned char *der = NULL;
     int derlen = -1;
-    int ret = -1;
 
     s = ECDSA_SIG_new();
     if (s == NULL)
-        return ret;
+        return NULL;
     if (d2i_ECDSA_SIG(&s, &p, sig_len) == NULL)
         goto err;
     /* Ensure signature uses DER and doesn't have trailing garbage */
     derlen = i2d_ECDSA_SIG(s, &der);
     if (derlen != sig_len || memcmp(sigbuf, der, derlen) != 0)
         goto err;
-    ret = ECDSA_do_verify(dgst, dgst_len, s, eckey);
+    OPENSSL_free(der);
+    return s;
  err:
     OPENSSL_free(der);
     ECDSA_SIG_free(s);
+    return NULL;
+}
+
+/*-
+ * returns
+ *      1: correct signature
+ *      0: incorrect signature
+ *     -1: error
+ */
+int ossl_ecdsa_verify(int type, const unsigned char *dgst, int dgst_len,
+                      const unsigned char *sigbuf, int sig_len, EC_KEY *eckey)
+{
+    ECDSA_SIG *s;
+    int ret;
+
+    if ((s = ecdsa_sig_decode(sigbuf, sig_len)) == NULL)
+        return -1;
+    ret = ECDSA_do_verify(dgst, dgst_len, s, eckey);
+    ECDSA_SIG_free(s);
+    return ret;
+}
+
+/*
+ * Checks that r and s of |sig| are in the range [1, order - 1]. Returns 1 if
+ * they are, and 0 otherwise.
+ */
+static int ecdsa_sig_check_range(const BIGNUM *order, const ECDSA_SIG *sig)
+{
+    if (BN_is_zero(sig->r) || BN_is_negative(sig->r) ||
+        BN_ucmp(sig->r, order) >= 0 || BN_is_zero(sig->s) ||
+        BN_is_negative(sig->s) || BN_ucmp(sig->s, order) >= 0) {
+        ERR_raise(ERR_LIB_EC, EC_R_BAD_SIGNATURE);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Given u2 = inv(s) mod order, computes u1 = m * u2 and u2 = r * u2 mod
+ * order, where m is |dgst| truncated to the length of the order.
+ */
+static int ecdsa_verify_scalars(const EC_GROUP *group,
+                                const unsigned char *dgst, int dgst_len,
+                                const ECDSA_SIG *sig, BIGNUM *u1, BIGNUM *u2,
+                                BN_CTX *ctx)
+{
+    int ret = 0, i;
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+    BIGNUM *m;
+
+    BN_CTX_start(ctx);
+    m = BN_CTX_get(ctx);
+    if (m == NULL) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        goto err;
+    }
+    /* digest -> m */
+    i = BN_num_bits(order);
+    /*
+     * Need to truncate digest if it is too long: first truncate whole bytes.
+     */
+    if (8 * dgst_len > i)
+        dgst_len = (i + 7) / 8;
+    if (!BN_bin2bn(dgst, dgst_len, m)) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        goto err;
+    }
+    /* If still too long truncate remaining bits with a shift */
+    if ((8 * dgst_len > i) && !BN_rshift(m, m, 8 - (i & 0x7))) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        goto err;
+    }
+    /* u1 = m * tmp mod order */
+    if (!BN_mod_mul(u1, m, u2, order, ctx)) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        goto err;
+    }
+    /* u2 = r * w mod q */
+    if (!BN_mod_mul(u2, sig->r, u2, order, ctx)) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        goto err;
+    }
+    ret = 1;
+ err:
+    BN_CTX_end(ctx);
     return ret;
 }
 
 int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
                                  const ECDSA_SIG *sig, EC_KEY *eckey)
 {
-    int ret = -1, i;
+    int ret = -1;
     BN_CTX *ctx;
     const BIGNUM *order;
-    BIGNUM *u1, *u2, *m, *X;
+    BIGNUM *u1, *u2, *X;
     EC_POINT *point = NULL;
     const EC_GROUP *group;
     const EC_POINT *pub_key;
@@ -450,7 +532,6 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
     BN_CTX_start(ctx);
     u1 = BN_CTX_get(ctx);
     u2 = BN_CTX_get(ctx);
-    m = BN_CTX_get(ctx);
     X = BN_CTX_get(ctx);
     if (X == NULL) {
         ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
@@ -463,10 +544,7 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
         goto err;
     }
 
-    if (BN_is_zero(sig->r) || BN_is_negative(sig->r) ||
-        BN_ucmp(sig->r, order) >= 0 || BN_is_zero(sig->s) ||
-        BN_is_negative(sig->s) || BN_ucmp(sig->s, order) >= 0) {
-        ERR_raise(ERR_LIB_EC, EC_R_BAD_SIGNATURE);
+    if (!ecdsa_sig_check_range(order, sig)) {
         ret = 0;                /* signature is invalid */
         goto err;
     }
@@ -475,32 +553,8 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
         ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
         goto err;
     }
-    /* digest -> m */
-    i = BN_num_bits(order);
-    /*
-     * Need to truncate digest if it is too long: first truncate whole bytes.
-     */
-    if (8 * dgst_len > i)
-        dgst_len = (i + 7) / 8;
-    if (!BN_bin2bn(dgst, dgst_len, m)) {
-        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
-        goto err;
-    }
-    /* If still too long truncate remaining bits with a shift */
-    if ((8 * dgst_len > i) && !BN_rshift(m, m, 8 - (i & 0x7))) {
-        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
-        goto err;
-    }
-    /* u1 = m * tmp mod order */
-    if (!BN_mod_mul(u1, m, u2, order, ctx)) {
-        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
-        goto err;
-    }
-    /* u2 = r * w mod q */
-    if (!BN_mod_mul(u2, sig->r, u2, order, ctx)) {
-        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+    if (!ecdsa_verify_scalars(group, dgst, dgst_len, sig, u1, u2, ctx))
         goto err;
-    }
 
     if ((point = EC_POINT_new(group)) == NULL) {
         ERR_raise(ERR_LIB_EC, ERR_R_EC_LIB);
@@ -528,3 +582,336 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
     EC_POINT_free(point);
     return ret;
 }
+
+/*-
+ * Multi-buffer ECDSA.
+ *
+ * ossl_ecdsa_multi_lanes() returns the number of signatures that
+ * ossl_ecdsa_sign_multi() and ossl_ecdsa_verify_multi() compute with keys
+ * like |eckey| at roughly the cost of one, or 1 if |eckey| does not use the
+ * built-in ECDSA implementation or its group has no multi-buffer support.
+ *
+ * ossl_ecdsa_sign_multi() and ossl_ecdsa_verify_multi() store in
+ * results[i] what ECDSA_sign_ex() and ECDSA_verify() return for the i-th
+ * set of arguments, 0 <= i < num. The curve multiplications of all
+ * entries whose key shares the group of eckey[0] are computed together,
+ * the others are handled one by one. They return 1 if every entry
+ * succeeded, and 0 otherwise.
+ */
+#define ECDSA_MULTI_CHUNK 16
+
+size_t ossl_ecdsa_multi_lanes(const EC_KEY *eckey)
+{
+    const EC_GROUP *group = EC_KEY_get0_group(eckey);
+
+    if (group == NULL
+        || eckey->engine != NULL
+        || eckey->meth->sign != ossl_ecdsa_sign
+        || eckey->meth->sign_sig != ossl_ecdsa_sign_sig
+        || eckey->meth->verify != ossl_ecdsa_verify
+        || eckey->meth->verify_sig != ossl_ecdsa_verify_sig
+        || group->meth->ecdsa_sign_sig != ossl_ecdsa_simple_sign_sig
+        || group->meth->ecdsa_verify_sig != ossl_ecdsa_simple_verify_sig)
+        return 1;
+
+    return ossl_ec_group_mul_multi_lanes(group);
+}
+
+static int ecdsa_multi_compatible(const EC_GROUP *group, const EC_KEY *eckey)
+{
+    const EC_GROUP *g = EC_KEY_get0_group(eckey);
+
+    if (group == NULL || g == NULL || ossl_ecdsa_multi_lanes(eckey) <= 1
+        || !EC_KEY_can_sign(eckey))
+        return 0;
+
+    return g == group
+        || (g->meth == group->meth && group->curve_name != NID_undef
+            && g->curve_name == group->curve_name);
+}
+
+/*
+ * Replaces each k[i], 0 <= i < n, by its inverse modulo the order, at the
+ * cost of a single inversion (Montgomery's trick). All of them must be
+ * non-zero and below the order.
+ */
+static int ecdsa_inverse_ord_multi(const EC_GROUP *group, BIGNUM *k[],
+                                   size_t n, BN_CTX *ctx)
+{
+    BN_MONT_CTX *mont = group->mont_data;
+    BIGNUM *prod[ECDSA_MULTI_CHUNK], *inv = NULL;
+    size_t i;
+    int ret = 0;
+
+    BN_CTX_start(ctx);
+    for (i = 0; i < n; i++)
+        prod[i] = BN_CTX_get(ctx);
+    inv = BN_CTX_get(ctx);
+    if (inv == NULL)
+        goto err;
+
+    /* prod[i] = k[0] * ... * k[i], with all of them in Montgomery form */
+    for (i = 0; i < n; i++) {
+        if (!BN_to_montgomery(k[i], k[i], mont, ctx))
+            goto err;
+        if (i == 0 ? BN_copy(prod[0], k[0]) == NULL
+                   : !BN_mod_mul_montgomery(prod[i], prod[i - 1], k[i], mont,
+                                            ctx))
+            goto err;
+    }
+
+    if (!BN_from_montgomery(inv, prod[n - 1], mont, ctx)
+        || !ossl_ec_group_do_inverse_ord(group, inv, inv, ctx)
+        || !BN_to_montgomery(inv, inv, mont, ctx))
+        goto err;
+
+    /* inv = (k[0] * ... * k[i])^-1 at the start of each iteration */
+    for (i = n - 1; i > 0; i--) {
+        if (!BN_mod_mul_montgomery(prod[i], inv, prod[i - 1], mont, ctx)
+            || !BN_mod_mul_montgomery(inv, inv, k[i], mont, ctx)
+            || !BN_from_montgomery(k[i], prod[i], mont, ctx))
+            goto err;
+    }
+    if (!BN_from_montgomery(k[0], inv, mont, ctx))
+        goto err;
+
+    ret = 1;
+ err:
+    BN_CTX_end(ctx);
+    return ret;
+}
+
+static void ecdsa_sign_multi_chunk(const EC_GROUP *group,
+                                   const size_t idx[], size_t n,
+                                   const unsigned char *const dgst[],
+                                   const int dlen[],
+                                   unsigned char *const sig[],
+                                   unsigned int siglen[],
+                                   EC_KEY *const eckey[], int *results)
+{
+    BIGNUM *k[ECDSA_MULTI_CHUNK], *r[ECDSA_MULTI_CHUNK];
+    EC_POINT *points[ECDSA_MULTI_CHUNK];
+    BN_CTX *ctx;
+    BIGNUM *X = NULL;
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+    int order_bits = BN_num_bits(order), len, ok = 0;
+    size_t i, j;
+
+    memset(k, 0, sizeof(k));
+    memset(r, 0, sizeof(r));
+    memset(points, 0, sizeof(points));
+
+    ctx = BN_CTX_secure_new_ex(eckey[idx[0]]->libctx);
+    if (ctx == NULL || (X = BN_new()) == NULL
+        || group->mont_data == NULL
+        || order_bits < MIN_ECDSA_SIGN_ORDERBITS)
+        goto end;
+
+    for (i = 0; i < n; i++) {
+        j = idx[i];
+        len = dlen[j];
+        if (8 * len > order_bits)
+            len = (order_bits + 7) / 8;
+
+        k[i] = BN_secure_new();
+        r[i] = BN_new();
+        points[i] = EC_POINT_new(group);
+        if (k[i] == NULL || r[i] == NULL || points[i] == NULL
+            || !BN_set_bit(k[i], order_bits)
+            || !BN_set_bit(r[i], order_bits))
+            goto end;
+        do {
+            if (!BN_generate_dsa_nonce(k[i], order, eckey[j]->priv_key,
+                                       dgst[j], len, ctx))
+                goto end;
+        } while (BN_is_zero(k[i]));
+    }
+
+    /* compute r the x-coordinate of generator * k, for all of them at once */
+    if (!ossl_ec_points_mul_multi(group, points, (const BIGNUM *const *)k,
+                                  NULL, NULL, n, ctx))
+        goto end;
+
+    for (i = 0; i < n; i++) {
+        if (!EC_POINT_get_affine_coordinates(group, points[i], X, NULL, ctx)
+            || !BN_nnmod(r[i], X, order, ctx))
+            goto end;
+    }
+
+    /* compute the inverses of k */
+    if (!ecdsa_inverse_ord_multi(group, k, n, ctx))
+        goto end;
+    ok = 1;
+
+ end:
+    for (i = 0; i < n; i++) {
+        j = idx[i];
+        /* anything unusual is left to the regular code path */
+        ERR_set_mark();
+        if (ok && !BN_is_zero(r[i])
+            && ossl_ecdsa_sign(0, dgst[j], dlen[j], sig[j], &siglen[j],
+                               k[i], r[i], eckey[j])) {
+            ERR_pop_to_mark();
+            results[j] = 1;
+        } else {
+            ERR_pop_to_mark();
+            results[j] = ossl_ecdsa_sign(0, dgst[j], dlen[j], sig[j],
+                                         &siglen[j], NULL, NULL, eckey[j]);
+        }
+        BN_clear_free(k[i]);
+        BN_clear_free(r[i]);
+        EC_POINT_free(points[i]);
+    }
+    BN_clear_free(X);
+    BN_CTX_free(ctx);
+}
+
+int ossl_ecdsa_sign_multi(const unsigned char *const dgst[], const int dlen[],
+                          unsigned char *const sig[], unsigned int siglen[],
+                          EC_KEY *const eckey[], size_t num, int *results)
+{
+    const EC_GROUP *group;
+    size_t i, n = 0, idx[ECDSA_MULTI_CHUNK];
+    int ret = 1;
+
+    if (num == 0)
+        return 1;
+
+    group = EC_KEY_get0_group(eckey[0]);
+    for (i = 0; i < num; i++) {
+        if (ecdsa_multi_compatible(group, eckey[i])
+            && EC_KEY_get0_private_key(eckey[i]) != NULL)
+            idx[n++] = i;
+        else
+            results[i] = ECDSA_sign_ex(0, dgst[i], dlen[i], sig[i],
+                                       &siglen[i], NULL, NULL, eckey[i]);
+
+        if (n == ECDSA_MULTI_CHUNK || (n > 0 && i + 1 == num)) {
+            ecdsa_sign_multi_chunk(group, idx, n, dgst, dlen, sig, siglen,
+                                   eckey, results);
+            n = 0;
+        }
+    }
+
+    for (i = 0; i < num; i++)
+        if (results[i] != 1)
+            ret = 0;
+    return ret;
+}
+
+static void ecdsa_verify_multi_chunk(const EC_GROUP *group,
+                                     const size_t idx[], size_t n,
+                                     const unsigned char *const dgst[],
+                                     const int dgst_len[],
+                                     ECDSA_SIG *const sig[],
+                                     EC_KEY *const eckey[], int *results)
+{
+    BIGNUM *u1[ECDSA_MULTI_CHUNK], *u2[ECDSA_MULTI_CHUNK], *X;
+    EC_POINT *points[ECDSA_MULTI_CHUNK];
+    const EC_POINT *pub_keys[ECDSA_MULTI_CHUNK];
+    size_t pos[ECDSA_MULTI_CHUNK];
+    BN_CTX *ctx;
+    const BIGNUM *order = EC_GROUP_get0_order(group);
+    size_t i, m = 0;
+    int ok = 0;
+
+    memset(points, 0, sizeof(points));
+    for (i = 0; i < n; i++)
+        results[idx[i]] = -1;
+
+    ctx = BN_CTX_new_ex(eckey[idx[0]]->libctx);
+    if (ctx == NULL)
+        return;
+    BN_CTX_start(ctx);
+    if ((X = BN_CTX_get(ctx)) == NULL || group->mont_data == NULL)
+        goto end;
+
+    for (i = 0; i < n; i++) {
+        if (!ecdsa_sig_check_range(order, sig[i])) {
+            results[idx[i]] = 0;        /* signature is invalid */
+            continue;
+        }
+        u1[m] = BN_CTX_get(ctx);
+        u2[m] = BN_CTX_get(ctx);
+        if (u2[m] == NULL || BN_copy(u2[m], sig[i]->s) == NULL
+            || (points[m] = EC_POINT_new(group)) == NULL)
+            goto end;
+        pub_keys[m] = EC_KEY_get0_public_key(eckey[idx[i]]);
+        pos[m++] = i;
+    }
+    if (m == 0)
+        goto end;
+
+    /* calculate inv(S) mod order for all of them at once */
+    if (!ecdsa_inverse_ord_multi(group, u2, m, ctx))
+        goto end;
+    for (i = 0; i < m; i++) {
+        if (!ecdsa_verify_scalars(group, dgst[idx[pos[i]]],
+                                  dgst_len[idx[pos[i]]], sig[pos[i]],
+                                  u1[i], u2[i], ctx))
+            goto end;
+    }
+
+    if (!ossl_ec_points_mul_multi(group, points, (const BIGNUM *const *)u1,
+                                  pub_keys, (const BIGNUM *const *)u2, m,
+                                  ctx))
+        goto end;
+    ok = 1;
+
+ end:
+    for (i = 0; i < m; i++) {
+        if (ok) {
+            if (!EC_POINT_get_affine_coordinates(group, points[i], X, NULL,
+                                                 ctx)
+                || !BN_nnmod(u1[i], X, order, ctx))
+                ERR_raise(ERR_LIB_EC, ERR_R_EC_LIB);
+            else
+                /*  if the signature is correct u1 is equal to sig->r */
+                results[idx[pos[i]]] = (BN_ucmp(u1[i], sig[pos[i]]->r) == 0);
+        }
+        EC_POINT_free(points[i]);
+    }
+    if (!ok && m > 0)
+        ERR_raise(ERR_LIB_EC, ERR_R_EC_LIB);
+    BN_CTX_end(ctx);
+    BN_CTX_free(ctx);
+}
+
+int ossl_ecdsa_verify_multi(const unsigned char *const dgst[],
+                            const int dgst_len[],
+                            const unsigned char *const sigbuf[],
+                            const int sig_len[], EC_KEY *const eckey[],
+                            size_t num, int *results)
+{
+    const EC_GROUP *group;
+    ECDSA_SIG *sig[ECDSA_MULTI_CHUNK];
+    size_t i, n = 0, idx[ECDSA_MULTI_CHUNK];
+    int ret = 1;
+
+    if (num == 0)
+        return 1;
+
+    group = EC_KEY_get0_group(eckey[0]);
+    for (i = 0; i < num; i++) {
+        if (!ecdsa_multi_compatible(group, eckey[i])
+            || EC_KEY_get0_public_key(eckey[i]) == NULL)
+            results[i] = ECDSA_verify(0, dgst[i], dgst_len[i], sigbuf[i],
+                                      sig_len[i], eckey[i]);
+        else if ((sig[n] = ecdsa_sig_decode(sigbuf[i], sig_len[i])) == NULL)
+            results[i] = -1;
+        else
+            idx[n++] = i;
+
+        if (n == ECDSA_MULTI_CHUNK || (n > 0 && i + 1 == num)) {
+            ecdsa_verify_multi_chunk(group, idx, n, dgst, dgst_len, sig,
+                                     eckey, results);
+            while (n > 0)
+                ECDSA_SIG_free(sig[--n]);
+        }
+    }
+
+    for (i = 0; i < num; i++)
+        if (results[i] != 1)
+            ret = 0;
+    return ret;
+}
@@ -74,7 +74,14 @@ const EC_METHOD *EC_GFp_mont_method(void)
         ossl_ec_GFp_simple_blind_coordinates,
         ossl_ec_GFp_simple_ladder_pre,
         ossl_ec_GFp_simple_ladder_step,
-        ossl_ec_GFp_simple_ladder_post
+        ossl_ec_GFp_simple_ladder_post,
+#ifdef ECP_NISTP_IFMA
+        ossl_ec_GFp_nistp_ifma_mul_multi_lanes,
+        ossl_ec_GFp_nistp_ifma_points_mul_multi
+#else
+        0, /* mul_multi_lanes */
+        0  /* points_mul_multi */
+#endif
     };
 
     return &ret;
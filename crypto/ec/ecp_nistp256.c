@@ -1833,7 +1833,9 @@ const EC_METHOD *EC_GFp_nistp256_method(void)
         0, /* blind_coordinates */
         0, /* ladder_pre */
         0, /* ladder_step */
-        0  /* ladder_post */
+        0, /* ladder_post */
+        0, /* mul_multi_lanes */
+        0  /* points_mul_multi */
     };
 
     return &ret;
@@ -1725,7 +1725,14 @@ const EC_METHOD *EC_GFp_nistp521_method(void)
         0, /* blind_coordinates */
         0, /* ladder_pre */
         0, /* ladder_step */
-        0  /* ladder_post */
+        0, /* ladder_post */
+#ifdef ECP_NISTP_IFMA
+        ossl_ec_GFp_nistp_ifma_mul_multi_lanes,
+        ossl_ec_GFp_nistp_ifma_points_mul_multi
+#else
+        0, /* mul_multi_lanes */
+        0  /* points_mul_multi */
+#endif
     };
 
     return &ret;
@@ -0,0 +1,878 @@
+/*
+ * Copyright 2024 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * Multi-buffer scalar multiplication on P-384 and P-521 for x86_64
+ * processors with AVX-512 IFMA.
+ *
+ * Eight independent computations are carried out at once, one per 64-bit
+ * lane, by the subroutines in ecp_nistp-ifma-x86_64.pl. Field elements are
+ * kept in radix 2^52, limb j of lane k being at index 8*j+k, in the
+ * Montgomery domain with R = 2^(52*limbs), and are only reduced to
+ * [0, 2*p). Both curves have a = -3, so the point formulas are those of
+ * ecp_nistz256.c.
+ *
+ * Multiples of the default generator are computed in constant time with
+ * the comb tables in ecp_nistp_ifma_table.c. The g*G + p*P part used for
+ * verification is variable time.
+ */
+
+#include <string.h>
+#include <openssl/err.h>
+#include "internal/constant_time.h"
+#include "ec_local.h"
+
+#define NISTP_MULTI_LANES       8
+#define NISTP_MAX_LIMBS         11
+/* Bytes of a scalar, plus one so that windows can run past the top */
+#define NISTP_SCALAR_BYTES      67
+/* Bytes of a field element in radix 2^52, plus slack for 64-bit reads */
+#define NISTP_FE_BYTES          80
+/* Distance between the teeth of the comb */
+#define NISTP_COMB_SPACING      12
+#define NISTP_FE52_MASK         0xfffffffffffff
+
+typedef BN_ULONG NISTP_FE52X8[NISTP_MAX_LIMBS * NISTP_MULTI_LANES];
+
+typedef struct {
+    NISTP_FE52X8 X;
+    NISTP_FE52X8 Y;
+    NISTP_FE52X8 Z;
+} NISTP_POINT_X8;
+
+typedef struct {
+    NISTP_FE52X8 X;
+    NISTP_FE52X8 Y;
+} NISTP_POINT_AFFINE_X8;
+
+typedef struct nistp_ifma_curve_st NISTP_IFMA_CURVE;
+
+struct nistp_ifma_curve_st {
+    int nid;
+    size_t limbs;               /* radix 2^52 limbs of a field element */
+    int bits;                   /* bits of the prime and of the order */
+    size_t comb_tables;         /* subtables of |comb| */
+    const BN_ULONG *poly;       /* the prime, one limb per word */
+    const BN_ULONG *one;        /* R mod p, in all lanes */
+    const BN_ULONG *rr;         /* R^2 mod p, in all lanes */
+    const BN_ULONG *comb;
+    const BIGNUM *(*prime)(void);
+    void (*mul_mont)(BN_ULONG *res, const BN_ULONG *a, const BN_ULONG *b);
+    void (*sqr_mont)(BN_ULONG *res, const BN_ULONG *a);
+    void (*add)(BN_ULONG *res, const BN_ULONG *a, const BN_ULONG *b);
+    void (*sub)(BN_ULONG *res, const BN_ULONG *a, const BN_ULONG *b);
+    void (*div_by_2)(BN_ULONG *res, const BN_ULONG *a);
+    /* Constant time access to a subtable of |comb| */
+    void (*gather16)(BN_ULONG *x, BN_ULONG *y, const BN_ULONG *in_t,
+                     const BN_ULONG idx[NISTP_MULTI_LANES]);
+    void (*mod_inverse)(const NISTP_IFMA_CURVE *c, BN_ULONG *res,
+                        const BN_ULONG *in);
+};
+
+int ecp_nistp_ifma_eligible(void);
+
+void ecp_nistp384_ifma_mul_mont(BN_ULONG *res, const BN_ULONG *a,
+                                const BN_ULONG *b);
+void ecp_nistp384_ifma_sqr_mont(BN_ULONG *res, const BN_ULONG *a);
+void ecp_nistp384_ifma_add(BN_ULONG *res, const BN_ULONG *a,
+                           const BN_ULONG *b);
+void ecp_nistp384_ifma_sub(BN_ULONG *res, const BN_ULONG *a,
+                           const BN_ULONG *b);
+void ecp_nistp384_ifma_div_by_2(BN_ULONG *res, const BN_ULONG *a);
+void ecp_nistp384_ifma_gather16(BN_ULONG *x, BN_ULONG *y,
+                                const BN_ULONG *in_t,
+                                const BN_ULONG idx[NISTP_MULTI_LANES]);
+
+void ecp_nistp521_ifma_mul_mont(BN_ULONG *res, const BN_ULONG *a,
+                                const BN_ULONG *b);
+void ecp_nistp521_ifma_sqr_mont(BN_ULONG *res, const BN_ULONG *a);
+void ecp_nistp521_ifma_add(BN_ULONG *res, const BN_ULONG *a,
+                           const BN_ULONG *b);
+void ecp_nistp521_ifma_sub(BN_ULONG *res, const BN_ULONG *a,
+                           const BN_ULONG *b);
+void ecp_nistp521_ifma_div_by_2(BN_ULONG *res, const BN_ULONG *a);
+void ecp_nistp521_ifma_gather16(BN_ULONG *x, BN_ULONG *y,
+                                const BN_ULONG *in_t,
+                                const BN_ULONG idx[NISTP_MULTI_LANES]);
+
+extern const BN_ULONG ecp_nistp384_ifma_comb[8 * 2 * 8 * 16];
+extern const BN_ULONG ecp_nistp521_ifma_comb[11 * 2 * 11 * 16];
+
+#define X8(x)  x, x, x, x, x, x, x, x
+
+static const BN_ULONG nistp384_poly[8] = {
+    0xffffffff, 0xff00000000000, 0xffffffeffffff, 0xfffffffffffff,
+    0xfffffffffffff, 0xfffffffffffff, 0xfffffffffffff, 0xfffff
+};
+
+/* 2^416 mod p */
+static const BN_ULONG nistp384_one[8 * 8] = {
+    X8(0x100000000), X8(0xffffffffff000), X8(0xffffff), X8(0x10),
+    X8(0), X8(0), X8(0), X8(0)
+};
+
+/* 2^832 mod p */
+static const BN_ULONG nistp384_rr[8 * 8] = {
+    X8(0), X8(0xfe00000001000), X8(0xffffff), X8(0x20),
+    X8(0xfffffffe0000), X8(0x20000000), X8(0x100), X8(0)
+};
+
+static const BN_ULONG nistp521_poly[11] = {
+    0xfffffffffffff, 0xfffffffffffff, 0xfffffffffffff, 0xfffffffffffff,
+    0xfffffffffffff, 0xfffffffffffff, 0xfffffffffffff, 0xfffffffffffff,
+    0xfffffffffffff, 0xfffffffffffff, 0x1
+};
+
+/* 2^572 mod p */
+static const BN_ULONG nistp521_one[11 * 8] = {
+    X8(0x8000000000000), X8(0), X8(0), X8(0), X8(0), X8(0), X8(0), X8(0),
+    X8(0), X8(0), X8(0)
+};
+
+/* 2^1144 mod p */
+static const BN_ULONG nistp521_rr[11 * 8] = {
+    X8(0), X8(0x4000000000000), X8(0), X8(0), X8(0), X8(0), X8(0), X8(0),
+    X8(0), X8(0), X8(0)
+};
+
+/* r = a^(2^n) */
+static void fe52x8_sqr_n(const NISTP_IFMA_CURVE *c, BN_ULONG *r,
+                         const BN_ULONG *a, int n)
+{
+    c->sqr_mont(r, a);
+    while (--n > 0)
+        c->sqr_mont(r, r);
+}
+
+/* r = in^-1 mod p, same addition chain as felem_inv in ecp_nistp384.c */
+static void nistp384_mod_inverse_x8(const NISTP_IFMA_CURVE *c, BN_ULONG *r,
+                                    const BN_ULONG *in)
+{
+    NISTP_FE52X8 t, f2, f3, f4, f5, f6;
+
+    c->sqr_mont(t, in);
+    c->mul_mont(f2, t, in);                 /* 2^2 - 1 */
+    c->sqr_mont(t, f2);
+    c->mul_mont(f3, t, in);                 /* 2^3 - 1 */
+    fe52x8_sqr_n(c, t, f3, 3);
+    c->mul_mont(f4, t, f3);                 /* 2^6 - 1 */
+    fe52x8_sqr_n(c, t, f4, 6);
+    c->mul_mont(t, t, f4);                  /* 2^12 - 1 */
+    fe52x8_sqr_n(c, t, t, 3);
+    c->mul_mont(f5, t, f3);                 /* 2^15 - 1 */
+    fe52x8_sqr_n(c, t, f5, 15);
+    c->mul_mont(f6, t, f5);                 /* 2^30 - 1 */
+    fe52x8_sqr_n(c, t, f6, 30);
+    c->mul_mont(f4, t, f6);                 /* 2^60 - 1 */
+    fe52x8_sqr_n(c, t, f4, 60);
+    c->mul_mont(f4, t, f4);                 /* 2^120 - 1 */
+    fe52x8_sqr_n(c, t, f4, 120);
+    c->mul_mont(t, t, f4);                  /* 2^240 - 1 */
+    fe52x8_sqr_n(c, t, t, 15);
+    c->mul_mont(t, t, f5);                  /* 2^255 - 1 */
+    fe52x8_sqr_n(c, t, t, 31);
+    c->mul_mont(t, t, f6);
+    fe52x8_sqr_n(c, t, t, 2);
+    c->mul_mont(t, t, f2);
+    fe52x8_sqr_n(c, t, t, 94);
+    c->mul_mont(t, t, f6);
+    fe52x8_sqr_n(c, t, t, 2);
+    c->mul_mont(r, t, in);                  /* p - 2 */
+}
+
+/* r = in^-1 mod p, with p - 2 = 2^521 - 3 */
+static void nistp521_mod_inverse_x8(const NISTP_IFMA_CURVE *c, BN_ULONG *r,
+                                    const BN_ULONG *in)
+{
+    NISTP_FE52X8 t, f2, f3, f7;
+    int i;
+
+    c->sqr_mont(t, in);
+    c->mul_mont(f2, t, in);                 /* 2^2 - 1 */
+    c->sqr_mont(t, f2);
+    c->mul_mont(f3, t, in);                 /* 2^3 - 1 */
+    fe52x8_sqr_n(c, t, f2, 2);
+    c->mul_mont(t, t, f2);                  /* 2^4 - 1 */
+    fe52x8_sqr_n(c, f7, t, 3);
+    c->mul_mont(f7, f7, f3);                /* 2^7 - 1 */
+    for (i = 4; i < 512; i *= 2) {
+        fe52x8_sqr_n(c, f3, t, i);
+        c->mul_mont(t, f3, t);              /* 2^(2*i) - 1 */
+    }
+    fe52x8_sqr_n(c, t, t, 7);
+    c->mul_mont(t, t, f7);                  /* 2^519 - 1 */
+    fe52x8_sqr_n(c, t, t, 2);
+    c->mul_mont(r, t, in);                  /* 2^521 - 3 */
+}
+
+static const NISTP_IFMA_CURVE nistp384_ifma = {
+    NID_secp384r1, 8, 384, 8,
+    nistp384_poly, nistp384_one, nistp384_rr, ecp_nistp384_ifma_comb,
+    BN_get0_nist_prime_384,
+    ecp_nistp384_ifma_mul_mont, ecp_nistp384_ifma_sqr_mont,
+    ecp_nistp384_ifma_add, ecp_nistp384_ifma_sub,
+    ecp_nistp384_ifma_div_by_2, ecp_nistp384_ifma_gather16,
+    nistp384_mod_inverse_x8
+};
+
+static const NISTP_IFMA_CURVE nistp521_ifma = {
+    NID_secp521r1, 11, 521, 11,
+    nistp521_poly, nistp521_one, nistp521_rr, ecp_nistp521_ifma_comb,
+    BN_get0_nist_prime_521,
+    ecp_nistp521_ifma_mul_mont, ecp_nistp521_ifma_sqr_mont,
+    ecp_nistp521_ifma_add, ecp_nistp521_ifma_sub,
+    ecp_nistp521_ifma_div_by_2, ecp_nistp521_ifma_gather16,
+    nistp521_mod_inverse_x8
+};
+
+/* Sets lane |k| of |r| to |in|, which must be below 2^(52*limbs) */
+static int fe52x8_set_lane(const NISTP_IFMA_CURVE *c, BN_ULONG *r, size_t k,
+                           const BIGNUM *in)
+{
+    unsigned char buf[NISTP_FE_BYTES];
+    uint64_t v;
+    size_t i, j, off;
+
+    if (BN_bn2lebinpad(in, buf, sizeof(buf)) < 0)
+        return 0;
+
+    for (j = 0; j < c->limbs; j++) {
+        off = 52 * j / 8;
+        for (v = 0, i = 0; i < 8; i++)
+            v |= (uint64_t)buf[off + i] << (8 * i);
+        r[8 * j + k] = (v >> (52 * j % 8)) & NISTP_FE52_MASK;
+    }
+
+    return 1;
+}
+
+/* Extracts lane |k| of |a| fully reduced, in constant time */
+static void fe52x8_get_lane(const NISTP_IFMA_CURVE *c,
+                            BN_ULONG out[NISTP_MAX_LIMBS], const BN_ULONG *a,
+                            size_t k)
+{
+    BN_ULONG t[NISTP_MAX_LIMBS], borrow = 0, mask;
+    size_t j;
+
+    for (j = 0; j < c->limbs; j++) {
+        out[j] = a[8 * j + k];
+        t[j] = out[j] - c->poly[j] - borrow;
+        borrow = t[j] >> (BN_BITS2 - 1);
+        t[j] &= NISTP_FE52_MASK;
+    }
+    /* keep |out| if it is less than p */
+    mask = 0 - borrow;
+    for (j = 0; j < c->limbs; j++)
+        out[j] = (out[j] & mask) | (t[j] & ~mask);
+}
+
+/* Converts lane |k| of |a| to a BIGNUM */
+static int fe52x8_get_lane_bn(const NISTP_IFMA_CURVE *c, BIGNUM *out,
+                              const BN_ULONG *a, size_t k)
+{
+    unsigned char buf[NISTP_FE_BYTES];
+    BN_ULONG v[NISTP_MAX_LIMBS];
+    uint64_t x;
+    size_t i, j, off;
+
+    fe52x8_get_lane(c, v, a, k);
+
+    memset(buf, 0, sizeof(buf));
+    for (j = 0; j < c->limbs; j++) {
+        off = 52 * j / 8;
+        x = (uint64_t)v[j] << (52 * j % 8);
+        for (i = 0; i < 8; i++)
+            buf[off + i] |= (unsigned char)(x >> (8 * i));
+    }
+
+    return BN_lebin2bn(buf, sizeof(buf), out) != NULL;
+}
+
+/* Returns the mask of lanes in which |a| is zero modulo p */
+static unsigned int fe52x8_is_zero(const NISTP_IFMA_CURVE *c,
+                                   const BN_ULONG *a)
+{
+    unsigned int ret = 0;
+    BN_ULONG z, p;
+    size_t j, k;
+
+    for (k = 0; k < NISTP_MULTI_LANES; k++) {
+        z = p = 0;
+        for (j = 0; j < c->limbs; j++) {
+            z |= a[8 * j + k];
+            p |= a[8 * j + k] ^ c->poly[j];
+        }
+        ret |= (unsigned int)(constant_time_is_zero_64(z)
+                              | constant_time_is_zero_64(p)) & (1U << k);
+    }
+
+    return ret;
+}
+
+static void fe52x8_copy_conditional(const NISTP_IFMA_CURVE *c,
+                                    BN_ULONG *dst, const BN_ULONG *src,
+                                    unsigned int lanes)
+{
+    BN_ULONG mask;
+    size_t j, k;
+
+    for (k = 0; k < NISTP_MULTI_LANES; k++) {
+        mask = 0 - (BN_ULONG)((lanes >> k) & 1);
+        for (j = 0; j < c->limbs; j++)
+            dst[8 * j + k] = (src[8 * j + k] & mask)
+                             ^ (dst[8 * j + k] & ~mask);
+    }
+}
+
+static void nistp_point_copy_conditional_x8(const NISTP_IFMA_CURVE *c,
+                                            NISTP_POINT_X8 *dst,
+                                            const NISTP_POINT_X8 *src,
+                                            unsigned int lanes)
+{
+    fe52x8_copy_conditional(c, dst->X, src->X, lanes);
+    fe52x8_copy_conditional(c, dst->Y, src->Y, lanes);
+    fe52x8_copy_conditional(c, dst->Z, src->Z, lanes);
+}
+
+/* Point double: r = 2*a */
+static void nistp_point_double_x8(const NISTP_IFMA_CURVE *c,
+                                  NISTP_POINT_X8 *r, const NISTP_POINT_X8 *a)
+{
+    NISTP_FE52X8 S, M, Zsqr, tmp0;
+
+    c->add(S, a->Y, a->Y);
+
+    c->sqr_mont(Zsqr, a->Z);
+
+    c->sqr_mont(S, S);
+
+    c->mul_mont(r->Z, a->Z, a->Y);
+    c->add(r->Z, r->Z, r->Z);
+
+    c->add(M, a->X, Zsqr);
+    c->sub(Zsqr, a->X, Zsqr);
+
+    c->sqr_mont(r->Y, S);
+    c->div_by_2(r->Y, r->Y);
+
+    c->mul_mont(M, M, Zsqr);
+    c->add(tmp0, M, M);
+    c->add(M, tmp0, M);
+
+    c->mul_mont(S, S, a->X);
+    c->add(tmp0, S, S);
+
+    c->sqr_mont(r->X, M);
+
+    c->sub(r->X, r->X, tmp0);
+    c->sub(S, S, r->X);
+
+    c->mul_mont(S, S, M);
+    c->sub(r->Y, S, r->Y);
+}
+
+/*
+ * Point addition: r = a+b. Lanes in which a and b are equal are doubled,
+ * which is not constant-time, so this is only used with public inputs.
+ */
+static void nistp_point_add_x8(const NISTP_IFMA_CURVE *c, NISTP_POINT_X8 *r,
+                               const NISTP_POINT_X8 *a,
+                               const NISTP_POINT_X8 *b)
+{
+    NISTP_FE52X8 U2, S2, U1, S1, Z1sqr, Z2sqr, H, R, Hsqr, Rsqr, Hcub;
+    NISTP_POINT_X8 res;
+    unsigned int in1infty, in2infty, equal;
+
+    in1infty = fe52x8_is_zero(c, a->Z);
+    in2infty = fe52x8_is_zero(c, b->Z);
+
+    c->sqr_mont(Z2sqr, b->Z);               /* Z2^2 */
+    c->sqr_mont(Z1sqr, a->Z);               /* Z1^2 */
+
+    c->mul_mont(S1, Z2sqr, b->Z);           /* S1 = Z2^3 */
+    c->mul_mont(S2, Z1sqr, a->Z);           /* S2 = Z1^3 */
+
+    c->mul_mont(S1, S1, a->Y);              /* S1 = Y1*Z2^3 */
+    c->mul_mont(S2, S2, b->Y);              /* S2 = Y2*Z1^3 */
+    c->sub(R, S2, S1);                      /* R = S2 - S1 */
+
+    c->mul_mont(U1, a->X, Z2sqr);           /* U1 = X1*Z2^2 */
+    c->mul_mont(U2, b->X, Z1sqr);           /* U2 = X2*Z1^2 */
+    c->sub(H, U2, U1);                      /* H = U2 - U1 */
+
+    equal = fe52x8_is_zero(c, H) & fe52x8_is_zero(c, R)
+            & ~in1infty & ~in2infty;
+
+    c->sqr_mont(Rsqr, R);                   /* R^2 */
+    c->mul_mont(res.Z, H, a->Z);            /* Z3 = H*Z1*Z2 */
+    c->sqr_mont(Hsqr, H);                   /* H^2 */
+    c->mul_mont(res.Z, res.Z, b->Z);        /* Z3 = H*Z1*Z2 */
+    c->mul_mont(Hcub, Hsqr, H);             /* H^3 */
+
+    c->mul_mont(U2, U1, Hsqr);              /* U1*H^2 */
+    c->add(Hsqr, U2, U2);                   /* 2*U1*H^2 */
+
+    c->sub(res.X, Rsqr, Hsqr);
+    c->sub(res.X, res.X, Hcub);
+
+    c->sub(res.Y, U2, res.X);
+
+    c->mul_mont(S2, S1, Hcub);
+    c->mul_mont(res.Y, R, res.Y);
+    c->sub(res.Y, res.Y, S2);
+
+    nistp_point_copy_conditional_x8(c, &res, b, in1infty);
+    nistp_point_copy_conditional_x8(c, &res, a, in2infty);
+
+    if (equal != 0) {
+        NISTP_POINT_X8 dbl;
+
+        nistp_point_double_x8(c, &dbl, a);
+        nistp_point_copy_conditional_x8(c, &res, &dbl, equal);
+    }
+
+    memcpy(r, &res, sizeof(res));
+}
+
+/* Point addition when b is known to be affine: r = a+b */
+static void nistp_point_add_affine_x8(const NISTP_IFMA_CURVE *c,
+                                      NISTP_POINT_X8 *r,
+                                      const NISTP_POINT_X8 *a,
+                                      const NISTP_POINT_AFFINE_X8 *b)
+{
+    NISTP_FE52X8 U2, S2, Z1sqr, H, R, Hsqr, Rsqr, Hcub;
+    NISTP_POINT_X8 res;
+    unsigned int in1infty, in2infty;
+
+    in1infty = fe52x8_is_zero(c, a->Z);
+    /* In affine representation infinity is encoded as (0,0) */
+    in2infty = fe52x8_is_zero(c, b->X) & fe52x8_is_zero(c, b->Y);
+
+    c->sqr_mont(Z1sqr, a->Z);               /* Z1^2 */
+
+    c->mul_mont(U2, b->X, Z1sqr);           /* U2 = X2*Z1^2 */
+    c->sub(H, U2, a->X);                    /* H = U2 - U1 */
+
+    c->mul_mont(S2, Z1sqr, a->Z);           /* S2 = Z1^3 */
+
+    c->mul_mont(res.Z, H, a->Z);            /* Z3 = H*Z1*Z2 */
+
+    c->mul_mont(S2, S2, b->Y);              /* S2 = Y2*Z1^3 */
+    c->sub(R, S2, a->Y);                    /* R = S2 - S1 */
+
+    c->sqr_mont(Hsqr, H);                   /* H^2 */
+    c->sqr_mont(Rsqr, R);                   /* R^2 */
+    c->mul_mont(Hcub, Hsqr, H);             /* H^3 */
+
+    c->mul_mont(U2, a->X, Hsqr);            /* U1*H^2 */
+    c->add(Hsqr, U2, U2);                   /* 2*U1*H^2 */
+
+    c->sub(res.X, Rsqr, Hsqr);
+    c->sub(res.X, res.X, Hcub);
+    c->sub(H, U2, res.X);
+
+    c->mul_mont(S2, a->Y, Hcub);
+    c->mul_mont(H, H, R);
+    c->sub(res.Y, H, S2);
+
+    fe52x8_copy_conditional(c, res.X, b->X, in1infty);
+    fe52x8_copy_conditional(c, res.X, a->X, in2infty);
+
+    fe52x8_copy_conditional(c, res.Y, b->Y, in1infty);
+    fe52x8_copy_conditional(c, res.Y, a->Y, in2infty);
+
+    fe52x8_copy_conditional(c, res.Z, c->one, in1infty);
+    fe52x8_copy_conditional(c, res.Z, a->Z, in2infty);
+
+    memcpy(r, &res, sizeof(res));
+}
+
+/* Little-endian encoding of |scalar|, reduced modulo the order if needed */
+__owur static int nistp_ifma_scalar_to_str(const NISTP_IFMA_CURVE *c,
+                                           unsigned char str[NISTP_SCALAR_BYTES],
+                                           const BIGNUM *scalar,
+                                           const EC_GROUP *group, BN_CTX *ctx)
+{
+    BIGNUM *mod;
+
+    /* This is an unusual input, we don't guarantee constant-timeness. */
+    if ((BN_num_bits(scalar) > c->bits) || BN_is_negative(scalar)) {
+        if ((mod = BN_CTX_get(ctx)) == NULL
+            || !BN_nnmod(mod, scalar, group->order, ctx)) {
+            ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+            return 0;
+        }
+        scalar = mod;
+    }
+
+    return BN_bn2lebinpad(scalar, str, NISTP_SCALAR_BYTES)
+           == NISTP_SCALAR_BYTES;
+}
+
+/*
+ * r[k] = scalar[k]*G for all lanes, with the comb tables for the default
+ * generator. At step i each subtable contributes the point selected by
+ * the scalar bits at 12*(4*t + m) + i, for m = 0..3. Lanes without a
+ * scalar are left at infinity.
+ */
+static void nistp_ifma_base_mul_x8(const NISTP_IFMA_CURVE *c,
+                                   NISTP_POINT_X8 *r,
+                                   unsigned char str[][NISTP_SCALAR_BYTES],
+                                   size_t num)
+{
+    const size_t stride = 2 * c->limbs * 16;
+    BN_ULONG digit[NISTP_MULTI_LANES];
+    NISTP_POINT_AFFINE_X8 b;
+    size_t t, k, m, pos;
+    int i;
+
+    memset(r, 0, sizeof(*r));
+    memset(digit, 0, sizeof(digit));
+
+    for (i = NISTP_COMB_SPACING - 1; i >= 0; i--) {
+        if (i != NISTP_COMB_SPACING - 1)
+            nistp_point_double_x8(c, r, r);
+
+        for (t = 0; t < c->comb_tables; t++) {
+            for (k = 0; k < num; k++) {
+                digit[k] = 0;
+                for (m = 0; m < 4; m++) {
+                    pos = (4 * t + m) * NISTP_COMB_SPACING + i;
+                    digit[k] |= (BN_ULONG)((str[k][pos / 8] >> (pos % 8)) & 1)
+                                << m;
+                }
+            }
+            c->gather16(b.X, b.Y, c->comb + t * stride, digit);
+            nistp_point_add_affine_x8(c, r, r, &b);
+        }
+    }
+
+    OPENSSL_cleanse(digit, sizeof(digit));
+    OPENSSL_cleanse(&b, sizeof(b));
+}
+
+static unsigned int nistp_booth_recode_w5(unsigned int in)
+{
+    unsigned int s, d;
+
+    s = ~((in >> 5) - 1);
+    d = (1 << 6) - in - 1;
+    d = (d & s) | (in & ~s);
+    d = (d >> 1) + (d & 1);
+
+    return (d << 1) + (s & 1);
+}
+
+/*
+ * r[k] = scalar[k]*point[k] for all lanes, with |table| holding 1..16
+ * times the points. Not constant-time.
+ */
+static void nistp_ifma_windowed_mul_x8(const NISTP_IFMA_CURVE *c,
+                                       NISTP_POINT_X8 *r,
+                                       const NISTP_POINT_X8 table[16],
+                                       unsigned char str[][NISTP_SCALAR_BYTES],
+                                       size_t num)
+{
+    const unsigned int window_size = 5;
+    const unsigned int mask = (1 << (window_size + 1)) - 1;
+    unsigned int wvalue, idx, off, neg;
+    NISTP_FE52X8 zero, negY;
+    NISTP_POINT_X8 t;
+    size_t j, k;
+    int i;
+
+    memset(r, 0, sizeof(*r));
+    memset(zero, 0, sizeof(zero));
+
+    for (idx = c->bits / window_size * window_size; ; idx -= window_size) {
+        memset(&t, 0, sizeof(t));
+        neg = 0;
+        for (k = 0; k < num; k++) {
+            if (idx == 0) {
+                wvalue = (str[k][0] << 1) & mask;
+            } else {
+                off = (idx - 1) / 8;
+                wvalue = str[k][off] | str[k][off + 1] << 8;
+                wvalue = (wvalue >> ((idx - 1) % 8)) & mask;
+            }
+            wvalue = nistp_booth_recode_w5(wvalue);
+
+            if ((wvalue >> 1) == 0)
+                continue;
+            for (j = k; j < c->limbs * NISTP_MULTI_LANES;
+                 j += NISTP_MULTI_LANES) {
+                t.X[j] = table[(wvalue >> 1) - 1].X[j];
+                t.Y[j] = table[(wvalue >> 1) - 1].Y[j];
+                t.Z[j] = table[(wvalue >> 1) - 1].Z[j];
+            }
+            neg |= (wvalue & 1) << k;
+        }
+        c->sub(negY, zero, t.Y);
+        fe52x8_copy_conditional(c, t.Y, negY, neg);
+
+        nistp_point_add_x8(c, r, r, &t);
+
+        if (idx == 0)
+            break;
+        for (i = 0; i < (int)window_size; i++)
+            nistp_point_double_x8(c, r, r);
+    }
+}
+
+/* Sets lane |k| of |r| to a coordinate of a point of |group| */
+__owur static int nistp_ifma_set_coordinate(const NISTP_IFMA_CURVE *c,
+                                            const EC_GROUP *group,
+                                            BN_ULONG *r, size_t k,
+                                            const BIGNUM *in, BIGNUM *tmp,
+                                            BN_CTX *ctx)
+{
+    if (group->meth->field_decode != NULL) {
+        if (!group->meth->field_decode(group, tmp, in, ctx))
+            return 0;
+        in = tmp;
+    }
+    if (BN_is_negative(in) || BN_num_bits(in) > c->bits) {
+        ERR_raise(ERR_LIB_EC, EC_R_COORDINATES_OUT_OF_RANGE);
+        return 0;
+    }
+
+    return fe52x8_set_lane(c, r, k, in);
+}
+
+/* Stores the lanes of |a| below |num| to r[] in affine coordinates */
+__owur static int nistp_ifma_set_from_x8(const NISTP_IFMA_CURVE *c,
+                                         const EC_GROUP *group, EC_POINT *r[],
+                                         NISTP_POINT_X8 *a, size_t num,
+                                         BN_CTX *ctx)
+{
+    NISTP_FE52X8 zinv, t;
+    BIGNUM *x, *y;
+    unsigned int infty;
+    size_t k;
+
+    x = BN_CTX_get(ctx);
+    y = BN_CTX_get(ctx);
+    if (y == NULL)
+        return 0;
+
+    infty = fe52x8_is_zero(c, a->Z);
+
+    c->mod_inverse(c, zinv, a->Z);
+    c->sqr_mont(t, zinv);
+    c->mul_mont(a->X, a->X, t);
+    c->mul_mont(t, t, zinv);
+    c->mul_mont(a->Y, a->Y, t);
+
+    /* leave the Montgomery domain */
+    memset(t, 0, sizeof(t));
+    for (k = 0; k < NISTP_MULTI_LANES; k++)
+        t[k] = 1;
+    c->mul_mont(a->X, a->X, t);
+    c->mul_mont(a->Y, a->Y, t);
+
+    for (k = 0; k < num; k++) {
+        if ((infty >> k) & 1) {
+            if (!EC_POINT_set_to_infinity(group, r[k]))
+                return 0;
+            continue;
+        }
+        if (!fe52x8_get_lane_bn(c, x, a->X, k)
+            || !fe52x8_get_lane_bn(c, y, a->Y, k)
+            || !group->meth->point_set_affine_coordinates(group, r[k], x, y,
+                                                          ctx))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* r[k] = g_scalars[k]*G + p_scalars[k]*points[k] for k < num <= 8 */
+__owur static int nistp_ifma_points_mul_x8(const NISTP_IFMA_CURVE *c,
+                                           const EC_GROUP *group,
+                                           EC_POINT *r[],
+                                           const BIGNUM *const g_scalars[],
+                                           const EC_POINT *const points[],
+                                           const BIGNUM *const p_scalars[],
+                                           size_t num, BN_CTX *ctx)
+{
+    unsigned char g_str[NISTP_MULTI_LANES][NISTP_SCALAR_BYTES];
+    unsigned char p_str[NISTP_MULTI_LANES][NISTP_SCALAR_BYTES];
+    NISTP_POINT_X8 acc, *table = NULL;
+    BIGNUM *tmp;
+    size_t k;
+    int i, ret = 0;
+
+    BN_CTX_start(ctx);
+
+    for (k = 0; k < num; k++)
+        if (!nistp_ifma_scalar_to_str(c, g_str[k], g_scalars[k], group, ctx))
+            goto err;
+    nistp_ifma_base_mul_x8(c, &acc, g_str, num);
+
+    if (points != NULL) {
+        /* place for 1..16 times the points, and their sum */
+        table = OPENSSL_zalloc(17 * sizeof(NISTP_POINT_X8));
+        if (table == NULL || (tmp = BN_CTX_get(ctx)) == NULL)
+            goto err;
+
+        for (k = 0; k < num; k++) {
+            if (!nistp_ifma_scalar_to_str(c, p_str[k], p_scalars[k], group,
+                                          ctx)
+                || !nistp_ifma_set_coordinate(c, group, table[0].X, k,
+                                              points[k]->X, tmp, ctx)
+                || !nistp_ifma_set_coordinate(c, group, table[0].Y, k,
+                                              points[k]->Y, tmp, ctx)
+                || !nistp_ifma_set_coordinate(c, group, table[0].Z, k,
+                                              points[k]->Z, tmp, ctx))
+                goto err;
+        }
+        c->mul_mont(table[0].X, table[0].X, c->rr);
+        c->mul_mont(table[0].Y, table[0].Y, c->rr);
+        c->mul_mont(table[0].Z, table[0].Z, c->rr);
+
+        for (i = 2; i <= 16; i++) {
+            if ((i & 1) == 0)
+                nistp_point_double_x8(c, &table[i - 1], &table[i / 2 - 1]);
+            else
+                nistp_point_add_x8(c, &table[i - 1], &table[i - 2],
+                                   &table[0]);
+        }
+
+        nistp_ifma_windowed_mul_x8(c, &table[16], table, p_str, num);
+        nistp_point_add_x8(c, &acc, &acc, &table[16]);
+    }
+
+    ret = nistp_ifma_set_from_x8(c, group, r, &acc, num, ctx);
+
+ err:
+    BN_CTX_end(ctx);
+    OPENSSL_cleanse(g_str, sizeof(g_str));
+    OPENSSL_cleanse(&acc, sizeof(acc));
+    OPENSSL_free(table);
+    return ret;
+}
+
+/*
+ * Returns the curve of |group|, if it is P-384 or P-521 with a = -3, or
+ * NULL otherwise
+ */
+static const NISTP_IFMA_CURVE *nistp_ifma_curve(const EC_GROUP *group)
+{
+    const NISTP_IFMA_CURVE *c;
+
+    switch (group->curve_name) {
+    case NID_secp384r1:
+        c = &nistp384_ifma;
+        break;
+    case NID_secp521r1:
+        c = &nistp521_ifma;
+        break;
+    default:
+        return NULL;
+    }
+    if (!group->a_is_minus3 || BN_cmp(group->field, c->prime()) != 0)
+        return NULL;
+
+    return c;
+}
+
+/* Checks that the generator of |group| is the one of the comb tables */
+static int nistp_ifma_is_default_generator(const NISTP_IFMA_CURVE *c,
+                                           const EC_GROUP *group,
+                                           BN_CTX *ctx)
+{
+    NISTP_FE52X8 x, y;
+    BN_ULONG vx[NISTP_MAX_LIMBS], vy[NISTP_MAX_LIMBS];
+    BIGNUM *bx, *by;
+    size_t j;
+    int ret = 0;
+
+    if (group->generator == NULL)
+        return 0;
+
+    BN_CTX_start(ctx);
+    bx = BN_CTX_get(ctx);
+    by = BN_CTX_get(ctx);
+    if (by == NULL
+        || !EC_POINT_get_affine_coordinates(group, group->generator, bx, by,
+                                            ctx)
+        || BN_num_bits(bx) > c->bits || BN_num_bits(by) > c->bits)
+        goto end;
+
+    memset(x, 0, sizeof(x));
+    memset(y, 0, sizeof(y));
+    if (!fe52x8_set_lane(c, x, 0, bx) || !fe52x8_set_lane(c, y, 0, by))
+        goto end;
+    c->mul_mont(x, x, c->rr);
+    c->mul_mont(y, y, c->rr);
+    fe52x8_get_lane(c, vx, x, 0);
+    fe52x8_get_lane(c, vy, y, 0);
+
+    /* G is entry 1 of subtable 0 */
+    ret = 1;
+    for (j = 0; j < c->limbs; j++) {
+        if (vx[j] != c->comb[16 * j + 1]
+            || vy[j] != c->comb[16 * (c->limbs + j) + 1])
+            ret = 0;
+    }
+
+ end:
+    BN_CTX_end(ctx);
+    return ret;
+}
+
+size_t ossl_ec_GFp_nistp_ifma_mul_multi_lanes(const EC_GROUP *group)
+{
+    const NISTP_IFMA_CURVE *c = nistp_ifma_curve(group);
+    BN_CTX *ctx;
+    int ok;
+
+    if (c == NULL || !ecp_nistp_ifma_eligible())
+        return 1;
+
+    /* Only multiples of the standard generator can be computed together */
+    if ((ctx = BN_CTX_new_ex(group->libctx)) == NULL)
+        return 1;
+    ok = nistp_ifma_is_default_generator(c, group, ctx);
+    BN_CTX_free(ctx);
+
+    return ok ? NISTP_MULTI_LANES : 1;
+}
+
+int ossl_ec_GFp_nistp_ifma_points_mul_multi(const EC_GROUP *group,
+                                            EC_POINT *r[],
+                                            const BIGNUM *const g_scalars[],
+                                            const EC_POINT *const points[],
+                                            const BIGNUM *const p_scalars[],
+                                            size_t num, BN_CTX *ctx)
+{
+    const NISTP_IFMA_CURVE *c = nistp_ifma_curve(group);
+    size_t i, n;
+
+    if (c == NULL || !nistp_ifma_is_default_generator(c, group, ctx)) {
+        for (i = 0; i < num; i++) {
+            if (!EC_POINT_mul(group, r[i], g_scalars[i],
+                              points != NULL ? points[i] : NULL,
+                              points != NULL ? p_scalars[i] : NULL, ctx))
+                return 0;
+        }
+        return 1;
+    }
+
+    for (i = 0; i < num; i += n) {
+        n = num - i < NISTP_MULTI_LANES ? num - i : NISTP_MULTI_LANES;
+        if (!nistp_ifma_points_mul_x8(c, group, r + i, g_scalars + i,
+                                      points != NULL ? points + i : NULL,
+                                      points != NULL ? p_scalars + i : NULL,
+                                      n, ctx))
+            return 0;
+    }
+
+    return 1;
+}
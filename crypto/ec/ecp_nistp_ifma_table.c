@@ -0,0 +1,1527 @@
+/*
+ * Copyright 2024 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * These are the precomputed comb tables for the code in ecp_nistp_ifma.c,
+ * for the default generators of P-384 and P-521. The scalar is split into
+ * teeth of 12 bits, and subtable t holds the 16 affine points
+ *     b0*2^(48*t)*G + b1*2^(48*t+12)*G + b2*2^(48*t+24)*G + b3*2^(48*t+36)*G
+ * for b = b3*8 + b2*4 + b1*2 + b0, with b = 0 being (0,0). There are 8
+ * subtables for P-384 and 11 for P-521, as ceil(521/48) = 11.
+ *
+ * Coordinates are in the Montgomery domain with R = 2^416 and 2^572
+ * respectively, in radix 2^52 with eight and eleven limbs. Each subtable
+ * is stored limb by limb for ecp_nistpNNN_ifma_gather16(): first limb 0
+ * of the 16 x coordinates, then limb 1, and so on, followed by the y
+ * coordinates in the same order.
+ */
+
+#include <openssl/bn.h>
+
+#if defined(__GNUC__)
+__attribute((aligned(64)))
+#elif defined(_MSC_VER)
+__declspec(align(64))
+#elif defined(__SUNPRO_C)
+# pragma align 64(ecp_nistp384_ifma_comb)
+#endif
+extern const BN_ULONG ecp_nistp384_ifma_comb[8 * 2 * 8 * 16];
+const BN_ULONG ecp_nistp384_ifma_comb[8 * 2 * 8 * 16] = {
+    0x0000000000000, 0x607664d3aadc2, 0x6766eb19e084c, 0xc064f852d3515,
+    0xe98d9a0583230, 0xb40ebc8c77432, 0x0c272dbcb1d35, 0x0c0f0ed80a8b4,
+    0xb550138d02bd3, 0xf9b981b4973a6, 0xd84d8b85142a7, 0x420751e5072bf,
+    0x6802544187c90, 0x22edf784fbcf3, 0xf6a100778d0db, 0xd096aefca0fe0,
+    0x0000000000000, 0xfa3dd07565fc8, 0x28eb06571b5db, 0x516beca6b3e49,
+    0xf77d27d71f312, 0xdafb0680304e6, 0x911e3b3b0a10b, 0xa6073152a0ebd,
+    0x38148bd39cbc2, 0x2b63aada6fecc, 0x5cac0dc64cbfc, 0xad32fbfea66ef,
+    0x2599fcf8235e3, 0x3c6583cf33e3c, 0xdfebdfe27dec4, 0x1aef6f71c475e,
+    0x0000000000000, 0xe1e26a4ee117b, 0x430cbda13e4c9, 0x78158368718ed,
+    0x823b17edc1a45, 0x375dfd9b2fd15, 0xdcd36a199956d, 0xd335b8aa6ac3d,
+    0xf6b4c6038c07a, 0x7ae1c02b289e1, 0x4b82154876294, 0xa66dc8b85c419,
+    0x2b85c48eef8c3, 0x6d0b933229d60, 0x9e9084ae6500c, 0x7645a94e7de3c,
+    0x0000000000000, 0x3afc541b4d6e6, 0x966726eed225a, 0xaff426d5f940f,
+    0xafeb6075b2d00, 0xf89d131b7013b, 0x3782e22d41aa8, 0x864392a97cbca,
+    0xfbe2ce5484157, 0xe6bf2cfd1c7e1, 0xe89983b3c2002, 0xe03401f8514eb,
+    0xd59bd6606ef2b, 0xcb6207595fb7a, 0xb87dc870630a4, 0xeaf853abcdb37,
+    0x0000000000000, 0x459a30eff879c, 0x46100e387a185, 0x6cf8958a7d0e5,
+    0x6d93a06f7418c, 0xd9c7921bb3369, 0xe1dcb612a17ca, 0x0fd272079e46c,
+    0xc87fdde9ff397, 0x79ee916b8d852, 0x0c24d03dcb779, 0x37b8f305114c4,
+    0xaa67de2920a23, 0x9208b454ff0de, 0x4263b2e2ee127, 0xbc7ea3a444e77,
+    0x0000000000000, 0x4ede2b6454868, 0x6298d18d9e56e, 0xafa1a059c3b84,
+    0xd001b9c0d691e, 0x82287ec43f14a, 0xdbd26b75d48fa, 0x5a1bdf51bb5e4,
+    0xe9c179441e5c2, 0xbb4c6ee6e37be, 0xb2042ae5e6cb1, 0x8acb72ff2356e,
+    0x51b8ef386379a, 0x8ef647b66172e, 0xf7b828b169faa, 0xbd08c27e98ea4,
+    0x0000000000000, 0x513812ff72361, 0xad0470506b9dc, 0xabfedf8a51fa2,
+    0x7b9c16a95259d, 0x738829ee955f3, 0x36195a31fc59a, 0xade16ab5928de,
+    0xc716366b49ffe, 0xa2f3aa68ce8f3, 0xad4f6378452c5, 0xddd4d8db8bce4,
+    0xe8d9d5c9b81e7, 0x22a6859b2993f, 0xe1b893f017724, 0x922c283722b31,
+    0x0000000000000, 0x00000000299e1, 0x00000000f3350, 0x000000008e9c0,
+    0x00000000026f1, 0x000000000526b, 0x0000000003f46, 0x00000000ea571,
+    0x000000002938d, 0x0000000037c6f, 0x00000000b0e14, 0x00000000ee582,
+    0x00000000549f2, 0x00000000098aa, 0x0000000082e20, 0x00000000ae1f7,
+    0x0000000000000, 0xaf93c2b78abc2, 0x9595e79f27f3a, 0x326b1e88eece5,
+    0xb72219cfa1dea, 0xe3b941aef83f0, 0xc6385ef0a5d97, 0x8a5efcf218f25,
+    0x8a64bcbf3adf9, 0x2bdeec7e8a9de, 0xa9e8a1ddef7ff, 0xb69a2493be29e,
+    0x4c8c12edd316c, 0xc1f3be7a7e496, 0x430ff6bff4391, 0x7fe3decd2cef0,
+    0x0000000000000, 0x6e23043dad1f8, 0x6683eb62a798b, 0xefc0464b1d89d,
+    0x984c1041afdb4, 0xc306d26e7bc4a, 0xe6ee82a05266d, 0xeabd953906e36,
+    0xd026d450f9f8a, 0x0e812d3dc3add, 0x5dfb034d9ca10, 0x3734566a6068f,
+    0x3a93cd58aeaff, 0x2dabd6f9d3de1, 0x71d969b884007, 0xc421019ccc4ec,
+    0x0000000000000, 0xd385481a72d55, 0xae3d2069c14b3, 0x625ea56641b09,
+    0x56e257be49c48, 0xdad671918bf4d, 0x0e6bd7c3f114e, 0xb78ddd851ee5a,
+    0x15da756f71781, 0x3d87dca82d82e, 0x4db4f68d3928c, 0x5ed68e4c7a295,
+    0x508f3299abaa7, 0x948eee04976e6, 0x836dd40a1aff6, 0xfb3301394bcb7,
+    0x0000000000000, 0xe7562e83b050c, 0xe880e1bd4a82e, 0x18eb705ef8fb6,
+    0xefd62c1758e9c, 0x3c9ecb6b08819, 0x15738b804c0e8, 0xe0bacb53cfaa8,
+    0xbf4d298fd8771, 0xa5f383e31cd06, 0x94612002c7112, 0x2936bc7319186,
+    0xb4f9df6829405, 0xb6455862dc9d5, 0x4c6b290619d65, 0x2251d58f22978,
+    0x0000000000000, 0x968f4ffd98bad, 0xfcaf3b3fcb089, 0xd4bc7e05b2fe9,
+    0x7e6c3229a8d08, 0x425730ac90e67, 0xd10face36a73e, 0x5956d766054a4,
+    0x7544768b65f68, 0x5960ca373996f, 0x3058492179be5, 0xaadce4ab2d67f,
+    0x9a8e49a0cab49, 0x10ef8987767c5, 0xd7b2485a98535, 0x877d2dd932f0f,
+    0x0000000000000, 0x69a840c6c3521, 0xffd65cd4d1e70, 0x0500f986200be,
+    0x2d89249cc6f20, 0x09a3529278314, 0x09ddf57c7e3e7, 0xbffec48c2e71b,
+    0x491267e86df04, 0x4d67951791199, 0xbe7a23726859b, 0x257e4d8eb2b63,
+    0xbe4e4e368bc82, 0xe510435bb5ea5, 0xba0918ec340ee, 0xd3620e3fc1636,
+    0x0000000000000, 0x5e9dd80022639, 0xebbd0b1ec6395, 0xda323b47387f6,
+    0xfe7ec69e90208, 0x0032bb3319606, 0xdccb93928b950, 0xac4784f0e1fd1,
+    0x71a40b69a32f8, 0x49149417b4bec, 0x7de63cdcb8320, 0x0a2f70742d9f6,
+    0x0ba21365959aa, 0x420e4d43277d9, 0xf76671c6ba315, 0xdc2776217cecc,
+    0x0000000000000, 0x000000005a15c, 0x000000009b184, 0x000000006a1c1,
+    0x00000000f331d, 0x00000000c978d, 0x0000000035cc4, 0x0000000058f02,
+    0x00000000f917c, 0x0000000023a5a, 0x0000000026419, 0x000000009fc14,
+    0x00000000e3ef1, 0x0000000083772, 0x0000000056488, 0x000000002b0db,
+    0x0000000000000, 0xff6bf222c5c9c, 0xc2532e44da930, 0xccc7506a37ad2,
+    0x4ea16a709d85d, 0x3f05edb68c428, 0x741a359a9e3b0, 0xbb471cb9306dc,
+    0xf8f632d3f21bf, 0xbd8fd26c007d2, 0x35418eaf92fee, 0x58dfa394f83aa,
+    0x0d6a211ab66d6, 0x10fc819babfae, 0xc65910aba510f, 0xc9f281cd972f9,
+    0x0000000000000, 0x322986475308d, 0x9eac6dbdf6097, 0xc5acd09b2233a,
+    0x329ded9b0ccd4, 0x887d8db3aaf98, 0x6f2634f557bc3, 0xffe44bb2086a6,
+    0x880233e423a7e, 0x05be9325376f0, 0x68569b2d049cc, 0x0c48ca7583df0,
+    0x5e0705a212161, 0xa44e218ac2f03, 0x32c16bc4b4e35, 0x4c8d8cd04cee3,
+    0x0000000000000, 0x309c5ef927cbf, 0x9dd0474f3e9a9, 0x9644f76cf3eec,
+    0x2e9bda4d583bd, 0x64beddd37e745, 0x630be758d7489, 0x9e470c0989332,
+    0xfc3a5113e93d2, 0xdfb32f1e3c79a, 0xc5c62d565d00f, 0x5bd5a51933122,
+    0x5cc66aaf6acdc, 0x9e52dce4d50f3, 0x26fa6c3020817, 0x07e1f3002b11e,
+    0x0000000000000, 0xd6b4216ab9acb, 0x4de3dc28e1b18, 0xb839913cc523f,
+    0xaaf5393937290, 0x23b9d5fabe68d, 0x96cc1a1f7bbd7, 0x036a21ee2355e,
+    0x9cef6349e35be, 0x9f21f664b8b91, 0x169f0969b04bf, 0xe37efded2fcf9,
+    0x5f567b9ef19a6, 0x9a5441b16ff2c, 0xe237240926017, 0xa7abaab0eb4cf,
+    0x0000000000000, 0x7be12d76a038c, 0x2a66477111669, 0xb0faba44e0ace,
+    0x2a438413e94f3, 0x86f999f76586d, 0x0a87218942d29, 0x605220d7a9ed8,
+    0x3ded2ec542ca0, 0x0d23e5df3ae98, 0x0e9c0cad9c07b, 0x549a2ea77c6e2,
+    0x76a3bfbc08538, 0x6f54ba714e2b4, 0x84fe92612c0a1, 0x8d68bfc132a06,
+    0x0000000000000, 0x347bdb3df9b7b, 0xb08b4b2d039cf, 0xa4365ee11dfec,
+    0x3c7de32213686, 0x6e01344c4f84f, 0xb729a07d3daa0, 0x74c476be4cbfc,
+    0xdded3d3b70afc, 0xef39bcb6a7061, 0x91ab7f8239209, 0xdc10634f46ee1,
+    0x3b77ae0de56a4, 0xe390d968cab49, 0xbf64da08d3a07, 0x2a72e2e446820,
+    0x0000000000000, 0x48913f4d9785f, 0x8cea13bbe6fc5, 0x86e9b1dc1ef98,
+    0x540449286da37, 0x6a2ba2b230952, 0x322502501c971, 0xe7d266bf23709,
+    0xee0c813474d52, 0xfe9125f2cf0ac, 0x581faeb6df9f4, 0x817dca37b6b71,
+    0x7b415bb7406a3, 0xc3c521a3c70e2, 0xba28078b0138a, 0x3061e680e0737,
+    0x0000000000000, 0x0000000013e94, 0x0000000010ebd, 0x000000006d5b0,
+    0x0000000029aa1, 0x0000000095c6a, 0x0000000048817, 0x000000004af84,
+    0x0000000012f00, 0x000000000ebed, 0x000000000fb1d, 0x00000000b8ffe,
+    0x00000000f4982, 0x000000002131b, 0x000000000b88a, 0x00000000211c1,
+    0x0000000000000, 0x466717b5c75f3, 0x6e345ee3db6d1, 0x23c8e0e3de32d,
+    0x1d592acb2cf64, 0x0b95a81043316, 0x2d19058c117f5, 0xf71acb8186d28,
+    0x2c304534f52c2, 0x83f87ea991388, 0x8f41e49455fdc, 0xd11b30cafe3f9,
+    0x1bf7febe3e867, 0xb1bcc7bb3b032, 0xfe4c094b4bd67, 0x22bdb96ae09e2,
+    0x0000000000000, 0x0a5f8e796eab2, 0xc2cd4720862b2, 0x7f12f5fd64877,
+    0xef1bd13e4055d, 0xd73b3d5b42d58, 0x5d04a0d43b9a2, 0xc1ba79f0a02e5,
+    0x02a0908f763fa, 0x824a7576aad5f, 0x4f8506a423404, 0xc116fbe4f7f3d,
+    0xecca22d178794, 0xb5404f4ab345a, 0x9bab5a777d208, 0x3798adf35822c,
+    0x0000000000000, 0xd6af2aad3919a, 0xfcd0516567c14, 0x65c4f21965e29,
+    0x4681cce9d2c6b, 0xeabb5f6b4ff5c, 0x6fffa44a7b14b, 0xcb23647da6af3,
+    0xcccb3aba1eb57, 0x885aad343b146, 0x42da2a783b9e8, 0xddbfab0fcab0e,
+    0x89edd5f6166c1, 0x23fa1ec262691, 0x13bd6e85f76a0, 0xbca0b155a0219,
+    0x0000000000000, 0x5d8ad10740b88, 0x6303929bfa29c, 0xc238a64973b82,
+    0x558f6bcd0cb2e, 0x2e3222fbae683, 0xb79d56b29c652, 0x4dc25085f1ab9,
+    0x10c134b6a8e10, 0xcec100a20fb12, 0xb0a6f3a146ffb, 0xa17d4b41025e1,
+    0x0fc268952c1c2, 0x045a31ba698e2, 0x2ddcee3b978a6, 0xedc2eb1f33009,
+    0x0000000000000, 0xb5337dee6254b, 0x3818249bfb3f6, 0x4df523adce9e4,
+    0xe9e610369d43b, 0x5faec0c41185e, 0x19510116a8c9f, 0x35a081efe0067,
+    0x56e7c163e84ad, 0x6bb23755c0932, 0xb317db5c09d38, 0x1c7487cca3890,
+    0xffd570ae778f3, 0x1693240dcc439, 0x293f6c84ab215, 0x8c597befb1727,
+    0x0000000000000, 0xf02247c38b8ef, 0x7f7cd97c378e4, 0x94fe1b54a9d3a,
+    0x6e0651f5757c0, 0x247f4225151c0, 0x777ba8e6ad9e0, 0xb49b5fccab7e1,
+    0x57e0c36f37fd9, 0x94858830f9295, 0x5c1f1672ee9e2, 0xbe298dd163c9f,
+    0xb60bf1b4ece56, 0x1f7905e8d11e2, 0x6d0b2f62fdd81, 0xb484a177717e3,
+    0x0000000000000, 0xc4cf688c2e194, 0xa1676068c8084, 0x77a4673d2e36a,
+    0x0aa15c80b23c1, 0xcd1d54c6b6823, 0x721116b61f374, 0x5d6972c3c7900,
+    0x1a27caae8c8d0, 0x572596e33d5e4, 0x3c96feb47de20, 0xd964f5f8e8eed,
+    0xbf9842d65aa92, 0x05c94835d6f57, 0x07db1a44b9b98, 0x2ecbd01195fb9,
+    0x0000000000000, 0x000000006c25b, 0x00000000987eb, 0x000000006c952,
+    0x0000000000182, 0x0000000047ddd, 0x00000000293b8, 0x0000000093592,
+    0x0000000055372, 0x00000000c0692, 0x000000008837d, 0x000000001a396,
+    0x0000000035c6e, 0x00000000a9ce7, 0x0000000033fc5, 0x00000000da45d,
+    0x0000000000000, 0xfbfb66a502f43, 0xe0e09fdbcad95, 0x5071e3189ee2b,
+    0x0e8a3d453ef19, 0x1093ba23ee8aa, 0x114ceeb6bf08f, 0xedc5bbef4b233,
+    0x455d88f7fc60e, 0x22d18923db62f, 0x5dec4780b8c4c, 0x85f6fd7d88caa,
+    0x8a56963df68cb, 0x5af117d4d7bc0, 0x1257218dc8b00, 0x2c3fd04c23aa1,
+    0x0000000000000, 0x8324480c57881, 0x4ef7aaa73197d, 0xa7d38b37adba8,
+    0x752af8ed809c8, 0x4eba085a4ac56, 0x9b8e2e27d148f, 0x8a2c4569a9872,
+    0x91a58a27c4fad, 0x8a6eb5d217ec6, 0x4ccea3306d8b4, 0xf9fbd502235e4,
+    0xb50607aef75bc, 0x1d9aed16b26a4, 0xaf5cbad4db797, 0xcff8ae221b737,
+    0x0000000000000, 0xd6a55d7a45e41, 0xfdf5aa02c7c2e, 0xda79cfd6890d1,
+    0x017d0798a8632, 0x757d893a08612, 0x4dfd405290cfa, 0x7f7a2190358d1,
+    0xee65aa7e47d3c, 0xead349b38a485, 0x3916b366caf1c, 0xd17b9666cea5d,
+    0xd2c0bc545f35b, 0xae7143f4d740e, 0xbdbaf6a4ae045, 0x297403ddec04d,
+    0x0000000000000, 0x02c3273e2bc82, 0x17372e0c286f0, 0x8f6c1b70053cb,
+    0x726f782193578, 0x716e4e9df2243, 0x5154f8699e7cb, 0xb19c0dfdae143,
+    0x826600079a263, 0xdb5bac12366b7, 0x7c6f73928b912, 0x3a19c2d856d57,
+    0x52d842b78914b, 0x7c917e41d93e6, 0xd6d66dbb83e46, 0x405f9d108628c,
+    0x0000000000000, 0x53ef1ed4c7350, 0x25da3472da1a4, 0xc1f3a60172d53,
+    0x1b87254c44c0e, 0xff322ee08838c, 0x1b94c35b9954b, 0x0779a1704cf5d,
+    0xf2606caf52431, 0x1375b9650f9e2, 0xe8bfe715c4aa1, 0xfa8900792652f,
+    0xd81e2ad4eb686, 0xbcd4422b4c25e, 0x10724ae35f73d, 0x7c91dcab0decf,
+    0x0000000000000, 0x4948e88c42e9c, 0x76f2a23b66850, 0xe5731bce4512a,
+    0xe7691a8c1962a, 0x62edf29aaf851, 0x6b3d1a698d080, 0xd13e188c85da7,
+    0xcb28c8113f6fc, 0x4d3b7c5f04fa7, 0x4798db9f2ffcc, 0x4b43d28b6b5c5,
+    0x1e1f418b1f210, 0xb35543ca97746, 0x4844fca1499b1, 0xfeb418c7e5885,
+    0x0000000000000, 0x632028babf67f, 0x7d4bc0d116b75, 0x5ac2ae820e8ab,
+    0x2ee30796a71c9, 0x662d2073491d4, 0xc338c03de0baf, 0xa641c6e752115,
+    0xaa6f6ff2be316, 0x2159cf6a40c27, 0x4f6a6b2332ab9, 0x2406c85f20385,
+    0xca6ba32a9ff22, 0xbe36074af6c21, 0x66a5d55a81b4d, 0xc09c622f0fef6,
+    0x0000000000000, 0x000000008a978, 0x00000000a36a2, 0x00000000209ee,
+    0x00000000a75a1, 0x00000000ac82a, 0x00000000ffc8d, 0x00000000ab339,
+    0x000000003c17c, 0x000000007efca, 0x00000000c4cc1, 0x00000000fd4fc,
+    0x0000000085de5, 0x00000000ba0e6, 0x00000000d10f0, 0x0000000077f21,
+    0x0000000000000, 0x8edce917c4930, 0xb11735059e67b, 0x85cb432ac2711,
+    0xc339094f215d4, 0x7ffbebadec098, 0x702f32a77e2da, 0xa20a8557c0225,
+    0xc05f668a9dc76, 0x00e08b21c411c, 0x8f14dfd7565cd, 0x971c4ef926bbe,
+    0x7d6c89ae1400f, 0x1fc03f1683707, 0x68e494d48c0a1, 0x24afe57193d7e,
+    0x0000000000000, 0x1bf5f13a4625c, 0x1ecdb3f4744cf, 0x9c28a1955c820,
+    0x3e535f42c17eb, 0xd47054c83c03d, 0xc97127d93e02e, 0x096b6ff1b732d,
+    0x798ea577e0148, 0x38a86d7b1942d, 0x2bb209da4c781, 0xe6f1a318c3658,
+    0x569cd642e56be, 0x84ef43970fb90, 0xfb91cac65b485, 0xfc844d84506db,
+    0x0000000000000, 0xe9dd4dc6a263a, 0x33adc74dab02a, 0x064df6007c67a,
+    0xb753210a29b6e, 0xf5660d304c422, 0x01ed9817cfafd, 0xd407c98d10a48,
+    0xc912137590c65, 0x9a59066b04c2f, 0x524bd9fa6366e, 0x3dd0f836208b4,
+    0x62ebfce8e93db, 0x14f403aa4d2be, 0xb398c77ae74dc, 0xe5a61856ba1a2,
+    0x0000000000000, 0x6bcc37232768a, 0x11b969d4f1723, 0x2d9940be512a0,
+    0xef35e39a7a591, 0x68776eae66b0f, 0x7686d973e4d50, 0xc4de396de966d,
+    0xeff4592a57ef2, 0x38c6e77c4792e, 0xd0b25568fc299, 0x13bc710b89661,
+    0x6588d24735494, 0xcc91200099e85, 0x93cd9514a9a85, 0x2a7ca4fd88e98,
+    0x0000000000000, 0x1576e8c1830f3, 0x66cca4ef7c70d, 0xf201a20968a43,
+    0x2d459b91ab7f1, 0x23bc4c790545a, 0xb2f36eb6c2f8a, 0x077d8be308685,
+    0xc5e3f67b24b28, 0x85d923a08eed7, 0xd6efd89f301fa, 0x06d73c563a2e6,
+    0x51a5ab01d543b, 0x073ed1463f642, 0x4508678fa577f, 0x5f3f94a99ff1f,
+    0x0000000000000, 0xbcb766c5317b3, 0xc6afdfdf96d13, 0x1c52e6e4d75a5,
+    0xfd429da2789ae, 0xd270063c7b4fd, 0x38f64b4a9b22e, 0x9a3c86eebd8d0,
+    0x00890276e1f87, 0xa82e3dad09ac7, 0x70550cf9e6038, 0x3ec5c50950746,
+    0x43f7a17fe9149, 0x1fc1ab162eefd, 0x25d59af545973, 0x5fb21e83fe8cd,
+    0x0000000000000, 0x4dcef1d57a69b, 0x4da570693db2f, 0xb283412fca0ce,
+    0xf57eadbca7f02, 0xb654ce152ea24, 0xc5e816e20ad9c, 0xb116088c7e5ad,
+    0xb7e40d7a676fb, 0xd8043ea03505c, 0x862aa4478abb8, 0x2066cbf4eebcf,
+    0x4d22c67f2e1fb, 0x95e6c7111ff4a, 0xcd5e3553db120, 0x8667463353f73,
+    0x0000000000000, 0x00000000b3e3d, 0x0000000056750, 0x00000000c8844,
+    0x0000000065290, 0x0000000091b5e, 0x0000000052214, 0x000000002915e,
+    0x000000004b6e6, 0x0000000002189, 0x000000001fac7, 0x000000002d24f,
+    0x0000000073e94, 0x0000000054e60, 0x0000000034bf8, 0x00000000a9fce,
+    0x0000000000000, 0xe4a9a609d4f93, 0x9cd8cd3edcb0c, 0x5ff5add16fabc,
+    0x956a7f54f949d, 0xe52e5e3b81a07, 0x2ca16cc743913, 0x1e4b9855cce0d,
+    0x51b4cfaf372e5, 0x2bf3bce7dbc23, 0x150745d04b61c, 0x019b1e8611651,
+    0xa41cea977e5e0, 0xcea234a72af46, 0xc5449450cdd35, 0x3dbc5ddaeb0c1,
+    0x0000000000000, 0xf05584cbb3289, 0x22e37211bdab0, 0x2325bce09f58d,
+    0x74086945790c5, 0x3d8ba023a2811, 0xa87df94980566, 0x77aac92f62799,
+    0xb9fa2db519927, 0xf705e51862913, 0x872f5f92dc043, 0x321fcb0cbf23a,
+    0x741f120afb516, 0x075a9fa80eb2c, 0xe0f5c21f9fe3f, 0xd7b24229347a0,
+    0x0000000000000, 0x2a9b59e61225b, 0xbfe0383f52218, 0xaa8a57b4f8c2f,
+    0x771ce236fcb82, 0x38cbadecfc486, 0x43950e1edcc9c, 0x49475d70d80c7,
+    0xd4edc529b8ffb, 0x4bf0d4c3fa8a3, 0xf0ebd35403355, 0x9a3fa35bffc3d,
+    0xdc58adf5bfd08, 0xedcee5f7b5352, 0xdfddc89835563, 0xa8047ed4e67d9,
+    0x0000000000000, 0xd8267df2d43de, 0x7e26a1b9f8b57, 0x8d5e105253a0d,
+    0xb0c6000575064, 0x5dc8febda1231, 0xcfe34a3a8a191, 0xb9e56228957b8,
+    0xaf1d605917201, 0xab21610464abd, 0xeb55a34b48dd1, 0x2e68c093a14ad,
+    0x6f0142e567ae2, 0xb21ef34deb6bc, 0xd864a258d9113, 0x2c26aa60d8003,
+    0x0000000000000, 0x00109e8014126, 0xd7d7f72d5fdcd, 0xc1e59cd8514d9,
+    0x80b09adeb2c04, 0x7de6806657f64, 0x789a807818f58, 0xfe5317b2e70b2,
+    0xe782a09939f88, 0xc9188e5e547af, 0x974d329e1f1d4, 0xb290cbd43457b,
+    0x0077dcf093710, 0xa98cb1aafcdb1, 0x53a9ddf81ce07, 0x7281aa2ec95d3,
+    0x0000000000000, 0x172f1cdd5bbbf, 0x49c9205641e45, 0xf2b3d6bcb6589,
+    0x81474f468be6e, 0xb85314c4892c8, 0xf371e64247c8b, 0xd08829a14149b,
+    0xc710d31c5fea5, 0xda3fd30470ac3, 0x7613efe9a2f51, 0x0ea9654f2ac68,
+    0x28d43924ab9ac, 0x3beb64b2d11b7, 0x263d1999b5bc5, 0x9c64b6a759057,
+    0x0000000000000, 0x0d985b92ee338, 0x2a15377c1bec4, 0x4829b8a9c750d,
+    0xcce2f3bf32b6f, 0x55846ae6557ba, 0x2416edd71a414, 0x2f7a474962068,
+    0x365e0fb15884e, 0x4fe45ae134f71, 0xd8c4cea8fbfae, 0xfd49669d1babf,
+    0x37df38ab2603a, 0xc9b6769a25014, 0xcf5560980d264, 0x8ed765c2b5502,
+    0x0000000000000, 0x00000000f3143, 0x00000000efc7b, 0x000000007b347,
+    0x00000000a712c, 0x000000007f724, 0x0000000015079, 0x00000000aebca,
+    0x00000000d32ce, 0x0000000014153, 0x000000004cfe5, 0x0000000075288,
+    0x00000000d29d0, 0x00000000945bf, 0x000000005510d, 0x00000000141a6,
+    0x0000000000000, 0xac2d50dd03701, 0x7344da1d40eaf, 0xe66bc2743ce6c,
+    0xc24bf8b416a6b, 0xeec428214d148, 0xffa91f174167f, 0x6f4526dfee617,
+    0x54592dfab29b3, 0x2830edac7c3f2, 0x10ac1fae952e9, 0x0b67fc02622f8,
+    0x7778585eaf8d6, 0x9adf03e01bb36, 0x5ae4adc3b5db7, 0x5a1b512796af9,
+    0x0000000000000, 0xb11e059a07dd0, 0xb6c657a9ff3f7, 0x065b61c7110ec,
+    0x4c292cee41c19, 0x605f04bd9691d, 0xb25c89afa6267, 0x95553b88f6f77,
+    0xd7d9f896aa46a, 0x05c98e7333af2, 0x72d3e5935dbd8, 0x7c7ffbe1cf6ef,
+    0x7082507217b77, 0x481b331020c19, 0xcc7621810ae8e, 0x15bb46e1cdd64,
+    0x0000000000000, 0xeb68a6d1ce296, 0xacc6777a25729, 0x649896d6874ad,
+    0x8e149d7276386, 0x01f9a9bebedcd, 0xaf7ef3cf3a1be, 0x09be0328400fc,
+    0xce02cec631ef0, 0x52123bf2da9a7, 0x5820842518063, 0xa196b2d16aa40,
+    0x5c4b39266638d, 0x69b90d3141914, 0xde2d8ea9c6c31, 0xa3827435f0915,
+    0x0000000000000, 0x0751560f20e77, 0xd1bcd020eaa96, 0x070491989b129,
+    0xa66156f47b2ac, 0xd9f6fca329d99, 0x2e43598426c0f, 0x88862bcf46201,
+    0x992dca6e73436, 0xaef4412e963d6, 0xbc4d99600a4d9, 0x3e5b40d5986b9,
+    0x3cd01ad656d60, 0xb42923781c673, 0xdb5ca7fac1a83, 0xa0fa1ad098086,
+    0x0000000000000, 0xe7aaf3a9ad622, 0xa3f6860c76bfc, 0x33fca37a103a1,
+    0x5840b5d1be54d, 0x80afbac3545f1, 0xcce9e9836095e, 0x1b056984a715d,
+    0xa6fd0c08b1b76, 0x1cb70351f97cf, 0x114094b56b24f, 0xbf3aeab66e0fe,
+    0x5d061bc2b2123, 0x05e9ed85f6260, 0xb04bc6e53a4c7, 0xcef4b481f1756,
+    0x0000000000000, 0xbae14ea59489a, 0xc7c80617534b0, 0x4084f31020cc4,
+    0x6e8cf62ca7683, 0xbde258f49872f, 0x00e64559620df, 0x801609b1a1506,
+    0x0f5c2376338fc, 0x2ef10d8734ad8, 0xc9c5fac1ad92c, 0x5bbde0c37749d,
+    0x744911f0f4317, 0x46576528b85b1, 0x0f78279679c62, 0xd345385c754f8,
+    0x0000000000000, 0x2497b70e2f664, 0x56b8ce5722284, 0xd6869973e1e5b,
+    0x53eb52adb6a8a, 0x810ab689c4c2c, 0xb940f1d9ae94c, 0x570e24316cbd8,
+    0x35bc3ea4c65a0, 0x320d22598a509, 0x6f8c7a747b6f5, 0x4bbfbb7788bf6,
+    0xcb6acd02a75c3, 0x2b3b04ce17201, 0x0e8bac7a199d9, 0xd8872a7fa4070,
+    0x0000000000000, 0x0000000076d08, 0x000000002bd74, 0x000000005d3f9,
+    0x00000000dade1, 0x000000009522f, 0x00000000513fe, 0x000000003e041,
+    0x00000000b316b, 0x000000008bc85, 0x00000000cc856, 0x00000000d9b12,
+    0x00000000b5717, 0x000000007e84d, 0x00000000f962f, 0x00000000f320b,
+    0x0000000000000, 0x688b6fc0935b1, 0xd68f9d41abcc8, 0x32c6c36e98fcf,
+    0x3b3ac56ccd2a3, 0x07cf27c6f522b, 0x217bc19416e3e, 0x02d7c679ef0fe,
+    0x1b38ab493e121, 0x58f757c49b85b, 0x9af289fb9d83c, 0xb5dc57be2a7e8,
+    0xc3edc43bc2189, 0x61382e2324c46, 0xf42e3844918ba, 0x7a6568ab5bf8d,
+    0x0000000000000, 0xf5378205dd339, 0x16a6c328ffdb0, 0xdecffb2818aa1,
+    0x649b23ab4e3e0, 0x0a2cd24b1d642, 0x3dbacb350d4a4, 0xdac761b242b89,
+    0x5bde849cd1240, 0x58e29f4f4a1bd, 0x05c33682d583c, 0x3640957018de0,
+    0xffa4b88062b11, 0x63c91cb722add, 0xd20c995b242ed, 0xe4bd7d01443f5,
+    0x0000000000000, 0x0b901357b7bc3, 0x797038aa63e5d, 0xdbb7ab428bd3c,
+    0xd023509576972, 0x286a57abecc5e, 0x96966892b512a, 0xdd6404b70ad4c,
+    0x576b3d2c358dc, 0x4c4d49b3718a6, 0x2c3693bdceb30, 0x34ff01e0b7723,
+    0xd797342a0ea27, 0x0c01e79609cf5, 0xbbbdb7fd0fb12, 0x17eacda00a015,
+    0x0000000000000, 0xc06c682e00f2c, 0x7d39063de7eb8, 0x16bacf4201b30,
+    0x9e51e798edf99, 0xe0b0b1cf48fc3, 0x81b2c15caefdc, 0x9ee32e33e73c6,
+    0x9e3dabe92fbab, 0x92439254ed38b, 0x56c28eefd244b, 0xc635d4f7cee0e,
+    0x76019dd053d0d, 0x26ea75419b061, 0x71662d13ea545, 0xd1d46750eb191,
+    0x0000000000000, 0x3114d5423dbce, 0x710daf9bd691e, 0x2400f1fbd18a1,
+    0x9307675c7dbe9, 0x6d6ee3d3d9931, 0xd6ed54c74e028, 0x28c950449cbb4,
+    0x43324900a3fbd, 0x333bf61917421, 0x71a31f558a7ef, 0xfdd541eec5090,
+    0x2d1082d949a34, 0xd0cebe886e1c4, 0x3fd2079704e1f, 0xb96642b1a2be1,
+    0x0000000000000, 0x52463ef2a145c, 0x8b5d7a998df4e, 0xe8ef241b745dc,
+    0x8c0fb63854744, 0xe3b94e1b8e94d, 0x9be77bce9729c, 0x131b1290b31d8,
+    0x20904e785414d, 0x73da90b9fd4d3, 0x70d2d487506a9, 0xb4034095693f8,
+    0xd02c020818c36, 0x31c4c155d6ff0, 0x5ad21aee1a23e, 0x38e4ec179bafa,
+    0x0000000000000, 0xb0aa01d98747a, 0x4b8c7085b9e71, 0x57e933fa0e43e,
+    0x37223ffaf5562, 0x61d9478835993, 0x492d359479b3b, 0x8298ac858e7c9,
+    0xba8daead1abde, 0xc57f3aab22394, 0x042064493452c, 0x2fd869654a4f2,
+    0x4bc9887fbfb2d, 0xd13ea173cb46e, 0xb8af4e9458c47, 0x53fc0b73ec328,
+    0x0000000000000, 0x000000007d717, 0x0000000016b3d, 0x00000000e26d3,
+    0x000000001698c, 0x00000000f06fc, 0x00000000c2072, 0x0000000085498,
+    0x00000000aa5f1, 0x0000000027f1a, 0x00000000bf284, 0x000000007905d,
+    0x00000000a1720, 0x00000000d2b1c, 0x000000007fd51, 0x00000000d7e1c,
+    0x0000000000000, 0xd2bf78a72f39e, 0x19da01ecaa2a1, 0x0ddd9e74cd4e4,
+    0x420dd9073adb8, 0x3b77764445746, 0x96cce3a0364c1, 0xbb14c0d516dc1,
+    0x2d0438c4bd099, 0xb0ccea1bb5ac8, 0x4990f2b6d9b57, 0x5e6b8ea1f18c1,
+    0xbb34b97aa79e1, 0x90bae8edaa99c, 0x914dd3c455df8, 0x5e6f914bb6699,
+    0x0000000000000, 0xd29653bc4f4a5, 0x494dfce693daf, 0xb78b09eacf158,
+    0xd039f45a56f2d, 0xad4a5c3a7a385, 0xcf0812c5aaa9b, 0x6012d867ef84b,
+    0x2fd60a4f2ce26, 0x42b1b4bb77e45, 0x8480af45609a8, 0x84786088baab4,
+    0x0fe994f2d3f9d, 0x1fa7414d01bbd, 0x45f8195516afd, 0x4a5c150874570,
+    0x0000000000000, 0x51b32471fd3a0, 0x7011a8e84696a, 0x76366381e9a48,
+    0x11e9a2cdfa00e, 0x31083dcceebfb, 0xef6663caa7448, 0xe602f23f44424,
+    0x593174efc1656, 0x5e489aa4f5184, 0x619570ca251aa, 0x8a125c0d13e58,
+    0x11bc184b38e56, 0x046021de274af, 0xc6d9fde6b99f3, 0x6b775f6cc3301,
+    0x0000000000000, 0x43dcaf8e3f402, 0x04bf4491fb345, 0xfabc17712c040,
+    0x079e4af138fd7, 0x298b62b1a4b57, 0xf395b42eb396d, 0xc9c37dc48cd7b,
+    0xc78934efa243c, 0x846755b73ef55, 0x1d87570f68834, 0x2bf554263c4c2,
+    0xb316f3a975721, 0xa615b75c0f738, 0x145d2cf16a27a, 0xf0252beb485be,
+    0x0000000000000, 0x0e86fe16ef779, 0x14552451c2c19, 0x5ff2fa6a3354f,
+    0xa2ee4ecc02a89, 0x03e87083ca90d, 0x86944080ec494, 0xc145741d0b9a4,
+    0xf216a8d8c163d, 0x8f5923b0a5ccb, 0x29ad826058bc1, 0x9f38b5c6fa721,
+    0xfb9fc31df58e9, 0x30275be09d413, 0x46ea8ea84cd04, 0x046276e5fda05,
+    0x0000000000000, 0x9ffdcf70774a1, 0x5e5e407c1bf11, 0xc74591c49d65a,
+    0xbbf92fb86371e, 0x3f4e9794a8b26, 0x774dd8912d5d4, 0x81f32d3f91d77,
+    0x01617b3067dcc, 0xcfbef2d37f6bb, 0x57471dd239680, 0x0faea5c7e727f,
+    0x344080e6d4931, 0x7b1f706acf63d, 0xeed07847c7b47, 0xf4a85836a9276,
+    0x0000000000000, 0x5c96b62e6f1bf, 0x3726562cc2c3c, 0x94d2447c088ba,
+    0xc51076d256a06, 0xa385d10700d4e, 0xf17e02409ddc3, 0x8044f57563084,
+    0x51e116b6534a9, 0xc0a90e8f70c70, 0x26c5877c3844f, 0x05f47ce251037,
+    0xf6fec29e51fd9, 0xf06882c20ba8b, 0x0fb7511e01d33, 0x8c7f1f1585d17,
+    0x0000000000000, 0x0000000058874, 0x00000000fe0e4, 0x0000000018edd,
+    0x00000000ae3c4, 0x00000000cf471, 0x0000000093f75, 0x0000000029b33,
+    0x00000000bbabe, 0x00000000dc1cc, 0x00000000faaef, 0x0000000016f49,
+    0x0000000037e21, 0x00000000825c8, 0x00000000fc6d3, 0x0000000015483,
+    0x0000000000000, 0x44971cf281b0a, 0x34e0d2aae29e9, 0xd06beb8835f78,
+    0x35e2ab65ec55c, 0x0ea2b718c6a4c, 0xbf546bf68a3b9, 0xe64f817efe20d,
+    0x261be9524972c, 0xb9028d2881290, 0x971c4053269ac, 0x73708262dd3a1,
+    0x47a850871d36b, 0xb0b434a804bc9, 0x58bba6c6b398f, 0xf7a06c51cd049,
+    0x0000000000000, 0x52c0426b768f1, 0x91a53f1a10241, 0x1f6dda735bb27,
+    0xb3114a25c78e3, 0x08abeed4c7eca, 0xf500d1efc3340, 0xf83eedf03ee33,
+    0x5728524830014, 0xb5402d33e1637, 0xb3993025b5623, 0x7eb6d3fcd17e5,
+    0x6221cb273318a, 0xb06a4e503f93d, 0x89c0d74d261a7, 0x3f11e63172939,
+    0x0000000000000, 0xef3f4445c186e, 0x4dd23936a5886, 0x3c797d35e898e,
+    0x36712a123ad50, 0xf6fbc5b36b6c2, 0xe58f84f2be7a5, 0x40e2ae44ae995,
+    0xa9e4b0c851ae7, 0xe6755da8a82b5, 0xc79f525848690, 0xf1053bba8d4d4,
+    0x48c92dc373061, 0x504e76cf34929, 0xbb3e35a9367cd, 0x29ef76e759c50,
+    0x0000000000000, 0x12e3172c0d3e8, 0xed8532976d137, 0x8699e2f0d7c4b,
+    0x68411e7bd7df9, 0x2b52d8c79c796, 0x3c77201687bba, 0xf618e7c8c51d3,
+    0xfa9900e4f78b6, 0xfbf7cb931b8e1, 0x5f4e8edf82ea3, 0x9d21a431cd2b4,
+    0xe80ed4ef4d5ff, 0x1b9f6b1494df6, 0xf82f3c3316209, 0xe86155924a283,
+    0x0000000000000, 0x6ee75473731d3, 0x65ee692d130ef, 0xedc4d0a8473a8,
+    0xad6da54dbc49b, 0x71f56a7c93f92, 0xf6041690cfffc, 0x6bfc96cf2c070,
+    0xb54a3f7a33a66, 0x71604e5f829bf, 0x1821d0f9e1479, 0x05c50421a6448,
+    0x393285e5e1bf1, 0x738376350ac55, 0x30fa26660a8e7, 0x5d72aad814ad5,
+    0x0000000000000, 0xa7ee615f49fde, 0x9e7cc1cf5ada1, 0x5542b5753525e,
+    0x0da3215b0359f, 0x8049b29a71a5a, 0x0a3986cbc626f, 0x9336befaba6cb,
+    0x65a79afd8a65b, 0xacca907376b6f, 0x456bb726991e3, 0xf1a2142cdf915,
+    0xaef2d94259a2b, 0x34fe1d35bf700, 0x03047b7c6a19a, 0xea9ed09ca600b,
+    0x0000000000000, 0x5fb895530f06d, 0x4723ceda69d25, 0xb1a96b9575492,
+    0x87ea6e6e5f93f, 0x13b7c688203e4, 0x6c1ae5664e154, 0xa5e434393552e,
+    0x69a505d3f6319, 0xbf9b46e89a38c, 0x1710d95a046ef, 0x12411107443cf,
+    0x1c4101b939c4d, 0xd01679e72f6ad, 0xb49c19a9fbe0a, 0xfae58af104a20,
+    0x0000000000000, 0x00000000e8b3a, 0x000000009baab, 0x00000000687aa,
+    0x00000000d640a, 0x0000000018d0e, 0x00000000ced09, 0x000000003fa60,
+    0x0000000018914, 0x000000005941e, 0x000000008b5a9, 0x0000000009dbb,
+    0x00000000417ee, 0x000000005bfe6, 0x000000007044f, 0x00000000484d1,
+    0x0000000000000, 0x6345afdc270e9, 0x95b8627836d36, 0x6187328f4de3f,
+    0x3244eb630ddc0, 0xb38902a4b8e79, 0xe8cb8bbeb5046, 0x1ea260fdbfb99,
+    0x675265cae6514, 0x83d90acef9370, 0x96dde45053f47, 0xce6837ddd80b5,
+    0x408288c78d6a1, 0x03513d88619d9, 0xe7446b8955729, 0x6887a16076c0b,
+    0x0000000000000, 0x19fd14973443f, 0x237ee5baef4bf, 0x5d9e1c55a6108,
+    0xf7c1a4f6cdf83, 0x0ffd1771d6fa1, 0x0c4a70e1ca2c9, 0xd7f46d582199e,
+    0x8278367cbbd6a, 0x9e7f907d9c249, 0xeca259ba16ecc, 0xe790053f54a8f,
+    0x25099cfed6656, 0x7945663abf653, 0x3a64d3c0dd7af, 0x7c3110598dfab,
+    0x0000000000000, 0xf6896912e434e, 0xe9b1caaa769fb, 0x0cc3eafb78aa1,
+    0x8137a92bebef0, 0x40ee119ff9490, 0x959b207ee1bdc, 0x2b6fbcaef65d5,
+    0xc906352414281, 0x84db9d5b0357c, 0xd97ca84819e39, 0x220633f1a2833,
+    0xd08f07830a8e0, 0x0f70566645c30, 0x1f34d3b8008ef, 0xbb0f640608b89,
+    0x0000000000000, 0xae07653908d03, 0x8ddacfdaff633, 0x97037af30d9ba,
+    0xeb8e3c0a631d4, 0x5039877bf0468, 0x1c98ce74ea11d, 0x3dae1c2e18175,
+    0xb3f6f5af173f1, 0x8c85af187ec13, 0xd47ed5be6627c, 0x12555aab640f8,
+    0xd4f84bc1e8f0a, 0xbab1c200eaa04, 0x2584c4aee9cd0, 0x34f17b1304a0c,
+    0x0000000000000, 0x6ba02a278e2ba, 0x9cec076939e5c, 0xae889a689cfbc,
+    0xdb756445ff44c, 0x4ad021e88ee4d, 0x3be7700507eea, 0x869eb227f850f,
+    0xa5ca36597e41b, 0x6569591345f87, 0xa7889e45c377c, 0xac46a2d4988b8,
+    0x9eee2287de47a, 0x1ffb467210fd4, 0xb7199bb6a32ee, 0x8ac520048adc3,
+    0x0000000000000, 0x21b8f8c3d0143, 0xfb509d575c8db, 0xbc3cced1c4cef,
+    0xc8880e0205b11, 0x426cf4674e232, 0xd7f55776dbc2c, 0xfa47fbe3b91ff,
+    0x99f79557cb03c, 0xcd51bd5cb5083, 0x4bc0062f4f59b, 0x00880784c12c7,
+    0x6f01099092f6d, 0x114a914473218, 0x59f8ba5bf55fd, 0xdce96e762a8fd,
+    0x0000000000000, 0x297a0d0222e7b, 0x6979afc8ae0fd, 0x49a88b7498f14,
+    0x0d304844e845b, 0x56f3ca46df830, 0xfe6f2d58385f1, 0xe778484722cec,
+    0xef127f86cb87b, 0x34f5c6a824a5d, 0x490883be9d5fc, 0x4921696cd3234,
+    0x98633a52ab17d, 0xebce7c90bc194, 0x260881931e402, 0x1c8ad349af055,
+    0x0000000000000, 0x00000000d7ec1, 0x0000000085651, 0x00000000b2b98,
+    0x00000000b85e0, 0x0000000013de3, 0x00000000fc040, 0x000000004103d,
+    0x00000000ad4dc, 0x0000000080084, 0x00000000681c8, 0x000000008acd8,
+    0x000000000582f, 0x0000000049749, 0x000000001e74e, 0x000000008b294,
+    0x0000000000000, 0xacb4203cc71b2, 0xdd4906efe62a1, 0xfc9dc58ccbfd3,
+    0xcb198f774dfa5, 0x3ee444049205f, 0xa99218fa41730, 0x404c516d2fa5f,
+    0x643c3f46ade04, 0x38e304b1a5bdb, 0x894728834c7f0, 0x0e668da435857,
+    0x4e6bf1e046343, 0x418f353575742, 0x76c2e6f2a887e, 0x55027998a7bb7,
+    0x0000000000000, 0xa9070d34e112c, 0x63bcc8842253e, 0x65da105274b3b,
+    0xdd1e347819af2, 0x4641f3232052d, 0x1fd522c0bbfab, 0x1ce3bb5dad964,
+    0x7aaa03b473d97, 0xf68cc79f19003, 0x4522c652455a4, 0x11d12b30a5bba,
+    0x62e453ad3c6c9, 0xe79175d641710, 0xc411f2c1fad7c, 0xb4bed7ba466ec,
+    0x0000000000000, 0x47b523d821ba6, 0x7a247757fdab1, 0xb55ea748dc2da,
+    0x20411ce747fbb, 0x36964ec680dc5, 0xa9941ff1466bf, 0x6fb761f722153,
+    0x91126d04a500a, 0xe1c09566f68b8, 0x423553ff147b7, 0xcb698920a86bd,
+    0xb7c9c34f28747, 0x3b61cec6c9ed5, 0x6dd850565d91d, 0xedc19757a4b76,
+    0x0000000000000, 0xf9b95eb8ad292, 0xa1ef2571d6b1e, 0x57ca8bf5a3b8a,
+    0x5ccc28af85bb9, 0x669a6d258a501, 0x092da3b9c31d4, 0xb3eb66f743af4,
+    0xef86f37b57bd6, 0x0ebe2eccf7821, 0x7a7f346dae503, 0x893223e8d8a66,
+    0xb7a40c3a30a49, 0x3585db96d1d38, 0x15295a26eefd2, 0xb1ab33614f591,
+    0x0000000000000, 0x6a6a45dda269a, 0x1739a956e745d, 0xd8a1b6de11f0f,
+    0xb3ae9ba11fc18, 0xb4821f09123a4, 0xc34219c367a46, 0x8df327f3f32af,
+    0xb2a6371d2b286, 0x4309f1f3d1cb8, 0x65d5693fcda29, 0xa7e9a36830cb7,
+    0x3677ba9dea757, 0xf17b92e8312b9, 0x0b8ed1043a071, 0x70a67bc484d10,
+    0x0000000000000, 0xdf41e0dde0a03, 0xbffc16f01c292, 0x234517085d300,
+    0xbdb313c923d78, 0x8a6b3a13a23ed, 0xdd4a2ab2413d6, 0x8e4f584461238,
+    0x77ccbd95b797e, 0xe9507e62578ad, 0x00dffffeb23ae, 0x2f0b4aca55fe5,
+    0x871d3a23a6677, 0xb84e90bbe995a, 0x42f800a833ed0, 0x59f649dfd56e7,
+    0x0000000000000, 0xf2aa18b528e63, 0x72ceffd8065e4, 0xc6547cea22617,
+    0xb877d494d7ea7, 0xdd69d2f294114, 0xb5cc73316845e, 0xf4c50d274c520,
+    0xa6da489ef8940, 0xe70fde95ca416, 0xf294087e7ef5b, 0x6f6d84376bd90,
+    0xd7265fd6cfad7, 0x587917164aee1, 0x8d8033d8afe06, 0xe47911444abd5,
+    0x0000000000000, 0x00000000a260d, 0x00000000f36fe, 0x00000000fc7f6,
+    0x00000000af8f8, 0x00000000dce02, 0x000000008530b, 0x00000000eec5a,
+    0x000000008e99c, 0x000000008a5c7, 0x00000000fc02a, 0x00000000e46e4,
+    0x000000007170b, 0x0000000092ac9, 0x00000000da00d, 0x000000004c7b4,
+    0x0000000000000, 0xc22d6a6aefb01, 0x478592361b14b, 0x0c9a08e4693de,
+    0x4fe8c8323652c, 0xa151e26f5b95f, 0xac389042407a5, 0x74b46422d9abd,
+    0x7980fdcec94f4, 0x524d5ce7ac992, 0xa489d7168a895, 0xf6964b90cef2e,
+    0x2a7b0ee4b8cea, 0xcb3e4a69400ae, 0x41a51914209ed, 0xa99962f61b7b6,
+    0x0000000000000, 0xd424a67709f9b, 0x3ff49e90d1ebe, 0x5ea5c1eafc4b7,
+    0xbdc178ccc093c, 0x1040b0a5ae76f, 0x035f9866dbd51, 0xc665f3fc1c82e,
+    0x845cf9e236463, 0xe266179112d9f, 0xd06ecae29006e, 0x6889ae1b30cf1,
+    0xd693e6b9327fd, 0x885631c496cf5, 0x40125e046e62e, 0x87656087c02dd,
+    0x0000000000000, 0x2a9971343d570, 0x1338e12b047f8, 0x4f0cf5ab52e9e,
+    0x06a94572bacfb, 0xd43768a5072fc, 0xaf1eb7102b80d, 0x0101d88d0187c,
+    0x0b4681fa85d18, 0x7e3fcdcf60d79, 0xcd886b64096d7, 0xc3c8d3e304538,
+    0x812553e21c225, 0xa5e545f633f35, 0x61934f0b7b793, 0x225c60258f74c,
+    0x0000000000000, 0xe2a1968444330, 0xb583b7240d91d, 0xf6addf7eee0bc,
+    0x47cc80a50372b, 0x973cf4b05bafe, 0xab618d21f5642, 0x03e703ec5c6b4,
+    0x23b6ba7ba4781, 0xb0a961c8b2763, 0x6fe854d4903e3, 0x26d1f7274aaa0,
+    0x51c6c48fde2a8, 0x7e6b94ccdbb50, 0x8a8b488f3f7c2, 0xfd27a9f4e611a,
+    0x0000000000000, 0xd131a6cf073c1, 0xc03f8387fcb78, 0x4aac3a6680173,
+    0x0e6f901976087, 0xe4afb3e44bdaf, 0xd718be70781e8, 0x01a1731687191,
+    0x757de30bf3295, 0xdba9ff9ec68ab, 0x1c5b66f510e98, 0xc7a770d2ad7de,
+    0x0e05375723310, 0x246466d0765a9, 0x8357fc30a69fb, 0x851da72a43a14,
+    0x0000000000000, 0xe794543660558, 0x00f2d92e1a7c3, 0x635d304577695,
+    0xc2f2168147aa9, 0x2a48ff3f86990, 0xed40a8d597eef, 0x68c5b48955420,
+    0x36ca01d406ab8, 0xa78bf14592e9a, 0xa1e02ac0449ab, 0x4c7d56ac9013d,
+    0xbfa5d6c2182fb, 0xfaa8476a98bee, 0x15f2c34a3540c, 0x0587f1c21186e,
+    0x0000000000000, 0xdcdb0289c832e, 0xa8416566c2232, 0x5efe90b7248eb,
+    0xb514683d4c978, 0xd12a8aa85b6ed, 0xe49c76ccc7a3e, 0x61521c41652d4,
+    0xac5aa10e4a215, 0x708ad02770177, 0x340d9a2b79ff0, 0x2ac9f82f168be,
+    0x861e697197e5f, 0x43428a5fab1ff, 0x16f487a420e9e, 0x0436e54d903fe,
+    0x0000000000000, 0x00000000c6d8d, 0x00000000aaf80, 0x0000000053f8c,
+    0x00000000552f3, 0x0000000093f66, 0x00000000022b5, 0x0000000066db3,
+    0x00000000dfa7a, 0x0000000073830, 0x00000000699d5, 0x000000007822d,
+    0x0000000091ec1, 0x0000000026560, 0x00000000fa762, 0x00000000805e8,
+    0x0000000000000, 0xd5d97020dd4a2, 0x5418902e018d8, 0x4b8f0e228255e,
+    0xc4e9ab57885e4, 0x720fe2277f963, 0xc5e3f6f22f5b8, 0x56ed1d592c35e,
+    0x7c9efed4b7222, 0x68bdc72f590c0, 0x25e02b025fbdd, 0x6db2b51ee26b1,
+    0x35b8883423150, 0x41194df425bcd, 0x82a334ff25645, 0x13571487df38d,
+    0x0000000000000, 0x5087c7dd7d118, 0x328002f4583b6, 0x7c1fdc5f4a091,
+    0xf3c32730e8279, 0xaecf35624cf77, 0x8f86ffd115412, 0x42de4f0a50b03,
+    0xab79768e9e648, 0x93fb6908d22b1, 0x2890602242d34, 0xf97ab7fab320b,
+    0x6e1b4e5604d10, 0x1655f26f832dc, 0x435bd99647084, 0xebd0bd82eb7f6,
+    0x0000000000000, 0xd6556f04f9110, 0x29b160f5eca39, 0x3198ae2e5b9ce,
+    0x33a83277668a3, 0x08efd1de82e78, 0xe40deaad192cc, 0x3c751167dd509,
+    0xc0eb72891fdba, 0x181b785160e04, 0x508d1f0c81cf8, 0x2e2862f5094c0,
+    0x6dfbffe174e85, 0xcf1e6f967757a, 0x70f57db571a3f, 0x31e1502082cb0,
+    0x0000000000000, 0x48789fff00158, 0xd112fb93f735b, 0x2903718337a8f,
+    0xfdbf3f5cd8478, 0x98bea3e60297b, 0xc310cc60a5f87, 0x6cac3f8751d66,
+    0x821bbe0c67d8d, 0x97db7e2d68a37, 0xc9e81c69daa25, 0xc3f36f49c1509,
+    0xae4d3379ae9ce, 0x742ceeed361bf, 0x9a96f8312acc3, 0x9c94ffce5ce75,
+    0x0000000000000, 0xb909eaf1abcbc, 0x2196e3084a8ce, 0xd73ce022f49b8,
+    0x67272d4dd2bac, 0x323f3c667a02d, 0x4e7a2345876e4, 0xc7dda28ae972b,
+    0xa6909fdfcc194, 0x2a9323c17a144, 0x869f27d651fcb, 0xf6ed1c6b6d1d3,
+    0x65edee59419b6, 0x548132adb824f, 0x690451d2fe00f, 0x61e334bce511e,
+    0x0000000000000, 0x443a788ffcef8, 0xe8c74427cb629, 0xd48ccfbb92ec8,
+    0xb7577645f3641, 0x3518b46d0e701, 0xf686e998e5e4f, 0x2d48e9e225ac9,
+    0xccdda7537a6a4, 0x71cfe135d3d1a, 0x57d537fa2768d, 0x4286fb87dda7c,
+    0xccc029f67a812, 0x4bb495dd8921b, 0x1c44721d58646, 0x3875f5479f559,
+    0x0000000000000, 0xfed9905f4eef1, 0x5ff72395bdd77, 0xb3ad8428fbec6,
+    0xbe2dd813a795e, 0x6eaf0ce6c1119, 0x5a8e802dd8acf, 0x6b5b436092f2f,
+    0x26cae6d705195, 0x97278398681c6, 0xa8675fab3445b, 0xf8f9e6b8e68ae,
+    0xfedbb1a173727, 0x6e0a0e75f8abf, 0x4d9988b824088, 0x8ad44dd5304e8,
+    0x0000000000000, 0x00000000e15cb, 0x00000000ee71f, 0x00000000e4d3a,
+    0x0000000050997, 0x0000000095fb9, 0x000000002d964, 0x000000000ebbc,
+    0x0000000092b39, 0x00000000ffe09, 0x000000003a2ab, 0x00000000d263c,
+    0x00000000713e3, 0x000000001307f, 0x00000000b420e, 0x00000000755ae,
+    0x0000000000000, 0x831894b4ea50c, 0x30cc165e06d5c, 0x4a34ae1f30326,
+    0x5df7d4526b8ac, 0x6956f6482108b, 0x40c863582d42b, 0x31758b389e786,
+    0x4e2be194fc116, 0x7f3e80ac16217, 0x8f090ecb71445, 0x22acb94768c15,
+    0x43ee1a8241148, 0xa947b72db80f0, 0xb719d0ceb6254, 0x05f965d0bb7ca,
+    0x0000000000000, 0x6cca2969ec57b, 0xca7cfc14d95b5, 0x08dbc39140e5d,
+    0x40da054e2b966, 0x6a3d387b56989, 0x684854446e050, 0x1941fdce38b02,
+    0xab2c5dd6af51d, 0xb70f475698c22, 0xf936e9299b6de, 0x2487a3f86c429,
+    0x9ad6408adfa6c, 0xec62a089cf7bc, 0x395ee1ede6d17, 0xd5231a9f5a093,
+    0x0000000000000, 0xae2b1ba048b54, 0xac1b9673d9545, 0x5ba781d838f96,
+    0x68890ccefdc5e, 0x61494dc41cd76, 0x910cc9305dad5, 0x3521705355059,
+    0xbd2ad4ffd8821, 0x0ffdbc774a960, 0x143bf5cca91ae, 0xc6f2b3c0b35ee,
+    0x9a085144ac2cf, 0x2397b3d1d0553, 0xd92b7d8f90f47, 0x2a2269be86a4a,
+    0x0000000000000, 0xfab787ea6e3a2, 0x0129d213738ef, 0x022d8128959ca,
+    0x8f31026116a38, 0x1b0a30ac6b418, 0x384f1c25cb52c, 0xaba15567f8776,
+    0x7388397a3bd3a, 0xaf64fc8e27588, 0x6a444d60ed159, 0xe8156d26d895f,
+    0xadc1511e79fc0, 0xd00afcefcbd4c, 0x2b82ea6432998, 0xc7bcde13541e2,
+    0x0000000000000, 0xff98c4fe567f7, 0x1bc0b5ea366e5, 0x067ed429b035b,
+    0x0dcd85e914c42, 0xb10e76b6e8b57, 0x0b2820ad69fa9, 0xd96555254110e,
+    0xa8baf59c2dd3c, 0x84d68554b13ad, 0xf12a076881fc9, 0xe134f65fbe780,
+    0xe4386ec83b9ca, 0x1a255cebf2ffa, 0x0462717d94374, 0xb36a83e55c2c9,
+    0x0000000000000, 0x9cb91e0d0ee10, 0xa067007a905d9, 0xc74e1f8739d16,
+    0x3adc2d372af9a, 0x586db43984fa9, 0xceb8e203649dd, 0xb0b3237f0bb4e,
+    0x0ec9589d176c6, 0xe9c03082d225c, 0x4591e3dbb19f4, 0x4b085140d9dd2,
+    0x116e0abfc30f5, 0xc2a102ee6c4a6, 0x1fac3da9ee8b6, 0x1f9ba7a79f4af,
+    0x0000000000000, 0xab4c646879ac1, 0x82192cb630afc, 0xff2206b4d96e1,
+    0x9e6fda6e90367, 0x24373c51960eb, 0x06ed371bb3e90, 0xc0f74564e715d,
+    0x315d5c6219e38, 0x1bed2f1736ea4, 0x03be2a92617c7, 0xe604b047a7622,
+    0x44fd3e1779ca6, 0x7559532822e18, 0x6b0c563f742ad, 0x22e1093e21930,
+    0x0000000000000, 0x000000007d1d7, 0x00000000bf3a0, 0x000000008e83e,
+    0x00000000a8db5, 0x0000000001137, 0x0000000072bed, 0x000000004a6ea,
+    0x0000000054e8e, 0x00000000350dc, 0x00000000d0b9b, 0x00000000790dc,
+    0x0000000067cb3, 0x000000002f4e8, 0x00000000c90a4, 0x00000000cd7f8
+};
+
+#if defined(__GNUC__)
+__attribute((aligned(64)))
+#elif defined(_MSC_VER)
+__declspec(align(64))
+#elif defined(__SUNPRO_C)
+# pragma align 64(ecp_nistp521_ifma_comb)
+#endif
+extern const BN_ULONG ecp_nistp521_ifma_comb[11 * 2 * 11 * 16];
+const BN_ULONG ecp_nistp521_ifma_comb[11 * 2 * 11 * 16] = {
+    0x0000000000000, 0x31a16381adc10, 0xbc092fe2354e8, 0x4b8af9f0fe331,
+    0x0872f1cba7983, 0x6f9520c94089c, 0x84f3298fd6049, 0xa84368f482608,
+    0xa73aaf5f01aa9, 0xdfd5212e31137, 0x922293a4b1951, 0x165f4339f237d,
+    0x11eb469304abe, 0xf3e3abe4b55d2, 0xc82bb09c4a871, 0x560d5ebbbd776,
+    0x0000000000000, 0xf3f18e172deb3, 0x850a2f27fd64d, 0xe44251e3958b1,
+    0xa9c28a369cd44, 0x3d035400c83c5, 0x5a6c391eaf9a1, 0x1c0cd99964936,
+    0x9abe5e08d9505, 0x67108d885e35a, 0x58a67566a786b, 0xe0ec49f2c21fc,
+    0x648e0beb974eb, 0x45992fcf006c0, 0x22245c03fddfa, 0x70b8c8c9ec2ae,
+    0x0000000000000, 0xe0c2b5214dfcb, 0x2ad51407fff03, 0x6336ba0b33884,
+    0x07ce63b6f5daf, 0xfd7a55dbd555c, 0x7cd139b2a220c, 0x804605ccdd3ac,
+    0x9fd8bcd318e91, 0x1039ea70cabd2, 0x0c964f929604d, 0x84a75a48f23b4,
+    0xf2fb4f9a72ee5, 0x6e6ae8b701910, 0x6a53744f13106, 0xb852d3f49d389,
+    0x0000000000000, 0x17fd46f19a459, 0x808402ffc14aa, 0xc25bd8569b650,
+    0x9c12dc12c54cd, 0x3e72cb8354e0a, 0xd165a5d00c8f8, 0xe48d82929a22f,
+    0x915895b386f06, 0x9b1ca820d42c1, 0xb015ede3a2fc7, 0x86a989d7b4cfa,
+    0x25db1c5950a19, 0xd6e4ddf3bcb89, 0x3ae6906acc285, 0x1b9e0d5d66f04,
+    0x0000000000000, 0xac947f0ee093d, 0x7fbe516b67c4b, 0x5b59d7e6d68b2,
+    0xa00a67eec84f7, 0x08ed312442de0, 0x7371af734094c, 0x88f55304350cf,
+    0x4a0b5abd07d68, 0xaa855b32e6fa5, 0x53f63fe2a50a8, 0x6ed9743046aa2,
+    0x39727743e0d52, 0xeda2020d69473, 0xa87668b0ec587, 0xb0813dc7de37c,
+    0x0000000000000, 0xd50a5af3bf7f3, 0xf027098449910, 0x43b2bae76cdeb,
+    0xbc7a4edee7a34, 0x42b53d15ed611, 0xb16927bc2ccb2, 0x5dc7352237efb,
+    0x39901b007bc24, 0x30ec352356421, 0x1db1cf4d86e19, 0x6c6ca000cd85d,
+    0xf320b8925b671, 0xa789dfaa628c5, 0x952d0df97b09e, 0x80c4c606d6548,
+    0x0000000000000, 0x1457b035a69ed, 0x9af3715688b40, 0xbf860c9c460c4,
+    0xea82ff4e7f63d, 0xe9b66293c8a79, 0x3b1896988085b, 0x3a57ba1ba8bfb,
+    0xff05c36936913, 0xfa3c1033988bc, 0x205bacd16e1a0, 0xce29e2408e98a,
+    0xd676d14b271ff, 0xe2f67537efd41, 0xa80dfc843d893, 0x22528ac40e21e,
+    0x0000000000000, 0x09c829fda90fc, 0xdbddce7795e2c, 0x613852a95ef99,
+    0x950ab492940f7, 0x004b05032a200, 0x3b1ce92fb03b1, 0x856d530e2377d,
+    0x3179dcef7684c, 0x9cd3e55bff66c, 0x2efcb3ab8a2a0, 0x8cd4b7ebe484c,
+    0xeb440708786e4, 0x50b8fcb8fa8f8, 0xdaa7571e96423, 0x85a5480072903,
+    0x0000000000000, 0x11cada214e324, 0x8a5dc626ec8f7, 0x8d7f8e1d1a0ca,
+    0x953027dc3353f, 0x08e8e50182cdc, 0xda3bf33aef648, 0x77c1774cd7ca1,
+    0x125196e69b799, 0xff0bb320d1c2c, 0x8ff78ab9eaebd, 0xeacd2f1d6442f,
+    0xad08f332bb0ca, 0x5fb35abf0c7b8, 0x3db72265b83c6, 0x686e70070b6f8,
+    0x0000000000000, 0x274e6cf1f65b3, 0x32acc9e1305cc, 0x91e304c4ff9b5,
+    0xbe21b37a3c6cd, 0xbed431f72daf1, 0x2750b6bcaf914, 0xe6fd606566f21,
+    0xa2823db7308b0, 0xc334060655370, 0xea6a557d332b1, 0x330cfe6b23dd1,
+    0x5a87f169eca82, 0x8cb693c7b97a3, 0x59686106dd639, 0x3cdf727fc843c,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x460e4a5a9e268, 0x14a5956e30ed0, 0xc19329a7f87de,
+    0x5f758ab77d6e7, 0xe8a9183767c15, 0x532ff0c4e56ab, 0x28cc7c99c2522,
+    0x8e83616d0d063, 0x21fe7b01fa3e8, 0x51bcfec6db04a, 0x33839217c48ea,
+    0xa3da867ba7a4b, 0x8f38309c82c02, 0xf77da81e40924, 0xb544dbee9f148,
+    0x0000000000000, 0xf4a3b4fe8b328, 0x921ce664e13cd, 0x26f9da37be4a4,
+    0xbab416ce18f4c, 0xbf4770a18940d, 0x065af1ce4a252, 0xa5805c3e50368,
+    0x3bf0c66e267f8, 0x94a6e1c86ae55, 0x708d17d556f6d, 0x38348d8eec06b,
+    0x80b9742093012, 0x0a660a08fa4bf, 0xb6743b6d59ba8, 0xdf6f84448e584,
+    0x0000000000000, 0x4351396120445, 0xb7485d5a678ff, 0xdb809a9024e20,
+    0xb9e45e70a1adf, 0x9762eb836eb5f, 0xdc8a77df67da1, 0xff635511c8a0d,
+    0x6d375b822f9f9, 0x9cf21ee1b47d5, 0x04c5159da6f42, 0x5ce3801a0cec1,
+    0x2c1ae5081b5cf, 0xbaaeb29463007, 0x0be8ffd1d3c88, 0x08978ddb8b109,
+    0x0000000000000, 0xfd683b09a9e38, 0x1d65fed6fe685, 0x488371f747e42,
+    0x38074a53a6ae6, 0x33db91e61f38d, 0x9268c27d2467d, 0xefbfc3c58e416,
+    0xdc02109656c0d, 0xaf9676ec3f232, 0xde7bdbf211379, 0x1a986385ac23b,
+    0xb1d45a0a6984f, 0x57789d1d08e56, 0x2c30d8fbab2db, 0xc5c1698281be6,
+    0x0000000000000, 0x132062a85c809, 0x152b7d0453dd6, 0x47fc30624d705,
+    0x5919bbc5eaf8e, 0x15c2ec92770fc, 0x476c08e0be16a, 0x649921c34fa45,
+    0x530c1fc16b6d5, 0x6068f8616f37b, 0xa6ccd9bfeffd1, 0xa6a291969d2b8,
+    0x757484ee7c7f9, 0x19425e9a597c4, 0xac8b666c97889, 0x9d7baa6cf6338,
+    0x0000000000000, 0x64bf7394caf7a, 0x1e48dc7a066d9, 0xbdeeed3a74496,
+    0x6580a40639d33, 0xfeecb336e4bb2, 0xcb73f99095d00, 0xcd2012e94f949,
+    0x6bf6541ba81db, 0xc3af802d1f2bc, 0xfa3a140bc57ee, 0x6d0cd8168def5,
+    0x7a2c06fc533ae, 0x41d9ce2426ec3, 0xd8334b4596e8c, 0x37d28360edb82,
+    0x0000000000000, 0xd7de8b939f331, 0x12560c3395f08, 0x914686320f2df,
+    0x33f83c3446f86, 0x55817ea91b74d, 0xa55f0c2d7c613, 0xf11c458516be7,
+    0x443cb4caf94b8, 0x11ad92c62c649, 0xd30638e1c0ee1, 0x28596b82da324,
+    0x10f24d93ebd38, 0x0883c26e8d19d, 0x1421b590a84f7, 0x935b68f1e3364,
+    0x0000000000000, 0x224abcda2340b, 0xd6053e587c1cb, 0xf661c3b046dd7,
+    0x9f20b5de7abe3, 0x5e56bffff8499, 0x510eeda143a7e, 0x36ffcf81f69c4,
+    0xa87f59d3c1a6d, 0x9cd6abbfd145c, 0x0e295de1c7d38, 0xb967daddb05cc,
+    0xdf8578a5ec76d, 0x313c7a2a49e22, 0xf0960b647521d, 0x58e23fc5be74b,
+    0x0000000000000, 0x163e8deccc7aa, 0x76afca630f2cd, 0x0e69a820d5eb2,
+    0xa42c48703c063, 0xe3bc29e6f5c17, 0x6fbb36b0e95b2, 0x66601de9a4f22,
+    0x2afcd60e10fe1, 0x4850d4685927a, 0x97715416821b2, 0x10195802e28a2,
+    0xb7769a8d504f3, 0xf674eaad41a58, 0xf7c10eb2197ee, 0xb247496220387,
+    0x0000000000000, 0xde0022e452fda, 0x814f0d70553c7, 0xa5bef1181d64e,
+    0xed659dbbfadd4, 0x5c8268a28d7f3, 0x72fc817c031ca, 0x07a86ed03e5e9,
+    0xa088d7e1995b7, 0xe8fe3f430d014, 0xadcabbbec63d1, 0x0f94f77302429,
+    0xe66707381d731, 0x6edecb4f95911, 0xeb28817206990, 0x8acc2c61b280d,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x9ba658c1f9460, 0xf6a9bd09d8e58, 0x40cdb4e755447,
+    0x38bb0c7aa46ca, 0x7b6e85546a3a1, 0x0a30e56e00ed6, 0xd6bf0198eabb6,
+    0x45bc39568d9b4, 0x12c6e699e5542, 0x82a2375d82bf8, 0xc7d4eae0e9abc,
+    0xcf25b3e8634ad, 0x82e57ed355ad5, 0xe842a886f922c, 0x7e59cf286ae8e,
+    0x0000000000000, 0xb18b48e1df3f7, 0x04bdca0a6cc0a, 0xdc04eb4865710,
+    0xd2cad2e37a158, 0xe68402ee509bc, 0x58ba99834d376, 0x1cd459a829b9e,
+    0xdeebca99c74cf, 0x73e8794c2c3a3, 0xe4bf6d1002a3b, 0xbdf1e6686e90f,
+    0x2b7ea02cadb95, 0xac8da423787d2, 0xea5e1a2aac50f, 0xd9e604537adf7,
+    0x0000000000000, 0x5fc03a103eb15, 0xd9e6d336fe5f9, 0xc84d7bf7cb717,
+    0x54d33ad65a28c, 0x01598251fb61a, 0x34f2e4e60512d, 0x3222a1333acf8,
+    0xae132b3816aa0, 0xbb0f45156768f, 0x7241857a55268, 0xd380bddcdba4d,
+    0x4446225f13307, 0xed7b7be84852a, 0x81563e4f19ed2, 0xbc67f4fa468dd,
+    0x0000000000000, 0x1ad263bed592a, 0xc9d8bd87d0339, 0xa4b7ac7d630f2,
+    0x04b20d4f1caa9, 0x29e720e56f414, 0x6e795eed93f2a, 0xfd43288fb3262,
+    0x3fb57b713a9d8, 0x439b0bb9d70ef, 0xf84ecc42f4774, 0x964f857ef194d,
+    0x021dad98f6a59, 0x1ea3f508f5489, 0xc4ad52491319e, 0xd1a26e5ffb32b,
+    0x0000000000000, 0x0a127b78a3359, 0x3f4d463bab3b8, 0x1fab050ec945c,
+    0xb180e4c9d244b, 0xf742a1e8a5e9d, 0x1fc34445eab0f, 0xc23ee5bcd8f3a,
+    0xe4139b0131f8d, 0xc98916102fd14, 0xc80baa4e46c15, 0x391f9f5e9b583,
+    0x1d532f032945a, 0x4a5629e4532a7, 0x130230689c31f, 0xc0b762739a55f,
+    0x0000000000000, 0x0337c7b07e9d8, 0x203e46dfb629c, 0x7743230262fb6,
+    0x70a13f58c65ce, 0x4801618e105cf, 0xf9ca83ab18706, 0x14f0c48fbb954,
+    0x42164bbc38156, 0x4d456a592880a, 0x410c6bf73590f, 0x1cf5d5bf28fcf,
+    0x46b81df35f2f5, 0x90d7ce0defce0, 0x0e21c5f814af3, 0x86f4e1cd7036a,
+    0x0000000000000, 0xd2a0349dd74fc, 0x0ef34ea62ed4c, 0x83f325df65412,
+    0x8816ecff016c3, 0x9588aef3a54b1, 0xb77745dcfb57a, 0x1976963aecb32,
+    0x5a533293d5ffc, 0x7a487fd483b3f, 0x22ad660aa79f8, 0x9202efb0ebf65,
+    0x6e8798a2e2ea1, 0x093e5e1858ea9, 0x9944fecb182b7, 0x8320cdde07988,
+    0x0000000000000, 0x3b1a807c5364e, 0x564035458998a, 0x5210a5b4c933d,
+    0x16ad260aeee75, 0x2a22d3cf46943, 0x4db1674529c76, 0xe797385582a4d,
+    0xf28a54d0e74da, 0x1e25e9ee453dd, 0xde62013070966, 0x0b05d5c4f7136,
+    0xb0975d7409d87, 0xc76fd9f1cac44, 0xdb27600acfd9e, 0x2a4c17f51d2c6,
+    0x0000000000000, 0xd92cca588d420, 0x69592c6278328, 0x7fea233164e3a,
+    0xdbb7b595c36fe, 0x382bee8d660c5, 0x709fe1a069d5c, 0xf92167ed24f4a,
+    0x246758970fcef, 0x5920879e4b5f3, 0xfa0d60925cf9c, 0x5afda9f844625,
+    0xbd8a470244438, 0x6e3e97984e1bc, 0x65fa9c583ec03, 0x38b38b523f966,
+    0x0000000000000, 0xd9e772a1716ec, 0x81b3c56ebb377, 0x22fc71bb80978,
+    0x2944d06dfe8bb, 0xca70141e03a6a, 0xa58abbba8e89c, 0x2840a65c9e3ea,
+    0x5cb3ef8fd2b56, 0x73b7ce673cf04, 0x752e1a45ad119, 0xb5080b14e42f3,
+    0x03bbcee0a4874, 0x485a021187417, 0xe754d1fe8fe9f, 0x5608df54412b7,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0xfc1df3f66f295, 0x9a17aab96cc87, 0x68e313acecedc,
+    0xc325d67839921, 0xb5b61efdc2853, 0x689098ff9fef6, 0x81b11c5054b93,
+    0xe59886b3941bc, 0xd1381ca8d4aa5, 0x1764ad5fadbc6, 0xb7164fa1f8af2,
+    0x7e8100f553a12, 0xb7aafea1d1326, 0xd5c22580802f1, 0x203fa00ceb1ac,
+    0x0000000000000, 0x15742d25980f6, 0xf8ed51ce44125, 0xa0ec5746d32c0,
+    0x6a5955c2a22f5, 0x5022fb3c9801f, 0x87256eea6b407, 0xb9fa66fac4a56,
+    0x9ade1a4b217a0, 0x88636c0b4df14, 0x6f5c0e0fc7003, 0xbd7deef507219,
+    0xed1e0093925f4, 0xd2e37658ab595, 0x9d705d766ec79, 0x23d0b3026526e,
+    0x0000000000000, 0x36f0fdb08922f, 0xc62b1c658666d, 0xea1e12540ff4e,
+    0x1664092579a37, 0xb7f26563187f4, 0x89721d3c151da, 0xc0030c8bf5e8b,
+    0x23117719aa3f6, 0xed0236162ba4a, 0xb1355fa74cbbf, 0xfb55fd88c1c2e,
+    0xc17cd07bfe685, 0x2859defc096fe, 0x0ec8a09904064, 0x93ed415bac11b,
+    0x0000000000000, 0x1fe47a583206a, 0xb6999437c7966, 0xc170089fdd19c,
+    0x3aac4f8e9390b, 0x97c84daacfd83, 0x086054347d324, 0x706afed1f9241,
+    0xc88c1b7b4e45e, 0xd8ee1d28479a6, 0x3cc89140a2468, 0x8301332c373f1,
+    0xb3b29685f058b, 0x14e16c456721b, 0x2e28eabdb13eb, 0x1ee9e1d3f43ef,
+    0x0000000000000, 0x01c73f88168cc, 0x8f0fecb36474d, 0xf3edd1cfb18e2,
+    0x722a8dbf2236b, 0x651e5e7ed5544, 0xa4cd9871c76c6, 0x3d7a8d7e1c95c,
+    0xc3f1294233118, 0x78eec0320ec82, 0xbb837d394c64e, 0xcc4772e5e4983,
+    0x242bce91a46fc, 0x287ae1abd9056, 0x501c82eff1ad0, 0xb3c093904f575,
+    0x0000000000000, 0x1b777671d2798, 0xf725b1f7c6099, 0xe8e6224338311,
+    0x7b02d94034f2b, 0x5c97038b4f624, 0xe9c677dd10f53, 0x182a0d5173209,
+    0x1ed8c9dd7dfa5, 0xbc41436661740, 0x350e36b5a8f49, 0x9d52d02f869dc,
+    0x28dbbc68e1c1f, 0xff0a57c43f367, 0x6cb0fc1ab5c02, 0xafcaec4f1acf7,
+    0x0000000000000, 0x68317ac8979ce, 0x396c71fdafc21, 0x89ad513f7922e,
+    0xfcd8d5de86b97, 0x6c9d4de15f8a7, 0x2784772eea146, 0xa5d0fb40c3812,
+    0x3ffafa2104f8f, 0x5269e0854be78, 0xa11bc306cbfc1, 0xd743cc7ca58dd,
+    0xa91cbe0b833f9, 0xbd90e07a7273b, 0xdc8f26e08b86c, 0x76ef8cbaf59f4,
+    0x0000000000000, 0x2a98b48363dba, 0x6a547fb5a5b56, 0x7fecbc4914fac,
+    0xfa8bc9f80729c, 0x79d2bc476af53, 0x5f3e331224240, 0x281c246c4596c,
+    0xe89ed71382221, 0x6c99fb5dae8be, 0x86f8618054ca9, 0xc72b0ee9ba855,
+    0x3ec61d328f845, 0x1182901da2e5e, 0x7d346a3dfbef4, 0x5b02df9631270,
+    0x0000000000000, 0xf36b7460d4015, 0x566ae79d88868, 0x8d346b5103eef,
+    0xbcbc03be296bc, 0x8f58936889736, 0x6e94c988eb9b7, 0x6853fb7137b3e,
+    0xd0f8573ea0a97, 0x708d08650bf03, 0xfc079e41b36a6, 0xdbc6a075a79e5,
+    0x40abc87ad6b27, 0x792af335aa624, 0xd8edc99e57a84, 0xe91f29227952a,
+    0x0000000000000, 0xda1c3d46c62c7, 0x0f4130033ff0f, 0x216ca1eda85b4,
+    0x364ec1469f11d, 0xf9f0541349c4d, 0x5fca786558424, 0x44b19ec2f5eaa,
+    0xa81f09db9f82c, 0xc789b1319c5d8, 0x00b0d35ba5fda, 0x5e16abb7bea3e,
+    0xad6019211f060, 0x33489237b0d04, 0x3f049693d6324, 0x7ba8eeaf87b5b,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0db5e813acae0, 0x36c3a6abc7042, 0xeb6f84d0c5fbb,
+    0xc1e136664d27c, 0xa1606a3845d92, 0x6d305ba49d596, 0x181b416669b48,
+    0x487d30649cced, 0x53e9b2fcd83f1, 0x1f1d7af24ed90, 0xa30d01cf08693,
+    0xc426e501be4d8, 0x78e24ee66ecd6, 0xd5b5addc07446, 0x34dc2ce6e2ab0,
+    0x0000000000000, 0x5831117f6d456, 0x04a11953f80fe, 0xcfbb0b26e36a0,
+    0xe853cf04eac1d, 0xe33ade8da7f78, 0xb1675c86a3941, 0x2481150a852be,
+    0x796a5efc98a70, 0x458636a7b1d4a, 0x9001874a0e519, 0xdc3ca4daa2bac,
+    0x35518aa312e25, 0xed30248f7b33b, 0x362731f71a98a, 0x0d795bfd6c7a7,
+    0x0000000000000, 0x1106059c8e19b, 0x0b4cc57cd15f7, 0xc6deb4aedc489,
+    0x599f98901c4f5, 0x088e773a659de, 0x923bc4370c9ff, 0x45981d2c29f07,
+    0x86f3d00556482, 0xdb4ef1714f84e, 0x6ca7bad3e85f5, 0x4b01d6651e9ff,
+    0xb306ae0d73926, 0xeab4a131abd14, 0xbcaa041e8c353, 0x78825d80aa089,
+    0x0000000000000, 0xf908ce8232c57, 0xdf44d3d3a8bb5, 0x133573f05499c,
+    0xf0e3ecbc44867, 0x9aebc78fe6fc0, 0x111ac771f2b60, 0x46062441ee365,
+    0xc177d81ed5742, 0x476f468166232, 0x3dc1bd8ef18b1, 0xe2acf57de2ccb,
+    0x606cf5d211e5f, 0x0f8e687e18a80, 0xd7320a6713473, 0x7ce1c429f5907,
+    0x0000000000000, 0x92d0f09782c78, 0x15b5099398347, 0x63a29e5a15969,
+    0xee5a12a7f834f, 0x4649d85033a52, 0x034448185b899, 0x246be9d478626,
+    0xf3693c918841a, 0x6445628d91e75, 0x888237fcdafc6, 0x8ee513a56a4d9,
+    0xe9aef78406f0c, 0x5b9575adbfed0, 0x34d0b7652f3d3, 0xeca403ba477e4,
+    0x0000000000000, 0xbd0fcb64a24aa, 0x81f3a553789e2, 0xdaa31054a2030,
+    0x066c152851c12, 0xc164aca1d7026, 0x2274942738030, 0x72b8bc19da9b0,
+    0x44078e141f63f, 0x1488d8d45dd00, 0x6ab671ce442d4, 0x91b419eb773f3,
+    0xfa1ad788e87f5, 0xb920d3172fadf, 0x24e676d7abf53, 0x102ff1a599f6a,
+    0x0000000000000, 0x77e3d766becf8, 0xd0115f2bce30d, 0x392ca2ebd953e,
+    0x2df97ca61be6f, 0x5cdb5f37ae262, 0x65235a81911e2, 0x6cfc96afa9e4f,
+    0xad9ccb0cceba5, 0xcbff8e213a398, 0x4e0089232b3c6, 0xe5dde0f337a1a,
+    0x859f06c306bc1, 0xdc2c43376683f, 0xdd7b559fc73b9, 0x207b09da86edc,
+    0x0000000000000, 0xf155f53d2f599, 0x90b7f91f0853e, 0x4951996113abf,
+    0x27153da2c7383, 0xa480e7f642f34, 0x6138504bb26a6, 0x48561a36d0931,
+    0x5cd9ca803f396, 0xc5befa013c6e7, 0xe003acc89dcc2, 0xd3fd6f30c9d50,
+    0x43b2be28c967d, 0xcfbf1a62d2f5d, 0xfc6f9cc40197e, 0xcbe153781248d,
+    0x0000000000000, 0x389ae2fa9a727, 0x7ec29320d53ac, 0x5f60790af38ee,
+    0x3e882e14acdbe, 0x3063a7df0e290, 0xb4080dab1580e, 0xa4f6dca775e0d,
+    0xa3b9f81f2f890, 0xedd440bc45efd, 0x033fda8223a85, 0x2bc3c6ab8f9dc,
+    0x68b6b1ad08334, 0x5f116eeb0a64b, 0x4841c139c7e4e, 0x55437b7e710c8,
+    0x0000000000000, 0x920ff877e9249, 0x85b63e7bfbe8d, 0x2a988439cd447,
+    0x30b87567338b7, 0x1dd4606399c65, 0x21655479bac21, 0x420fac62bacde,
+    0xc5b4318691bb9, 0xe05c293e5fdba, 0x324a43560a5f1, 0x0455837512b19,
+    0x2cc89a2532ffa, 0xbb32b3493af9e, 0x2a5dc04bd697a, 0x0168fb420a727,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x85d510d2d4458, 0xcdcd80232c6da, 0x29fe86b08a44d,
+    0xfe8148de5b00a, 0xdd786af1da421, 0x7401bf23181d0, 0x499bbc4d8f9c6,
+    0x76e3095e41a52, 0xd760018cafb4b, 0xcf99dd7e17903, 0xfcfb2a7a74e61,
+    0x69adb445b0ff4, 0x039a2ece803f1, 0xa4f7fc1f7ac11, 0x44201376216bd,
+    0x0000000000000, 0xdc73b4e520499, 0xd8fc636cf5e56, 0x4c928a0df3d07,
+    0x3a405fd56d3d1, 0xcabf970ceb1b9, 0xe9526eb7266c3, 0xdab1d6f05f9a5,
+    0x1ffb6fd45a8f8, 0x8d582586e3bbf, 0xfb15fe5d5c8fd, 0x7fea2e14bba2c,
+    0x71b05175ef948, 0x0e71b8d2de26e, 0xaa1636e3bc0a5, 0xd504ecbad44d4,
+    0x0000000000000, 0xaa68342be4788, 0x6e4c3d9621241, 0x0666fbdf51162,
+    0xe986a7db49ee5, 0x240cb5225ea01, 0xfeef4e4c67a05, 0xef6086d583fe5,
+    0xa8a0715ef8788, 0xf9f06ff245513, 0xe8619fdeff025, 0x027fda2a8c8b8,
+    0x6366b0c2457e9, 0x2b9e6aabfe8b7, 0x32e566c1d5666, 0xd7c2959829cb1,
+    0x0000000000000, 0x4f89c8a0ca8e6, 0xb84a86812f9d5, 0xe5da4cd983850,
+    0xcf7bc11101981, 0xf7dd96502f550, 0x70faf1780a29c, 0x34892de3a841f,
+    0x192a0b8d73d7d, 0x87016a805e6a1, 0x342bf976f15b7, 0x81fcfed2d563e,
+    0xff59caf89ad1b, 0xf836a995481b3, 0x0146af298ebb4, 0x8a13a79953455,
+    0x0000000000000, 0xe8668748927b1, 0x287741d3de81f, 0x646f61a61b448,
+    0xa9750760e2695, 0x2bc8e734f057d, 0x5c186c6dc099e, 0x9ab0ba7842781,
+    0x86ca88981c074, 0x24b0d83e2775b, 0x98c4abc4ad3b1, 0xcb6985c7729b6,
+    0xf17db8ac6ed16, 0x792169c243241, 0x57e4a83334836, 0x8b56c3b18fcaa,
+    0x0000000000000, 0x17375ddf19eb3, 0xab3d77eb50a79, 0xec6b8300920bb,
+    0x815cb90b6aca2, 0xb32630cec7ab8, 0xf3e2d04b92c8e, 0x4bc5aceed931a,
+    0x0f41a80dc66d0, 0xa15269b6aa1c8, 0x1eb0625005223, 0x8a770108c0b8c,
+    0x93f286542be47, 0x55c0e71bc76a4, 0xa38c8be8aafcc, 0x1219da2f602c0,
+    0x0000000000000, 0x41d15e5f8b7ce, 0x48627cc80386b, 0x6e2f4cf22bb02,
+    0x9f299f5ace2a4, 0xb3b2c0fe12c90, 0x6b872d9098401, 0xb6042c4e6c86d,
+    0x2bbb8f279d460, 0x903566802dbfa, 0x1a81931101f2a, 0x0137c3b94c1c7,
+    0x13b9f08d4664b, 0xc7a558f9d8c16, 0x9f4a60ce44246, 0x1a0902654ae8f,
+    0x0000000000000, 0x52912af54652a, 0xa1901afee8f37, 0x1351ee78b4b9f,
+    0xd6b06b61bc3dc, 0x0c8de40065850, 0xcd1839efdb02e, 0x5db626f214607,
+    0xcb55640383488, 0xddee478a6087f, 0xcd801eb455f58, 0xca585e4075695,
+    0x0fccc0f83576f, 0x0db66103c9c4b, 0x7e4a4f68ff4ab, 0xd63c6535e5c6c,
+    0x0000000000000, 0xb9a777a86a727, 0x95591fbf5ceb2, 0xc0f158676df5f,
+    0x2e5c223b28698, 0xf951097b3b35b, 0xbd01c3f6df1d9, 0x3cf2bac20dfcb,
+    0x52b11c10c7a90, 0x50f0d671f0c89, 0x52074a88183c5, 0xc602ea4c5ba63,
+    0x66249d8e2e191, 0x3b2f8cb7cc1bf, 0x7ad8d0b98bd87, 0x90760425c68ce,
+    0x0000000000000, 0x03bbaf706d85a, 0x80aed0c8140dd, 0x386f35b7dd6b2,
+    0xc0b5687880a6b, 0x8a133a9f3344d, 0x5b9c01c258cca, 0x8fb84a93f6861,
+    0x053f89b04d855, 0xc37ece2931e14, 0x8bfaa71c324f4, 0x96e24f7052d94,
+    0x082ec266bf979, 0xc44e34faf9492, 0x80dfd05e01df1, 0xe01fb2b7f6ebf,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x02ef5664a50e9, 0x41390c3361b6e, 0x37a254d06622a,
+    0x2ee214ad0e3d6, 0x0c1dfe472e4d8, 0xb30e3e851c6d4, 0x6f46a50f79b59,
+    0x384b0dc2ffbb2, 0xe7891dd5d41a7, 0x7b2714cc8b395, 0x20a540a932081,
+    0x2364e2d0f0504, 0x60ce8df9a97d0, 0xd7a63f394b199, 0xf35fae7eadd16,
+    0x0000000000000, 0x569e6626b5584, 0xb58054f802294, 0x651e5e9f3e33d,
+    0xd51de6a66c4a4, 0x6f03327f966d6, 0xe2acac3a2d9db, 0xef2e31c3bb518,
+    0xe0c16c289b477, 0x735b7bda52d6e, 0xc294f8072b0f1, 0x1b56ddf7972e7,
+    0x5203ad2837513, 0x81ed53e8efb3a, 0xb6e32116d6ece, 0xab48af150bc5c,
+    0x0000000000000, 0xbb9dc4c85c34e, 0x9b74e1597143a, 0x8ccf56c4103c8,
+    0xc1ce94446c6c7, 0x98babbe47de3f, 0xbfec66bc31601, 0xb80933cbce265,
+    0x9eabe48cf9601, 0xbfd8a8c7a6247, 0xa2f51d555d3b8, 0x831bf96be0fb4,
+    0xdd631025e676f, 0x051766a074580, 0x057dd8e34db98, 0x9ddcf8743ed30,
+    0x0000000000000, 0x6cac4009d6dab, 0x652a48a901ba0, 0x3d8e6782b2f82,
+    0xc0d5dd2eee21b, 0x1b5257a3efd64, 0x4f718b38e73fe, 0x5489d45461169,
+    0x199d671ddca51, 0x5c19b44b7ae96, 0xf487e8cf7d421, 0xa1d53f092bfba,
+    0xaef99c97eb890, 0x9e029030890c3, 0x6ebbfcb6d5eb1, 0x8c5c5d4759324,
+    0x0000000000000, 0x47cf68656c674, 0x4b9b4f3635116, 0x21b3f9ad19847,
+    0xe88f8f4a8deaa, 0xe8114cfb455ee, 0x9063831ab10e0, 0x662c1691f3ea9,
+    0x6f3fce7863b3f, 0xc98cd77367d69, 0xab6d4d3c01143, 0x772e396ae62d3,
+    0xb3ba6a0f1cb3d, 0x25b1ac4f93c95, 0x4867e8d194486, 0xd8ae1ff36f10a,
+    0x0000000000000, 0xe65ab973336b9, 0x5e2ee300afb31, 0x5db6d8c1415f7,
+    0x55296fd5914a3, 0xbaf96ac46914b, 0x9289da4a73d93, 0xdfe760c283584,
+    0xe01be3ea3ecba, 0x7ce05b311e6d8, 0xd8dfa5cd8b057, 0x5aeae77bf4473,
+    0xcfdc7d9a91907, 0x96128394b18b3, 0x09c411385ed75, 0x5f1a01bfbe6a2,
+    0x0000000000000, 0xecf3e266a898f, 0x79f7d46228864, 0x09c06ff357094,
+    0xdd876c3945207, 0x1e478cf9292b9, 0x57f9e34c8ec04, 0x2e66330264036,
+    0xb70167c58c7d2, 0x1c39597f04d59, 0x685b617367329, 0x21be23c9eaf50,
+    0x5d990be22a70a, 0x8445c504f8e17, 0xf911b67c0bef1, 0x0c58f4de9cee7,
+    0x0000000000000, 0xb5830a2ee0371, 0x1b66e61674d2f, 0xe60804ed52113,
+    0x83798ebb4e647, 0x3a50914ab5225, 0x8d7643109c22a, 0x4fd5528230d63,
+    0xf4893679afbf4, 0xbc5f9cd5cc060, 0x3382d9f3c9e05, 0xef5c9a11bdbeb,
+    0xef8b05043ef55, 0x0426a3f42b645, 0x74d1ddbdfd5f8, 0x5e6b10ba9c9a4,
+    0x0000000000000, 0x7109821d57e75, 0x05aad2298ff3c, 0x9c400677bc1a6,
+    0xfd6484696a7a6, 0xd58115a99d7ca, 0x73196fedb1baf, 0x9c39f052b9c6a,
+    0x19a4362cb78d1, 0x15cae9c8cd2d6, 0x183536d2bd5ce, 0x189cec035d7de,
+    0x9b589386acc42, 0xa6b054af328e3, 0x11b31a0ad7da3, 0xbbde115148904,
+    0x0000000000000, 0x2643e097669c9, 0xbd327d6400925, 0x40375a8265254,
+    0x1d866ec9d8ec9, 0x9e2d7aba780a1, 0x34246788e82f6, 0xf50aea26f4971,
+    0x61515a3d7fee0, 0xcc365a9b46d33, 0x62225f3c441dc, 0x9ed4e442f73b0,
+    0xcc147b3f9e959, 0xbfaff4c8e8a79, 0xd3e082a2cf2c2, 0x097f12cc0be77,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0xe2ad77fec8187, 0xb20dd543f093d, 0x13143d08d744f,
+    0xca34e120495f9, 0x08df53e546c9f, 0x6dd0671cad8be, 0x0a9d09eadecde,
+    0xf2840f746e722, 0x6d59305576c86, 0x81a0c51d69016, 0x8896036cdd69f,
+    0xccb29ba1f5925, 0x83f44d3e26e70, 0x9475600f8d8ce, 0xe076b25d7fd90,
+    0x0000000000000, 0x1deddfb754e78, 0xdac4b51c2ba0e, 0xbda2517b195ed,
+    0x50701e46446f4, 0x26216b1d0841e, 0x53f8d54102f1b, 0x0e4e179b57395,
+    0x2ef160c51fc25, 0x07a3949745c73, 0x4f042c0bca97e, 0x992eef05aa3c7,
+    0x3a87696a07e0a, 0x9dd4a134c8316, 0x40729d23232c4, 0xaf5b63d8488b8,
+    0x0000000000000, 0x4aaa3d5328431, 0xbf1d364874c9c, 0x3006d38d4ec61,
+    0x4431e6d90fc27, 0x407a8d94a0519, 0x2d521002b580e, 0xa4249cb8b85fa,
+    0x97156a16516e7, 0x01b744c99f91a, 0xf0901f0eab878, 0x6e6efd1df40e7,
+    0x4149c7266cc5c, 0x79a134d179a64, 0xc64eaa8fc5967, 0xd60fa6eb5ffdd,
+    0x0000000000000, 0xf5938ac9d56ca, 0x2601310d4063e, 0x4f09e15f25ef7,
+    0x6b7610b310d40, 0x6a8d3d3d216f7, 0x2e51d0d2285b3, 0x7ab83e90970af,
+    0xe8398d9625db3, 0x625171c1da651, 0xbc5107650426f, 0xff41033cfa23d,
+    0x186e6b82aab33, 0xb4b6e254f7bfa, 0x48ad0ea864147, 0x235ba5a2c06fc,
+    0x0000000000000, 0x0419e9ec29fe5, 0xc6c8c6fbaa6b7, 0x58be5d59c7c88,
+    0x86e5199614976, 0x8cee6bb8048f8, 0x7d52c99f4e4f5, 0xc985c14be6045,
+    0xd63f5b2c0ebf6, 0x2e273042a19fc, 0x276e724d33554, 0x560d3bd6dee96,
+    0xae5faaaeb0775, 0xa05d841818540, 0x975c02a8541fd, 0xd3c7f7833b9c8,
+    0x0000000000000, 0x89e92d324185a, 0xce6639ff8b94a, 0xa478da746ae15,
+    0xe7e80f704e266, 0x626cc35d7392e, 0x5c530fe12eee0, 0x6e114e912f734,
+    0xc5b6523651404, 0x99b2694fdfe21, 0x24e359d283fa8, 0x74872558b37df,
+    0x401d3d8157422, 0x73fb33c2c063c, 0xc6768899eb398, 0xb73e4f61baa26,
+    0x0000000000000, 0x68c4746f628de, 0x066c91f488ec6, 0xeee42911eb6cd,
+    0xaa764f7efe74a, 0x0bb925590a84e, 0x506df2703edee, 0xbb441f2159b6c,
+    0x476dd10c4d87f, 0x30af07ea7782f, 0x8e0b8522c3b26, 0x00b16f42e0333,
+    0xedb9140a99536, 0xd4996b820e5fe, 0xc8d6d046ad76c, 0x496489d3ab6f5,
+    0x0000000000000, 0x86959a461fd09, 0x524c600b8f454, 0x68e05d9cb1cbe,
+    0x3d9535c6d9829, 0x661dc681fbdb5, 0x3e6f5e7cdb8b7, 0xf60bbbaf68150,
+    0x1f40ffa318eef, 0x55f501094e942, 0xdbb03b60e0ca7, 0xadade42bc8114,
+    0x4282df9caf516, 0xe60d7debb728b, 0x087d0cd567762, 0xe195b27fa770d,
+    0x0000000000000, 0x39e1752cc1b19, 0xff656ef37706e, 0x6cb2057b2da57,
+    0x5a23c25702e18, 0x22eb3b05462ea, 0xcc425aef581ed, 0x8781fde56697c,
+    0x788025e5d3977, 0x567097e55298b, 0xfdd9a02775128, 0x219aa817a0143,
+    0x7c4995e5daacc, 0xfff9a6bc7524d, 0xaa58b5625b60a, 0x3ac3b03b29930,
+    0x0000000000000, 0xf685c4efa867f, 0x8a0434286c21c, 0x44d9de3e35bc2,
+    0x0a0457bd92a75, 0x27f9d513ef16a, 0xb4116911c542b, 0x9443d3bc2610f,
+    0x3c298fa2547e3, 0x5c4b89e2cb9c0, 0xcd1531ce4af39, 0x80d07ab6a9bbc,
+    0xf0e3b2517682f, 0xf239a7998d110, 0x163250855212f, 0xa6614898e31fb,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x556d5fcb0ca3e, 0xce56e11c7765f, 0x10c7bb52061f9,
+    0x0c039d020c1dd, 0x78d2c89ebe620, 0x41de1876ffff4, 0xa99734d2aaf75,
+    0x60edf11bb374f, 0x8a72060698314, 0xb878519505f55, 0xfb002e4c2a01e,
+    0x1de6b73509272, 0xaa71c22693983, 0xe91723d3675b5, 0x1d725374af338,
+    0x0000000000000, 0xbb40eb6f5de7b, 0xfe4cfdef6377d, 0x20204ab3023ed,
+    0xd44ab7b690765, 0xfdd1685e0c22f, 0xa7772795dbd39, 0xe429ea4077bf6,
+    0x07883a0baf3f0, 0x3c9d8f90e8f2e, 0x59b52a53014d2, 0xa8190298fa05b,
+    0x23d0728d162da, 0x7a91c7c64017f, 0x7b99a5a6336f8, 0xfe6c21679f3d2,
+    0x0000000000000, 0x92b00751e1fef, 0x35b399363df3d, 0x2ffc9f16c70c2,
+    0x26b42700b4f64, 0x2a28896eae23c, 0x8cf21afcc1779, 0xb11396a5531e3,
+    0xeb8cb2a326de7, 0x818ec0ef3f19a, 0xd45d6a9a7135b, 0xd7cb9ed98a0f9,
+    0x27ab82426f639, 0xbb09749c2c375, 0xcaaa3de3c9885, 0x302fb7615c669,
+    0x0000000000000, 0xd985badf10d77, 0xca630a715e9e9, 0x91bd2db43fd54,
+    0x2c1e20576d051, 0xb2696df64fbcf, 0x059d71556afd4, 0x4109f1178283c,
+    0x95554f5a8d631, 0x208984d6e556e, 0x2d5a4c6bd4886, 0x3386d638390a4,
+    0x115470616e670, 0x9c65493192db3, 0x02bea601a33ca, 0xd059c56f0feff,
+    0x0000000000000, 0xbda78c0fd8245, 0xa21011f820ffa, 0xb628efe88b079,
+    0x9e70d2ad712c7, 0x7dda2e431d5f0, 0xcd464d797ac5b, 0xad6fca9d9a669,
+    0x236ba14fb5cfa, 0x39c8759f8ce26, 0xbb6fb06eb4ca9, 0xbf38ce114e146,
+    0xb91fafc5f1d14, 0xe4d0c005b43b7, 0xe7f1fccca0d47, 0xc0895a463c25c,
+    0x0000000000000, 0x97cec621ec6c5, 0x22d3bc633f64d, 0x5aa9f12bfba37,
+    0x15f46314322ae, 0xc534fae6e4492, 0xb5704792e451b, 0x8704c02cc6d9c,
+    0x53769e29d950c, 0x12e68d31dda79, 0x4ff8ff7ec3580, 0xf3f47210e5626,
+    0x5973b7d80201e, 0x8ddb4c9b7db0b, 0xc02eb843208ac, 0x84e0ae9144e8b,
+    0x0000000000000, 0x9de36f6534761, 0xdab0c59875522, 0xa6bf18f267591,
+    0xdfb189904b573, 0x7e7dbd8cdd088, 0x5e597af0ac852, 0x734cce222bfe6,
+    0x43eac3b6e6d4c, 0xcca23ac810061, 0x11a48e05373d8, 0x0b4e419434a72,
+    0x9e0f5895406d4, 0x5bf702e4e17de, 0x808c663b3a3b3, 0xe6e5863431f07,
+    0x0000000000000, 0x929578b20f59e, 0xdc95736a8523a, 0xb421ccae4b5b7,
+    0x124905a45ef02, 0xf4ef874ad439d, 0xea395b103df49, 0x1f91ac825f36b,
+    0x400e396b6857d, 0x56478bf8609b5, 0xe4a8fbb3979b0, 0x6ec8f33c56e5d,
+    0x0c31cccb645b1, 0xc04013af033b3, 0x88a5803aca8d2, 0xfb77be33c2ffc,
+    0x0000000000000, 0x08129148b6a34, 0x8fef5b787c715, 0xc67bf1cd29ca2,
+    0x26cce68a7b470, 0x7cb0370574ae4, 0x64c0ff787e784, 0x92e86c7f3bd64,
+    0xb3b40a28cc2c6, 0xcddf09775a789, 0x491eee98a201b, 0x2377d71b82c79,
+    0x3b9ca7297ebba, 0x6cc4424bb90f4, 0xc7c5f1f210255, 0x21ae5416bceb5,
+    0x0000000000000, 0x260858df1e4dd, 0x32a66393c6305, 0x9fec0f9d28ada,
+    0x4ac5f0db2cade, 0x64164e011a9ed, 0xfb5cd61203736, 0x2a979786146e9,
+    0xf0142ca52de79, 0x5e0369ff9dece, 0xf0007d6892359, 0xe8e3da3fa5230,
+    0x1163f0f76a3ab, 0xb5156ca20fe3a, 0xbeaf0e5cb1ca7, 0x76e2adba28c8c,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x2df7b80140bb6, 0x34ecf897f6f48, 0xf50eba9907845,
+    0x42cd205524778, 0x7ea04c025c234, 0x56ecb9047f7ad, 0x4e9e905e8801e,
+    0x536d43744d95a, 0x165aa927b045e, 0xd328b5d7b8d23, 0x0f6199969d3f7,
+    0xae85c8a1cd3a0, 0xfc399be05eaee, 0x0f8e003b5bdf7, 0x024294174314e,
+    0x0000000000000, 0xf0872cf54b64a, 0xd40891f4ace54, 0x8d3cd0a207ce7,
+    0x0d86fcfeb993a, 0x1d576eb5bc6e3, 0xc0419ada07964, 0xda588d9317356,
+    0x80dbb696fec4e, 0x5a88615bfb6d6, 0xc3482343c8c1b, 0x2dfe14395436c,
+    0x358934e20b8fb, 0x15b85d1b660f0, 0x8527274a57245, 0x0b0e64667286a,
+    0x0000000000000, 0x5ba02c9e702cc, 0x51c5f6bf7708a, 0x739e82cb4d9eb,
+    0x1cc7f2d2ee992, 0x54223a0c8af24, 0x50f4068cf00ae, 0x19a9a7dd2da12,
+    0x86879c7360fe9, 0x0e537eceb785b, 0xd6412a830827d, 0x9cdeeaaebaacb,
+    0x25ae0335df6a0, 0x3794d0bbc599b, 0x66ca7d88c7731, 0xd156923fee033,
+    0x0000000000000, 0x6a4694fa2136f, 0x7ca62fe89ee25, 0xf0644d8449594,
+    0xc209546bdb299, 0xc0e5613f662cd, 0x9932b48b1761c, 0x4bcaf8f5a3749,
+    0x6d4736a564e15, 0x9abb3159c10bf, 0x3c3123800d03d, 0xeb7a9d2a1b890,
+    0x4d2e4715ba58b, 0xf82eb21de0f84, 0x936c74abee8c5, 0xe227ace52ae5f,
+    0x0000000000000, 0xae62ca46c9431, 0xeae6011a07c37, 0xcbd76a8d8e3aa,
+    0x531516a6eab71, 0x028ce55505c35, 0xd027ed5df7b48, 0x90a443a4cb203,
+    0x1262e7ce9d679, 0xdd04a8e28d4d9, 0x0adb26e8b1c88, 0xb39922020d39e,
+    0xae0e034819288, 0xfe25514ed1cbd, 0x12b9b55727b40, 0x1605b70b16aaa,
+    0x0000000000000, 0xa69d6c72a601f, 0x028c949d24cd2, 0x70e615b524f49,
+    0x5f1492f99e62c, 0x8f13970cc990c, 0x47582b64d5053, 0xd485a44b488ab,
+    0x4cced89ee75c8, 0xbecdd6e00f28c, 0xcc141ef653506, 0x215a5f5d1bd2b,
+    0x19fefa4e2bb55, 0xf28ec04a2e744, 0x57027bb271761, 0xb281e67d6dcc1,
+    0x0000000000000, 0xff0af210ce686, 0xab99c094a1a4d, 0x5c8640e63517d,
+    0x2cf5197ae7709, 0xd0125e567ada8, 0x9dafc0b2b2838, 0x52e114f639cac,
+    0x5fe2dd4f732cd, 0x9dd33a1ba0039, 0xfcec492600ef5, 0x2562676a2929b,
+    0xc9642ed620d6a, 0x48af524dc53ed, 0x928e2f970c537, 0x6fbf3f85bb3cc,
+    0x0000000000000, 0xa108647e23ca9, 0x31fed19d9cf84, 0x5d1f7641b7c31,
+    0x2013e12e8e95c, 0xaba356a9a92ae, 0x42b0735598013, 0x97d8de7b65a49,
+    0x04a4d97d2a3a7, 0x8eb356a6ac60e, 0xc4f167aada702, 0xb5e28b26fb732,
+    0xca388a0eb6676, 0xa2211874bc8e3, 0xcfec45d3c3596, 0xa981e4fec5e55,
+    0x0000000000000, 0x72d54b7301dc8, 0x51c154036f7f0, 0x533b5e347624a,
+    0xb78cb72aad7be, 0x63f78b3288848, 0x43d3e98eb1af7, 0xb3a38e169cc3f,
+    0xe046cc62def6c, 0xa7e288648c388, 0x2b30aa45564b1, 0x7e05c38a961be,
+    0x2b9ec718ce292, 0x3867170f6fba4, 0xa6515494badc6, 0xdec12792503fa,
+    0x0000000000000, 0xb4fc0d011e4bc, 0x3d437b50c3205, 0xb62eca9e05454,
+    0x0320e70b96760, 0xaf0fe9739adbe, 0x16f5585fc7a3d, 0x3426a0a9bef31,
+    0xc590bfe781afc, 0x90a588a4b8a6d, 0xc6e02c0ac4c2b, 0xa079daf5a4190,
+    0x94d6438dd671e, 0x7afb82dc3675f, 0x891adf4a13101, 0xf15d568c26916,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x1074e0ee1b4c2, 0xe4e5c561d5097, 0xe11d3ca26e4f4,
+    0xa3a0634a3ce07, 0xaec258520a2c4, 0x0691bd00993fe, 0x0f00e6b0be3a0,
+    0xd708c668b7357, 0x885c24d9385e8, 0x3aadacad861fe, 0xba0c4a33b422b,
+    0x69fabf8171af2, 0x35960fba3ff9d, 0x82b862cd0241c, 0x108049ad50800,
+    0x0000000000000, 0x1a0ff10eeb73d, 0xb584aedde8b8f, 0x1b14139f491ff,
+    0x8f38d14324956, 0x915b7dc3ddda7, 0xa22e8c7e769cc, 0x5d5ccafa2e39f,
+    0xd96ce839038b2, 0x1e0ce8f156866, 0x728968c29f469, 0xf358e51013511,
+    0xdaa667e7601af, 0x2ffc4f160ba2b, 0xd5f4b4d5c9f70, 0x30246111e74af,
+    0x0000000000000, 0xc77549f2e087c, 0xaba27830c0d36, 0x60901232c4265,
+    0x2232fc3562771, 0x210b8c7640bae, 0x2e45c0f866f4b, 0x0f95f61749ad1,
+    0x20e1ea62ce28e, 0x598ebd1a49608, 0xa750470e11a15, 0x07c0aed9e6427,
+    0x6464ec1dcb390, 0xc21f3f6596c66, 0x03616ac9c43e9, 0x19cd62694e4ac,
+    0x0000000000000, 0x6808a5e2e0837, 0xc7d59c0f869dc, 0x530fb7e316257,
+    0xd389e5a0479ef, 0xdb7ce18b02fbf, 0xbab975415dd91, 0x16cbdeb9e8d47,
+    0x713c58763eab5, 0x8e739be1a12a0, 0xc0a3d7106e1dc, 0x095bfb739ec6d,
+    0xa22610bd7bcce, 0x426edc2a634f5, 0x5cf11fbd612c8, 0xa042e79f353be,
+    0x0000000000000, 0xe948c7156c74d, 0xb714a35cbc32b, 0x551875efb3afa,
+    0xb882744b806a6, 0x66773594b6aa2, 0x35312077e7ff2, 0x430e63e7cbe42,
+    0xe2c4523fd6ed2, 0x19846ae0047f3, 0x4795cd6edfb40, 0x37b2a45b15a33,
+    0x859b6626f229f, 0xe9feeac3129ac, 0xa4a6584f7d931, 0x7b32e67eaa1f1,
+    0x0000000000000, 0xc13bf7c11f82c, 0x4bed4bc22d71a, 0xb1b54632ec555,
+    0x0bd687af4d435, 0x85352c78f4c36, 0xf2564de53c9ab, 0xbb883fb4d29fc,
+    0xeae1cb271027f, 0xf023d4d2bc9f3, 0x6e92d878bbb9f, 0xc722997c78b5f,
+    0x8945a09badf9d, 0x7d72a1a81f925, 0x6bfda9f50476d, 0x6bace8c4b19f5,
+    0x0000000000000, 0xa51472ee287eb, 0x061f00680d9e0, 0xe9c4439382ff3,
+    0xd3172792b960b, 0xf5663e017cad0, 0x3c181c5957f06, 0xd9b29949382e7,
+    0x5e4f9c4b8cf67, 0x858cb7f34245a, 0x66fcf6ec5172e, 0xdeb1d6f7d679b,
+    0x0f63df864c54c, 0x84acb74650831, 0x477ce5d48986a, 0x679e5c6caae2d,
+    0x0000000000000, 0xb28c4e6f906f6, 0x33bf0836adf25, 0x1de876aadd0dc,
+    0x1f792e60e4cec, 0x7a34ee1eef6bc, 0xeeae49db717cd, 0x3ce813d9fd2dc,
+    0x9601ad02024a9, 0xc0c5da0de4ae8, 0xd7c68095eadfb, 0x47d4e17f47f0b,
+    0xc41802e289168, 0x71ae242331f2a, 0xf04ff8d8bf121, 0xb057e25ee223d,
+    0x0000000000000, 0x0fef0b165038c, 0x0d7fedb3d768c, 0x30a8a00a2fc12,
+    0x9dcb17063be91, 0xeba30d4450ba7, 0x990fcb756c323, 0xed5af0affa773,
+    0x7d73ac0716494, 0x90cc64773f0cd, 0x4bd4cacaeaef5, 0x665b0e915f4c8,
+    0x901f268652c43, 0x3d3fe609c1017, 0xf569feccd1b4e, 0x7713ca7333d2e,
+    0x0000000000000, 0x2d8b6f1c9d932, 0x95c616b984e3b, 0xb9633cb6c9fc7,
+    0xc5902f6ffb4b0, 0x79e5078390b86, 0x638c14c11df80, 0x524719f401cbf,
+    0x64337442ffcdd, 0x32b56b274a882, 0x19f101bd87de5, 0x674afa80f06b7,
+    0xe1416760669ef, 0x6f9e8204d2fe1, 0x7f6fc7091e0b0, 0xcb26007d9dc44,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0xd310ce2cf5a19, 0x8c5d5c16b3659, 0xc5df7c840b705,
+    0x4fbf6f215ba3d, 0xa7ebb3ac3c815, 0x28e78f4a5ea0e, 0x1f9e54aa00229,
+    0x7851b23ec84bf, 0xbd4de2f840e5d, 0x88b8719482c2c, 0x0b3e460422678,
+    0x1a81548af1a0c, 0xe7955a0bac400, 0x485c53a3fc86b, 0x89d25292570e0,
+    0x0000000000000, 0xc08add6b6df57, 0x9b2bd923c283c, 0xf8bcd4b997490,
+    0x918e7c66f8fb0, 0x0f0856182ed9b, 0x2bef838cd2257, 0x9340037864669,
+    0xbeedb8574d7b7, 0xf79fda7741d16, 0x1021e856d0da7, 0x376545ecd30b0,
+    0xd52ea8e081ce0, 0xfe7629325369b, 0xa6675327cdf4b, 0x7498a0e28438e,
+    0x0000000000000, 0xdcd4cb28cd825, 0xfbaf03219a32e, 0x81108276d0d45,
+    0x95b38bbb07b90, 0x378a1a2b9a9af, 0x87a8d60d17a72, 0x8b248693fd694,
+    0x286ebfe9b645b, 0x25184443fd7ff, 0xdd898a1e66699, 0xc02d80f521fcb,
+    0x6e5f5672dfda7, 0x9aeed32e11f28, 0x0c1e070896bb5, 0x74c9a94a78968,
+    0x0000000000000, 0xe1cbe48bebf85, 0x5bdb0f0d8e95a, 0x02377cdd67bca,
+    0x022d201c5b207, 0xca97b1d8b4df8, 0x5d9cfa69e0716, 0x115449bb273d6,
+    0xe45ce0c8710d8, 0xe5993934cb753, 0xe92ea3d2d172b, 0xc5ad6d7fbc738,
+    0xc0e4f27a9e517, 0xed9c96b65443c, 0x7ab83dd6958ee, 0xbbbd077ff5be1,
+    0x0000000000000, 0x51f1d5aa6a644, 0x27d3039b5fed1, 0x14fce2db6f27d,
+    0x344fdf3937c67, 0x36b0b20290397, 0x7fd4b6ad41b5e, 0xf5bd76f50bb3c,
+    0x56a79aecb4766, 0x095d3f0208a51, 0x17b6806ec1f2e, 0x810e1f4062971,
+    0x79ae9082e98a8, 0x70dccef5e0d3f, 0x6cd2e84090814, 0xc35ecb0128d4b,
+    0x0000000000000, 0x08ba85cbebbd3, 0xc59ce26d89427, 0xe3f117e648857,
+    0x5a11142ee01b8, 0x0b605493d9c19, 0x68c5f0fe6389b, 0xaa9dd7d596fd7,
+    0xf379f83c2d312, 0x31c271c366e1d, 0x4d39df64d6b5b, 0x07cfeedc18f9d,
+    0x370477876c85e, 0x6aa9798523b96, 0x5346563a1d1e5, 0x23650b209a160,
+    0x0000000000000, 0x1bc84d8a2aa19, 0x676fa1dec9a4c, 0xf0333d0e7ed1d,
+    0xcb5fc7b97506e, 0x70995a216c4c2, 0xa41b8fdeb62f4, 0x35382314c270a,
+    0xbbc5340ea164b, 0xad48bffee3c0b, 0xb4d4d80acebf3, 0xaa498a8a5bc89,
+    0xffabdfa814703, 0x4b48a20d9f6d1, 0xabb0c7cd4d48d, 0x8c8e920ea32c1,
+    0x0000000000000, 0xd343d2d77518b, 0x121992696f0b3, 0x0a01118ec617e,
+    0xc2ae4043311b8, 0x2e5809d8a98aa, 0xbdd1c7fab440b, 0x5fdfe8c533cf0,
+    0xdf851521a164b, 0x85bae0709e87d, 0xb5cedd9cf50af, 0x8ee8cddab9a4a,
+    0x12456e510090e, 0x73e4f8925a7e6, 0x0e69c1cc6c675, 0xeec6bf98cebda,
+    0x0000000000000, 0xa9098229b988e, 0x260c98b8c7cfb, 0x4ee5709c06c4b,
+    0xe1937f2450b7b, 0xff5bd9e31d83f, 0x99b818b71d34e, 0xf10c87f6d49fa,
+    0x9d5d5e1ac3081, 0xb3d628f4c0ce2, 0x91b2e92a315dd, 0x9ec59e05595fd,
+    0x9eb3e7ad51ecc, 0xb0b0dcf3f6181, 0xea8dcc0404c2a, 0x50f34fa2156c0,
+    0x0000000000000, 0xa9f940fc8d07e, 0x541c1c9792927, 0xdab7ea6c1a689,
+    0x45fa26a70cfe3, 0xff6f9aad63d7e, 0xfc688d36df2d2, 0x6ca0435595140,
+    0x081b205779b7e, 0x75ff7a2cb5870, 0x93bb90acc92fb, 0x8e36b222086f4,
+    0xfa32bc25af2c3, 0xdb1ea93b4ab36, 0x81b6b86a41027, 0x0b65a67818c89,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x9af391a8697ed, 0x83fd796b1a72b, 0x60e953220c950,
+    0x976185cedb78e, 0xf7278f0bc1d9f, 0x01143e168da89, 0xb1074cb211390,
+    0x8f08161486b22, 0xcd2d6fe66da8b, 0x8ee0fab74fb00, 0x4943b0c270afb,
+    0x5c588238c02bd, 0xb819df45f6cb3, 0x90b34d7ba76c3, 0x4406aa31e69a8,
+    0x0000000000000, 0x7fe5bb7320546, 0xc549640b910ec, 0x50cde8fb393f2,
+    0x00d5ac29ab973, 0x496dca1b48f0a, 0x2c3099b9eb59e, 0x6678a9fc827e9,
+    0xbe755ab4efe68, 0xeb427903dd2c4, 0x95eb8ddeb24d7, 0xca09c985f0069,
+    0x45f7454ba444f, 0xb5f42b8e4b4e2, 0xc4a8d73fd94f7, 0xe3eb218f456bd,
+    0x0000000000000, 0x80d05ad03f5f9, 0x1f3c076c5166d, 0xa413b2a702889,
+    0x5376ef5010492, 0x1d83189cf8664, 0x25ff63d215b33, 0x18b60478657d4,
+    0x48d9609c012b1, 0xa443a7032d378, 0xc9bf0fe1f676a, 0x28176b48dc489,
+    0xed721ea013fa0, 0xa381ab57a21ec, 0x626def689c0d6, 0xe8b525c107773,
+    0x0000000000000, 0xf9b7973b1a3ca, 0xb7e4e553ff932, 0x332e984bcefe2,
+    0xfcfdeb7cabe96, 0x283fd56845cb6, 0x08968d804011e, 0xa6004cab7b24e,
+    0x98843db068e78, 0xce272a6f3d8ba, 0xfd61ff198fc07, 0xce14b508d4193,
+    0xb8d7d6d40b674, 0x1362b66be773b, 0xb33cbb05d7dec, 0x3d02e5c307dff,
+    0x0000000000000, 0x33b52add9800a, 0xe97e2f7e676d2, 0xd3385a0c0a077,
+    0xe82ebeaa6eb29, 0xbf24b6d870c94, 0xbc1df3473b59e, 0x0d92fbd9133b3,
+    0x2d958488ad0fb, 0xc144718a108ff, 0x44a7fcd19b8e5, 0x883f92626cf05,
+    0x8cb6c7aa4e86a, 0x75a07ba5f58fd, 0x35bd5ac8780e1, 0x7cd0e433df383,
+    0x0000000000000, 0x3cc487ccc82c5, 0xa2cdad5097c11, 0x75c699c0d7c54,
+    0x856863e849702, 0x67c38decf0a4b, 0xd1f5801943c98, 0xa48799bdce8cd,
+    0x3f6d23cff5eda, 0xfbf4354e6aa48, 0xc7711ce47f0a4, 0x253829c040848,
+    0xd2ade72aa222f, 0xba59c1afc3b41, 0xced647fa85d1b, 0xc59e7db0b3e4e,
+    0x0000000000000, 0xf71a0da2ae069, 0x4bc0c5cedff5a, 0xe7bf28168413a,
+    0x2b7dd5820c1d9, 0x032447ae80c10, 0x0c5bda5da6157, 0x25b44419baeb2,
+    0xc41d3ec7372a8, 0xebd0aab87f530, 0x50c5c03483c80, 0xfd580851e4fe3,
+    0x6a8da07fced38, 0xd63af0d1ce40a, 0x91d1de02bc1f0, 0xfdd2fb0274beb,
+    0x0000000000000, 0xc060c7047e46c, 0x757d09eef397f, 0xa61523b7c0a53,
+    0x80b85b8b6adb3, 0x0b1fd21409e5c, 0x7a0c4380d8c63, 0x4a81ee65a09cc,
+    0x35d185ec0b176, 0x9f1b8087c3b6c, 0xf9be6f02dd15e, 0x80eb3b4189ca6,
+    0xdc1c7afd9037a, 0x57f47dae5f885, 0x54501b39127ed, 0x6e5869b1a40ba,
+    0x0000000000000, 0xa21503aeb64ab, 0x7434958d95f66, 0x15dc4c7aa8fe4,
+    0xcc2bebcb2a1da, 0x9ff1c429efa9e, 0x0f8e964b13060, 0x53b0010b5bfb7,
+    0x6314a5925e490, 0xccd8d5c90ff00, 0xdaf8e3de2de0d, 0x15f035452f309,
+    0xc9763fd54209a, 0x67c22ba0a7443, 0xd624e0f90600f, 0xff1c2d6c313c7,
+    0x0000000000000, 0x4ed0075b1d33a, 0x4eee32eada9e7, 0x1d73e21f025b6,
+    0x1cb911240a24e, 0x8892e86e15327, 0x58a094d53eded, 0x2fff7f0a20732,
+    0xa3de4ff957947, 0x50196a3a287db, 0x39847f7a5e26d, 0x518645369a5ab,
+    0x5e9c263c056f6, 0x48658a8396cd3, 0x9e43888f4dccb, 0xc577be9ac1fa6,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0xa2bed91298551, 0x41f85b3f06836, 0x75b3226d07432,
+    0x9339d66471f42, 0x03dde1f1a5d52, 0xcfc494c95fb06, 0xcc5ecba134583,
+    0x29cc94c1b43aa, 0x66654d81806dd, 0xd84010b7fab43, 0xcf67735430df5,
+    0x6d944ddcccef2, 0xf38fcca68f1f5, 0x0e0e2af379977, 0x0b152123d8877,
+    0x0000000000000, 0x0c49a79f6b129, 0x3aba0e3496ce6, 0x0404ff602d534,
+    0x86865738f288e, 0xb577dfd4d5f84, 0xa4907f140feb5, 0x6e417597c8c87,
+    0xd43d2ad417dd5, 0x56a541ae31857, 0x16913ccbaba72, 0x834f9b22f6fb8,
+    0x0fa63243490e1, 0x57fb3bf95c993, 0x5b485bb7e98ff, 0xec38cd0336082,
+    0x0000000000000, 0x22374a19da463, 0x7931548ea6b77, 0x5cecd5484eac8,
+    0xec9ab31ac9389, 0xbe9078dd5dba7, 0x0b36c2ab606db, 0xe7424db9190e0,
+    0x360ab4fa2dfe7, 0x8993280a4e9b4, 0xe7685f4fbd575, 0x13e332832fe34,
+    0x46f022ce56131, 0x61a214cc69231, 0x91878bb57b8db, 0x7aa7befbed80c,
+    0x0000000000000, 0x1305962f001a1, 0x149273aecbf5b, 0xa302d45c73f9e,
+    0x6dfc0b78b477c, 0xb63f6c55fc6e6, 0xcb3960b49d97b, 0xabf3d74c7a1c3,
+    0xe9eb552cc454d, 0x149a846e7e1e1, 0x4f9fdbf2c2126, 0xf33da1eea4be4,
+    0x01ae3675b6f84, 0x7db17cf7babae, 0x82614e3bd4792, 0x848a1ba71c362,
+    0x0000000000000, 0xa3a3cc4dcc90a, 0x1858c42c5d2ef, 0x4f3891a06a03d,
+    0xd22531d4c9b75, 0xa41589f406c44, 0x8ba1501caf437, 0x90fa14da097fd,
+    0x35a4732c24fb2, 0x90b6520cf3b64, 0x1da8cf6c42dbe, 0xa761889a8465a,
+    0xf4e87a2968f12, 0xfd98e50717730, 0xcfa61efdfcd5e, 0xf8edf8429150d,
+    0x0000000000000, 0x188b4cc026cef, 0xddc70d91528b8, 0xcb6f010b3fe75,
+    0x957b1f72bea7b, 0x4e22d011d6f2b, 0x64747fe423c9a, 0x50146d725261c,
+    0x8d1e843cf82a2, 0x625d252a80f84, 0x18823fee054ed, 0x1fc57991c740f,
+    0x7c3d0bb679007, 0x983b30ed54d5b, 0x54c8102d4202d, 0x5f17939f850e5,
+    0x0000000000000, 0x2ff30fbb1d3fb, 0x8d341c157c1ef, 0xede5d55eb2054,
+    0xf90819668750a, 0xde50ea78c7d41, 0xc2424280c2eaa, 0xcd506a0a797f7,
+    0xab8e67bb7a406, 0x37095423a545c, 0x6075423c7840d, 0x297456ab813ab,
+    0xf09e3c8889eef, 0x239679e769ad6, 0x3dd859500a3a6, 0x63039fdc96772,
+    0x0000000000000, 0xc36e3761cad09, 0xa690e10df0a32, 0x368b508dad1db,
+    0x023544082b7ac, 0xcbe6106d2851e, 0x71fdec7d118df, 0xa12a3868fff70,
+    0x191877eafbca2, 0x80712807fe5e3, 0x75774cbfe5c39, 0xdf31adc0aada6,
+    0x10767cbde7b28, 0x2032411f9b52e, 0xe2a02c7fc8ed9, 0x47d5b89df7e44,
+    0x0000000000000, 0xdbdbdc6354b93, 0x64f5d30760fd8, 0xd73939be670bb,
+    0x10dd35fa97aa9, 0xd1eeb5f09314e, 0xf07545c4ea8ac, 0x15faf0ea141d9,
+    0x574ab099566cd, 0x3681a83983cc0, 0xa7ee5fb74afab, 0x465b8ca7bf224,
+    0xd9d972a28017b, 0xd446016841838, 0xa2324fb2cf25c, 0xad12de2687ae6,
+    0x0000000000000, 0xb2ab73317cff3, 0x0d14ec3b44ea3, 0x96eea518f7b3d,
+    0x0657c9376d4d3, 0xd6e27099f4592, 0x0f4ddc8014f75, 0x2b8568edc3216,
+    0x9f922f9872f62, 0x12d6effe70862, 0xe18bcc5859afc, 0xdbf8ef6da4096,
+    0x4c5a91c699e30, 0xcc1c31752493c, 0x721bbd771b1dc, 0xaea112c9a3043,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0xc16671a6774f1, 0xd7989af2b44ed, 0xc00f43b2ea849,
+    0x188556b53942b, 0x61e599731e691, 0x02bbc45ca6067, 0x257feb988a43f,
+    0x981c54aaf54da, 0x9dc994a121c9c, 0xb75a13316ac47, 0xd0e5485727377,
+    0x2c0c293fd7f9d, 0x90d2fa5751b64, 0xc0f9ab5bcf0ab, 0x79efec8cee36f,
+    0x0000000000000, 0xaf03753ce5839, 0x6f91b1a9086f8, 0x15db1ec438d41,
+    0x736bd7c7672ca, 0x314eb1a634deb, 0x80f927b62975a, 0xe145efbadcd1e,
+    0x345cebb5e6933, 0xb3416e1629f5a, 0xdcbb501482ca0, 0xe157e439e0151,
+    0x3faa7dffd2db0, 0xba52531696612, 0xb7f576b232465, 0x2fc628afb8cf5,
+    0x0000000000000, 0x54c5f8c07356f, 0x2b4d5672b30f1, 0xa06f613f7489e,
+    0xa466705820ced, 0xf38ad5e689fce, 0xc192c5a3517fc, 0xe3ab95135042d,
+    0x544b1b1632546, 0x1cef1460a3764, 0x1f023e338a767, 0x9ef8d9b7126b8,
+    0xf836618413321, 0x77eca80a6987d, 0x86f06a68d0f91, 0xaddec0008fdae,
+    0x0000000000000, 0x1afc71165a356, 0x72009919c3dae, 0x7d961cb1f341f,
+    0x39ba4b83d6897, 0x31e8b1d05c9a2, 0x857eba5d720bb, 0x2220c1bd0ce3b,
+    0x1b01f84cafbc6, 0xf27cd399038ee, 0xcfaccb73e786b, 0x52a7b159ebb38,
+    0xc4503f8bf9240, 0x194314c1e0ec1, 0xc48399f560e72, 0xe8f15bb0ad0b2,
+    0x0000000000000, 0xf9d6adf86cf5c, 0x003b6ec0a964f, 0x445bc5276581a,
+    0xaf174ecbf7e3f, 0xd3f2b5d66729d, 0x73fc2d31c5102, 0xb9800a771891a,
+    0x115cddc181798, 0x7ba849b73f353, 0x71afc9d7164c0, 0xfafa00dec9860,
+    0xfc16b0898eb41, 0x90d871581c0db, 0xec56bcdcb198b, 0x30796934dda0e,
+    0x0000000000000, 0xa6b4966903b89, 0x12b7f4f64ce56, 0x18e0fab106e4e,
+    0x03dc58b34188f, 0x4aecc04042151, 0xb3680f31baef4, 0x6b4c48718cd36,
+    0x378ad86aa1393, 0x0597d17ccc5f7, 0x1b2c61b16f6bf, 0xabb91b62f50b9,
+    0x5d058da8d4e82, 0x7190f402edd3f, 0x4e026389983f5, 0xd930977418893,
+    0x0000000000000, 0x9f4ebff86c3fb, 0x76bfe0f0d4fbc, 0x0acdf803e0c69,
+    0xb453db5dba0b2, 0xf76ca8629a85b, 0xc47cb2507280a, 0xc623d66fec7e4,
+    0x75fe68cbb4941, 0x6d93ca3778b0a, 0x6a5d25d817ed1, 0xba512fa5a5ddf,
+    0xf8b84197020a0, 0x2d5916373105d, 0x3c116f89ec033, 0xf211ca25fe19c,
+    0x0000000000000, 0x4a87b0151b151, 0x43eb40f821444, 0xe9506a8c802d6,
+    0xef54df32d5206, 0xd2b335a9b180d, 0x0056b8e64ddb3, 0x5c8fbbdb68f54,
+    0x9588ce3ac7e26, 0xbf3faae1e5748, 0x4e9a9b37eadd0, 0x17b3b21cecce9,
+    0x7005ef858fcfd, 0x58647036581f9, 0x48562d58e8e31, 0x5bd3b9d0504a8,
+    0x0000000000000, 0xefd27bbe4f95b, 0xcbb4480332a8a, 0xb2f0224cef1d9,
+    0xd08e3c52fcf51, 0x0263ceb368785, 0xe054b2f8c2cd6, 0x7fa6951f3f926,
+    0x708d627f2694e, 0x56562c3d00a7a, 0x94cbd473064bc, 0x6e542a5f31483,
+    0xcd16249d57c41, 0x16d8be1bd0ff9, 0x20f889f200f9f, 0x37805635d9256,
+    0x0000000000000, 0xb040513d26385, 0xf3ff375566080, 0x2f9f38fc38aa1,
+    0x3732f551f3408, 0x191f1fc8c8a43, 0xbd6de299ee671, 0x53fabb1d0dfe1,
+    0xa9deda381ddab, 0x8202417c27e14, 0x7481625af1003, 0xfeebf008535ff,
+    0x141e2029097ed, 0xdb92e9829c6a3, 0x4f55f3ebb57d4, 0x987f6b58dc9cf,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x622a63fa5d90d, 0x18caf35e5d712, 0x4ee9bc2d580fb,
+    0x937ade92603b2, 0x37d6527114052, 0x435985003a18e, 0x96b70bb2f5a44,
+    0xd5f56fe3c020f, 0xcdd07cf36dd5a, 0x8c7d70c9c5761, 0x4d32c7f19d5f2,
+    0xc1db9be81b6eb, 0x8e5b15b5c9f20, 0x3a1c687b5f323, 0xc96d5fb2f514b,
+    0x0000000000000, 0x8d92aca99c7d4, 0x9aba53d6591e5, 0x5aa75d89efe4f,
+    0xb6a7f7f5dfd6b, 0xe1c05c923471a, 0x54d6a95ed7d6c, 0x882d912950f7d,
+    0x64c1a13df6f31, 0x0288dab283421, 0xc887702f25c7a, 0xc1b1f967f5095,
+    0x92e1e9080edf2, 0x28393a4a816bf, 0x71fd0c18dddea, 0xc6fdc50405874,
+    0x0000000000000, 0x1d6acf3aa6efd, 0x4f1b1b50e170d, 0x5c9f3a99658d0,
+    0x3151876b632c9, 0xb59eb8334b1de, 0x9980c79ad7079, 0x1c5f7806f46b9,
+    0x02f2a54ccdb45, 0x4fbe41ee970ad, 0x2fa2d60270c41, 0x8259add8736dd,
+    0xa6e8dc8078907, 0xfcb012c78e16b, 0xbb1d9b0fab46d, 0x81aff52bc75bf,
+    0x0000000000000, 0x1b7387e55d6dd, 0xf9eca3e56ed3e, 0x5000c8437e689,
+    0x9040d3ee4a789, 0xcfc3232050229, 0x477ff1c886da3, 0x206a4cd0cdc38,
+    0x18f47586ae362, 0x8f16aa4610e52, 0x1198b6d233440, 0x1d6913e4b3168,
+    0xe5f2473143800, 0x1f0bc72dfe77b, 0xffdc1583cc0ae, 0xce65f3c3a1b96,
+    0x0000000000000, 0x10db119c2295a, 0x288dfe4cc67c4, 0x940ac73b487dd,
+    0x7441b009fd7a5, 0x4066944e5515c, 0xbd5cb6ec63f9f, 0x0844cf6bc11a9,
+    0xf6db9ebb1f191, 0xad4e677987fdc, 0xd2d0ca03e2f6c, 0x49c3341e835ad,
+    0xeac4c5c99d056, 0xd2412f43c0119, 0x8df25ed0db5ee, 0x2d474c7024c43,
+    0x0000000000000, 0x11a67dad9703d, 0x59c7726fa0dd0, 0x367db7ed400e5,
+    0x8b427fedfc2d2, 0xef3bef0a727ea, 0x7d38c46655138, 0x510e00a17c2ae,
+    0xb71b6517fa3e3, 0x745990b3ac9aa, 0xaf5748af01674, 0x7a47c30e5239b,
+    0x1a7dd2e0b3bef, 0x95a60dacc2c8c, 0xd1996e6f6adf0, 0x7c2490f4283b6,
+    0x0000000000000, 0xeedb427c0f52d, 0xa0660a01f234a, 0x7aa27012c5552,
+    0x7f921c0ceded6, 0x488dc779b9ed7, 0xf89bf6d2b4ebb, 0x61dd9069a33fe,
+    0xf8c282c695b00, 0x8e7f8a66d34e1, 0x36721eb2eb037, 0x9d2f7d576e7b2,
+    0x1bcf05363ba5d, 0xb8bf7a5ccc8b1, 0x466f0075e0770, 0xb13928dc565e0,
+    0x0000000000000, 0x1e055192fe412, 0xa704007db6c8f, 0xe3e38f2aa75a0,
+    0x2220fc8f207d5, 0xe8d1f80e3faab, 0xd51729e491314, 0x587618ff697a9,
+    0x758306aa882ec, 0xf624e7c4fcb94, 0x15b32123062a6, 0xf18e6b1757787,
+    0x11d24fd9a9ccd, 0xf4e1a96c68512, 0x565b5b1aade41, 0xd6ab8b3213ca1,
+    0x0000000000000, 0x4a5758174c7a3, 0x70b32e8366767, 0xbbee07412f750,
+    0x0f675383c79a4, 0x7233339b9c65d, 0xc0d60c0f225c8, 0x0ba2ef650d829,
+    0xbb71fac8a72bb, 0x64bdb3b11e439, 0x4d17bcb0f9b91, 0xeb31a72f05878,
+    0xa98a403654a7d, 0x037f2fa3847a8, 0x98b04f5d00b19, 0xf7b7818f76efe,
+    0x0000000000000, 0x55cfd4b1dde40, 0x96994810fb845, 0x2b85efa17bff1,
+    0xd6f410a2e837b, 0x9c70cf3196ae3, 0xa625291d3434d, 0xd91012508aa8c,
+    0x5351671f4f924, 0x30a6745244a4a, 0x24ff2a068cf70, 0xa5a6457cee8c5,
+    0x7392e3d9119e2, 0x75796b5bcb9b2, 0x3fb77ccf51c0d, 0x2cfa53d67b739,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x3ac5243ed86b5, 0x942a4c75e9fe7, 0x4fbdf876f9315,
+    0x85142795b0fc9, 0xfaa16adecac12, 0x0222656680409, 0xb1eb365b52a29,
+    0x9afb73836ce2c, 0xcba8ddf2a8539, 0xeb47e381cdd56, 0x64127f7370a51,
+    0xf762496f0c7ca, 0x418337009cc12, 0x4eed03a2dde89, 0x81a5b509b2ff3,
+    0x0000000000000, 0x75f9805e79dc4, 0xc673dad29e115, 0xcba74d3a2833b,
+    0x32b75a8973a1f, 0x367dd25fc32fd, 0x87c0f253b2deb, 0x39c8e56a18873,
+    0x35d1c0854627d, 0x7487c756db272, 0x50afd69c1c433, 0x3237bf4d779a6,
+    0x62c17696786d3, 0xeb9100a6cca37, 0xf826771ecce1d, 0x3f3be4ba86ff7,
+    0x0000000000000, 0x2bee2dfe95a21, 0xe6be55a2350de, 0xb7caa45ac8002,
+    0x125d27c2f65e5, 0xffb4ac1c50f40, 0x343baa028da54, 0x3c8e880ea04a3,
+    0xacf6649f2eb9d, 0x6ccbc48cceabd, 0xa1481c77df24e, 0x60153ef22766c,
+    0x8c595d3ed5248, 0x5edc3be8a5157, 0x65be5908e15b9, 0xbe763af19999e,
+    0x0000000000000, 0x284b06125c31c, 0x45659ca3c399f, 0x8383a5d83ed70,
+    0x245efb7e6ca7e, 0xa14620b2be987, 0x89e9279377092, 0x83e302b47de09,
+    0xacf4c38a8a9ec, 0xe5784dbfe90f2, 0x7bb47b569c7c7, 0x44512cf678c9c,
+    0x4d2c26471be97, 0xc8c7d85c50ad7, 0xb2cb798e8d764, 0xf61a385048c71,
+    0x0000000000000, 0xa0103195082b6, 0x3c87e22652712, 0x68e9a1f4b57d4,
+    0xa3d37a1c1d680, 0x33bb0ae4692af, 0x5d5c3ea1301aa, 0x7a479f09d4453,
+    0x2178be52c0095, 0x7b284951b3b93, 0x56bf787bd7a7a, 0x6592991c5f6c1,
+    0x8438afdfd83f2, 0x3c8a22252b944, 0x55b291e36462a, 0x44ee8b89247cc,
+    0x0000000000000, 0xcedfa4a2264eb, 0xbd4c4458f51c6, 0x0305fe90f312b,
+    0x8ed8871c0ac3f, 0xdf594e6b641f1, 0x5e76a495b970a, 0x5f94318a431cc,
+    0x8f6e06df7d7ea, 0x52ce04006da93, 0xc87cb0ff18713, 0x799cd737d13da,
+    0x6d5c3cfdac7e3, 0xdb837a7a961ae, 0x1419e9ff6a5d9, 0xd067df6becc55,
+    0x0000000000000, 0xafa325bc143e8, 0x57db758ae1a11, 0x1377ac0f160ac,
+    0xf92273ed1f61c, 0x932cd2b111965, 0x8384f0d059661, 0x46443e2ea8a06,
+    0x8285115ce7bb4, 0x0787ab81af3fe, 0x0df36f389a0fb, 0xf123a71aae1b5,
+    0x9f3f694d19405, 0x3d6c4895ce854, 0x7ace96b4e619f, 0x69b939293dcfe,
+    0x0000000000000, 0xae3ae24853199, 0xc547db810319b, 0xa2a19b226d97e,
+    0xf1c0619b125a3, 0x64a7b58c3b6d6, 0x69e56f73015d8, 0x8dc2bffe37f05,
+    0xb7f232680bedc, 0x1ca83c011e07a, 0x4b81f063a1f75, 0x15a8d8462649c,
+    0x0236b039f23b4, 0x9d184007415c4, 0x03693a4bf2f14, 0x9d079df801849,
+    0x0000000000000, 0xebe96963067c6, 0xc8ba847d5c89d, 0x9ab3140deaa5b,
+    0xc151e1baaf99b, 0x4a63dfd7170cd, 0x0100aa3378960, 0x1e53ec61f6294,
+    0x4103a6e51e8f4, 0x8348522df897f, 0x3ffba51502b39, 0xae6cf8e8ada66,
+    0x500ce59480a9b, 0x2c304cfbd706b, 0x199a2e72acf03, 0xcf8c044f9be5f,
+    0x0000000000000, 0x96c54a7cecdeb, 0x239959a5bbe62, 0x3d7317593a10d,
+    0xb5fb9c92ca12f, 0x8e388e1e6e84a, 0x1b31b2f0497ab, 0x7fdc480b336ff,
+    0xaaa09aa0bc0d2, 0x169dbb06f3db8, 0x8dd8deb547ebc, 0x3d33ba6e7ee7d,
+    0x8f9f1608ec0e9, 0x56f38db0b06a0, 0x671e9171cf4a8, 0x0151d159b5027,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0xe3a5229434e36, 0x3d490f3876f02, 0x74d6a771ccfdb,
+    0xd45f1302c2800, 0x24586e8453a9d, 0xb50d4d8def575, 0xc939393d2db32,
+    0x1c4bc539f42b1, 0xc046722d1010c, 0xb94faa23bb99f, 0x24b2d21be00d9,
+    0xcb27f501e02c4, 0xd598005c924ae, 0xf474763f4b775, 0x0f0b5f36f9bc3,
+    0x0000000000000, 0x55f3a1a50446d, 0x521482b690e8c, 0xaad08a6c326b4,
+    0x28a46eca65c4c, 0xef8836fac6e7b, 0xbbb2d64ead650, 0x7624e07e1c203,
+    0x9f1f757159ce1, 0x9fd48c2be710a, 0x623c8e9a5044b, 0x35553a6df2a28,
+    0x99998f34a1c7d, 0xcde859581a64c, 0x3699ad182fda6, 0x1148b57aae6b7,
+    0x0000000000000, 0x644f2db4f7215, 0x83aada0850d48, 0x53b469d8fd212,
+    0x181d940c2f16b, 0x26a69d9c5a208, 0xe9705f437c404, 0x2c1eb5285873d,
+    0x0e9e10c0bc8d0, 0x7b317e60d4365, 0xba2ebb135d850, 0x328b39bf7064a,
+    0x87979518aaefe, 0xadb368a43b054, 0x9081fb8551847, 0xf527a3f18a9b4,
+    0x0000000000000, 0xad43f6dc38924, 0x4a53582c13331, 0xf83293d6ed1a6,
+    0x08156dae561c3, 0x9f4fa0ae87db3, 0x11dfd5302ff7a, 0xd7d4a2fc370f4,
+    0x7345be3621884, 0x92babea8fab46, 0x5a6048c06c590, 0x1cd030666e28e,
+    0xc965b8f73c24f, 0x6187c1e73fd14, 0xcb8be7e0457d7, 0x1b655a5db7c11,
+    0x0000000000000, 0x2239beb126b72, 0x7bae5a342545c, 0xe6545e0ab6241,
+    0xffdb51b5dbdef, 0x2f36dabf7a3b8, 0x1ab25494c6a0b, 0x9e9a910180c74,
+    0xd1822e5e0a60d, 0x343b882c100d9, 0x16141bd170043, 0x3193e60f55146,
+    0xc79b511a5afae, 0xc720e6f9cae39, 0x4145812dc0e09, 0xab8428385de98,
+    0x0000000000000, 0x840de05e7dd77, 0x1c50d6f31c146, 0x4d412837590d6,
+    0x7d0f3f05aff9f, 0xaccff1b683930, 0x09f1d28856308, 0x54fe2c24e5f4e,
+    0xae792acddc802, 0x139d8a1fdb970, 0x9a397ede900a2, 0x6e9362229b35c,
+    0x0616970388704, 0xb2518230ec2c8, 0xf4b39143a2961, 0x63b9266833c94,
+    0x0000000000000, 0x2862d6caacd0d, 0xd97c2d093b815, 0x9d4ce0f0e5ea6,
+    0x216756731470d, 0x9674735f7c0c5, 0xf9771c60656fe, 0x09924cde33f1b,
+    0x6be0f49763d76, 0x5520d204d66e2, 0xc546acab030d9, 0x4c442222a42be,
+    0x6a4c675afde1a, 0x5988f5495d47e, 0x9e0a0a3cbf501, 0x7ecff5a20bea7,
+    0x0000000000000, 0xbce6fa639c67a, 0xe82d6fbdb84a7, 0x346cf9c6f6af2,
+    0xd3e4323b09f64, 0x6408733fae356, 0xa8da17e44ed25, 0x04b9098b5d8e0,
+    0xdff0f1717868a, 0x2ab9a2c9178f0, 0x8d38e30eebfee, 0xd60125a9d6d43,
+    0xc4811b881c0a1, 0xe2598638f4813, 0x934cb88853307, 0x6f42fc1e71282,
+    0x0000000000000, 0x087602ba53021, 0x53468edb41ffb, 0xfc3a14ec1baae,
+    0xc256f1c5c736f, 0xf212e9502a912, 0x8180ff8f83d4c, 0xfcec85829ca51,
+    0x4437867cae1bc, 0x9108523c465fe, 0x02f14b10c9b0b, 0xc87e55445ae72,
+    0xf25b4802031df, 0xb4c2be56d3827, 0xe1aee8c324d71, 0x50de703404058,
+    0x0000000000000, 0x679ec9b598271, 0x9e6ae0e9fad49, 0x102de7d119028,
+    0xc46af757ebac2, 0x3e48cae6ce586, 0xb3ab569602e39, 0xfb681e0719013,
+    0x70e8bfe19f269, 0xfe64a4f3934b8, 0x476a607ffef36, 0x7a58aac677288,
+    0x23090ce18e150, 0x351c78f2ea2af, 0x2f8670c7f18e1, 0x657abebd479e2,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0x019f2fc6beb7f, 0x8fa162e0dbf60, 0x13add3fcde048,
+    0xd810c86eab937, 0xbf2951d39a44f, 0xe9f8e55c90ab0, 0x438e5ba5338b3,
+    0xeb05013cb5aab, 0x8c6d112af95d8, 0x14d2397992e28, 0x4becfbe15d48a,
+    0x46f3d16bd86a6, 0x08f8779866d74, 0xfeefe2d03f1ea, 0x70a5e7677bb1e,
+    0x0000000000000, 0x666646b70deb9, 0x3f486c08a442e, 0x1219fe4aa9d7d,
+    0x8e6e6eb51bdd5, 0x398498d969528, 0xc249c5855ba42, 0xd1ff4b67e28df,
+    0x9afca55bd420f, 0xaaf85c27f32ef, 0xffe34f93a7642, 0x19a591f3b789e,
+    0x07824883bff93, 0xf02cdb0243e9b, 0x991e7a25985d6, 0x40a8f63db615b,
+    0x0000000000000, 0x90a5717d2e533, 0xd94f9cd2b15f8, 0x5351a22977d5c,
+    0x9bc2e3a0e4219, 0xc4d3ab735a8c9, 0x5713f3bef09a2, 0x9c3431625c90b,
+    0x9c3c71fd8695f, 0x05471ad6e013c, 0xffca9bec4c064, 0x31d92c0447d51,
+    0xcb712f336f74d, 0x849513ca23b88, 0x9e8ac76f6961d, 0xec277d09f138d,
+    0x0000000000000, 0x6810fd38f5274, 0xf2a2350bb6a89, 0x1b5d9a700b538,
+    0x7e391c4b3dc48, 0x49f301c079cba, 0xfeabc99f1b370, 0x3e72d7fb9aa32,
+    0x00cafcc6e5ed1, 0xa7f8ca9a40fc0, 0xbb1bfd70a3104, 0x82cbebe3611cc,
+    0xdcbebb2da1061, 0xf37ba7a274462, 0x3c0a7cf29411c, 0x0cc9ebfcb779e,
+    0x0000000000000, 0x233bb33bad791, 0x5b606cc5727bb, 0x468abff17eb5e,
+    0x736ed77fe5eda, 0x1622ab80acb7c, 0xa630df8e8f305, 0x95577f5afd06b,
+    0x728edc89ca3d5, 0x3d6a2d18025c4, 0x9dfa588d12058, 0xe0d72d5260e03,
+    0x1d3208b8dba59, 0x304df099dead3, 0xf28aef7f70591, 0xdeb400389e54f,
+    0x0000000000000, 0x9b6b88efd9526, 0x03f198a74b132, 0x4cb8e973ec8f1,
+    0x5e60972cd0e3d, 0x3eacce22e2961, 0x132fdba159b0e, 0x50ec99edcd297,
+    0x76471854e21b8, 0x0712f9d940540, 0x78cd5edab5c56, 0x64b92dae6705e,
+    0x7a96bd690ae41, 0x1cc7a4b7eb74c, 0xf12dfb72ab6c8, 0x5729f09edc9a4,
+    0x0000000000000, 0xd5745dad71c05, 0x1a6f73b79d3ab, 0x5983691ce383b,
+    0x1aaa05f70f41c, 0x13e8f870156a2, 0x47d480011a271, 0x4673ba9187e9d,
+    0x201f0ff872ac7, 0x1852985b69894, 0x0d3f2e4546256, 0x714299535c0c8,
+    0x806c7b2a080a3, 0xca6cdbc442562, 0xc6074a319e347, 0x25e7aee36e897,
+    0x0000000000000, 0x4ca300788fe6e, 0x1c95046a9cf73, 0x876ffadb91242,
+    0xdb07669f426a5, 0xe327c5b8a45e2, 0x306b2714065ad, 0xf6e6b8bdec4d3,
+    0x3e23036d8ee45, 0x05f8791eaafad, 0x020a440767f07, 0x42851d7b378ed,
+    0x0ca362b3bd337, 0x4748a5394775f, 0x1f9b1ed1e6994, 0x45e07297d6ad4,
+    0x0000000000000, 0xed4a6a21a98ac, 0x5ed71e298efd1, 0xcdc55b584d748,
+    0x5914839830a47, 0x9c4d7ab891cb1, 0xe40f193750a8e, 0xb430a041ad26e,
+    0x2c13f7c8bee8b, 0xbb53716d434e9, 0x28961cfae7935, 0xd4d097992754a,
+    0x982059559ab0e, 0xed3cf82dd559e, 0x650cc248aadf5, 0x425a29a830311,
+    0x0000000000000, 0xe10eeff58916d, 0x274d622bb2409, 0x081729f9b0ef9,
+    0x29045b98cf434, 0xabade94298ebc, 0x7dae8de8fca28, 0xbd9ba1bb4421a,
+    0x707a1d51a1e5f, 0x18f4a6dc386ca, 0x08fbb1397fef5, 0x4aed7a83b4e32,
+    0x33afbdb1f2f26, 0xe2b844d12d976, 0xb21d3f0c15475, 0xf8e2ef6b04cbf,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0xda52e803a67cf, 0xc383b3b59eae1, 0x2c7a08078a38c,
+    0x9d9c576932524, 0x93fbd0f434cbe, 0xf89ae5b29b4be, 0xeca25724224eb,
+    0x22b011bf68532, 0x3e7af2a15204c, 0x17242e0a3c7a6, 0xf18159bf7a046,
+    0xec00a2413b16a, 0x6440bad77dbef, 0xf5b40184e8fdc, 0x24b64c8d00967,
+    0x0000000000000, 0x7d398c1a5fc48, 0xe81b2f1927508, 0x5b7d204c0d5bb,
+    0x409f4c3b8bddc, 0xa56f07d42e9ba, 0x675e6e437a2f7, 0xfdadb5bd25cd2,
+    0x0cf529ed8e280, 0xea227301c52a3, 0xdc3fdd5b157e4, 0x40ee788a9f8fe,
+    0x432b8091411f5, 0x8487e41e20cf4, 0x52c6a1846c424, 0x0eb0d5db894cb,
+    0x0000000000000, 0x42b185c01901e, 0x0d888be6e14de, 0xf736da42c9fe2,
+    0xd467dc9295086, 0x9b0d479c3a8e7, 0x8042ce6715f26, 0xcff4bcef311d4,
+    0xb8a477a52b6ff, 0xf43d47381ac52, 0xda0bd73515671, 0xf2f2bd5f24129,
+    0x0708bd751bb2e, 0xf640b42a264ef, 0x8e9a1c376d504, 0x03af1e45f0ea6,
+    0x0000000000000, 0x4eda6cb2700b0, 0xfb612ce4b12e8, 0x29ab3d1c07e1e,
+    0xbdef23e6cf0fa, 0xa6557ef7ff666, 0x2d9db7eedb4d8, 0x1581c94d78a8f,
+    0xcd2f63b6e8238, 0x6c601a9dfd007, 0xd58ddac530e59, 0x60ac49bfcaa9d,
+    0xb5e3941dc85af, 0x84d283e27d82a, 0x467b26b422be2, 0x7dafbd2b1ef61,
+    0x0000000000000, 0x4eeec867cdaca, 0x1378248f53213, 0x3fa1ecafc23f7,
+    0x729684c1e0fbe, 0x37d9ea018a779, 0x3c2945ae2f3f9, 0x18e9d246c4a90,
+    0x7c291c55c9cf5, 0x5f55ceed59de5, 0x307e02f34daf6, 0xb7e2740c3f9ec,
+    0xafdeb21e50791, 0x7faa255f8379d, 0x2b7e7120a1441, 0xf15eb04457872,
+    0x0000000000000, 0xdcb7e930a19ae, 0x330dbca43092c, 0x939da95c4451f,
+    0xc3a23011daa3a, 0x3d73d7317c593, 0xa2b238b234321, 0x658eb0072ed20,
+    0xf4796ab42ab24, 0x7ea2454a46c3a, 0x9d51638590cb0, 0xca89fe7b157e1,
+    0x2ff3c0f7e8133, 0xf326122195389, 0x43b29f441bbdd, 0x052e64bd29835,
+    0x0000000000000, 0x10a288471dcc7, 0x9ef5e40c52b24, 0xcde8515da8e1d,
+    0x8c4ef40ca0da8, 0xe3521c4e7fa6b, 0x71be571ff8a71, 0x0b668627f8496,
+    0xc0989f93937b3, 0x332238cd1e9ee, 0x66e00e6336185, 0x28af65605f5f2,
+    0xfffd014a7da1c, 0x354de776d9e35, 0xacb66ff909de1, 0x7d5237691f989,
+    0x0000000000000, 0x3198ed17517e0, 0xe9d869889952b, 0x114f3cbf372d6,
+    0x34dda12c0850f, 0x2ddceb7ff7a03, 0x0861ce0cd3f7c, 0x5739e7236aa0c,
+    0xbca7b47aa5dbf, 0x432307b056cb3, 0x318059eb6cadb, 0x702b2a8d3e8fa,
+    0x4ca47be94b99f, 0xae826460a4ea4, 0xa8512d8d6c166, 0x30e1d09dfcc60,
+    0x0000000000000, 0x4e8756bb36f68, 0xc05f4131f1126, 0x9bd279caf9bb0,
+    0x2c5e51990ccbe, 0x83bb77f91f793, 0x1aa1485c040c1, 0x0100ad84a4ec4,
+    0x6f0a6b7620e79, 0xe206a895c054f, 0xc9b86ac1a419b, 0xc82ac3eae4b36,
+    0xf9a58a49892a5, 0xcb111901e6fe8, 0x9b870cb470ec5, 0x094eb7c0254a7,
+    0x0000000000000, 0x27df915ed36bb, 0x503fd03ae1dfb, 0xd6515521c9ac0,
+    0x494c2f0adaf8f, 0x6bb0e241189bf, 0x671589a80a882, 0xea2c0f771dba0,
+    0xf58dd4ea00729, 0x9bba8d39e6ce4, 0x35d95055331a3, 0xee4f655e7bee2,
+    0xf7a3810b3ca4d, 0xe877a82aef030, 0x5aeefcf3c4117, 0xcb50dee52dc9f,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000001,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0xe419064732d33, 0x4265bd7179d88, 0x4278657d6cee4,
+    0x61ebad9ee2c24, 0x9d0cb02edeaaf, 0x8aee214bdfd9d, 0x68fd067d90bd0,
+    0x76fe9e4b410aa, 0xa7d2d9a059926, 0xcb4efed87293a, 0xb19d4b3a3cd6e,
+    0xca6564d8e6179, 0x7888fbf8e7c4c, 0x6277d568073e6, 0x2f38f2e21e06e,
+    0x0000000000000, 0x0fb9f1fdd6e2b, 0x32014b97128c5, 0x14abb0af63319,
+    0xdd46aced3ddaa, 0xe65f48843f24d, 0x42b8664093980, 0xced5b29ec51e2,
+    0x2e2e46e8257e7, 0xc79efacf40be5, 0x66faab5f9956f, 0x213cc78b22a16,
+    0x6022a9ab64697, 0x17fdcaaea05fc, 0xc441eb99b0ec9, 0x735a7397f82b1,
+    0x0000000000000, 0xb458dd169ab15, 0xfd3dafdfe0b08, 0x38fa8a779e8d6,
+    0x0bd3e3fde5fe2, 0x13cfc6421060e, 0x02e1044a832fb, 0xf8d55e8022fe8,
+    0x285dece1c90ea, 0xc6b27e7d65795, 0x5f8536336b00a, 0x4d2e561a2deb9,
+    0xf4a4161b3f509, 0x74f8c5d82dcbe, 0xf7132639af075, 0xb498cb701245d,
+    0x0000000000000, 0xb79def3f55fa5, 0xb1956b3fd6699, 0x077c4b865c08f,
+    0x20569fe14f9f4, 0x1b869707d28a2, 0x964f7f3d5a20e, 0x13958382e1319,
+    0x4f07e02e70a0d, 0xb0225ed7bf892, 0x16a4144c4eb1b, 0x78863f5f4f87e,
+    0x68b84842b4904, 0x44f290d5ff2c9, 0x868ae88ae94e2, 0x19af4abd55b75,
+    0x0000000000000, 0x1fd9b88ebfb1b, 0x91416a87bbb8b, 0xe3d911dccc263,
+    0x88d818d1a2095, 0x9d06dbe5ac925, 0x60fe0ef2f657b, 0x5ec06b8982cf2,
+    0x7d9e22652fd2e, 0x1efb85a65a6de, 0xcda120090230f, 0x74bfe374cf59c,
+    0x7973978c0b279, 0x5aec755b766a4, 0xb3298a0f8c50e, 0xa372dfd6347dd,
+    0x0000000000000, 0xb8b17a8c1d98e, 0x1dd4344038f86, 0x862d70a88369b,
+    0x2f0bdc9b4968b, 0xed8ede7d63e3a, 0x6a731404e6179, 0xb96e5716a29a0,
+    0x325ca4b7fb066, 0x492a3c07ac8c9, 0x7395b68e4269b, 0x8a76ad03a6837,
+    0x0241f6b5e8705, 0x590ef7d16e229, 0x9d369746943e1, 0x2c627c78bc1b1,
+    0x0000000000000, 0xe6b37f6beb8b7, 0x566c88826c840, 0xeb9bc04f1f48f,
+    0xe3de0b8b77328, 0x0ae78dcb7db9e, 0x7987f09a892ea, 0x054ac8514b452,
+    0x1305e36daaa95, 0x1ea2b1037ed95, 0xa5a9bc4838da1, 0x7c975ec18ec3e,
+    0xaf27ffdb2ab49, 0xcc51a0ef429aa, 0xf59e53c3c9d6b, 0x0dae46d4cfb92,
+    0x0000000000000, 0xdbc72340b6c86, 0xf07a8a4b77456, 0x7c1ff1db82afb,
+    0x7fe9e8edc6520, 0x58c5eac50cb8a, 0x360dcf427f283, 0x89625914318d4,
+    0xfeebe9d3d04df, 0x3f01761686fa5, 0x5ae3312ae458e, 0x5f24c3c591925,
+    0xf2cd13ddc2a29, 0x424e194615d1c, 0xf77c64114e401, 0xb2bc9ef7ff5ae,
+    0x0000000000000, 0x7c19d37bb70ed, 0x7671e1b2fca59, 0xc00170f280325,
+    0x017cf0272ff76, 0x0c8d4b8e00e35, 0x85756dd9ffcaf, 0x54e33b1ef4978,
+    0x0e3be0fcd0755, 0xc0d6dda7bae4d, 0xb49ed54b45958, 0x97de19b121029,
+    0x10a4838ccf7df, 0xb4e61ac33cdb1, 0xc437d42394c74, 0x80f708dc29e25,
+    0x0000000000000, 0xf6867a99418dc, 0x200797dc52a03, 0x2c109d3c57113,
+    0xeda0f65dc99bc, 0xee7889d542b9d, 0xf815005c6261b, 0xdac1a2bad0516,
+    0x5f74f74e60357, 0xeeddbcb7aaa60, 0x5e7f41de3319c, 0x79b2bc065b513,
+    0x5fec533309509, 0xc8da4c8a44d64, 0x3061b2e7afe81, 0x8c837f425d985,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000001, 0x0000000000001, 0x0000000000000,
+    0x0000000000001, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000001, 0x0000000000000,
+    0x0000000000000, 0xa4a09f22c0fb3, 0x7843bbe8d7f70, 0x3be9373c87e38,
+    0x9b50b03dc034f, 0x4be5b255764e3, 0x574816b1af47b, 0x1422b5bd92ec0,
+    0xa7ff33f158714, 0xf857f5dfa2798, 0x426830ade368f, 0xbff742429ace5,
+    0xa07c2b0d72770, 0x565dbd86c8fde, 0xe94d4d0a7ce35, 0xd6ead710033fe,
+    0x0000000000000, 0xbb19cb6bc1256, 0x4f9ee9b4c465d, 0xe0a9a9c432243,
+    0xff04ea634ab0a, 0xc5c7217d51148, 0x8b4e2a829664e, 0x4272195fb2261,
+    0x12737b93b28b8, 0x66fc7318c499e, 0x6e87f07146081, 0x452bccc225505,
+    0xae241a1087e91, 0x9ba0a81bd7d56, 0x19e6ce57eb7de, 0x760683f4a3ea9,
+    0x0000000000000, 0x77d8b51c8ded9, 0x303b1652fa39c, 0x66e79167ec825,
+    0x7b191db6e6308, 0xfbfbeebf825f2, 0x70a4667025455, 0xbf050014af98f,
+    0xa408dc4f02791, 0xc74ccd60fb644, 0xaa433c74401b3, 0x06920873f73d4,
+    0xa8b01ca462075, 0x38f02f1e8b00c, 0xacd153228ad55, 0xde505acbf9224,
+    0x0000000000000, 0x574809f35ca45, 0xae7c4c4a55ae2, 0xf149dda6eb946,
+    0xa9de7ee04399a, 0x0e55e87d3f28f, 0x9211c4886648b, 0xf219900e93399,
+    0x9c78d219fcf52, 0x2d0e5b0682a08, 0x4810a325f661e, 0xea132eca9199c,
+    0xe1b3b589fcd31, 0x1106dde9360ee, 0x4284333ed9a08, 0x4edd55b323146,
+    0x0000000000000, 0xbef1168ba7eb2, 0x263ccdcb67c15, 0x3bbebd8082ccc,
+    0xe6da7bdea8dde, 0x9201f0282083b, 0x80d6a11b49a18, 0xdbfd9739da270,
+    0x8fbf0f03e3758, 0xecae76ffbc819, 0xb8177fd390b72, 0x3fd29d9cc5264,
+    0xd62e899105609, 0x8dff7e84cdc0b, 0xf31fa34a6460c, 0xf2890238914db,
+    0x0000000000000, 0x2cdae11770b52, 0xa17fd06da8ac5, 0x7bb5beb6f914a,
+    0x54c55ae492d45, 0xe59645b23eb86, 0x6ad462f79ecf9, 0x0a9143b3c94e5,
+    0xd6cdb0c0bb10f, 0xc886de2400ec5, 0x18ec07e44a93c, 0xdc7a6f2a26fc6,
+    0xf42611bf1ebca, 0x0bfc1e76632c0, 0x5279eb36e18ca, 0xa3b32f4c2ab85,
+    0x0000000000000, 0xff68ed4f42bd1, 0xc10d8d1d1e927, 0x95f2fbad7d42e,
+    0xf4e939e666b7b, 0xd5145a37c3fbc, 0x4089a0903d9ce, 0xcef7c7bec37bc,
+    0x7428d517b4d78, 0x0668532267e33, 0x252a1abf977de, 0x6d4f805351a6b,
+    0x3007a5a145edf, 0x6b6d89c6e8f5d, 0x06e4ac4e7bc7f, 0xd1674a58c0429,
+    0x0000000000000, 0x3d326b225de9d, 0xe5bfc6232685a, 0x17ec747252cb7,
+    0x90c925a51f573, 0xd63325467d8ab, 0xae91fed85b4f2, 0x8b5f46ca83880,
+    0xd37e06b1f9904, 0x990a506968db3, 0x7da04f6a39098, 0x899f44912c521,
+    0x52943b4866a62, 0x593c75429a702, 0xc872b84439ea3, 0xb7277a3384096,
+    0x0000000000000, 0x37f1445631a8c, 0x3162cd048bbb8, 0x6a6c36c193e46,
+    0xf916220292c15, 0x991120d2f4387, 0x6a45807532794, 0xb973d82cc2ac8,
+    0xf8786ba69f3ae, 0xe909832c7f5f8, 0x15c8fee2284e3, 0x43edf1f9956f9,
+    0x99633da3ff610, 0xe53704e0cc873, 0xa64ef890825e9, 0xef959c903b70a,
+    0x0000000000000, 0x12cb14a3c371d, 0xb11c2cffebb23, 0xed24afe4367ff,
+    0x2d380fc7f5071, 0x660c43785e0cb, 0x85e64b8afcfaa, 0xd27f76399e42e,
+    0xb508624d39698, 0xc385b8aae5ec1, 0x766487013d183, 0x93abe4d1ba43f,
+    0x2656fecc42038, 0xd9e21753f4e01, 0x500092b279c21, 0x9207cda492ed4,
+    0x0000000000000, 0x0000000000001, 0x0000000000000, 0x0000000000001,
+    0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000001,
+    0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000,
+    0x0000000000000, 0x0000000000000, 0x0000000000001, 0x0000000000000
+};
@@ -1179,9 +1179,19 @@ __owur static int ecp_nistz256_get_affine(const EC_GROUP *group,
         return 0;
     }
 
-    ecp_nistz256_mod_inverse(z_inv3, point_z);
-    ecp_nistz256_sqr_mont(z_inv2, z_inv3);
-    ecp_nistz256_mul_mont(x_aff, z_inv2, point_x);
+    if (point->Z_is_one) {
+        /* already affine, e.g. the result of ecp_nistz256_points_mul_multi */
+        memcpy(x_aff, point_x, sizeof(x_aff));
+        memcpy(y_aff, point_y, sizeof(y_aff));
+    } else {
+        ecp_nistz256_mod_inverse(z_inv3, point_z);
+        ecp_nistz256_sqr_mont(z_inv2, z_inv3);
+        ecp_nistz256_mul_mont(x_aff, z_inv2, point_x);
+        if (y != NULL) {
+            ecp_nistz256_mul_mont(z_inv3, z_inv3, z_inv2);
+            ecp_nistz256_mul_mont(y_aff, z_inv3, point_y);
+        }
+    }
 
     if (x != NULL) {
         ecp_nistz256_from_mont(x_ret, x_aff);
@@ -1190,8 +1200,6 @@ __owur static int ecp_nistz256_get_affine(const EC_GROUP *group,
     }
 
     if (y != NULL) {
-        ecp_nistz256_mul_mont(z_inv3, z_inv3, z_inv2);
-        ecp_nistz256_mul_mont(y_aff, z_inv3, point_y);
         ecp_nistz256_from_mont(y_ret, y_aff);
         if (!bn_set_words(y, y_ret, P256_LIMBS))
             return 0;
@@ -1445,6 +1453,634 @@ err:
 # define ecp_nistz256_inv_mod_ord NULL
 #endif
 
+#if defined(__x86_64) || defined(__x86_64__) || \
+    defined(_M_AMD64) || defined(_M_X64)
+/*
+ * Multi-buffer scalar multiplication for processors with AVX-512 IFMA.
+ *
+ * Eight independent computations are carried out at once, one per 64-bit
+ * lane, by the subroutines in ecp_nistz256-ifma-x86_64.pl. Field elements
+ * are kept in radix 2^52, limb j of lane k being at index 8*j+k, in the
+ * Montgomery domain with R = 2^260, and are only reduced to [0, 2*p).
+ * Point formulas are the same as in the reference implementation above.
+ */
+# define P256_MULTI_LANES       8
+# define P256_FE52_MASK         0xfffffffffffff
+
+typedef BN_ULONG P256_FE52X8[5 * P256_MULTI_LANES];
+
+typedef struct {
+    P256_FE52X8 X;
+    P256_FE52X8 Y;
+    P256_FE52X8 Z;
+} P256_POINT_X8;
+
+typedef struct {
+    P256_FE52X8 X;
+    P256_FE52X8 Y;
+} P256_POINT_AFFINE_X8;
+
+int ecp_nistz256_ifma_eligible(void);
+void ecp_nistz256_ifma_mul_mont(P256_FE52X8 res, const P256_FE52X8 a,
+                                const P256_FE52X8 b);
+void ecp_nistz256_ifma_sqr_mont(P256_FE52X8 res, const P256_FE52X8 a);
+void ecp_nistz256_ifma_add(P256_FE52X8 res, const P256_FE52X8 a,
+                           const P256_FE52X8 b);
+void ecp_nistz256_ifma_sub(P256_FE52X8 res, const P256_FE52X8 a,
+                           const P256_FE52X8 b);
+void ecp_nistz256_ifma_div_by_2(P256_FE52X8 res, const P256_FE52X8 a);
+/* Constant time access to a row of the table for the default generator */
+void ecp_nistz256_ifma_gather_w7(P256_POINT_AFFINE_X8 *val,
+                                 const P256_POINT_AFFINE *in_t,
+                                 const BN_ULONG idx[P256_MULTI_LANES]);
+
+# define X8(x)  x, x, x, x, x, x, x, x
+
+/* The modulus */
+static const P256_FE52X8 P_X8 = {
+    X8(0xfffffffffffff), X8(0xfffffffffff), X8(0), X8(0x1000000000),
+    X8(0xffffffff0000)
+};
+
+/* One converted into the Montgomery domain, 2^260 mod P */
+static const P256_FE52X8 ONE_X8 = {
+    X8(0x10), X8(0xf000000000000), X8(0xfffffffffffff),
+    X8(0xffeffffffffff), X8(0xfffff)
+};
+
+/* Multiplier converting from the 2^256 Montgomery domain, 2^264 mod P */
+static const P256_FE52X8 TO_X8 = {
+    X8(0x100), X8(0), X8(0xfffffffffffff), X8(0xfefffffffffff),
+    X8(0xffffff)
+};
+
+/* Multiplier converting to the 2^256 Montgomery domain, 2^256 mod P */
+static const P256_FE52X8 FROM_X8 = {
+    X8(0x1), X8(0xff00000000000), X8(0xfffffffffffff), X8(0xfffefffffffff),
+    X8(0xffff)
+};
+
+static void fe52x8_set_lane(P256_FE52X8 r, size_t k,
+                            const BN_ULONG in[P256_LIMBS])
+{
+    r[8 * 0 + k] = in[0] & P256_FE52_MASK;
+    r[8 * 1 + k] = ((in[0] >> 52) | (in[1] << 12)) & P256_FE52_MASK;
+    r[8 * 2 + k] = ((in[1] >> 40) | (in[2] << 24)) & P256_FE52_MASK;
+    r[8 * 3 + k] = ((in[2] >> 28) | (in[3] << 36)) & P256_FE52_MASK;
+    r[8 * 4 + k] = in[3] >> 16;
+}
+
+/* Extracts lane |k| of |a| fully reduced, in constant time */
+static void fe52x8_get_lane(BN_ULONG out[P256_LIMBS], const P256_FE52X8 a,
+                            size_t k)
+{
+    BN_ULONG v[5], t[5], borrow = 0, mask;
+    int j;
+
+    for (j = 0; j < 5; j++) {
+        v[j] = a[8 * j + k];
+        t[j] = v[j] - P_X8[8 * j] - borrow;
+        borrow = t[j] >> (BN_BITS2 - 1);
+        t[j] &= P256_FE52_MASK;
+    }
+    /* keep |v| if it is less than P */
+    mask = 0 - borrow;
+    for (j = 0; j < 5; j++)
+        v[j] = (v[j] & mask) | (t[j] & ~mask);
+
+    out[0] = v[0] | (v[1] << 52);
+    out[1] = (v[1] >> 12) | (v[2] << 40);
+    out[2] = (v[2] >> 24) | (v[3] << 28);
+    out[3] = (v[3] >> 36) | (v[4] << 16);
+}
+
+/* Returns the mask of lanes in which |a| is zero modulo P */
+static unsigned int fe52x8_is_zero(const P256_FE52X8 a)
+{
+    unsigned int ret = 0;
+    BN_ULONG z, p;
+    size_t j, k;
+
+    for (k = 0; k < P256_MULTI_LANES; k++) {
+        z = p = 0;
+        for (j = 0; j < 5; j++) {
+            z |= a[8 * j + k];
+            p |= a[8 * j + k] ^ P_X8[8 * j + k];
+        }
+        ret |= (unsigned int)(is_zero(z) | is_zero(p)) << k;
+    }
+
+    return ret;
+}
+
+static void fe52x8_copy_conditional(P256_FE52X8 dst, const P256_FE52X8 src,
+                                    unsigned int lanes)
+{
+    BN_ULONG mask;
+    size_t j, k;
+
+    for (k = 0; k < P256_MULTI_LANES; k++) {
+        mask = 0 - (BN_ULONG)((lanes >> k) & 1);
+        for (j = 0; j < 5; j++)
+            dst[8 * j + k] = (src[8 * j + k] & mask)
+                             ^ (dst[8 * j + k] & ~mask);
+    }
+}
+
+/* Point double: r = 2*a */
+static void ecp_nistz256_point_double_x8(P256_POINT_X8 *r,
+                                         const P256_POINT_X8 *a)
+{
+    P256_FE52X8 S, M, Zsqr, tmp0;
+
+    ecp_nistz256_ifma_add(S, a->Y, a->Y);
+
+    ecp_nistz256_ifma_sqr_mont(Zsqr, a->Z);
+
+    ecp_nistz256_ifma_sqr_mont(S, S);
+
+    ecp_nistz256_ifma_mul_mont(r->Z, a->Z, a->Y);
+    ecp_nistz256_ifma_add(r->Z, r->Z, r->Z);
+
+    ecp_nistz256_ifma_add(M, a->X, Zsqr);
+    ecp_nistz256_ifma_sub(Zsqr, a->X, Zsqr);
+
+    ecp_nistz256_ifma_sqr_mont(r->Y, S);
+    ecp_nistz256_ifma_div_by_2(r->Y, r->Y);
+
+    ecp_nistz256_ifma_mul_mont(M, M, Zsqr);
+    ecp_nistz256_ifma_add(tmp0, M, M);
+    ecp_nistz256_ifma_add(M, tmp0, M);
+
+    ecp_nistz256_ifma_mul_mont(S, S, a->X);
+    ecp_nistz256_ifma_add(tmp0, S, S);
+
+    ecp_nistz256_ifma_sqr_mont(r->X, M);
+
+    ecp_nistz256_ifma_sub(r->X, r->X, tmp0);
+    ecp_nistz256_ifma_sub(S, S, r->X);
+
+    ecp_nistz256_ifma_mul_mont(S, S, M);
+    ecp_nistz256_ifma_sub(r->Y, S, r->Y);
+}
+
+/*
+ * Point addition: r = a+b. Lanes in which a and b are equal are doubled,
+ * which is not constant-time, so this is only used with public inputs.
+ */
+static void ecp_nistz256_point_add_x8(P256_POINT_X8 *r,
+                                      const P256_POINT_X8 *a,
+                                      const P256_POINT_X8 *b)
+{
+    P256_FE52X8 U2, S2, U1, S1, Z1sqr, Z2sqr, H, R, Hsqr, Rsqr, Hcub;
+    P256_POINT_X8 res;
+    unsigned int in1infty, in2infty, equal;
+
+    in1infty = fe52x8_is_zero(a->Z);
+    in2infty = fe52x8_is_zero(b->Z);
+
+    ecp_nistz256_ifma_sqr_mont(Z2sqr, b->Z);        /* Z2^2 */
+    ecp_nistz256_ifma_sqr_mont(Z1sqr, a->Z);        /* Z1^2 */
+
+    ecp_nistz256_ifma_mul_mont(S1, Z2sqr, b->Z);    /* S1 = Z2^3 */
+    ecp_nistz256_ifma_mul_mont(S2, Z1sqr, a->Z);    /* S2 = Z1^3 */
+
+    ecp_nistz256_ifma_mul_mont(S1, S1, a->Y);       /* S1 = Y1*Z2^3 */
+    ecp_nistz256_ifma_mul_mont(S2, S2, b->Y);       /* S2 = Y2*Z1^3 */
+    ecp_nistz256_ifma_sub(R, S2, S1);               /* R = S2 - S1 */
+
+    ecp_nistz256_ifma_mul_mont(U1, a->X, Z2sqr);    /* U1 = X1*Z2^2 */
+    ecp_nistz256_ifma_mul_mont(U2, b->X, Z1sqr);    /* U2 = X2*Z1^2 */
+    ecp_nistz256_ifma_sub(H, U2, U1);               /* H = U2 - U1 */
+
+    equal = fe52x8_is_zero(H) & fe52x8_is_zero(R) & ~in1infty & ~in2infty;
+
+    ecp_nistz256_ifma_sqr_mont(Rsqr, R);            /* R^2 */
+    ecp_nistz256_ifma_mul_mont(res.Z, H, a->Z);     /* Z3 = H*Z1*Z2 */
+    ecp_nistz256_ifma_sqr_mont(Hsqr, H);            /* H^2 */
+    ecp_nistz256_ifma_mul_mont(res.Z, res.Z, b->Z); /* Z3 = H*Z1*Z2 */
+    ecp_nistz256_ifma_mul_mont(Hcub, Hsqr, H);      /* H^3 */
+
+    ecp_nistz256_ifma_mul_mont(U2, U1, Hsqr);       /* U1*H^2 */
+    ecp_nistz256_ifma_add(Hsqr, U2, U2);            /* 2*U1*H^2 */
+
+    ecp_nistz256_ifma_sub(res.X, Rsqr, Hsqr);
+    ecp_nistz256_ifma_sub(res.X, res.X, Hcub);
+
+    ecp_nistz256_ifma_sub(res.Y, U2, res.X);
+
+    ecp_nistz256_ifma_mul_mont(S2, S1, Hcub);
+    ecp_nistz256_ifma_mul_mont(res.Y, R, res.Y);
+    ecp_nistz256_ifma_sub(res.Y, res.Y, S2);
+
+    fe52x8_copy_conditional(res.X, b->X, in1infty);
+    fe52x8_copy_conditional(res.Y, b->Y, in1infty);
+    fe52x8_copy_conditional(res.Z, b->Z, in1infty);
+
+    fe52x8_copy_conditional(res.X, a->X, in2infty);
+    fe52x8_copy_conditional(res.Y, a->Y, in2infty);
+    fe52x8_copy_conditional(res.Z, a->Z, in2infty);
+
+    if (equal != 0) {
+        P256_POINT_X8 dbl;
+
+        ecp_nistz256_point_double_x8(&dbl, a);
+        fe52x8_copy_conditional(res.X, dbl.X, equal);
+        fe52x8_copy_conditional(res.Y, dbl.Y, equal);
+        fe52x8_copy_conditional(res.Z, dbl.Z, equal);
+    }
+
+    memcpy(r, &res, sizeof(res));
+}
+
+/* Point addition when b is known to be affine: r = a+b */
+static void ecp_nistz256_point_add_affine_x8(P256_POINT_X8 *r,
+                                             const P256_POINT_X8 *a,
+                                             const P256_POINT_AFFINE_X8 *b)
+{
+    P256_FE52X8 U2, S2, Z1sqr, H, R, Hsqr, Rsqr, Hcub;
+    P256_POINT_X8 res;
+    unsigned int in1infty, in2infty;
+
+    in1infty = fe52x8_is_zero(a->Z);
+    /* In affine representation infinity is encoded as (0,0) */
+    in2infty = fe52x8_is_zero(b->X) & fe52x8_is_zero(b->Y);
+
+    ecp_nistz256_ifma_sqr_mont(Z1sqr, a->Z);        /* Z1^2 */
+
+    ecp_nistz256_ifma_mul_mont(U2, b->X, Z1sqr);    /* U2 = X2*Z1^2 */
+    ecp_nistz256_ifma_sub(H, U2, a->X);             /* H = U2 - U1 */
+
+    ecp_nistz256_ifma_mul_mont(S2, Z1sqr, a->Z);    /* S2 = Z1^3 */
+
+    ecp_nistz256_ifma_mul_mont(res.Z, H, a->Z);     /* Z3 = H*Z1*Z2 */
+
+    ecp_nistz256_ifma_mul_mont(S2, S2, b->Y);       /* S2 = Y2*Z1^3 */
+    ecp_nistz256_ifma_sub(R, S2, a->Y);             /* R = S2 - S1 */
+
+    ecp_nistz256_ifma_sqr_mont(Hsqr, H);            /* H^2 */
+    ecp_nistz256_ifma_sqr_mont(Rsqr, R);            /* R^2 */
+    ecp_nistz256_ifma_mul_mont(Hcub, Hsqr, H);      /* H^3 */
+
+    ecp_nistz256_ifma_mul_mont(U2, a->X, Hsqr);     /* U1*H^2 */
+    ecp_nistz256_ifma_add(Hsqr, U2, U2);            /* 2*U1*H^2 */
+
+    ecp_nistz256_ifma_sub(res.X, Rsqr, Hsqr);
+    ecp_nistz256_ifma_sub(res.X, res.X, Hcub);
+    ecp_nistz256_ifma_sub(H, U2, res.X);
+
+    ecp_nistz256_ifma_mul_mont(S2, a->Y, Hcub);
+    ecp_nistz256_ifma_mul_mont(H, H, R);
+    ecp_nistz256_ifma_sub(res.Y, H, S2);
+
+    fe52x8_copy_conditional(res.X, b->X, in1infty);
+    fe52x8_copy_conditional(res.X, a->X, in2infty);
+
+    fe52x8_copy_conditional(res.Y, b->Y, in1infty);
+    fe52x8_copy_conditional(res.Y, a->Y, in2infty);
+
+    fe52x8_copy_conditional(res.Z, ONE_X8, in1infty);
+    fe52x8_copy_conditional(res.Z, a->Z, in2infty);
+
+    memcpy(r, &res, sizeof(res));
+}
+
+/* r = in^-1 mod p, same addition chain as in ecp_nistz256_mod_inverse */
+static void ecp_nistz256_mod_inverse_x8(P256_FE52X8 r, const P256_FE52X8 in)
+{
+    P256_FE52X8 p2, p4, p8, p16, p32, res;
+    int i;
+
+    ecp_nistz256_ifma_sqr_mont(res, in);
+    ecp_nistz256_ifma_mul_mont(p2, res, in);        /* 3*p */
+
+    ecp_nistz256_ifma_sqr_mont(res, p2);
+    ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(p4, res, p2);        /* f*p */
+
+    ecp_nistz256_ifma_sqr_mont(res, p4);
+    for (i = 0; i < 3; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(p8, res, p4);        /* ff*p */
+
+    ecp_nistz256_ifma_sqr_mont(res, p8);
+    for (i = 0; i < 7; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(p16, res, p8);       /* ffff*p */
+
+    ecp_nistz256_ifma_sqr_mont(res, p16);
+    for (i = 0; i < 15; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(p32, res, p16);      /* ffffffff*p */
+
+    ecp_nistz256_ifma_sqr_mont(res, p32);
+    for (i = 0; i < 31; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, in);
+
+    for (i = 0; i < 32 * 4; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, p32);
+
+    for (i = 0; i < 32; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, p32);
+
+    for (i = 0; i < 16; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, p16);
+
+    for (i = 0; i < 8; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, p8);
+
+    for (i = 0; i < 4; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, p4);
+
+    for (i = 0; i < 2; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, p2);
+
+    for (i = 0; i < 2; i++)
+        ecp_nistz256_ifma_sqr_mont(res, res);
+    ecp_nistz256_ifma_mul_mont(res, res, in);
+
+    memcpy(r, res, sizeof(res));
+}
+
+/* Little-endian encoding of |scalar|, reduced modulo the order if needed */
+__owur static int ecp_nistz256_scalar_to_str(unsigned char p_str[33],
+                                             const BIGNUM *scalar,
+                                             const EC_GROUP *group,
+                                             BN_CTX *ctx)
+{
+    BIGNUM *mod;
+
+    /* This is an unusual input, we don't guarantee constant-timeness. */
+    if ((BN_num_bits(scalar) > 256) || BN_is_negative(scalar)) {
+        if ((mod = BN_CTX_get(ctx)) == NULL
+            || !BN_nnmod(mod, scalar, group->order, ctx)) {
+            ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+            return 0;
+        }
+        scalar = mod;
+    }
+
+    return BN_bn2lebinpad(scalar, p_str, 33) == 33;
+}
+
+/*
+ * r[k] = scalar[k]*G for all lanes, using the hard-coded table for the
+ * default generator. Lanes without a scalar are left at infinity.
+ */
+static void ecp_nistz256_base_mul_x8(P256_POINT_X8 *r,
+                                     unsigned char p_str[][33], size_t num)
+{
+    const unsigned int window_size = 7;
+    const unsigned int mask = (1 << (window_size + 1)) - 1;
+    unsigned int wvalue, idx, off, neg;
+    BN_ULONG digit[P256_MULTI_LANES];
+    P256_FE52X8 zero, negY;
+    P256_POINT_AFFINE_X8 b;
+    size_t i, k;
+
+    memset(r, 0, sizeof(*r));
+    memset(zero, 0, sizeof(zero));
+    memset(digit, 0, sizeof(digit));
+
+    for (i = 0, idx = 0; i < 37; i++, idx += window_size) {
+        neg = 0;
+        for (k = 0; k < num; k++) {
+            if (i == 0) {
+                wvalue = (p_str[k][0] << 1) & mask;
+            } else {
+                off = (idx - 1) / 8;
+                wvalue = p_str[k][off] | p_str[k][off + 1] << 8;
+                wvalue = (wvalue >> ((idx - 1) % 8)) & mask;
+            }
+            wvalue = _booth_recode_w7(wvalue);
+
+            digit[k] = wvalue >> 1;
+            neg |= (wvalue & 1) << k;
+        }
+        ecp_nistz256_ifma_gather_w7(&b, ecp_nistz256_precomputed[i], digit);
+
+        ecp_nistz256_ifma_sub(negY, zero, b.Y);
+        fe52x8_copy_conditional(b.Y, negY, neg);
+
+        ecp_nistz256_ifma_mul_mont(b.X, b.X, TO_X8);
+        ecp_nistz256_ifma_mul_mont(b.Y, b.Y, TO_X8);
+
+        ecp_nistz256_point_add_affine_x8(r, r, &b);
+    }
+
+    OPENSSL_cleanse(digit, sizeof(digit));
+    OPENSSL_cleanse(&b, sizeof(b));
+}
+
+/*
+ * r[k] = scalar[k]*point[k] for all lanes, with |table| holding 1..16
+ * times the points. Not constant-time.
+ */
+static void ecp_nistz256_windowed_mul_x8(P256_POINT_X8 *r,
+                                         const P256_POINT_X8 table[16],
+                                         unsigned char p_str[][33],
+                                         size_t num)
+{
+    const unsigned int window_size = 5;
+    const unsigned int mask = (1 << (window_size + 1)) - 1;
+    unsigned int wvalue, idx, off, neg;
+    P256_FE52X8 zero, negY;
+    P256_POINT_X8 t;
+    size_t j, k;
+    int i;
+
+    memset(r, 0, sizeof(*r));
+    memset(zero, 0, sizeof(zero));
+
+    for (idx = 255; ; idx -= window_size) {
+        memset(&t, 0, sizeof(t));
+        neg = 0;
+        for (k = 0; k < num; k++) {
+            if (idx == 0) {
+                wvalue = (p_str[k][0] << 1) & mask;
+            } else {
+                off = (idx - 1) / 8;
+                wvalue = p_str[k][off] | p_str[k][off + 1] << 8;
+                wvalue = (wvalue >> ((idx - 1) % 8)) & mask;
+            }
+            wvalue = _booth_recode_w5(wvalue);
+
+            if ((wvalue >> 1) == 0)
+                continue;
+            for (j = k; j < 5 * P256_MULTI_LANES; j += P256_MULTI_LANES) {
+                t.X[j] = table[(wvalue >> 1) - 1].X[j];
+                t.Y[j] = table[(wvalue >> 1) - 1].Y[j];
+                t.Z[j] = table[(wvalue >> 1) - 1].Z[j];
+            }
+            neg |= (wvalue & 1) << k;
+        }
+        ecp_nistz256_ifma_sub(negY, zero, t.Y);
+        fe52x8_copy_conditional(t.Y, negY, neg);
+
+        ecp_nistz256_point_add_x8(r, r, &t);
+
+        if (idx == 0)
+            break;
+        for (i = 0; i < 5; i++)
+            ecp_nistz256_point_double_x8(r, r);
+    }
+}
+
+/* Stores the lanes of |a| below |num| to r[] in affine coordinates */
+__owur static int ecp_nistz256_set_from_x8(const EC_GROUP *group,
+                                           EC_POINT *r[], P256_POINT_X8 *a,
+                                           size_t num)
+{
+    P256_FE52X8 zinv, t;
+    BN_ULONG x[P256_LIMBS], y[P256_LIMBS];
+    unsigned int infty;
+    size_t k;
+
+    infty = fe52x8_is_zero(a->Z);
+
+    ecp_nistz256_mod_inverse_x8(zinv, a->Z);
+    ecp_nistz256_ifma_sqr_mont(t, zinv);
+    ecp_nistz256_ifma_mul_mont(a->X, a->X, t);
+    ecp_nistz256_ifma_mul_mont(t, t, zinv);
+    ecp_nistz256_ifma_mul_mont(a->Y, a->Y, t);
+
+    ecp_nistz256_ifma_mul_mont(a->X, a->X, FROM_X8);
+    ecp_nistz256_ifma_mul_mont(a->Y, a->Y, FROM_X8);
+
+    for (k = 0; k < num; k++) {
+        if ((infty >> k) & 1) {
+            if (!EC_POINT_set_to_infinity(group, r[k]))
+                return 0;
+            continue;
+        }
+        fe52x8_get_lane(x, a->X, k);
+        fe52x8_get_lane(y, a->Y, k);
+        if (!bn_set_words(r[k]->X, x, P256_LIMBS)
+            || !bn_set_words(r[k]->Y, y, P256_LIMBS)
+            || !bn_set_words(r[k]->Z, ONE, P256_LIMBS))
+            return 0;
+        r[k]->Z_is_one = 1;
+    }
+
+    return 1;
+}
+
+/* r[k] = g_scalars[k]*G + p_scalars[k]*points[k] for k < num <= 8 */
+__owur static int ecp_nistz256_points_mul_x8(const EC_GROUP *group,
+                                             EC_POINT *r[],
+                                             const BIGNUM *const g_scalars[],
+                                             const EC_POINT *const points[],
+                                             const BIGNUM *const p_scalars[],
+                                             size_t num, BN_CTX *ctx)
+{
+    unsigned char g_str[P256_MULTI_LANES][33];
+    unsigned char p_str[P256_MULTI_LANES][33];
+    BN_ULONG in[P256_LIMBS];
+    P256_POINT_X8 acc, *table = NULL;
+    size_t k;
+    int i, ret = 0;
+
+    BN_CTX_start(ctx);
+
+    for (k = 0; k < num; k++)
+        if (!ecp_nistz256_scalar_to_str(g_str[k], g_scalars[k], group, ctx))
+            goto err;
+    ecp_nistz256_base_mul_x8(&acc, g_str, num);
+
+    if (points != NULL) {
+        /* place for 1..16 times the points, and their sum */
+        table = OPENSSL_zalloc(17 * sizeof(P256_POINT_X8));
+        if (table == NULL)
+            goto err;
+
+        for (k = 0; k < num; k++) {
+            if (!ecp_nistz256_scalar_to_str(p_str[k], p_scalars[k], group,
+                                            ctx))
+                goto err;
+            if (!ecp_nistz256_bignum_to_field_elem(in, points[k]->X)) {
+                ERR_raise(ERR_LIB_EC, EC_R_COORDINATES_OUT_OF_RANGE);
+                goto err;
+            }
+            fe52x8_set_lane(table[0].X, k, in);
+            if (!ecp_nistz256_bignum_to_field_elem(in, points[k]->Y)) {
+                ERR_raise(ERR_LIB_EC, EC_R_COORDINATES_OUT_OF_RANGE);
+                goto err;
+            }
+            fe52x8_set_lane(table[0].Y, k, in);
+            if (!ecp_nistz256_bignum_to_field_elem(in, points[k]->Z)) {
+                ERR_raise(ERR_LIB_EC, EC_R_COORDINATES_OUT_OF_RANGE);
+                goto err;
+            }
+            fe52x8_set_lane(table[0].Z, k, in);
+        }
+        ecp_nistz256_ifma_mul_mont(table[0].X, table[0].X, TO_X8);
+        ecp_nistz256_ifma_mul_mont(table[0].Y, table[0].Y, TO_X8);
+        ecp_nistz256_ifma_mul_mont(table[0].Z, table[0].Z, TO_X8);
+
+        for (i = 2; i <= 16; i++) {
+            if ((i & 1) == 0)
+                ecp_nistz256_point_double_x8(&table[i - 1], &table[i / 2 - 1]);
+            else
+                ecp_nistz256_point_add_x8(&table[i - 1], &table[i - 2],
+                                          &table[0]);
+        }
+
+        ecp_nistz256_windowed_mul_x8(&table[16], table, p_str, num);
+        ecp_nistz256_point_add_x8(&acc, &acc, &table[16]);
+    }
+
+    ret = ecp_nistz256_set_from_x8(group, r, &acc, num);
+
+ err:
+    BN_CTX_end(ctx);
+    OPENSSL_cleanse(g_str, sizeof(g_str));
+    OPENSSL_free(table);
+    return ret;
+}
+
+static size_t ecp_nistz256_mul_multi_lanes(const EC_GROUP *group)
+{
+    const EC_POINT *generator = EC_GROUP_get0_generator(group);
+
+    if (generator == NULL || !ecp_nistz256_is_affine_G(generator)
+        || !ecp_nistz256_ifma_eligible())
+        return 1;
+
+    return P256_MULTI_LANES;
+}
+
+__owur static int ecp_nistz256_points_mul_multi(const EC_GROUP *group,
+                                                EC_POINT *r[],
+                                                const BIGNUM *const g_scalars[],
+                                                const EC_POINT *const points[],
+                                                const BIGNUM *const p_scalars[],
+                                                size_t num, BN_CTX *ctx)
+{
+    size_t i, n;
+
+    for (i = 0; i < num; i += n) {
+        n = num - i < P256_MULTI_LANES ? num - i : P256_MULTI_LANES;
+        if (!ecp_nistz256_points_mul_x8(group, r + i, g_scalars + i,
+                                        points != NULL ? points + i : NULL,
+                                        points != NULL ? p_scalars + i : NULL,
+                                        n, ctx))
+            return 0;
+    }
+
+    return 1;
+}
+#else
+# define ecp_nistz256_mul_multi_lanes NULL
+# define ecp_nistz256_points_mul_multi NULL
+#endif
+
 const EC_METHOD *EC_GFp_nistz256_method(void)
 {
     static const EC_METHOD ret = {
@@ -1501,7 +2137,9 @@ const EC_METHOD *EC_GFp_nistz256_method(void)
         0,                                          /* blind_coordinates */
         0,                                          /* ladder_pre */
         0,                                          /* ladder_step */
-        0                                           /* ladder_post */
+        0,                                          /* ladder_post */
+        ecp_nistz256_mul_multi_lanes,               /* can be #define-d NULL */
+        ecp_nistz256_points_mul_multi               /* can be #define-d NULL */
     };
 
     return &ret;
@@ -378,7 +378,9 @@ const EC_METHOD *EC_GFp_s390x_nistp##bits##_method(void)                \
         ossl_ec_GFp_simple_blind_coordinates,                           \
         ossl_ec_GFp_simple_ladder_pre,                                  \
         ossl_ec_GFp_simple_ladder_step,                                 \
-        ossl_ec_GFp_simple_ladder_post                                  \
+        ossl_ec_GFp_simple_ladder_post,                                 \
+        NULL, /* mul_multi_lanes */                                     \
+        NULL  /* points_mul_multi */                                    \
     };                                                                  \
     static const EC_METHOD *ret;                                        \
                                                                         \
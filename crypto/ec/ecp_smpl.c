@@ -75,7 +75,9 @@ const EC_METHOD *EC_GFp_simple_method(void)
         ossl_ec_GFp_simple_blind_coordinates,
         ossl_ec_GFp_simple_ladder_pre,
         ossl_ec_GFp_simple_ladder_step,
-        ossl_ec_GFp_simple_ladder_post
+        ossl_ec_GFp_simple_ladder_post,
+        0, /* mul_multi_lanes */
+        0  /* points_mul_multi */
     };
 
     return &ret;
@@ -715,4 +715,32 @@ int EVP_DigestVerify(EVP_MD_CTX *ctx, const unsigned char *sigret,
         return -1;
     return EVP_DigestVerifyFinal(ctx, sigret, siglen);
 }
+
+int EVP_DigestVerifyBatch(EVP_MD_CTX *ctx, const unsigned char *const *sigs,
+                          const size_t *siglens,
+                          const unsigned char *const *tbs,
+                          const size_t *tbslens, size_t num, int *results)
+{
+    EVP_PKEY_CTX *pctx = ctx->pctx;
+
+    if ((ctx->flags & EVP_MD_CTX_FLAG_FINALISED) != 0) {
+        ERR_raise(ERR_LIB_EVP, EVP_R_FINAL_ERROR);
+        return 0;
+    }
+
+    if (pctx == NULL
+            || pctx->operation != EVP_PKEY_OP_VERIFYCTX
+            || pctx->op.sig.algctx == NULL
+            || pctx->op.sig.signature == NULL
+            || pctx->op.sig.signature->digest_verify_batch == NULL) {
+        ERR_raise(ERR_LIB_EVP, EVP_R_OPERATION_NOT_SUPPORTED_FOR_THIS_KEYTYPE);
+        return -2;
+    }
+
+    ctx->flags |= EVP_MD_CTX_FLAG_FINALISED;
+    return pctx->op.sig.signature->digest_verify_batch(pctx->op.sig.algctx,
+                                                       sigs, siglens,
+                                                       tbs, tbslens,
+                                                       num, results);
+}
 #endif /* FIPS_MODULE */
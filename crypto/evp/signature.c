@@ -154,6 +154,12 @@ static void *evp_signature_from_algorithm(int name_id,
             signature->digest_verify
                 = OSSL_FUNC_signature_digest_verify(fns);
             break;
+        case OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_BATCH:
+            if (signature->digest_verify_batch != NULL)
+                break;
+            signature->digest_verify_batch
+                = OSSL_FUNC_signature_digest_verify_batch(fns);
+            break;
         case OSSL_FUNC_SIGNATURE_FREECTX:
             if (signature->freectx != NULL)
                 break;
@@ -242,6 +248,8 @@ static void *evp_signature_from_algorithm(int name_id,
             && signature->digest_sign_init == NULL)
         || (signature->digest_verify != NULL
             && signature->digest_verify_init == NULL)
+        || (signature->digest_verify_batch != NULL
+            && signature->digest_verify_init == NULL)
         || (gparamfncnt != 0 && gparamfncnt != 2)
         || (sparamfncnt != 0 && sparamfncnt != 2)
         || (gmdparamfncnt != 0 && gmdparamfncnt != 2)
@@ -258,6 +266,8 @@ static void *evp_signature_from_algorithm(int name_id,
          *  (digest_sign_init, digest_sign) or
          *  (digest_verify_init, digest_verify).
          *
+         * digest_verify_batch is optional, but requires digest_verify_init.
+         *
          * set_ctx_params and settable_ctx_params are optional, but if one of
          * them is present then the other one must also be present. The same
          * applies to get_ctx_params and gettable_ctx_params. The same rules
@@ -16,6 +16,7 @@
 #include "internal/property.h"
 #include "internal/provider.h"
 #include "internal/tsan_assist.h"
+#include "internal/rcu.h"
 #include "crypto/ctype.h"
 #include <openssl/lhash.h>
 #include <openssl/rand.h>
@@ -32,6 +33,12 @@
  */
 #define IMPL_CACHE_FLUSH_THRESHOLD  500
 
+/*
+ * The number of hash buckets in the query cache, must be a power of two.
+ * This is sized so that the chains stay short up to the flush threshold.
+ */
+#define IMPL_CACHE_BUCKETS          256
+
 typedef struct {
     void *method;
     int (*up_ref)(void *);
@@ -46,19 +53,23 @@ typedef struct {
 
 DEFINE_STACK_OF(IMPLEMENTATION)
 
-typedef struct {
+typedef struct query_st QUERY;
+
+struct query_st {
+    /* Next entry in the hash bucket, readers follow this under RCU */
+    QUERY *next;
+    /* Next entry waiting for a grace period before being freed */
+    QUERY *retired;
+    int nid;
     const OSSL_PROVIDER *provider;
     const char *query;
     METHOD method;
     char body[1];
-} QUERY;
-
-DEFINE_LHASH_OF_EX(QUERY);
+};
 
 typedef struct {
     int nid;
     STACK_OF(IMPLEMENTATION) *impls;
-    LHASH_OF(QUERY) *cache;
 } ALGORITHM;
 
 struct ossl_method_store_st {
@@ -80,6 +91,17 @@ struct ossl_method_store_st {
 
     /* query cache specific values */
 
+    /*
+     * The query cache is shared by all algorithms and is read without taking
+     * |lock|.  Lookups traverse the bucket chains inside an RCU read side
+     * critical section, while all modifications are made holding |lock| for
+     * writing.  Unlinked entries are put on |cache_retired| and are only
+     * freed once all readers that could still see them have finished.
+     */
+    CRYPTO_RCU_LOCK *cache_lock;
+    QUERY *cache[IMPL_CACHE_BUCKETS];
+    QUERY *cache_retired;
+
     /* Count of the query cache entries for all algs */
     size_t cache_nelem;
 
@@ -88,7 +110,6 @@ struct ossl_method_store_st {
 };
 
 typedef struct {
-    LHASH_OF(QUERY) *cache;
     size_t nelem;
     uint32_t seed;
     unsigned char using_global_seed;
@@ -103,9 +124,8 @@ typedef struct ossl_global_properties_st {
 #endif
 } OSSL_GLOBAL_PROPERTIES;
 
-static void ossl_method_cache_flush_alg(OSSL_METHOD_STORE *store,
-                                        ALGORITHM *alg);
 static void ossl_method_cache_flush(OSSL_METHOD_STORE *store, int nid);
+static void impl_cache_reclaim(OSSL_METHOD_STORE *store);
 
 /* Global properties are stored per library context */
 void ossl_ctx_global_properties_free(void *vglobp)
@@ -181,20 +201,34 @@ static int ossl_property_unlock(OSSL_METHOD_STORE *p)
     return p != 0 ? CRYPTO_THREAD_unlock(p->lock) : 0;
 }
 
-static unsigned long query_hash(const QUERY *a)
+/*
+ * Release a write lock, first freeing any query cache entries that were
+ * unlinked while it was held.
+ */
+static int ossl_property_write_unlock(OSSL_METHOD_STORE *p)
 {
-    return OPENSSL_LH_strhash(a->query);
+    if (p == NULL)
+        return 0;
+    impl_cache_reclaim(p);
+    return CRYPTO_THREAD_unlock(p->lock);
 }
 
-static int query_cmp(const QUERY *a, const QUERY *b)
+static size_t query_hash(int nid, const char *query)
 {
-    int res = strcmp(a->query, b->query);
+    return (OPENSSL_LH_strhash(query) ^ ((unsigned long)nid * 0x9e3779b1UL))
+           & (IMPL_CACHE_BUCKETS - 1);
+}
 
-    if (res == 0 && a->provider != NULL && b->provider != NULL)
-        res = b->provider > a->provider ? 1
-            : b->provider < a->provider ? -1
-            : 0;
-    return res;
+/*
+ * A NULL |prov| in a lookup matches an entry for any provider, which is why
+ * the provider isn't part of the hash.
+ */
+static int query_match(const QUERY *q, int nid, const OSSL_PROVIDER *prov,
+                       const char *query)
+{
+    return q->nid == nid
+           && (prov == NULL || q->provider == prov)
+           && strcmp(q->query, query) == 0;
 }
 
 static void impl_free(IMPLEMENTATION *impl)
@@ -213,10 +247,53 @@ static void impl_cache_free(QUERY *elem)
     }
 }
 
-static void impl_cache_flush_alg(ossl_uintmax_t idx, ALGORITHM *alg)
+/*
+ * Unlink a cache entry.  Readers might still be looking at it, so it isn't
+ * freed until impl_cache_reclaim() is called.  The caller must hold both the
+ * store's write lock and the cache's RCU write lock.
+ */
+static void impl_cache_unlink(OSSL_METHOD_STORE *store, QUERY **pprev,
+                              QUERY *q)
 {
-    lh_QUERY_doall(alg->cache, &impl_cache_free);
-    lh_QUERY_flush(alg->cache);
+    ossl_rcu_assign_ptr(pprev, q->next);
+    q->retired = store->cache_retired;
+    store->cache_retired = q;
+    store->cache_nelem--;
+}
+
+/* Free the unlinked cache entries, once no reader can be using them */
+static void impl_cache_reclaim(OSSL_METHOD_STORE *store)
+{
+    QUERY *q, *next;
+
+    if (store->cache_retired == NULL)
+        return;
+
+    ossl_synchronize_rcu(store->cache_lock);
+    for (q = store->cache_retired; q != NULL; q = next) {
+        next = q->retired;
+        impl_cache_free(q);
+    }
+    store->cache_retired = NULL;
+}
+
+/* Unlink all cache entries for |nid|, or all of them if |nid| is zero */
+static void impl_cache_flush_nid(OSSL_METHOD_STORE *store, int nid)
+{
+    QUERY **pprev, *q;
+    size_t i;
+
+    if (!ossl_rcu_write_lock(store->cache_lock))
+        return;
+    for (i = 0; i < IMPL_CACHE_BUCKETS; i++) {
+        for (pprev = &store->cache[i]; (q = *pprev) != NULL;) {
+            if (nid == 0 || q->nid == nid)
+                impl_cache_unlink(store, pprev, q);
+            else
+                pprev = &q->next;
+        }
+    }
+    ossl_rcu_write_unlock(store->cache_lock);
 }
 
 static void alg_cleanup(ossl_uintmax_t idx, ALGORITHM *a, void *arg)
@@ -225,8 +302,6 @@ static void alg_cleanup(ossl_uintmax_t idx, ALGORITHM *a, void *arg)
 
     if (a != NULL) {
         sk_IMPLEMENTATION_pop_free(a->impls, &impl_free);
-        lh_QUERY_doall(a->cache, &impl_cache_free);
-        lh_QUERY_free(a->cache);
         OPENSSL_free(a);
     }
     if (store != NULL)
@@ -246,7 +321,8 @@ OSSL_METHOD_STORE *ossl_method_store_new(OSSL_LIB_CTX *ctx)
         res->ctx = ctx;
         if ((res->algs = ossl_sa_ALGORITHM_new()) == NULL
             || (res->lock = CRYPTO_THREAD_lock_new()) == NULL
-            || (res->biglock = CRYPTO_THREAD_lock_new()) == NULL) {
+            || (res->biglock = CRYPTO_THREAD_lock_new()) == NULL
+            || (res->cache_lock = ossl_rcu_lock_new()) == NULL) {
             ossl_method_store_free(res);
             return NULL;
         }
@@ -256,12 +332,21 @@ OSSL_METHOD_STORE *ossl_method_store_new(OSSL_LIB_CTX *ctx)
 
 void ossl_method_store_free(OSSL_METHOD_STORE *store)
 {
+    QUERY *q, *next;
+    size_t i;
+
     if (store != NULL) {
+        for (i = 0; i < IMPL_CACHE_BUCKETS; i++)
+            for (q = store->cache[i]; q != NULL; q = next) {
+                next = q->next;
+                impl_cache_free(q);
+            }
         if (store->algs != NULL)
             ossl_sa_ALGORITHM_doall_arg(store->algs, &alg_cleanup, store);
         ossl_sa_ALGORITHM_free(store->algs);
         CRYPTO_THREAD_lock_free(store->lock);
         CRYPTO_THREAD_lock_free(store->biglock);
+        ossl_rcu_lock_free(store->cache_lock);
         OPENSSL_free(store);
     }
 }
@@ -337,8 +422,7 @@ int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
     alg = ossl_method_store_retrieve(store, nid);
     if (alg == NULL) {
         if ((alg = OPENSSL_zalloc(sizeof(*alg))) == NULL
-                || (alg->impls = sk_IMPLEMENTATION_new_null()) == NULL
-                || (alg->cache = lh_QUERY_new(&query_hash, &query_cmp)) == NULL)
+                || (alg->impls = sk_IMPLEMENTATION_new_null()) == NULL)
             goto err;
         alg->nid = nid;
         if (!ossl_method_store_insert(store, alg))
@@ -356,13 +440,13 @@ int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
     if (i == sk_IMPLEMENTATION_num(alg->impls)
         && sk_IMPLEMENTATION_push(alg->impls, impl))
         ret = 1;
-    ossl_property_unlock(store);
+    ossl_property_write_unlock(store);
     if (ret == 0)
         impl_free(impl);
     return ret;
 
 err:
-    ossl_property_unlock(store);
+    ossl_property_write_unlock(store);
     alg_cleanup(0, alg, NULL);
     impl_free(impl);
     return 0;
@@ -382,7 +466,7 @@ int ossl_method_store_remove(OSSL_METHOD_STORE *store, int nid,
     ossl_method_cache_flush(store, nid);
     alg = ossl_method_store_retrieve(store, nid);
     if (alg == NULL) {
-        ossl_property_unlock(store);
+        ossl_property_write_unlock(store);
         return 0;
     }
 
@@ -397,11 +481,11 @@ int ossl_method_store_remove(OSSL_METHOD_STORE *store, int nid,
         if (impl->method.method == method) {
             impl_free(impl);
             (void)sk_IMPLEMENTATION_delete(alg->impls, i);
-            ossl_property_unlock(store);
+            ossl_property_write_unlock(store);
             return 1;
         }
     }
-    ossl_property_unlock(store);
+    ossl_property_write_unlock(store);
     return 0;
 }
 
@@ -437,7 +521,7 @@ alg_cleanup_by_provider(ossl_uintmax_t idx, ALGORITHM *alg, void *arg)
      * any implementation, though.
      */
     if (count > 0)
-        ossl_method_cache_flush_alg(data->store, alg);
+        ossl_method_cache_flush(data->store, alg->nid);
 }
 
 int ossl_method_store_remove_all_provided(OSSL_METHOD_STORE *store,
@@ -450,7 +534,7 @@ int ossl_method_store_remove_all_provided(OSSL_METHOD_STORE *store,
     data.prov = prov;
     data.store = store;
     ossl_sa_ALGORITHM_doall_arg(store->algs, &alg_cleanup_by_provider, &data);
-    ossl_property_unlock(store);
+    ossl_property_write_unlock(store);
     return 1;
 }
 
@@ -573,33 +657,20 @@ fin:
     return ret;
 }
 
-static void ossl_method_cache_flush_alg(OSSL_METHOD_STORE *store,
-                                        ALGORITHM *alg)
-{
-    store->cache_nelem -= lh_QUERY_num_items(alg->cache);
-    impl_cache_flush_alg(0, alg);
-}
-
 static void ossl_method_cache_flush(OSSL_METHOD_STORE *store, int nid)
 {
-    ALGORITHM *alg = ossl_method_store_retrieve(store, nid);
-
-    if (alg != NULL)
-        ossl_method_cache_flush_alg(store, alg);
+    impl_cache_flush_nid(store, nid);
 }
 
 int ossl_method_store_cache_flush_all(OSSL_METHOD_STORE *store)
 {
     if (!ossl_property_write_lock(store))
         return 0;
-    ossl_sa_ALGORITHM_doall(store->algs, &impl_cache_flush_alg);
-    store->cache_nelem = 0;
-    ossl_property_unlock(store);
+    impl_cache_flush_nid(store, 0);
+    ossl_property_write_unlock(store);
     return 1;
 }
 
-IMPLEMENT_LHASH_DOALL_ARG(QUERY, IMPL_CACHE_FLUSH);
-
 /*
  * Flush an element from the query cache (perhaps).
  *
@@ -616,7 +687,7 @@ IMPLEMENT_LHASH_DOALL_ARG(QUERY, IMPL_CACHE_FLUSH);
  * preferable to a more refined approach that imposes a performance
  * impact.
  */
-static void impl_cache_flush_cache(QUERY *c, IMPL_CACHE_FLUSH *state)
+static int impl_cache_flush_cache(IMPL_CACHE_FLUSH *state)
 {
     uint32_t n;
 
@@ -633,26 +704,15 @@ static void impl_cache_flush_cache(QUERY *c, IMPL_CACHE_FLUSH *state)
     n ^= n << 5;
     state->seed = n;
 
-    if ((n & 1) != 0)
-        impl_cache_free(lh_QUERY_delete(state->cache, c));
-    else
-        state->nelem++;
-}
-
-static void impl_cache_flush_one_alg(ossl_uintmax_t idx, ALGORITHM *alg,
-                                     void *v)
-{
-    IMPL_CACHE_FLUSH *state = (IMPL_CACHE_FLUSH *)v;
-
-    state->cache = alg->cache;
-    lh_QUERY_doall_IMPL_CACHE_FLUSH(state->cache, &impl_cache_flush_cache,
-                                    state);
+    return (n & 1) != 0;
 }
 
 static void ossl_method_cache_flush_some(OSSL_METHOD_STORE *store)
 {
     IMPL_CACHE_FLUSH state;
     static TSAN_QUALIFIER uint32_t global_seed = 1;
+    QUERY **pprev, *q;
+    size_t i;
 
     state.nelem = 0;
     state.using_global_seed = 0;
@@ -662,40 +722,52 @@ static void ossl_method_cache_flush_some(OSSL_METHOD_STORE *store)
         state.seed = tsan_load(&global_seed);
     }
     store->cache_need_flush = 0;
-    ossl_sa_ALGORITHM_doall_arg(store->algs, &impl_cache_flush_one_alg, &state);
+    if (!ossl_rcu_write_lock(store->cache_lock))
+        return;
+    for (i = 0; i < IMPL_CACHE_BUCKETS; i++) {
+        for (pprev = &store->cache[i]; (q = *pprev) != NULL;) {
+            if (impl_cache_flush_cache(&state)) {
+                impl_cache_unlink(store, pprev, q);
+            } else {
+                state.nelem++;
+                pprev = &q->next;
+            }
+        }
+    }
+    ossl_rcu_write_unlock(store->cache_lock);
     store->cache_nelem = state.nelem;
     /* Without a timer, update the global seed */
     if (state.using_global_seed)
         tsan_add(&global_seed, state.seed);
 }
 
+/*
+ * Query cache lookups don't take the store lock at all.  The bucket chain is
+ * walked inside an RCU read side critical section, which guarantees that the
+ * entry found, and the reference it holds on the method, stay alive until the
+ * method has been up-ref'd.
+ */
 int ossl_method_store_cache_get(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
                                 int nid, const char *prop_query, void **method)
 {
-    ALGORITHM *alg;
-    QUERY elem, *r;
+    CRYPTO_RCU_TOKEN token;
+    QUERY *r;
     int res = 0;
 
     if (nid <= 0 || store == NULL || prop_query == NULL)
         return 0;
 
-    if (!ossl_property_read_lock(store))
+    if (!ossl_rcu_read_lock(store->cache_lock, &token))
         return 0;
-    alg = ossl_method_store_retrieve(store, nid);
-    if (alg == NULL)
-        goto err;
-
-    elem.query = prop_query;
-    elem.provider = prov;
-    r = lh_QUERY_retrieve(alg->cache, &elem);
-    if (r == NULL)
-        goto err;
-    if (ossl_method_up_ref(&r->method)) {
+    for (r = ossl_rcu_deref(&store->cache[query_hash(nid, prop_query)]);
+         r != NULL; r = ossl_rcu_deref(&r->next))
+        if (query_match(r, nid, prov, prop_query))
+            break;
+    if (r != NULL && ossl_method_up_ref(&r->method)) {
         *method = r->method.method;
         res = 1;
     }
-err:
-    ossl_property_unlock(store);
+    ossl_rcu_read_unlock(store->cache_lock, token);
     return res;
 }
 
@@ -704,8 +776,7 @@ int ossl_method_store_cache_set(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
                                 int (*method_up_ref)(void *),
                                 void (*method_destruct)(void *))
 {
-    QUERY elem, *old, *p = NULL;
-    ALGORITHM *alg;
+    QUERY **pprev, *old, *p = NULL;
     size_t len;
     int res = 1;
 
@@ -719,22 +790,15 @@ int ossl_method_store_cache_set(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
         return 0;
     if (store->cache_need_flush)
         ossl_method_cache_flush_some(store);
-    alg = ossl_method_store_retrieve(store, nid);
-    if (alg == NULL)
+    if (ossl_method_store_retrieve(store, nid) == NULL)
         goto err;
 
-    if (method == NULL) {
-        elem.query = prop_query;
-        elem.provider = prov;
-        if ((old = lh_QUERY_delete(alg->cache, &elem)) != NULL) {
-            impl_cache_free(old);
-            store->cache_nelem--;
-        }
-        goto end;
-    }
-    p = OPENSSL_malloc(sizeof(*p) + (len = strlen(prop_query)));
-    if (p != NULL) {
+    if (method != NULL) {
+        p = OPENSSL_malloc(sizeof(*p) + (len = strlen(prop_query)));
+        if (p == NULL)
+            goto err;
         p->query = p->body;
+        p->nid = nid;
         p->provider = prov;
         p->method.method = method;
         p->method.up_ref = method_up_ref;
@@ -742,21 +806,40 @@ int ossl_method_store_cache_set(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
         if (!ossl_method_up_ref(&p->method))
             goto err;
         memcpy((char *)p->query, prop_query, len + 1);
-        if ((old = lh_QUERY_insert(alg->cache, p)) != NULL) {
-            impl_cache_free(old);
-            goto end;
-        }
-        if (!lh_QUERY_error(alg->cache)) {
-            if (++store->cache_nelem >= IMPL_CACHE_FLUSH_THRESHOLD)
-                store->cache_need_flush = 1;
-            goto end;
+    }
+
+    if (!ossl_rcu_write_lock(store->cache_lock)) {
+        if (p != NULL)
+            ossl_method_free(&p->method);
+        goto err;
+    }
+    pprev = &store->cache[query_hash(nid, prop_query)];
+    for (; (old = *pprev) != NULL; pprev = &old->next)
+        if (query_match(old, nid, prov, prop_query))
+            break;
+    if (p != NULL) {
+        /*
+         * The new entry must be completely initialised before it is made
+         * visible to readers, the assignment provides the needed barrier.
+         */
+        p->next = old != NULL ? old->next : *pprev;
+        if (old == NULL
+                && ++store->cache_nelem >= IMPL_CACHE_FLUSH_THRESHOLD)
+            store->cache_need_flush = 1;
+        ossl_rcu_assign_ptr(pprev, p);
+        if (old != NULL) {
+            old->retired = store->cache_retired;
+            store->cache_retired = old;
         }
-        ossl_method_free(&p->method);
+    } else if (old != NULL) {
+        impl_cache_unlink(store, pprev, old);
     }
+    ossl_rcu_write_unlock(store->cache_lock);
+    goto end;
 err:
     res = 0;
     OPENSSL_free(p);
 end:
-    ossl_property_unlock(store);
+    ossl_property_write_unlock(store);
     return res;
 }
@@ -8,6 +8,7 @@
  */
 
 #include <openssl/crypto.h>
+#include "internal/rcu.h"
 #include "internal/cryptlib.h"
 
 #if !defined(OPENSSL_THREADS) || defined(CRYPTO_TDEBUG)
@@ -155,6 +156,54 @@ int CRYPTO_atomic_load_int(int *val, int *ret, CRYPTO_RWLOCK *lock)
     return 1;
 }
 
+/* Without threads there are no concurrent readers to wait for */
+struct rcu_lock_st {
+    int dummy;
+};
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void)
+{
+    return OPENSSL_zalloc(sizeof(CRYPTO_RCU_LOCK));
+}
+
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock)
+{
+    OPENSSL_free(lock);
+}
+
+int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN *token)
+{
+    *token = 0;
+    return 1;
+}
+
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN token)
+{
+}
+
+int ossl_rcu_write_lock(CRYPTO_RCU_LOCK *lock)
+{
+    return 1;
+}
+
+void ossl_rcu_write_unlock(CRYPTO_RCU_LOCK *lock)
+{
+}
+
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock)
+{
+}
+
+void *ossl_rcu_uptr_deref(void **p)
+{
+    return *p;
+}
+
+void ossl_rcu_assign_uptr(void **p, void *v)
+{
+    *p = v;
+}
+
 int openssl_init_fork_handlers(void)
 {
     return 0;
@@ -10,8 +10,10 @@
 /* We need to use the OPENSSL_fork_*() deprecated APIs */
 #define OPENSSL_SUPPRESS_DEPRECATED
 
+#include <string.h>
 #include <openssl/crypto.h>
 #include "internal/cryptlib.h"
+#include "internal/rcu.h"
 
 #if defined(__sun)
 # include <atomic.h>
@@ -37,6 +39,7 @@
 #endif
 
 # include <assert.h>
+# include <sched.h>
 
 # ifdef PTHREAD_RWLOCK_INITIALIZER
 #  define USE_RWLOCK
@@ -292,6 +295,178 @@ int CRYPTO_atomic_load_int(int *val, int *ret, CRYPTO_RWLOCK *lock)
     return 1;
 }
 
+/*
+ * RCU locks
+ *
+ * Readers announce themselves by incrementing a counter belonging to the
+ * current generation.  To avoid all readers hammering the same cache line
+ * the counters are striped over a number of slots, chosen by hashing the
+ * thread id.  ossl_synchronize_rcu() flips the generation and then waits for
+ * the counters of the previous generation to drain in every slot.
+ */
+# if defined(__GNUC__) && defined(__ATOMIC_ACQ_REL) && !defined(BROKEN_CLANG_ATOMICS)
+#  define USE_ATOMIC_RCU
+# endif
+
+# define RCU_READER_SLOTS     16        /* Must be a power of 2 */
+# define RCU_READER_SLOT_BITS 4
+
+typedef union {
+    uint32_t users[2];
+    /* Keep each slot on its own cache line */
+    unsigned char pad[64];
+} RCU_READER_SLOT;
+
+struct rcu_lock_st {
+    RCU_READER_SLOT slots[RCU_READER_SLOTS];
+    uint32_t generation;
+    int use_atomics;
+    pthread_mutex_t writer;
+    /* Used instead of the reader slots when atomics aren't lock free */
+    CRYPTO_RWLOCK *fallback;
+};
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void)
+{
+    CRYPTO_RCU_LOCK *lock;
+
+    if ((lock = OPENSSL_zalloc(sizeof(*lock))) == NULL)
+        return NULL;
+
+# ifdef USE_ATOMIC_RCU
+    lock->use_atomics = __atomic_is_lock_free(sizeof(uint32_t), NULL);
+# endif
+    if (!lock->use_atomics
+            && (lock->fallback = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(lock);
+        return NULL;
+    }
+    if (pthread_mutex_init(&lock->writer, NULL) != 0) {
+        CRYPTO_THREAD_lock_free(lock->fallback);
+        OPENSSL_free(lock);
+        return NULL;
+    }
+    return lock;
+}
+
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock)
+{
+    if (lock == NULL)
+        return;
+
+    pthread_mutex_destroy(&lock->writer);
+    CRYPTO_THREAD_lock_free(lock->fallback);
+    OPENSSL_free(lock);
+}
+
+# ifdef USE_ATOMIC_RCU
+static unsigned int rcu_reader_slot(void)
+{
+    CRYPTO_THREAD_ID id = CRYPTO_THREAD_get_current_id();
+    uint64_t h = 0;
+
+    memcpy(&h, &id, sizeof(id) < sizeof(h) ? sizeof(id) : sizeof(h));
+    /* Fibonacci hashing, the top bits are the well mixed ones */
+    h *= 0x9e3779b97f4a7c15ULL;
+    return (unsigned int)(h >> (64 - RCU_READER_SLOT_BITS));
+}
+# endif
+
+int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN *token)
+{
+# ifdef USE_ATOMIC_RCU
+    if (lock->use_atomics) {
+        unsigned int slot = rcu_reader_slot();
+        uint32_t *users = lock->slots[slot].users;
+        uint32_t gen;
+
+        /*
+         * Retry if a writer flipped the generation between our load of it
+         * and the increment, otherwise the writer might already have found
+         * our counter to be zero.
+         */
+        for (;;) {
+            gen = __atomic_load_n(&lock->generation, __ATOMIC_SEQ_CST) & 1;
+            __atomic_add_fetch(&users[gen], 1, __ATOMIC_SEQ_CST);
+            if ((__atomic_load_n(&lock->generation, __ATOMIC_SEQ_CST) & 1) == gen)
+                break;
+            __atomic_sub_fetch(&users[gen], 1, __ATOMIC_SEQ_CST);
+        }
+        *token = (slot << 1) | gen;
+        return 1;
+    }
+# endif
+    *token = 0;
+    return CRYPTO_THREAD_read_lock(lock->fallback);
+}
+
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN token)
+{
+# ifdef USE_ATOMIC_RCU
+    if (lock->use_atomics) {
+        __atomic_sub_fetch(&lock->slots[token >> 1].users[token & 1], 1,
+                           __ATOMIC_RELEASE);
+        return;
+    }
+# endif
+    CRYPTO_THREAD_unlock(lock->fallback);
+}
+
+int ossl_rcu_write_lock(CRYPTO_RCU_LOCK *lock)
+{
+    if (lock->use_atomics)
+        return pthread_mutex_lock(&lock->writer) == 0;
+    return CRYPTO_THREAD_write_lock(lock->fallback);
+}
+
+void ossl_rcu_write_unlock(CRYPTO_RCU_LOCK *lock)
+{
+    if (lock->use_atomics)
+        pthread_mutex_unlock(&lock->writer);
+    else
+        CRYPTO_THREAD_unlock(lock->fallback);
+}
+
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock)
+{
+# ifdef USE_ATOMIC_RCU
+    uint32_t old;
+    size_t i;
+
+    /*
+     * With the fallback read/write lock, writers already exclude all readers
+     * and there is nothing left to wait for.
+     */
+    if (!lock->use_atomics)
+        return;
+
+    pthread_mutex_lock(&lock->writer);
+    old = __atomic_fetch_add(&lock->generation, 1, __ATOMIC_SEQ_CST) & 1;
+    for (i = 0; i < RCU_READER_SLOTS; i++)
+        while (__atomic_load_n(&lock->slots[i].users[old], __ATOMIC_ACQUIRE) != 0)
+            sched_yield();
+    pthread_mutex_unlock(&lock->writer);
+# endif
+}
+
+void *ossl_rcu_uptr_deref(void **p)
+{
+# ifdef USE_ATOMIC_RCU
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+# else
+    return *p;
+# endif
+}
+
+void ossl_rcu_assign_uptr(void **p, void *v)
+{
+# ifdef USE_ATOMIC_RCU
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+# else
+    *p = v;
+# endif
+}
+
 # ifndef FIPS_MODULE
 int openssl_init_fork_handlers(void)
 {
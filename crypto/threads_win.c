@@ -27,6 +27,7 @@
 #endif
 
 #include <openssl/crypto.h>
+#include "internal/rcu.h"
 
 #if defined(OPENSSL_THREADS) && !defined(CRYPTO_TDEBUG) && defined(OPENSSL_SYS_WINDOWS)
 
@@ -268,6 +269,72 @@ int CRYPTO_atomic_load_int(int *val, int *ret, CRYPTO_RWLOCK *lock)
 #endif
 }
 
+/*
+ * RCU locks are mapped onto a read/write lock: readers hold it shared and
+ * writers exclusively, so no reader can see data being reclaimed and
+ * ossl_synchronize_rcu() has nothing left to wait for.
+ */
+struct rcu_lock_st {
+    CRYPTO_RWLOCK *rw;
+};
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void)
+{
+    CRYPTO_RCU_LOCK *lock;
+
+    if ((lock = OPENSSL_zalloc(sizeof(*lock))) == NULL)
+        return NULL;
+    if ((lock->rw = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(lock);
+        return NULL;
+    }
+    return lock;
+}
+
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock)
+{
+    if (lock == NULL)
+        return;
+
+    CRYPTO_THREAD_lock_free(lock->rw);
+    OPENSSL_free(lock);
+}
+
+int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN *token)
+{
+    *token = 0;
+    return CRYPTO_THREAD_read_lock(lock->rw);
+}
+
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN token)
+{
+    CRYPTO_THREAD_unlock(lock->rw);
+}
+
+int ossl_rcu_write_lock(CRYPTO_RCU_LOCK *lock)
+{
+    return CRYPTO_THREAD_write_lock(lock->rw);
+}
+
+void ossl_rcu_write_unlock(CRYPTO_RCU_LOCK *lock)
+{
+    CRYPTO_THREAD_unlock(lock->rw);
+}
+
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock)
+{
+}
+
+void *ossl_rcu_uptr_deref(void **p)
+{
+    return *p;
+}
+
+void ossl_rcu_assign_uptr(void **p, void *v)
+{
+    *p = v;
+}
+
 int openssl_init_fork_handlers(void)
 {
     return 0;
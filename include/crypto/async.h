@@ -15,5 +15,6 @@
 
 int async_init(void);
 void async_deinit(void);
+int ossl_async_pause_job_woken(void);
 
 #endif
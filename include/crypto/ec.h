@@ -102,5 +102,14 @@ int ossl_ecdsa_deterministic_sign(const unsigned char *dgst, int dlen,
                                   EC_KEY *eckey, unsigned int nonce_type,
                                   const char *digestname,
                                   OSSL_LIB_CTX *libctx, const char *propq);
+size_t ossl_ecdsa_multi_lanes(const EC_KEY *eckey);
+int ossl_ecdsa_sign_multi(const unsigned char *const dgst[], const int dlen[],
+                          unsigned char *const sig[], unsigned int siglen[],
+                          EC_KEY *const eckey[], size_t num, int *results);
+int ossl_ecdsa_verify_multi(const unsigned char *const dgst[],
+                            const int dgst_len[],
+                            const unsigned char *const sigbuf[],
+                            const int sig_len[], EC_KEY *const eckey[],
+                            size_t num, int *results);
 # endif /* OPENSSL_NO_EC */
 #endif
@@ -90,6 +90,11 @@ int ossl_x25519(uint8_t out_shared_key[32], const uint8_t private_key[32],
                 const uint8_t peer_public_value[32]);
 void ossl_x25519_public_from_private(uint8_t out_public_value[32],
                                      const uint8_t private_key[32]);
+size_t ossl_x25519_multi_lanes(void);
+int ossl_x25519_multi(uint8_t *const out_shared_key[],
+                      const uint8_t *const private_key[],
+                      const uint8_t *const peer_public_value[], size_t num,
+                      int *results);
 
 int
 ossl_ed25519_public_from_private(OSSL_LIB_CTX *ctx, uint8_t out_public_key[32],
@@ -108,6 +113,16 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
                     const uint8_t *context, size_t context_len,
                     OSSL_LIB_CTX *libctx, const char *propq);
 int
+ossl_ed25519_verify_batch(const uint8_t *const *tbs, const size_t *tbs_len,
+                          const uint8_t *const *signatures,
+                          const size_t *siglens,
+                          const uint8_t *const *public_keys, size_t num,
+                          int *results,
+                          const uint8_t dom2flag, const uint8_t phflag,
+                          const uint8_t csflag,
+                          const uint8_t *context, size_t context_len,
+                          OSSL_LIB_CTX *libctx, const char *propq);
+int
 ossl_ed448_public_from_private(OSSL_LIB_CTX *ctx, uint8_t out_public_key[57],
                                const uint8_t private_key[57], const char *propq);
 int
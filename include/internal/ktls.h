@@ -242,6 +242,7 @@ static ossl_inline ossl_ssize_t ktls_sendfile(int s, int fd, off_t off,
 #   endif
 
 #   include <sys/sendfile.h>
+#   include <fcntl.h>
 #   include <netinet/tcp.h>
 #   include <linux/socket.h>
 #   include <openssl/ssl3.h>
@@ -364,6 +365,21 @@ static ossl_inline ossl_ssize_t ktls_sendfile(int s, int fd, off_t off, size_t s
     return sendfile(s, fd, &off, size);
 }
 
+#   if !defined(OPENSSL_NO_KTLS_RX) && defined(SPLICE_F_MOVE)
+#    define OPENSSL_KTLS_SPLICE
+/*
+ * KTLS enables the splice system call to move received application data
+ * from the socket to a pipe without copying it to user space. A record of any
+ * other type makes the call fail with EINVAL, and must be read with
+ * ktls_read_record(). splice() is only declared if _GNU_SOURCE is defined.
+ */
+static ossl_inline ossl_ssize_t ktls_splice(int s, int fd, size_t size,
+                                            int flags)
+{
+    return splice(s, NULL, fd, NULL, size, (unsigned int)flags);
+}
+#   endif
+
 #   ifdef OPENSSL_NO_KTLS_RX
 
 
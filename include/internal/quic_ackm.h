@@ -54,6 +54,32 @@ void ossl_ackm_set_rx_max_ack_delay(OSSL_ACKM *ackm, OSSL_TIME rx_max_ack_delay)
  */
 void ossl_ackm_set_tx_max_ack_delay(OSSL_ACKM *ackm, OSSL_TIME tx_max_ack_delay);
 
+/*
+ * Applies ACK generation parameters requested by the peer in an ACK_FREQUENCY
+ * frame (draft-ietf-quic-ack-frequency). An ACK is generated once more than
+ * ack_eliciting_threshold ACK-eliciting packets have been received since the
+ * last one, and otherwise within max_ack_delay, which replaces the TX-side
+ * maximum ACK delay. An ACK is also generated immediately once packets have
+ * been reordered by at least reordering_threshold PNs; 0 disables this.
+ */
+void ossl_ackm_set_ack_frequency(OSSL_ACKM *ackm,
+                                 uint64_t ack_eliciting_threshold,
+                                 OSSL_TIME max_ack_delay,
+                                 uint64_t reordering_threshold);
+
+/*
+ * Called when an IMMEDIATE_ACK frame is received. Causes an ACK frame to be
+ * desired for the given PN space regardless of any thresholds.
+ */
+void ossl_ackm_on_rx_immediate_ack(OSSL_ACKM *ackm, int pkt_space);
+
+/*
+ * Changes the congestion controller the ACKM informs of packet events. This
+ * must only be done before any packet has been sent.
+ */
+void ossl_ackm_set_cc(OSSL_ACKM *ackm, const OSSL_CC_METHOD *cc_method,
+                      OSSL_CC_DATA *cc_data);
+
 typedef struct ossl_ackm_tx_pkt_st OSSL_ACKM_TX_PKT;
 struct ossl_ackm_tx_pkt_st {
     /* The packet number of the transmitted packet. */
@@ -208,10 +208,54 @@ struct ossl_cc_method_st {
      */
     int (*on_ecn)(OSSL_CC_DATA *ccdata,
                   const OSSL_CC_ECN_INFO *info);
+
+    /*
+     * Returns the rate in bytes per second at which the TXP should spread the
+     * transmission of ack-eliciting packets, or 0 if packets should not be
+     * paced (for example, because there is no RTT estimate yet). The TXP
+     * still never sends more than get_tx_allowance() permits. This method may
+     * be NULL, which is equivalent to always returning 0.
+     */
+    uint64_t (*get_pacing_rate)(OSSL_CC_DATA *ccdata);
 };
 
 extern const OSSL_CC_METHOD ossl_cc_dummy_method;
 extern const OSSL_CC_METHOD ossl_cc_newreno_method;
+extern const OSSL_CC_METHOD ossl_cc_cubic_method;
+extern const OSSL_CC_METHOD ossl_cc_bbr_method;
+
+/*
+ * Returns the congestion controller with the given name ("newreno", "cubic"
+ * or "bbr"), or NULL if there is no such controller.
+ */
+const OSSL_CC_METHOD *ossl_cc_get_method_by_name(const char *name);
+
+/*
+ * Helpers for implementing bind_diagnostics and unbind_diagnostics. The
+ * location of the parameter named |param_name| in |params|, which must be an
+ * unsigned integer of |len| bytes, is written to |*pp|, or NULL if there is no
+ * such parameter. ossl_cc_unbind_diag() sets |*pp| to NULL if |params|
+ * contains a parameter named |param_name|.
+ */
+int ossl_cc_bind_diag(OSSL_PARAM *params, const char *param_name, size_t len,
+                      void **pp);
+void ossl_cc_unbind_diag(OSSL_PARAM *params, const char *param_name,
+                         void **pp);
+
+/*
+ * Updates the smoothed RTT |*srtt| with the RTT of a packet sent at |tx_time|
+ * and acknowledged at |now|. |*srtt| should be zero before the first sample.
+ */
+void ossl_cc_update_srtt(OSSL_TIME *srtt, OSSL_TIME now, OSSL_TIME tx_time);
+
+/*
+ * Returns the pacing rate for a window-based controller with congestion
+ * window |cwnd| and smoothed RTT |srtt|, as suggested by RFC 9002 s. 7.7:
+ * twice cwnd/srtt in slow start, so that pacing does not slow the window's
+ * growth, and 5/4 of it otherwise. Returns 0 if |srtt| is zero.
+ */
+uint64_t ossl_cc_get_pacing_rate(uint64_t cwnd, OSSL_TIME srtt,
+                                 int in_slow_start);
 
 # endif
 
@@ -118,6 +118,12 @@ typedef struct quic_channel_args_st {
 
     int             is_server;
     SSL             *tls;
+
+    /*
+     * The max_datagram_frame_size transport parameter (RFC 9221) to send, or
+     * 0 if we do not accept DATAGRAM frames.
+     */
+    uint64_t        max_datagram_frame_size;
 } QUIC_CHANNEL_ARGS;
 
 /* Represents the cause for a connection's termination. */
@@ -197,6 +203,55 @@ int ossl_quic_channel_set_mutator(QUIC_CHANNEL *ch,
  */
 int ossl_quic_channel_start(QUIC_CHANNEL *ch);
 
+/*
+ * Arranges for a client channel which has not yet been started to send 0-RTT
+ * data, using the session set on its TLS object. Fails if that session does not
+ * allow 0-RTT.
+ */
+int ossl_quic_channel_enable_early_data(QUIC_CHANNEL *ch);
+
+/*
+ * Returns 1 if application data can be sent, either because 0-RTT keys are
+ * available or because the handshake is complete.
+ */
+int ossl_quic_channel_is_early_data_writable(const QUIC_CHANNEL *ch);
+
+/*
+ * Sets the max_datagram_frame_size transport parameter (RFC 9221) we send. Zero,
+ * the default, means we do not accept DATAGRAM frames. Fails once the channel
+ * has been started.
+ */
+int ossl_quic_channel_set_max_datagram_frame_size(QUIC_CHANNEL *ch,
+                                                  uint64_t max_size);
+
+/*
+ * Returns the largest datagram payload which can currently be sent in a single
+ * DATAGRAM frame, or 0 if the peer does not accept DATAGRAM frames.
+ */
+size_t ossl_quic_channel_get_max_datagram_size(QUIC_CHANNEL *ch);
+
+/* Returns 1 if the channel has room to queue another outgoing datagram. */
+int ossl_quic_channel_can_send_datagram(const QUIC_CHANNEL *ch);
+
+/*
+ * Queues a datagram to be sent in a DATAGRAM frame. It is sent once and is
+ * never retransmitted. Fails if the datagram is too large (see
+ * ossl_quic_channel_get_max_datagram_size()) or too many are queued.
+ */
+int ossl_quic_channel_send_datagram(QUIC_CHANNEL *ch, const void *buf,
+                                    size_t len);
+
+/* Returns 1 if a received datagram is waiting to be read. */
+int ossl_quic_channel_has_pending_datagram(const QUIC_CHANNEL *ch);
+
+/*
+ * Takes the oldest received datagram, copying up to buf_len bytes of it to buf.
+ * The number of bytes copied is written to *readbytes, and the rest of the
+ * datagram is discarded. Returns 0 if no datagram is waiting.
+ */
+int ossl_quic_channel_recv_datagram(QUIC_CHANNEL *ch, void *buf,
+                                    size_t buf_len, size_t *readbytes);
+
 /* Start a locally initiated connection shutdown. */
 void ossl_quic_channel_local_close(QUIC_CHANNEL *ch, uint64_t app_error_code,
                                    const char *app_reason);
@@ -262,6 +317,11 @@ void ossl_quic_channel_on_remote_conn_close(QUIC_CHANNEL *ch,
                                             OSSL_QUIC_FRAME_CONN_CLOSE *f);
 void ossl_quic_channel_on_new_conn_id(QUIC_CHANNEL *ch,
                                       OSSL_QUIC_FRAME_NEW_CONN_ID *f);
+void ossl_quic_channel_on_ack_frequency(QUIC_CHANNEL *ch,
+                                        const OSSL_QUIC_FRAME_ACK_FREQUENCY *f);
+int ossl_quic_channel_on_datagram(QUIC_CHANNEL *ch,
+                                  const OSSL_QUIC_FRAME_DATAGRAM *f,
+                                  size_t frame_len);
 
 /* Temporarily exposed during QUIC_PORT transition. */
 int ossl_quic_channel_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
@@ -301,6 +361,13 @@ OSSL_STATM *ossl_quic_channel_get_statm(QUIC_CHANNEL *ch);
 int ossl_quic_channel_get_peer_addr(QUIC_CHANNEL *ch, BIO_ADDR *peer_addr);
 int ossl_quic_channel_set_peer_addr(QUIC_CHANNEL *ch, const BIO_ADDR *peer_addr);
 
+/*
+ * Changes the congestion controller used by the channel. This can only be done
+ * before the channel is started.
+ */
+int ossl_quic_channel_set_cc_method(QUIC_CHANNEL *ch,
+                                    const OSSL_CC_METHOD *cc_method);
+
 /*
  * Returns an existing stream by stream ID. Returns NULL if the stream does not
  * exist.
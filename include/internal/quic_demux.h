@@ -211,6 +211,13 @@ void ossl_quic_demux_set_bio(QUIC_DEMUX *demux, BIO *net_bio);
  */
 int ossl_quic_demux_set_mtu(QUIC_DEMUX *demux, unsigned int mtu);
 
+/*
+ * Changes the length of the DCIDs of short header packets. Only datagrams
+ * received after the call are affected.
+ */
+void ossl_quic_demux_set_short_conn_id_len(QUIC_DEMUX *demux,
+                                           size_t short_conn_id_len);
+
 /*
  * Set the default packet handler. This is used for incoming packets which don't
  * match a registered DCID. This is only needed for servers. If a default packet
@@ -79,6 +79,27 @@ void ossl_quic_engine_set_inhibit_tick(QUIC_ENGINE *qeng, int inhibit);
 /* Gets the reactor which can be used to tick/poll on the port. */
 QUIC_REACTOR *ossl_quic_engine_get0_reactor(QUIC_ENGINE *qeng);
 
+/*
+ * Worker Threads
+ * ==============
+ *
+ * An engine can be serviced by a worker thread of its own, which ticks it
+ * whenever its network BIOs are ready or a timeout expires, so that several
+ * engines (e.g. the shards of a listener) can run on different cores without
+ * the application driving them. Application calls on objects belonging to the
+ * engine remain possible and are serialised with the worker by the engine
+ * mutex. While a worker is running, the engine never waits for longer than
+ * QUIC_ENGINE_WORKER_MAX_WAIT, as deadlines may be changed by other threads and
+ * datagrams may be forwarded to it by other shards without waking it.
+ *
+ * Both functions must be called with the engine mutex held. Stopping a worker
+ * temporarily releases the mutex while waiting for the thread to exit.
+ */
+#  define QUIC_ENGINE_WORKER_MAX_WAIT    (ossl_ms2time(10))
+
+int ossl_quic_engine_start_worker(QUIC_ENGINE *qeng);
+int ossl_quic_engine_stop_worker(QUIC_ENGINE *qeng);
+
 # endif
 
 #endif
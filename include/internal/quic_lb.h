@@ -0,0 +1,111 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_INTERNAL_QUIC_LB_H
+# define OSSL_INTERNAL_QUIC_LB_H
+# pragma once
+
+# include "internal/e_os.h"
+# include "internal/quic_types.h"
+
+# ifndef OPENSSL_NO_QUIC
+
+/*
+ * QUIC Load Balancer Connection ID Codec
+ * ======================================
+ *
+ * This encodes and decodes routable connection IDs in the format of
+ * draft-ietf-quic-load-balancers (QUIC-LB). A load balancer and the servers
+ * behind it share a configuration consisting of a config ID, a server ID
+ * length, a nonce length and optionally a 16 byte AES-128 key. Each server is
+ * assigned a server ID. A CID encoded by a server is laid out as follows:
+ *
+ *   First Octet (8):
+ *     Config Rotation (3): the config ID
+ *     CID Len (5): the length of the CID minus one
+ *   Server ID (server_id_len * 8)
+ *   Nonce (nonce_len * 8)
+ *
+ * The server ID and nonce together are encrypted as follows:
+ *
+ *   - if there is no key, they are sent in the clear;
+ *   - if they are exactly 16 bytes long, a single AES-128-ECB block
+ *     encryption is used;
+ *   - otherwise a four-pass Feistel network with AES-128-ECB as its round
+ *     function is used, splitting an odd length in the middle of a byte.
+ *
+ * Anybody holding the configuration can therefore recover the server ID, and
+ * any data the server chose to place in the nonce, from the CID alone. No
+ * state needs to be shared between the load balancer and the servers, or
+ * between the workers of a server.
+ *
+ * A QUIC_LB_CONFIG is not thread safe, as it holds cipher contexts.
+ */
+typedef struct quic_lb_config_st QUIC_LB_CONFIG;
+
+#  define QUIC_LB_MAX_CONFIG_ID         6
+#  define QUIC_LB_MIN_SERVER_ID_LEN     1
+#  define QUIC_LB_MAX_SERVER_ID_LEN     15
+#  define QUIC_LB_MIN_NONCE_LEN         4
+#  define QUIC_LB_MAX_NONCE_LEN         18
+#  define QUIC_LB_KEY_LEN               16
+
+/*
+ * Creates a new QUIC-LB configuration. config_id must not exceed
+ * QUIC_LB_MAX_CONFIG_ID; the value 7 is reserved for unroutable CIDs.
+ * server_id_len and nonce_len must lie within the limits above, and their sum
+ * must not exceed QUIC_MAX_CONN_ID_LEN - 1. key may be NULL, in which case the
+ * CIDs are not encrypted, and otherwise must be QUIC_LB_KEY_LEN bytes long.
+ *
+ * Returns NULL on failure.
+ */
+QUIC_LB_CONFIG *ossl_quic_lb_config_new(OSSL_LIB_CTX *libctx,
+                                        const char *propq,
+                                        unsigned int config_id,
+                                        const unsigned char *server_id,
+                                        size_t server_id_len,
+                                        size_t nonce_len,
+                                        const unsigned char *key,
+                                        size_t key_len);
+
+/* Frees a QUIC-LB configuration. No-op if lb is NULL. */
+void ossl_quic_lb_config_free(QUIC_LB_CONFIG *lb);
+
+/* Returns the length of the CIDs encoded with the configuration. */
+size_t ossl_quic_lb_config_get_cid_len(const QUIC_LB_CONFIG *lb);
+
+/* Returns the length of the nonce of the configuration. */
+size_t ossl_quic_lb_config_get_nonce_len(const QUIC_LB_CONFIG *lb);
+
+/*
+ * Encodes a CID identifying the server ID of the configuration, using the
+ * given nonce, which must be ossl_quic_lb_config_get_nonce_len() bytes long.
+ * Callers should ensure nonces are not reused.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int ossl_quic_lb_encode_cid(QUIC_LB_CONFIG *lb, const unsigned char *nonce,
+                            QUIC_CONN_ID *cid);
+
+/*
+ * Decodes a CID encoded with the configuration, writing the server ID to
+ * server_id and the nonce to nonce. Either may be NULL if not required. The
+ * buffers must be large enough for the server ID and nonce lengths of the
+ * configuration.
+ *
+ * Returns 0 if the CID does not belong to the configuration, which is the case
+ * if its length or config ID do not match, or on other failure. Returns 1 on
+ * success.
+ */
+int ossl_quic_lb_decode_cid(QUIC_LB_CONFIG *lb, const QUIC_CONN_ID *cid,
+                            unsigned char *server_id, unsigned char *nonce);
+
+# endif
+
+#endif
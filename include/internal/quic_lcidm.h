@@ -16,6 +16,7 @@
 # include "internal/quic_types.h"
 # include "internal/quic_wire.h"
 # include "internal/quic_predef.h"
+# include "internal/quic_lb.h"
 
 # ifndef OPENSSL_NO_QUIC
 
@@ -95,6 +96,28 @@
  *
  * An ODCID has no sequence number associated with it. It is the only CID to
  * lack one.
+ *
+ *
+ * Sharding
+ * --------
+ *
+ * Where the connections of a server are divided between several shards, each
+ * with its own LCIDM, the LCIDM of each shard can be configured to generate
+ * only LCIDs which identify that shard. The first byte of such an LCID, taken
+ * modulo the number of shards, is the index of the shard. This allows a packet
+ * received by the wrong shard to be passed to the right one without any shared
+ * state. ODCIDs are chosen by the peer and do not identify any shard.
+ *
+ *
+ * Load Balancer Routing
+ * ---------------------
+ *
+ * An LCIDM can be given a QUIC-LB configuration (see quic_lb.h), in which case
+ * every LCID it generates is a QUIC-LB CID encoding the server ID of the
+ * configuration and a random nonce. A load balancer holding the same
+ * configuration can then route packets to the right server. If sharding is
+ * also enabled, the first byte of the nonce rather than of the LCID identifies
+ * the shard, so finding the shard of an LCID requires decoding it.
  */
 
 /*
@@ -105,6 +128,39 @@
  */
 QUIC_LCIDM *ossl_quic_lcidm_new(OSSL_LIB_CTX *libctx, size_t lcid_len);
 
+/*
+ * Configures the LCIDM to generate only LCIDs identifying shard shard_idx of
+ * num_shards shards. num_shards must not exceed QUIC_LCIDM_MAX_SHARDS, and
+ * LCIDs generated beforehand are not affected. A num_shards of 1 disables
+ * sharding, which is the default. Sharding requires a non-zero lcid_len.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+#  define QUIC_LCIDM_MAX_SHARDS     256
+
+int ossl_quic_lcidm_set_shard(QUIC_LCIDM *lcidm, size_t shard_idx,
+                              size_t num_shards);
+
+/*
+ * Returns the index of the shard identified by an LCID generated by an LCIDM
+ * configured with ossl_quic_lcidm_set_shard(), or 0 if sharding is not enabled
+ * or lcid is not of the length of the LCIDs the LCIDM generates. If the LCIDM
+ * has a QUIC-LB configuration, 0 is also returned for an LCID which does not
+ * belong to that configuration.
+ */
+size_t ossl_quic_lcidm_get_shard(QUIC_LCIDM *lcidm,
+                                 const QUIC_CONN_ID *lcid);
+
+/*
+ * Configures the LCIDM to generate LCIDs encoded with the given QUIC-LB
+ * configuration, of which the LCIDM takes ownership on success. The LCID
+ * length of the LCIDM becomes the CID length of the configuration. This must
+ * be done before any LCIDs are generated or enrolled.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int ossl_quic_lcidm_set_lb_config(QUIC_LCIDM *lcidm, QUIC_LB_CONFIG *lb);
+
 /* Frees a LCIDM. */
 void ossl_quic_lcidm_free(QUIC_LCIDM *lcidm);
 
@@ -14,6 +14,7 @@
 # include "internal/quic_reactor.h"
 # include "internal/quic_demux.h"
 # include "internal/quic_predef.h"
+# include "internal/quic_lb.h"
 # include "internal/thread_arch.h"
 
 # ifndef OPENSSL_NO_QUIC
@@ -28,8 +29,10 @@
  * QUIC_PORT.
  *
  * A QUIC port is responsible for managing a set of channels which all use the
- * same UDP socket, and (in future) for automatically creating new channels when
- * incoming connections are received.
+ * same UDP socket, and for automatically creating new channels when incoming
+ * connections are received, if it has been set to allow them. Such channels are
+ * queued until they are popped from the port by the caller, e.g. a
+ * QUIC_LISTENER.
  *
  * In order to retain compatibility with QUIC_TSERVER, it also supports a point
  * of legacy compatibility where a caller can create an incoming (server role)
@@ -76,6 +79,99 @@ QUIC_CHANNEL *ossl_quic_port_create_outgoing(QUIC_PORT *port, SSL *tls);
  */
 QUIC_CHANNEL *ossl_quic_port_create_incoming(QUIC_PORT *port, SSL *tls);
 
+/*
+ * Sets the max_datagram_frame_size transport parameter (RFC 9221) sent by
+ * channels subsequently created on the port. Zero, the default, means they do
+ * not accept DATAGRAM frames.
+ */
+void ossl_quic_port_set_max_datagram_frame_size(QUIC_PORT *port,
+                                                uint64_t max_size);
+
+/*
+ * Sets whether the port creates channels for incoming connections. The port
+ * must be multi-connection and should have network BIOs set.
+ */
+void ossl_quic_port_set_allow_incoming(QUIC_PORT *port, int allow_incoming);
+
+/*
+ * Sets the maximum number of incoming channels waiting to be popped. Requests
+ * for new connections are dropped while the queue is full.
+ */
+void ossl_quic_port_set_max_incoming(QUIC_PORT *port, size_t max_incoming);
+
+/*
+ * Pops the next incoming channel from the queue of incoming connections, or
+ * returns NULL if there is none. The caller takes ownership of the channel and
+ * of its handshake layer object (see ossl_quic_channel_get0_ssl()), which must
+ * be freed along with it.
+ */
+QUIC_CHANNEL *ossl_quic_port_pop_incoming(QUIC_PORT *port);
+
+/* Returns the number of incoming channels waiting to be popped. */
+size_t ossl_quic_port_get_num_incoming_channels(const QUIC_PORT *port);
+
+/* Returns 1 if there is at least one incoming channel waiting to be popped. */
+int ossl_quic_port_have_incoming(const QUIC_PORT *port);
+
+/*
+ * Sets a callback which is called, with the port's mutex held, whenever an
+ * incoming channel is queued on the port.
+ */
+typedef void (ossl_quic_port_incoming_cb_fn)(QUIC_PORT *port, void *arg);
+
+void ossl_quic_port_set_incoming_cb(QUIC_PORT *port,
+                                    ossl_quic_port_incoming_cb_fn *cb,
+                                    void *cb_arg);
+
+/*
+ * Sharding
+ * ========
+ *
+ * The connections of a server can be divided between several ports, each of
+ * which belongs to its own engine, and is thus serviced under its own mutex
+ * (and potentially by its own thread). Each such port is a shard, and only
+ * issues local CIDs which identify it (see ossl_quic_lcidm_set_shard()).
+ *
+ * A datagram for a connection of another shard, which a port may receive if
+ * the peer's address changes or the shards share a socket, is passed to fwd_cb
+ * rather than processed. fwd_cb is called with the port's mutex held and should
+ * pass the datagram to the port of shard shard_idx with
+ * ossl_quic_port_post_dgram(). Datagrams which start new connections are
+ * always handled by the shard receiving them.
+ *
+ * ossl_quic_port_set_shard() must be called before any channel is created on
+ * the port. Returns 1 on success and 0 on failure.
+ */
+typedef void (ossl_quic_port_fwd_cb_fn)(const QUIC_URXE *e, size_t shard_idx,
+                                        void *arg);
+
+int ossl_quic_port_set_shard(QUIC_PORT *port,
+                             size_t shard_idx, size_t num_shards,
+                             ossl_quic_port_fwd_cb_fn *fwd_cb,
+                             void *fwd_cb_arg);
+
+/*
+ * Queues a copy of a datagram forwarded by another shard, to be processed the
+ * next time the port is ticked. Unlike other port functions, this must be
+ * called WITHOUT holding the port's mutex. Returns 1 on success and 0 if the
+ * datagram was dropped.
+ */
+int ossl_quic_port_post_dgram(QUIC_PORT *port, const QUIC_URXE *e);
+
+/*
+ * Load Balancer Routing
+ * =====================
+ *
+ * Configures a multi-connection port to issue QUIC-LB CIDs encoding the server
+ * ID of the given configuration (see quic_lb.h), so that a load balancer can
+ * route packets for its connections to it. The port takes ownership of lb on
+ * success. This also changes the length of the local CIDs of the port.
+ *
+ * Must be called before any channel is created on the port. Returns 1 on
+ * success and 0 on failure.
+ */
+int ossl_quic_port_set_lb_config(QUIC_PORT *port, QUIC_LB_CONFIG *lb);
+
 /*
  * Queries and Accessors
  * =====================
@@ -241,6 +241,9 @@ void ossl_qtx_finish_dgram(OSSL_QTX *qtx);
  * To determine if there is still data to be sent after calling this function,
  * use ossl_qtx_get_queue_len_bytes().
  *
+ * If the BIO supports UDP generic segmentation offload, runs of datagrams of
+ * the same size to the same peer are passed to it as a single message.
+ *
  * Returns one of the following values:
  *
  *   QTX_FLUSH_NET_RES_OK
@@ -123,6 +123,13 @@ int ossl_sframe_list_lock_head(SFRAME_LIST *fl, UINT_RANGE *range,
  */
 int ossl_sframe_list_is_head_locked(SFRAME_LIST *fl);
 
+/*
+ * Returns the packet holding the data of the head frame locked by a previous
+ * ossl_sframe_list_lock_head() call, or NULL if the head frame is not locked
+ * or its data is no longer held in a packet.
+ */
+OSSL_QRX_PKT *ossl_sframe_list_get_head_pkt(SFRAME_LIST *fl);
+
 /*
  * Callback function type to write stream frame data to some
  * side storage before the packet containing the frame data
@@ -31,6 +31,20 @@ __owur int ossl_quic_peek(SSL *s, void *buf, size_t len, size_t *readbytes);
 __owur int ossl_quic_write_flags(SSL *s, const void *buf, size_t len,
                                  uint64_t flags, size_t *written);
 __owur int ossl_quic_write(SSL *s, const void *buf, size_t len, size_t *written);
+__owur int ossl_quic_write_early_data(SSL *s, const void *buf, size_t len,
+                                      size_t *written);
+__owur int ossl_quic_write_ref(SSL *s, const void *buf, size_t len,
+                               uint64_t flags,
+                               SSL_write_ref_release_cb_fn release_cb,
+                               void *arg);
+__owur int ossl_quic_borrow_read_buf(SSL *s, const unsigned char **buf,
+                                     size_t *buf_len);
+__owur int ossl_quic_release_read_buf(SSL *s, size_t consumed);
+__owur int ossl_quic_set_max_datagram_frame_size(SSL *s, uint64_t max_size);
+__owur size_t ossl_quic_get_max_datagram_size(SSL *s);
+__owur int ossl_quic_send_datagram(SSL *s, const void *buf, size_t len);
+__owur int ossl_quic_recv_datagram(SSL *s, void *buf, size_t len,
+                                   size_t *readbytes);
 __owur long ossl_quic_ctrl(SSL *s, int cmd, long larg, void *parg);
 __owur long ossl_quic_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg);
 __owur long ossl_quic_callback_ctrl(SSL *s, int cmd, void (*fp) (void));
@@ -45,6 +59,7 @@ int ossl_quic_renegotiate_check(SSL *ssl, int initok);
 
 typedef struct quic_conn_st QUIC_CONNECTION;
 typedef struct quic_xso_st QUIC_XSO;
+typedef struct quic_listener_st QUIC_LISTENER;
 
 int ossl_quic_do_handshake(SSL *s);
 void ossl_quic_set_connect_state(SSL *s);
@@ -78,7 +93,12 @@ __owur SSL *ossl_quic_get0_connection(SSL *s);
 __owur int ossl_quic_get_stream_type(SSL *s);
 __owur uint64_t ossl_quic_get_stream_id(SSL *s);
 __owur int ossl_quic_is_stream_local(SSL *s);
+__owur int ossl_quic_set_stream_priority(SSL *s, unsigned int urgency,
+                                         int incremental);
+__owur int ossl_quic_get_stream_priority(SSL *s, unsigned int *urgency,
+                                         int *incremental);
 __owur int ossl_quic_set_default_stream_mode(SSL *s, uint32_t mode);
+__owur int ossl_quic_set_congestion_control(SSL *s, const char *name);
 __owur SSL *ossl_quic_detach_stream(SSL *s);
 __owur int ossl_quic_attach_stream(SSL *conn, SSL *stream);
 __owur int ossl_quic_set_incoming_stream_policy(SSL *s, int policy,
@@ -86,6 +106,19 @@ __owur int ossl_quic_set_incoming_stream_policy(SSL *s, int policy,
 __owur SSL *ossl_quic_accept_stream(SSL *s, uint64_t flags);
 __owur size_t ossl_quic_get_accept_stream_queue_len(SSL *s);
 
+__owur SSL *ossl_quic_new_listener(SSL_CTX *ctx, uint64_t flags);
+__owur int ossl_quic_listen(SSL *ssl);
+__owur SSL *ossl_quic_accept_connection(SSL *ssl, uint64_t flags);
+__owur size_t ossl_quic_get_accept_connection_queue_len(SSL *ssl);
+__owur int ossl_quic_set_max_accept_connection_queue_len(SSL *ssl,
+                                                         size_t max_len);
+__owur int ossl_quic_add_listener_worker(SSL *ssl, BIO *net_rbio,
+                                         BIO *net_wbio);
+__owur int ossl_quic_set_lb_config(SSL *ssl, unsigned int config_id,
+                                   const unsigned char *server_id,
+                                   size_t server_id_len, size_t nonce_len,
+                                   const unsigned char *key, size_t key_len);
+
 __owur int ossl_quic_stream_reset(SSL *ssl,
                                   const SSL_STREAM_RESET_ARGS *args,
                                   size_t args_len);
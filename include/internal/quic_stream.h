@@ -241,6 +241,34 @@ int ossl_quic_sstream_append(QUIC_SSTREAM *qss,
                              size_t buf_len,
                              size_t *consumed);
 
+/*
+ * Callback type used to return a buffer passed to
+ * ossl_quic_sstream_append_ref() to its owner.
+ */
+typedef void (ossl_quic_sstream_release_cb)(const void *buf,
+                                            size_t buf_len,
+                                            void *arg);
+
+/*
+ * (Front end use.) Appends user data to the stream without copying it. The
+ * stream references buf directly, so the caller must keep it valid and
+ * unchanged until release_cb is called with release_cb_arg. This happens once
+ * all of the data has been acknowledged by the peer, or when the QUIC_SSTREAM
+ * is freed, whichever is sooner. The whole buffer is always appended.
+ *
+ * Until all referenced buffers have been released, ossl_quic_sstream_append()
+ * does not accept any data (this is reported as backpressure), though further
+ * buffers can be appended using this function.
+ *
+ * Returns 1 on success or 0 on failure, in which case release_cb is not
+ * called.
+ */
+int ossl_quic_sstream_append_ref(QUIC_SSTREAM *qss,
+                                 const unsigned char *buf,
+                                 size_t buf_len,
+                                 ossl_quic_sstream_release_cb *release_cb,
+                                 void *release_cb_arg);
+
 /*
  * Marks a stream as finished. ossl_quic_sstream_append() may not be called anymore
  * after calling this.
@@ -399,6 +427,14 @@ int ossl_quic_rstream_get_record(QUIC_RSTREAM *qrs,
  */
 int ossl_quic_rstream_release_record(QUIC_RSTREAM *qrs, size_t read_len);
 
+/*
+ * Returns the packet which holds the data of the record returned by the
+ * previous ossl_quic_rstream_get_record() call, so that the caller can take a
+ * reference to it if the data must outlive the QUIC_RSTREAM. Returns NULL if
+ * there is no such record or if its data is held in the ring buffer.
+ */
+OSSL_QRX_PKT *ossl_quic_rstream_get_record_pkt(QUIC_RSTREAM *qrs);
+
 /*
  * Moves received frame data from decrypted packets to ring buffer.
  * This should be called when there are too many decrypted packets allocated.
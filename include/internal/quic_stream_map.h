@@ -18,6 +18,7 @@
 # include "internal/quic_predef.h"
 # include "internal/quic_stream.h"
 # include "internal/quic_fc.h"
+# include "internal/priority_queue.h"
 # include <openssl/lhash.h>
 
 # ifndef OPENSSL_NO_QUIC
@@ -119,6 +120,15 @@ struct quic_stream_st {
     /* Temporary value used by TXP. */
     uint64_t        txp_txfc_new_credit_consumed;
 
+    /*
+     * Position of an incremental stream in the RR rotation among the active
+     * streams of the same urgency. Only meaningful while active.
+     */
+    uint64_t        sched_seq;
+
+    /* Handle of this stream in the QUIC_STREAM_MAP active queue. */
+    size_t          active_elem;
+
     /*
      * The final size of the send stream. Although this information can be
      * discerned from a QUIC_SSTREAM, it is stored separately as we need to keep
@@ -163,6 +173,15 @@ struct quic_stream_st {
     /* 1 iff this QUIC_STREAM is on the active queue (invariant). */
     unsigned int    active : 1;
 
+    /*
+     * Scheduling priority (RFC 9218). Streams of a lower urgency value are
+     * served first. Among streams of the same urgency, non-incremental streams
+     * are served one at a time in stream ID order, followed by incremental
+     * streams, which share the available bandwidth in RR order.
+     */
+    unsigned int    urgency     : 3;
+    unsigned int    incremental : 1;
+
     /*
      * This is a copy of the QUIC connection as_server value, indicating
      * whether we are locally operating as a server or not. Having this
@@ -324,6 +343,9 @@ struct quic_stream_st {
 #define QUIC_STREAM_DIR_UNI                 2
 #define QUIC_STREAM_DIR_MASK                2
 
+#define QUIC_STREAM_URGENCY_MAX             7
+#define QUIC_STREAM_URGENCY_DEFAULT         3
+
 void ossl_quic_stream_check(const QUIC_STREAM *s);
 
 /*
@@ -511,17 +533,25 @@ static ossl_inline ossl_unused int ossl_quic_stream_recv_get_final_size(const QU
  *
  *   - maps stream IDs to QUIC_STREAM objects;
  *   - tracks which streams are 'active' (currently have data for transmission);
- *   - allows iteration over the active streams only.
+ *   - allows iteration over the active streams only, in scheduling order.
  *
+ * The active streams are held in a priority queue ordered by their scheduling
+ * priority. active_list holds the same streams in iteration order; it is
+ * rebuilt from the queue before the next iteration whenever active_dirty is
+ * set.
  */
+DEFINE_PRIORITY_QUEUE_OF(QUIC_STREAM);
+
 struct quic_stream_map_st {
     LHASH_OF(QUIC_STREAM)   *map;
+    PRIORITY_QUEUE_OF(QUIC_STREAM) *active_pq;
     QUIC_STREAM_LIST_NODE   active_list;
     QUIC_STREAM_LIST_NODE   accept_list;
     QUIC_STREAM_LIST_NODE   ready_for_gc_list;
     size_t                  rr_stepping, rr_counter;
     size_t                  num_accept, num_shutdown_flush;
-    QUIC_STREAM             *rr_cur;
+    uint64_t                next_sched_seq;
+    int                     active_dirty;
     uint64_t                (*get_stream_limit_cb)(int uni, void *arg);
     void                    *get_stream_limit_cb_arg;
     QUIC_RXFC               *max_streams_bidi_rxfc;
@@ -607,6 +637,15 @@ void ossl_quic_stream_map_update_state(QUIC_STREAM_MAP *qsm, QUIC_STREAM *s);
  */
 void ossl_quic_stream_map_set_rr_stepping(QUIC_STREAM_MAP *qsm, size_t stepping);
 
+/*
+ * Sets the scheduling priority of a stream (see RFC 9218). urgency must not
+ * exceed QUIC_STREAM_URGENCY_MAX. New streams have an urgency of
+ * QUIC_STREAM_URGENCY_DEFAULT and are incremental. Takes effect from the next
+ * iteration over the active streams.
+ */
+void ossl_quic_stream_map_set_priority(QUIC_STREAM_MAP *qsm, QUIC_STREAM *s,
+                                       unsigned int urgency, int incremental);
+
 /*
  * Returns 1 if the stream ordinal given is allowed by the current stream count
  * flow control limit, assuming a locally initiated stream of a type described
@@ -839,23 +878,28 @@ int ossl_quic_stream_map_is_shutdown_flush_finished(QUIC_STREAM_MAP *qsm);
  * QUIC Stream Iterator
  * ====================
  *
- * Allows the current set of active streams to be walked using a RR-based
- * algorithm. Each time ossl_quic_stream_iter_init is called, the RR algorithm
- * is stepped. The RR algorithm rotates the iteration order such that the next
- * active stream is returned first after n calls to ossl_quic_stream_iter_init,
- * where n is the stepping value configured via
- * ossl_quic_stream_map_set_rr_stepping.
+ * Allows the current set of active streams to be walked in scheduling order:
+ * by urgency, then non-incremental streams in stream ID order, then
+ * incremental streams in RR order. Each time ossl_quic_stream_iter_init is
+ * called, the RR algorithm is stepped. Every n calls, where n is the stepping
+ * value configured via ossl_quic_stream_map_set_rr_stepping, the first
+ * incremental stream in the iteration order is moved behind the other
+ * incremental streams of the same urgency.
  *
- * Suppose there are three active streams and the configured stepping is n:
+ * Suppose there are three active incremental streams of the same urgency and
+ * the configured stepping is n:
  *
  *   Iteration 0n:  [Stream 1] [Stream 2] [Stream 3]
  *   Iteration 1n:  [Stream 2] [Stream 3] [Stream 1]
  *   Iteration 2n:  [Stream 3] [Stream 1] [Stream 2]
  *
+ * If stream 0 of a lower urgency value also becomes active, it is returned
+ * first in every iteration until it becomes inactive, while streams 1 to 3
+ * keep rotating behind it.
  */
 typedef struct quic_stream_iter_st {
     QUIC_STREAM_MAP     *qsm;
-    QUIC_STREAM         *first_stream, *stream;
+    QUIC_STREAM         *stream;
 } QUIC_STREAM_ITER;
 
 /*
@@ -103,6 +103,24 @@ int ossl_quic_tls_get_error(QUIC_TLS *qtls,
 int ossl_quic_tls_is_cert_request(QUIC_TLS *qtls);
 int ossl_quic_tls_has_bad_max_early_data(QUIC_TLS *qtls);
 
+/*
+ * Client only. If the session set on the inner SSL object permits 0-RTT,
+ * returns 1 and the transport parameters the server sent in the connection
+ * which issued the session. Returns 0 otherwise.
+ */
+int ossl_quic_tls_get0_early_data_tparams(QUIC_TLS *qtls,
+                                          const unsigned char **tparams,
+                                          size_t *tparams_len);
+
+/*
+ * Client only. Offer early data in the ClientHello. Must be called before the
+ * first call to ossl_quic_tls_tick().
+ */
+int ossl_quic_tls_enable_early_data(QUIC_TLS *qtls);
+
+/* Returns 1 if the peer accepted our offer of early data. */
+int ossl_quic_tls_is_early_data_accepted(QUIC_TLS *qtls);
+
 # endif
 
 #endif
@@ -131,6 +131,14 @@ int ossl_quic_tserver_stream_new(QUIC_TSERVER *srv,
                                  int is_uni,
                                  uint64_t *stream_id);
 
+/*
+ * Sets the scheduling priority of a stream, as for SSL_set_stream_priority().
+ */
+int ossl_quic_tserver_set_stream_priority(QUIC_TSERVER *srv,
+                                          uint64_t stream_id,
+                                          unsigned int urgency,
+                                          int incremental);
+
 BIO *ossl_quic_tserver_get0_rbio(QUIC_TSERVER *srv);
 
 SSL_CTX *ossl_quic_tserver_get0_ssl_ctx(QUIC_TSERVER *srv);
@@ -215,6 +223,25 @@ int ossl_quic_tserver_set_max_early_data(QUIC_TSERVER *srv,
 void ossl_quic_tserver_set_psk_find_session_cb(QUIC_TSERVER *srv,
                                                SSL_psk_find_session_cb_func cb);
 
+/*
+ * Set the max_datagram_frame_size transport parameter (RFC 9221). Must be
+ * called before the connection is accepted.
+ */
+int ossl_quic_tserver_set_max_datagram_frame_size(QUIC_TSERVER *srv,
+                                                  uint64_t max_size);
+
+/* Send a datagram in a DATAGRAM frame. Returns 1 if it was queued. */
+int ossl_quic_tserver_send_datagram(QUIC_TSERVER *srv,
+                                    const unsigned char *buf, size_t buf_len);
+
+/*
+ * Take a received datagram. Returns 0 if no datagram is waiting. Otherwise
+ * *bytes_read is set to its length, truncated to buf_len.
+ */
+int ossl_quic_tserver_recv_datagram(QUIC_TSERVER *srv,
+                                    unsigned char *buf, size_t buf_len,
+                                    size_t *bytes_read);
+
 # endif
 
 #endif
@@ -129,6 +129,14 @@ int ossl_quic_tx_packetiser_set_cur_dcid(OSSL_QUIC_TX_PACKETISER *txp,
 int ossl_quic_tx_packetiser_set_cur_scid(OSSL_QUIC_TX_PACKETISER *txp,
                                          const QUIC_CONN_ID *scid);
 
+/*
+ * Change the congestion controller the TXP consults. This must only be done
+ * before any packet has been sent.
+ */
+void ossl_quic_tx_packetiser_set_cc(OSSL_QUIC_TX_PACKETISER *txp,
+                                    const OSSL_CC_METHOD *cc_method,
+                                    OSSL_CC_DATA *cc_data);
+
 /*
  * Change the destination L4 address the TXP uses to send datagrams. Specify
  * NULL (or AF_UNSPEC) to disable use of addressed mode.
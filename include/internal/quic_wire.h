@@ -42,6 +42,14 @@
 #  define OSSL_QUIC_FRAME_TYPE_CONN_CLOSE_APP         0x1D
 #  define OSSL_QUIC_FRAME_TYPE_HANDSHAKE_DONE         0x1E
 
+/* draft-ietf-quic-ack-frequency */
+#  define OSSL_QUIC_FRAME_TYPE_IMMEDIATE_ACK          0x1F
+#  define OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY          0xAF
+
+/* RFC 9221 */
+#  define OSSL_QUIC_FRAME_TYPE_DATAGRAM               0x30
+#  define OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN           0x31
+
 #  define OSSL_QUIC_FRAME_FLAG_STREAM_FIN         0x01
 #  define OSSL_QUIC_FRAME_FLAG_STREAM_LEN         0x02
 #  define OSSL_QUIC_FRAME_FLAG_STREAM_OFF         0x04
@@ -86,6 +94,8 @@
     (((x) & ~(uint64_t)1) == OSSL_QUIC_FRAME_TYPE_STREAMS_BLOCKED_BIDI)
 #  define OSSL_QUIC_FRAME_TYPE_IS_CONN_CLOSE(x) \
     (((x) & ~(uint64_t)1) == OSSL_QUIC_FRAME_TYPE_CONN_CLOSE_TRANSPORT)
+#  define OSSL_QUIC_FRAME_TYPE_IS_DATAGRAM(x) \
+    (((x) & ~(uint64_t)1) == OSSL_QUIC_FRAME_TYPE_DATAGRAM)
 
 const char *ossl_quic_frame_type_to_string(uint64_t frame_type);
 
@@ -123,6 +133,12 @@ ossl_quic_frame_type_is_ack_eliciting(uint64_t frame_type)
 #  define QUIC_TPARAM_INITIAL_SCID                        0x0F
 #  define QUIC_TPARAM_RETRY_SCID                          0x10
 
+/* draft-ietf-quic-ack-frequency */
+#  define QUIC_TPARAM_MIN_ACK_DELAY                       0xFF04DE1B
+
+/* RFC 9221 */
+#  define QUIC_TPARAM_MAX_DATAGRAM_FRAME_SIZE             0x20
+
 /*
  * QUIC Frame Logical Representations
  * ==================================
@@ -223,6 +239,27 @@ typedef struct ossl_quic_frame_conn_close_st {
     size_t          reason_len; /* Length of reason in bytes */
 } OSSL_QUIC_FRAME_CONN_CLOSE;
 
+/* QUIC Frame: ACK_FREQUENCY */
+typedef struct ossl_quic_frame_ack_frequency_st {
+    uint64_t    seq_num;
+    uint64_t    ack_eliciting_threshold;
+    OSSL_TIME   max_ack_delay;          /* encoded in microseconds */
+    uint64_t    reordering_threshold;
+} OSSL_QUIC_FRAME_ACK_FREQUENCY;
+
+/* QUIC Frame: DATAGRAM */
+typedef struct ossl_quic_frame_datagram_st {
+    const unsigned char *data;  /* pointer to datagram payload */
+    uint64_t            len;    /* length of payload in bytes */
+
+    /*
+     * On encode, determines whether the length field is written. If zero, the
+     * frame extends to the end of the packet and must be the last frame in it.
+     * Set on decode according to the frame type.
+     */
+    unsigned int        has_explicit_len : 1;
+} OSSL_QUIC_FRAME_DATAGRAM;
+
 /*
  * QUIC Wire Format Encoding
  * =========================
@@ -440,6 +477,32 @@ int ossl_quic_wire_encode_frame_conn_close(WPACKET *pkt,
  */
 int ossl_quic_wire_encode_frame_handshake_done(WPACKET *pkt);
 
+/*
+ * Encodes a QUIC ACK_FREQUENCY frame to the packet writer, given a logical
+ * representation of the ACK_FREQUENCY frame.
+ */
+int ossl_quic_wire_encode_frame_ack_frequency(WPACKET *pkt,
+                                              const OSSL_QUIC_FRAME_ACK_FREQUENCY *f);
+
+/*
+ * Encodes a QUIC IMMEDIATE_ACK frame to the packet writer. This frame type
+ * takes no arguments.
+ */
+int ossl_quic_wire_encode_frame_immediate_ack(WPACKET *pkt);
+
+/*
+ * Encodes a QUIC DATAGRAM frame to the packet writer, given a logical
+ * representation of the DATAGRAM frame.
+ */
+int ossl_quic_wire_encode_frame_datagram(WPACKET *pkt,
+                                         const OSSL_QUIC_FRAME_DATAGRAM *f);
+
+/*
+ * Returns the encoded length of a DATAGRAM frame with an explicit length
+ * field carrying a payload of len bytes. Returns 0 if len is too large.
+ */
+size_t ossl_quic_wire_get_encoded_frame_len_datagram(uint64_t len);
+
 /*
  * Encodes a QUIC transport parameter TLV with the given ID into the WPACKET.
  * The payload is an arbitrary buffer.
@@ -726,6 +789,27 @@ int ossl_quic_wire_decode_frame_ping(PACKET *pkt);
  */
 int ossl_quic_wire_decode_frame_handshake_done(PACKET *pkt);
 
+/*
+ * Decodes a QUIC ACK_FREQUENCY frame into the preallocated structure at f.
+ */
+int ossl_quic_wire_decode_frame_ack_frequency(PACKET *pkt,
+                                              OSSL_QUIC_FRAME_ACK_FREQUENCY *f);
+
+/*
+ * Decodes a QUIC IMMEDIATE_ACK frame. This frame type takes no arguments.
+ */
+int ossl_quic_wire_decode_frame_immediate_ack(PACKET *pkt);
+
+/*
+ * Decodes a QUIC DATAGRAM frame into the preallocated structure at f.
+ *
+ * f->data is set to point inside the packet buffer inside the PACKET, therefore
+ * it is safe to access for as long as the packet buffer exists. If the frame
+ * has no length field, it consumes the remainder of the packet.
+ */
+int ossl_quic_wire_decode_frame_datagram(PACKET *pkt,
+                                         OSSL_QUIC_FRAME_DATAGRAM *f);
+
 /*
  * Peeks at the ID of the next QUIC transport parameter TLV in the stream.
  * The ID is written to *id.
@@ -166,6 +166,9 @@ typedef struct quic_hdr_protector_st {
 #  define QUIC_HDR_PROT_CIPHER_AES_256    2
 #  define QUIC_HDR_PROT_CIPHER_CHACHA     3
 
+/* Maximum number of packets ossl_quic_hdr_protector_decrypt_batch() accepts. */
+#  define QUIC_HDR_PROT_MAX_BATCH         32
+
 /*
  * Initialises a header protector.
  *
@@ -214,6 +217,22 @@ void ossl_quic_hdr_protector_cleanup(QUIC_HDR_PROTECTOR *hpr);
 int ossl_quic_hdr_protector_decrypt(QUIC_HDR_PROTECTOR *hpr,
                                     QUIC_PKT_HDR_PTRS *ptrs);
 
+/*
+ * Removes header protection from num_ptrs packets protected with the same key,
+ * as though ossl_quic_hdr_protector_decrypt() were called for each of them.
+ * The header protection masks for all of the packets are generated together,
+ * which is substantially cheaper than generating them one at a time when
+ * many packets arrive at once. num_ptrs must not exceed
+ * QUIC_HDR_PROT_MAX_BATCH.
+ *
+ * If this function fails, no data is modified.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int ossl_quic_hdr_protector_decrypt_batch(QUIC_HDR_PROTECTOR *hpr,
+                                          QUIC_PKT_HDR_PTRS *ptrs,
+                                          size_t num_ptrs);
+
 /*
  * Applies header protection to a packet. The packet payload must already have
  * been encrypted (i.e., you must apply header protection after encrypting
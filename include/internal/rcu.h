@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_INTERNAL_RCU_H
+# define OSSL_INTERNAL_RCU_H
+# pragma once
+
+# include <openssl/crypto.h>
+
+/*
+ * Read-copy-update (RCU) locks
+ * ============================
+ *
+ * An RCU lock allows any number of readers to traverse a shared data
+ * structure without ever blocking or writing to a shared lock word, while
+ * writers publish new versions of the structure with ossl_rcu_assign_ptr()
+ * and reclaim the old ones once ossl_synchronize_rcu() has returned.
+ *
+ * Readers must only obtain pointers to shared data with ossl_rcu_deref()
+ * inside a read side critical section and must not keep them after calling
+ * ossl_rcu_read_unlock().  The token filled in by ossl_rcu_read_lock() has
+ * to be passed to the matching ossl_rcu_read_unlock().  Read side critical
+ * sections must be short and must never call ossl_synchronize_rcu().
+ *
+ * Writers serialise against each other with ossl_rcu_write_lock() and
+ * ossl_rcu_write_unlock().  Data unlinked inside a write side critical
+ * section may be freed once ossl_synchronize_rcu() has been called after
+ * ossl_rcu_write_unlock(); at that point no reader can still refer to it.
+ *
+ * On platforms without lock free atomics the implementation falls back to a
+ * read/write lock, which preserves the semantics described above.
+ */
+
+typedef struct rcu_lock_st CRYPTO_RCU_LOCK;
+typedef unsigned int CRYPTO_RCU_TOKEN;
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void);
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock);
+
+__owur int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN *token);
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, CRYPTO_RCU_TOKEN token);
+
+__owur int ossl_rcu_write_lock(CRYPTO_RCU_LOCK *lock);
+void ossl_rcu_write_unlock(CRYPTO_RCU_LOCK *lock);
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock);
+
+void *ossl_rcu_uptr_deref(void **p);
+void ossl_rcu_assign_uptr(void **p, void *v);
+
+# define ossl_rcu_deref(p) ossl_rcu_uptr_deref((void **)(p))
+# define ossl_rcu_assign_ptr(p, v) ossl_rcu_assign_uptr((void **)(p), (void *)(v))
+
+#endif
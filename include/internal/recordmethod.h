@@ -61,12 +61,20 @@ typedef struct ossl_record_layer_st OSSL_RECORD_LAYER;
  * Template for creating a record. A record consists of the |type| of data it
  * will contain (e.g. alert, handshake, application data, etc) along with a
  * buffer of payload data in |buf| of length |buflen|.
+ *
+ * Application data may instead be spread over several buffers. In that case
+ * |buf| is NULL and the |buflen| bytes are gathered from the |numiov| buffers
+ * in |iov|, starting |iovoff| bytes into the first of them. Otherwise |iov| is
+ * NULL.
  */
 struct ossl_record_template_st {
     unsigned char type;
     unsigned int version;
     const unsigned char *buf;
     size_t buflen;
+    const SSL_IOVEC *iov;
+    size_t numiov;
+    size_t iovoff;
 };
 
 typedef struct ossl_record_template_st OSSL_RECORD_TEMPLATE;
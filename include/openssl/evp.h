@@ -825,6 +825,12 @@ __owur int EVP_VerifyFinal_ex(EVP_MD_CTX *ctx, const unsigned char *sigbuf,
 __owur int EVP_DigestVerify(EVP_MD_CTX *ctx, const unsigned char *sigret,
                             size_t siglen, const unsigned char *tbs,
                             size_t tbslen);
+__owur int EVP_DigestVerifyBatch(EVP_MD_CTX *ctx,
+                                 const unsigned char *const *sigs,
+                                 const size_t *siglens,
+                                 const unsigned char *const *tbs,
+                                 const size_t *tbslens, size_t num,
+                                 int *results);
 
 __owur int EVP_DigestSignInit_ex(EVP_MD_CTX *ctx, EVP_PKEY_CTX **pctx,
                           const char *mdname, OSSL_LIB_CTX *libctx,
@@ -28,6 +28,11 @@ __owur const SSL_METHOD *OSSL_QUIC_client_method(void);
  * Method used for thread-assisted QUIC client operation.
  */
 __owur const SSL_METHOD *OSSL_QUIC_client_thread_method(void);
+/*
+ * Method used for QUIC server operation, through a listener created with
+ * SSL_new_listener().
+ */
+__owur const SSL_METHOD *OSSL_QUIC_server_method(void);
 
 #  ifdef __cplusplus
 }
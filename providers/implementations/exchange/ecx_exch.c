@@ -14,7 +14,11 @@
 #include <openssl/err.h>
 #include <openssl/proverr.h>
 #include "internal/cryptlib.h"
+#include "internal/thread_once.h"
 #include "crypto/ecx.h"
+#ifndef FIPS_MODULE
+# include "crypto/async.h"
+#endif
 #include "prov/implementations.h"
 #include "prov/providercommon.h"
 
@@ -108,6 +112,116 @@ static int ecx_set_peer(void *vecxctx, void *vkey)
     return 1;
 }
 
+#ifndef FIPS_MODULE
+/*
+ * X25519 derivations performed inside ASYNC jobs are queued per thread and
+ * computed together by ossl_x25519_multi(). A queued job pauses, waking its
+ * caller at once through the ASYNC_WAIT_CTX so that it is resumed like any
+ * other job; jobs which the caller starts in the meantime join the queue.
+ * The queue is computed once it is full, or as soon as any of the paused
+ * jobs is resumed. The queue itself lives on the stack of the job that
+ * opened it, which cannot return before the queue has been computed.
+ */
+# define X25519_QUEUE_MAX 8
+
+typedef struct x25519_queue_st X25519_QUEUE;
+
+typedef struct {
+    X25519_QUEUE *queue;
+    const uint8_t *priv;
+    const uint8_t *peer;
+    uint8_t *secret;
+    int result;
+    int done;
+} X25519_REQUEST;
+
+struct x25519_queue_st {
+    size_t num;
+    X25519_REQUEST *reqs[X25519_QUEUE_MAX];
+};
+
+static CRYPTO_ONCE x25519_queue_once = CRYPTO_ONCE_STATIC_INIT;
+static CRYPTO_THREAD_LOCAL x25519_queue_key;
+static int x25519_queue_key_inited = 0;
+
+DEFINE_RUN_ONCE_STATIC(x25519_queue_init)
+{
+    x25519_queue_key_inited = CRYPTO_THREAD_init_local(&x25519_queue_key,
+                                                       NULL);
+    return 1;
+}
+
+static void x25519_queue_flush(X25519_QUEUE *queue)
+{
+    uint8_t *out[X25519_QUEUE_MAX];
+    const uint8_t *priv[X25519_QUEUE_MAX], *peer[X25519_QUEUE_MAX];
+    int results[X25519_QUEUE_MAX];
+    size_t i;
+
+    if (CRYPTO_THREAD_get_local(&x25519_queue_key) == queue)
+        CRYPTO_THREAD_set_local(&x25519_queue_key, NULL);
+
+    for (i = 0; i < queue->num; i++) {
+        out[i] = queue->reqs[i]->secret;
+        priv[i] = queue->reqs[i]->priv;
+        peer[i] = queue->reqs[i]->peer;
+    }
+    ossl_x25519_multi(out, priv, peer, queue->num, results);
+    for (i = 0; i < queue->num; i++) {
+        queue->reqs[i]->result = results[i];
+        queue->reqs[i]->done = 1;
+    }
+}
+
+/*
+ * Returns -1 if the derivation cannot be queued, in which case it should
+ * be computed directly.
+ */
+static int x25519_derive_queued(PROV_ECX_CTX *ecxctx, unsigned char *secret,
+                                size_t *secretlen)
+{
+    X25519_QUEUE local, *queue;
+    X25519_REQUEST req;
+    size_t max = ossl_x25519_multi_lanes();
+
+    if (max > X25519_QUEUE_MAX)
+        max = X25519_QUEUE_MAX;
+    if (max < 2
+            || ASYNC_get_current_job() == NULL
+            || !RUN_ONCE(&x25519_queue_once, x25519_queue_init)
+            || !x25519_queue_key_inited)
+        return -1;
+
+    queue = CRYPTO_THREAD_get_local(&x25519_queue_key);
+    if (queue == NULL) {
+        queue = &local;
+        queue->num = 0;
+        if (!CRYPTO_THREAD_set_local(&x25519_queue_key, queue))
+            return -1;
+    }
+
+    req.queue = queue;
+    req.priv = ecxctx->key->privkey;
+    req.peer = ecxctx->peerkey->pubkey;
+    req.secret = secret;
+    req.result = 0;
+    req.done = 0;
+    queue->reqs[queue->num++] = &req;
+
+    if (queue->num < max)
+        ossl_async_pause_job_woken();
+    if (!req.done)
+        x25519_queue_flush(req.queue);
+
+    if (!req.result) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_DURING_DERIVATION);
+        return 0;
+    }
+    *secretlen = ecxctx->keylen;
+    return 1;
+}
+#endif
+
 static int ecx_derive(void *vecxctx, unsigned char *secret, size_t *secretlen,
                       size_t outlen)
 {
@@ -115,6 +229,19 @@ static int ecx_derive(void *vecxctx, unsigned char *secret, size_t *secretlen,
 
     if (!ossl_prov_is_running())
         return 0;
+#ifndef FIPS_MODULE
+    if (ecxctx->keylen == X25519_KEYLEN
+            && secret != NULL
+            && outlen >= ecxctx->keylen
+            && ecxctx->key != NULL
+            && ecxctx->key->privkey != NULL
+            && ecxctx->peerkey != NULL) {
+        int ret = x25519_derive_queued(ecxctx, secret, secretlen);
+
+        if (ret >= 0)
+            return ret;
+    }
+#endif
     return ossl_ecx_compute_key(ecxctx->peerkey, ecxctx->key, ecxctx->keylen,
                                 secret, secretlen, outlen);
 }
@@ -25,12 +25,16 @@
 #include "internal/nelem.h"
 #include "internal/sizes.h"
 #include "internal/cryptlib.h"
+#include "internal/thread_once.h"
 #include "internal/deterministic_nonce.h"
 #include "prov/providercommon.h"
 #include "prov/implementations.h"
 #include "prov/provider_ctx.h"
 #include "prov/securitycheck.h"
 #include "crypto/ec.h"
+#ifndef FIPS_MODULE
+# include "crypto/async.h"
+#endif
 #include "prov/der_ec.h"
 
 static OSSL_FUNC_signature_newctx_fn ecdsa_newctx;
@@ -168,6 +172,144 @@ static int ecdsa_verify_init(void *vctx, void *ec, const OSSL_PARAM params[])
     return ecdsa_signverify_init(vctx, ec, params, EVP_PKEY_OP_VERIFY);
 }
 
+#ifndef FIPS_MODULE
+/*
+ * ECDSA signatures created or verified inside ASYNC jobs are queued per
+ * thread and computed together by ossl_ecdsa_sign_multi() and
+ * ossl_ecdsa_verify_multi(). A queued job pauses, waking its caller at once
+ * through the ASYNC_WAIT_CTX so that it is resumed like any other job; jobs
+ * which the caller starts in the meantime join the queue. The queue is
+ * computed once it is full, or as soon as any of the paused jobs is
+ * resumed. The queue itself lives on the stack of the job that opened it,
+ * which cannot return before the queue has been computed.
+ */
+# define ECDSA_QUEUE_MAX 8
+
+typedef struct ecdsa_queue_st ECDSA_QUEUE;
+
+typedef struct {
+    ECDSA_QUEUE *queue;
+    EC_KEY *ec;
+    const unsigned char *tbs;
+    int tbslen;
+    unsigned char *sig;             /* set for signing */
+    unsigned int siglen;
+    const unsigned char *sigbuf;    /* for verification */
+    int result;
+    int done;
+} ECDSA_REQUEST;
+
+struct ecdsa_queue_st {
+    size_t num;
+    ECDSA_REQUEST *reqs[ECDSA_QUEUE_MAX];
+};
+
+static CRYPTO_ONCE ecdsa_queue_once = CRYPTO_ONCE_STATIC_INIT;
+static CRYPTO_THREAD_LOCAL ecdsa_queue_key;
+static int ecdsa_queue_key_inited = 0;
+
+DEFINE_RUN_ONCE_STATIC(ecdsa_queue_init)
+{
+    ecdsa_queue_key_inited = CRYPTO_THREAD_init_local(&ecdsa_queue_key, NULL);
+    return 1;
+}
+
+static void ecdsa_queue_flush(ECDSA_QUEUE *queue)
+{
+    ECDSA_REQUEST *reqs[ECDSA_QUEUE_MAX];
+    EC_KEY *ec[ECDSA_QUEUE_MAX];
+    const unsigned char *tbs[ECDSA_QUEUE_MAX], *sigbuf[ECDSA_QUEUE_MAX];
+    unsigned char *sig[ECDSA_QUEUE_MAX];
+    unsigned int siglen[ECDSA_QUEUE_MAX];
+    int tbslen[ECDSA_QUEUE_MAX], sigbuflen[ECDSA_QUEUE_MAX];
+    int results[ECDSA_QUEUE_MAX];
+    size_t i, n;
+    int signing;
+
+    if (CRYPTO_THREAD_get_local(&ecdsa_queue_key) == queue)
+        CRYPTO_THREAD_set_local(&ecdsa_queue_key, NULL);
+
+    for (signing = 0; signing <= 1; signing++) {
+        for (i = n = 0; i < queue->num; i++) {
+            if ((queue->reqs[i]->sig != NULL) != signing)
+                continue;
+            reqs[n] = queue->reqs[i];
+            ec[n] = reqs[n]->ec;
+            tbs[n] = reqs[n]->tbs;
+            tbslen[n] = reqs[n]->tbslen;
+            sig[n] = reqs[n]->sig;
+            sigbuf[n] = reqs[n]->sigbuf;
+            sigbuflen[n] = (int)reqs[n]->siglen;
+            n++;
+        }
+        if (n == 0)
+            continue;
+        if (signing)
+            ossl_ecdsa_sign_multi(tbs, tbslen, sig, siglen, ec, n, results);
+        else
+            ossl_ecdsa_verify_multi(tbs, tbslen, sigbuf, sigbuflen, ec, n,
+                                    results);
+        for (i = 0; i < n; i++) {
+            if (signing)
+                reqs[i]->siglen = siglen[i];
+            reqs[i]->result = results[i];
+            reqs[i]->done = 1;
+        }
+    }
+}
+
+/*
+ * Returns -2 if the operation cannot be queued, in which case it should be
+ * performed directly. Otherwise returns what ECDSA_sign_ex() or
+ * ECDSA_verify() would.
+ */
+static int ecdsa_queued(PROV_ECDSA_CTX *ctx, const unsigned char *tbs,
+                        size_t tbslen, unsigned char *sig,
+                        const unsigned char *sigbuf, size_t *siglen)
+{
+    ECDSA_QUEUE local, *queue;
+    ECDSA_REQUEST req;
+    size_t max = ossl_ecdsa_multi_lanes(ctx->ec);
+
+    if (max > ECDSA_QUEUE_MAX)
+        max = ECDSA_QUEUE_MAX;
+    if (max < 2
+            || tbslen > INT_MAX
+            || *siglen > INT_MAX
+            || ASYNC_get_current_job() == NULL
+            || !RUN_ONCE(&ecdsa_queue_once, ecdsa_queue_init)
+            || !ecdsa_queue_key_inited)
+        return -2;
+
+    queue = CRYPTO_THREAD_get_local(&ecdsa_queue_key);
+    if (queue == NULL) {
+        queue = &local;
+        queue->num = 0;
+        if (!CRYPTO_THREAD_set_local(&ecdsa_queue_key, queue))
+            return -2;
+    }
+
+    req.queue = queue;
+    req.ec = ctx->ec;
+    req.tbs = tbs;
+    req.tbslen = (int)tbslen;
+    req.sig = sig;
+    req.siglen = (unsigned int)*siglen;
+    req.sigbuf = sigbuf;
+    req.result = 0;
+    req.done = 0;
+    queue->reqs[queue->num++] = &req;
+
+    if (queue->num < max)
+        ossl_async_pause_job_woken();
+    if (!req.done)
+        ecdsa_queue_flush(req.queue);
+
+    *siglen = req.siglen;
+    return req.result;
+}
+#endif
+
 static int ecdsa_sign(void *vctx, unsigned char *sig, size_t *siglen,
                       size_t sigsize, const unsigned char *tbs, size_t tbslen)
 {
@@ -201,8 +343,18 @@ static int ecdsa_sign(void *vctx, unsigned char *sig, size_t *siglen,
                                             ctx->mdname,
                                             ctx->libctx, ctx->propq);
     } else {
-        ret = ECDSA_sign_ex(0, tbs, tbslen, sig, &sltmp, ctx->kinv, ctx->r,
-                            ctx->ec);
+        ret = -2;
+#ifndef FIPS_MODULE
+        if (ctx->kinv == NULL && ctx->r == NULL) {
+            size_t len = 0;
+
+            ret = ecdsa_queued(ctx, tbs, tbslen, sig, NULL, &len);
+            sltmp = (unsigned int)len;
+        }
+#endif
+        if (ret == -2)
+            ret = ECDSA_sign_ex(0, tbs, tbslen, sig, &sltmp, ctx->kinv,
+                                ctx->r, ctx->ec);
     }
     if (ret <= 0)
         return 0;
@@ -219,6 +371,14 @@ static int ecdsa_verify(void *vctx, const unsigned char *sig, size_t siglen,
     if (!ossl_prov_is_running() || (ctx->mdsize != 0 && tbslen != ctx->mdsize))
         return 0;
 
+#ifndef FIPS_MODULE
+    {
+        int ret = ecdsa_queued(ctx, tbs, tbslen, NULL, sig, &siglen);
+
+        if (ret != -2)
+            return ret;
+    }
+#endif
     return ECDSA_verify(0, tbs, tbslen, sig, siglen, ctx->ec);
 }
 
@@ -67,6 +67,7 @@ static OSSL_FUNC_signature_digest_sign_fn ed25519_digest_sign;
 static OSSL_FUNC_signature_digest_sign_fn ed448_digest_sign;
 static OSSL_FUNC_signature_digest_verify_fn ed25519_digest_verify;
 static OSSL_FUNC_signature_digest_verify_fn ed448_digest_verify;
+static OSSL_FUNC_signature_digest_verify_batch_fn ed25519_digest_verify_batch;
 static OSSL_FUNC_signature_freectx_fn eddsa_freectx;
 static OSSL_FUNC_signature_dupctx_fn eddsa_dupctx;
 static OSSL_FUNC_signature_get_ctx_params_fn eddsa_get_ctx_params;
@@ -412,6 +413,57 @@ int ed25519_digest_verify(void *vpeddsactx, const unsigned char *sig,
                                peddsactx->libctx, edkey->propq);
 }
 
+static int ed25519_digest_verify_batch(void *vpeddsactx,
+                                       const unsigned char *const *sigs,
+                                       const size_t *siglens,
+                                       const unsigned char *const *tbs,
+                                       const size_t *tbslens, size_t num,
+                                       int *results)
+{
+    PROV_EDDSA_CTX *peddsactx = (PROV_EDDSA_CTX *)vpeddsactx;
+    const ECX_KEY *edkey = peddsactx->key;
+    const unsigned char **pubkeys;
+    size_t i;
+    int ok, ret = 1;
+
+    if (!ossl_prov_is_running())
+        return 0;
+    if (num == 0)
+        return 1;
+
+    /* Pre-hashed input is verified one signature at a time */
+    if (peddsactx->prehash_flag) {
+        for (i = 0; i < num; i++) {
+            ok = ed25519_digest_verify(vpeddsactx, sigs[i], siglens[i],
+                                       tbs[i], tbslens[i]) == 1;
+            if (results != NULL)
+                results[i] = ok;
+            if (!ok) {
+                ret = 0;
+                if (results == NULL)
+                    break;
+            }
+        }
+        return ret;
+    }
+
+    pubkeys = OPENSSL_malloc(num * sizeof(*pubkeys));
+    if (pubkeys == NULL)
+        return 0;
+    for (i = 0; i < num; i++)
+        pubkeys[i] = edkey->pubkey;
+
+    ret = ossl_ed25519_verify_batch(tbs, tbslens, sigs, siglens, pubkeys, num,
+                                    results, peddsactx->dom2_flag,
+                                    peddsactx->prehash_flag,
+                                    peddsactx->context_string_flag,
+                                    peddsactx->context_string,
+                                    peddsactx->context_string_len,
+                                    peddsactx->libctx, edkey->propq);
+    OPENSSL_free(pubkeys);
+    return ret;
+}
+
 int ed448_digest_verify(void *vpeddsactx, const unsigned char *sig,
                         size_t siglen, const unsigned char *tbs,
                         size_t tbslen)
@@ -599,6 +651,8 @@ const OSSL_DISPATCH ossl_ed25519_signature_functions[] = {
       (void (*)(void))eddsa_digest_signverify_init },
     { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY,
       (void (*)(void))ed25519_digest_verify },
+    { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_BATCH,
+      (void (*)(void))ed25519_digest_verify_batch },
     { OSSL_FUNC_SIGNATURE_FREECTX, (void (*)(void))eddsa_freectx },
     { OSSL_FUNC_SIGNATURE_DUPCTX, (void (*)(void))eddsa_dupctx },
     { OSSL_FUNC_SIGNATURE_GET_CTX_PARAMS, (void (*)(void))eddsa_get_ctx_params },
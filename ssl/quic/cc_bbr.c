@@ -0,0 +1,729 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "internal/nelem.h"
+#include "internal/quic_cc.h"
+#include "internal/quic_types.h"
+#include "internal/safe_math.h"
+
+OSSL_SAFE_MATH_UNSIGNED(u64, uint64_t)
+
+/*
+ * BBR congestion controller, modelled on BBRv2.
+ *
+ * Rather than treating loss as the signal of congestion, BBR builds a model of
+ * the path from the bottleneck bandwidth (the maximum delivery rate seen over
+ * the last few round trips) and the minimum RTT. It paces packets at about
+ * the bottleneck bandwidth, which fills the pipe without building a standing
+ * queue at the bottleneck, and bounds the data in flight to twice the
+ * bandwidth-delay product (BDP) so that delayed and aggregated ACKs do not
+ * stall it. As in BBRv2, loss also bounds the amount of data in flight if it
+ * exceeds a small rate.
+ *
+ * The controller goes through the following states, each of which applies a
+ * gain to the pacing rate:
+ *
+ *   - Startup: the pacing rate is twice the bandwidth estimate, and the window
+ *     grows as in slow start, until the bandwidth estimate stops growing or
+ *     there is too much loss.
+ *
+ *   - Drain: the pacing rate is half the bandwidth estimate until the queue
+ *     built up during Startup has drained.
+ *
+ *   - ProbeBW: the pacing rate cycles through gains of 5/4, 3/4 and then 1 for
+ *     six round trips, to probe for more bandwidth and then drain the queue
+ *     that the probing built up.
+ *
+ *   - ProbeRTT: if the minimum RTT has not been seen for 10 seconds, the
+ *     window drops to half the BDP for 200 ms to drain the queue and measure
+ *     the RTT again.
+ *
+ * Delivery rate samples are taken over each round trip, as the ACKM does not
+ * give us per-packet delivery state: a round ends when a packet sent after its
+ * start is acknowledged, and its sample is the number of bytes acknowledged
+ * during the round divided by its length.
+ */
+typedef struct ossl_cc_bbr_st {
+    /* Dependencies. */
+    OSSL_TIME   (*now_cb)(void *arg);
+    void        *now_cb_arg;
+
+    /* 'Constants' (which we allow to be configurable). */
+    uint64_t    k_init_wnd, k_min_wnd;
+
+    /* State. */
+    size_t      max_dgram_size;
+    uint64_t    bytes_in_flight, cong_wnd;
+    uint32_t    state;
+
+    /* Round trip counting. */
+    uint64_t    delivered;              /* total bytes acknowledged */
+    uint64_t    round_count;
+    OSSL_TIME   round_start_time;
+    uint64_t    round_start_delivered;
+    uint64_t    round_lost;             /* bytes lost during this round */
+    int         round_cong_limited;     /* 1 if we filled the pipe */
+    int         round_loss_handled;     /* 1 if we reacted to loss */
+
+    /* Path model. */
+    uint64_t    bw_samples[8];          /* maximum per round, in bytes/s */
+    uint64_t    max_bw;
+    OSSL_TIME   min_rtt, min_rtt_stamp;
+    uint64_t    inflight_hi;            /* upper bound from loss */
+
+    /* Startup. */
+    uint64_t    full_bw;
+    uint32_t    full_bw_count;
+    int         filled_pipe;
+
+    /* ProbeBW. */
+    size_t      cycle_idx;
+    OSSL_TIME   cycle_stamp;
+
+    /* ProbeRTT. */
+    OSSL_TIME   probe_rtt_done_stamp;   /* zero until the queue has drained */
+    uint64_t    probe_rtt_round;
+
+    /* Unflushed state during multiple on-loss calls. */
+    int         processing_loss; /* 1 if not flushed */
+
+    /* Diagnostic output locations. */
+    size_t      *p_diag_max_dgram_payload_len;
+    uint64_t    *p_diag_cur_cwnd_size;
+    uint64_t    *p_diag_min_cwnd_size;
+    uint64_t    *p_diag_cur_bytes_in_flight;
+    uint32_t    *p_diag_cur_state;
+} OSSL_CC_BBR;
+
+#define MIN_MAX_INIT_WND_SIZE    14720  /* RFC 9002 s. 7.2 */
+
+/* States, also used as their diagnostic values. */
+#define BBR_STATE_STARTUP       'S'
+#define BBR_STATE_DRAIN         'D'
+#define BBR_STATE_PROBE_BW      'B'
+#define BBR_STATE_PROBE_RTT     'T'
+
+/* Gains are expressed in quarters. */
+#define BBR_GAIN_DEN            4
+#define BBR_STARTUP_GAIN        8
+#define BBR_DRAIN_GAIN          2
+#define BBR_CWND_GAIN           8
+#define BBR_PROBE_RTT_DURATION  (ossl_ms2time(200))
+#define BBR_MIN_RTT_EXPIRY      (ossl_seconds2time(10))
+
+/* Startup ends after three rounds without 25% growth in the bandwidth. */
+#define BBR_FULL_BW_COUNT       3
+
+/* Loss above 2% in a round bounds the data in flight (BBRv2). */
+#define BBR_LOSS_THRESH_DEN     50
+#define BBR_BETA_NUM            7
+#define BBR_BETA_DEN            10
+
+static const uint32_t bbr_cycle_gains[] = { 5, 3, 4, 4, 4, 4, 4, 4 };
+
+static void bbr_set_max_dgram_size(OSSL_CC_BBR *bbr,
+                                   size_t max_dgram_size);
+static void bbr_update_diag(OSSL_CC_BBR *bbr);
+
+static void bbr_reset(OSSL_CC_DATA *cc);
+
+static OSSL_CC_DATA *bbr_new(OSSL_TIME (*now_cb)(void *arg),
+                             void *now_cb_arg)
+{
+    OSSL_CC_BBR *bbr;
+
+    if ((bbr = OPENSSL_zalloc(sizeof(*bbr))) == NULL)
+        return NULL;
+
+    bbr->now_cb         = now_cb;
+    bbr->now_cb_arg     = now_cb_arg;
+
+    bbr_set_max_dgram_size(bbr, QUIC_MIN_INITIAL_DGRAM_LEN);
+    bbr_reset((OSSL_CC_DATA *)bbr);
+
+    return (OSSL_CC_DATA *)bbr;
+}
+
+static void bbr_free(OSSL_CC_DATA *cc)
+{
+    OPENSSL_free(cc);
+}
+
+static void bbr_set_max_dgram_size(OSSL_CC_BBR *bbr,
+                                   size_t max_dgram_size)
+{
+    size_t max_init_wnd;
+    int is_reduced = (max_dgram_size < bbr->max_dgram_size);
+
+    bbr->max_dgram_size = max_dgram_size;
+
+    max_init_wnd = 2 * max_dgram_size;
+    if (max_init_wnd < MIN_MAX_INIT_WND_SIZE)
+        max_init_wnd = MIN_MAX_INIT_WND_SIZE;
+
+    bbr->k_init_wnd = 10 * max_dgram_size;
+    if (bbr->k_init_wnd > max_init_wnd)
+        bbr->k_init_wnd = max_init_wnd;
+
+    bbr->k_min_wnd = 4 * max_dgram_size;
+
+    if (is_reduced)
+        bbr->cong_wnd = bbr->k_init_wnd;
+
+    bbr_update_diag(bbr);
+}
+
+static void bbr_reset(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+    size_t i;
+
+    bbr->cong_wnd               = bbr->k_init_wnd;
+    bbr->bytes_in_flight        = 0;
+    bbr->state                  = BBR_STATE_STARTUP;
+
+    bbr->delivered              = 0;
+    bbr->round_count            = 0;
+    bbr->round_start_time       = ossl_time_zero();
+    bbr->round_start_delivered  = 0;
+    bbr->round_lost             = 0;
+    bbr->round_cong_limited     = 0;
+    bbr->round_loss_handled     = 0;
+
+    for (i = 0; i < OSSL_NELEM(bbr->bw_samples); i++)
+        bbr->bw_samples[i] = 0;
+
+    bbr->max_bw                 = 0;
+    bbr->min_rtt                = ossl_time_infinite();
+    bbr->min_rtt_stamp          = ossl_time_zero();
+    bbr->inflight_hi            = UINT64_MAX;
+
+    bbr->full_bw                = 0;
+    bbr->full_bw_count          = 0;
+    bbr->filled_pipe            = 0;
+
+    bbr->cycle_idx              = 0;
+    bbr->cycle_stamp            = ossl_time_zero();
+
+    bbr->probe_rtt_done_stamp   = ossl_time_zero();
+    bbr->probe_rtt_round        = 0;
+
+    bbr->processing_loss        = 0;
+}
+
+static int bbr_set_input_params(OSSL_CC_DATA *cc, const OSSL_PARAM *params)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+    const OSSL_PARAM *p;
+    size_t value;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_size_t(p, &value))
+            return 0;
+        if (value < QUIC_MIN_INITIAL_DGRAM_LEN)
+            return 0;
+
+        bbr_set_max_dgram_size(bbr, value);
+    }
+
+    return 1;
+}
+
+static int bbr_bind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+    size_t *new_p_max_dgram_payload_len;
+    uint64_t *new_p_cur_cwnd_size;
+    uint64_t *new_p_min_cwnd_size;
+    uint64_t *new_p_cur_bytes_in_flight;
+    uint32_t *new_p_cur_state;
+
+    if (!ossl_cc_bind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                           sizeof(size_t),
+                           (void **)&new_p_max_dgram_payload_len)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
+                              sizeof(uint64_t), (void **)&new_p_cur_cwnd_size)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
+                              sizeof(uint64_t), (void **)&new_p_min_cwnd_size)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
+                              sizeof(uint64_t),
+                              (void **)&new_p_cur_bytes_in_flight)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_STATE,
+                              sizeof(uint32_t), (void **)&new_p_cur_state))
+        return 0;
+
+    if (new_p_max_dgram_payload_len != NULL)
+        bbr->p_diag_max_dgram_payload_len = new_p_max_dgram_payload_len;
+
+    if (new_p_cur_cwnd_size != NULL)
+        bbr->p_diag_cur_cwnd_size = new_p_cur_cwnd_size;
+
+    if (new_p_min_cwnd_size != NULL)
+        bbr->p_diag_min_cwnd_size = new_p_min_cwnd_size;
+
+    if (new_p_cur_bytes_in_flight != NULL)
+        bbr->p_diag_cur_bytes_in_flight = new_p_cur_bytes_in_flight;
+
+    if (new_p_cur_state != NULL)
+        bbr->p_diag_cur_state = new_p_cur_state;
+
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static int bbr_unbind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                        (void **)&bbr->p_diag_max_dgram_payload_len);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
+                        (void **)&bbr->p_diag_cur_cwnd_size);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
+                        (void **)&bbr->p_diag_min_cwnd_size);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
+                        (void **)&bbr->p_diag_cur_bytes_in_flight);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_STATE,
+                        (void **)&bbr->p_diag_cur_state);
+    return 1;
+}
+
+static void bbr_update_diag(OSSL_CC_BBR *bbr)
+{
+    if (bbr->p_diag_max_dgram_payload_len != NULL)
+        *bbr->p_diag_max_dgram_payload_len = bbr->max_dgram_size;
+
+    if (bbr->p_diag_cur_cwnd_size != NULL)
+        *bbr->p_diag_cur_cwnd_size = bbr->cong_wnd;
+
+    if (bbr->p_diag_min_cwnd_size != NULL)
+        *bbr->p_diag_min_cwnd_size = bbr->k_min_wnd;
+
+    if (bbr->p_diag_cur_bytes_in_flight != NULL)
+        *bbr->p_diag_cur_bytes_in_flight = bbr->bytes_in_flight;
+
+    if (bbr->p_diag_cur_state != NULL)
+        *bbr->p_diag_cur_state = bbr->state;
+}
+
+/* Returns the estimated BDP, or 0 if we do not have a path model yet. */
+static uint64_t bbr_bdp(OSSL_CC_BBR *bbr)
+{
+    uint64_t bdp;
+    int err = 0;
+
+    if (bbr->max_bw == 0 || ossl_time_is_infinite(bbr->min_rtt))
+        return 0;
+
+    bdp = safe_muldiv_u64(bbr->max_bw, ossl_time2ticks(bbr->min_rtt),
+                          OSSL_TIME_SECOND, &err);
+    return err ? UINT64_MAX : bdp;
+}
+
+static uint64_t bbr_probe_rtt_cwnd(OSSL_CC_BBR *bbr)
+{
+    uint64_t cwnd = bbr_bdp(bbr) / 2;
+
+    return cwnd > bbr->k_min_wnd ? cwnd : bbr->k_min_wnd;
+}
+
+/*
+ * Returns 1 if sending |num_bytes| more would fill the pipe. Since we pace at
+ * about the bottleneck bandwidth, the window is usually not full, so the pipe
+ * is full once there is a BDP in flight.
+ */
+static int bbr_is_pipe_full(OSSL_CC_BBR *bbr, uint64_t num_bytes)
+{
+    uint64_t limit = bbr_bdp(bbr);
+
+    if (limit == 0 || limit > bbr->cong_wnd)
+        limit = bbr->cong_wnd;
+
+    return bbr->bytes_in_flight + num_bytes >= limit;
+}
+
+/* Returns the gain applied to the pacing rate. */
+static uint32_t bbr_gain(OSSL_CC_BBR *bbr)
+{
+    switch (bbr->state) {
+    case BBR_STATE_STARTUP:
+        return BBR_STARTUP_GAIN;
+    case BBR_STATE_DRAIN:
+        return BBR_DRAIN_GAIN;
+    case BBR_STATE_PROBE_BW:
+        return bbr_cycle_gains[bbr->cycle_idx];
+    default:
+        return BBR_GAIN_DEN;
+    }
+}
+
+/* Returns the congestion window we are aiming for. */
+static uint64_t bbr_target_cwnd(OSSL_CC_BBR *bbr)
+{
+    uint64_t target, bdp = bbr_bdp(bbr);
+    int err = 0;
+
+    if (bbr->state == BBR_STATE_PROBE_RTT)
+        return bbr_probe_rtt_cwnd(bbr);
+
+    if (bdp == 0)
+        return bbr->k_init_wnd;
+
+    target = safe_muldiv_u64(bdp, BBR_CWND_GAIN, BBR_GAIN_DEN, &err);
+    if (err)
+        target = UINT64_MAX;
+
+    if (target > bbr->inflight_hi)
+        target = bbr->inflight_hi;
+    if (target < bbr->k_min_wnd)
+        target = bbr->k_min_wnd;
+
+    return target;
+}
+
+static void bbr_enter_probe_bw(OSSL_CC_BBR *bbr, OSSL_TIME now)
+{
+    bbr->state          = BBR_STATE_PROBE_BW;
+    /* Start probing up after a phase at the BDP. */
+    bbr->cycle_idx      = OSSL_NELEM(bbr_cycle_gains) - 1;
+    bbr->cycle_stamp    = now;
+}
+
+static void bbr_update_bw(OSSL_CC_BBR *bbr, OSSL_TIME now)
+{
+    OSSL_TIME elapsed = ossl_time_subtract(now, bbr->round_start_time);
+    uint64_t sample, *slot;
+    size_t i;
+    int err = 0;
+
+    if (ossl_time_is_zero(elapsed))
+        return;
+
+    sample = safe_muldiv_u64(bbr->delivered - bbr->round_start_delivered,
+                             OSSL_TIME_SECOND, ossl_time2ticks(elapsed),
+                             &err);
+    if (err)
+        return;
+
+    /*
+     * If we did not fill the window this round, the sample only tells us
+     * about the rate at which the application gave us data, so only use it if
+     * it raises the estimate.
+     */
+    slot = &bbr->bw_samples[bbr->round_count % OSSL_NELEM(bbr->bw_samples)];
+    if (bbr->round_cong_limited || sample > bbr->max_bw)
+        *slot = sample;
+    else
+        *slot = bbr->max_bw;
+
+    bbr->max_bw = 0;
+    for (i = 0; i < OSSL_NELEM(bbr->bw_samples); i++)
+        if (bbr->bw_samples[i] > bbr->max_bw)
+            bbr->max_bw = bbr->bw_samples[i];
+}
+
+static void bbr_check_full_pipe(OSSL_CC_BBR *bbr)
+{
+    if (bbr->filled_pipe || !bbr->round_cong_limited)
+        return;
+
+    /* Has the bandwidth grown by at least 25% in the last round? */
+    if (bbr->max_bw >= bbr->full_bw + bbr->full_bw / 4) {
+        bbr->full_bw        = bbr->max_bw;
+        bbr->full_bw_count  = 0;
+        return;
+    }
+
+    if (++bbr->full_bw_count >= BBR_FULL_BW_COUNT)
+        bbr->filled_pipe = 1;
+}
+
+/* Called when a round trip ends. */
+static void bbr_on_round_end(OSSL_CC_BBR *bbr, OSSL_TIME now)
+{
+    int err = 0;
+
+    bbr_update_bw(bbr, now);
+    bbr_check_full_pipe(bbr);
+
+    /* Probe for more room in flight after a round without excessive loss. */
+    if (!bbr->round_loss_handled && bbr->inflight_hi != UINT64_MAX
+        && bbr->state == BBR_STATE_PROBE_BW && bbr->round_cong_limited) {
+        bbr->inflight_hi = safe_add_u64(bbr->inflight_hi,
+                                        bbr->inflight_hi / 8, &err);
+        if (err)
+            bbr->inflight_hi = UINT64_MAX;
+    }
+
+    ++bbr->round_count;
+    bbr->round_start_time       = now;
+    bbr->round_start_delivered  = bbr->delivered;
+    bbr->round_lost             = 0;
+    bbr->round_cong_limited     = bbr_is_pipe_full(bbr, 0);
+    bbr->round_loss_handled     = 0;
+}
+
+static void bbr_update_state(OSSL_CC_BBR *bbr, OSSL_TIME now)
+{
+    OSSL_TIME phase_len;
+
+    switch (bbr->state) {
+    case BBR_STATE_STARTUP:
+        if (bbr->filled_pipe)
+            bbr->state = BBR_STATE_DRAIN;
+        break;
+
+    case BBR_STATE_PROBE_BW:
+        /* Each phase lasts one minimum RTT. */
+        phase_len = bbr->min_rtt;
+        if (ossl_time_compare(ossl_time_subtract(now, bbr->cycle_stamp),
+                              phase_len) > 0) {
+            bbr->cycle_idx = (bbr->cycle_idx + 1) % OSSL_NELEM(bbr_cycle_gains);
+            bbr->cycle_stamp = now;
+        }
+        break;
+
+    case BBR_STATE_PROBE_RTT:
+        if (ossl_time_is_zero(bbr->probe_rtt_done_stamp)) {
+            if (bbr->bytes_in_flight <= bbr_probe_rtt_cwnd(bbr)) {
+                bbr->probe_rtt_done_stamp
+                    = ossl_time_add(now, BBR_PROBE_RTT_DURATION);
+                bbr->probe_rtt_round = bbr->round_count + 1;
+            }
+        } else if (ossl_time_compare(now, bbr->probe_rtt_done_stamp) >= 0
+                   && bbr->round_count >= bbr->probe_rtt_round) {
+            bbr->min_rtt_stamp = now;
+            if (bbr->filled_pipe)
+                bbr_enter_probe_bw(bbr, now);
+            else
+                bbr->state = BBR_STATE_STARTUP;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    /* Drain ends once the queue built up in Startup is gone. */
+    if (bbr->state == BBR_STATE_DRAIN && bbr->bytes_in_flight <= bbr_bdp(bbr))
+        bbr_enter_probe_bw(bbr, now);
+}
+
+static void bbr_update_min_rtt(OSSL_CC_BBR *bbr, OSSL_TIME now,
+                               OSSL_TIME tx_time)
+{
+    OSSL_TIME rtt = ossl_time_subtract(now, tx_time);
+    int expired = !ossl_time_is_infinite(bbr->min_rtt)
+        && ossl_time_compare(now, ossl_time_add(bbr->min_rtt_stamp,
+                                                BBR_MIN_RTT_EXPIRY)) > 0;
+
+    if (ossl_time_compare(rtt, bbr->min_rtt) <= 0 || expired) {
+        bbr->min_rtt        = rtt;
+        bbr->min_rtt_stamp  = now;
+    }
+
+    if (expired && bbr->state != BBR_STATE_PROBE_RTT) {
+        bbr->state                  = BBR_STATE_PROBE_RTT;
+        bbr->probe_rtt_done_stamp   = ossl_time_zero();
+    }
+}
+
+/*
+ * Bounds the data in flight if more than 2% of the data sent in this round
+ * has been lost, at most once per round.
+ */
+static void bbr_check_loss(OSSL_CC_BBR *bbr, int force)
+{
+    uint64_t round_delivered = bbr->delivered - bbr->round_start_delivered;
+    uint64_t bdp = bbr_bdp(bbr);
+    int err = 0;
+
+    if (bbr->round_loss_handled
+        || (!force && bbr->round_lost * BBR_LOSS_THRESH_DEN
+                      <= bbr->round_lost + round_delivered))
+        return;
+
+    /*
+     * We do not go below the BDP, as the path model tells us that we can keep
+     * that much in flight.
+     */
+    bbr->round_loss_handled = 1;
+    bbr->inflight_hi = safe_muldiv_u64(bbr->cong_wnd, BBR_BETA_NUM,
+                                       BBR_BETA_DEN, &err);
+    if (bbr->inflight_hi < bdp)
+        bbr->inflight_hi = bdp;
+    if (bbr->inflight_hi < bbr->k_min_wnd)
+        bbr->inflight_hi = bbr->k_min_wnd;
+
+    /* Loss also tells us that Startup has filled the pipe. */
+    bbr->filled_pipe = 1;
+
+    if (bbr->cong_wnd > bbr->inflight_hi)
+        bbr->cong_wnd = bbr->inflight_hi;
+}
+
+static uint64_t bbr_get_tx_allowance(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    if (bbr->bytes_in_flight >= bbr->cong_wnd)
+        return 0;
+
+    return bbr->cong_wnd - bbr->bytes_in_flight;
+}
+
+static OSSL_TIME bbr_get_wakeup_deadline(OSSL_CC_DATA *cc)
+{
+    if (bbr_get_tx_allowance(cc) > 0) {
+        /* We have TX allowance now so wakeup immediately */
+        return ossl_time_zero();
+    } else {
+        /* The state only changes in response to acknowledgements. */
+        return ossl_time_infinite();
+    }
+}
+
+static int bbr_on_data_sent(OSSL_CC_DATA *cc, uint64_t num_bytes)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    bbr->bytes_in_flight += num_bytes;
+    if (bbr_is_pipe_full(bbr, bbr->max_dgram_size))
+        bbr->round_cong_limited = 1;
+
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static int bbr_on_data_acked(OSSL_CC_DATA *cc,
+                             const OSSL_CC_ACK_INFO *info)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+    OSSL_TIME now = bbr->now_cb(bbr->now_cb_arg);
+    uint64_t target;
+
+    bbr->bytes_in_flight -= info->tx_size;
+    bbr->delivered += info->tx_size;
+
+    if (ossl_time_is_zero(bbr->round_start_time)) {
+        bbr->round_start_time = now;
+    } else if (ossl_time_compare(info->tx_time, bbr->round_start_time) >= 0) {
+        /* A packet sent after the start of this round ends it. */
+        bbr_on_round_end(bbr, now);
+    }
+
+    bbr_update_min_rtt(bbr, now, info->tx_time);
+    bbr_update_state(bbr, now);
+
+    /*
+     * Grow the window by the amount acknowledged, as in slow start, until it
+     * reaches the target. Until the pipe is full there is no target, but as
+     * in slow start we only grow the window if we are using it.
+     */
+    target = bbr_target_cwnd(bbr);
+    if (!bbr->filled_pipe && bbr->inflight_hi == UINT64_MAX) {
+        if (bbr->round_cong_limited)
+            bbr->cong_wnd += info->tx_size;
+    }
+    else if (bbr->cong_wnd < target)
+        bbr->cong_wnd = bbr->cong_wnd + info->tx_size < target
+            ? bbr->cong_wnd + info->tx_size : target;
+    else
+        bbr->cong_wnd = target;
+
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static int bbr_on_data_lost(OSSL_CC_DATA *cc,
+                            const OSSL_CC_LOSS_INFO *info)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    if (info->tx_size > bbr->bytes_in_flight)
+        return 0;
+
+    bbr->bytes_in_flight -= info->tx_size;
+    bbr->round_lost += info->tx_size;
+    bbr->processing_loss = 1;
+
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static int bbr_on_data_lost_finished(OSSL_CC_DATA *cc, uint32_t flags)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    if (!bbr->processing_loss)
+        return 1;
+
+    bbr_check_loss(bbr, 0);
+
+    if ((flags & OSSL_CC_LOST_FLAG_PERSISTENT_CONGESTION) != 0)
+        bbr->cong_wnd = bbr->k_min_wnd;
+
+    bbr->processing_loss = 0;
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static int bbr_on_data_invalidated(OSSL_CC_DATA *cc,
+                                   uint64_t num_bytes)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    bbr->bytes_in_flight -= num_bytes;
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static int bbr_on_ecn(OSSL_CC_DATA *cc,
+                      const OSSL_CC_ECN_INFO *info)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+
+    /* Treat ECN-CE like excessive loss. */
+    bbr_check_loss(bbr, 1);
+    bbr_update_diag(bbr);
+    return 1;
+}
+
+static uint64_t bbr_get_pacing_rate(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_BBR *bbr = (OSSL_CC_BBR *)cc;
+    uint64_t rate;
+    int err = 0;
+
+    /* Do not pace until we have a bandwidth estimate. */
+    if (bbr->max_bw == 0)
+        return 0;
+
+    rate = safe_muldiv_u64(bbr->max_bw, bbr_gain(bbr), BBR_GAIN_DEN, &err);
+    return err ? UINT64_MAX : rate;
+}
+
+const OSSL_CC_METHOD ossl_cc_bbr_method = {
+    bbr_new,
+    bbr_free,
+    bbr_reset,
+    bbr_set_input_params,
+    bbr_bind_diagnostic,
+    bbr_unbind_diagnostic,
+    bbr_get_tx_allowance,
+    bbr_get_wakeup_deadline,
+    bbr_on_data_sent,
+    bbr_on_data_acked,
+    bbr_on_data_lost,
+    bbr_on_data_lost_finished,
+    bbr_on_data_invalidated,
+    bbr_on_ecn,
+    bbr_get_pacing_rate,
+};
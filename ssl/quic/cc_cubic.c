@@ -0,0 +1,594 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "internal/quic_cc.h"
+#include "internal/quic_types.h"
+#include "internal/safe_math.h"
+
+OSSL_SAFE_MATH_UNSIGNED(u64, uint64_t)
+
+/*
+ * CUBIC congestion controller as described in RFC 9438.
+ *
+ * Slow start, recovery periods and the handling of persistent congestion are
+ * the same as for NewReno. In congestion avoidance the congestion window
+ * follows the cubic function
+ *
+ *   W_cubic(t) = C * (t - K)^3 + W_max
+ *
+ * of the time t since the start of the current congestion avoidance epoch,
+ * where W_max is the congestion window before the last reduction and K is the
+ * time it takes to grow back to it. This makes the growth of the window
+ * independent of the RTT, so that it recovers from a loss much faster than
+ * NewReno on paths with a large bandwidth-delay product.
+ *
+ * All arithmetic is done in integers, with windows in bytes and times in
+ * milliseconds.
+ */
+typedef struct ossl_cc_cubic_st {
+    /* Dependencies. */
+    OSSL_TIME   (*now_cb)(void *arg);
+    void        *now_cb_arg;
+
+    /* 'Constants' (which we allow to be configurable). */
+    uint64_t    k_init_wnd, k_min_wnd;
+
+    /* State. */
+    size_t      max_dgram_size;
+    uint64_t    bytes_in_flight, cong_wnd, slow_start_thresh;
+    OSSL_TIME   cong_recovery_start_time;
+
+    /* CUBIC state. */
+    uint64_t    w_max;          /* window before the last reduction */
+    uint64_t    w_est;          /* window NewReno would have (RFC 9438 4.3) */
+    uint64_t    est_bytes_acked;
+    uint64_t    cwnd_inc_acc;   /* unapplied window growth, times cong_wnd */
+    uint64_t    k_ms;           /* K in milliseconds */
+    OSSL_TIME   epoch_start;    /* zero if no epoch has started */
+    OSSL_TIME   srtt;           /* smoothed RTT of the ACKs we have seen */
+
+    /* Unflushed state during multiple on-loss calls. */
+    int         processing_loss; /* 1 if not flushed */
+    OSSL_TIME   tx_time_of_last_loss;
+
+    /* Diagnostic state. */
+    int         in_congestion_recovery;
+
+    /* Diagnostic output locations. */
+    size_t      *p_diag_max_dgram_payload_len;
+    uint64_t    *p_diag_cur_cwnd_size;
+    uint64_t    *p_diag_min_cwnd_size;
+    uint64_t    *p_diag_cur_bytes_in_flight;
+    uint32_t    *p_diag_cur_state;
+} OSSL_CC_CUBIC;
+
+#define MIN_MAX_INIT_WND_SIZE    14720  /* RFC 9002 s. 7.2 */
+
+/* beta_cubic = 0.7 (RFC 9438 s. 4.6) */
+#define CUBIC_BETA_NUM          7
+#define CUBIC_BETA_DEN          10
+
+/*
+ * C = 0.4 segments/s^3 (RFC 9438 s. 5). With t in milliseconds, this makes
+ * C * t^3 in bytes equal to t^3 * max_dgram_size / CUBIC_C_INV.
+ */
+#define CUBIC_C_INV             2500000000ULL
+
+/* alpha_cubic = 3 * (1 - beta_cubic) / (1 + beta_cubic) = 9/17 */
+#define CUBIC_ALPHA_NUM         9
+#define CUBIC_ALPHA_DEN         17
+
+/* Cap on |t - K| so that its cube fits in 64 bits (about 35 minutes). */
+#define CUBIC_MAX_T_MS          ((uint64_t)1 << 21)
+
+static void cubic_set_max_dgram_size(OSSL_CC_CUBIC *cu,
+                                     size_t max_dgram_size);
+static void cubic_update_diag(OSSL_CC_CUBIC *cu);
+
+static void cubic_reset(OSSL_CC_DATA *cc);
+
+static OSSL_CC_DATA *cubic_new(OSSL_TIME (*now_cb)(void *arg),
+                               void *now_cb_arg)
+{
+    OSSL_CC_CUBIC *cu;
+
+    if ((cu = OPENSSL_zalloc(sizeof(*cu))) == NULL)
+        return NULL;
+
+    cu->now_cb          = now_cb;
+    cu->now_cb_arg      = now_cb_arg;
+
+    cubic_set_max_dgram_size(cu, QUIC_MIN_INITIAL_DGRAM_LEN);
+    cubic_reset((OSSL_CC_DATA *)cu);
+
+    return (OSSL_CC_DATA *)cu;
+}
+
+static void cubic_free(OSSL_CC_DATA *cc)
+{
+    OPENSSL_free(cc);
+}
+
+static void cubic_set_max_dgram_size(OSSL_CC_CUBIC *cu,
+                                     size_t max_dgram_size)
+{
+    size_t max_init_wnd;
+    int is_reduced = (max_dgram_size < cu->max_dgram_size);
+
+    cu->max_dgram_size = max_dgram_size;
+
+    max_init_wnd = 2 * max_dgram_size;
+    if (max_init_wnd < MIN_MAX_INIT_WND_SIZE)
+        max_init_wnd = MIN_MAX_INIT_WND_SIZE;
+
+    cu->k_init_wnd = 10 * max_dgram_size;
+    if (cu->k_init_wnd > max_init_wnd)
+        cu->k_init_wnd = max_init_wnd;
+
+    cu->k_min_wnd = 2 * max_dgram_size;
+
+    if (is_reduced)
+        cu->cong_wnd = cu->k_init_wnd;
+
+    cubic_update_diag(cu);
+}
+
+static void cubic_reset(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    cu->cong_wnd                    = cu->k_init_wnd;
+    cu->bytes_in_flight             = 0;
+    cu->slow_start_thresh           = UINT64_MAX;
+    cu->cong_recovery_start_time    = ossl_time_zero();
+
+    cu->w_max                   = 0;
+    cu->w_est                   = 0;
+    cu->est_bytes_acked         = 0;
+    cu->cwnd_inc_acc            = 0;
+    cu->k_ms                    = 0;
+    cu->epoch_start             = ossl_time_zero();
+    cu->srtt                    = ossl_time_zero();
+
+    cu->processing_loss         = 0;
+    cu->tx_time_of_last_loss    = ossl_time_zero();
+    cu->in_congestion_recovery  = 0;
+}
+
+static int cubic_set_input_params(OSSL_CC_DATA *cc, const OSSL_PARAM *params)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+    const OSSL_PARAM *p;
+    size_t value;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_size_t(p, &value))
+            return 0;
+        if (value < QUIC_MIN_INITIAL_DGRAM_LEN)
+            return 0;
+
+        cubic_set_max_dgram_size(cu, value);
+    }
+
+    return 1;
+}
+
+static int cubic_bind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+    size_t *new_p_max_dgram_payload_len;
+    uint64_t *new_p_cur_cwnd_size;
+    uint64_t *new_p_min_cwnd_size;
+    uint64_t *new_p_cur_bytes_in_flight;
+    uint32_t *new_p_cur_state;
+
+    if (!ossl_cc_bind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                           sizeof(size_t),
+                           (void **)&new_p_max_dgram_payload_len)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
+                              sizeof(uint64_t), (void **)&new_p_cur_cwnd_size)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
+                              sizeof(uint64_t), (void **)&new_p_min_cwnd_size)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
+                              sizeof(uint64_t),
+                              (void **)&new_p_cur_bytes_in_flight)
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_STATE,
+                              sizeof(uint32_t), (void **)&new_p_cur_state))
+        return 0;
+
+    if (new_p_max_dgram_payload_len != NULL)
+        cu->p_diag_max_dgram_payload_len = new_p_max_dgram_payload_len;
+
+    if (new_p_cur_cwnd_size != NULL)
+        cu->p_diag_cur_cwnd_size = new_p_cur_cwnd_size;
+
+    if (new_p_min_cwnd_size != NULL)
+        cu->p_diag_min_cwnd_size = new_p_min_cwnd_size;
+
+    if (new_p_cur_bytes_in_flight != NULL)
+        cu->p_diag_cur_bytes_in_flight = new_p_cur_bytes_in_flight;
+
+    if (new_p_cur_state != NULL)
+        cu->p_diag_cur_state = new_p_cur_state;
+
+    cubic_update_diag(cu);
+    return 1;
+}
+
+static int cubic_unbind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                        (void **)&cu->p_diag_max_dgram_payload_len);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
+                        (void **)&cu->p_diag_cur_cwnd_size);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
+                        (void **)&cu->p_diag_min_cwnd_size);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
+                        (void **)&cu->p_diag_cur_bytes_in_flight);
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_STATE,
+                        (void **)&cu->p_diag_cur_state);
+    return 1;
+}
+
+static void cubic_update_diag(OSSL_CC_CUBIC *cu)
+{
+    if (cu->p_diag_max_dgram_payload_len != NULL)
+        *cu->p_diag_max_dgram_payload_len = cu->max_dgram_size;
+
+    if (cu->p_diag_cur_cwnd_size != NULL)
+        *cu->p_diag_cur_cwnd_size = cu->cong_wnd;
+
+    if (cu->p_diag_min_cwnd_size != NULL)
+        *cu->p_diag_min_cwnd_size = cu->k_min_wnd;
+
+    if (cu->p_diag_cur_bytes_in_flight != NULL)
+        *cu->p_diag_cur_bytes_in_flight = cu->bytes_in_flight;
+
+    if (cu->p_diag_cur_state != NULL) {
+        if (cu->in_congestion_recovery)
+            *cu->p_diag_cur_state = 'R';
+        else if (cu->cong_wnd < cu->slow_start_thresh)
+            *cu->p_diag_cur_state = 'S';
+        else
+            *cu->p_diag_cur_state = 'A';
+    }
+}
+
+/* Returns the integer cube root of |x|, rounded down. */
+static uint64_t cubic_cbrt(uint64_t x)
+{
+    uint64_t lo = 0, hi = 2642246, mid; /* 2642246^3 > 2^64 */
+
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (mid * mid * mid <= x)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/* Returns W_cubic(t) in bytes for t in milliseconds. */
+static uint64_t cubic_w_cubic(OSSL_CC_CUBIC *cu, uint64_t t_ms)
+{
+    uint64_t d, delta;
+    int err = 0, below = (t_ms < cu->k_ms);
+
+    d = below ? cu->k_ms - t_ms : t_ms - cu->k_ms;
+    if (d > CUBIC_MAX_T_MS)
+        d = CUBIC_MAX_T_MS;
+
+    delta = safe_muldiv_u64(d * d * d, cu->max_dgram_size, CUBIC_C_INV, &err);
+    if (err)
+        delta = UINT64_MAX;
+
+    if (below)
+        return delta < cu->w_max ? cu->w_max - delta : 0;
+
+    return safe_add_u64(cu->w_max, delta, &err);
+}
+
+static int cubic_in_cong_recovery(OSSL_CC_CUBIC *cu, OSSL_TIME tx_time)
+{
+    return ossl_time_compare(tx_time, cu->cong_recovery_start_time) <= 0;
+}
+
+static void cubic_cong(OSSL_CC_CUBIC *cu, OSSL_TIME tx_time)
+{
+    int err = 0;
+
+    /* No reaction if already in a recovery period. */
+    if (cubic_in_cong_recovery(cu, tx_time))
+        return;
+
+    /* Start a new recovery period. */
+    cu->in_congestion_recovery = 1;
+    cu->cong_recovery_start_time = cu->now_cb(cu->now_cb_arg);
+
+    /*
+     * Fast convergence (RFC 9438 s. 4.7): if the window is reduced before it
+     * has grown back to W_max, another flow is likely to have taken some of
+     * the capacity, so release some of ours by lowering W_max further.
+     */
+    if (cu->cong_wnd < cu->w_max)
+        cu->w_max = safe_muldiv_u64(cu->cong_wnd,
+                                    CUBIC_BETA_DEN + CUBIC_BETA_NUM,
+                                    2 * CUBIC_BETA_DEN, &err);
+    else
+        cu->w_max = cu->cong_wnd;
+
+    /* slow_start_thresh = cong_wnd * beta_cubic */
+    cu->slow_start_thresh
+        = safe_muldiv_u64(cu->cong_wnd, CUBIC_BETA_NUM, CUBIC_BETA_DEN, &err);
+
+    if (err) {
+        cu->w_max = UINT64_MAX;
+        cu->slow_start_thresh = UINT64_MAX;
+    }
+
+    cu->cong_wnd = cu->slow_start_thresh;
+    if (cu->cong_wnd < cu->k_min_wnd)
+        cu->cong_wnd = cu->k_min_wnd;
+
+    /* The next congestion avoidance epoch starts on the next ACK. */
+    cu->epoch_start = ossl_time_zero();
+}
+
+static void cubic_flush(OSSL_CC_CUBIC *cu, uint32_t flags)
+{
+    if (!cu->processing_loss)
+        return;
+
+    cubic_cong(cu, cu->tx_time_of_last_loss);
+
+    if ((flags & OSSL_CC_LOST_FLAG_PERSISTENT_CONGESTION) != 0) {
+        cu->cong_wnd                    = cu->k_min_wnd;
+        cu->cong_recovery_start_time    = ossl_time_zero();
+        cu->w_max                       = 0;
+        cu->epoch_start                 = ossl_time_zero();
+    }
+
+    cu->processing_loss = 0;
+    cubic_update_diag(cu);
+}
+
+static uint64_t cubic_get_tx_allowance(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    if (cu->bytes_in_flight >= cu->cong_wnd)
+        return 0;
+
+    return cu->cong_wnd - cu->bytes_in_flight;
+}
+
+static OSSL_TIME cubic_get_wakeup_deadline(OSSL_CC_DATA *cc)
+{
+    if (cubic_get_tx_allowance(cc) > 0) {
+        /* We have TX allowance now so wakeup immediately */
+        return ossl_time_zero();
+    } else {
+        /*
+         * Although W_cubic is a function of time, the window is only updated
+         * in response to acknowledgements.
+         */
+        return ossl_time_infinite();
+    }
+}
+
+static int cubic_on_data_sent(OSSL_CC_DATA *cc, uint64_t num_bytes)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    cu->bytes_in_flight += num_bytes;
+    cubic_update_diag(cu);
+    return 1;
+}
+
+static int cubic_is_cong_limited(OSSL_CC_CUBIC *cu)
+{
+    uint64_t wnd_rem;
+
+    /* We are congestion-limited if we are already at the congestion window. */
+    if (cu->bytes_in_flight >= cu->cong_wnd)
+        return 1;
+
+    wnd_rem = cu->cong_wnd - cu->bytes_in_flight;
+
+    /*
+     * Consider ourselves congestion-limited if less than three datagrams' worth
+     * of congestion window remains to be spent, or if we are in slow start and
+     * have consumed half of our window.
+     */
+    return (cu->cong_wnd < cu->slow_start_thresh && wnd_rem <= cu->cong_wnd / 2)
+           || wnd_rem <= 3 * cu->max_dgram_size;
+}
+
+/* Congestion avoidance (RFC 9438 s. 4.2-4.4). */
+static void cubic_avoid_cong(OSSL_CC_CUBIC *cu, OSSL_TIME now,
+                             uint64_t num_bytes)
+{
+    uint64_t t_ms, w_cubic, target, inc;
+    int err = 0;
+
+    if (ossl_time_is_zero(cu->epoch_start)) {
+        cu->epoch_start     = now;
+        cu->w_est           = cu->cong_wnd;
+        cu->est_bytes_acked = 0;
+        cu->cwnd_inc_acc    = 0;
+
+        if (cu->cong_wnd < cu->w_max) {
+            /* K = cbrt((W_max - cwnd_epoch) / C) */
+            cu->k_ms = cubic_cbrt(safe_muldiv_u64(cu->w_max - cu->cong_wnd,
+                                                  CUBIC_C_INV,
+                                                  cu->max_dgram_size, &err));
+            if (err)
+                cu->k_ms = CUBIC_MAX_T_MS;
+        } else {
+            cu->k_ms    = 0;
+            cu->w_max   = cu->cong_wnd;
+        }
+    }
+
+    t_ms = ossl_time2ms(ossl_time_subtract(now, cu->epoch_start));
+
+    /*
+     * The estimated window of a NewReno flow with the same reduction factor as
+     * ours grows by alpha_cubic segments per window acknowledged.
+     */
+    cu->est_bytes_acked += num_bytes;
+    if (cu->est_bytes_acked * CUBIC_ALPHA_NUM >= cu->cong_wnd * CUBIC_ALPHA_DEN) {
+        cu->est_bytes_acked -= cu->cong_wnd * CUBIC_ALPHA_DEN / CUBIC_ALPHA_NUM;
+        cu->w_est           += cu->max_dgram_size;
+    }
+
+    w_cubic = cubic_w_cubic(cu, t_ms);
+    if (w_cubic < cu->w_est) {
+        /* Reno-friendly region. */
+        if (cu->cong_wnd < cu->w_est)
+            cu->cong_wnd = cu->w_est;
+        return;
+    }
+
+    /* Aim for W_cubic one RTT from now, growing by at most half a window. */
+    target = cubic_w_cubic(cu, t_ms + ossl_time2ms(cu->srtt));
+    if (target < cu->cong_wnd)
+        target = cu->cong_wnd;
+    else if (target > cu->cong_wnd + cu->cong_wnd / 2)
+        target = cu->cong_wnd + cu->cong_wnd / 2;
+
+    /* cong_wnd += (target - cong_wnd) / cong_wnd for each byte acked */
+    cu->cwnd_inc_acc = safe_add_u64(cu->cwnd_inc_acc,
+                                    safe_mul_u64(target - cu->cong_wnd,
+                                                 num_bytes, &err),
+                                    &err);
+    if (err)
+        cu->cwnd_inc_acc = UINT64_MAX;
+
+    if (cu->cwnd_inc_acc >= cu->cong_wnd) {
+        inc = cu->cwnd_inc_acc / cu->cong_wnd;
+        cu->cwnd_inc_acc -= inc * cu->cong_wnd;
+        cu->cong_wnd += inc;
+    }
+}
+
+static int cubic_on_data_acked(OSSL_CC_DATA *cc,
+                               const OSSL_CC_ACK_INFO *info)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+    OSSL_TIME now = cu->now_cb(cu->now_cb_arg);
+
+    cu->bytes_in_flight -= info->tx_size;
+    ossl_cc_update_srtt(&cu->srtt, now, info->tx_time);
+
+    /*
+     * As for NewReno, only grow the window if we are actually using it, and
+     * not during a recovery period.
+     */
+    if (!cubic_is_cong_limited(cu)
+        || cubic_in_cong_recovery(cu, info->tx_time))
+        goto out;
+
+    if (cu->cong_wnd < cu->slow_start_thresh)
+        cu->cong_wnd += info->tx_size;
+    else
+        cubic_avoid_cong(cu, now, info->tx_size);
+
+    cu->in_congestion_recovery = 0;
+
+out:
+    cubic_update_diag(cu);
+    return 1;
+}
+
+static int cubic_on_data_lost(OSSL_CC_DATA *cc,
+                              const OSSL_CC_LOSS_INFO *info)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    if (info->tx_size > cu->bytes_in_flight)
+        return 0;
+
+    cu->bytes_in_flight -= info->tx_size;
+
+    if (!cu->processing_loss) {
+        /* See newreno_on_data_lost(). */
+        if (ossl_time_compare(info->tx_time, cu->tx_time_of_last_loss) <= 0)
+            goto out;
+
+        cu->processing_loss = 1;
+    }
+
+    cu->tx_time_of_last_loss
+        = ossl_time_max(cu->tx_time_of_last_loss, info->tx_time);
+
+out:
+    cubic_update_diag(cu);
+    return 1;
+}
+
+static int cubic_on_data_lost_finished(OSSL_CC_DATA *cc, uint32_t flags)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    cubic_flush(cu, flags);
+    return 1;
+}
+
+static int cubic_on_data_invalidated(OSSL_CC_DATA *cc,
+                                     uint64_t num_bytes)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    cu->bytes_in_flight -= num_bytes;
+    cubic_update_diag(cu);
+    return 1;
+}
+
+static int cubic_on_ecn(OSSL_CC_DATA *cc,
+                        const OSSL_CC_ECN_INFO *info)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    cu->processing_loss         = 1;
+    cu->tx_time_of_last_loss    = info->largest_acked_time;
+    cubic_flush(cu, 0);
+    return 1;
+}
+
+static uint64_t cubic_get_pacing_rate(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    return ossl_cc_get_pacing_rate(cu->cong_wnd, cu->srtt,
+                                   cu->cong_wnd < cu->slow_start_thresh);
+}
+
+const OSSL_CC_METHOD ossl_cc_cubic_method = {
+    cubic_new,
+    cubic_free,
+    cubic_reset,
+    cubic_set_input_params,
+    cubic_bind_diagnostic,
+    cubic_unbind_diagnostic,
+    cubic_get_tx_allowance,
+    cubic_get_wakeup_deadline,
+    cubic_on_data_sent,
+    cubic_on_data_acked,
+    cubic_on_data_lost,
+    cubic_on_data_lost_finished,
+    cubic_on_data_invalidated,
+    cubic_on_ecn,
+    cubic_get_pacing_rate,
+};
@@ -18,6 +18,7 @@ typedef struct ossl_cc_newreno_st {
     size_t      max_dgram_size;
     uint64_t    bytes_in_flight, cong_wnd, slow_start_thresh, bytes_acked;
     OSSL_TIME   cong_recovery_start_time;
+    OSSL_TIME   srtt;           /* smoothed RTT, used only for pacing */
 
     /* Unflushed state during multiple on-loss calls. */
     int         processing_loss; /* 1 if not flushed */
@@ -36,8 +37,6 @@ typedef struct ossl_cc_newreno_st {
 
 #define MIN_MAX_INIT_WND_SIZE    14720  /* RFC 9002 s. 7.2 */
 
-/* TODO(QUIC FUTURE): Pacing support. */
-
 static void newreno_set_max_dgram_size(OSSL_CC_NEWRENO *nr,
                                        size_t max_dgram_size);
 static void newreno_update_diag(OSSL_CC_NEWRENO *nr);
@@ -103,6 +102,7 @@ static void newreno_reset(OSSL_CC_DATA *cc)
     nr->bytes_acked                 = 0;
     nr->slow_start_thresh           = UINT64_MAX;
     nr->cong_recovery_start_time    = ossl_time_zero();
+    nr->srtt                        = ossl_time_zero();
 
     nr->processing_loss         = 0;
     nr->tx_time_of_last_loss    = ossl_time_zero();
@@ -128,24 +128,6 @@ static int newreno_set_input_params(OSSL_CC_DATA *cc, const OSSL_PARAM *params)
     return 1;
 }
 
-static int bind_diag(OSSL_PARAM *params, const char *param_name, size_t len,
-                     void **pp)
-{
-    const OSSL_PARAM *p = OSSL_PARAM_locate_const(params, param_name);
-
-    *pp = NULL;
-
-    if (p == NULL)
-        return 1;
-
-    if (p->data_type != OSSL_PARAM_UNSIGNED_INTEGER
-        || p->data_size != len)
-        return 0;
-
-    *pp = p->data;
-    return 1;
-}
-
 static int newreno_bind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
 {
     OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
@@ -155,15 +137,15 @@ static int newreno_bind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
     uint64_t *new_p_cur_bytes_in_flight;
     uint32_t *new_p_cur_state;
 
-    if (!bind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+    if (!ossl_cc_bind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
                    sizeof(size_t), (void **)&new_p_max_dgram_payload_len)
-        || !bind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
                       sizeof(uint64_t), (void **)&new_p_cur_cwnd_size)
-        || !bind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
                       sizeof(uint64_t), (void **)&new_p_min_cwnd_size)
-        || !bind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
                       sizeof(uint64_t), (void **)&new_p_cur_bytes_in_flight)
-        || !bind_diag(params, OSSL_CC_OPTION_CUR_STATE,
+        || !ossl_cc_bind_diag(params, OSSL_CC_OPTION_CUR_STATE,
                       sizeof(uint32_t), (void **)&new_p_cur_state))
         return 0;
 
@@ -186,28 +168,19 @@ static int newreno_bind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
     return 1;
 }
 
-static void unbind_diag(OSSL_PARAM *params, const char *param_name,
-                        void **pp)
-{
-    const OSSL_PARAM *p = OSSL_PARAM_locate_const(params, param_name);
-
-    if (p != NULL)
-        *pp = NULL;
-}
-
 static int newreno_unbind_diagnostic(OSSL_CC_DATA *cc, OSSL_PARAM *params)
 {
     OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
 
-    unbind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
                 (void **)&nr->p_diag_max_dgram_payload_len);
-    unbind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_CWND_SIZE,
                 (void **)&nr->p_diag_cur_cwnd_size);
-    unbind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_MIN_CWND_SIZE,
                 (void **)&nr->p_diag_min_cwnd_size);
-    unbind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_BYTES_IN_FLIGHT,
                 (void **)&nr->p_diag_cur_bytes_in_flight);
-    unbind_diag(params, OSSL_CC_OPTION_CUR_STATE,
+    ossl_cc_unbind_diag(params, OSSL_CC_OPTION_CUR_STATE,
                 (void **)&nr->p_diag_cur_state);
     return 1;
 }
@@ -346,6 +319,7 @@ static int newreno_on_data_acked(OSSL_CC_DATA *cc,
      * bytes in flight.
      */
     nr->bytes_in_flight -= info->tx_size;
+    ossl_cc_update_srtt(&nr->srtt, nr->now_cb(nr->now_cb_arg), info->tx_time);
 
     /*
      * We use acknowledgement of data as a signal that we are not at channel
@@ -467,6 +441,14 @@ static int newreno_on_ecn(OSSL_CC_DATA *cc,
     return 1;
 }
 
+static uint64_t newreno_get_pacing_rate(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
+
+    return ossl_cc_get_pacing_rate(nr->cong_wnd, nr->srtt,
+                                   nr->cong_wnd < nr->slow_start_thresh);
+}
+
 const OSSL_CC_METHOD ossl_cc_newreno_method = {
     newreno_new,
     newreno_free,
@@ -482,4 +464,5 @@ const OSSL_CC_METHOD ossl_cc_newreno_method = {
     newreno_on_data_lost_finished,
     newreno_on_data_invalidated,
     newreno_on_ecn,
+    newreno_get_pacing_rate,
 };
@@ -8,7 +8,6 @@
  */
 
 #include "internal/quic_ackm.h"
-#include "internal/uint_set.h"
 #include "internal/common.h"
 #include <assert.h>
 
@@ -355,12 +354,17 @@ tx_pkt_history_remove(struct tx_pkt_history_st *h, uint64_t pkt_num)
  * given PN until that PN becomes provably ACKed and we finally remove it from
  * our set (by bumping the watermark) as no longer being our concern.
  *
- * The data structure used is the UINT_SET structure defined in uint_set.h,
- * which is used as a PN set. We use the following operations of the structure:
+ * The data structure used is a sorted array of disjoint PN ranges held inline
+ * in the history, which is used as a PN set. Since the number of ranges is
+ * bounded (see below) the array never needs to be reallocated, and since PNs
+ * generally arrive in order, nearly all insertions simply extend the last
+ * range. Lookups use a binary search. We use the following operations of the
+ * structure:
  *
- *   Insert Range: Used when we receive a new PN.
+ *   Insert:       Used when we receive a new PN.
  *
- *   Remove Range: Used when bumping the watermark.
+ *   Remove Range: Used when bumping the watermark. Only ranges at the start
+ *                 of the array are ever removed.
  *
  *   Query:        Used to determine if a PN is in the set.
  *
@@ -386,8 +390,21 @@ tx_pkt_history_remove(struct tx_pkt_history_st *h, uint64_t pkt_num)
  * used to update the state of the RX side of the ACK manager by bumping the
  * watermark accordingly.
  */
+
+/*
+ * Limit the number of ACK ranges we store to prevent resource consumption DoS
+ * attacks.
+ */
+#define MAX_RX_ACK_RANGES   32
+
 struct rx_pkt_history_st {
-    UINT_SET set;
+    /*
+     * Ranges of received PNs in ascending order. No two ranges overlap or
+     * border one another. One extra slot allows a range to be inserted before
+     * the oldest range is discarded to get back within the limit.
+     */
+    OSSL_QUIC_ACK_RANGE ranges[MAX_RX_ACK_RANGES + 1];
+    size_t              num_ranges;
 
     /*
      * Invariant: PNs below this are not in the set.
@@ -396,81 +413,129 @@ struct rx_pkt_history_st {
     QUIC_PN watermark;
 };
 
-static int rx_pkt_history_bump_watermark(struct rx_pkt_history_st *h,
-                                         QUIC_PN watermark);
+static void rx_pkt_history_bump_watermark(struct rx_pkt_history_st *h,
+                                          QUIC_PN watermark);
 
 static void rx_pkt_history_init(struct rx_pkt_history_st *h)
 {
-    ossl_uint_set_init(&h->set);
-    h->watermark = 0;
+    h->num_ranges   = 0;
+    h->watermark    = 0;
 }
 
 static void rx_pkt_history_destroy(struct rx_pkt_history_st *h)
 {
-    ossl_uint_set_destroy(&h->set);
+    h->num_ranges = 0;
 }
 
 /*
- * Limit the number of ACK ranges we store to prevent resource consumption DoS
- * attacks.
+ * Returns the index of the first range which ends at or after pn, or
+ * h->num_ranges if there is no such range.
  */
-#define MAX_RX_ACK_RANGES   32
-
-static void rx_pkt_history_trim_range_count(struct rx_pkt_history_st *h)
+static size_t rx_pkt_history_find(const struct rx_pkt_history_st *h,
+                                  QUIC_PN pn)
 {
-    QUIC_PN highest = QUIC_PN_INVALID;
+    size_t lo = 0, hi = h->num_ranges, mid;
 
-    while (ossl_list_uint_set_num(&h->set) > MAX_RX_ACK_RANGES) {
-        UINT_RANGE r = ossl_list_uint_set_head(&h->set)->range;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (h->ranges[mid].end < pn)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
 
-        highest = (highest == QUIC_PN_INVALID)
-            ? r.end : ossl_quic_pn_max(highest, r.end);
+    return lo;
+}
 
-        ossl_uint_set_remove(&h->set, &r);
-    }
+static int rx_pkt_history_contains(const struct rx_pkt_history_st *h,
+                                   QUIC_PN pn)
+{
+    size_t i;
+
+    if (h->num_ranges == 0 || pn > h->ranges[h->num_ranges - 1].end)
+        return 0;
+
+    i = rx_pkt_history_find(h, pn);
+    return i < h->num_ranges && h->ranges[i].start <= pn;
+}
 
+static void rx_pkt_history_trim_range_count(struct rx_pkt_history_st *h)
+{
     /*
-     * Bump watermark to cover all PNs we removed to avoid accidental
-     * reprocessing of packets.
+     * Bump watermark past the oldest range to discard it, which also avoids
+     * accidental reprocessing of packets in it.
      */
-    if (highest != QUIC_PN_INVALID)
-        rx_pkt_history_bump_watermark(h, highest + 1);
+    if (h->num_ranges > MAX_RX_ACK_RANGES)
+        rx_pkt_history_bump_watermark(h, h->ranges[0].end + 1);
 }
 
-static int rx_pkt_history_add_pn(struct rx_pkt_history_st *h,
-                                 QUIC_PN pn)
+static void rx_pkt_history_add_pn(struct rx_pkt_history_st *h,
+                                  QUIC_PN pn)
 {
-    UINT_RANGE r;
-
-    r.start = pn;
-    r.end   = pn;
+    OSSL_QUIC_ACK_RANGE *r;
+    size_t i;
+    int join_prev, join_next;
 
     if (pn < h->watermark)
-        return 1; /* consider this a success case */
+        return; /* consider this a success case */
 
-    if (ossl_uint_set_insert(&h->set, &r) != 1)
-        return 0;
+    if (h->num_ranges > 0) {
+        r = &h->ranges[h->num_ranges - 1];
 
-    rx_pkt_history_trim_range_count(h);
-    return 1;
+        /* Fast path: the PN extends the highest range. */
+        if (pn == r->end + 1) {
+            r->end = pn;
+            return;
+        }
+    }
+
+    i = rx_pkt_history_find(h, pn);
+    if (i < h->num_ranges && h->ranges[i].start <= pn)
+        return; /* already in the set */
+
+    join_prev = (i > 0 && h->ranges[i - 1].end + 1 == pn);
+    join_next = (i < h->num_ranges && h->ranges[i].start == pn + 1);
+
+    if (join_prev && join_next) {
+        /* The PN closes the gap between two ranges, so merge them. */
+        h->ranges[i - 1].end = h->ranges[i].end;
+        memmove(&h->ranges[i], &h->ranges[i + 1],
+                (h->num_ranges - i - 1) * sizeof(h->ranges[0]));
+        --h->num_ranges;
+    } else if (join_prev) {
+        h->ranges[i - 1].end = pn;
+    } else if (join_next) {
+        h->ranges[i].start = pn;
+    } else {
+        memmove(&h->ranges[i + 1], &h->ranges[i],
+                (h->num_ranges - i) * sizeof(h->ranges[0]));
+        h->ranges[i].start  = pn;
+        h->ranges[i].end    = pn;
+        ++h->num_ranges;
+        rx_pkt_history_trim_range_count(h);
+    }
 }
 
-static int rx_pkt_history_bump_watermark(struct rx_pkt_history_st *h,
-                                         QUIC_PN watermark)
+static void rx_pkt_history_bump_watermark(struct rx_pkt_history_st *h,
+                                          QUIC_PN watermark)
 {
-    UINT_RANGE r;
+    size_t i;
 
     if (watermark <= h->watermark)
-        return 1;
+        return;
 
     /* Remove existing PNs below the watermark. */
-    r.start = 0;
-    r.end   = watermark - 1;
-    if (ossl_uint_set_remove(&h->set, &r) != 1)
-        return 0;
+    i = rx_pkt_history_find(h, watermark);
+    if (i < h->num_ranges && h->ranges[i].start < watermark)
+        h->ranges[i].start = watermark;
+
+    if (i > 0) {
+        memmove(&h->ranges[0], &h->ranges[i],
+                (h->num_ranges - i) * sizeof(h->ranges[0]));
+        h->num_ranges -= i;
+    }
 
     h->watermark = watermark;
-    return 1;
 }
 
 /*
@@ -491,6 +556,19 @@ static int rx_pkt_history_bump_watermark(struct rx_pkt_history_st *h,
 /* Default maximum amount of time to leave an ACK-eliciting packet un-ACK'd. */
 #define DEFAULT_TX_MAX_ACK_DELAY       ossl_ms2time(QUIC_DEFAULT_MAX_ACK_DELAY)
 
+/*
+ * Number of ACK-eliciting packets we may RX without emitting an ACK. We always
+ * emit an ACK once this is exceeded, so by default we ACK every second packet
+ * (RFC 9000 s. 13.2.2). The peer can change this with an ACK_FREQUENCY frame.
+ */
+#define DEFAULT_ACK_ELICITING_THRESHOLD     1
+
+/*
+ * Default reordering threshold; a value of 1 means that we ACK immediately
+ * whenever a packet arrives out of order (RFC 9000 s. 13.2.1).
+ */
+#define DEFAULT_REORDERING_THRESHOLD        1
+
 struct ossl_ackm_st {
     /* Our list of transmitted packets. Corresponds to RFC 9002 sent_packets. */
     struct tx_pkt_history_st tx_history[QUIC_PN_SPACE_NUM];
@@ -596,6 +674,14 @@ struct ossl_ackm_st {
      */
     OSSL_TIME       tx_max_ack_delay;
 
+    /*
+     * The number of ACK-eliciting packets we may receive without sending an
+     * ACK, and the amount of reordering which causes us to send an ACK
+     * immediately. The peer may change these using an ACK_FREQUENCY frame.
+     */
+    uint64_t        rx_ack_eliciting_threshold;
+    uint64_t        rx_reordering_threshold;
+
     /* Callbacks for deadline updates. */
     void (*loss_detection_deadline_cb)(OSSL_TIME deadline, void *arg);
     void *loss_detection_deadline_cb_arg;
@@ -997,10 +1083,6 @@ static void ackm_on_pkts_acked(OSSL_ACKM *ackm, const OSSL_ACKM_TX_PKT *apkt)
                 last_pn_acked = apkt->pkt_num;
 
             if (apkt->largest_acked != QUIC_PN_INVALID)
-                /*
-                 * This can fail, but it is monotonic; worst case we try again
-                 * next time.
-                 */
                 rx_pkt_history_bump_watermark(get_rx_history(ackm,
                                                              apkt->pkt_space),
                                               apkt->largest_acked + 1);
@@ -1049,6 +1131,9 @@ OSSL_ACKM *ossl_ackm_new(OSSL_TIME (*now)(void *arg),
     ackm->rx_max_ack_delay = ossl_ms2time(QUIC_DEFAULT_MAX_ACK_DELAY);
     ackm->tx_max_ack_delay = DEFAULT_TX_MAX_ACK_DELAY;
 
+    ackm->rx_ack_eliciting_threshold    = DEFAULT_ACK_ELICITING_THRESHOLD;
+    ackm->rx_reordering_threshold       = DEFAULT_REORDERING_THRESHOLD;
+
     return ackm;
 
 err:
@@ -1358,9 +1443,6 @@ int ossl_ackm_get_largest_unacked(OSSL_ACKM *ackm, int pkt_space, QUIC_PN *pn)
     return 0;
 }
 
-/* Number of ACK-eliciting packets RX'd before we always emit an ACK. */
-#define PKTS_BEFORE_ACK     2
-
 /*
  * Return 1 if emission of an ACK frame is currently desired.
  *
@@ -1415,34 +1497,41 @@ static int ackm_is_missing(OSSL_ACKM *ackm, int pkt_space, QUIC_PN pkt_num)
 
 /*
  * Returns 1 iff our RX of a PN newly establishes the implication of missing
- * packets.
+ * packets to an extent which warrants an immediate ACK.
+ *
+ * Following draft-ietf-quic-ack-frequency s. 6.2, we find the smallest PN above
+ * the largest PN reported in our last ACK frame which we have not received (and
+ * thus have not yet reported as missing). If the largest PN we have received
+ * exceeds it by at least the reordering threshold, an ACK is sent immediately.
+ * With the default threshold of 1 this means that any newly implied missing PN
+ * causes an ACK, as required by RFC 9000 s. 13.2.1. A threshold of 0 means
+ * reordering never causes an immediate ACK.
  */
 static int ackm_has_newly_missing(OSSL_ACKM *ackm, int pkt_space)
 {
     struct rx_pkt_history_st *h;
+    QUIC_PN missing, largest;
+    size_t i;
 
     h = get_rx_history(ackm, pkt_space);
 
-    if (ossl_list_uint_set_is_empty(&h->set))
+    if (h->num_ranges == 0
+        || ackm->ack[pkt_space].num_ack_ranges == 0
+        || ackm->rx_reordering_threshold == 0)
         return 0;
 
-    /*
-     * The second condition here establishes that the highest PN range in our RX
-     * history comprises only a single PN. If there is more than one, then this
-     * function will have returned 1 during a previous call to
-     * ossl_ackm_on_rx_packet assuming the third condition below was met. Thus
-     * we only return 1 when the missing PN condition is newly established.
-     *
-     * The third condition here establishes that the highest PN range in our RX
-     * history is beyond (and does not border) the highest PN we have yet
-     * reported in any ACK frame. Thus there is a gap of at least one PN between
-     * the PNs we have ACK'd previously and the PN we have just received.
-     */
-    return ackm->ack[pkt_space].num_ack_ranges > 0
-        && ossl_list_uint_set_tail(&h->set)->range.start
-           == ossl_list_uint_set_tail(&h->set)->range.end
-        && ossl_list_uint_set_tail(&h->set)->range.start
-            > ackm->ack[pkt_space].ack_ranges[0].end + 1;
+    missing = ackm->ack[pkt_space].ack_ranges[0].end + 1;
+    largest = h->ranges[h->num_ranges - 1].end;
+
+    for (i = rx_pkt_history_find(h, missing); i < h->num_ranges; ++i) {
+        if (h->ranges[i].start > missing)
+            break;
+
+        missing = h->ranges[i].end + 1;
+    }
+
+    return largest > missing
+        && largest - missing >= ackm->rx_reordering_threshold;
 }
 
 static void ackm_set_flush_deadline(OSSL_ACKM *ackm, int pkt_space,
@@ -1477,9 +1566,9 @@ static void ackm_on_rx_ack_eliciting(OSSL_ACKM *ackm,
     ++ackm->rx_ack_eliciting_pkts_since_last_ack[pkt_space];
 
     if (!ackm->rx_ack_generated[pkt_space]
-            || was_missing
+            || (was_missing && ackm->rx_reordering_threshold > 0)
             || ackm->rx_ack_eliciting_pkts_since_last_ack[pkt_space]
-                >= PKTS_BEFORE_ACK
+                > ackm->rx_ack_eliciting_threshold
             || ackm_has_newly_missing(ackm, pkt_space)) {
         /*
          * Either:
@@ -1561,8 +1650,7 @@ int ossl_ackm_on_rx_packet(OSSL_ACKM *ackm, const OSSL_ACKM_RX_PKT *pkt)
      * Add the packet number to our history list of PNs we have not yet provably
      * acked.
      */
-    if (rx_pkt_history_add_pn(h, pkt->pkt_num) != 1)
-        return 0;
+    rx_pkt_history_add_pn(h, pkt->pkt_num);
 
     /*
      * Receiving this packet may or may not cause us to emit an ACK frame.
@@ -1594,19 +1682,14 @@ static void ackm_fill_rx_ack_ranges(OSSL_ACKM *ackm, int pkt_space,
                                     OSSL_QUIC_FRAME_ACK *ack)
 {
     struct rx_pkt_history_st *h = get_rx_history(ackm, pkt_space);
-    UINT_SET_ITEM *x;
-    size_t i = 0;
+    size_t i;
 
     /*
-     * Copy out ranges from the PN set, starting at the end, until we reach our
-     * maximum number of ranges.
+     * Copy out ranges from the PN set in descending order. The history never
+     * holds more ranges than fit in an ACK frame.
      */
-    for (x = ossl_list_uint_set_tail(&h->set);
-         x != NULL && i < OSSL_NELEM(ackm->ack_ranges);
-         x = ossl_list_uint_set_prev(x), ++i) {
-        ackm->ack_ranges[pkt_space][i].start = x->range.start;
-        ackm->ack_ranges[pkt_space][i].end   = x->range.end;
-    }
+    for (i = 0; i < h->num_ranges; ++i)
+        ackm->ack_ranges[pkt_space][i] = h->ranges[h->num_ranges - 1 - i];
 
     ack->ack_ranges     = ackm->ack_ranges[pkt_space];
     ack->num_ack_ranges = i;
@@ -1655,7 +1738,7 @@ int ossl_ackm_is_rx_pn_processable(OSSL_ACKM *ackm, QUIC_PN pn, int pkt_space)
 {
     struct rx_pkt_history_st *h = get_rx_history(ackm, pkt_space);
 
-    return pn >= h->watermark && ossl_uint_set_query(&h->set, pn) == 0;
+    return pn >= h->watermark && !rx_pkt_history_contains(h, pn);
 }
 
 void ossl_ackm_set_loss_detection_deadline_callback(OSSL_ACKM *ackm,
@@ -1723,3 +1806,25 @@ void ossl_ackm_set_tx_max_ack_delay(OSSL_ACKM *ackm, OSSL_TIME tx_max_ack_delay)
 {
     ackm->tx_max_ack_delay = tx_max_ack_delay;
 }
+
+void ossl_ackm_set_ack_frequency(OSSL_ACKM *ackm,
+                                 uint64_t ack_eliciting_threshold,
+                                 OSSL_TIME max_ack_delay,
+                                 uint64_t reordering_threshold)
+{
+    ackm->rx_ack_eliciting_threshold    = ack_eliciting_threshold;
+    ackm->tx_max_ack_delay              = max_ack_delay;
+    ackm->rx_reordering_threshold       = reordering_threshold;
+}
+
+void ossl_ackm_on_rx_immediate_ack(OSSL_ACKM *ackm, int pkt_space)
+{
+    ackm_queue_ack(ackm, pkt_space);
+}
+
+void ossl_ackm_set_cc(OSSL_ACKM *ackm, const OSSL_CC_METHOD *cc_method,
+                      OSSL_CC_DATA *cc_data)
+{
+    ackm->cc_method = cc_method;
+    ackm->cc_data   = cc_data;
+}
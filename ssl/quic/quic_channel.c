@@ -48,12 +48,43 @@
  */
 #define DEFAULT_MAX_ACK_DELAY   QUIC_DEFAULT_MAX_ACK_DELAY
 
+/*
+ * The smallest ACK delay we can honour if the peer asks us to delay ACKs using
+ * an ACK_FREQUENCY frame (draft-ietf-quic-ack-frequency). This is sent as the
+ * min_ack_delay transport parameter.
+ */
+#define MIN_ACK_DELAY_US        1000
+
+/*
+ * If the peer supports the ACK frequency extension, we ask it to send about
+ * this many ACKs per congestion window, up to a limit on the number of
+ * ACK-eliciting packets it may receive before sending an ACK. The default
+ * threshold of 1 applies until the window is large enough.
+ */
+#define ACK_FREQ_ACKS_PER_CWND      4
+#define ACK_FREQ_MAX_THRESHOLD      15
+
+/*
+ * Limits on the number of DATAGRAM frames (RFC 9221) we hold. Datagrams are
+ * unreliable, so received datagrams which the application does not read in time
+ * are dropped rather than buffered without bound, while the application is told
+ * to retry sending when too many datagrams are queued or in flight.
+ */
+#define MAX_DGRAM_RX_COUNT          64
+#define MAX_DGRAM_TX_COUNT          64
+
+/* The longest 1-RTT packet header we may use: first byte, DCID and PN. */
+#define MAX_1RTT_HDR_LEN            (1 + QUIC_MAX_CONN_ID_LEN + 4)
+
 DEFINE_LIST_OF_IMPL(ch, QUIC_CHANNEL);
 
 static void ch_save_err_state(QUIC_CHANNEL *ch);
+static void ch_dgram_rx_clear(QUIC_CHANNEL *ch);
 static int ch_rx(QUIC_CHANNEL *ch, int channel_only);
 static int ch_tx(QUIC_CHANNEL *ch);
 static int ch_tick_tls(QUIC_CHANNEL *ch, int channel_only);
+static int ch_bind_cc_diag(QUIC_CHANNEL *ch);
+static void ch_update_ack_frequency(QUIC_CHANNEL *ch);
 static void ch_rx_handle_packet(QUIC_CHANNEL *ch, int channel_only);
 static OSSL_TIME ch_determine_next_tick_deadline(QUIC_CHANNEL *ch);
 static int ch_retry(QUIC_CHANNEL *ch,
@@ -137,8 +168,12 @@ static int ch_init(QUIC_CHANNEL *ch)
                                        &ch->init_dcid))
         goto err;
 
-    /* We plug in a network write BIO to the QTX later when we get one. */
+    /*
+     * Plug in the network write BIO of the port, if it already has one; if it
+     * does not, it is plugged in later when we get one.
+     */
     qtx_args.libctx = ch->port->engine->libctx;
+    qtx_args.bio = ch->port->net_wbio;
     qtx_args.mdpl = QUIC_MIN_INITIAL_DGRAM_LEN;
     ch->rx_max_udp_payload_size = qtx_args.mdpl;
 
@@ -195,7 +230,8 @@ static int ch_init(QUIC_CHANNEL *ch)
 
     ch->have_statm = 1;
     ch->cc_method = &ossl_cc_newreno_method;
-    if ((ch->cc_data = ch->cc_method->new(get_time, ch)) == NULL)
+    if ((ch->cc_data = ch->cc_method->new(get_time, ch)) == NULL
+        || !ch_bind_cc_diag(ch))
         goto err;
 
     if ((ch->ackm = ossl_ackm_new(get_time, ch, &ch->statm,
@@ -263,6 +299,10 @@ static int ch_init(QUIC_CHANNEL *ch)
                                     ch))
         goto err;
 
+    /* Clients never receive 0-RTT packets. */
+    if (!ch->is_server)
+        ossl_qrx_discard_enc_level(ch->qrx, QUIC_ENC_LEVEL_0RTT);
+
     for (pn_space = QUIC_PN_SPACE_INITIAL; pn_space < QUIC_PN_SPACE_NUM; ++pn_space) {
         ch->crypto_recv[pn_space] = ossl_quic_rstream_new(NULL, NULL, 0);
         if (ch->crypto_recv[pn_space] == NULL)
@@ -293,6 +333,8 @@ static int ch_init(QUIC_CHANNEL *ch)
     ch->tx_max_ack_delay        = DEFAULT_MAX_ACK_DELAY;
     ch->rx_max_ack_delay        = QUIC_DEFAULT_MAX_ACK_DELAY;
     ch->rx_ack_delay_exp        = QUIC_DEFAULT_ACK_DELAY_EXP;
+    ch->rx_min_ack_delay        = UINT64_MAX;
+    ch->tx_ack_freq_threshold   = 1;
     ch->rx_active_conn_id_limit = QUIC_MIN_ACTIVE_CONN_ID_LIMIT;
     ch->max_idle_timeout        = QUIC_DEFAULT_IDLE_TIMEOUT;
     ch->tx_enc_level            = QUIC_ENC_LEVEL_INITIAL;
@@ -357,6 +399,7 @@ static void ch_cleanup(QUIC_CHANNEL *ch)
     ossl_qrx_free(ch->qrx);
     OPENSSL_free(ch->local_transport_params);
     OPENSSL_free((char *)ch->terminate_cause.reason);
+    ch_dgram_rx_clear(ch);
     OSSL_ERR_STATE_free(ch->err_state);
     OPENSSL_free(ch->ack_range_scratch);
 
@@ -379,6 +422,8 @@ QUIC_CHANNEL *ossl_quic_channel_new(const QUIC_CHANNEL_ARGS *args)
     ch->lcidm       = args->lcidm;
     ch->srtm        = args->srtm;
 
+    ch->tx_max_datagram_frame_size = args->max_datagram_frame_size;
+
     if (!ch_init(ch)) {
         OPENSSL_free(ch);
         return NULL;
@@ -434,6 +479,41 @@ int ossl_quic_channel_set_peer_addr(QUIC_CHANNEL *ch, const BIO_ADDR *peer_addr)
     return 1;
 }
 
+int ossl_quic_channel_set_cc_method(QUIC_CHANNEL *ch,
+                                    const OSSL_CC_METHOD *cc_method)
+{
+    OSSL_CC_DATA *cc_data;
+
+    if (ch->state != QUIC_CHANNEL_STATE_IDLE)
+        return 0;
+
+    if (cc_method == ch->cc_method)
+        return 1;
+
+    if ((cc_data = cc_method->new(get_time, ch)) == NULL)
+        return 0;
+
+    ch->cc_method->free(ch->cc_data);
+    ch->cc_method   = cc_method;
+    ch->cc_data     = cc_data;
+    ossl_ackm_set_cc(ch->ackm, cc_method, cc_data);
+    ossl_quic_tx_packetiser_set_cc(ch->txp, cc_method, cc_data);
+    return ch_bind_cc_diag(ch);
+}
+
+static int ch_bind_cc_diag(QUIC_CHANNEL *ch)
+{
+    OSSL_PARAM params[3];
+
+    params[0] = OSSL_PARAM_construct_uint64(OSSL_CC_OPTION_CUR_CWND_SIZE,
+                                            &ch->cc_cwnd);
+    params[1] = OSSL_PARAM_construct_size_t(OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                                            &ch->cc_max_dgram_payload_len);
+    params[2] = OSSL_PARAM_construct_end();
+
+    return ch->cc_method->bind_diagnostics(ch->cc_data, params);
+}
+
 QUIC_REACTOR *ossl_quic_channel_get_reactor(QUIC_CHANNEL *ch)
 {
     return ossl_quic_port_get0_reactor(ch->port);
@@ -899,6 +979,26 @@ static int ch_on_handshake_yield_secret(uint32_t enc_level, int direction,
         /* Invalid EL. */
         return 0;
 
+    if (enc_level == QUIC_ENC_LEVEL_0RTT) {
+        /*
+         * Only a client sends and only a server receives 0-RTT packets. The
+         * 0-RTT EL is used alongside the Initial and Handshake ELs, so it does
+         * not change our preferred ELs.
+         */
+        if (direction == ch->is_server)
+            return 0;
+
+        if (direction)
+            return ossl_qtx_provide_secret(ch->qtx, enc_level, suite_id, md,
+                                           secret, secret_len);
+
+        if (!ossl_qrx_provide_secret(ch->qrx, enc_level, suite_id, md,
+                                     secret, secret_len))
+            return 0;
+
+        ch->have_new_rx_secret = 1;
+        return 1;
+    }
 
     if (direction) {
         /* TX */
@@ -915,6 +1015,26 @@ static int ch_on_handshake_yield_secret(uint32_t enc_level, int direction,
             return 0;
 
         ch->tx_enc_level = enc_level;
+
+        if (ch->is_server && enc_level == QUIC_ENC_LEVEL_HANDSHAKE
+            && !ossl_quic_tls_is_early_data_accepted(ch->qtls))
+            /*
+             * Early data is accepted or rejected by the time we send a
+             * ServerHello. If we rejected it, drop 0-RTT packets immediately
+             * rather than deferring them.
+             */
+            ch_discard_el(ch, QUIC_ENC_LEVEL_0RTT);
+
+        if (ch->doing_early_data && enc_level == QUIC_ENC_LEVEL_1RTT) {
+            /*
+             * RFC 9001 s. 4.9.3: A client stops sending 0-RTT packets once it
+             * has 1-RTT keys.
+             */
+            ch->early_data_pn_end
+                = ossl_quic_tx_packetiser_get_next_pn(ch->txp,
+                                                      QUIC_PN_SPACE_APP);
+            ch_discard_el(ch, QUIC_ENC_LEVEL_0RTT);
+        }
     } else {
         /* RX */
         if (enc_level <= ch->rx_enc_level)
@@ -982,6 +1102,22 @@ static int ch_on_handshake_complete(void *arg)
 
     ch->handshake_complete = 1;
 
+    if (ch->is_server) {
+        /* The client has 1-RTT keys now, so will not send any more 0-RTT. */
+        ch_discard_el(ch, QUIC_ENC_LEVEL_0RTT);
+    } else if (ch->doing_early_data
+               && !ossl_quic_tls_is_early_data_accepted(ch->qtls)) {
+        QUIC_PN pn;
+
+        /*
+         * RFC 9001 s. 4.6.2: If the server rejected 0-RTT, all 0-RTT packets
+         * are lost. Any stream data they carried is sent again under 1-RTT.
+         * Packets which loss detection has already handled are ignored.
+         */
+        for (pn = 0; pn < ch->early_data_pn_end; ++pn)
+            ossl_ackm_mark_packet_pseudo_lost(ch->ackm, QUIC_PN_SPACE_APP, pn);
+    }
+
     if (ch->is_server) {
         /*
          * On the server, the handshake is confirmed as soon as it is complete.
@@ -1110,6 +1246,8 @@ static int ch_on_transport_params(const unsigned char *params,
     int got_max_idle_timeout = 0;
     int got_active_conn_id_limit = 0;
     int got_disable_active_migration = 0;
+    int got_min_ack_delay = 0;
+    int got_max_datagram_frame_size = 0;
     QUIC_CONN_ID cid;
     const char *reason = "bad transport parameter";
 
@@ -1335,7 +1473,7 @@ static int ch_on_transport_params(const unsigned char *params,
                 goto malformed;
             }
 
-            assert(ch->max_local_streams_bidi == 0);
+            /* May replace a value remembered for 0-RTT. */
             ch->max_local_streams_bidi = v;
             got_initial_max_streams_bidi = 1;
             break;
@@ -1353,7 +1491,7 @@ static int ch_on_transport_params(const unsigned char *params,
                 goto malformed;
             }
 
-            assert(ch->max_local_streams_uni == 0);
+            /* May replace a value remembered for 0-RTT. */
             ch->max_local_streams_uni = v;
             got_initial_max_streams_uni = 1;
             break;
@@ -1500,6 +1638,39 @@ static int ch_on_transport_params(const unsigned char *params,
             got_disable_active_migration = 1;
             break;
 
+        case QUIC_TPARAM_MIN_ACK_DELAY:
+            if (got_min_ack_delay) {
+                /* must not appear more than once */
+                reason = TP_REASON_DUP("MIN_ACK_DELAY");
+                goto malformed;
+            }
+
+            if (!ossl_quic_wire_decode_transport_param_int(&pkt, &id, &v)
+                || v >= (((uint64_t)1) << 24)) {
+                reason = TP_REASON_MALFORMED("MIN_ACK_DELAY");
+                goto malformed;
+            }
+
+            ch->rx_min_ack_delay = v;
+            got_min_ack_delay = 1;
+            break;
+
+        case QUIC_TPARAM_MAX_DATAGRAM_FRAME_SIZE:
+            if (got_max_datagram_frame_size) {
+                /* must not appear more than once */
+                reason = TP_REASON_DUP("MAX_DATAGRAM_FRAME_SIZE");
+                goto malformed;
+            }
+
+            if (!ossl_quic_wire_decode_transport_param_int(&pkt, &id, &v)) {
+                reason = TP_REASON_MALFORMED("MAX_DATAGRAM_FRAME_SIZE");
+                goto malformed;
+            }
+
+            ch->rx_max_datagram_frame_size = v;
+            got_max_datagram_frame_size = 1;
+            break;
+
         default:
             /*
              * Skip over and ignore.
@@ -1524,6 +1695,15 @@ static int ch_on_transport_params(const unsigned char *params,
         goto malformed;
     }
 
+    /*
+     * draft-ietf-quic-ack-frequency s. 3: min_ack_delay must not exceed
+     * max_ack_delay.
+     */
+    if (got_min_ack_delay && ch->rx_min_ack_delay > ch->rx_max_ack_delay * 1000) {
+        reason = TP_REASON_MALFORMED("MIN_ACK_DELAY");
+        goto malformed;
+    }
+
     if (!ch->is_server) {
         if (!got_orig_dcid) {
             reason = TP_REASON_REQUIRED("ORIG_DCID");
@@ -1621,6 +1801,15 @@ static int ch_generate_transport_params(QUIC_CHANNEL *ch)
                                                       ch->tx_max_ack_delay))
         goto err;
 
+    if (!ossl_quic_wire_encode_transport_param_int(&wpkt, QUIC_TPARAM_MIN_ACK_DELAY,
+                                                   MIN_ACK_DELAY_US))
+        goto err;
+
+    if (ch->tx_max_datagram_frame_size > 0
+        && !ossl_quic_wire_encode_transport_param_int(&wpkt, QUIC_TPARAM_MAX_DATAGRAM_FRAME_SIZE,
+                                                      ch->tx_max_datagram_frame_size))
+        goto err;
+
     if (!ossl_quic_wire_encode_transport_param_int(&wpkt, QUIC_TPARAM_INITIAL_MAX_DATA,
                                                    ossl_quic_rxfc_get_cwm(&ch->conn_rxfc)))
         goto err;
@@ -1792,6 +1981,9 @@ void ossl_quic_channel_subtick(QUIC_CHANNEL *ch, QUIC_TICK_RESULT *res,
             ch_update_ping_deadline(ch);
         }
 
+        /* Adapt the peer's ACK frequency to our congestion window. */
+        ch_update_ack_frequency(ch);
+
         /* Queue any data to be sent for transmission. */
         ch_tx(ch);
 
@@ -2091,12 +2283,10 @@ static void ch_rx_handle_packet(QUIC_CHANNEL *ch, int channel_only)
             return;
 
         /*
-         * TODO(QUIC 0RTT): Implement 0-RTT on the server side. We currently
-         * do not need to implement this as a client can only do 0-RTT if we
-         * have given it permission to in a previous session.
+         * The QRX only has 0-RTT keys if we accepted early data. The RXDP
+         * checks that only frames permitted in 0-RTT packets are present.
          */
-        break;
-
+        /* fall through */
     case QUIC_PKT_TYPE_INITIAL:
     case QUIC_PKT_TYPE_HANDSHAKE:
     case QUIC_PKT_TYPE_1RTT:
@@ -2419,6 +2609,303 @@ int ossl_quic_channel_start(QUIC_CHANNEL *ch)
     return 1;
 }
 
+/*
+ * Applies the limits remembered from the transport parameters of the server in
+ * a previous connection, which a client must use when sending 0-RTT data (RFC
+ * 9000 s. 7.4.1). Other parameters are only used once the handshake provides
+ * them again.
+ */
+static int ch_apply_remembered_tparams(QUIC_CHANNEL *ch,
+                                       const unsigned char *params,
+                                       size_t params_len)
+{
+    PACKET pkt;
+    uint64_t id, v;
+    size_t len;
+
+    if (!PACKET_buf_init(&pkt, params, params_len))
+        return 0;
+
+    while (PACKET_remaining(&pkt) > 0) {
+        if (!ossl_quic_wire_peek_transport_param(&pkt, &id))
+            return 0;
+
+        switch (id) {
+        case QUIC_TPARAM_INITIAL_MAX_DATA:
+        case QUIC_TPARAM_INITIAL_MAX_STREAM_DATA_BIDI_LOCAL:
+        case QUIC_TPARAM_INITIAL_MAX_STREAM_DATA_BIDI_REMOTE:
+        case QUIC_TPARAM_INITIAL_MAX_STREAM_DATA_UNI:
+        case QUIC_TPARAM_INITIAL_MAX_STREAMS_BIDI:
+        case QUIC_TPARAM_INITIAL_MAX_STREAMS_UNI:
+        case QUIC_TPARAM_ACTIVE_CONN_ID_LIMIT:
+            if (!ossl_quic_wire_decode_transport_param_int(&pkt, &id, &v))
+                return 0;
+            break;
+
+        default:
+            if (ossl_quic_wire_decode_transport_param_bytes(&pkt, &id,
+                                                            &len) == NULL)
+                return 0;
+            continue;
+        }
+
+        switch (id) {
+        case QUIC_TPARAM_INITIAL_MAX_DATA:
+            ossl_quic_txfc_bump_cwm(&ch->conn_txfc, v);
+            break;
+        case QUIC_TPARAM_INITIAL_MAX_STREAM_DATA_BIDI_LOCAL:
+            ch->rx_init_max_stream_data_bidi_remote = v;
+            break;
+        case QUIC_TPARAM_INITIAL_MAX_STREAM_DATA_BIDI_REMOTE:
+            ch->rx_init_max_stream_data_bidi_local = v;
+            break;
+        case QUIC_TPARAM_INITIAL_MAX_STREAM_DATA_UNI:
+            ch->rx_init_max_stream_data_uni = v;
+            break;
+        case QUIC_TPARAM_INITIAL_MAX_STREAMS_BIDI:
+            if (v <= (((uint64_t)1) << 60))
+                ch->max_local_streams_bidi = v;
+            break;
+        case QUIC_TPARAM_INITIAL_MAX_STREAMS_UNI:
+            if (v <= (((uint64_t)1) << 60))
+                ch->max_local_streams_uni = v;
+            break;
+        case QUIC_TPARAM_ACTIVE_CONN_ID_LIMIT:
+            if (v >= QUIC_MIN_ACTIVE_CONN_ID_LIMIT)
+                ch->rx_active_conn_id_limit = v;
+            break;
+        }
+    }
+
+    return 1;
+}
+
+int ossl_quic_channel_enable_early_data(QUIC_CHANNEL *ch)
+{
+    const unsigned char *params;
+    size_t params_len;
+
+    if (ch->is_server || ch->state != QUIC_CHANNEL_STATE_IDLE)
+        return 0;
+
+    if (ch->doing_early_data)
+        return 1;
+
+    if (!ossl_quic_tls_get0_early_data_tparams(ch->qtls, &params, &params_len)
+        || !ch_apply_remembered_tparams(ch, params, params_len)
+        || !ossl_quic_tls_enable_early_data(ch->qtls))
+        return 0;
+
+    ch->doing_early_data = 1;
+    return 1;
+}
+
+int ossl_quic_channel_is_early_data_writable(const QUIC_CHANNEL *ch)
+{
+    return ch->handshake_complete
+        || (ch->doing_early_data
+            && ossl_qtx_is_enc_level_provisioned(ch->qtx,
+                                                 QUIC_ENC_LEVEL_0RTT));
+}
+
+/*
+ * QUIC Channel: Datagrams
+ * =======================
+ */
+int ossl_quic_channel_set_max_datagram_frame_size(QUIC_CHANNEL *ch,
+                                                  uint64_t max_size)
+{
+    if (ch->state != QUIC_CHANNEL_STATE_IDLE)
+        return 0;
+
+    ch->tx_max_datagram_frame_size = max_size;
+
+    /* A client serializes its transport parameters when it is created. */
+    if (ch->is_server || ch->local_transport_params == NULL)
+        return 1;
+
+    OPENSSL_free(ch->local_transport_params);
+    ch->local_transport_params = NULL;
+    return ch_generate_transport_params(ch);
+}
+
+size_t ossl_quic_channel_get_max_datagram_size(QUIC_CHANNEL *ch)
+{
+    uint64_t max_frame_len;
+    size_t mdpl, payload_len;
+
+    if (!ch->got_remote_transport_params
+        || ch->rx_max_datagram_frame_size == 0
+        || !ossl_quic_channel_is_active(ch))
+        return 0;
+
+    /* DATAGRAM frames are not split, so each must fit in a single packet. */
+    mdpl = ossl_qtx_get_mdpl(ch->qtx);
+    if (mdpl <= MAX_1RTT_HDR_LEN
+        || !ossl_qtx_calculate_plaintext_payload_len(ch->qtx,
+                                                     QUIC_ENC_LEVEL_1RTT,
+                                                     mdpl - MAX_1RTT_HDR_LEN,
+                                                     &payload_len))
+        return 0;
+
+    max_frame_len = ch->rx_max_datagram_frame_size;
+    if (max_frame_len > payload_len)
+        max_frame_len = payload_len;
+
+    /* Leave room for the frame type and length fields. */
+    if (max_frame_len < 2)
+        return 0;
+
+    --max_frame_len;
+    return (size_t)(max_frame_len - ossl_quic_vlint_encode_len(max_frame_len));
+}
+
+int ossl_quic_channel_can_send_datagram(const QUIC_CHANNEL *ch)
+{
+    return ch->dgram_tx_count < MAX_DGRAM_TX_COUNT;
+}
+
+static void ch_free_dgram_frame(unsigned char *buf, size_t buf_len, void *arg)
+{
+    QUIC_CHANNEL *ch = arg;
+
+    --ch->dgram_tx_count;
+    OPENSSL_free(buf);
+}
+
+int ossl_quic_channel_send_datagram(QUIC_CHANNEL *ch, const void *buf,
+                                    size_t len)
+{
+    OSSL_QUIC_FRAME_DATAGRAM f = {0};
+    unsigned char *frame;
+    size_t frame_len, written;
+    WPACKET wpkt;
+
+    if (len > ossl_quic_channel_get_max_datagram_size(ch)
+        || !ossl_quic_channel_can_send_datagram(ch)
+        || (frame_len = ossl_quic_wire_get_encoded_frame_len_datagram(len)) == 0
+        || (frame = OPENSSL_malloc(frame_len)) == NULL)
+        return 0;
+
+    /*
+     * Always encode the length, as the TXP may follow the frame with other
+     * frames in the same packet.
+     */
+    f.data              = buf;
+    f.len               = len;
+    f.has_explicit_len  = 1;
+
+    if (!WPACKET_init_static_len(&wpkt, frame, frame_len, 0))
+        goto err;
+
+    if (!ossl_quic_wire_encode_frame_datagram(&wpkt, &f)
+        || !WPACKET_get_total_written(&wpkt, &written)) {
+        WPACKET_cleanup(&wpkt);
+        goto err;
+    }
+
+    WPACKET_finish(&wpkt);
+
+    /*
+     * DATAGRAM frames are never retransmitted, and a lost one is simply
+     * released by the CFQ. Queue them behind other control frames.
+     */
+    if (ossl_quic_cfq_add_frame(ch->cfq, 2, QUIC_PN_SPACE_APP,
+                                OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN,
+                                QUIC_CFQ_ITEM_FLAG_UNRELIABLE,
+                                frame, written,
+                                ch_free_dgram_frame, ch) == NULL)
+        goto err;
+
+    ++ch->dgram_tx_count;
+    return 1;
+
+err:
+    OPENSSL_free(frame);
+    return 0;
+}
+
+int ossl_quic_channel_on_datagram(QUIC_CHANNEL *ch,
+                                  const OSSL_QUIC_FRAME_DATAGRAM *f,
+                                  size_t frame_len)
+{
+    QUIC_CHANNEL_DGRAM *d;
+
+    /*
+     * RFC 9221 s. 3: Receiving a DATAGRAM frame we did not indicate support
+     * for, or which is larger than we allowed, is a PROTOCOL_VIOLATION.
+     */
+    if (frame_len > ch->tx_max_datagram_frame_size) {
+        ossl_quic_channel_raise_protocol_error(ch,
+                                               QUIC_ERR_PROTOCOL_VIOLATION,
+                                               f->has_explicit_len
+                                               ? OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN
+                                               : OSSL_QUIC_FRAME_TYPE_DATAGRAM,
+                                               ch->tx_max_datagram_frame_size == 0
+                                               ? "DATAGRAM frames not enabled"
+                                               : "DATAGRAM frame too large");
+        return 0;
+    }
+
+    /* Drop the datagram, as the network would, if the application is slow. */
+    if (ch->dgram_rx_count >= MAX_DGRAM_RX_COUNT)
+        return 1;
+
+    if ((d = OPENSSL_malloc(sizeof(*d) + (size_t)f->len)) == NULL)
+        return 1;
+
+    d->next     = NULL;
+    d->data_len = (size_t)f->len;
+    memcpy(d + 1, f->data, d->data_len);
+
+    if (ch->dgram_rx_tail != NULL)
+        ch->dgram_rx_tail->next = d;
+    else
+        ch->dgram_rx_head = d;
+
+    ch->dgram_rx_tail = d;
+    ++ch->dgram_rx_count;
+    return 1;
+}
+
+int ossl_quic_channel_has_pending_datagram(const QUIC_CHANNEL *ch)
+{
+    return ch->dgram_rx_head != NULL;
+}
+
+int ossl_quic_channel_recv_datagram(QUIC_CHANNEL *ch, void *buf,
+                                    size_t buf_len, size_t *readbytes)
+{
+    QUIC_CHANNEL_DGRAM *d = ch->dgram_rx_head;
+
+    if (d == NULL)
+        return 0;
+
+    *readbytes = d->data_len < buf_len ? d->data_len : buf_len;
+    memcpy(buf, d + 1, *readbytes);
+
+    ch->dgram_rx_head = d->next;
+    if (ch->dgram_rx_head == NULL)
+        ch->dgram_rx_tail = NULL;
+
+    --ch->dgram_rx_count;
+    OPENSSL_free(d);
+    return 1;
+}
+
+static void ch_dgram_rx_clear(QUIC_CHANNEL *ch)
+{
+    QUIC_CHANNEL_DGRAM *d, *dnext;
+
+    for (d = ch->dgram_rx_head; d != NULL; d = dnext) {
+        dnext = d->next;
+        OPENSSL_free(d);
+    }
+
+    ch->dgram_rx_head = ch->dgram_rx_tail = NULL;
+    ch->dgram_rx_count = 0;
+}
+
 /* Start a locally initiated connection shutdown. */
 void ossl_quic_channel_local_close(QUIC_CHANNEL *ch, uint64_t app_error_code,
                                    const char *app_reason)
@@ -2908,6 +3395,103 @@ void ossl_quic_channel_on_new_conn_id(QUIC_CHANNEL *ch,
     }
 }
 
+void ossl_quic_channel_on_ack_frequency(QUIC_CHANNEL *ch,
+                                        const OSSL_QUIC_FRAME_ACK_FREQUENCY *f)
+{
+    if (!ossl_quic_channel_is_active(ch))
+        return;
+
+    /*
+     * draft-ietf-quic-ack-frequency s. 4: A Request Max Ack Delay below the
+     * min_ack_delay we advertised is a PROTOCOL_VIOLATION.
+     */
+    if (ossl_time_compare(f->max_ack_delay, ossl_us2time(MIN_ACK_DELAY_US)) < 0) {
+        ossl_quic_channel_raise_protocol_error(ch,
+                                               QUIC_ERR_PROTOCOL_VIOLATION,
+                                               OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY,
+                                               "max ack delay below min_ack_delay");
+        return;
+    }
+
+    /* Frames may be reordered; only the most recent one applies. */
+    if (f->seq_num < ch->rx_ack_freq_next_seq_num)
+        return;
+
+    ch->rx_ack_freq_next_seq_num = f->seq_num + 1;
+    ossl_ackm_set_ack_frequency(ch->ackm, f->ack_eliciting_threshold,
+                                f->max_ack_delay, f->reordering_threshold);
+}
+
+/*
+ * Asks the peer to change how often it acknowledges our packets, if it supports
+ * the ACK frequency extension and the size of our congestion window warrants a
+ * different ACK-eliciting threshold than the one we last requested. The
+ * threshold is kept to one less than a power of two, so a new ACK_FREQUENCY
+ * frame is sent only when the window has roughly doubled or halved.
+ *
+ * We keep the peer's own max_ack_delay, so our PTO is unaffected, and a
+ * reordering threshold of 1, so the peer still reports a missing packet
+ * immediately and loss detection is not delayed.
+ */
+static void ch_update_ack_frequency(QUIC_CHANNEL *ch)
+{
+    OSSL_QUIC_FRAME_ACK_FREQUENCY f;
+    BUF_MEM *buf_mem;
+    WPACKET wpkt;
+    uint64_t pkts_per_ack, threshold = 1;
+    size_t l;
+
+    if (!ch->handshake_confirmed
+        || ch->rx_min_ack_delay == UINT64_MAX
+        || ch->cc_max_dgram_payload_len == 0
+        || !ossl_quic_channel_is_active(ch))
+        return;
+
+    pkts_per_ack = ch->cc_cwnd
+        / (ACK_FREQ_ACKS_PER_CWND * (uint64_t)ch->cc_max_dgram_payload_len);
+
+    while (threshold * 2 + 1 <= ACK_FREQ_MAX_THRESHOLD
+           && threshold * 2 + 2 <= pkts_per_ack)
+        threshold = threshold * 2 + 1;
+
+    if (threshold == ch->tx_ack_freq_threshold)
+        return;
+
+    f.seq_num                   = ch->tx_ack_freq_next_seq_num;
+    f.ack_eliciting_threshold   = threshold;
+    f.max_ack_delay             = ossl_ms2time(ch->rx_max_ack_delay);
+    f.reordering_threshold      = 1;
+
+    if ((buf_mem = BUF_MEM_new()) == NULL)
+        return;
+
+    if (!WPACKET_init(&wpkt, buf_mem))
+        goto out;
+
+    if (!ossl_quic_wire_encode_frame_ack_frequency(&wpkt, &f)) {
+        WPACKET_cleanup(&wpkt);
+        goto out;
+    }
+
+    WPACKET_finish(&wpkt);
+    if (!WPACKET_get_total_written(&wpkt, &l))
+        goto out;
+
+    if (ossl_quic_cfq_add_frame(ch->cfq, 1, QUIC_PN_SPACE_APP,
+                                OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY, 0,
+                                (unsigned char *)buf_mem->data, l,
+                                free_frame_data, NULL) == NULL)
+        goto out;
+
+    buf_mem->data = NULL;
+    ++ch->tx_ack_freq_next_seq_num;
+    ch->tx_ack_freq_threshold = threshold;
+
+    /* On failure, we simply try again on the next tick. */
+out:
+    BUF_MEM_free(buf_mem);
+}
+
 static void ch_save_err_state(QUIC_CHANNEL *ch)
 {
     if (ch->err_state == NULL)
@@ -3196,11 +3780,11 @@ static int ch_init_new_stream(QUIC_CHANNEL *ch, QUIC_STREAM *qs,
     if (!ossl_quic_txfc_init(&qs->txfc, &ch->conn_txfc))
         goto err;
 
-    if (ch->got_remote_transport_params) {
+    if (ch->got_remote_transport_params || ch->doing_early_data) {
         /*
-         * If we already got peer TPs we need to apply the initial CWM credit
-         * now. If we didn't already get peer TPs this will be done
-         * automatically for all extant streams when we do.
+         * If we already got peer TPs, or remembered them for 0-RTT, we need to
+         * apply the initial CWM credit now. If we didn't already get peer TPs
+         * this will be done automatically for all extant streams when we do.
          */
         if (can_send) {
             uint64_t cwm;
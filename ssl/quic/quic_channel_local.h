@@ -11,6 +11,15 @@
 #  include "internal/quic_fc.h"
 #  include "internal/quic_stream_map.h"
 
+/* A received DATAGRAM frame payload (RFC 9221) not yet read by the application. */
+typedef struct quic_channel_dgram_st QUIC_CHANNEL_DGRAM;
+
+struct quic_channel_dgram_st {
+    QUIC_CHANNEL_DGRAM              *next;
+    size_t                          data_len;
+    /* The payload follows. */
+};
+
 /*
  * QUIC Channel Structure
  * ======================
@@ -36,6 +45,12 @@ struct quic_channel_st {
      */
     OSSL_LIST_MEMBER(ch, struct quic_channel_st);
 
+    /*
+     * Incoming channels not yet handed to the application are also kept on a
+     * queue by the QUIC_PORT.
+     */
+    OSSL_LIST_MEMBER(incoming_ch, struct quic_channel_st);
+
     /*
      * The associated TLS 1.3 connection data. Used to provide the handshake
      * layer; its 'network' side is plugged into the crypto stream for each EL
@@ -139,6 +154,39 @@ struct quic_channel_st {
     uint64_t                        rx_max_ack_delay; /* ms */
     unsigned char                   rx_ack_delay_exp;
 
+    /* The peer's min_ack_delay, or UINT64_MAX if it did not send one. */
+    uint64_t                        rx_min_ack_delay; /* us */
+
+    /*
+     * The max_datagram_frame_size we advertise, and that advertised by the
+     * peer. Zero means DATAGRAM frames (RFC 9221) are not accepted.
+     */
+    uint64_t                        tx_max_datagram_frame_size;
+    uint64_t                        rx_max_datagram_frame_size;
+
+    /*
+     * Received datagrams waiting to be read by the application, oldest first.
+     * dgram_tx_count is the number of DATAGRAM frames we have handed to the
+     * CFQ and which it has not yet released, whether queued or in flight.
+     */
+    QUIC_CHANNEL_DGRAM              *dgram_rx_head, *dgram_rx_tail;
+    size_t                          dgram_rx_count;
+    size_t                          dgram_tx_count;
+
+    /*
+     * ACK frequency (draft-ietf-quic-ack-frequency) state. ACK_FREQUENCY frames
+     * with a sequence number below rx_ack_freq_next_seq_num are stale and are
+     * ignored. tx_ack_freq_threshold is the ACK-eliciting threshold we most
+     * recently asked the peer to use.
+     */
+    uint64_t                        rx_ack_freq_next_seq_num;
+    uint64_t                        tx_ack_freq_next_seq_num;
+    uint64_t                        tx_ack_freq_threshold;
+
+    /* Congestion controller state, bound as CC diagnostics. */
+    uint64_t                        cc_cwnd;
+    size_t                          cc_max_dgram_payload_len;
+
     /*
      * Temporary staging area to store information about the incoming packet we
      * are currently processing.
@@ -246,6 +294,13 @@ struct quic_channel_st {
      */
     QUIC_PN                         rxku_trigger_pn;
 
+    /*
+     * The first application space PN sent with 1-RTT keys. Valid if
+     * doing_early_data is set and the 0-RTT EL has been discarded. Every lower
+     * application space PN was used by a 0-RTT packet.
+     */
+    QUIC_PN                         early_data_pn_end;
+
     /*
      * State tracking. QUIC connection-level state is best represented based on
      * whether various things have happened yet or not, rather than as an
@@ -425,6 +480,9 @@ struct quic_channel_st {
     /* Are we on the QUIC_PORT linked list of channels? */
     unsigned int                    on_port_list                        : 1;
 
+    /* Have we offered 0-RTT in the ClientHello? (client only) */
+    unsigned int                    doing_early_data                    : 1;
+
     /* Saved error stack in case permanent error was encountered */
     ERR_STATE                       *err_state;
 
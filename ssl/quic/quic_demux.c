@@ -19,6 +19,13 @@
 
 #define DEMUX_MAX_MSGS_PER_CALL    32
 
+/*
+ * With generic receive offload (GRO), a message may hold up to 64 KiB of
+ * coalesced datagrams, so only a few are received at a time.
+ */
+#define DEMUX_MAX_GRO_MSGS_PER_CALL 4
+#define DEMUX_GRO_BUF_LEN           65535
+
 #define DEMUX_DEFAULT_MTU        1500
 
 struct quic_demux_st {
@@ -63,8 +70,33 @@ struct quic_demux_st {
 
     /* Whether to use local address support. */
     char                        use_local_addr;
+
+    /*
+     * Whether the BIO does UDP generic receive offload, and the buffers
+     * messages are received into before being split into URXEs if so.
+     */
+    char                        use_gro;
+    unsigned char              *gro_buf;
 };
 
+/* Enables generic receive offload on the BIO if it supports it. */
+static void demux_update_gro(QUIC_DEMUX *demux)
+{
+    uint32_t offload;
+
+    demux->use_gro = 0;
+    if (demux->net_bio == NULL
+        || (BIO_dgram_get_segment_offload_cap(demux->net_bio)
+            & BIO_DGRAM_SEGMENT_OFFLOAD_RX) == 0)
+        return;
+
+    offload = BIO_dgram_get_segment_offload(demux->net_bio);
+    demux->use_gro
+        = BIO_dgram_set_segment_offload(demux->net_bio,
+                                        offload | BIO_DGRAM_SEGMENT_OFFLOAD_RX)
+          == 1;
+}
+
 QUIC_DEMUX *ossl_quic_demux_new(BIO *net_bio,
                                 size_t short_conn_id_len,
                                 OSSL_TIME (*now)(void *arg),
@@ -88,6 +120,7 @@ QUIC_DEMUX *ossl_quic_demux_new(BIO *net_bio,
         && BIO_dgram_set_local_addr_enable(net_bio, 1))
         demux->use_local_addr = 1;
 
+    demux_update_gro(demux);
     return demux;
 }
 
@@ -111,6 +144,7 @@ void ossl_quic_demux_free(QUIC_DEMUX *demux)
     demux_free_urxl(&demux->urx_free);
     demux_free_urxl(&demux->urx_pending);
 
+    OPENSSL_free(demux->gro_buf);
     OPENSSL_free(demux);
 }
 
@@ -119,6 +153,7 @@ void ossl_quic_demux_set_bio(QUIC_DEMUX *demux, BIO *net_bio)
     unsigned int mtu;
 
     demux->net_bio = net_bio;
+    demux_update_gro(demux);
 
     if (net_bio != NULL) {
         /*
@@ -141,6 +176,12 @@ int ossl_quic_demux_set_mtu(QUIC_DEMUX *demux, unsigned int mtu)
     return 1;
 }
 
+void ossl_quic_demux_set_short_conn_id_len(QUIC_DEMUX *demux,
+                                           size_t short_conn_id_len)
+{
+    demux->short_conn_id_len = short_conn_id_len;
+}
+
 void ossl_quic_demux_set_default_handler(QUIC_DEMUX *demux,
                                          ossl_quic_demux_cb_fn *cb,
                                          void *cb_arg)
@@ -220,6 +261,102 @@ static int demux_ensure_free_urxe(QUIC_DEMUX *demux, size_t min_num_free)
     return 1;
 }
 
+/* Calls BIO_recvmmsg, returning one of the QUIC_DEMUX_PUMP_RES_* values. */
+static int demux_recvmmsg(QUIC_DEMUX *demux, BIO_MSG *msg, size_t num_msg,
+                          size_t *rd)
+{
+    ERR_set_mark();
+    if (!BIO_recvmmsg(demux->net_bio, msg, sizeof(BIO_MSG), num_msg, 0, rd)) {
+        if (BIO_err_is_non_fatal(ERR_peek_last_error())) {
+            /* Transient error, clear the error and stop. */
+            ERR_pop_to_mark();
+            return QUIC_DEMUX_PUMP_RES_TRANSIENT_FAIL;
+        } else {
+            /* Non-transient error, do not clear the error. */
+            ERR_clear_last_mark();
+            return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
+        }
+    }
+
+    ERR_clear_last_mark();
+    return QUIC_DEMUX_PUMP_RES_OK;
+}
+
+/*
+ * Receive datagrams from network when generic receive offload is in use. Each
+ * message then holds one or more datagrams of segment_size bytes, the last of
+ * which may be shorter, and is received into a buffer large enough for any
+ * message and split into URXEs afterwards.
+ */
+static int demux_recv_gro(QUIC_DEMUX *demux)
+{
+    BIO_MSG msg[DEMUX_MAX_GRO_MSGS_PER_CALL];
+    BIO_ADDR peer[DEMUX_MAX_GRO_MSGS_PER_CALL];
+    BIO_ADDR local[DEMUX_MAX_GRO_MSGS_PER_CALL];
+    size_t rd, i, off, len, seg_len;
+    QUIC_URXE *urxe;
+    OSSL_TIME now;
+    int ret;
+
+    if (demux->gro_buf == NULL) {
+        demux->gro_buf = OPENSSL_malloc(DEMUX_GRO_BUF_LEN
+                                        * DEMUX_MAX_GRO_MSGS_PER_CALL);
+        if (demux->gro_buf == NULL)
+            return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
+    }
+
+    for (i = 0; i < OSSL_NELEM(msg); ++i) {
+        memset(&msg[i], 0, sizeof(BIO_MSG));
+        msg[i].data     = demux->gro_buf + i * DEMUX_GRO_BUF_LEN;
+        msg[i].data_len = DEMUX_GRO_BUF_LEN;
+        msg[i].peer     = &peer[i];
+        BIO_ADDR_clear(&peer[i]);
+        BIO_ADDR_clear(&local[i]);
+        if (demux->use_local_addr)
+            msg[i].local = &local[i];
+    }
+
+    ret = demux_recvmmsg(demux, msg, OSSL_NELEM(msg), &rd);
+    if (ret != QUIC_DEMUX_PUMP_RES_OK)
+        return ret;
+
+    now = demux->now != NULL ? demux->now(demux->now_arg) : ossl_time_zero();
+
+    for (i = 0; i < rd; ++i) {
+        seg_len = msg[i].segment_size > 0 ? msg[i].segment_size
+                                          : msg[i].data_len;
+        off = 0;
+        do {
+            len = msg[i].data_len - off;
+            if (len > seg_len)
+                len = seg_len;
+
+            if (!demux_ensure_free_urxe(demux, 1))
+                return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
+
+            urxe = ossl_list_urxe_head(&demux->urx_free);
+            urxe = demux_reserve_urxe(demux, urxe, len);
+            if (urxe == NULL)
+                return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
+
+            memcpy(ossl_quic_urxe_data(urxe),
+                   (unsigned char *)msg[i].data + off, len);
+            urxe->data_len  = len;
+            urxe->peer      = peer[i];
+            urxe->local     = local[i];
+            urxe->time      = now;
+            off            += len;
+
+            /* Move from free list to pending list. */
+            ossl_list_urxe_remove(&demux->urx_free, urxe);
+            ossl_list_urxe_insert_tail(&demux->urx_pending, urxe);
+            urxe->demux_state = URXE_DEMUX_STATE_PENDING;
+        } while (off < msg[i].data_len);
+    }
+
+    return QUIC_DEMUX_PUMP_RES_OK;
+}
+
 /*
  * Receive datagrams from network, placing them into URXEs.
  *
@@ -234,6 +371,7 @@ static int demux_recv(QUIC_DEMUX *demux)
     size_t rd, i;
     QUIC_URXE *urxe = ossl_list_urxe_head(&demux->urx_free), *unext;
     OSSL_TIME now;
+    int ret;
 
     /* This should never be called when we have any pending URXE. */
     assert(ossl_list_urxe_head(&demux->urx_pending) == NULL);
@@ -245,6 +383,9 @@ static int demux_recv(QUIC_DEMUX *demux)
          */
         return QUIC_DEMUX_PUMP_RES_TRANSIENT_FAIL;
 
+    if (demux->use_gro)
+        return demux_recv_gro(demux);
+
     /*
      * Opportunistically receive as many messages as possible in a single
      * syscall, determined by how many free URXEs are available.
@@ -277,20 +418,10 @@ static int demux_recv(QUIC_DEMUX *demux)
             BIO_ADDR_clear(&urxe->local);
     }
 
-    ERR_set_mark();
-    if (!BIO_recvmmsg(demux->net_bio, msg, sizeof(BIO_MSG), i, 0, &rd)) {
-        if (BIO_err_is_non_fatal(ERR_peek_last_error())) {
-            /* Transient error, clear the error and stop. */
-            ERR_pop_to_mark();
-            return QUIC_DEMUX_PUMP_RES_TRANSIENT_FAIL;
-        } else {
-            /* Non-transient error, do not clear the error. */
-            ERR_clear_last_mark();
-            return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
-        }
-    }
+    ret = demux_recvmmsg(demux, msg, i, &rd);
+    if (ret != QUIC_DEMUX_PUMP_RES_OK)
+        return ret;
 
-    ERR_clear_last_mark();
     now = demux->now != NULL ? demux->now(demux->now_arg) : ossl_time_zero();
 
     urxe = ossl_list_urxe_head(&demux->urx_free);
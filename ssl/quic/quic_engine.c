@@ -62,6 +62,7 @@ static int qeng_init(QUIC_ENGINE *qeng)
 static void qeng_cleanup(QUIC_ENGINE *qeng)
 {
     assert(ossl_list_port_num(&qeng->port_list) == 0);
+    assert(qeng->worker == NULL);
 }
 
 QUIC_REACTOR *ossl_quic_engine_get0_reactor(QUIC_ENGINE *qeng)
@@ -108,6 +109,93 @@ QUIC_PORT *ossl_quic_engine_create_port(QUIC_ENGINE *qeng,
     return ossl_quic_port_new(&largs);
 }
 
+/*
+ * QUIC Engine: Worker Threads
+ * ===========================
+ */
+
+#if defined(OPENSSL_THREADS)
+
+static int qeng_worker_should_exit(void *arg)
+{
+    QUIC_ENGINE *qeng = arg;
+
+    return qeng->worker_teardown;
+}
+
+/* Main loop for the worker thread of an engine. */
+static unsigned int qeng_worker_main(void *arg)
+{
+    QUIC_ENGINE *qeng = arg;
+
+    ossl_crypto_mutex_lock(qeng->mutex);
+
+    while (!qeng->worker_teardown)
+        if (!ossl_quic_reactor_block_until_pred(&qeng->rtor,
+                                                qeng_worker_should_exit, qeng,
+                                                0, qeng->mutex)) {
+            /*
+             * The poll failed for some reason other than a timeout. Back off
+             * rather than spinning; the next tick will retry any network I/O.
+             */
+            ossl_crypto_mutex_unlock(qeng->mutex);
+            OSSL_sleep(ossl_time2ms(QUIC_ENGINE_WORKER_MAX_WAIT));
+            ossl_crypto_mutex_lock(qeng->mutex);
+        }
+
+    ossl_crypto_mutex_unlock(qeng->mutex);
+    return 1;
+}
+
+#endif
+
+QUIC_NEEDS_LOCK
+int ossl_quic_engine_start_worker(QUIC_ENGINE *qeng)
+{
+#if defined(OPENSSL_THREADS)
+    if (qeng->worker != NULL)
+        return 1;
+
+    if (qeng->mutex == NULL)
+        return 0;
+
+    qeng->worker_teardown = 0;
+    qeng->worker = ossl_crypto_thread_native_start(qeng_worker_main, qeng,
+                                                   /*joinable=*/1);
+    return qeng->worker != NULL;
+#else
+    return 0;
+#endif
+}
+
+QUIC_NEEDS_LOCK
+int ossl_quic_engine_stop_worker(QUIC_ENGINE *qeng)
+{
+#if defined(OPENSSL_THREADS)
+    CRYPTO_THREAD_RETVAL rv;
+    int ok;
+
+    if (qeng->worker == NULL)
+        return 1;
+
+    /* The worker notices this within QUIC_ENGINE_WORKER_MAX_WAIT. */
+    qeng->worker_teardown = 1;
+
+    ossl_crypto_mutex_unlock(qeng->mutex);
+    ok = ossl_crypto_thread_native_join(qeng->worker, &rv);
+    ossl_crypto_mutex_lock(qeng->mutex);
+
+    if (!ok)
+        return 0;
+
+    ossl_crypto_thread_native_clean(qeng->worker);
+    qeng->worker = NULL;
+    return 1;
+#else
+    return 1;
+#endif
+}
+
 /*
  * QUIC Engine: Ticker-Mutator
  * ==========================
@@ -127,14 +215,19 @@ static void qeng_tick(QUIC_TICK_RESULT *res, void *arg, uint32_t flags)
     res->net_write_desired  = 0;
     res->tick_deadline      = ossl_time_infinite();
 
-    if (qeng->inhibit_tick)
-        return;
-
-    /* Iterate through all ports and service them. */
-    LIST_FOREACH(port, port, &qeng->port_list) {
-        QUIC_TICK_RESULT subr = {0};
-
-        ossl_quic_port_subtick(port, &subr, flags);
-        ossl_quic_tick_result_merge_into(res, &subr);
-    }
+    if (!qeng->inhibit_tick)
+        /* Iterate through all ports and service them. */
+        LIST_FOREACH(port, port, &qeng->port_list) {
+            QUIC_TICK_RESULT subr = {0};
+
+            ossl_quic_port_subtick(port, &subr, flags);
+            ossl_quic_tick_result_merge_into(res, &subr);
+        }
+
+    /* Ensure a worker thread keeps an eye on the world (see quic_engine.h). */
+    if (qeng->worker != NULL)
+        res->tick_deadline
+            = ossl_time_min(res->tick_deadline,
+                            ossl_time_add(ossl_quic_engine_get_time(qeng),
+                                          QUIC_ENGINE_WORKER_MAX_WAIT));
 }
@@ -12,6 +12,7 @@
 
 # include "internal/quic_engine.h"
 # include "internal/quic_reactor.h"
+# include "internal/thread_arch.h"
 
 # ifndef OPENSSL_NO_QUIC
 
@@ -50,8 +51,14 @@ struct quic_engine_st {
     /* List of all child ports. */
     OSSL_LIST(port)                 port_list;
 
+    /* Worker thread servicing the engine, if any. */
+    CRYPTO_THREAD                   *worker;
+
     /* Inhibit tick for testing purposes? */
     unsigned int                    inhibit_tick                    : 1;
+
+    /* Has the worker thread been asked to exit? */
+    unsigned int                    worker_teardown                 : 1;
 };
 
 # endif
@@ -17,11 +17,13 @@
 #include "internal/quic_error.h"
 #include "internal/quic_engine.h"
 #include "internal/quic_port.h"
+#include "internal/quic_lcidm.h"
 #include "internal/time.h"
 
 typedef struct qctx_st QCTX;
 
 static void aon_write_finish(QUIC_XSO *xso);
+static void xso_clear_read_borrow(QUIC_XSO *xso);
 static int create_channel(QUIC_CONNECTION *qc);
 static QUIC_XSO *create_xso_from_stream(QUIC_CONNECTION *qc, QUIC_STREAM *qs);
 static int qc_try_create_default_xso_for_write(QCTX *ctx);
@@ -40,6 +42,12 @@ static int quic_validate_for_write(QUIC_XSO *xso, int *err);
 static int quic_mutation_allowed(QUIC_CONNECTION *qc, int req_active);
 static int qc_blocking_mode(const QUIC_CONNECTION *qc);
 static int xso_blocking_mode(const QUIC_XSO *xso);
+static void qc_init_defaults(QUIC_CONNECTION *qc);
+static void qc_update_blocking_mode(QUIC_CONNECTION *qc);
+static void ql_lock(QUIC_LISTENER *ql);
+static void ql_unlock(QUIC_LISTENER *ql);
+static void ql_free(QUIC_LISTENER *ql);
+static void ql_update_blocking_mode(QUIC_LISTENER *ql);
 
 /*
  * QUIC Front-End I/O API: Common Utilities
@@ -110,6 +118,8 @@ struct qctx_st {
     QUIC_CONNECTION *qc;
     QUIC_XSO        *xso;
     int             is_stream, in_io;
+    /* Is this a 0-RTT write, which need not wait for the handshake? */
+    int             in_early;
 };
 
 QUIC_NEEDS_LOCK
@@ -214,6 +224,7 @@ static int expect_quic(const SSL *s, QCTX *ctx)
         ctx->xso        = qc->default_xso;
         ctx->is_stream  = 0;
         ctx->in_io      = 0;
+        ctx->in_early   = 0;
         return 1;
 
     case SSL_TYPE_QUIC_XSO:
@@ -222,8 +233,13 @@ static int expect_quic(const SSL *s, QCTX *ctx)
         ctx->xso        = xso;
         ctx->is_stream  = 1;
         ctx->in_io      = 0;
+        ctx->in_early   = 0;
         return 1;
 
+    case SSL_TYPE_QUIC_LISTENER:
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_UNSUPPORTED,
+                                           "not supported on a listener");
+
     default:
         return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
     }
@@ -240,12 +256,14 @@ static int expect_quic(const SSL *s, QCTX *ctx)
  * Channel mutex is acquired and retained on success.
  */
 QUIC_ACQUIRES_LOCK
-static int ossl_unused expect_quic_with_stream_lock(const SSL *s, int remote_init,
-                                                    int in_io, QCTX *ctx)
+static int expect_quic_with_stream_lock_ex(const SSL *s, int remote_init,
+                                           int in_io, int in_early, QCTX *ctx)
 {
     if (!expect_quic(s, ctx))
         return 0;
 
+    ctx->in_early = in_early;
+
     if (in_io)
         quic_lock_for_io(ctx);
     else
@@ -285,6 +303,14 @@ err:
     return 0;
 }
 
+QUIC_ACQUIRES_LOCK
+static int ossl_unused expect_quic_with_stream_lock(const SSL *s, int remote_init,
+                                                    int in_io, QCTX *ctx)
+{
+    return expect_quic_with_stream_lock_ex(s, remote_init, in_io,
+                                           /*in_early=*/0, ctx);
+}
+
 /*
  * Like expect_quic(), but fails if called on a QUIC_XSO. ctx->xso may still
  * be non-NULL if the QCSO has a default stream.
@@ -374,6 +400,18 @@ static int quic_mutation_allowed(QUIC_CONNECTION *qc, int req_active)
  *
  */
 
+/* Initialises the API personality layer settings of a new QUIC_CONNECTION. */
+static void qc_init_defaults(QUIC_CONNECTION *qc)
+{
+    qc->default_stream_mode     = SSL_DEFAULT_STREAM_MODE_AUTO_BIDI;
+    qc->default_ssl_mode        = qc->ssl.ctx->mode;
+    qc->default_ssl_options     = qc->ssl.ctx->options & OSSL_QUIC_PERMITTED_OPTIONS;
+    qc->desires_blocking        = 1;
+    qc->blocking                = 0;
+    qc->incoming_stream_policy  = SSL_INCOMING_STREAM_POLICY_AUTO;
+    qc->last_error              = SSL_ERROR_NONE;
+}
+
 /* SSL_new */
 SSL *ossl_quic_new(SSL_CTX *ctx)
 {
@@ -381,6 +419,13 @@ SSL *ossl_quic_new(SSL_CTX *ctx)
     SSL *ssl_base = NULL;
     SSL_CONNECTION *sc = NULL;
 
+    /* Server connections can only be obtained from a listener. */
+    if (ctx->method == OSSL_QUIC_server_method()) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                    "use SSL_new_listener()");
+        return NULL;
+    }
+
     qc = OPENSSL_zalloc(sizeof(*qc));
     if (qc == NULL) {
         QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
@@ -419,16 +464,10 @@ SSL *ossl_quic_new(SSL_CTX *ctx)
         = (ssl_base->method == OSSL_QUIC_client_thread_method());
 #endif
 
-    qc->as_server       = 0; /* TODO(QUIC SERVER): add server support */
+    qc->as_server       = 0;
     qc->as_server_state = qc->as_server;
 
-    qc->default_stream_mode     = SSL_DEFAULT_STREAM_MODE_AUTO_BIDI;
-    qc->default_ssl_mode        = qc->ssl.ctx->mode;
-    qc->default_ssl_options     = qc->ssl.ctx->options & OSSL_QUIC_PERMITTED_OPTIONS;
-    qc->desires_blocking        = 1;
-    qc->blocking                = 0;
-    qc->incoming_stream_policy  = SSL_INCOMING_STREAM_POLICY_AUTO;
-    qc->last_error              = SSL_ERROR_NONE;
+    qc_init_defaults(qc);
 
     if (!create_channel(qc))
         goto err;
@@ -467,8 +506,14 @@ QUIC_TAKES_LOCK
 void ossl_quic_free(SSL *s)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
     int is_default;
 
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_free(ql);
+        return;
+    }
+
     /* We should never be called on anything but a QSO. */
     if (!expect_quic(s, &ctx))
         return;
@@ -486,6 +531,8 @@ void ossl_quic_free(SSL *s)
         assert(ctx.qc->num_xso > 0);
         --ctx.qc->num_xso;
 
+        xso_clear_read_borrow(ctx.xso);
+
         /* If a stream's send part has not been finished, auto-reset it. */
         if ((   ctx.xso->stream->send_state == QUIC_SSTREAM_STATE_READY
              || ctx.xso->stream->send_state == QUIC_SSTREAM_STATE_SEND)
@@ -547,6 +594,17 @@ void ossl_quic_free(SSL *s)
     SSL_free(ctx.qc->tls);
 
     ossl_quic_channel_free(ctx.qc->ch);
+
+    if (ctx.qc->listener != NULL) {
+        /*
+         * The engine, port and mutex belong to the listener, on which we hold
+         * a reference.
+         */
+        quic_unlock(ctx.qc);
+        SSL_free(&ctx.qc->listener->ssl);
+        return;
+    }
+
     ossl_quic_port_free(ctx.qc->port);
     ossl_quic_engine_free(ctx.qc->engine);
 
@@ -873,6 +931,23 @@ static void qc_update_blocking_mode(QUIC_CONNECTION *qc)
 void ossl_quic_conn_set0_net_rbio(SSL *s, BIO *net_rbio)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        if (ql->net_rbio != net_rbio
+            && ossl_quic_port_set_net_rbio(ql->port, net_rbio)) {
+            BIO_free_all(ql->net_rbio);
+            ql->net_rbio = net_rbio;
+
+            if (net_rbio != NULL)
+                BIO_set_nbio(net_rbio, 1); /* best effort autoconfig */
+
+            ql_update_blocking_mode(ql);
+        }
+        ql_unlock(ql);
+        return;
+    }
 
     if (!expect_quic(s, &ctx))
         return;
@@ -880,6 +955,13 @@ void ossl_quic_conn_set0_net_rbio(SSL *s, BIO *net_rbio)
     if (ctx.qc->net_rbio == net_rbio)
         return;
 
+    /* The network BIOs of an accepted connection belong to its listener. */
+    if (ctx.qc->listener != NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                    NULL);
+        return;
+    }
+
     if (!ossl_quic_port_set_net_rbio(ctx.qc->port, net_rbio))
         return;
 
@@ -900,6 +982,23 @@ void ossl_quic_conn_set0_net_rbio(SSL *s, BIO *net_rbio)
 void ossl_quic_conn_set0_net_wbio(SSL *s, BIO *net_wbio)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        if (ql->net_wbio != net_wbio
+            && ossl_quic_port_set_net_wbio(ql->port, net_wbio)) {
+            BIO_free_all(ql->net_wbio);
+            ql->net_wbio = net_wbio;
+
+            if (net_wbio != NULL)
+                BIO_set_nbio(net_wbio, 1); /* best effort autoconfig */
+
+            ql_update_blocking_mode(ql);
+        }
+        ql_unlock(ql);
+        return;
+    }
 
     if (!expect_quic(s, &ctx))
         return;
@@ -907,6 +1006,13 @@ void ossl_quic_conn_set0_net_wbio(SSL *s, BIO *net_wbio)
     if (ctx.qc->net_wbio == net_wbio)
         return;
 
+    /* The network BIOs of an accepted connection belong to its listener. */
+    if (ctx.qc->listener != NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                    NULL);
+        return;
+    }
+
     if (!ossl_quic_port_set_net_wbio(ctx.qc->port, net_wbio))
         return;
 
@@ -927,26 +1033,38 @@ void ossl_quic_conn_set0_net_wbio(SSL *s, BIO *net_wbio)
 BIO *ossl_quic_conn_get_net_rbio(const SSL *s)
 {
     QCTX ctx;
+    const QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_CONST_SSL(s)) != NULL)
+        return ql->net_rbio;
 
     if (!expect_quic(s, &ctx))
         return NULL;
 
-    return ctx.qc->net_rbio;
+    return ossl_quic_port_get_net_rbio(ctx.qc->port);
 }
 
 BIO *ossl_quic_conn_get_net_wbio(const SSL *s)
 {
     QCTX ctx;
+    const QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_CONST_SSL(s)) != NULL)
+        return ql->net_wbio;
 
     if (!expect_quic(s, &ctx))
         return NULL;
 
-    return ctx.qc->net_wbio;
+    return ossl_quic_port_get_net_wbio(ctx.qc->port);
 }
 
 int ossl_quic_conn_get_blocking_mode(const SSL *s)
 {
     QCTX ctx;
+    const QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_CONST_SSL(s)) != NULL)
+        return ql->blocking;
 
     if (!expect_quic(s, &ctx))
         return 0;
@@ -962,6 +1080,20 @@ int ossl_quic_conn_set_blocking_mode(SSL *s, int blocking)
 {
     int ret = 0;
     QCTX ctx;
+    QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        ql->desires_blocking = (blocking != 0);
+        ql_update_blocking_mode(ql);
+        ret = (ql->blocking == ql->desires_blocking);
+        ql_unlock(ql);
+
+        /* Cannot enable blocking mode if we do not have pollable FDs. */
+        if (!ret)
+            QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_UNSUPPORTED, NULL);
+        return ret;
+    }
 
     if (!expect_quic(s, &ctx))
         return 0;
@@ -1058,6 +1190,14 @@ QUIC_TAKES_LOCK
 int ossl_quic_handle_events(SSL *s)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        ossl_quic_reactor_tick(ossl_quic_port_get0_reactor(ql->port), 0);
+        ql_unlock(ql);
+        return 1;
+    }
 
     if (!expect_quic(s, &ctx))
         return 0;
@@ -1069,25 +1209,13 @@ int ossl_quic_handle_events(SSL *s)
 }
 
 /*
- * SSL_get_event_timeout. Get the time in milliseconds until the SSL object
- * should next have events handled by the application by calling
- * SSL_handle_events(). tv is set to 0 if the object should have events handled
- * immediately. If no timeout is currently active, *is_infinite is set to 1 and
- * the value of *tv is undefined.
+ * Gets the time until the reactor should next be ticked, as described for
+ * SSL_get_event_timeout() below.
  */
-QUIC_TAKES_LOCK
-int ossl_quic_get_event_timeout(SSL *s, struct timeval *tv, int *is_infinite)
+static void reactor_get_event_timeout(QUIC_REACTOR *rtor, OSSL_TIME now,
+                                      struct timeval *tv, int *is_infinite)
 {
-    QCTX ctx;
-    OSSL_TIME deadline = ossl_time_infinite();
-
-    if (!expect_quic(s, &ctx))
-        return 0;
-
-    quic_lock(ctx.qc);
-
-    deadline
-        = ossl_quic_reactor_get_tick_deadline(ossl_quic_channel_get_reactor(ctx.qc->ch));
+    OSSL_TIME deadline = ossl_quic_reactor_get_tick_deadline(rtor);
 
     if (ossl_time_is_infinite(deadline)) {
         *is_infinite = 1;
@@ -1098,13 +1226,41 @@ int ossl_quic_get_event_timeout(SSL *s, struct timeval *tv, int *is_infinite)
          */
         tv->tv_sec  = 1000000;
         tv->tv_usec = 0;
+        return;
+    }
 
-        quic_unlock(ctx.qc);
+    *tv = ossl_time_to_timeval(ossl_time_subtract(deadline, now));
+    *is_infinite = 0;
+}
+
+/*
+ * SSL_get_event_timeout. Get the time in milliseconds until the SSL object
+ * should next have events handled by the application by calling
+ * SSL_handle_events(). tv is set to 0 if the object should have events handled
+ * immediately. If no timeout is currently active, *is_infinite is set to 1 and
+ * the value of *tv is undefined.
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_get_event_timeout(SSL *s, struct timeval *tv, int *is_infinite)
+{
+    QCTX ctx;
+    QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        reactor_get_event_timeout(ossl_quic_port_get0_reactor(ql->port),
+                                  ossl_quic_port_get_time(ql->port),
+                                  tv, is_infinite);
+        ql_unlock(ql);
         return 1;
     }
 
-    *tv = ossl_time_to_timeval(ossl_time_subtract(deadline, get_time(ctx.qc)));
-    *is_infinite = 0;
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock(ctx.qc);
+    reactor_get_event_timeout(ossl_quic_channel_get_reactor(ctx.qc->ch),
+                              get_time(ctx.qc), tv, is_infinite);
     quic_unlock(ctx.qc);
     return 1;
 }
@@ -1113,30 +1269,46 @@ int ossl_quic_get_event_timeout(SSL *s, struct timeval *tv, int *is_infinite)
 int ossl_quic_get_rpoll_descriptor(SSL *s, BIO_POLL_DESCRIPTOR *desc)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
+    BIO *net_rbio;
 
-    if (!expect_quic(s, &ctx))
-        return 0;
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        net_rbio = ql->net_rbio;
+    } else {
+        if (!expect_quic(s, &ctx))
+            return 0;
 
-    if (desc == NULL || ctx.qc->net_rbio == NULL)
-        return QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
-                                       NULL);
+        net_rbio = ossl_quic_port_get_net_rbio(ctx.qc->port);
+    }
 
-    return BIO_get_rpoll_descriptor(ctx.qc->net_rbio, desc);
+    if (desc == NULL || net_rbio == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           NULL);
+
+    return BIO_get_rpoll_descriptor(net_rbio, desc);
 }
 
 /* SSL_get_wpoll_descriptor */
 int ossl_quic_get_wpoll_descriptor(SSL *s, BIO_POLL_DESCRIPTOR *desc)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
+    BIO *net_wbio;
 
-    if (!expect_quic(s, &ctx))
-        return 0;
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        net_wbio = ql->net_wbio;
+    } else {
+        if (!expect_quic(s, &ctx))
+            return 0;
 
-    if (desc == NULL || ctx.qc->net_wbio == NULL)
-        return QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
-                                       NULL);
+        net_wbio = ossl_quic_port_get_net_wbio(ctx.qc->port);
+    }
 
-    return BIO_get_wpoll_descriptor(ctx.qc->net_wbio, desc);
+    if (desc == NULL || net_wbio == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           NULL);
+
+    return BIO_get_wpoll_descriptor(net_wbio, desc);
 }
 
 /* SSL_net_read_desired */
@@ -1144,8 +1316,16 @@ QUIC_TAKES_LOCK
 int ossl_quic_get_net_read_desired(SSL *s)
 {
     QCTX ctx;
+    QUIC_LISTENER *ql;
     int ret;
 
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        ret = ossl_quic_reactor_net_read_desired(ossl_quic_port_get0_reactor(ql->port));
+        ql_unlock(ql);
+        return ret;
+    }
+
     if (!expect_quic(s, &ctx))
         return 0;
 
@@ -1161,6 +1341,14 @@ int ossl_quic_get_net_write_desired(SSL *s)
 {
     int ret;
     QCTX ctx;
+    QUIC_LISTENER *ql;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+        ret = ossl_quic_reactor_net_write_desired(ossl_quic_port_get0_reactor(ql->port));
+        ql_unlock(ql);
+        return ret;
+    }
 
     if (!expect_quic(s, &ctx))
         return 0;
@@ -1450,6 +1638,7 @@ void ossl_quic_set_accept_state(SSL *s)
 /* SSL_do_handshake */
 struct quic_handshake_wait_args {
     QUIC_CONNECTION     *qc;
+    int                 in_early;
 };
 
 static int tls_wants_non_io_retry(QUIC_CONNECTION *qc)
@@ -1471,7 +1660,9 @@ static int quic_handshake_wait(void *arg)
     if (!quic_mutation_allowed(args->qc, /*req_active=*/1))
         return -1;
 
-    if (ossl_quic_channel_is_handshake_complete(args->qc->ch))
+    if (ossl_quic_channel_is_handshake_complete(args->qc->ch)
+        || (args->in_early
+            && ossl_quic_channel_is_early_data_writable(args->qc->ch)))
         return 1;
 
     if (tls_wants_non_io_retry(args->qc))
@@ -1567,13 +1758,25 @@ static int ensure_channel_started(QCTX *ctx)
     return 1;
 }
 
+/*
+ * Returns 1 if the handshake is far enough along for the operation in ctx to
+ * proceed. For a 0-RTT write, it is enough for 0-RTT keys to be available.
+ */
+QUIC_NEEDS_LOCK
+static int qctx_handshake_done(const QCTX *ctx)
+{
+    return ossl_quic_channel_is_handshake_complete(ctx->qc->ch)
+        || (ctx->in_early
+            && ossl_quic_channel_is_early_data_writable(ctx->qc->ch));
+}
+
 QUIC_NEEDS_LOCK
 static int quic_do_handshake(QCTX *ctx)
 {
     int ret;
     QUIC_CONNECTION *qc = ctx->qc;
 
-    if (ossl_quic_channel_is_handshake_complete(qc->ch))
+    if (qctx_handshake_done(ctx))
         /* Handshake already completed. */
         return 1;
 
@@ -1585,7 +1788,8 @@ static int quic_do_handshake(QCTX *ctx)
         return -1; /* Non-protocol error */
     }
 
-    if (qc->net_rbio == NULL || qc->net_wbio == NULL) {
+    if (qc->listener == NULL
+        && (qc->net_rbio == NULL || qc->net_wbio == NULL)) {
         /* Need read and write BIOs. */
         QUIC_RAISE_NON_NORMAL_ERROR(ctx, SSL_R_BIO_NOT_SET, NULL);
         return -1; /* Non-protocol error */
@@ -1672,7 +1876,7 @@ static int quic_do_handshake(QCTX *ctx)
     if (!ensure_channel_started(ctx)) /* raises on failure */
         return -1; /* Non-protocol error */
 
-    if (ossl_quic_channel_is_handshake_complete(qc->ch))
+    if (qctx_handshake_done(ctx))
         /* The handshake is now done. */
         return 1;
 
@@ -1680,7 +1884,7 @@ static int quic_do_handshake(QCTX *ctx)
         /* Try to advance the reactor. */
         ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(qc->ch), 0);
 
-        if (ossl_quic_channel_is_handshake_complete(qc->ch))
+        if (qctx_handshake_done(ctx))
             /* The handshake is now done. */
             return 1;
 
@@ -1708,7 +1912,8 @@ static int quic_do_handshake(QCTX *ctx)
         /* In blocking mode, wait for the handshake to complete. */
         struct quic_handshake_wait_args args;
 
-        args.qc     = qc;
+        args.qc         = qc;
+        args.in_early   = ctx->in_early;
 
         ret = block_until_pred(qc, quic_handshake_wait, &args, 0);
         if (!quic_mutation_allowed(qc, /*req_active=*/1)) {
@@ -1724,7 +1929,7 @@ static int quic_do_handshake(QCTX *ctx)
             return -1;
         }
 
-        assert(ossl_quic_channel_is_handshake_complete(qc->ch));
+        assert(qctx_handshake_done(ctx));
         return 1;
     }
 
@@ -2512,8 +2717,8 @@ static int quic_validate_for_write(QUIC_XSO *xso, int *err)
 }
 
 QUIC_TAKES_LOCK
-int ossl_quic_write_flags(SSL *s, const void *buf, size_t len,
-                          uint64_t flags, size_t *written)
+static int quic_write_flags(SSL *s, const void *buf, size_t len,
+                            uint64_t flags, int in_early, size_t *written)
 {
     int ret;
     QCTX ctx;
@@ -2521,7 +2726,8 @@ int ossl_quic_write_flags(SSL *s, const void *buf, size_t len,
 
     *written = 0;
 
-    if (!expect_quic_with_stream_lock(s, /*remote_init=*/0, /*io=*/1, &ctx))
+    if (!expect_quic_with_stream_lock_ex(s, /*remote_init=*/0, /*io=*/1,
+                                         in_early, &ctx))
         return 0;
 
     partial_write = ((ctx.xso->ssl_mode & SSL_MODE_ENABLE_PARTIAL_WRITE) != 0);
@@ -2538,7 +2744,8 @@ int ossl_quic_write_flags(SSL *s, const void *buf, size_t len,
 
     /*
      * If we haven't finished the handshake, try to advance it.
-     * We don't accept writes until the handshake is completed.
+     * We don't accept writes until the handshake is completed, unless they
+     * can be sent as 0-RTT data.
      */
     if (quic_do_handshake(&ctx) < 1) {
         ret = 0;
@@ -2571,12 +2778,137 @@ out:
     return ret;
 }
 
+QUIC_TAKES_LOCK
+int ossl_quic_write_flags(SSL *s, const void *buf, size_t len,
+                          uint64_t flags, size_t *written)
+{
+    return quic_write_flags(s, buf, len, flags, /*in_early=*/0, written);
+}
+
 QUIC_TAKES_LOCK
 int ossl_quic_write(SSL *s, const void *buf, size_t len, size_t *written)
 {
     return ossl_quic_write_flags(s, buf, len, 0, written);
 }
 
+/*
+ * SSL_write_early_data
+ * --------------------
+ */
+QUIC_NEEDS_LOCK
+static int qc_enable_early_data(QCTX *ctx)
+{
+    QUIC_CONNECTION *qc = ctx->qc;
+
+    if (qc->started) {
+        /* 0-RTT can only be chosen before the connection is started. */
+        if (!qc->early_data)
+            return QUIC_RAISE_NON_NORMAL_ERROR(ctx,
+                                               ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                               NULL);
+        return 1;
+    }
+
+    /* Fails if we are a server or the session does not allow 0-RTT. */
+    if (qc->as_server || !ossl_quic_channel_enable_early_data(qc->ch))
+        return QUIC_RAISE_NON_NORMAL_ERROR(ctx,
+                                           ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                           NULL);
+
+    qc->early_data = 1;
+    return 1;
+}
+
+QUIC_TAKES_LOCK
+int ossl_quic_write_early_data(SSL *s, const void *buf, size_t len,
+                               size_t *written)
+{
+    QCTX ctx;
+    int ret;
+
+    *written = 0;
+
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock_for_io(&ctx);
+    ret = qc_enable_early_data(&ctx);
+    quic_unlock(ctx.qc);
+    if (!ret)
+        return 0;
+
+    return quic_write_flags(s, buf, len, 0, /*in_early=*/1, written);
+}
+
+/*
+ * SSL_write_ref
+ * -------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_write_ref(SSL *s, const void *buf, size_t len, uint64_t flags,
+                        SSL_write_ref_release_cb_fn release_cb, void *arg)
+{
+    int ret;
+    QCTX ctx;
+    int err;
+
+    if (!expect_quic_with_stream_lock(s, /*remote_init=*/0, /*io=*/1, &ctx))
+        return 0;
+
+    if ((flags & ~SSL_WRITE_FLAG_CONCLUDE) != 0) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_UNSUPPORTED_WRITE_FLAG, NULL);
+        goto out;
+    }
+
+    if (buf == NULL || len == 0 || release_cb == NULL) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
+                                          NULL);
+        goto out;
+    }
+
+    if (!quic_mutation_allowed(ctx.qc, /*req_active=*/0)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        goto out;
+    }
+
+    if (quic_do_handshake(&ctx) < 1) {
+        ret = 0;
+        goto out;
+    }
+
+    if (!quic_validate_for_write(ctx.xso, &err)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, err, NULL);
+        goto out;
+    }
+
+    /*
+     * The rest of an unfinished all-or-nothing SSL_write must come first in
+     * the stream, so it has to be retried to completion before this call.
+     */
+    if (ctx.xso->aon_write_in_progress) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_BAD_WRITE_RETRY, NULL);
+        goto out;
+    }
+
+    /*
+     * The buffer is referenced rather than copied, so unlike SSL_write it is
+     * never limited by the size of the stream buffer or by flow control; the
+     * TXP still only sends as much as flow control permits.
+     */
+    if (!ossl_quic_sstream_append_ref(ctx.xso->stream->sstream, buf, len,
+                                      release_cb, arg)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
+        goto out;
+    }
+
+    quic_post_write(ctx.xso, 1, 1, flags, 1);
+    ret = 1;
+
+out:
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
 /*
  * SSL_read
  * --------
@@ -2753,6 +3085,13 @@ static int quic_read(SSL *s, void *buf, size_t len, size_t *bytes_read, int peek
         ctx.xso = ctx.qc->default_xso;
     }
 
+    if (ctx.xso->read_borrowed) {
+        /* The buffer borrowed with SSL_borrow_read_buf() must be released. */
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                          NULL);
+        goto out;
+    }
+
     if (!quic_read_actual(&ctx, ctx.xso->stream, buf, len, bytes_read, peek)) {
         ret = 0; /* quic_read_actual raised error here */
         goto out;
@@ -2823,29 +3162,263 @@ int ossl_quic_peek(SSL *s, void *buf, size_t len, size_t *bytes_read)
 }
 
 /*
- * SSL_pending
- * -----------
+ * SSL_borrow_read_buf
+ * -------------------
  */
+struct quic_borrow_again_args {
+    QCTX                *ctx;
+    const unsigned char **buf;
+    size_t              *buf_len;
+};
 
-QUIC_TAKES_LOCK
-static size_t ossl_quic_pending_int(const SSL *s, int check_channel)
+QUIC_NEEDS_LOCK
+static void xso_clear_read_borrow(QUIC_XSO *xso)
 {
-    QCTX ctx;
-    size_t avail = 0;
-    int fin = 0;
+    ossl_qrx_pkt_release(xso->read_borrow_pkt);
+    xso->read_borrow_pkt    = NULL;
+    xso->read_borrow_len    = 0;
+    xso->read_borrow_fin    = 0;
+    xso->read_borrowed      = 0;
+}
 
+/*
+ * Lends the caller the contiguous run of received stream data at the current
+ * read position, which is left in the packet it arrived in. Sets *buf_len to 0
+ * if no data is available yet.
+ */
+QUIC_NEEDS_LOCK
+static int quic_borrow_actual(QCTX *ctx, const unsigned char **buf,
+                              size_t *buf_len)
+{
+    int is_fin = 0, err, eos;
+    QUIC_XSO *xso = ctx->xso;
+    QUIC_STREAM *stream = xso->stream;
+    OSSL_QRX_PKT *pkt;
 
-    if (!expect_quic(s, &ctx))
-        return 0;
+    if (!quic_validate_for_read(xso, &err, &eos)) {
+        if (eos)
+            return QUIC_RAISE_NORMAL_ERROR(ctx, SSL_ERROR_ZERO_RETURN);
+        else
+            return QUIC_RAISE_NON_NORMAL_ERROR(ctx, err, NULL);
+    }
 
-    quic_lock(ctx.qc);
+    if (!ossl_quic_rstream_get_record(stream->rstream, buf, buf_len, &is_fin))
+        return QUIC_RAISE_NON_NORMAL_ERROR(ctx, ERR_R_INTERNAL_ERROR, NULL);
 
-    if (ctx.xso == NULL) {
-        QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_NO_STREAM, NULL);
-        goto out;
-    }
+    if (*buf_len == 0) {
+        /* Nothing was locked, so there is nothing to release. */
+        *buf = NULL;
 
-    if (ctx.xso->stream == NULL
+        if (is_fin) {
+            ossl_quic_stream_map_notify_totally_read(ossl_quic_channel_get_qsm(ctx->qc->ch),
+                                                     stream);
+            return QUIC_RAISE_NORMAL_ERROR(ctx, SSL_ERROR_ZERO_RETURN);
+        }
+
+        return 1;
+    }
+
+    if ((pkt = ossl_quic_rstream_get_record_pkt(stream->rstream)) != NULL)
+        ossl_qrx_pkt_up_ref(pkt);
+
+    xso->read_borrowed      = 1;
+    xso->read_borrow_fin    = is_fin;
+    xso->read_borrow_len    = *buf_len;
+    xso->read_borrow_pkt    = pkt;
+    return 1;
+}
+
+QUIC_NEEDS_LOCK
+static int quic_borrow_again(void *arg)
+{
+    struct quic_borrow_again_args *args = arg;
+
+    if (!quic_mutation_allowed(args->ctx->qc, /*req_active=*/1)) {
+        /* If connection is torn down due to an error while blocking, stop. */
+        QUIC_RAISE_NON_NORMAL_ERROR(args->ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        return -1;
+    }
+
+    if (!quic_borrow_actual(args->ctx, args->buf, args->buf_len))
+        return -1;
+
+    return *args->buf_len > 0;
+}
+
+QUIC_TAKES_LOCK
+int ossl_quic_borrow_read_buf(SSL *s, const unsigned char **buf,
+                              size_t *buf_len)
+{
+    int ret, res;
+    QCTX ctx;
+    struct quic_borrow_again_args args;
+
+    *buf        = NULL;
+    *buf_len    = 0;
+
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock_for_io(&ctx);
+
+    if (!quic_mutation_allowed(ctx.qc, /*req_active=*/0)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        goto out;
+    }
+
+    if (quic_do_handshake(&ctx) < 1) {
+        ret = 0; /* ossl_quic_do_handshake raised error here */
+        goto out;
+    }
+
+    if (ctx.xso == NULL) {
+        if (!qc_wait_for_default_xso_for_read(&ctx)) {
+            ret = 0; /* error already raised here */
+            goto out;
+        }
+
+        ctx.xso = ctx.qc->default_xso;
+    }
+
+    if (ctx.xso->read_borrowed) {
+        /* Only one buffer can be borrowed at a time. */
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                          NULL);
+        goto out;
+    }
+
+    if (!quic_borrow_actual(&ctx, buf, buf_len)) {
+        ret = 0; /* quic_borrow_actual raised error here */
+        goto out;
+    }
+
+    if (*buf_len > 0) {
+        ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(ctx.qc->ch), 0);
+        ret = 1;
+    } else if (xso_blocking_mode(ctx.xso)) {
+        args.ctx        = &ctx;
+        args.buf        = buf;
+        args.buf_len    = buf_len;
+
+        res = block_until_pred(ctx.qc, quic_borrow_again, &args, 0);
+        if (res == 0) {
+            ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
+            goto out;
+        } else if (res < 0) {
+            ret = 0; /* quic_borrow_again raised error here */
+            goto out;
+        }
+
+        ret = 1;
+    } else {
+        ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(ctx.qc->ch), 0);
+
+        if (!quic_borrow_actual(&ctx, buf, buf_len)) {
+            ret = 0; /* quic_borrow_actual raised error here */
+            goto out;
+        }
+
+        if (*buf_len > 0)
+            ret = 1;
+        else
+            ret = QUIC_RAISE_NORMAL_ERROR(&ctx, SSL_ERROR_WANT_READ);
+    }
+
+out:
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
+/*
+ * SSL_release_read_buf
+ * --------------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_release_read_buf(SSL *s, size_t consumed)
+{
+    int ret = 0;
+    QCTX ctx;
+    QUIC_STREAM *stream;
+    QUIC_STREAM_MAP *qsm;
+    OSSL_RTT_INFO rtt_info;
+
+    if (!expect_quic_with_stream_lock(s, /*remote_init=*/-1, /*io=*/0, &ctx))
+        return 0;
+
+    if (!ctx.xso->read_borrowed) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                          NULL);
+        goto out;
+    }
+
+    if (consumed > ctx.xso->read_borrow_len) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
+                                          NULL);
+        goto out;
+    }
+
+    stream = ctx.xso->stream;
+    if (stream->rstream == NULL) {
+        /* The stream was reset while the buffer was borrowed. */
+        ret = 1;
+        goto out;
+    }
+
+    if (!ossl_quic_rstream_release_record(stream->rstream, consumed)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
+        goto out;
+    }
+
+    qsm = ossl_quic_channel_get_qsm(ctx.qc->ch);
+    if (consumed > 0) {
+        /* As for SSL_read, retire the bytes and grant the peer more credit. */
+        ossl_statm_get_rtt_info(ossl_quic_channel_get_statm(ctx.qc->ch),
+                                &rtt_info);
+
+        if (!ossl_quic_rxfc_on_retire(&stream->rxfc, consumed,
+                                      rtt_info.smoothed_rtt)) {
+            ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
+            goto out;
+        }
+
+        if (ctx.xso->read_borrow_fin && consumed == ctx.xso->read_borrow_len)
+            ossl_quic_stream_map_notify_totally_read(qsm, stream);
+
+        ossl_quic_stream_map_update_state(qsm, stream);
+    }
+
+    ret = 1;
+out:
+    if (ret)
+        xso_clear_read_borrow(ctx.xso);
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
+/*
+ * SSL_pending
+ * -----------
+ */
+
+QUIC_TAKES_LOCK
+static size_t ossl_quic_pending_int(const SSL *s, int check_channel)
+{
+    QCTX ctx;
+    size_t avail = 0;
+    int fin = 0;
+
+
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock(ctx.qc);
+
+    if (ctx.xso == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_NO_STREAM, NULL);
+        goto out;
+    }
+
+    if (ctx.xso->stream == NULL
         || !ossl_quic_stream_has_recv_buffer(ctx.xso->stream)) {
         QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
         goto out;
@@ -3023,6 +3596,57 @@ int ossl_quic_is_stream_local(SSL *s)
     return is_local;
 }
 
+/*
+ * SSL_set_stream_priority
+ * -----------------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_set_stream_priority(SSL *s, unsigned int urgency,
+                                  int incremental)
+{
+    QCTX ctx;
+    int ret = 0;
+
+    if (!expect_quic_with_stream_lock(s, /*remote_init=*/-1, /*io=*/0, &ctx))
+        return 0;
+
+    if (urgency > QUIC_STREAM_URGENCY_MAX) {
+        QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
+                                    "urgency out of range");
+        goto out;
+    }
+
+    ossl_quic_stream_map_set_priority(ossl_quic_channel_get_qsm(ctx.qc->ch),
+                                      ctx.xso->stream, urgency, incremental);
+    ret = 1;
+
+out:
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
+/*
+ * SSL_get_stream_priority
+ * -----------------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_get_stream_priority(SSL *s, unsigned int *urgency,
+                                  int *incremental)
+{
+    QCTX ctx;
+
+    if (!expect_quic_with_stream_lock(s, /*remote_init=*/-1, /*io=*/0, &ctx))
+        return 0;
+
+    if (urgency != NULL)
+        *urgency = ctx.xso->stream->urgency;
+    if (incremental != NULL)
+        *incremental = ctx.xso->stream->incremental;
+
+    quic_unlock(ctx.qc);
+    return 1;
+}
+
 /*
  * SSL_set_default_stream_mode
  * ---------------------------
@@ -3059,6 +3683,37 @@ int ossl_quic_set_default_stream_mode(SSL *s, uint32_t mode)
     return 1;
 }
 
+/*
+ * SSL_set_quic_congestion_control
+ * -------------------------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_set_congestion_control(SSL *s, const char *name)
+{
+    QCTX ctx;
+    const OSSL_CC_METHOD *cc_method;
+
+    if (!expect_quic_conn_only(s, &ctx))
+        return 0;
+
+    if (name == NULL
+        || (cc_method = ossl_cc_get_method_by_name(name)) == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           "unknown congestion controller");
+
+    quic_lock(ctx.qc);
+
+    if (ctx.qc->started
+        || !ossl_quic_channel_set_cc_method(ctx.qc->ch, cc_method)) {
+        quic_unlock(ctx.qc);
+        return QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                           "too late to change congestion controller");
+    }
+
+    quic_unlock(ctx.qc);
+    return 1;
+}
+
 /*
  * SSL_detach_stream
  * -----------------
@@ -3598,6 +4253,1029 @@ int ossl_quic_get_key_update_type(const SSL *s)
     return SSL_KEY_UPDATE_NONE;
 }
 
+/*
+ * SSL_set_max_datagram_frame_size
+ * -------------------------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_set_max_datagram_frame_size(SSL *s, uint64_t max_size)
+{
+    QCTX ctx;
+    QUIC_LISTENER *ql;
+    size_t i;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(s)) != NULL) {
+        ql_lock(ql);
+
+        if (ql->listening) {
+            ql_unlock(ql);
+            return QUIC_RAISE_NON_NORMAL_ERROR(NULL,
+                                               ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                               "listener is already listening");
+        }
+
+        /* Workers are not running yet, so their ports need no locking. */
+        ql->max_datagram_frame_size = max_size;
+        ossl_quic_port_set_max_datagram_frame_size(ql->port, max_size);
+        for (i = 0; i < ql->num_workers; i++)
+            ossl_quic_port_set_max_datagram_frame_size(ql->workers[i].port,
+                                                       max_size);
+
+        ql_unlock(ql);
+        return 1;
+    }
+
+    if (!expect_quic_conn_only(s, &ctx))
+        return 0;
+
+    quic_lock(ctx.qc);
+
+    if (ctx.qc->started
+        || !ossl_quic_channel_set_max_datagram_frame_size(ctx.qc->ch,
+                                                          max_size)) {
+        quic_unlock(ctx.qc);
+        return QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                           "connection has already started");
+    }
+
+    quic_unlock(ctx.qc);
+    return 1;
+}
+
+/*
+ * SSL_get_max_datagram_size
+ * -------------------------
+ */
+QUIC_TAKES_LOCK
+size_t ossl_quic_get_max_datagram_size(SSL *s)
+{
+    QCTX ctx;
+    size_t ret;
+
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock(ctx.qc);
+    ret = ossl_quic_channel_get_max_datagram_size(ctx.qc->ch);
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
+/*
+ * SSL_send_datagram
+ * -----------------
+ */
+QUIC_NEEDS_LOCK
+static int quic_send_datagram_again(void *arg)
+{
+    QCTX *ctx = arg;
+
+    if (!quic_mutation_allowed(ctx->qc, /*req_active=*/1)) {
+        /* If connection is torn down due to an error while blocking, stop. */
+        QUIC_RAISE_NON_NORMAL_ERROR(ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        return -1;
+    }
+
+    return ossl_quic_channel_can_send_datagram(ctx->qc->ch);
+}
+
+QUIC_TAKES_LOCK
+int ossl_quic_send_datagram(SSL *s, const void *buf, size_t len)
+{
+    QCTX ctx;
+    int ret, res;
+
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock_for_io(&ctx);
+
+    if (!quic_mutation_allowed(ctx.qc, /*req_active=*/0)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        goto out;
+    }
+
+    if (quic_do_handshake(&ctx) < 1) {
+        ret = 0; /* quic_do_handshake raised error here */
+        goto out;
+    }
+
+    if (ossl_quic_channel_get_max_datagram_size(ctx.qc->ch) == 0) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_UNSUPPORTED,
+                                          "peer does not accept datagrams");
+        goto out;
+    }
+
+    if (buf == NULL && len > 0) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_NULL_PARAMETER,
+                                          NULL);
+        goto out;
+    }
+
+    if (len > ossl_quic_channel_get_max_datagram_size(ctx.qc->ch)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_PASSED_INVALID_ARGUMENT,
+                                          "datagram too large");
+        goto out;
+    }
+
+    /*
+     * Too many datagrams are queued or in flight. They are released once
+     * acknowledged or declared lost, so wait for that in blocking mode.
+     */
+    if (!ossl_quic_channel_can_send_datagram(ctx.qc->ch)) {
+        if (!qc_blocking_mode(ctx.qc)) {
+            ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(ctx.qc->ch), 0);
+            if (!ossl_quic_channel_can_send_datagram(ctx.qc->ch)) {
+                ret = QUIC_RAISE_NORMAL_ERROR(&ctx, SSL_ERROR_WANT_WRITE);
+                goto out;
+            }
+        } else {
+            res = block_until_pred(ctx.qc, quic_send_datagram_again, &ctx, 0);
+            if (res == 0) {
+                ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR,
+                                                  NULL);
+                goto out;
+            } else if (res < 0) {
+                ret = 0; /* quic_send_datagram_again raised error here */
+                goto out;
+            }
+        }
+    }
+
+    if (!ossl_quic_channel_send_datagram(ctx.qc->ch, buf, len)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
+        goto out;
+    }
+
+    /* Try and send. */
+    ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(ctx.qc->ch), 0);
+    ret = 1;
+
+out:
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
+/*
+ * SSL_recv_datagram
+ * -----------------
+ */
+struct quic_recv_datagram_again_args {
+    QCTX        *ctx;
+    void        *buf;
+    size_t      len;
+    size_t      *readbytes;
+};
+
+QUIC_NEEDS_LOCK
+static int quic_recv_datagram_again(void *arg)
+{
+    struct quic_recv_datagram_again_args *args = arg;
+
+    if (ossl_quic_channel_recv_datagram(args->ctx->qc->ch, args->buf,
+                                        args->len, args->readbytes))
+        return 1;
+
+    if (!quic_mutation_allowed(args->ctx->qc, /*req_active=*/1)) {
+        /* If connection is torn down due to an error while blocking, stop. */
+        QUIC_RAISE_NON_NORMAL_ERROR(args->ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        return -1;
+    }
+
+    return 0;
+}
+
+QUIC_TAKES_LOCK
+int ossl_quic_recv_datagram(SSL *s, void *buf, size_t len, size_t *readbytes)
+{
+    QCTX ctx;
+    int ret, res;
+    struct quic_recv_datagram_again_args args;
+
+    *readbytes = 0;
+
+    if (!expect_quic(s, &ctx))
+        return 0;
+
+    quic_lock_for_io(&ctx);
+
+    /* Datagrams which arrived before the connection closed can still be read. */
+    if (ossl_quic_channel_recv_datagram(ctx.qc->ch, buf, len, readbytes)) {
+        ret = 1;
+        goto out;
+    }
+
+    if (!quic_mutation_allowed(ctx.qc, /*req_active=*/0)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        goto out;
+    }
+
+    if (quic_do_handshake(&ctx) < 1) {
+        ret = 0; /* quic_do_handshake raised error here */
+        goto out;
+    }
+
+    if (qc_blocking_mode(ctx.qc)) {
+        args.ctx        = &ctx;
+        args.buf        = buf;
+        args.len        = len;
+        args.readbytes  = readbytes;
+
+        res = block_until_pred(ctx.qc, quic_recv_datagram_again, &args, 0);
+        if (res == 0) {
+            ret = QUIC_RAISE_NON_NORMAL_ERROR(&ctx, ERR_R_INTERNAL_ERROR, NULL);
+            goto out;
+        } else if (res < 0) {
+            ret = 0; /* quic_recv_datagram_again raised error here */
+            goto out;
+        }
+
+        ret = 1;
+    } else {
+        /* Tick to see if this delivers a datagram, then try again. */
+        ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(ctx.qc->ch), 0);
+
+        if (ossl_quic_channel_recv_datagram(ctx.qc->ch, buf, len, readbytes))
+            ret = 1;
+        else
+            ret = QUIC_RAISE_NORMAL_ERROR(&ctx, SSL_ERROR_WANT_READ);
+    }
+
+out:
+    quic_unlock(ctx.qc);
+    return ret;
+}
+
+/*
+ * QUIC Front-End I/O API: Listeners
+ * =================================
+ *
+ *         SSL_new_listener         => ossl_quic_new_listener
+ *         SSL_listen               => ossl_quic_listen
+ *         SSL_accept_connection    => ossl_quic_accept_connection
+ *         SSL_get_accept_connection_queue_len
+ *                                  => ossl_quic_get_accept_connection_queue_len
+ *         SSL_set_max_accept_connection_queue_len
+ *             => ossl_quic_set_max_accept_connection_queue_len
+ *         SSL_add_listener_worker  => ossl_quic_add_listener_worker
+ *
+ * A listener owns a QUIC_ENGINE with a single QUIC_PORT, which demultiplexes
+ * any number of connections over the network BIOs of the listener. The port
+ * creates a QUIC_CHANNEL for each incoming connection and queues it until the
+ * application accepts it, at which point the channel is wrapped in a
+ * QUIC_CONNECTION which shares the engine, port and mutex of the listener.
+ *
+ * Since everything under an engine is serialised by its mutex, a listener can
+ * be given workers to spread its connections over several cores. Each worker
+ * is an additional shard with an engine, port and network BIOs of its own
+ * (typically a socket bound to the same address with SO_REUSEPORT), and each
+ * shard is serviced by its own thread. The local CIDs issued by a shard
+ * identify it, so that a datagram received by the wrong shard is forwarded to
+ * the right one.
+ */
+
+static void ql_lock(QUIC_LISTENER *ql)
+{
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_lock(ql->mutex);
+#endif
+}
+
+QUIC_NEEDS_LOCK
+static void ql_unlock(QUIC_LISTENER *ql)
+{
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_unlock(ql->mutex);
+#endif
+}
+
+QUIC_NEEDS_LOCK
+static void ql_update_blocking_mode(QUIC_LISTENER *ql)
+{
+    QUIC_REACTOR *rtor = ossl_quic_port_get0_reactor(ql->port);
+
+    ossl_quic_port_update_poll_descriptors(ql->port); /* best effort */
+    ql->blocking = ql->desires_blocking
+        && ossl_quic_reactor_can_poll_r(rtor)
+        && ossl_quic_reactor_can_poll_w(rtor);
+}
+
+/*
+ * Gets the port of shard idx of the listener, and optionally its mutex. Shard 0
+ * is formed by the listener's own engine and port.
+ */
+static QUIC_PORT *ql_get0_shard(QUIC_LISTENER *ql, size_t idx,
+                                CRYPTO_MUTEX **mutex)
+{
+    if (idx == 0) {
+        if (mutex != NULL)
+            *mutex = ql->mutex;
+        return ql->port;
+    }
+
+    if (mutex != NULL)
+        *mutex = ql->workers[idx - 1].mutex;
+    return ql->workers[idx - 1].port;
+}
+
+static void ql_shard_lock(QUIC_LISTENER *ql, size_t idx)
+{
+#if defined(OPENSSL_THREADS)
+    CRYPTO_MUTEX *m;
+
+    ql_get0_shard(ql, idx, &m);
+    ossl_crypto_mutex_lock(m);
+#endif
+}
+
+static void ql_shard_unlock(QUIC_LISTENER *ql, size_t idx)
+{
+#if defined(OPENSSL_THREADS)
+    CRYPTO_MUTEX *m;
+
+    ql_get0_shard(ql, idx, &m);
+    ossl_crypto_mutex_unlock(m);
+#endif
+}
+
+/* SSL_new_listener */
+SSL *ossl_quic_new_listener(SSL_CTX *ctx, uint64_t flags)
+{
+    QUIC_LISTENER *ql = NULL;
+    QUIC_ENGINE_ARGS engine_args = {0};
+    QUIC_PORT_ARGS port_args = {0};
+
+    if (ctx->method != OSSL_QUIC_server_method() || flags != 0) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT, NULL);
+        return NULL;
+    }
+
+    ql = OPENSSL_zalloc(sizeof(*ql));
+    if (ql == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+        return NULL;
+    }
+#if defined(OPENSSL_THREADS)
+    if ((ql->mutex = ossl_crypto_mutex_new()) == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+        OPENSSL_free(ql);
+        return NULL;
+    }
+#endif
+
+    if (!ossl_ssl_init(&ql->ssl, ctx, ctx->method, SSL_TYPE_QUIC_LISTENER)) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+#if defined(OPENSSL_THREADS)
+        ossl_crypto_mutex_free(&ql->mutex);
+#endif
+        OPENSSL_free(ql);
+        return NULL;
+    }
+
+    engine_args.libctx      = ctx->libctx;
+    engine_args.propq       = ctx->propq;
+    engine_args.mutex       = ql->mutex;
+    ql->engine = ossl_quic_engine_new(&engine_args);
+    if (ql->engine == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+        goto err;
+    }
+
+    port_args.channel_ctx   = ctx;
+    port_args.is_multi_conn = 1;
+    ql->port = ossl_quic_engine_create_port(ql->engine, &port_args);
+    if (ql->port == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+        goto err;
+    }
+
+    ql->desires_blocking = 1;
+    ql->blocking         = 0;
+    return &ql->ssl;
+
+err:
+    SSL_free(&ql->ssl);
+    return NULL;
+}
+
+static void ql_worker_free(QUIC_LISTENER_WORKER *w)
+{
+    ossl_quic_port_free(w->port);
+    ossl_quic_engine_free(w->engine);
+
+    if (w->net_wbio != w->net_rbio)
+        BIO_free_all(w->net_wbio);
+    BIO_free_all(w->net_rbio);
+
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_free(&w->mutex);
+#endif
+}
+
+/*
+ * Stops the worker threads of all shards. They must all be stopped before any
+ * port is freed, as each may forward datagrams to the port of any other.
+ */
+QUIC_NEEDS_LOCK
+static void ql_stop_workers(QUIC_LISTENER *ql)
+{
+    size_t i;
+
+    ossl_quic_engine_stop_worker(ql->engine);
+
+    for (i = 0; i < ql->num_workers; i++) {
+        ql_shard_lock(ql, i + 1);
+        ossl_quic_engine_stop_worker(ql->workers[i].engine);
+        ql_shard_unlock(ql, i + 1);
+    }
+}
+
+/* SSL_free of a listener */
+QUIC_TAKES_LOCK
+static void ql_free(QUIC_LISTENER *ql)
+{
+    size_t i;
+
+    /*
+     * Every connection accepted from the listener holds a reference to it, so
+     * the ports no longer have any channel other than queued incoming ones,
+     * which they free.
+     */
+    ql_lock(ql);
+
+    ql_stop_workers(ql);
+
+    for (i = 0; i < ql->num_workers; i++)
+        ql_worker_free(&ql->workers[i]);
+    OPENSSL_free(ql->workers);
+
+    ossl_quic_port_free(ql->port);
+    ossl_quic_engine_free(ql->engine);
+
+    BIO_free_all(ql->net_rbio);
+    BIO_free_all(ql->net_wbio);
+    OPENSSL_cleanse(ql->lb_key, sizeof(ql->lb_key));
+
+    ql_unlock(ql); /* tsan doesn't like freeing locked mutexes */
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_condvar_free(&ql->accept_cv);
+    ossl_crypto_mutex_free(&ql->accept_mutex);
+    ossl_crypto_mutex_free(&ql->mutex);
+#endif
+}
+
+/*
+ * Called by the port of a shard with a datagram for a connection of another
+ * shard.
+ */
+static void ql_forward_dgram(const QUIC_URXE *e, size_t shard_idx, void *arg)
+{
+    QUIC_LISTENER *ql = arg;
+
+    if (shard_idx <= ql->num_workers)
+        /* Best effort */
+        ossl_quic_port_post_dgram(ql_get0_shard(ql, shard_idx, NULL), e);
+}
+
+/* Called by the port of a shard when it has queued an incoming connection. */
+static void ql_on_incoming(QUIC_PORT *port, void *arg)
+{
+#if defined(OPENSSL_THREADS)
+    QUIC_LISTENER *ql = arg;
+
+    ossl_crypto_mutex_lock(ql->accept_mutex);
+    ++ql->incoming_gen;
+    ossl_crypto_condvar_broadcast(ql->accept_cv);
+    ossl_crypto_mutex_unlock(ql->accept_mutex);
+#endif
+}
+
+/* Sets up sharding and starts a worker thread for each shard. */
+QUIC_NEEDS_LOCK
+static int ql_start_workers(QUIC_LISTENER *ql)
+{
+#if defined(OPENSSL_THREADS)
+    size_t i, num_shards = ql->num_workers + 1;
+    QUIC_PORT *port;
+    int ok;
+
+    if (ql->accept_mutex == NULL
+        && (ql->accept_mutex = ossl_crypto_mutex_new()) == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+
+    if (ql->accept_cv == NULL
+        && (ql->accept_cv = ossl_crypto_condvar_new()) == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+
+    for (i = 0; i < num_shards; i++) {
+        port = ql_get0_shard(ql, i, NULL);
+
+        if (i > 0)
+            ql_shard_lock(ql, i);
+
+        ok = ossl_quic_port_set_shard(port, i, num_shards,
+                                      ql_forward_dgram, ql);
+        if (ok) {
+            ossl_quic_port_set_incoming_cb(port, ql_on_incoming, ql);
+            ossl_quic_port_set_allow_incoming(port, 1);
+            ok = ossl_quic_engine_start_worker(ossl_quic_port_get0_engine(port));
+        }
+
+        if (i > 0)
+            ql_shard_unlock(ql, i);
+
+        if (!ok) {
+            ql_stop_workers(ql);
+            return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR,
+                                               "cannot start listener workers");
+        }
+    }
+
+    return 1;
+#else
+    return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_UNSUPPORTED,
+                                       "listener workers need threads");
+#endif
+}
+
+QUIC_NEEDS_LOCK
+static int ql_listen(QUIC_LISTENER *ql)
+{
+    if (ql->listening)
+        return 1;
+
+    if (ql->net_rbio == NULL || ql->net_wbio == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, SSL_R_BIO_NOT_SET, NULL);
+
+    if (ql->num_workers > 0) {
+        if (!ql_start_workers(ql))
+            return 0;
+    } else {
+        ossl_quic_port_set_allow_incoming(ql->port, 1);
+    }
+
+    ql->listening = 1;
+    return 1;
+}
+
+/* SSL_listen */
+QUIC_TAKES_LOCK
+int ossl_quic_listen(SSL *ssl)
+{
+    QUIC_LISTENER *ql;
+    int ret;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(ssl)) == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           NULL);
+
+    ql_lock(ql);
+    ret = ql_listen(ql);
+    ql_unlock(ql);
+    return ret;
+}
+
+/*
+ * Wraps an incoming channel popped from the port of a shard of a listener in a
+ * new QUIC_CONNECTION. On success, the QUIC_CONNECTION takes ownership of the
+ * channel and of its handshake layer object. Must be called with the mutex of
+ * the shard held.
+ */
+QUIC_NEEDS_LOCK
+static QUIC_CONNECTION *create_qc_from_incoming_conn(QUIC_LISTENER *ql,
+                                                     QUIC_PORT *port,
+                                                     QUIC_CHANNEL *ch,
+                                                     int desires_blocking)
+{
+    QUIC_CONNECTION *qc;
+    SSL_CTX *ctx = ql->ssl.ctx;
+
+    qc = OPENSSL_zalloc(sizeof(*qc));
+    if (qc == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+        return NULL;
+    }
+
+    if (!ossl_ssl_init(&qc->ssl, ctx, ql->ssl.method,
+                       SSL_TYPE_QUIC_CONNECTION)) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+        OPENSSL_free(qc);
+        return NULL;
+    }
+
+    /*
+     * Keep the listener, and thus the engine, port and mutex we share with it,
+     * alive for as long as we are.
+     */
+    SSL_up_ref(&ql->ssl);
+    qc->listener        = ql;
+    qc->engine          = ossl_quic_port_get0_engine(port);
+    qc->port            = port;
+    qc->mutex           = ossl_quic_port_get0_mutex(port);
+    qc->ch              = ch;
+    qc->tls             = ossl_quic_channel_get0_ssl(ch);
+
+    /* The channel has already been started by the port. */
+    qc->as_server       = 1;
+    qc->as_server_state = 1;
+    qc->started         = 1;
+
+    qc_init_defaults(qc);
+    qc->desires_blocking = desires_blocking;
+    qc_update_blocking_mode(qc);
+
+    ossl_quic_channel_set_msg_callback(ch, ctx->msg_callback, &qc->ssl);
+    ossl_quic_channel_set_msg_callback_arg(ch, ctx->msg_callback_arg);
+
+    qc_update_reject_policy(qc);
+    return qc;
+}
+
+static int quic_accept_connection_wait(void *arg)
+{
+    QUIC_PORT *port = arg;
+
+    if (!ossl_quic_port_is_running(port))
+        return -1;
+
+    return ossl_quic_port_have_incoming(port);
+}
+
+/* Pops an incoming channel from a port and wraps it in a QUIC_CONNECTION. */
+QUIC_NEEDS_LOCK
+static QUIC_CONNECTION *ql_pop_incoming(QUIC_LISTENER *ql, QUIC_PORT *port,
+                                        int desires_blocking)
+{
+    QUIC_CHANNEL *ch;
+    QUIC_CONNECTION *qc;
+    SSL *tls;
+
+    if ((ch = ossl_quic_port_pop_incoming(port)) == NULL)
+        return NULL;
+
+    if ((qc = create_qc_from_incoming_conn(ql, port, ch,
+                                           desires_blocking)) == NULL) {
+        tls = ossl_quic_channel_get0_ssl(ch);
+        SSL_free(tls);
+        ossl_quic_channel_free(ch);
+    }
+
+    return qc;
+}
+
+/*
+ * SSL_accept_connection on a listener with workers. Each shard is locked in
+ * turn, starting with a different one each time so that no shard is starved.
+ * A blocking call waits for any shard to queue an incoming connection; shards
+ * are serviced by their worker threads meanwhile.
+ */
+QUIC_TAKES_LOCK
+static QUIC_CONNECTION *ql_accept_from_shards(QUIC_LISTENER *ql, int blocking,
+                                              int desires_blocking)
+{
+#if defined(OPENSSL_THREADS)
+    QUIC_CONNECTION *qc = NULL;
+    size_t i, idx, first, num_shards = ql->num_workers + 1;
+    uint64_t gen;
+    int any_running;
+
+    for (;;) {
+        ossl_crypto_mutex_lock(ql->accept_mutex);
+        gen     = ql->incoming_gen;
+        first   = ql->next_shard;
+        ql->next_shard = (first + 1) % num_shards;
+        ossl_crypto_mutex_unlock(ql->accept_mutex);
+
+        any_running = 0;
+        for (i = 0; i < num_shards && qc == NULL; i++) {
+            idx = (first + i) % num_shards;
+
+            ql_shard_lock(ql, idx);
+            if (ossl_quic_port_is_running(ql_get0_shard(ql, idx, NULL)))
+                any_running = 1;
+            qc = ql_pop_incoming(ql, ql_get0_shard(ql, idx, NULL),
+                                 desires_blocking);
+            ql_shard_unlock(ql, idx);
+        }
+
+        if (qc != NULL || !blocking)
+            return qc;
+
+        if (!any_running) {
+            ql_lock(ql);
+            ossl_quic_port_restore_err_state(ql->port);
+            ql_unlock(ql);
+            return NULL;
+        }
+
+        /*
+         * Wait for a shard to queue a connection. The timeout is only there
+         * so that we notice if every port fails meanwhile.
+         */
+        ossl_crypto_mutex_lock(ql->accept_mutex);
+        if (ql->incoming_gen == gen)
+            ossl_crypto_condvar_wait_timeout(ql->accept_cv, ql->accept_mutex,
+                                             ossl_time_add(ossl_time_now(),
+                                                           ossl_ms2time(100)));
+        ossl_crypto_mutex_unlock(ql->accept_mutex);
+    }
+#else
+    return NULL;
+#endif
+}
+
+/* SSL_accept_connection */
+QUIC_TAKES_LOCK
+SSL *ossl_quic_accept_connection(SSL *ssl, uint64_t flags)
+{
+    QUIC_LISTENER *ql;
+    QUIC_REACTOR *rtor;
+    QUIC_CONNECTION *qc = NULL;
+    int ret, desires_blocking;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(ssl)) == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT, NULL);
+        return NULL;
+    }
+
+    ql_lock(ql);
+
+    if (!ql_listen(ql))
+        goto out;
+
+    desires_blocking = ql->desires_blocking;
+    if (ql->num_workers > 0) {
+        /*
+         * Worker threads service the shards, so we can block whether or not
+         * the network BIOs are pollable.
+         */
+        ql_unlock(ql);
+        qc = ql_accept_from_shards(ql,
+                                   desires_blocking
+                                   && (flags & SSL_ACCEPT_CONNECTION_NO_BLOCK) == 0,
+                                   desires_blocking);
+        return qc != NULL ? &qc->ssl : NULL;
+    }
+
+    rtor = ossl_quic_port_get0_reactor(ql->port);
+    if (!ossl_quic_port_have_incoming(ql->port)) {
+        if (ql->blocking && (flags & SSL_ACCEPT_CONNECTION_NO_BLOCK) == 0) {
+            /*
+             * Any attempt to block auto-disables tick inhibition as otherwise
+             * we will hang around forever.
+             */
+            ossl_quic_engine_set_inhibit_tick(ql->engine, 0);
+
+            ret = ossl_quic_reactor_block_until_pred(rtor,
+                                                     quic_accept_connection_wait,
+                                                     ql->port, 0, ql->mutex);
+            if (!ossl_quic_port_is_running(ql->port)) {
+                ossl_quic_port_restore_err_state(ql->port);
+                goto out;
+            } else if (ret < 1) {
+                QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+                goto out;
+            }
+        } else {
+            /* Try to advance the reactor. */
+            ossl_quic_reactor_tick(rtor, 0);
+        }
+    }
+
+    qc = ql_pop_incoming(ql, ql->port, desires_blocking);
+
+out:
+    ql_unlock(ql);
+    return qc != NULL ? &qc->ssl : NULL;
+}
+
+/* SSL_get_accept_connection_queue_len */
+QUIC_TAKES_LOCK
+size_t ossl_quic_get_accept_connection_queue_len(SSL *ssl)
+{
+    QUIC_LISTENER *ql;
+    size_t v, i;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(ssl)) == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT, NULL);
+        return 0;
+    }
+
+    ql_lock(ql);
+    v = ossl_quic_port_get_num_incoming_channels(ql->port);
+    for (i = 0; i < ql->num_workers; i++) {
+        ql_shard_lock(ql, i + 1);
+        v += ossl_quic_port_get_num_incoming_channels(ql->workers[i].port);
+        ql_shard_unlock(ql, i + 1);
+    }
+    ql_unlock(ql);
+    return v;
+}
+
+/* SSL_set_max_accept_connection_queue_len */
+QUIC_TAKES_LOCK
+int ossl_quic_set_max_accept_connection_queue_len(SSL *ssl, size_t max_len)
+{
+    QUIC_LISTENER *ql;
+    size_t i;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(ssl)) == NULL || max_len == 0)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           NULL);
+
+    ql_lock(ql);
+
+    if (ql->listening) {
+        ql_unlock(ql);
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL,
+                                           ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                           "listener is already listening");
+    }
+
+    /* Workers are not running yet, so their ports need no locking. */
+    ql->max_incoming = max_len;
+    ossl_quic_port_set_max_incoming(ql->port, max_len);
+    for (i = 0; i < ql->num_workers; i++)
+        ossl_quic_port_set_max_incoming(ql->workers[i].port, max_len);
+
+    ql_unlock(ql);
+    return 1;
+}
+
+/* Gives the port of a shard its own instance of the QUIC-LB configuration. */
+QUIC_NEEDS_LOCK
+static int ql_apply_lb_config(QUIC_LISTENER *ql, QUIC_PORT *port)
+{
+    QUIC_LB_CONFIG *lb;
+
+    lb = ossl_quic_lb_config_new(ql->ssl.ctx->libctx, ql->ssl.ctx->propq,
+                                 ql->lb_config_id,
+                                 ql->lb_server_id, ql->lb_server_id_len,
+                                 ql->lb_nonce_len,
+                                 ql->lb_has_key ? ql->lb_key : NULL,
+                                 sizeof(ql->lb_key));
+    if (lb == NULL)
+        return 0;
+
+    if (!ossl_quic_port_set_lb_config(port, lb)) {
+        ossl_quic_lb_config_free(lb);
+        return 0;
+    }
+
+    return 1;
+}
+
+/* SSL_add_listener_worker */
+QUIC_TAKES_LOCK
+int ossl_quic_add_listener_worker(SSL *ssl, BIO *net_rbio, BIO *net_wbio)
+{
+    QUIC_LISTENER *ql;
+    QUIC_LISTENER_WORKER *w, *workers;
+    QUIC_ENGINE_ARGS engine_args = {0};
+    QUIC_PORT_ARGS port_args = {0};
+    int ret = 0;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(ssl)) == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           NULL);
+
+    if (net_rbio == NULL || net_wbio == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_NULL_PARAMETER,
+                                           NULL);
+
+    ql_lock(ql);
+
+    if (ql->listening) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                    "listener is already listening");
+        goto out;
+    }
+
+    /* Each shard must be identifiable from the CIDs it issues. */
+    if (ql->num_workers + 2 > QUIC_LCIDM_MAX_SHARDS) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                    "too many listener workers");
+        goto out;
+    }
+
+    workers = OPENSSL_realloc(ql->workers,
+                              (ql->num_workers + 1) * sizeof(*workers));
+    if (workers == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+        goto out;
+    }
+    ql->workers = workers;
+
+    w = &ql->workers[ql->num_workers];
+    memset(w, 0, sizeof(*w));
+
+#if defined(OPENSSL_THREADS)
+    if ((w->mutex = ossl_crypto_mutex_new()) == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_CRYPTO_LIB, NULL);
+        goto out;
+    }
+#endif
+
+    engine_args.libctx      = ql->ssl.ctx->libctx;
+    engine_args.propq       = ql->ssl.ctx->propq;
+    engine_args.mutex       = w->mutex;
+    port_args.channel_ctx   = ql->ssl.ctx;
+    port_args.is_multi_conn = 1;
+
+    if ((w->engine = ossl_quic_engine_new(&engine_args)) == NULL
+        || (w->port = ossl_quic_engine_create_port(w->engine,
+                                                    &port_args)) == NULL
+        || !ossl_quic_port_set_net_rbio(w->port, net_rbio)
+        || !ossl_quic_port_set_net_wbio(w->port, net_wbio)
+        || (ql->lb_server_id_len > 0 && !ql_apply_lb_config(ql, w->port))) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+        ql_worker_free(w); /* does not own the BIOs yet */
+        goto out;
+    }
+
+    ossl_quic_port_set_max_datagram_frame_size(w->port,
+                                               ql->max_datagram_frame_size);
+    if (ql->max_incoming > 0)
+        ossl_quic_port_set_max_incoming(w->port, ql->max_incoming);
+
+    /* best effort autoconfig */
+    BIO_set_nbio(net_rbio, 1);
+    if (net_wbio != net_rbio)
+        BIO_set_nbio(net_wbio, 1);
+
+    w->net_rbio = net_rbio;
+    w->net_wbio = net_wbio;
+    ++ql->num_workers;
+    ret = 1;
+
+out:
+    ql_unlock(ql);
+    return ret;
+}
+
+/* SSL_set_quic_lb_config */
+QUIC_TAKES_LOCK
+int ossl_quic_set_lb_config(SSL *ssl, unsigned int config_id,
+                            const unsigned char *server_id,
+                            size_t server_id_len, size_t nonce_len,
+                            const unsigned char *key, size_t key_len)
+{
+    QUIC_LISTENER *ql;
+    QUIC_LB_CONFIG *lb;
+    size_t i;
+    int ret = 0;
+
+    if ((ql = QUIC_LISTENER_FROM_SSL(ssl)) == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                           NULL);
+
+    ql_lock(ql);
+
+    if (ql->listening) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                    "listener is already listening");
+        goto out;
+    }
+
+    /* Check the configuration before changing anything. */
+    lb = ossl_quic_lb_config_new(ql->ssl.ctx->libctx, ql->ssl.ctx->propq,
+                                 config_id, server_id, server_id_len,
+                                 nonce_len, key, key_len);
+    if (lb == NULL) {
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_PASSED_INVALID_ARGUMENT,
+                                    "invalid QUIC-LB configuration");
+        goto out;
+    }
+
+    if (!ossl_quic_port_set_lb_config(ql->port, lb)) {
+        ossl_quic_lb_config_free(lb);
+        QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+        goto out;
+    }
+
+    memcpy(ql->lb_server_id, server_id, server_id_len);
+    ql->lb_server_id_len    = server_id_len;
+    ql->lb_nonce_len        = nonce_len;
+    ql->lb_config_id        = config_id;
+    ql->lb_has_key          = (key != NULL);
+    if (key != NULL)
+        memcpy(ql->lb_key, key, sizeof(ql->lb_key));
+    else
+        OPENSSL_cleanse(ql->lb_key, sizeof(ql->lb_key));
+
+    /* Workers are not running yet, so their ports need no locking. */
+    for (i = 0; i < ql->num_workers; i++)
+        if (!ql_apply_lb_config(ql, ql->workers[i].port)) {
+            QUIC_RAISE_NON_NORMAL_ERROR(NULL, ERR_R_INTERNAL_ERROR, NULL);
+            goto out;
+        }
+
+    ret = 1;
+out:
+    ql_unlock(ql);
+    return ret;
+}
+
 /*
  * QUIC Front-End I/O API: SSL_CTX Management
  * ==========================================
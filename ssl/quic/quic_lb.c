@@ -0,0 +1,229 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "internal/quic_lb.h"
+#include <openssl/evp.h>
+
+#define LB_BLOCK_LEN    16
+
+struct quic_lb_config_st {
+    /* NULL if CIDs are not encrypted */
+    EVP_CIPHER      *cipher;
+    EVP_CIPHER_CTX  *enc_ctx, *dec_ctx;
+
+    unsigned char   server_id[QUIC_LB_MAX_SERVER_ID_LEN];
+    size_t          server_id_len, nonce_len;
+    unsigned char   config_id;
+};
+
+QUIC_LB_CONFIG *ossl_quic_lb_config_new(OSSL_LIB_CTX *libctx,
+                                        const char *propq,
+                                        unsigned int config_id,
+                                        const unsigned char *server_id,
+                                        size_t server_id_len,
+                                        size_t nonce_len,
+                                        const unsigned char *key,
+                                        size_t key_len)
+{
+    QUIC_LB_CONFIG *lb;
+
+    if (config_id > QUIC_LB_MAX_CONFIG_ID
+        || server_id == NULL
+        || server_id_len < QUIC_LB_MIN_SERVER_ID_LEN
+        || server_id_len > QUIC_LB_MAX_SERVER_ID_LEN
+        || nonce_len < QUIC_LB_MIN_NONCE_LEN
+        || nonce_len > QUIC_LB_MAX_NONCE_LEN
+        || 1 + server_id_len + nonce_len > QUIC_MAX_CONN_ID_LEN
+        || (key != NULL && key_len != QUIC_LB_KEY_LEN))
+        return NULL;
+
+    if ((lb = OPENSSL_zalloc(sizeof(*lb))) == NULL)
+        return NULL;
+
+    memcpy(lb->server_id, server_id, server_id_len);
+    lb->server_id_len   = server_id_len;
+    lb->nonce_len       = nonce_len;
+    lb->config_id       = (unsigned char)config_id;
+
+    if (key == NULL)
+        return lb;
+
+    if ((lb->cipher = EVP_CIPHER_fetch(libctx, "AES-128-ECB", propq)) == NULL
+        || (lb->enc_ctx = EVP_CIPHER_CTX_new()) == NULL
+        || (lb->dec_ctx = EVP_CIPHER_CTX_new()) == NULL
+        || !EVP_EncryptInit_ex2(lb->enc_ctx, lb->cipher, key, NULL, NULL)
+        || !EVP_DecryptInit_ex2(lb->dec_ctx, lb->cipher, key, NULL, NULL)
+        || !EVP_CIPHER_CTX_set_padding(lb->enc_ctx, 0)
+        || !EVP_CIPHER_CTX_set_padding(lb->dec_ctx, 0))
+        goto err;
+
+    return lb;
+
+err:
+    ossl_quic_lb_config_free(lb);
+    return NULL;
+}
+
+void ossl_quic_lb_config_free(QUIC_LB_CONFIG *lb)
+{
+    if (lb == NULL)
+        return;
+
+    EVP_CIPHER_CTX_free(lb->enc_ctx);
+    EVP_CIPHER_CTX_free(lb->dec_ctx);
+    EVP_CIPHER_free(lb->cipher);
+    OPENSSL_free(lb);
+}
+
+size_t ossl_quic_lb_config_get_cid_len(const QUIC_LB_CONFIG *lb)
+{
+    return 1 + lb->server_id_len + lb->nonce_len;
+}
+
+size_t ossl_quic_lb_config_get_nonce_len(const QUIC_LB_CONFIG *lb)
+{
+    return lb->nonce_len;
+}
+
+static int lb_block(EVP_CIPHER_CTX *ctx, const unsigned char *in,
+                    unsigned char *out)
+{
+    int outl = 0;
+
+    return EVP_CipherUpdate(ctx, out, &outl, in, LB_BLOCK_LEN)
+        && outl == LB_BLOCK_LEN;
+}
+
+/*
+ * One pass of the Feistel network: XORs the AES encryption of the expansion of
+ * side into target. The expansion is side, zero padded, followed by the
+ * plaintext length and the pass index. For an odd plaintext length, half_len
+ * includes the shared middle byte, of which the left half keeps only the high
+ * nibble and the right half only the low nibble.
+ */
+static int lb_feistel_pass(QUIC_LB_CONFIG *lb, const unsigned char *side,
+                           unsigned char *target, int target_is_left,
+                           size_t pt_len, size_t half_len,
+                           unsigned char idx)
+{
+    unsigned char block[LB_BLOCK_LEN] = {0}, mask[LB_BLOCK_LEN];
+    size_t i;
+
+    memcpy(block, side, half_len);
+    block[LB_BLOCK_LEN - 2] = (unsigned char)pt_len;
+    block[LB_BLOCK_LEN - 1] = idx;
+
+    if (!lb_block(lb->enc_ctx, block, mask))
+        return 0;
+
+    for (i = 0; i < half_len; ++i)
+        target[i] ^= mask[i];
+
+    if ((pt_len & 1) != 0) {
+        if (target_is_left)
+            target[half_len - 1] &= 0xf0;
+        else
+            target[0] &= 0x0f;
+    }
+
+    return 1;
+}
+
+static int lb_four_pass(QUIC_LB_CONFIG *lb, const unsigned char *in,
+                        unsigned char *out, size_t len, int enc)
+{
+    unsigned char l[LB_BLOCK_LEN], r[LB_BLOCK_LEN];
+    size_t half_len = (len + 1) / 2;
+    int odd = (len & 1) != 0;
+
+    memcpy(l, in, half_len);
+    memcpy(r, in + len - half_len, half_len);
+    if (odd) {
+        l[half_len - 1] &= 0xf0;
+        r[0] &= 0x0f;
+    }
+
+    /* The odd passes encrypt the right half, the even ones the left half. */
+    if (enc) {
+        if (!lb_feistel_pass(lb, l, r, 0, len, half_len, 1)
+            || !lb_feistel_pass(lb, r, l, 1, len, half_len, 2)
+            || !lb_feistel_pass(lb, l, r, 0, len, half_len, 3)
+            || !lb_feistel_pass(lb, r, l, 1, len, half_len, 4))
+            return 0;
+    } else {
+        if (!lb_feistel_pass(lb, r, l, 1, len, half_len, 4)
+            || !lb_feistel_pass(lb, l, r, 0, len, half_len, 3)
+            || !lb_feistel_pass(lb, r, l, 1, len, half_len, 2)
+            || !lb_feistel_pass(lb, l, r, 0, len, half_len, 1))
+            return 0;
+    }
+
+    memcpy(out, l, half_len);
+    if (odd) {
+        out[half_len - 1] |= r[0];
+        memcpy(out + half_len, r + 1, half_len - 1);
+    } else {
+        memcpy(out + half_len, r, half_len);
+    }
+
+    return 1;
+}
+
+static int lb_crypt(QUIC_LB_CONFIG *lb, const unsigned char *in,
+                    unsigned char *out, int enc)
+{
+    size_t len = lb->server_id_len + lb->nonce_len;
+
+    if (lb->cipher == NULL) {
+        memmove(out, in, len);
+        return 1;
+    }
+
+    if (len == LB_BLOCK_LEN)
+        return lb_block(enc ? lb->enc_ctx : lb->dec_ctx, in, out);
+
+    return lb_four_pass(lb, in, out, len, enc);
+}
+
+int ossl_quic_lb_encode_cid(QUIC_LB_CONFIG *lb, const unsigned char *nonce,
+                            QUIC_CONN_ID *cid)
+{
+    unsigned char pt[QUIC_MAX_CONN_ID_LEN];
+    size_t cid_len = ossl_quic_lb_config_get_cid_len(lb);
+
+    memcpy(pt, lb->server_id, lb->server_id_len);
+    memcpy(pt + lb->server_id_len, nonce, lb->nonce_len);
+
+    if (!lb_crypt(lb, pt, cid->id + 1, 1))
+        return 0;
+
+    /* The low five bits of the first octet self-encode the CID length. */
+    cid->id[0]  = (unsigned char)((lb->config_id << 5) | (cid_len - 1));
+    cid->id_len = (unsigned char)cid_len;
+    return 1;
+}
+
+int ossl_quic_lb_decode_cid(QUIC_LB_CONFIG *lb, const QUIC_CONN_ID *cid,
+                            unsigned char *server_id, unsigned char *nonce)
+{
+    unsigned char pt[QUIC_MAX_CONN_ID_LEN];
+
+    if (cid->id_len != ossl_quic_lb_config_get_cid_len(lb)
+        || (cid->id[0] >> 5) != lb->config_id)
+        return 0;
+
+    if (!lb_crypt(lb, cid->id + 1, pt, 0))
+        return 0;
+
+    if (server_id != NULL)
+        memcpy(server_id, pt, lb->server_id_len);
+    if (nonce != NULL)
+        memcpy(nonce, pt + lb->server_id_len, lb->nonce_len);
+    return 1;
+}
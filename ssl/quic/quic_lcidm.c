@@ -8,6 +8,7 @@
  */
 
 #include "internal/quic_lcidm.h"
+#include "internal/quic_lb.h"
 #include "internal/quic_types.h"
 #include "internal/quic_vlint.h"
 #include "internal/common.h"
@@ -58,6 +59,8 @@ struct quic_lcidm_st {
     LHASH_OF(QUIC_LCID)         *lcids; /* (QUIC_CONN_ID) -> (QUIC_LCID *)  */
     LHASH_OF(QUIC_LCIDM_CONN)   *conns; /* (void *opaque) -> (QUIC_LCIDM_CONN *) */
     size_t                      lcid_len; /* Length in bytes for all LCIDs */
+    size_t                      shard_idx, num_shards;
+    QUIC_LB_CONFIG              *lb; /* Encodes LCIDs if non-NULL */
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     QUIC_CONN_ID                next_lcid;
 #endif
@@ -111,8 +114,9 @@ QUIC_LCIDM *ossl_quic_lcidm_new(OSSL_LIB_CTX *libctx, size_t lcid_len)
                                                lcidm_conn_comp)) == NULL)
         goto err;
 
-    lcidm->libctx   = libctx;
-    lcidm->lcid_len = lcid_len;
+    lcidm->libctx       = libctx;
+    lcidm->lcid_len     = lcid_len;
+    lcidm->num_shards   = 1;
     return lcidm;
 
 err:
@@ -159,6 +163,7 @@ void ossl_quic_lcidm_free(QUIC_LCIDM *lcidm)
 
     lh_QUIC_LCID_free(lcidm->lcids);
     lh_QUIC_LCIDM_CONN_free(lcidm->conns);
+    ossl_quic_lb_config_free(lcidm->lb);
     OPENSSL_free(lcidm);
 }
 
@@ -287,23 +292,97 @@ size_t ossl_quic_lcidm_get_num_active_lcid(const QUIC_LCIDM *lcidm,
     return conn->num_active_lcid;
 }
 
+int ossl_quic_lcidm_set_shard(QUIC_LCIDM *lcidm, size_t shard_idx,
+                              size_t num_shards)
+{
+    if (num_shards == 0 || num_shards > QUIC_LCIDM_MAX_SHARDS
+        || shard_idx >= num_shards
+        || (num_shards > 1 && lcidm->lcid_len == 0))
+        return 0;
+
+    lcidm->shard_idx    = shard_idx;
+    lcidm->num_shards   = num_shards;
+    return 1;
+}
+
+int ossl_quic_lcidm_set_lb_config(QUIC_LCIDM *lcidm, QUIC_LB_CONFIG *lb)
+{
+    if (lb == NULL || lh_QUIC_LCIDM_CONN_num_items(lcidm->conns) > 0)
+        return 0;
+
+    ossl_quic_lb_config_free(lcidm->lb);
+    lcidm->lb       = lb;
+    lcidm->lcid_len = ossl_quic_lb_config_get_cid_len(lb);
+    return 1;
+}
+
+size_t ossl_quic_lcidm_get_shard(QUIC_LCIDM *lcidm,
+                                 const QUIC_CONN_ID *lcid)
+{
+    unsigned char nonce[QUIC_LB_MAX_NONCE_LEN];
+
+    if (lcidm->num_shards == 1 || lcid->id_len != lcidm->lcid_len)
+        return 0;
+
+    if (lcidm->lb == NULL)
+        return lcid->id[0] % lcidm->num_shards;
+
+    /* The shard is identified by the first byte of the nonce. */
+    if (!ossl_quic_lb_decode_cid(lcidm->lb, lcid, NULL, nonce))
+        return 0;
+
+    return nonce[0] % lcidm->num_shards;
+}
+
 static int lcidm_generate_cid(QUIC_LCIDM *lcidm,
                               QUIC_CONN_ID *cid)
 {
+    QUIC_CONN_ID nonce, *raw;
+    size_t v, raw_len;
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     int i;
+#endif
 
-    lcidm->next_lcid.id_len = (unsigned char)lcidm->lcid_len;
-    *cid = lcidm->next_lcid;
+    /*
+     * With a QUIC-LB configuration, the random part of the LCID is the nonce,
+     * which is then encoded along with our server ID.
+     */
+    if (lcidm->lb != NULL) {
+        raw     = &nonce;
+        raw_len = ossl_quic_lb_config_get_nonce_len(lcidm->lb);
+    } else {
+        raw     = cid;
+        raw_len = lcidm->lcid_len;
+    }
+
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    lcidm->next_lcid.id_len = (unsigned char)raw_len;
+    *raw = lcidm->next_lcid;
 
-    for (i = lcidm->lcid_len - 1; i >= 0; --i)
+    for (i = raw_len - 1; i >= 0; --i)
         if (++lcidm->next_lcid.id[i] != 0)
             break;
-
-    return 1;
 #else
-    return ossl_quic_gen_rand_conn_id(lcidm->libctx, lcidm->lcid_len, cid);
+    if (!ossl_quic_gen_rand_conn_id(lcidm->libctx, raw_len, raw))
+        return 0;
 #endif
+
+    if (lcidm->num_shards > 1) {
+        /*
+         * Replace the first byte with the nearest value which is congruent to
+         * our shard index modulo the number of shards.
+         */
+        v = raw->id[0] - raw->id[0] % lcidm->num_shards + lcidm->shard_idx;
+        if (v > 0xff)
+            v -= lcidm->num_shards;
+
+        raw->id[0] = (unsigned char)v;
+    }
+
+    if (lcidm->lb != NULL)
+        return ossl_quic_lb_encode_cid(lcidm->lb, nonce.id, cid);
+
+    return 1;
 }
 
 static int lcidm_generate(QUIC_LCIDM *lcidm,
@@ -22,6 +22,7 @@
 # include "internal/quic_channel.h"
 # include "internal/quic_reactor.h"
 # include "internal/quic_thread_assist.h"
+# include "internal/quic_lb.h"
 # include "../ssl_local.h"
 
 # ifndef OPENSSL_NO_QUIC
@@ -92,6 +93,19 @@ struct quic_xso_st {
      */
     size_t                          aon_buf_pos;
 
+    /*
+     * Is there a receive buffer borrowed by SSL_borrow_read_buf() which has not
+     * yet been released? If so, read_borrow_len is its length, and
+     * read_borrow_fin is set if it runs up to the end of the stream. We hold a
+     * reference to the packet containing the borrowed data (if any), so that
+     * the data remains valid even if the stream is reset before the caller
+     * releases it.
+     */
+    unsigned int                    read_borrowed           : 1;
+    unsigned int                    read_borrow_fin         : 1;
+    size_t                          read_borrow_len;
+    OSSL_QRX_PKT                    *read_borrow_pkt;
+
     /* SSL_set_mode */
     uint32_t                        ssl_mode;
 
@@ -106,6 +120,99 @@ struct quic_xso_st {
     int                             last_error;
 };
 
+/*
+ * An additional shard of a QUIC listener, added with SSL_add_listener_worker().
+ * Each shard has its own engine, port, mutex and network BIOs, and accepts
+ * connections independently of the others.
+ */
+typedef struct quic_listener_worker_st {
+    QUIC_ENGINE                     *engine;
+    QUIC_PORT                       *port;
+
+    /* The mutex of the engine, which we own. */
+    CRYPTO_MUTEX                    *mutex;
+
+    /* The network read and write BIOs, which may be the same BIO. */
+    BIO                             *net_rbio, *net_wbio;
+} QUIC_LISTENER_WORKER;
+
+/*
+ * QUIC listener SSL object (QLSO) type. This implements the API personality
+ * layer for a listener, which owns a QUIC_PORT (and the QUIC_ENGINE it belongs
+ * to) and hands out incoming connections on it as QUIC_CONNECTION objects.
+ */
+struct quic_listener_st {
+    /* SSL object common header. */
+    struct ssl_st                   ssl;
+
+    /* The QUIC engine representing the QUIC event domain. */
+    QUIC_ENGINE                     *engine;
+
+    /* The QUIC port representing the QUIC listener and socket. */
+    QUIC_PORT                       *port;
+
+    /*
+     * The mutex used to synchronise access to the QUIC_ENGINE. We own this but
+     * provide it to the engine, and to the connections we hand out.
+     */
+    CRYPTO_MUTEX                    *mutex;
+
+    /* The network read and write BIOs. */
+    BIO                             *net_rbio, *net_wbio;
+
+    /*
+     * Additional shards, if any. The engine, port and mutex above form shard 0,
+     * and workers[i] is shard i + 1. If there are any workers, every shard is
+     * serviced by a worker thread of its engine once the listener is
+     * listening, and the connections accepted from a shard use its engine,
+     * port and mutex. The set of shards does not change once listening.
+     */
+    QUIC_LISTENER_WORKER            *workers;
+    size_t                          num_workers;
+
+    /*
+     * Used to wait for an incoming connection on any shard when there are
+     * workers. incoming_gen counts the incoming connections queued on any
+     * shard, and next_shard is the shard SSL_accept_connection tries first.
+     * Both are protected by accept_mutex, which is never held while locking
+     * the mutex of a shard.
+     */
+    CRYPTO_MUTEX                    *accept_mutex;
+    CRYPTO_CONDVAR                  *accept_cv;
+    uint64_t                        incoming_gen;
+    size_t                          next_shard;
+
+    /*
+     * The QUIC-LB configuration set with SSL_set_quic_lb_config(), if
+     * lb_server_id_len is non-zero. It is applied to every shard.
+     */
+    unsigned char                   lb_server_id[QUIC_LB_MAX_SERVER_ID_LEN];
+    unsigned char                   lb_key[QUIC_LB_KEY_LEN];
+    size_t                          lb_server_id_len, lb_nonce_len;
+    unsigned int                    lb_config_id;
+
+    /* Set with SSL_set_max_datagram_frame_size() and applied to every shard. */
+    uint64_t                        max_datagram_frame_size;
+
+    /*
+     * Set with SSL_set_max_accept_connection_queue_len() and applied to every
+     * shard, or 0 if the default of the ports is used.
+     */
+    size_t                          max_incoming;
+
+    /* Has SSL_listen been called (possibly implicitly)? */
+    unsigned int                    listening               : 1;
+
+    /* Does SSL_accept_connection block? */
+    unsigned int                    blocking                : 1;
+
+    /* Does the application want blocking mode? */
+    unsigned int                    desires_blocking        : 1;
+
+    /* Does the QUIC-LB configuration have a key? */
+    unsigned int                    lb_has_key              : 1;
+};
+
 struct quic_conn_st {
     /*
      * ssl_st is a common header for ordinary SSL objects, QUIC connection
@@ -118,6 +225,13 @@ struct quic_conn_st {
 
     SSL                             *tls;
 
+    /*
+     * The listener this connection was accepted from, or NULL for a client
+     * connection. An accepted connection holds a reference to its listener and
+     * uses its engine, port and mutex, which it does not own.
+     */
+    QUIC_LISTENER                   *listener;
+
     /* The QUIC engine representing the QUIC event domain. */
     QUIC_ENGINE                     *engine;
 
@@ -171,8 +285,8 @@ struct quic_conn_st {
     unsigned int                    started                 : 1;
 
     /*
-     * This is 1 if we were instantiated using a QUIC server method
-     * (for future use).
+     * This is 1 if we are a server-side connection, i.e., were accepted from a
+     * QUIC listener.
      */
     unsigned int                    as_server               : 1;
 
@@ -194,6 +308,9 @@ struct quic_conn_st {
     /* Have we created a default XSO yet? */
     unsigned int                    default_xso_created     : 1;
 
+    /* Did the application start the connection with SSL_write_early_data()? */
+    unsigned int                    early_data              : 1;
+
     /*
      * Pre-TERMINATING shutdown phase in which we are flushing streams.
      * Monotonically transitions to 1.
@@ -251,7 +368,8 @@ int ossl_quic_trace(int write_p, int version, int content_type,
 #  define OSSL_QUIC_ANY_VERSION 0xFFFFF
 #  define IS_QUIC_METHOD(m) \
     ((m) == OSSL_QUIC_client_method() || \
-     (m) == OSSL_QUIC_client_thread_method())
+     (m) == OSSL_QUIC_client_thread_method() || \
+     (m) == OSSL_QUIC_server_method())
 #  define IS_QUIC_CTX(ctx)          IS_QUIC_METHOD((ctx)->method)
 
 #  define QUIC_CONNECTION_FROM_SSL_int(ssl, c)   \
@@ -260,6 +378,12 @@ int ossl_quic_trace(int write_p, int version, int content_type,
          ? (c QUIC_CONNECTION *)(ssl)            \
          : NULL))
 
+#  define QUIC_LISTENER_FROM_SSL_int(ssl, c)     \
+     ((ssl) == NULL ? NULL                       \
+      : ((ssl)->type == SSL_TYPE_QUIC_LISTENER   \
+         ? (c QUIC_LISTENER *)(ssl)              \
+         : NULL))
+
 #  define QUIC_XSO_FROM_SSL_int(ssl, c)                             \
     ((ssl) == NULL                                                  \
      ? NULL                                                         \
@@ -277,9 +401,11 @@ int ossl_quic_trace(int write_p, int version, int content_type,
 
 #  define IS_QUIC(ssl) ((ssl) != NULL                                   \
                         && ((ssl)->type == SSL_TYPE_QUIC_CONNECTION     \
-                            || (ssl)->type == SSL_TYPE_QUIC_XSO))
+                            || (ssl)->type == SSL_TYPE_QUIC_XSO         \
+                            || (ssl)->type == SSL_TYPE_QUIC_LISTENER))
 # else
 #  define QUIC_CONNECTION_FROM_SSL_int(ssl, c) NULL
+#  define QUIC_LISTENER_FROM_SSL_int(ssl, c) NULL
 #  define QUIC_XSO_FROM_SSL_int(ssl, c) NULL
 #  define SSL_CONNECTION_FROM_QUIC_SSL_int(ssl, c) NULL
 #  define IS_QUIC(ssl) 0
@@ -291,6 +417,10 @@ int ossl_quic_trace(int write_p, int version, int content_type,
     QUIC_CONNECTION_FROM_SSL_int(ssl, SSL_CONNECTION_NO_CONST)
 # define QUIC_CONNECTION_FROM_CONST_SSL(ssl) \
     QUIC_CONNECTION_FROM_SSL_int(ssl, const)
+# define QUIC_LISTENER_FROM_SSL(ssl) \
+    QUIC_LISTENER_FROM_SSL_int(ssl, SSL_CONNECTION_NO_CONST)
+# define QUIC_LISTENER_FROM_CONST_SSL(ssl) \
+    QUIC_LISTENER_FROM_SSL_int(ssl, const)
 # define QUIC_XSO_FROM_SSL(ssl) \
     QUIC_XSO_FROM_SSL_int(ssl, SSL_CONNECTION_NO_CONST)
 # define QUIC_XSO_FROM_CONST_SSL(ssl) \
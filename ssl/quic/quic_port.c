@@ -22,14 +22,24 @@
  */
 #define INIT_DCID_LEN                   8
 
+/* Maximum number of datagrams forwarded by other shards we queue. */
+#define MAX_INBOX_LEN                   1024
+
+/* Default maximum number of incoming channels waiting to be popped. */
+#define DEFAULT_MAX_INCOMING            1024
+
 static int port_init(QUIC_PORT *port);
 static void port_cleanup(QUIC_PORT *port);
 static OSSL_TIME get_time(void *arg);
 static void port_default_packet_handler(QUIC_URXE *e, void *arg,
                                         const QUIC_CONN_ID *dcid);
 static void port_rx_pre(QUIC_PORT *port);
+static void port_inbox_clear(QUIC_PORT *port);
+static void port_free_incoming(QUIC_CHANNEL *ch);
+static void port_prune_incoming(QUIC_PORT *port);
 
 DEFINE_LIST_OF_IMPL(ch, QUIC_CHANNEL);
+DEFINE_LIST_OF_IMPL(incoming_ch, QUIC_CHANNEL);
 DEFINE_LIST_OF_IMPL(port, QUIC_PORT);
 
 QUIC_PORT *ossl_quic_port_new(const QUIC_PORT_ARGS *args)
@@ -89,6 +99,8 @@ static int port_init(QUIC_PORT *port)
 
     port->rx_short_dcid_len = (unsigned char)rx_short_dcid_len;
     port->tx_init_dcid_len  = INIT_DCID_LEN;
+    port->num_shards        = 1;
+    port->max_incoming      = DEFAULT_MAX_INCOMING;
     port->state             = QUIC_PORT_STATE_RUNNING;
 
     ossl_list_port_insert_tail(&port->engine->port_list, port);
@@ -102,8 +114,19 @@ err:
 
 static void port_cleanup(QUIC_PORT *port)
 {
+    QUIC_CHANNEL *ch;
+
+    /* Free any incoming channels nobody has taken ownership of. */
+    while ((ch = ossl_quic_port_pop_incoming(port)) != NULL)
+        port_free_incoming(ch);
+
     assert(ossl_list_ch_num(&port->channel_list) == 0);
 
+    port_inbox_clear(port);
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_free(&port->inbox_mutex);
+#endif
+
     ossl_quic_demux_free(port->demux);
     port->demux = NULL;
 
@@ -313,6 +336,7 @@ static QUIC_CHANNEL *port_make_channel(QUIC_PORT *port, SSL *tls, int is_server)
     args.tls        = (tls != NULL ? tls : port_new_handshake_layer(port));
     args.lcidm      = port->lcidm;
     args.srtm       = port->srtm;
+    args.max_datagram_frame_size = port->max_datagram_frame_size;
     if (args.tls == NULL)
         return NULL;
 
@@ -344,6 +368,239 @@ QUIC_CHANNEL *ossl_quic_port_create_incoming(QUIC_PORT *port, SSL *tls)
     return ch;
 }
 
+void ossl_quic_port_set_max_datagram_frame_size(QUIC_PORT *port,
+                                                uint64_t max_size)
+{
+    port->max_datagram_frame_size = max_size;
+}
+
+void ossl_quic_port_set_allow_incoming(QUIC_PORT *port, int allow_incoming)
+{
+    port->allow_incoming = (allow_incoming != 0);
+    if (port->allow_incoming)
+        port->is_server = 1;
+}
+
+void ossl_quic_port_set_max_incoming(QUIC_PORT *port, size_t max_incoming)
+{
+    port->max_incoming = max_incoming;
+}
+
+QUIC_CHANNEL *ossl_quic_port_pop_incoming(QUIC_PORT *port)
+{
+    QUIC_CHANNEL *ch;
+
+    ch = ossl_list_incoming_ch_head(&port->incoming_channel_list);
+    if (ch != NULL)
+        ossl_list_incoming_ch_remove(&port->incoming_channel_list, ch);
+
+    return ch;
+}
+
+/* Frees an incoming channel which was never popped. */
+static void port_free_incoming(QUIC_CHANNEL *ch)
+{
+    SSL *tls = ossl_quic_channel_get0_ssl(ch);
+
+    SSL_free(tls);
+    ossl_quic_channel_free(ch);
+}
+
+/*
+ * Frees the incoming channels which have terminated, e.g. because their
+ * handshake timed out or the peer closed the connection, before the application
+ * popped them. They would otherwise hold on to a place in the queue forever.
+ */
+static void port_prune_incoming(QUIC_PORT *port)
+{
+    QUIC_CHANNEL *ch, *chnext;
+
+    LIST_FOREACH_DELSAFE(ch, chnext, incoming_ch,
+                         &port->incoming_channel_list) {
+        if (!ossl_quic_channel_is_terminated(ch))
+            continue;
+
+        ossl_list_incoming_ch_remove(&port->incoming_channel_list, ch);
+        port_free_incoming(ch);
+    }
+}
+
+size_t ossl_quic_port_get_num_incoming_channels(const QUIC_PORT *port)
+{
+    return ossl_list_incoming_ch_num(&port->incoming_channel_list);
+}
+
+int ossl_quic_port_have_incoming(const QUIC_PORT *port)
+{
+    return ossl_list_incoming_ch_head(&port->incoming_channel_list) != NULL;
+}
+
+void ossl_quic_port_set_incoming_cb(QUIC_PORT *port,
+                                    ossl_quic_port_incoming_cb_fn *cb,
+                                    void *cb_arg)
+{
+    port->incoming_cb       = cb;
+    port->incoming_cb_arg   = cb_arg;
+}
+
+/*
+ * QUIC Port: Sharding
+ * ===================
+ */
+
+int ossl_quic_port_set_shard(QUIC_PORT *port,
+                             size_t shard_idx, size_t num_shards,
+                             ossl_quic_port_fwd_cb_fn *fwd_cb,
+                             void *fwd_cb_arg)
+{
+    if (ossl_list_ch_num(&port->channel_list) > 0
+        || (num_shards > 1 && fwd_cb == NULL))
+        return 0;
+
+#if defined(OPENSSL_THREADS)
+    if (num_shards > 1 && port->inbox_mutex == NULL
+        && (port->inbox_mutex = ossl_crypto_mutex_new()) == NULL)
+        return 0;
+#else
+    if (num_shards > 1)
+        return 0;
+#endif
+
+    if (!ossl_quic_lcidm_set_shard(port->lcidm, shard_idx, num_shards))
+        return 0;
+
+    port->shard_idx     = shard_idx;
+    port->num_shards    = num_shards;
+    port->fwd_cb        = fwd_cb;
+    port->fwd_cb_arg    = fwd_cb_arg;
+    return 1;
+}
+
+int ossl_quic_port_post_dgram(QUIC_PORT *port, const QUIC_URXE *e)
+{
+    QUIC_PORT_DGRAM *d;
+
+    if (port->inbox_mutex == NULL)
+        return 0;
+
+    if ((d = OPENSSL_malloc(sizeof(*d) + e->data_len)) == NULL)
+        return 0;
+
+    d->next     = NULL;
+    d->peer     = e->peer;
+    d->local    = e->local;
+    d->data_len = e->data_len;
+    memcpy(d + 1, ossl_quic_urxe_data(e), e->data_len);
+
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_lock(port->inbox_mutex);
+#endif
+    if (port->inbox_len >= MAX_INBOX_LEN) {
+        /* Drop the datagram, as the network would. */
+        OPENSSL_free(d);
+        d = NULL;
+    } else {
+        if (port->inbox_tail != NULL)
+            port->inbox_tail->next = d;
+        else
+            port->inbox_head = d;
+
+        port->inbox_tail = d;
+        ++port->inbox_len;
+    }
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_unlock(port->inbox_mutex);
+#endif
+
+    return d != NULL;
+}
+
+/* Takes all datagrams from the inbox of the port. */
+static QUIC_PORT_DGRAM *port_inbox_take(QUIC_PORT *port)
+{
+    QUIC_PORT_DGRAM *d;
+
+    if (port->inbox_mutex == NULL)
+        return NULL;
+
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_lock(port->inbox_mutex);
+#endif
+    d = port->inbox_head;
+    port->inbox_head = port->inbox_tail = NULL;
+    port->inbox_len = 0;
+#if defined(OPENSSL_THREADS)
+    ossl_crypto_mutex_unlock(port->inbox_mutex);
+#endif
+
+    return d;
+}
+
+static void port_inbox_clear(QUIC_PORT *port)
+{
+    QUIC_PORT_DGRAM *d, *dnext;
+
+    for (d = port_inbox_take(port); d != NULL; d = dnext) {
+        dnext = d->next;
+        OPENSSL_free(d);
+    }
+}
+
+/* Processes datagrams forwarded to us by other shards, if any. */
+static void port_rx_inbox(QUIC_PORT *port)
+{
+    QUIC_PORT_DGRAM *d, *dnext;
+
+    for (d = port_inbox_take(port); d != NULL; d = dnext) {
+        dnext = d->next;
+        /* Best effort; a datagram we cannot handle is lost. */
+        ossl_quic_demux_inject(port->demux, (unsigned char *)(d + 1),
+                               d->data_len, &d->peer, &d->local);
+        OPENSSL_free(d);
+    }
+}
+
+/*
+ * QUIC Port: Load Balancer Routing
+ * ================================
+ */
+
+int ossl_quic_port_set_lb_config(QUIC_PORT *port, QUIC_LB_CONFIG *lb)
+{
+    size_t lcid_len;
+
+    if (!port->is_multi_conn
+        || ossl_list_ch_num(&port->channel_list) > 0
+        || !ossl_quic_lcidm_set_lb_config(port->lcidm, lb))
+        return 0;
+
+    lcid_len = ossl_quic_lcidm_get_lcid_len(port->lcidm);
+    ossl_quic_demux_set_short_conn_id_len(port->demux, lcid_len);
+    port->rx_short_dcid_len = (unsigned char)lcid_len;
+    return 1;
+}
+
+/*
+ * Returns 1 if the first packet in a datagram is one which always carries a
+ * DCID we issued, and which therefore identifies the shard which owns the
+ * connection. The DCID of Initial and 0-RTT packets may have been chosen by the
+ * peer, and cannot be used to find the shard.
+ */
+static int port_dgram_has_local_dcid(const QUIC_URXE *e)
+{
+    const unsigned char *data = ossl_quic_urxe_data(e);
+
+    if (e->data_len == 0)
+        return 0;
+
+    /* A 1-RTT packet (short header). */
+    if ((data[0] & 0x80) == 0)
+        return 1;
+
+    /* A QUIC v1 Handshake packet (long header with long packet type 2). */
+    return ((data[0] >> 4) & 0x3) == 2;
+}
+
 /*
  * QUIC Port: Ticker-Mutator
  * =========================
@@ -363,9 +620,11 @@ void ossl_quic_port_subtick(QUIC_PORT *port, QUIC_TICK_RESULT *res,
     res->tick_deadline      = ossl_time_infinite();
 
     if (!port->engine->inhibit_tick) {
-        /* Handle any incoming data from network. */
-        if (ossl_quic_port_is_running(port))
+        /* Handle any incoming data from network and other shards. */
+        if (ossl_quic_port_is_running(port)) {
             port_rx_pre(port);
+            port_rx_inbox(port);
+        }
 
         /* Iterate through all channels and service them. */
         LIST_FOREACH(ch, ch, &port->channel_list) {
@@ -374,6 +633,12 @@ void ossl_quic_port_subtick(QUIC_PORT *port, QUIC_TICK_RESULT *res,
             ossl_quic_channel_subtick(ch, &subr, flags);
             ossl_quic_tick_result_merge_into(res, &subr);
         }
+
+        port_prune_incoming(port);
+
+        /* A port accepting connections always wants to hear about them. */
+        if (port->allow_incoming && ossl_quic_port_is_running(port))
+            res->net_read_desired = 1;
     }
 }
 
@@ -426,6 +691,8 @@ static void port_on_new_conn(QUIC_PORT *port, const BIO_ADDR *peer,
                              const QUIC_CONN_ID *dcid,
                              QUIC_CHANNEL **new_ch)
 {
+    QUIC_CHANNEL *ch;
+
     if (port->tserver_ch != NULL) {
         /* Specially assign to existing channel */
         if (!ossl_quic_channel_on_new_conn(port->tserver_ch, peer, scid, dcid))
@@ -435,6 +702,36 @@ static void port_on_new_conn(QUIC_PORT *port, const BIO_ADDR *peer,
         port->tserver_ch = NULL;
         return;
     }
+
+    if (!port->allow_incoming)
+        return;
+
+    /*
+     * Drop the connection request if the queue of incoming channels is full.
+     * The client retransmits its Initial packets, so it can still get in once
+     * the application has popped some channels.
+     */
+    if (ossl_list_incoming_ch_num(&port->incoming_channel_list)
+            >= port->max_incoming)
+        return;
+
+    /*
+     * Create a new channel for the connection and queue it until the
+     * application takes it.
+     */
+    if ((ch = port_make_channel(port, NULL, /*is_server=*/1)) == NULL)
+        return;
+
+    if (!ossl_quic_channel_on_new_conn(ch, peer, scid, dcid)) {
+        port_free_incoming(ch);
+        return;
+    }
+
+    ossl_list_incoming_ch_insert_tail(&port->incoming_channel_list, ch);
+    *new_ch = ch;
+
+    if (port->incoming_cb != NULL)
+        port->incoming_cb(port, port->incoming_cb_arg);
 }
 
 static int port_try_handle_stateless_reset(QUIC_PORT *port, const QUIC_URXE *e)
@@ -510,16 +807,25 @@ static void port_default_packet_handler(QUIC_URXE *e, void *arg,
     if (port_try_handle_stateless_reset(port, e))
         goto undesirable;
 
+    /* Pass on a datagram for a connection of another shard. */
+    if (dcid != NULL && port->num_shards > 1
+        && port_dgram_has_local_dcid(e)) {
+        size_t shard_idx = ossl_quic_lcidm_get_shard(port->lcidm, dcid);
+
+        if (shard_idx != port->shard_idx) {
+            port->fwd_cb(e, shard_idx, port->fwd_cb_arg);
+            goto undesirable;
+        }
+    }
+
     /*
      * If we have an incoming packet which doesn't match any existing connection
-     * we assume this is an attempt to make a new connection. Currently we
-     * require our caller to have precreated a latent 'incoming' channel via
-     * TSERVER which then gets turned into the new connection.
-     *
-     * TODO(QUIC SERVER): In the future we will construct channels dynamically
-     * in this case.
+     * we assume this is an attempt to make a new connection. We only handle it
+     * if the port creates channels for incoming connections, or if our caller
+     * has precreated a latent 'incoming' channel via TSERVER which then gets
+     * turned into the new connection.
      */
-    if (port->tserver_ch == NULL)
+    if (port->tserver_ch == NULL && !port->allow_incoming)
         goto undesirable;
 
     /*
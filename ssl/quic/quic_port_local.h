@@ -26,6 +26,17 @@
  * Other components should not include this header.
  */
 DECLARE_LIST_OF(ch, QUIC_CHANNEL);
+DECLARE_LIST_OF(incoming_ch, QUIC_CHANNEL);
+
+/* A datagram forwarded to the port by another shard. */
+typedef struct quic_port_dgram_st QUIC_PORT_DGRAM;
+
+struct quic_port_dgram_st {
+    QUIC_PORT_DGRAM                 *next;
+    BIO_ADDR                        peer, local;
+    size_t                          data_len;
+    /* The datagram follows. */
+};
 
 /* A port is always in one of the following states: */
 enum {
@@ -62,6 +73,15 @@ struct quic_port_st {
     /* List of all child channels. */
     OSSL_LIST(ch)                   channel_list;
 
+    /*
+     * Channels created for incoming connections which have not been popped
+     * yet. The port owns these and their handshake layer objects.
+     */
+    OSSL_LIST(incoming_ch)          incoming_channel_list;
+
+    /* Maximum number of entries on incoming_channel_list. */
+    size_t                          max_incoming;
+
     /* Special TSERVER channel. To be removed in the future. */
     QUIC_CHANNEL                    *tserver_ch;
 
@@ -71,6 +91,29 @@ struct quic_port_st {
     /* SRTM used for incoming packet routing by SRT. */
     QUIC_SRTM                       *srtm;
 
+    /* Called when an incoming channel is queued. */
+    ossl_quic_port_incoming_cb_fn   *incoming_cb;
+    void                            *incoming_cb_arg;
+
+    /* Our shard index and the number of shards, which is 1 if not sharded. */
+    size_t                          shard_idx, num_shards;
+
+    /* Called with datagrams belonging to another shard. */
+    ossl_quic_port_fwd_cb_fn        *fwd_cb;
+    void                            *fwd_cb_arg;
+
+    /*
+     * Datagrams forwarded to us by other shards. These are protected by
+     * inbox_mutex rather than the engine mutex, as they are posted by threads
+     * servicing other shards.
+     */
+    CRYPTO_MUTEX                    *inbox_mutex;
+    QUIC_PORT_DGRAM                 *inbox_head, *inbox_tail;
+    size_t                          inbox_len;
+
+    /* max_datagram_frame_size applied to channels we create (RFC 9221). */
+    uint64_t                        max_datagram_frame_size;
+
     /* Port-level permanent errors (causing failure state) are stored here. */
     ERR_STATE                       *err_state;
 
@@ -91,6 +134,9 @@ struct quic_port_st {
     /* Does this port allow incoming connections? */
     unsigned int                    is_server                       : 1;
 
+    /* Does this port create channels for incoming connections? */
+    unsigned int                    allow_incoming                  : 1;
+
     /* Are we on the QUIC_ENGINE linked list of ports? */
     unsigned int                    on_engine_list                  : 1;
 };
@@ -277,7 +277,12 @@ static int poll_two_fds(int rfd, int rfd_want_read,
         } else {
             now         = ossl_time_now();
             timeout     = ossl_time_subtract(deadline, now);
-            timeout_ms  = ossl_time2ms(timeout);
+            /*
+             * Round up, so that we do not spin until a deadline less than a
+             * millisecond away (such as the next pacing slot) arrives.
+             */
+            timeout_ms  = (int)((ossl_time2ticks(timeout) + OSSL_TIME_MS - 1)
+                                / OSSL_TIME_MS);
         }
 
         pres = poll(pfds, npfd, timeout_ms);
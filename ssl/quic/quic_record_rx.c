@@ -495,8 +495,13 @@ static int qrx_validate_hdr_early(OSSL_QRX *qrx, RXE *rxe,
         && rxe->hdr.version != QUIC_VERSION_NONE)
         return 0;
 
-    /* Clients should never receive 0-RTT packets. */
-    if (rxe->hdr.type == QUIC_PKT_TYPE_0RTT)
+    /*
+     * Clients should never receive 0-RTT packets, and a client's QRX discards
+     * the 0-RTT EL up front. A server does so once it no longer expects 0-RTT.
+     */
+    if (rxe->hdr.type == QUIC_PKT_TYPE_0RTT
+        && ossl_qrl_enc_level_set_have_el(&qrx->el_set,
+                                          QUIC_ENC_LEVEL_0RTT) == -1)
         return 0;
 
     /* Version negotiation and retry packets must be the first packet. */
@@ -702,9 +707,14 @@ static int qrx_decrypt_pkt_body(OSSL_QRX *qrx, unsigned char *dst,
 
     cctx = el->cctx[cctx_idx];
 
-    /* Construct nonce (nonce=IV ^ PN). */
-    nonce_len = EVP_CIPHER_CTX_get_iv_length(cctx);
-    if (!ossl_assert(nonce_len >= (int)sizeof(QUIC_PN)))
+    /*
+     * Construct nonce (nonce=IV ^ PN). The IV length is taken from the suite
+     * rather than queried from the cipher context, which would cost a
+     * parameter round trip to the provider for every packet.
+     */
+    nonce_len = (int)ossl_qrl_get_suite_cipher_iv_len(el->suite_id);
+    if (!ossl_assert(nonce_len >= (int)sizeof(QUIC_PN)
+                     && nonce_len <= EVP_MAX_IV_LENGTH))
         return 0;
 
     memcpy(nonce, el->iv[cctx_idx], nonce_len);
@@ -926,13 +936,17 @@ static int qrx_process_pkt(OSSL_QRX *qrx, QUIC_URXE *urxe,
         rxe->hdr.token = token;
     }
 
-    /* Now remove header protection. */
-    *pkt = orig_pkt;
-
     el = ossl_qrl_enc_level_set_get(&qrx->el_set, enc_level, 1);
     assert(el != NULL); /* Already checked above */
 
+    /*
+     * Now remove header protection, unless that was done before, in which
+     * case the full header was decoded above and pkt already points past the
+     * packet.
+     */
     if (need_second_decode) {
+        *pkt = orig_pkt;
+
         if (!ossl_quic_hdr_protector_decrypt(&el->hpr, &ptrs))
             goto malformed;
 
@@ -1187,11 +1201,83 @@ static int qrx_process_one_urxe(OSSL_QRX *qrx, QUIC_URXE *e)
     return 1;
 }
 
+/*
+ * Removes header protection from up to QUIC_HDR_PROT_MAX_BATCH 1-RTT packets at
+ * once and marks them so that qrx_process_pkt() does not do so again.
+ */
+static void qrx_remove_hpr_batch(OSSL_QRL_ENC_LEVEL *el, QUIC_URXE **batch,
+                                 QUIC_PKT_HDR_PTRS *ptrs, size_t num_pkts)
+{
+    size_t i;
+
+    if (num_pkts == 0
+        || !ossl_quic_hdr_protector_decrypt_batch(&el->hpr, ptrs, num_pkts))
+        /* qrx_process_pkt() will try again one packet at a time. */
+        return;
+
+    for (i = 0; i < num_pkts; ++i)
+        pkt_mark(&batch[i]->hpr_removed, 0);
+}
+
+/*
+ * Removes header protection from the 1-RTT packets in all pending URXEs
+ * before they are processed individually, so that the header protection masks
+ * for a burst of datagrams can be generated together.
+ *
+ * Only a datagram whose first packet has a short header is considered. Such a
+ * packet extends to the end of the datagram, so it is the only packet in it,
+ * and in practice such datagrams make up nearly all of the traffic on a busy
+ * connection. Header protection keys do not change on a key update, so this is
+ * unaffected by the key phase of the packets.
+ */
+static void qrx_remove_hpr_pending(OSSL_QRX *qrx)
+{
+    QUIC_URXE *e, *batch[QUIC_HDR_PROT_MAX_BATCH];
+    QUIC_PKT_HDR_PTRS ptrs[QUIC_HDR_PROT_MAX_BATCH];
+    QUIC_PKT_HDR hdr;
+    OSSL_QRL_ENC_LEVEL *el;
+    PACKET pkt;
+    size_t n = 0;
+
+    if (!qrx->allow_1rtt
+        || ossl_qrl_enc_level_set_have_el(&qrx->el_set,
+                                          QUIC_ENC_LEVEL_1RTT) != 1)
+        return;
+
+    el = ossl_qrl_enc_level_set_get(&qrx->el_set, QUIC_ENC_LEVEL_1RTT, 1);
+    if (el == NULL)
+        return;
+
+    for (e = ossl_list_urxe_head(&qrx->urx_pending);
+         e != NULL;
+         e = ossl_list_urxe_next(e)) {
+        if (e->data_len < QUIC_MIN_VALID_PKT_LEN
+            || pkt_is_marked(&e->processed, 0)
+            || pkt_is_marked(&e->hpr_removed, 0)
+            || (*ossl_quic_urxe_data(e) & 0x80) != 0
+            || !PACKET_buf_init(&pkt, ossl_quic_urxe_data(e), e->data_len)
+            || !ossl_quic_wire_decode_pkt_hdr(&pkt, qrx->short_conn_id_len,
+                                              1, 0, &hdr, &ptrs[n])
+            || hdr.type != QUIC_PKT_TYPE_1RTT)
+            continue;
+
+        batch[n++] = e;
+        if (n == QUIC_HDR_PROT_MAX_BATCH) {
+            qrx_remove_hpr_batch(el, batch, ptrs, n);
+            n = 0;
+        }
+    }
+
+    qrx_remove_hpr_batch(el, batch, ptrs, n);
+}
+
 /* Process any pending URXEs to generate pending RXEs. */
 static int qrx_process_pending_urxl(OSSL_QRX *qrx)
 {
     QUIC_URXE *e;
 
+    qrx_remove_hpr_pending(qrx);
+
     while ((e = ossl_list_urxe_head(&qrx->urx_pending)) != NULL)
         if (!qrx_process_one_urxe(qrx, e))
             return 0;
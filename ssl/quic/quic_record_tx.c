@@ -63,6 +63,13 @@ struct ossl_qtx_st {
     /* TX maximum datagram payload length. */
     size_t                      mdpl;
 
+    /*
+     * Whether the BIO does UDP generic segmentation offload, and the buffer
+     * datagrams are coalesced into for it.
+     */
+    int                         use_gso;
+    unsigned char              *gso_buf;
+
     /*
      * List of TXEs which are not currently in use. These are moved to the
      * pending list (possibly via tx_cons first) as they are filled.
@@ -101,6 +108,24 @@ struct ossl_qtx_st {
     SSL *msg_callback_ssl;
 };
 
+/* Enables segmentation offload on the BIO if it supports it. */
+static void qtx_update_gso(OSSL_QTX *qtx)
+{
+    uint32_t offload;
+
+    qtx->use_gso = 0;
+    if (qtx->bio == NULL
+        || (BIO_dgram_get_segment_offload_cap(qtx->bio)
+            & BIO_DGRAM_SEGMENT_OFFLOAD_TX) == 0)
+        return;
+
+    offload = BIO_dgram_get_segment_offload(qtx->bio);
+    qtx->use_gso
+        = BIO_dgram_set_segment_offload(qtx->bio,
+                                        offload | BIO_DGRAM_SEGMENT_OFFLOAD_TX)
+          == 1;
+}
+
 /* Instantiates a new QTX. */
 OSSL_QTX *ossl_qtx_new(const OSSL_QTX_ARGS *args)
 {
@@ -117,6 +142,7 @@ OSSL_QTX *ossl_qtx_new(const OSSL_QTX_ARGS *args)
     qtx->propq              = args->propq;
     qtx->bio                = args->bio;
     qtx->mdpl               = args->mdpl;
+    qtx_update_gso(qtx);
     return qtx;
 }
 
@@ -142,6 +168,7 @@ void ossl_qtx_free(OSSL_QTX *qtx)
     qtx_cleanup_txl(&qtx->pending);
     qtx_cleanup_txl(&qtx->free);
     OPENSSL_free(qtx->cons);
+    OPENSSL_free(qtx->gso_buf);
 
     /* Drop keying material and crypto resources. */
     for (i = 0; i < QUIC_ENC_LEVEL_NUM; ++i)
@@ -878,9 +905,10 @@ void ossl_qtx_finish_dgram(OSSL_QTX *qtx)
 
 static void txe_to_msg(TXE *txe, BIO_MSG *msg)
 {
-    msg->data       = txe_data(txe);
-    msg->data_len   = txe->data_len;
-    msg->flags      = 0;
+    msg->data           = txe_data(txe);
+    msg->data_len       = txe->data_len;
+    msg->flags          = 0;
+    msg->segment_size   = 0;
     msg->peer
         = BIO_ADDR_family(&txe->peer) != AF_UNSPEC ? &txe->peer : NULL;
     msg->local
@@ -889,12 +917,68 @@ static void txe_to_msg(TXE *txe, BIO_MSG *msg)
 
 #define MAX_MSGS_PER_SEND   32
 
+/*
+ * For UDP generic segmentation offload (GSO), a message may hold up to 64
+ * datagrams, the limit of the Linux kernel, and must fit in a UDP datagram over
+ * IPv4. All the datagrams but the last must have the same size.
+ */
+#define QTX_GSO_MAX_SEGMENTS    64
+#define QTX_GSO_MAX_LEN         65507
+#define QTX_GSO_BUF_LEN         (2 * QTX_GSO_MAX_LEN)
+
+/*
+ * Tries to append the datagram in txe to msg, the last message of the batch
+ * being built, which holds *num_txe datagrams from first to last. The
+ * datagrams of a message are copied one after another into the GSO buffer, of
+ * which *gso_used bytes are already taken. Returns 1 if the datagram was
+ * appended.
+ */
+static int qtx_gso_append(OSSL_QTX *qtx, BIO_MSG *msg, size_t *num_txe,
+                          const TXE *first, const TXE *last, const TXE *txe,
+                          size_t *gso_used)
+{
+    size_t len = msg->data_len + txe->data_len;
+
+    if (!qtx->use_gso
+        || *num_txe >= QTX_GSO_MAX_SEGMENTS
+        || last->data_len != first->data_len
+        || txe->data_len > first->data_len
+        || len > QTX_GSO_MAX_LEN
+        || !addr_eq(&first->peer, &txe->peer)
+        || !addr_eq(&first->local, &txe->local))
+        return 0;
+
+    if (*num_txe == 1) {
+        /* Move the first datagram into the GSO buffer. */
+        if (*gso_used + len > QTX_GSO_BUF_LEN)
+            return 0;
+
+        if (qtx->gso_buf == NULL
+            && (qtx->gso_buf = OPENSSL_malloc(QTX_GSO_BUF_LEN)) == NULL)
+            return 0;
+
+        memcpy(qtx->gso_buf + *gso_used, msg->data, msg->data_len);
+        msg->data           = qtx->gso_buf + *gso_used;
+        msg->segment_size   = first->data_len;
+        *gso_used          += msg->data_len;
+    } else if (*gso_used + txe->data_len > QTX_GSO_BUF_LEN) {
+        return 0;
+    }
+
+    memcpy(qtx->gso_buf + *gso_used, txe_data(txe), txe->data_len);
+    *gso_used      += txe->data_len;
+    msg->data_len   = len;
+    ++*num_txe;
+    return 1;
+}
+
 int ossl_qtx_flush_net(OSSL_QTX *qtx)
 {
     BIO_MSG msg[MAX_MSGS_PER_SEND];
-    size_t wr, i, total_written = 0;
-    TXE *txe;
-    int res;
+    size_t num_txe[MAX_MSGS_PER_SEND];
+    size_t wr, i, j, gso_used, total_written = 0;
+    TXE *txe, *first = NULL, *last = NULL;
+    int res, coalesced;
 
     if (ossl_list_txe_head(&qtx->pending) == NULL)
         return QTX_FLUSH_NET_RES_OK; /* Nothing to send. */
@@ -903,10 +987,24 @@ int ossl_qtx_flush_net(OSSL_QTX *qtx)
         return QTX_FLUSH_NET_RES_PERMANENT_FAIL;
 
     for (;;) {
+        gso_used = 0;
+        coalesced = 0;
         for (txe = ossl_list_txe_head(&qtx->pending), i = 0;
-             txe != NULL && i < OSSL_NELEM(msg);
-             txe = ossl_list_txe_next(txe), ++i)
+             txe != NULL;
+             last = txe, txe = ossl_list_txe_next(txe)) {
+            if (i > 0 && qtx_gso_append(qtx, &msg[i - 1], &num_txe[i - 1],
+                                        first, last, txe, &gso_used)) {
+                coalesced = 1;
+                continue;
+            }
+
+            if (i == OSSL_NELEM(msg))
+                break;
+
             txe_to_msg(txe, &msg[i]);
+            num_txe[i++] = 1;
+            first = txe;
+        }
 
         if (!i)
             /* Nothing to send. */
@@ -929,6 +1027,15 @@ int ossl_qtx_flush_net(OSSL_QTX *qtx)
                 /* Transient error, just stop for now, clearing the error. */
                 ERR_pop_to_mark();
                 break;
+            } else if (coalesced) {
+                /*
+                 * The kernel or the network interface may not be able to
+                 * segment the datagrams after all (e.g. without checksum
+                 * offload), so send them one at a time from now on.
+                 */
+                ERR_pop_to_mark();
+                qtx->use_gso = 0;
+                continue;
             } else {
                 /* Non-transient error, fail and do not clear the error. */
                 ERR_clear_last_mark();
@@ -942,12 +1049,16 @@ int ossl_qtx_flush_net(OSSL_QTX *qtx)
          * Remove everything which was successfully sent from the pending queue.
          */
         for (i = 0; i < wr; ++i) {
-            if (qtx->msg_callback != NULL)
-                qtx->msg_callback(1, OSSL_QUIC1_VERSION, SSL3_RT_QUIC_DATAGRAM,
-                                msg[i].data, msg[i].data_len,
-                                qtx->msg_callback_ssl,
-                                qtx->msg_callback_arg);
-            qtx_pending_to_free(qtx);
+            for (j = 0; j < num_txe[i]; ++j) {
+                txe = ossl_list_txe_head(&qtx->pending);
+                if (qtx->msg_callback != NULL)
+                    qtx->msg_callback(1, OSSL_QUIC1_VERSION,
+                                      SSL3_RT_QUIC_DATAGRAM,
+                                      txe_data(txe), txe->data_len,
+                                      qtx->msg_callback_ssl,
+                                      qtx->msg_callback_arg);
+                qtx_pending_to_free(qtx);
+            }
         }
 
         total_written += wr;
@@ -973,6 +1084,7 @@ int ossl_qtx_pop_net(OSSL_QTX *qtx, BIO_MSG *msg)
 void ossl_qtx_set_bio(OSSL_QTX *qtx, BIO *bio)
 {
     qtx->bio = bio;
+    qtx_update_gso(qtx);
 }
 
 int ossl_qtx_set_mdpl(OSSL_QTX *qtx, size_t mdpl)
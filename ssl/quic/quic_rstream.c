@@ -260,6 +260,11 @@ int ossl_quic_rstream_release_record(QUIC_RSTREAM *qrs, size_t read_len)
     return 1;
 }
 
+OSSL_QRX_PKT *ossl_quic_rstream_get_record_pkt(QUIC_RSTREAM *qrs)
+{
+    return ossl_sframe_list_get_head_pkt(&qrs->fl);
+}
+
 static int write_at_ring_buf_cb(uint64_t logical_offset,
                                 const unsigned char *buf,
                                 size_t buf_len,
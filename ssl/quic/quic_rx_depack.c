@@ -1040,6 +1040,59 @@ static int depack_do_frame_handshake_done(PACKET *pkt,
     return 1;
 }
 
+static int depack_do_frame_ack_frequency(PACKET *pkt,
+                                         QUIC_CHANNEL *ch,
+                                         OSSL_ACKM_RX_PKT *ackm_data)
+{
+    OSSL_QUIC_FRAME_ACK_FREQUENCY frame_data;
+
+    if (!ossl_quic_wire_decode_frame_ack_frequency(pkt, &frame_data)) {
+        ossl_quic_channel_raise_protocol_error(ch,
+                                               QUIC_ERR_FRAME_ENCODING_ERROR,
+                                               OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY,
+                                               "decode error");
+        return 0;
+    }
+
+    ossl_quic_channel_on_ack_frequency(ch, &frame_data);
+    return 1;
+}
+
+static int depack_do_frame_immediate_ack(PACKET *pkt,
+                                         QUIC_CHANNEL *ch,
+                                         OSSL_ACKM_RX_PKT *ackm_data)
+{
+    if (!ossl_quic_wire_decode_frame_immediate_ack(pkt)) {
+        /* This can fail only with an internal error. */
+        ossl_quic_channel_raise_protocol_error(ch,
+                                               QUIC_ERR_INTERNAL_ERROR,
+                                               OSSL_QUIC_FRAME_TYPE_IMMEDIATE_ACK,
+                                               "internal error (decode frame immediate ack)");
+        return 0;
+    }
+
+    ossl_ackm_on_rx_immediate_ack(ch->ackm, ackm_data->pkt_space);
+    return 1;
+}
+
+static int depack_do_frame_datagram(PACKET *pkt, QUIC_CHANNEL *ch,
+                                    OSSL_ACKM_RX_PKT *ackm_data)
+{
+    OSSL_QUIC_FRAME_DATAGRAM frame_data;
+    size_t start_len = PACKET_remaining(pkt);
+
+    if (!ossl_quic_wire_decode_frame_datagram(pkt, &frame_data)) {
+        ossl_quic_channel_raise_protocol_error(ch,
+                                               QUIC_ERR_FRAME_ENCODING_ERROR,
+                                               OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN,
+                                               "decode error");
+        return 0;
+    }
+
+    return ossl_quic_channel_on_datagram(ch, &frame_data,
+                                         start_len - PACKET_remaining(pkt));
+}
+
 /* Main frame processor */
 
 static int depack_process_frames(QUIC_CHANNEL *ch, PACKET *pkt,
@@ -1375,6 +1428,49 @@ static int depack_process_frames(QUIC_CHANNEL *ch, PACKET *pkt,
                 return 0;
             break;
 
+        case OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY:
+            /* ACK_FREQUENCY frames are valid in 0RTT and 1RTT packets */
+            if (pkt_type != QUIC_PKT_TYPE_0RTT
+                && pkt_type != QUIC_PKT_TYPE_1RTT) {
+                ossl_quic_channel_raise_protocol_error(ch,
+                                                       QUIC_ERR_PROTOCOL_VIOLATION,
+                                                       frame_type,
+                                                       "ACK_FREQUENCY valid only in 0/1-RTT");
+                return 0;
+            }
+            if (!depack_do_frame_ack_frequency(pkt, ch, ackm_data))
+                return 0;
+            break;
+
+        case OSSL_QUIC_FRAME_TYPE_IMMEDIATE_ACK:
+            /* IMMEDIATE_ACK frames are valid in 0RTT and 1RTT packets */
+            if (pkt_type != QUIC_PKT_TYPE_0RTT
+                && pkt_type != QUIC_PKT_TYPE_1RTT) {
+                ossl_quic_channel_raise_protocol_error(ch,
+                                                       QUIC_ERR_PROTOCOL_VIOLATION,
+                                                       frame_type,
+                                                       "IMMEDIATE_ACK valid only in 0/1-RTT");
+                return 0;
+            }
+            if (!depack_do_frame_immediate_ack(pkt, ch, ackm_data))
+                return 0;
+            break;
+
+        case OSSL_QUIC_FRAME_TYPE_DATAGRAM:
+        case OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN:
+            /* DATAGRAM frames are valid in 0RTT and 1RTT packets */
+            if (pkt_type != QUIC_PKT_TYPE_0RTT
+                && pkt_type != QUIC_PKT_TYPE_1RTT) {
+                ossl_quic_channel_raise_protocol_error(ch,
+                                                       QUIC_ERR_PROTOCOL_VIOLATION,
+                                                       frame_type,
+                                                       "DATAGRAM valid only in 0/1-RTT");
+                return 0;
+            }
+            if (!depack_do_frame_datagram(pkt, ch, ackm_data))
+                return 0;
+            break;
+
         default:
             /* Unknown frame type */
             ossl_quic_channel_raise_protocol_error(ch,
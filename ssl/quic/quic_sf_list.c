@@ -269,6 +269,14 @@ int ossl_sframe_list_is_head_locked(SFRAME_LIST *fl)
     return fl->head_locked;
 }
 
+OSSL_QRX_PKT *ossl_sframe_list_get_head_pkt(SFRAME_LIST *fl)
+{
+    if (!fl->head_locked || fl->head->data == NULL)
+        return NULL;
+
+    return fl->head->pkt;
+}
+
 int ossl_sframe_list_move_data(SFRAME_LIST *fl,
                                sframe_list_write_at_cb *write_at_cb,
                                void *cb_arg)
@@ -16,9 +16,33 @@
  * ==================================================================
  * QUIC Send Stream
  */
+
+/*
+ * A caller-owned buffer appended with ossl_quic_sstream_append_ref(). It holds
+ * the logical bytes [start, start + len) of the stream.
+ */
+typedef struct qss_ref_buf_st QSS_REF_BUF;
+
+struct qss_ref_buf_st {
+    QSS_REF_BUF                     *next;
+    uint64_t                        start;
+    const unsigned char             *buf;
+    size_t                          len;
+    ossl_quic_sstream_release_cb    *release_cb;
+    void                            *release_cb_arg;
+};
+
 struct quic_sstream_st {
     struct ring_buf ring_buf;
 
+    /*
+     * Caller-owned buffers referenced by the stream, in ascending order of
+     * logical offset. These always follow all data held in ring_buf, so
+     * ossl_quic_sstream_append() cannot append to the ring buffer again until
+     * all of them have been acknowledged and released.
+     */
+    QSS_REF_BUF     *ref_head, *ref_tail;
+
     /*
      * Any logical byte in the stream is in one of these states:
      *
@@ -46,7 +70,8 @@ struct quic_sstream_st {
     UINT_SET        new_set, acked_set;
 
     /*
-     * The current size of the stream is ring_buf.head_offset. If
+     * The current size of the stream is the end of ref_tail if there are
+     * referenced buffers, and ring_buf.head_offset otherwise. If
      * have_final_size is true, this is also the final size of the stream.
      */
     unsigned int    have_final_size     : 1;
@@ -57,6 +82,56 @@ struct quic_sstream_st {
 
 static void qss_cull(QUIC_SSTREAM *qss);
 
+/* The current size of the stream, which is also the final size if known. */
+static uint64_t qss_cur_size(const QUIC_SSTREAM *qss)
+{
+    if (qss->ref_tail != NULL)
+        return qss->ref_tail->start + qss->ref_tail->len;
+
+    return qss->ring_buf.head_offset;
+}
+
+static void qss_release_ref_head(QUIC_SSTREAM *qss)
+{
+    QSS_REF_BUF *rb = qss->ref_head;
+
+    qss->ref_head = rb->next;
+    if (qss->ref_head == NULL)
+        qss->ref_tail = NULL;
+
+    rb->release_cb(rb->buf, rb->len, rb->release_cb_arg);
+    OPENSSL_free(rb);
+}
+
+/*
+ * Gets a pointer to the contiguous run of stored stream data starting at the
+ * given logical offset, which may be in the ring buffer or in a referenced
+ * caller buffer. *buf_len is set to 0 if there is no data at that offset.
+ */
+static int qss_get_buf_at(const QUIC_SSTREAM *qss, uint64_t logical_offset,
+                          const unsigned char **buf, size_t *buf_len)
+{
+    const QSS_REF_BUF *rb = qss->ref_head;
+
+    if (rb == NULL || logical_offset < rb->start)
+        return ring_buf_get_buf_at(&qss->ring_buf, logical_offset,
+                                   buf, buf_len);
+
+    for (; rb != NULL; rb = rb->next)
+        if (logical_offset < rb->start + rb->len) {
+            *buf        = rb->buf + (size_t)(logical_offset - rb->start);
+            *buf_len    = (size_t)(rb->start + rb->len - logical_offset);
+            return 1;
+        }
+
+    if (logical_offset > qss_cur_size(qss))
+        return 0;
+
+    *buf        = NULL;
+    *buf_len    = 0;
+    return 1;
+}
+
 QUIC_SSTREAM *ossl_quic_sstream_new(size_t init_buf_size)
 {
     QUIC_SSTREAM *qss;
@@ -82,6 +157,9 @@ void ossl_quic_sstream_free(QUIC_SSTREAM *qss)
     if (qss == NULL)
         return;
 
+    while (qss->ref_head != NULL)
+        qss_release_ref_head(qss);
+
     ossl_uint_set_destroy(&qss->new_set);
     ossl_uint_set_destroy(&qss->acked_set);
     ring_buf_destroy(&qss->ring_buf, qss->cleanse);
@@ -114,7 +192,7 @@ int ossl_quic_sstream_get_stream_frame(QUIC_SSTREAM *qss,
         if (!qss->have_final_size || qss->sent_final_size)
             return 0;
 
-        hdr->offset = qss->ring_buf.head_offset;
+        hdr->offset = qss_cur_size(qss);
         hdr->len    = 0;
         hdr->is_fin = 1;
         *num_iov    = 0;
@@ -130,20 +208,17 @@ int ossl_quic_sstream_get_stream_frame(QUIC_SSTREAM *qss,
      */
     max_len = range->range.end - range->range.start + 1;
 
-    for (i = 0;; ++i) {
+    for (i = 0; i < *num_iov; ++i) {
         if (total_len >= max_len)
             break;
 
-        if (!ring_buf_get_buf_at(&qss->ring_buf,
-                                 range->range.start + total_len,
-                                 &src, &src_len))
+        if (!qss_get_buf_at(qss, range->range.start + total_len,
+                            &src, &src_len))
             return 0;
 
         if (src_len == 0)
             break;
 
-        assert(i < 2);
-
         if (total_len + src_len > max_len)
             src_len = (size_t)(max_len - total_len);
 
@@ -157,7 +232,7 @@ int ossl_quic_sstream_get_stream_frame(QUIC_SSTREAM *qss,
     hdr->offset = range->range.start;
     hdr->len    = total_len;
     hdr->is_fin = qss->have_final_size
-        && hdr->offset + hdr->len == qss->ring_buf.head_offset;
+        && hdr->offset + hdr->len == qss_cur_size(qss);
 
     *num_iov    = num_iov_;
     return 1;
@@ -174,7 +249,7 @@ int ossl_quic_sstream_has_pending(QUIC_SSTREAM *qss)
 
 uint64_t ossl_quic_sstream_get_cur_size(QUIC_SSTREAM *qss)
 {
-    return qss->ring_buf.head_offset;
+    return qss_cur_size(qss);
 }
 
 int ossl_quic_sstream_mark_transmitted(QUIC_SSTREAM *qss,
@@ -199,7 +274,7 @@ int ossl_quic_sstream_mark_transmitted_fin(QUIC_SSTREAM *qss,
      * We do not really need final_size since we already know the size of the
      * stream, but this serves as a sanity check.
      */
-    if (!qss->have_final_size || final_size != qss->ring_buf.head_offset)
+    if (!qss->have_final_size || final_size != qss_cur_size(qss))
         return 0;
 
     qss->sent_final_size = 1;
@@ -274,7 +349,7 @@ int ossl_quic_sstream_get_final_size(QUIC_SSTREAM *qss, uint64_t *final_size)
         return 0;
 
     if (final_size != NULL)
-        *final_size = qss->ring_buf.head_offset;
+        *final_size = qss_cur_size(qss);
 
     return 1;
 }
@@ -293,6 +368,15 @@ int ossl_quic_sstream_append(QUIC_SSTREAM *qss,
         return 0;
     }
 
+    if (qss->ref_head != NULL) {
+        /*
+         * Data can only be appended to the ring buffer once all referenced
+         * buffers have been acknowledged, so this is backpressure.
+         */
+        *consumed = 0;
+        return 1;
+    }
+
     /*
      * Note: It is assumed that ossl_quic_sstream_append will be called during a
      * call to e.g. SSL_write and this function is therefore designed to support
@@ -329,6 +413,45 @@ int ossl_quic_sstream_append(QUIC_SSTREAM *qss,
     return 1;
 }
 
+int ossl_quic_sstream_append_ref(QUIC_SSTREAM *qss,
+                                 const unsigned char *buf,
+                                 size_t buf_len,
+                                 ossl_quic_sstream_release_cb *release_cb,
+                                 void *release_cb_arg)
+{
+    QSS_REF_BUF *rb;
+    UINT_RANGE r;
+    uint64_t start = qss_cur_size(qss);
+
+    if (qss->have_final_size || buf_len == 0 || release_cb == NULL
+        || buf_len > MAX_OFFSET - start)
+        return 0;
+
+    if ((rb = OPENSSL_zalloc(sizeof(*rb))) == NULL)
+        return 0;
+
+    r.start = start;
+    r.end   = start + buf_len - 1;
+    if (!ossl_uint_set_insert(&qss->new_set, &r)) {
+        OPENSSL_free(rb);
+        return 0;
+    }
+
+    rb->start           = start;
+    rb->buf             = buf;
+    rb->len             = buf_len;
+    rb->release_cb      = release_cb;
+    rb->release_cb_arg  = release_cb_arg;
+
+    if (qss->ref_tail != NULL)
+        qss->ref_tail->next = rb;
+    else
+        qss->ref_head = rb;
+
+    qss->ref_tail = rb;
+    return 1;
+}
+
 static void qss_cull(QUIC_SSTREAM *qss)
 {
     UINT_SET_ITEM *h = ossl_list_uint_set_head(&qss->acked_set);
@@ -349,9 +472,22 @@ static void qss_cull(QUIC_SSTREAM *qss)
      * We only need to check the first range entry in the integer set because we
      * can only cull contiguous areas at the start of the ring buffer anyway.
      */
-    if (h != NULL)
-        ring_buf_cpop_range(&qss->ring_buf, h->range.start, h->range.end,
-                            qss->cleanse);
+    if (h == NULL)
+        return;
+
+    ring_buf_cpop_range(&qss->ring_buf, h->range.start, h->range.end,
+                        qss->cleanse);
+
+    /*
+     * Referenced buffers are released on the same basis. Since they follow all
+     * data in the ring buffer, culling the ring buffer past its head also
+     * moves its head past the released buffers, which is where appending must
+     * resume once no referenced buffers remain.
+     */
+    while (qss->ref_head != NULL
+           && qss->ref_head->start + qss->ref_head->len
+              <= qss->ring_buf.ctail_offset)
+        qss_release_ref_head(qss);
 }
 
 int ossl_quic_sstream_set_buffer_size(QUIC_SSTREAM *qss, size_t num_bytes)
@@ -389,7 +525,7 @@ int ossl_quic_sstream_is_totally_acked(QUIC_SSTREAM *qss)
         return 0;
 
     r = ossl_list_uint_set_head(&qss->acked_set)->range;
-    cur_size = qss->ring_buf.head_offset;
+    cur_size = qss_cur_size(qss);
 
     /*
      * The invariants of UINT_SET guarantee a single list element if we have a
@@ -68,6 +68,8 @@ static QUIC_STREAM *list_next(QUIC_STREAM_LIST_NODE *l, QUIC_STREAM_LIST_NODE *n
                                           offsetof(QUIC_STREAM, accept_node))
 #define ready_for_gc_next(l, s) list_next((l), &(s)->ready_for_gc_node, \
                                           offsetof(QUIC_STREAM, ready_for_gc_node))
+#define active_head(l)          list_next((l), (l), \
+                                          offsetof(QUIC_STREAM, active_node))
 #define accept_head(l)          list_next((l), (l), \
                                           offsetof(QUIC_STREAM, accept_node))
 #define ready_for_gc_head(l)    list_next((l), (l), \
@@ -87,6 +89,22 @@ static int cmp_stream(const QUIC_STREAM *a, const QUIC_STREAM *b)
     return 0;
 }
 
+/*
+ * Scheduling order of active streams: by urgency, then non-incremental streams
+ * in stream ID order, then incremental streams by their position in the RR
+ * rotation.
+ */
+static int cmp_stream_sched(const QUIC_STREAM *a, const QUIC_STREAM *b)
+{
+    if (a->urgency != b->urgency)
+        return a->urgency < b->urgency ? -1 : 1;
+    if (a->incremental != b->incremental)
+        return a->incremental ? 1 : -1;
+    if (a->incremental && a->sched_seq != b->sched_seq)
+        return a->sched_seq < b->sched_seq ? -1 : 1;
+    return cmp_stream(a, b);
+}
+
 int ossl_quic_stream_map_init(QUIC_STREAM_MAP *qsm,
                               uint64_t (*get_stream_limit_cb)(int uni, void *arg),
                               void *get_stream_limit_cb_arg,
@@ -95,13 +113,25 @@ int ossl_quic_stream_map_init(QUIC_STREAM_MAP *qsm,
                               int is_server)
 {
     qsm->map = lh_QUIC_STREAM_new(hash_stream, cmp_stream);
+    if (qsm->map == NULL)
+        return 0;
+
+    qsm->active_pq = ossl_pqueue_QUIC_STREAM_new(cmp_stream_sched);
+    if (qsm->active_pq == NULL) {
+        lh_QUIC_STREAM_free(qsm->map);
+        qsm->map = NULL;
+        return 0;
+    }
+
     qsm->active_list.prev = qsm->active_list.next = &qsm->active_list;
     qsm->accept_list.prev = qsm->accept_list.next = &qsm->accept_list;
     qsm->ready_for_gc_list.prev = qsm->ready_for_gc_list.next
         = &qsm->ready_for_gc_list;
     qsm->rr_stepping = 1;
     qsm->rr_counter  = 0;
-    qsm->rr_cur      = NULL;
+
+    qsm->next_sched_seq = 0;
+    qsm->active_dirty   = 0;
 
     qsm->num_accept         = 0;
     qsm->num_shutdown_flush = 0;
@@ -127,6 +157,9 @@ void ossl_quic_stream_map_cleanup(QUIC_STREAM_MAP *qsm)
 
     lh_QUIC_STREAM_free(qsm->map);
     qsm->map = NULL;
+
+    ossl_pqueue_QUIC_STREAM_free(qsm->active_pq);
+    qsm->active_pq = NULL;
 }
 
 void ossl_quic_stream_map_visit(QUIC_STREAM_MAP *qsm,
@@ -149,6 +182,15 @@ QUIC_STREAM *ossl_quic_stream_map_alloc(QUIC_STREAM_MAP *qsm,
     if (s != NULL)
         return NULL;
 
+    /*
+     * Reserve space for every stream in the active queue up front, so that
+     * marking a stream as active cannot fail.
+     */
+    if (!ossl_pqueue_QUIC_STREAM_reserve(qsm->active_pq,
+                                         lh_QUIC_STREAM_num_items(qsm->map) + 1
+                                         - ossl_pqueue_QUIC_STREAM_num(qsm->active_pq)))
+        return NULL;
+
     s = OPENSSL_zalloc(sizeof(*s));
     if (s == NULL)
         return NULL;
@@ -156,6 +198,8 @@ QUIC_STREAM *ossl_quic_stream_map_alloc(QUIC_STREAM_MAP *qsm,
     s->id           = stream_id;
     s->type         = type;
     s->as_server    = qsm->is_server;
+    s->urgency      = QUIC_STREAM_URGENCY_DEFAULT;
+    s->incremental  = 1;
     s->send_state   = (ossl_quic_stream_is_local_init(s)
                        || ossl_quic_stream_is_bidi(s))
         ? QUIC_SSTREAM_STATE_READY
@@ -176,8 +220,10 @@ void ossl_quic_stream_map_release(QUIC_STREAM_MAP *qsm, QUIC_STREAM *stream)
     if (stream == NULL)
         return;
 
-    if (stream->active_node.next != NULL)
+    if (stream->active_node.next != NULL) {
         list_remove(&qsm->active_list, &stream->active_node);
+        ossl_pqueue_QUIC_STREAM_remove(qsm->active_pq, stream->active_elem);
+    }
     if (stream->accept_node.next != NULL)
         list_remove(&qsm->accept_list, &stream->accept_node);
     if (stream->ready_for_gc_node.next != NULL)
@@ -203,15 +249,34 @@ QUIC_STREAM *ossl_quic_stream_map_get_by_id(QUIC_STREAM_MAP *qsm,
     return lh_QUIC_STREAM_retrieve(qsm->map, &key);
 }
 
+/*
+ * Space in the active queue is reserved for every stream when it is allocated,
+ * so this cannot fail.
+ */
+static void stream_map_push_active(QUIC_STREAM_MAP *qsm, QUIC_STREAM *s)
+{
+    int ok;
+
+    ok = ossl_pqueue_QUIC_STREAM_push(qsm->active_pq, s, &s->active_elem);
+    assert(ok);
+    (void)ok;
+}
+
 static void stream_map_mark_active(QUIC_STREAM_MAP *qsm, QUIC_STREAM *s)
 {
     if (s->active)
         return;
 
-    list_insert_tail(&qsm->active_list, &s->active_node);
+    /* A newly active incremental stream joins the back of the RR rotation. */
+    s->sched_seq = qsm->next_sched_seq++;
+    stream_map_push_active(qsm, s);
 
-    if (qsm->rr_cur == NULL)
-        qsm->rr_cur = s;
+    /*
+     * The stream is put in its place in the iteration order before the next
+     * iteration. Until then, an iteration in progress can still reach it.
+     */
+    list_insert_tail(&qsm->active_list, &s->active_node);
+    qsm->active_dirty = 1;
 
     s->active = 1;
 }
@@ -221,16 +286,85 @@ static void stream_map_mark_inactive(QUIC_STREAM_MAP *qsm, QUIC_STREAM *s)
     if (!s->active)
         return;
 
-    if (qsm->rr_cur == s)
-        qsm->rr_cur = active_next(&qsm->active_list, s);
-    if (qsm->rr_cur == s)
-        qsm->rr_cur = NULL;
-
     list_remove(&qsm->active_list, &s->active_node);
+    ossl_pqueue_QUIC_STREAM_remove(qsm->active_pq, s->active_elem);
 
     s->active = 0;
 }
 
+/*
+ * Rebuilds the active list in scheduling order by draining the active queue.
+ * The streams are then pushed back in ascending order, which needs no sifting.
+ */
+static void stream_map_sort_active(QUIC_STREAM_MAP *qsm)
+{
+    QUIC_STREAM_LIST_NODE *n;
+    QUIC_STREAM *s;
+
+    while ((s = active_head(&qsm->active_list)) != NULL)
+        list_remove(&qsm->active_list, &s->active_node);
+
+    while ((s = ossl_pqueue_QUIC_STREAM_pop(qsm->active_pq)) != NULL)
+        list_insert_tail(&qsm->active_list, &s->active_node);
+
+    for (n = qsm->active_list.next; n != &qsm->active_list; n = n->next) {
+        s = (QUIC_STREAM *)((char *)n - offsetof(QUIC_STREAM, active_node));
+        stream_map_push_active(qsm, s);
+    }
+
+    qsm->active_dirty = 0;
+}
+
+void ossl_quic_stream_map_set_priority(QUIC_STREAM_MAP *qsm, QUIC_STREAM *s,
+                                       unsigned int urgency, int incremental)
+{
+    if (!ossl_assert(urgency <= QUIC_STREAM_URGENCY_MAX))
+        return;
+
+    incremental = (incremental != 0);
+    if (s->urgency == urgency && s->incremental == (unsigned int)incremental)
+        return;
+
+    if (s->active)
+        ossl_pqueue_QUIC_STREAM_remove(qsm->active_pq, s->active_elem);
+
+    s->urgency      = urgency;
+    s->incremental  = incremental;
+
+    if (s->active) {
+        stream_map_push_active(qsm, s);
+        qsm->active_dirty = 1;
+    }
+}
+
+/*
+ * Moves the first incremental stream in the iteration order behind the other
+ * incremental streams of the same urgency, if there are any.
+ */
+static void stream_map_rotate_rr(QUIC_STREAM_MAP *qsm)
+{
+    QUIC_STREAM *head = active_head(&qsm->active_list), *s = head, *next;
+
+    while (s != NULL && !s->incremental) {
+        s = active_next(&qsm->active_list, s);
+        if (s == head)
+            s = NULL;
+    }
+
+    if (s == NULL)
+        return;
+
+    next = active_next(&qsm->active_list, s);
+    if (next == head
+        || !next->incremental || next->urgency != s->urgency)
+        return;
+
+    ossl_pqueue_QUIC_STREAM_remove(qsm->active_pq, s->active_elem);
+    s->sched_seq = qsm->next_sched_seq++;
+    stream_map_push_active(qsm, s);
+    qsm->active_dirty = 1;
+}
+
 void ossl_quic_stream_map_set_rr_stepping(QUIC_STREAM_MAP *qsm, size_t stepping)
 {
     qsm->rr_stepping = stepping;
@@ -828,21 +962,31 @@ int ossl_quic_stream_map_is_shutdown_flush_finished(QUIC_STREAM_MAP *qsm)
 void ossl_quic_stream_iter_init(QUIC_STREAM_ITER *it, QUIC_STREAM_MAP *qsm,
                                 int advance_rr)
 {
+    if (qsm->active_dirty)
+        stream_map_sort_active(qsm);
+
     it->qsm    = qsm;
-    it->stream = it->first_stream = qsm->rr_cur;
+    it->stream = active_head(&qsm->active_list);
+
+    /* The new RR order takes effect from the next iteration. */
     if (advance_rr && it->stream != NULL
         && ++qsm->rr_counter >= qsm->rr_stepping) {
         qsm->rr_counter = 0;
-        qsm->rr_cur     = active_next(&qsm->active_list, qsm->rr_cur);
+        stream_map_rotate_rr(qsm);
     }
 }
 
 void ossl_quic_stream_iter_next(QUIC_STREAM_ITER *it)
 {
+    QUIC_STREAM_LIST_NODE *n;
+
     if (it->stream == NULL)
         return;
 
-    it->stream = active_next(&it->qsm->active_list, it->stream);
-    if (it->stream == it->first_stream)
+    n = it->stream->active_node.next;
+    if (n == &it->qsm->active_list)
         it->stream = NULL;
+    else
+        it->stream = (QUIC_STREAM *)((char *)n
+                                     - offsetof(QUIC_STREAM, active_node));
 }
@@ -51,6 +51,9 @@ struct quic_tls_st {
 
     /* Set if the handshake has completed */
     unsigned int complete : 1;
+
+    /* Set if we offer early data in the ClientHello */
+    unsigned int early_data : 1;
 };
 
 struct ossl_record_layer_st {
@@ -623,6 +626,22 @@ static int parse_transport_params_cb(SSL *s, unsigned int ext_type,
                                      int *al, void *parse_arg)
 {
     QUIC_TLS *qtls = parse_arg;
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL(qtls->args.s);
+
+    /*
+     * A client remembers the transport parameters of the server along with a
+     * new session so that they can be used for 0-RTT (RFC 9000 s. 7.4.1).
+     */
+    if (!qtls->args.is_server && sc != NULL && !sc->hit
+        && sc->session != NULL) {
+        OPENSSL_free(sc->session->ext.quic_tparams);
+        sc->session->ext.quic_tparams_len = 0;
+        if ((sc->session->ext.quic_tparams = OPENSSL_memdup(in, inlen)) == NULL) {
+            *al = SSL_AD_INTERNAL_ERROR;
+            return 0;
+        }
+        sc->session->ext.quic_tparams_len = inlen;
+    }
 
     return qtls->args.got_transport_params_cb(in, inlen,
                                               qtls->args.got_transport_params_cb_arg);
@@ -755,6 +774,9 @@ int ossl_quic_tls_tick(QUIC_TLS *qtls)
         SSL_clear_options(qtls->args.s, SSL_OP_ENABLE_MIDDLEBOX_COMPAT);
         ossl_ssl_set_custom_record_layer(sc, &quic_tls_record_method, qtls);
 
+        /* The handshake differs for QUIC, e.g. there is no EndOfEarlyData. */
+        sc->s3.flags |= TLS1_FLAGS_QUIC;
+
         if (!ossl_tls_add_custom_ext_intern(NULL, &sc->cert->custext,
                                             qtls->args.is_server ? ENDPOINT_SERVER
                                                                  : ENDPOINT_CLIENT,
@@ -782,18 +804,35 @@ int ossl_quic_tls_tick(QUIC_TLS *qtls)
         else
             SSL_set_connect_state(qtls->args.s);
 
+        if (qtls->early_data)
+            sc->early_data_state = SSL_EARLY_DATA_CONNECTING;
+
         qtls->configured = 1;
     }
 
-    if (qtls->complete)
+    if (qtls->complete) {
         /*
          * There should never be app data to read, but calling SSL_read() will
          * ensure any post-handshake messages are processed.
          */
         ret = SSL_read(qtls->args.s, NULL, 0);
-    else
+    } else {
         ret = SSL_do_handshake(qtls->args.s);
 
+        if (ret > 0 && qtls->early_data
+            && SSL_CONNECTION_FROM_SSL(qtls->args.s)->early_data_state
+               == SSL_EARLY_DATA_CONNECTING) {
+            /*
+             * libssl pauses after sending a ClientHello offering early data so
+             * that the application can write it. QUIC 0-RTT data does not go
+             * through TLS, so the handshake just carries on.
+             */
+            SSL_CONNECTION_FROM_SSL(qtls->args.s)->early_data_state
+                = SSL_EARLY_DATA_FINISHED_WRITING;
+            ret = SSL_do_handshake(qtls->args.s);
+        }
+    }
+
     if (ret <= 0) {
         err = ossl_ssl_get_error(qtls->args.s, ret,
                                  /*check_err=*/ERR_count_to_mark() > 0);
@@ -877,3 +916,34 @@ int ossl_quic_tls_has_bad_max_early_data(QUIC_TLS *qtls)
      */
     return max_early_data != 0xffffffff && max_early_data != 0;
 }
+
+int ossl_quic_tls_get0_early_data_tparams(QUIC_TLS *qtls,
+                                          const unsigned char **tparams,
+                                          size_t *tparams_len)
+{
+    const SSL_SESSION *sess = SSL_get0_session(qtls->args.s);
+
+    /* RFC 9001 s. 4.6.1: QUIC tickets allow 0-RTT with 0xffffffff only. */
+    if (qtls->args.is_server || sess == NULL
+        || sess->ext.max_early_data != 0xffffffff
+        || sess->ext.quic_tparams == NULL)
+        return 0;
+
+    *tparams        = sess->ext.quic_tparams;
+    *tparams_len    = sess->ext.quic_tparams_len;
+    return 1;
+}
+
+int ossl_quic_tls_enable_early_data(QUIC_TLS *qtls)
+{
+    if (qtls->args.is_server || qtls->configured)
+        return 0;
+
+    qtls->early_data = 1;
+    return 1;
+}
+
+int ossl_quic_tls_is_early_data_accepted(QUIC_TLS *qtls)
+{
+    return SSL_get_early_data_status(qtls->args.s) == SSL_EARLY_DATA_ACCEPTED;
+}
@@ -426,6 +426,22 @@ int ossl_quic_tserver_stream_new(QUIC_TSERVER *srv,
     return 1;
 }
 
+int ossl_quic_tserver_set_stream_priority(QUIC_TSERVER *srv,
+                                          uint64_t stream_id,
+                                          unsigned int urgency,
+                                          int incremental)
+{
+    QUIC_STREAM_MAP *qsm = ossl_quic_channel_get_qsm(srv->ch);
+    QUIC_STREAM *qs;
+
+    if (urgency > QUIC_STREAM_URGENCY_MAX
+        || (qs = ossl_quic_stream_map_get_by_id(qsm, stream_id)) == NULL)
+        return 0;
+
+    ossl_quic_stream_map_set_priority(qsm, qs, urgency, incremental);
+    return 1;
+}
+
 BIO *ossl_quic_tserver_get0_rbio(QUIC_TSERVER *srv)
 {
     return srv->args.net_rbio;
@@ -525,6 +541,9 @@ int ossl_quic_tserver_shutdown(QUIC_TSERVER *srv, uint64_t app_error_code)
 {
     ossl_quic_channel_local_close(srv->ch, app_error_code, NULL);
 
+    /* As for SSL_shutdown(), so that the session stays in the cache. */
+    SSL_set_shutdown(srv->tls, SSL_SENT_SHUTDOWN);
+
     /* TODO(QUIC SERVER): !SSL_SHUTDOWN_FLAG_NO_STREAM_FLUSH */
 
     if (ossl_quic_channel_is_terminated(srv->ch))
@@ -581,3 +600,26 @@ void ossl_quic_tserver_set_psk_find_session_cb(QUIC_TSERVER *srv,
 {
     SSL_set_psk_find_session_callback(srv->tls, cb);
 }
+
+int ossl_quic_tserver_set_max_datagram_frame_size(QUIC_TSERVER *srv,
+                                                  uint64_t max_size)
+{
+    return ossl_quic_channel_set_max_datagram_frame_size(srv->ch, max_size);
+}
+
+int ossl_quic_tserver_send_datagram(QUIC_TSERVER *srv,
+                                    const unsigned char *buf, size_t buf_len)
+{
+    if (!ossl_quic_channel_send_datagram(srv->ch, buf, buf_len))
+        return 0;
+
+    ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(srv->ch), 0);
+    return 1;
+}
+
+int ossl_quic_tserver_recv_datagram(QUIC_TSERVER *srv,
+                                    unsigned char *buf, size_t buf_len,
+                                    size_t *bytes_read)
+{
+    return ossl_quic_channel_recv_datagram(srv->ch, buf, buf_len, bytes_read);
+}
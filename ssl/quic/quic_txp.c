@@ -12,8 +12,11 @@
 #include "internal/quic_stream_map.h"
 #include "internal/quic_error.h"
 #include "internal/common.h"
+#include "internal/safe_math.h"
 #include <openssl/err.h>
 
+OSSL_SAFE_MATH_UNSIGNED(uint64_t, uint64_t)
+
 #define MIN_CRYPTO_HDR_SIZE             3
 
 #define MIN_FRAME_SIZE_HANDSHAKE_DONE   1
@@ -48,6 +51,16 @@
 
 #define TX_PACKETISER_ARCHETYPE_NUM                 3
 
+/*
+ * Pacing. Packets are paced using a token bucket which fills at the pacing
+ * rate given by the congestion controller. The bucket holds enough for a
+ * burst of TXP_PACING_MIN_BURST datagrams, or for TXP_PACING_QUANTUM of
+ * transmission at the pacing rate if that is more, so that the granularity of
+ * the timers used to wake us up does not limit the rate at which we can send.
+ */
+#define TXP_PACING_MIN_BURST        10
+#define TXP_PACING_QUANTUM          (ossl_ms2time(2))
+
 struct ossl_quic_tx_packetiser_st {
     OSSL_QUIC_TX_PACKETISER_ARGS args;
 
@@ -67,6 +80,10 @@ struct ossl_quic_tx_packetiser_st {
     uint64_t        next_pn[QUIC_PN_SPACE_NUM]; /* Next PN to use in given PN space. */
     OSSL_TIME       last_tx_time;               /* Last time a packet was generated, or 0. */
 
+    /* Internal state - pacing. */
+    uint64_t        pacing_tokens;  /* bytes we may send before we are paced */
+    OSSL_TIME       pacing_time;    /* time the bucket was last filled */
+
     /* Internal state - frame (re)generation flags. */
     unsigned int    want_handshake_done     : 1;
     unsigned int    want_max_data           : 1;
@@ -87,6 +104,12 @@ struct ossl_quic_tx_packetiser_st {
     /* Has the handshake been completed? */
     unsigned int    handshake_complete      : 1;
 
+    /*
+     * Set if the CC would have allowed us to send more in the last call to
+     * ossl_quic_tx_packetiser_generate() but pacing did not.
+     */
+    unsigned int    pacing_blocked          : 1;
+
     OSSL_QUIC_FRAME_CONN_CLOSE  conn_close_frame;
 
     /*
@@ -450,6 +473,8 @@ static int txp_pkt_commit(OSSL_QUIC_TX_PACKETISER *txp, struct txp_pkt *pkt,
                           uint32_t archetype, int *txpim_pkt_reffed);
 static uint32_t txp_determine_archetype(OSSL_QUIC_TX_PACKETISER *txp,
                                         uint64_t cc_limit);
+static uint64_t txp_pacing_update(OSSL_QUIC_TX_PACKETISER *txp,
+                                  uint64_t cc_limit);
 
 OSSL_QUIC_TX_PACKETISER *ossl_quic_tx_packetiser_new(const OSSL_QUIC_TX_PACKETISER_ARGS *args)
 {
@@ -602,6 +627,14 @@ int ossl_quic_tx_packetiser_set_cur_scid(OSSL_QUIC_TX_PACKETISER *txp,
     return 1;
 }
 
+void ossl_quic_tx_packetiser_set_cc(OSSL_QUIC_TX_PACKETISER *txp,
+                                    const OSSL_CC_METHOD *cc_method,
+                                    OSSL_CC_DATA *cc_data)
+{
+    txp->args.cc_method = cc_method;
+    txp->args.cc_data   = cc_data;
+}
+
 /* Change the destination L4 address the TXP uses to send datagrams. */
 int ossl_quic_tx_packetiser_set_peer(OSSL_QUIC_TX_PACKETISER *txp,
                                      const BIO_ADDR *peer)
@@ -760,6 +793,7 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
     struct txp_pkt pkt[QUIC_ENC_LEVEL_NUM];
     size_t pkts_done = 0;
     uint64_t cc_limit = txp->args.cc_method->get_tx_allowance(txp->args.cc_data);
+    uint64_t paced_bytes = 0;
     int need_padding = 0, txpim_pkt_reffed;
 
     for (enc_level = QUIC_ENC_LEVEL_INITIAL;
@@ -775,6 +809,12 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
      */
     ossl_qtx_finish_dgram(txp->args.qtx);
 
+    /*
+     * If pacing does not let us send a full datagram yet, we can still send
+     * packets which bypass CC, just as if we were out of CC budget.
+     */
+    cc_limit = txp_pacing_update(txp, cc_limit);
+
     /* 1. Archetype Selection */
     archetype = txp_determine_archetype(txp, cc_limit);
 
@@ -900,6 +940,9 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
                 status->sent_handshake
                     = (pkt[enc_level].h_valid
                        && pkt[enc_level].h.bytes_appended > 0);
+
+            if (pkt[enc_level].tpkt->ackm_pkt.is_inflight)
+                paced_bytes += pkt[enc_level].tpkt->ackm_pkt.num_bytes;
         }
 
         if (txpim_pkt_reffed)
@@ -914,6 +957,10 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
     /* Flush & Cleanup */
     res = 1;
 out:
+    /* Probes bypass pacing, so may be sent when we are short of tokens. */
+    txp->pacing_tokens -= paced_bytes < txp->pacing_tokens
+        ? paced_bytes : txp->pacing_tokens;
+
     ossl_qtx_finish_dgram(txp->args.qtx);
 
     for (enc_level = QUIC_ENC_LEVEL_INITIAL;
@@ -1276,6 +1323,84 @@ static int txp_determine_geometry(OSSL_QUIC_TX_PACKETISER *txp,
     return 1;
 }
 
+static uint64_t txp_get_pacing_rate(OSSL_QUIC_TX_PACKETISER *txp)
+{
+    if (txp->args.cc_method->get_pacing_rate == NULL)
+        return 0;
+
+    return txp->args.cc_method->get_pacing_rate(txp->args.cc_data);
+}
+
+static uint64_t txp_pacing_burst(OSSL_QUIC_TX_PACKETISER *txp, uint64_t rate)
+{
+    uint64_t burst = TXP_PACING_MIN_BURST * txp_get_mdpl(txp);
+    uint64_t quantum;
+    int err = 0;
+
+    quantum = safe_muldiv_uint64_t(rate, ossl_time2ticks(TXP_PACING_QUANTUM),
+                                   OSSL_TIME_SECOND, &err);
+    if (err)
+        quantum = UINT64_MAX;
+
+    return quantum > burst ? quantum : burst;
+}
+
+/*
+ * Fills the pacing token bucket and returns the CC limit to use for the next
+ * datagram, which is 0 if pacing does not let us send a full datagram yet.
+ */
+static uint64_t txp_pacing_update(OSSL_QUIC_TX_PACKETISER *txp,
+                                  uint64_t cc_limit)
+{
+    OSSL_TIME now = txp->args.now(txp->args.now_arg);
+    uint64_t rate = txp_get_pacing_rate(txp);
+    uint64_t burst = txp_pacing_burst(txp, rate);
+    uint64_t fill;
+    int err = 0;
+
+    if (rate == 0) {
+        /* Not pacing. */
+        fill = burst;
+    } else {
+        fill = safe_muldiv_uint64_t(rate,
+                                    ossl_time2ticks(ossl_time_subtract(now,
+                                                                       txp->pacing_time)),
+                                    OSSL_TIME_SECOND, &err);
+        if (err)
+            fill = UINT64_MAX;
+    }
+
+    txp->pacing_tokens = safe_add_uint64_t(txp->pacing_tokens, fill, &err);
+    if (err || txp->pacing_tokens > burst)
+        txp->pacing_tokens = burst;
+
+    txp->pacing_time    = now;
+    txp->pacing_blocked = (cc_limit > 0
+                           && txp->pacing_tokens < txp_get_mdpl(txp));
+
+    return txp->pacing_blocked ? 0 : cc_limit;
+}
+
+/* Returns the time at which pacing will let us send a full datagram. */
+static OSSL_TIME txp_pacing_get_deadline(OSSL_QUIC_TX_PACKETISER *txp)
+{
+    uint64_t rate = txp_get_pacing_rate(txp);
+    uint64_t mdpl = txp_get_mdpl(txp);
+    uint64_t wait;
+    int err = 0;
+
+    if (rate == 0 || txp->pacing_tokens >= mdpl)
+        return ossl_time_zero();
+
+    /* Round up so that we do not wake up just before the tokens arrive. */
+    wait = safe_muldiv_uint64_t(mdpl - txp->pacing_tokens, OSSL_TIME_SECOND,
+                                rate, &err);
+    if (err)
+        return ossl_time_infinite();
+
+    return ossl_time_add(txp->pacing_time, ossl_ticks2time(wait + 1));
+}
+
 static uint32_t txp_determine_archetype(OSSL_QUIC_TX_PACKETISER *txp,
                                         uint64_t cc_limit)
 {
@@ -1311,6 +1436,16 @@ static uint32_t txp_determine_archetype(OSSL_QUIC_TX_PACKETISER *txp,
     return TX_PACKETISER_ARCHETYPE_NORMAL;
 }
 
+/*
+ * Stream data is sent in 1-RTT packets once the handshake is complete, or by a
+ * client in 0-RTT packets before that.
+ */
+static int txp_can_send_stream_data(OSSL_QUIC_TX_PACKETISER *txp,
+                                    uint32_t enc_level)
+{
+    return txp->handshake_complete || enc_level == QUIC_ENC_LEVEL_0RTT;
+}
+
 static int txp_should_try_staging(OSSL_QUIC_TX_PACKETISER *txp,
                                   uint32_t enc_level,
                                   uint32_t archetype,
@@ -1452,7 +1587,7 @@ static int txp_should_try_staging(OSSL_QUIC_TX_PACKETISER *txp,
             }
        }
 
-    if (a.allow_stream_rel && txp->handshake_complete) {
+    if (a.allow_stream_rel && txp_can_send_stream_data(txp, enc_level)) {
         QUIC_STREAM_ITER it;
 
         /* If there are any active streams, 0/1-RTT wants to produce a packet.
@@ -2731,10 +2866,16 @@ static int txp_generate_for_el(OSSL_QUIC_TX_PACKETISER *txp,
 
         /*
          * If the frame is too big, don't try to schedule any more GCR frames in
-         * this packet rather than sending subsequent ones out of order.
+         * this packet rather than sending subsequent ones out of order. DATAGRAM
+         * frames (RFC 9221) are unordered, so one which does not fit waits for
+         * the next packet without holding back any others.
          */
-        if (encoded_len > tx_helper_get_space_left(h))
+        if (encoded_len > tx_helper_get_space_left(h)) {
+            if (OSSL_QUIC_FRAME_TYPE_IS_DATAGRAM(frame_type))
+                continue;
+
             break;
+        }
 
         if (!tx_helper_append_iovec(h, encoded, encoded_len))
             goto fatal_err;
@@ -2763,7 +2904,7 @@ static int txp_generate_for_el(OSSL_QUIC_TX_PACKETISER *txp,
             goto fatal_err;
 
     /* Stream-specific frames */
-    if (a.allow_stream_rel && txp->handshake_complete)
+    if (a.allow_stream_rel && txp_can_send_stream_data(txp, enc_level))
         if (!txp_generate_stream_related(txp, pkt,
                                          &have_ack_eliciting,
                                          &pkt->stream_head))
@@ -3129,6 +3270,9 @@ OSSL_TIME ossl_quic_tx_packetiser_get_deadline(OSSL_QUIC_TX_PACKETISER *txp)
     if (txp->args.cc_method->get_tx_allowance(txp->args.cc_data) == 0)
         deadline = ossl_time_min(deadline,
                                  txp->args.cc_method->get_wakeup_deadline(txp->args.cc_data));
+    else if (txp->pacing_blocked)
+        /* When will pacing let us send more? */
+        deadline = ossl_time_min(deadline, txp_pacing_get_deadline(txp));
 
     return deadline;
 }
@@ -392,6 +392,50 @@ int ossl_quic_wire_encode_frame_handshake_done(WPACKET *pkt)
     return encode_frame_hdr(pkt, OSSL_QUIC_FRAME_TYPE_HANDSHAKE_DONE);
 }
 
+int ossl_quic_wire_encode_frame_ack_frequency(WPACKET *pkt,
+                                              const OSSL_QUIC_FRAME_ACK_FREQUENCY *f)
+{
+    if (!encode_frame_hdr(pkt, OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY)
+            || !WPACKET_quic_write_vlint(pkt, f->seq_num)
+            || !WPACKET_quic_write_vlint(pkt, f->ack_eliciting_threshold)
+            || !WPACKET_quic_write_vlint(pkt, ossl_time2us(f->max_ack_delay))
+            || !WPACKET_quic_write_vlint(pkt, f->reordering_threshold))
+        return 0;
+
+    return 1;
+}
+
+int ossl_quic_wire_encode_frame_immediate_ack(WPACKET *pkt)
+{
+    return encode_frame_hdr(pkt, OSSL_QUIC_FRAME_TYPE_IMMEDIATE_ACK);
+}
+
+int ossl_quic_wire_encode_frame_datagram(WPACKET *pkt,
+                                         const OSSL_QUIC_FRAME_DATAGRAM *f)
+{
+    uint64_t frame_type = f->has_explicit_len
+        ? OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN : OSSL_QUIC_FRAME_TYPE_DATAGRAM;
+
+    if (!encode_frame_hdr(pkt, frame_type)
+            || (f->has_explicit_len && !WPACKET_quic_write_vlint(pkt, f->len))
+            || !WPACKET_memcpy(pkt, f->data, (size_t)f->len))
+        return 0;
+
+    return 1;
+}
+
+size_t ossl_quic_wire_get_encoded_frame_len_datagram(uint64_t len)
+{
+    size_t a, b;
+
+    a = ossl_quic_vlint_encode_len(OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN);
+    b = ossl_quic_vlint_encode_len(len);
+    if (a == 0 || b == 0 || len > SIZE_MAX - a - b)
+        return 0;
+
+    return a + b + (size_t)len;
+}
+
 unsigned char *ossl_quic_wire_encode_transport_param_bytes(WPACKET *pkt,
                                                            uint64_t id,
                                                            const unsigned char *value,
@@ -909,6 +953,56 @@ int ossl_quic_wire_decode_frame_handshake_done(PACKET *pkt)
     return expect_frame_header(pkt, OSSL_QUIC_FRAME_TYPE_HANDSHAKE_DONE);
 }
 
+int ossl_quic_wire_decode_frame_ack_frequency(PACKET *pkt,
+                                              OSSL_QUIC_FRAME_ACK_FREQUENCY *f)
+{
+    uint64_t max_ack_delay_us;
+
+    if (!expect_frame_header(pkt, OSSL_QUIC_FRAME_TYPE_ACK_FREQUENCY)
+            || !PACKET_get_quic_vlint(pkt, &f->seq_num)
+            || !PACKET_get_quic_vlint(pkt, &f->ack_eliciting_threshold)
+            || !PACKET_get_quic_vlint(pkt, &max_ack_delay_us)
+            || !PACKET_get_quic_vlint(pkt, &f->reordering_threshold))
+        return 0;
+
+    f->max_ack_delay = ossl_time_multiply(ossl_ticks2time(OSSL_TIME_US),
+                                          max_ack_delay_us);
+
+    return 1;
+}
+
+int ossl_quic_wire_decode_frame_immediate_ack(PACKET *pkt)
+{
+    return expect_frame_header(pkt, OSSL_QUIC_FRAME_TYPE_IMMEDIATE_ACK);
+}
+
+int ossl_quic_wire_decode_frame_datagram(PACKET *pkt,
+                                         OSSL_QUIC_FRAME_DATAGRAM *f)
+{
+    uint64_t frame_type;
+
+    if (!PACKET_get_quic_vlint(pkt, &frame_type)
+            || !OSSL_QUIC_FRAME_TYPE_IS_DATAGRAM(frame_type))
+        return 0;
+
+    f->has_explicit_len = (frame_type == OSSL_QUIC_FRAME_TYPE_DATAGRAM_LEN);
+
+    if (f->has_explicit_len) {
+        if (!PACKET_get_quic_vlint(pkt, &f->len)
+                || f->len > PACKET_remaining(pkt))
+            return 0;
+    } else {
+        f->len = PACKET_remaining(pkt);
+    }
+
+    f->data = PACKET_data(pkt);
+
+    if (!PACKET_forward(pkt, (size_t)f->len))
+        return 0;
+
+    return 1;
+}
+
 int ossl_quic_wire_peek_transport_param(PACKET *pkt, uint64_t *id)
 {
     return PACKET_peek_quic_vlint(pkt, id);
@@ -1036,6 +1130,10 @@ ossl_quic_frame_type_to_string(uint64_t frame_type)
     X(CONN_CLOSE_TRANSPORT)
     X(CONN_CLOSE_APP)
     X(HANDSHAKE_DONE)
+    X(IMMEDIATE_ACK)
+    X(ACK_FREQUENCY)
+    X(DATAGRAM)
+    X(DATAGRAM_LEN)
     X(STREAM)
     X(STREAM_FIN)
     X(STREAM_LEN)
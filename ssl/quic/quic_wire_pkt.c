@@ -123,6 +123,74 @@ static int hdr_generate_mask(QUIC_HDR_PROTECTOR *hpr,
     return 1;
 }
 
+/*
+ * Generates the header protection masks for num_ptrs packets. For AES, all of
+ * the samples are enciphered in a single ECB operation, which lets the cipher
+ * implementation process several blocks in parallel. ChaCha20 takes the sample
+ * as its IV, so each mask needs its own cipher call.
+ */
+static int hdr_generate_masks(QUIC_HDR_PROTECTOR *hpr,
+                              const QUIC_PKT_HDR_PTRS *ptrs, size_t num_ptrs,
+                              unsigned char masks[][5])
+{
+    int l = 0;
+    unsigned char src[QUIC_HDR_PROT_MAX_BATCH * 16];
+    unsigned char dst[QUIC_HDR_PROT_MAX_BATCH * 16];
+    size_t i;
+
+    if (num_ptrs > QUIC_HDR_PROT_MAX_BATCH) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_INVALID_ARGUMENT);
+        return 0;
+    }
+
+    if (hpr->cipher_id != QUIC_HDR_PROT_CIPHER_AES_128
+        && hpr->cipher_id != QUIC_HDR_PROT_CIPHER_AES_256) {
+        for (i = 0; i < num_ptrs; ++i)
+            if (!hdr_generate_mask(hpr, ptrs[i].raw_sample,
+                                   ptrs[i].raw_sample_len, masks[i]))
+                return 0;
+
+        return 1;
+    }
+
+    for (i = 0; i < num_ptrs; ++i) {
+        if (ptrs[i].raw_sample_len < 16) {
+            ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_INVALID_ARGUMENT);
+            return 0;
+        }
+
+        memcpy(src + i * 16, ptrs[i].raw_sample, 16);
+    }
+
+    if (!EVP_CipherInit_ex(hpr->cipher_ctx, NULL, NULL, NULL, NULL, 1)
+        || !EVP_CipherUpdate(hpr->cipher_ctx, dst, &l, src,
+                             (int)(num_ptrs * 16))) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_EVP_LIB);
+        return 0;
+    }
+
+    for (i = 0; i < num_ptrs; ++i)
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+        memset(masks[i], 0, 5);
+#else
+        memcpy(masks[i], dst + i * 16, 5);
+#endif
+
+    return 1;
+}
+
+static void hdr_unmask(const unsigned char *mask, unsigned char *first_byte,
+                       unsigned char *pn_bytes)
+{
+    unsigned char pn_len, i;
+
+    *first_byte ^= mask[0] & ((*first_byte & 0x80) != 0 ? 0xf : 0x1f);
+    pn_len = (*first_byte & 0x3) + 1;
+
+    for (i = 0; i < pn_len; ++i)
+        pn_bytes[i] ^= mask[i + 1];
+}
+
 int ossl_quic_hdr_protector_decrypt(QUIC_HDR_PROTECTOR *hpr,
                                     QUIC_PKT_HDR_PTRS *ptrs)
 {
@@ -139,16 +207,27 @@ int ossl_quic_hdr_protector_decrypt_fields(QUIC_HDR_PROTECTOR *hpr,
                                            unsigned char *first_byte,
                                            unsigned char *pn_bytes)
 {
-    unsigned char mask[5], pn_len, i;
+    unsigned char mask[5];
 
     if (!hdr_generate_mask(hpr, sample, sample_len, mask))
         return 0;
 
-    *first_byte ^= mask[0] & ((*first_byte & 0x80) != 0 ? 0xf : 0x1f);
-    pn_len = (*first_byte & 0x3) + 1;
+    hdr_unmask(mask, first_byte, pn_bytes);
+    return 1;
+}
 
-    for (i = 0; i < pn_len; ++i)
-        pn_bytes[i] ^= mask[i + 1];
+int ossl_quic_hdr_protector_decrypt_batch(QUIC_HDR_PROTECTOR *hpr,
+                                          QUIC_PKT_HDR_PTRS *ptrs,
+                                          size_t num_ptrs)
+{
+    unsigned char masks[QUIC_HDR_PROT_MAX_BATCH][5];
+    size_t i;
+
+    if (!hdr_generate_masks(hpr, ptrs, num_ptrs, masks))
+        return 0;
+
+    for (i = 0; i < num_ptrs; ++i)
+        hdr_unmask(masks[i], ptrs[i].raw_start, ptrs[i].raw_pn);
 
     return 1;
 }
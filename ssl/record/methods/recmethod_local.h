@@ -67,6 +67,21 @@ typedef struct tls_rl_record_st {
     /* where the decode bytes are */
     /* rw */
     unsigned char *input;
+    /*
+     * When sending, if not 0, the number of bytes at the start of the record
+     * that are still at 'input' rather than in 'data'. They are encrypted
+     * from there into 'data' rather than being copied there first.
+     */
+    /* w */
+    size_t input_len;
+    /*
+     * When sending, if not NULL, the data is not at 'input' but spread over
+     * the 'numiov' buffers of 'iov', starting 'iovoff' bytes into the first.
+     */
+    /* w */
+    const SSL_IOVEC *iov;
+    size_t numiov;
+    size_t iovoff;
     /* only used with decompression - malloc()ed */
     /* r */
     unsigned char *comp;
@@ -247,6 +262,13 @@ struct ossl_record_layer_st
     /* Next wbuf with pending data still to write */
     size_t nextwbuf;
 
+    /*
+     * Buffer supplied by the application to build records in, used instead
+     * of wbuf[0] when writing through a single pipeline (not for DTLS)
+     */
+    unsigned char *app_wbuf;
+    size_t app_wbuf_len;
+
     /* How many pipelines can be used to write data */
     size_t numwpipes;
 
@@ -336,6 +358,11 @@ struct ossl_record_layer_st
     /* static IV */
     unsigned char iv[EVP_MAX_IV_LENGTH];
     int allow_plain_alerts;
+    /*
+     * Set if the cipher can take the application data to send straight from
+     * the caller's buffer, see TLS_RL_RECORD.input_len
+     */
+    int encrypt_from_input;
 
     /* TLS "any" fields */
     /* Set to true if this is the first record in a connection */
@@ -363,6 +390,8 @@ struct ossl_record_layer_st
     OSSL_FUNC_rlayer_msg_callback_fn *msg_callback;
     OSSL_FUNC_rlayer_security_fn *security;
     OSSL_FUNC_rlayer_padding_fn *padding;
+    OSSL_FUNC_rlayer_buffer_alloc_fn *buffer_alloc;
+    OSSL_FUNC_rlayer_buffer_free_fn *buffer_free;
 
     size_t max_pipelines;
 
@@ -51,40 +51,57 @@ static int tls13_set_crypto_state(OSSL_RECORD_LAYER *rl, int level,
         ERR_raise(ERR_LIB_SSL, ERR_R_INTERNAL_ERROR);
         return OSSL_RECORD_RETURN_FATAL;
     }
+    /* CCM only takes the data to encrypt in one go */
+    rl->encrypt_from_input = enc && mode != EVP_CIPH_CCM_MODE;
 
     return OSSL_RECORD_RETURN_SUCCESS;
 }
 
-static int tls13_cipher(OSSL_RECORD_LAYER *rl, TLS_RL_RECORD *recs,
-                        size_t n_recs, int sending, SSL_MAC_BUF *mac,
-                        size_t macsize)
+/*
+ * Encrypts the application data of |rec| that is still in the caller's
+ * buffer, or buffers, into rec->data. Sets |*outl| to the number of bytes
+ * written.
+ */
+static int tls13_encrypt_input(EVP_CIPHER_CTX *ctx, TLS_RL_RECORD *rec,
+                               int *outl)
+{
+    const SSL_IOVEC *iov = rec->iov;
+    size_t numiov = rec->numiov, off = rec->iovoff;
+    size_t left = rec->input_len, n;
+    int lenu;
+
+    if (iov == NULL)
+        return EVP_CipherUpdate(ctx, rec->data, outl, rec->input,
+                                (int)rec->input_len) > 0;
+
+    *outl = 0;
+    for (; left > 0; iov++, numiov--, off = 0) {
+        if (numiov == 0 || off > iov->data_len)
+            return 0;
+        n = iov->data_len - off;
+        if (n > left)
+            n = left;
+        if (n == 0)
+            continue;
+        if (EVP_CipherUpdate(ctx, rec->data + *outl, &lenu,
+                             (unsigned char *)iov->data + off, (int)n) <= 0)
+            return 0;
+        *outl += lenu;
+        left -= n;
+    }
+
+    return 1;
+}
+
+static int tls13_cipher_rec(OSSL_RECORD_LAYER *rl, TLS_RL_RECORD *rec,
+                            int sending, EVP_CIPHER_CTX *ctx, int mode)
 {
-    EVP_CIPHER_CTX *ctx;
     unsigned char iv[EVP_MAX_IV_LENGTH], recheader[SSL3_RT_HEADER_LENGTH];
     size_t ivlen, offset, loop, hdrlen;
-    unsigned char *staticiv;
+    unsigned char *staticiv = rl->iv;
     unsigned char *seq = rl->sequence;
-    int lenu, lenf;
-    TLS_RL_RECORD *rec = &recs[0];
+    int lenu, lenf, lent = 0;
     WPACKET wpkt;
-    const EVP_CIPHER *cipher;
-    int mode;
-
-    if (n_recs != 1) {
-        /* Should not happen */
-        RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
-        return 0;
-    }
-
-    ctx = rl->enc_ctx;
-    staticiv = rl->iv;
-
-    cipher = EVP_CIPHER_CTX_get0_cipher(ctx);
-    if (cipher == NULL) {
-        RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
-        return 0;
-    }
-    mode = EVP_CIPHER_get_mode(cipher);
 
     /*
      * If we're sending an alert and ctx != NULL then we must be forcing
@@ -155,10 +172,30 @@ static int tls13_cipher(OSSL_RECORD_LAYER *rl, TLS_RL_RECORD *recs,
                  && EVP_CipherUpdate(ctx, NULL, &lenu, NULL,
                                      (unsigned int)rec->length) <= 0)
             || EVP_CipherUpdate(ctx, NULL, &lenu, recheader,
-                                sizeof(recheader)) <= 0
-            || EVP_CipherUpdate(ctx, rec->data, &lenu, rec->input,
-                                (unsigned int)rec->length) <= 0
-            || EVP_CipherFinal_ex(ctx, rec->data + lenu, &lenf) <= 0
+                                sizeof(recheader)) <= 0) {
+        return 0;
+    }
+    if (sending && rec->input_len > 0) {
+        /*
+         * The application data is still in the caller's buffer: encrypt it
+         * from there, followed by the content type and padding in place.
+         */
+        if (rec->input_len > rec->length
+                || !tls13_encrypt_input(ctx, rec, &lenu)
+                || EVP_CipherUpdate(ctx, rec->data + lenu, &lent,
+                                    rec->data + rec->input_len,
+                                    (unsigned int)(rec->length
+                                                   - rec->input_len)) <= 0)
+            return 0;
+        lenu += lent;
+        TLS_RL_RECORD_reset_input(rec);
+        rec->input_len = 0;
+        rec->iov = NULL;
+    } else if (EVP_CipherUpdate(ctx, rec->data, &lenu, rec->input,
+                                (unsigned int)rec->length) <= 0) {
+        return 0;
+    }
+    if (EVP_CipherFinal_ex(ctx, rec->data + lenu, &lenf) <= 0
             || (size_t)(lenu + lenf) != rec->length) {
         return 0;
     }
@@ -175,6 +212,64 @@ static int tls13_cipher(OSSL_RECORD_LAYER *rl, TLS_RL_RECORD *recs,
     return 1;
 }
 
+/*
+ * Encrypts or decrypts the |n_recs| records in |recs|. There is more than one
+ * record when sending application data split over several pipelines (see
+ * tls13_get_max_records()). Each of them is sealed by tls13_cipher_rec() in
+ * turn, with consecutive sequence numbers.
+ */
+static int tls13_cipher(OSSL_RECORD_LAYER *rl, TLS_RL_RECORD *recs,
+                        size_t n_recs, int sending, SSL_MAC_BUF *mac,
+                        size_t macsize)
+{
+    EVP_CIPHER_CTX *ctx = rl->enc_ctx;
+    const EVP_CIPHER *cipher;
+    size_t i;
+    int mode;
+
+    if (n_recs == 0 || (n_recs > 1 && !sending)) {
+        /* Should not happen */
+        RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+
+    cipher = EVP_CIPHER_CTX_get0_cipher(ctx);
+    if (cipher == NULL) {
+        RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+    mode = EVP_CIPHER_get_mode(cipher);
+
+    for (i = 0; i < n_recs; i++)
+        if (!tls13_cipher_rec(rl, &recs[i], sending, ctx, mode))
+            return 0;
+
+    return 1;
+}
+
+/*
+ * Unlike TLSv1.2, TLSv1.3 doesn't need a pipeline capable cipher to write
+ * several records in one go: tls13_cipher() seals them one by one. So if we
+ * have been configured to use pipelines, split application data over as many
+ * records as that takes.
+ */
+static size_t tls13_get_max_records(OSSL_RECORD_LAYER *rl, uint8_t type,
+                                    size_t len, size_t maxfrag,
+                                    size_t *preffrag)
+{
+    size_t pipes;
+
+    if (rl->max_pipelines <= 1
+            || type != SSL3_RT_APPLICATION_DATA
+            || rl->enc_ctx == NULL
+            || len == 0)
+        return 1;
+
+    pipes = ((len - 1) / *preffrag) + 1;
+
+    return (pipes < rl->max_pipelines) ? pipes : rl->max_pipelines;
+}
+
 static int tls13_validate_record_header(OSSL_RECORD_LAYER *rl,
                                         TLS_RL_RECORD *rec)
 {
@@ -312,7 +407,7 @@ struct record_functions_st tls_1_3_funcs = {
     tls_get_more_records,
     tls13_validate_record_header,
     tls13_post_process_record,
-    tls_get_max_records_default,
+    tls13_get_max_records,
     tls_write_records_default,
     tls_allocate_write_buffers_default,
     tls_initialise_write_packets_default,
@@ -120,6 +120,26 @@ static int tls_allow_compression(OSSL_RECORD_LAYER *rl)
 }
 #endif
 
+/*
+ * Buffers come from the pool of the caller if it has one. Whichever way they
+ * were allocated, they can always be freed with OPENSSL_free().
+ */
+static unsigned char *tls_buffer_alloc(OSSL_RECORD_LAYER *rl, size_t len)
+{
+    if (rl->buffer_alloc != NULL)
+        return rl->buffer_alloc(rl->cbarg, len);
+    return OPENSSL_malloc(len);
+}
+
+static void tls_buffer_free(OSSL_RECORD_LAYER *rl, TLS_BUFFER *b)
+{
+    if (rl->buffer_free != NULL)
+        rl->buffer_free(rl->cbarg, b->buf, b->len);
+    else
+        OPENSSL_free(b->buf);
+    b->buf = NULL;
+}
+
 static void tls_release_write_buffer_int(OSSL_RECORD_LAYER *rl, size_t start)
 {
     TLS_BUFFER *wb;
@@ -133,7 +153,7 @@ static void tls_release_write_buffer_int(OSSL_RECORD_LAYER *rl, size_t start)
         if (TLS_BUFFER_is_app_buffer(wb))
             TLS_BUFFER_set_app_buffer(wb, 0);
         else
-            OPENSSL_free(wb->buf);
+            tls_buffer_free(rl, wb);
         wb->buf = NULL;
         pipes--;
     }
@@ -186,14 +206,29 @@ int tls_setup_write_buffer(OSSL_RECORD_LAYER *rl, size_t numwpipes,
         if (len == 0)
             len = defltlen;
 
-        if (thiswb->len != len) {
-            OPENSSL_free(thiswb->buf);
-            thiswb->buf = NULL;         /* force reallocation */
+        if (numwpipes == 1 && !rl->isdtls && rl->app_wbuf != NULL
+                && rl->app_wbuf_len >= len) {
+            /* Build the record in the buffer the application gave us */
+            if (!TLS_BUFFER_is_app_buffer(thiswb))
+                tls_buffer_free(rl, thiswb);
+            memset(thiswb, 0, sizeof(TLS_BUFFER));
+            thiswb->buf = rl->app_wbuf;
+            thiswb->len = len;
+            TLS_BUFFER_set_app_buffer(thiswb, 1);
+            continue;
+        }
+
+        if (TLS_BUFFER_is_app_buffer(thiswb)) {
+            /* Not ours to free */
+            thiswb->buf = NULL;
+            TLS_BUFFER_set_app_buffer(thiswb, 0);
+        } else if (thiswb->len != len) {
+            tls_buffer_free(rl, thiswb); /* force reallocation */
         }
 
         p = thiswb->buf;
         if (p == NULL) {
-            p = OPENSSL_malloc(len);
+            p = tls_buffer_alloc(rl, len);
             if (p == NULL) {
                 if (rl->numwpipes < currpipe)
                     rl->numwpipes = currpipe;
@@ -258,7 +293,7 @@ int tls_setup_read_buffer(OSSL_RECORD_LAYER *rl)
         if (b->default_len > len)
             len = b->default_len;
 
-        if ((p = OPENSSL_malloc(len)) == NULL) {
+        if ((p = tls_buffer_alloc(rl, len)) == NULL) {
             /*
              * We've got a malloc failure, and we're still initialising buffers.
              * We assume we're so doomed that we won't even be able to send an
@@ -281,8 +316,7 @@ static int tls_release_read_buffer(OSSL_RECORD_LAYER *rl)
     b = &rl->rbuf;
     if ((rl->options & SSL_OP_CLEANSE_PLAINTEXT) != 0)
         OPENSSL_cleanse(b->buf, b->len);
-    OPENSSL_free(b->buf);
-    b->buf = NULL;
+    tls_buffer_free(rl, b);
     return 1;
 }
 
@@ -1210,6 +1244,20 @@ int tls_set_options(OSSL_RECORD_LAYER *rl, const OSSL_PARAM *options)
             ERR_raise(ERR_LIB_SSL, SSL_R_FAILED_TO_GET_PARAMETER);
             return 0;
         }
+
+        p = OSSL_PARAM_locate_const(options,
+                                    OSSL_LIBSSL_RECORD_LAYER_PARAM_WRITE_BUFFER);
+        if (p != NULL) {
+            const void *wbuf = NULL;
+            size_t wbuflen = 0;
+
+            if (!OSSL_PARAM_get_octet_ptr(p, &wbuf, &wbuflen)) {
+                ERR_raise(ERR_LIB_SSL, SSL_R_FAILED_TO_GET_PARAMETER);
+                return 0;
+            }
+            rl->app_wbuf = (unsigned char *)wbuf;
+            rl->app_wbuf_len = wbuflen;
+        }
     }
 
     if (rl->level == OSSL_RECORD_PROTECTION_LEVEL_APPLICATION) {
@@ -1339,6 +1387,13 @@ tls_int_new_record_layer(OSSL_LIB_CTX *libctx, const char *propq, int vers,
                 break;
             case OSSL_FUNC_RLAYER_PADDING:
                 rl->padding = OSSL_FUNC_rlayer_padding(fns);
+                break;
+            case OSSL_FUNC_RLAYER_BUFFER_ALLOC:
+                rl->buffer_alloc = OSSL_FUNC_rlayer_buffer_alloc(fns);
+                break;
+            case OSSL_FUNC_RLAYER_BUFFER_FREE:
+                rl->buffer_free = OSSL_FUNC_rlayer_buffer_free(fns);
+                break;
             default:
                 /* Just ignore anything we don't understand */
                 break;
@@ -1434,7 +1489,7 @@ static void tls_int_free(OSSL_RECORD_LAYER *rl)
     BIO_free(rl->prev);
     BIO_free(rl->bio);
     BIO_free(rl->next);
-    ossl_tls_buffer_release(&rl->rbuf);
+    tls_buffer_free(rl, &rl->rbuf);
 
     tls_release_write_buffer(rl);
 
@@ -1657,7 +1712,8 @@ int tls_prepare_for_encryption_default(OSSL_RECORD_LAYER *rl,
     /* Get a pointer to the start of this record excluding header */
     recordstart = WPACKET_get_curr(thispkt) - len;
     TLS_RL_RECORD_set_data(thiswr, recordstart);
-    TLS_RL_RECORD_reset_input(thiswr);
+    if (thiswr->input_len == 0)
+        TLS_RL_RECORD_reset_input(thiswr);
     TLS_RL_RECORD_set_length(thiswr, len);
 
     return 1;
@@ -1730,6 +1786,29 @@ int tls_post_encryption_processing_default(OSSL_RECORD_LAYER *rl,
     return 1;
 }
 
+/*
+ * Copies |len| bytes into |pkt| from the |numiov| buffers in |iov|, starting
+ * |off| bytes into the first of them.
+ */
+static int tls_gather_iov(WPACKET *pkt, const SSL_IOVEC *iov, size_t numiov,
+                          size_t off, size_t len)
+{
+    size_t n;
+
+    for (; len > 0; iov++, numiov--, off = 0) {
+        if (numiov == 0 || off > iov->data_len)
+            return 0;
+        n = iov->data_len - off;
+        if (n > len)
+            n = len;
+        if (n > 0 && !WPACKET_memcpy(pkt, (unsigned char *)iov->data + off, n))
+            return 0;
+        len -= n;
+    }
+
+    return 1;
+}
+
 int tls_write_records_default(OSSL_RECORD_LAYER *rl,
                               OSSL_RECORD_TEMPLATE *templates,
                               size_t numtempl)
@@ -1805,13 +1884,34 @@ int tls_write_records_default(OSSL_RECORD_LAYER *rl,
 
         /* first we compress */
         if (rl->compctx != NULL) {
-            if (!tls_do_compress(rl, thiswr)
+            /* libssl does not gather data when compressing */
+            if (!ossl_assert(thistempl->iov == NULL)
+                    || !tls_do_compress(rl, thiswr)
                     || !WPACKET_allocate_bytes(thispkt, thiswr->length, NULL)) {
                 RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, SSL_R_COMPRESSION_FAILURE);
                 goto err;
             }
+        } else if (compressdata != NULL && rl->encrypt_from_input
+                   && rectype == SSL3_RT_APPLICATION_DATA) {
+            /*
+             * Leave the data in the caller's buffer and just make room for it:
+             * the cipher reads it from there.
+             */
+            if (!WPACKET_allocate_bytes(thispkt, thiswr->length, NULL)) {
+                RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
+                goto err;
+            }
+            thiswr->input_len = thiswr->length;
+            thiswr->iov = thistempl->iov;
+            thiswr->numiov = thistempl->numiov;
+            thiswr->iovoff = thistempl->iovoff;
         } else if (compressdata != NULL) {
-            if (!WPACKET_memcpy(thispkt, thiswr->input, thiswr->length)) {
+            if (thistempl->iov != NULL
+                    ? !tls_gather_iov(thispkt, thistempl->iov,
+                                      thistempl->numiov, thistempl->iovoff,
+                                      thiswr->length)
+                    : !WPACKET_memcpy(thispkt, thiswr->input,
+                                      thiswr->length)) {
                 RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
                 goto err;
             }
@@ -82,8 +82,11 @@ static int tls_write_records_multiblock_int(OSSL_RECORD_LAYER *rl,
      * Check templates have contiguous buffers and are all the same type and
      * length
      */
+    if (templates[0].iov != NULL)
+        return 0;
     for (i = 1; i < numtempl; i++) {
-        if (templates[i - 1].type != templates[i].type
+        if (templates[i].iov != NULL
+                || templates[i - 1].type != templates[i].type
                 || templates[i - 1].buflen != templates[i].buflen
                 || templates[i - 1].buf + templates[i - 1].buflen
                    != templates[i].buf)
@@ -45,6 +45,7 @@ int RECORD_LAYER_clear(RECORD_LAYER *rl)
     rl->alert_count = 0;
     rl->num_recs = 0;
     rl->curr_rec = 0;
+    rl->read_borrowed = 0;
 
     BIO_free(rl->rrlnext);
     rl->rrlnext = NULL;
@@ -211,6 +212,37 @@ void SSL_set_default_read_buffer_len(SSL *s, size_t len)
     sc->rlayer.default_read_buf_len = len;
 }
 
+int SSL_set_write_buffer(SSL *s, void *buf, size_t len)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+    OSSL_PARAM options[2], *opts = options;
+
+    if (sc == NULL || SSL_CONNECTION_IS_DTLS(sc)) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_WRONG_SSL_VERSION);
+        return 0;
+    }
+
+    /* Records still waiting to be sent may be in the old buffer */
+    if (RECORD_LAYER_write_pending(&sc->rlayer)) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+
+    sc->rlayer.app_wbuf = buf;
+    sc->rlayer.app_wbuf_len = buf != NULL ? len : 0;
+
+    if (sc->rlayer.wrlmethod != NULL) {
+        *opts++ = OSSL_PARAM_construct_octet_ptr(OSSL_LIBSSL_RECORD_LAYER_PARAM_WRITE_BUFFER,
+                                                 &sc->rlayer.app_wbuf,
+                                                 sc->rlayer.app_wbuf_len);
+        *opts = OSSL_PARAM_construct_end();
+        if (!sc->rlayer.wrlmethod->set_options(sc->rlayer.wrl, options))
+            return 0;
+    }
+
+    return 1;
+}
+
 const char *SSL_rstate_string_long(const SSL *s)
 {
     const SSL_CONNECTION *sc = SSL_CONNECTION_FROM_CONST_SSL(s);
@@ -261,23 +293,95 @@ static int tls_write_check_pending(SSL_CONNECTION *s, uint8_t type,
 }
 
 /*
- * Call this to write data in records of type 'type' It will return <= 0 if
- * not all data has been sent or non-blocking IO.
+ * Sets up |tmpl| to send the |len| bytes which start |off| bytes into the data
+ * of a write. That data is either in |buf|, or if |iov| is not NULL, spread
+ * over the |numiov| buffers of |iov|.
  */
-int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
-                     size_t *written)
+static void tls_set_template_data(OSSL_RECORD_TEMPLATE *tmpl,
+                                  const unsigned char *buf,
+                                  const SSL_IOVEC *iov, size_t numiov,
+                                  size_t off, size_t len)
+{
+    tmpl->buflen = len;
+    tmpl->iov = NULL;
+    if (iov == NULL) {
+        tmpl->buf = buf + off;
+        return;
+    }
+
+    /* Find the buffer the record starts in */
+    while (numiov > 1 && off >= iov->data_len) {
+        off -= iov->data_len;
+        iov++;
+        numiov--;
+    }
+    if (off + len <= iov->data_len) {
+        /* The record fits in that buffer, so no need to gather it */
+        tmpl->buf = (const unsigned char *)iov->data + off;
+    } else {
+        tmpl->buf = NULL;
+        tmpl->iov = iov;
+        tmpl->numiov = numiov;
+        tmpl->iovoff = off;
+    }
+}
+
+/*
+ * Returns how many of the |len| bytes which start |off| bytes into the data
+ * spread over the |numiov| buffers of |iov| are in the same buffer.
+ */
+static size_t tls_iov_contig_len(const SSL_IOVEC *iov, size_t numiov,
+                                 size_t off, size_t len)
+{
+    while (numiov > 1 && off >= iov->data_len) {
+        off -= iov->data_len;
+        iov++;
+        numiov--;
+    }
+    if (len > iov->data_len - off)
+        len = iov->data_len - off;
+
+    return len;
+}
+
+/*
+ * kTLS passes the data of a record to the kernel as it is, and compression
+ * takes it in one piece, so with either a record must not span more than one
+ * buffer of an SSL_writev_ex() call.
+ */
+static int tls_write_can_gather(SSL_CONNECTION *s)
+{
+    return !BIO_get_ktls_send(s->wbio)
+           && s->rlayer.wrlmethod->get_compression(s->rlayer.wrl) == NULL;
+}
+
+/*
+ * Writes |len| bytes of data in records of type |type|. The data is either in
+ * |buf|, or if |iov| is not NULL, spread over the |numiov| buffers of |iov|.
+ * It will return <= 0 if not all data has been sent or non-blocking IO.
+ */
+static int tls_write_bytes_int(SSL *ssl, uint8_t type, const unsigned char *buf,
+                               const SSL_IOVEC *iov, size_t numiov, size_t len,
+                               size_t *written)
 {
-    const unsigned char *buf = buf_;
     size_t tot;
     size_t n, max_send_fragment, split_send_fragment, maxpipes;
     int i;
     SSL_CONNECTION *s = SSL_CONNECTION_FROM_SSL_ONLY(ssl);
     OSSL_RECORD_TEMPLATE tmpls[SSL_MAX_PIPELINES];
     unsigned int recversion;
+    /*
+     * What a retry is checked against to see if the data moved. For data in
+     * several buffers the first one stands for all of them.
+     */
+    const unsigned char *wbuf = buf;
 
     if (s == NULL)
         return -1;
 
+    if (iov != NULL)
+        wbuf = numiov > 0 ? iov[0].data : NULL;
+
     s->rwstate = SSL_NOTHING;
     tot = s->rlayer.wnum;
     /*
@@ -329,7 +433,7 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
         }
     }
 
-    i = tls_write_check_pending(s, type, buf, len);
+    i = tls_write_check_pending(s, type, wbuf, len);
     if (i < 0) {
         /* SSLfatal() already called */
         return i;
@@ -352,7 +456,7 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
          */
         s->rlayer.wpend_tot = 0;
         s->rlayer.wpend_type = type;
-        s->rlayer.wpend_buf = buf;
+        s->rlayer.wpend_buf = wbuf;
     }
 
     if (tot == len) {           /* done? */
@@ -401,12 +505,18 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
     for (;;) {
         size_t tmppipelen, remain;
         size_t j, lensofar = 0;
+        size_t avail = n;
+
+        /* The data we can send in this round, see tls_write_can_gather() */
+        if (iov != NULL && !tls_write_can_gather(s))
+            avail = tls_iov_contig_len(iov, numiov, tot, n);
 
         /*
         * Ask the record layer how it would like to split the amount of data
         * that we have, and how many of those records it would like in one go.
         */
-        maxpipes = s->rlayer.wrlmethod->get_max_records(s->rlayer.wrl, type, n,
+        maxpipes = s->rlayer.wrlmethod->get_max_records(s->rlayer.wrl, type,
+                                                        avail,
                                                         max_send_fragment,
                                                         &split_send_fragment);
         /*
@@ -426,7 +536,7 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
             return -1;
         }
 
-        if (n / maxpipes >= split_send_fragment) {
+        if (avail / maxpipes >= split_send_fragment) {
             /*
              * We have enough data to completely fill all available
              * pipelines
@@ -434,15 +544,16 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
             for (j = 0; j < maxpipes; j++) {
                 tmpls[j].type = type;
                 tmpls[j].version = recversion;
-                tmpls[j].buf = &(buf[tot]) + (j * split_send_fragment);
-                tmpls[j].buflen = split_send_fragment;
+                tls_set_template_data(&tmpls[j], buf, iov, numiov,
+                                      tot + j * split_send_fragment,
+                                      split_send_fragment);
             }
             /* Remember how much data we are going to be sending */
             s->rlayer.wpend_tot = maxpipes * split_send_fragment;
         } else {
             /* We can partially fill all available pipelines */
-            tmppipelen = n / maxpipes;
-            remain = n % maxpipes;
+            tmppipelen = avail / maxpipes;
+            remain = avail % maxpipes;
             /*
              * If there is a remainder we add an extra byte to the first few
              * pipelines
@@ -452,14 +563,14 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
             for (j = 0; j < maxpipes; j++) {
                 tmpls[j].type = type;
                 tmpls[j].version = recversion;
-                tmpls[j].buf = &(buf[tot]) + lensofar;
-                tmpls[j].buflen = tmppipelen;
+                tls_set_template_data(&tmpls[j], buf, iov, numiov,
+                                      tot + lensofar, tmppipelen);
                 lensofar += tmppipelen;
                 if (j + 1 == remain)
                     tmppipelen--;
             }
             /* Remember how much data we are going to be sending */
-            s->rlayer.wpend_tot = n;
+            s->rlayer.wpend_tot = avail;
         }
 
         i = HANDLE_RLAYER_WRITE_RETURN(s,
@@ -483,6 +594,27 @@ int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf_, size_t len,
     }
 }
 
+/*
+ * Call this to write data in records of type 'type' It will return <= 0 if
+ * not all data has been sent or non-blocking IO.
+ */
+int ssl3_write_bytes(SSL *ssl, uint8_t type, const void *buf, size_t len,
+                     size_t *written)
+{
+    return tls_write_bytes_int(ssl, type, buf, NULL, 0, len, written);
+}
+
+/*
+ * As ssl3_write_bytes() for application data gathered from the |numiov|
+ * buffers of |iov|, whose lengths add up to |len|.
+ */
+int ssl3_writev_bytes(SSL *ssl, const SSL_IOVEC *iov, size_t numiov,
+                      size_t len, size_t *written)
+{
+    return tls_write_bytes_int(ssl, SSL3_RT_APPLICATION_DATA, NULL, iov,
+                               numiov, len, written);
+}
+
 int ossl_tls_handle_rlayer_return(SSL_CONNECTION *s, int writing, int ret,
                                   char *file, int line)
 {
@@ -1154,11 +1286,30 @@ static size_t rlayer_padding_wrapper(void *cbarg, int type, size_t len)
                                        s->rlayer.record_padding_arg);
 }
 
+static OSSL_FUNC_rlayer_buffer_alloc_fn rlayer_buffer_alloc_wrapper;
+static unsigned char *rlayer_buffer_alloc_wrapper(void *cbarg, size_t len)
+{
+    SSL_CONNECTION *s = cbarg;
+
+    return ssl_buf_pool_alloc(SSL_CONNECTION_GET_CTX(s), len);
+}
+
+static OSSL_FUNC_rlayer_buffer_free_fn rlayer_buffer_free_wrapper;
+static void rlayer_buffer_free_wrapper(void *cbarg, unsigned char *buf,
+                                       size_t len)
+{
+    SSL_CONNECTION *s = cbarg;
+
+    ssl_buf_pool_release(SSL_CONNECTION_GET_CTX(s), buf, len);
+}
+
 static const OSSL_DISPATCH rlayer_dispatch[] = {
     { OSSL_FUNC_RLAYER_SKIP_EARLY_DATA, (void (*)(void))ossl_statem_skip_early_data },
     { OSSL_FUNC_RLAYER_MSG_CALLBACK, (void (*)(void))rlayer_msg_callback_wrapper },
     { OSSL_FUNC_RLAYER_SECURITY, (void (*)(void))rlayer_security_wrapper },
     { OSSL_FUNC_RLAYER_PADDING, (void (*)(void))rlayer_padding_wrapper },
+    { OSSL_FUNC_RLAYER_BUFFER_ALLOC, (void (*)(void))rlayer_buffer_alloc_wrapper },
+    { OSSL_FUNC_RLAYER_BUFFER_FREE, (void (*)(void))rlayer_buffer_free_wrapper },
     OSSL_DISPATCH_END
 };
 
@@ -1287,6 +1438,10 @@ int ssl_set_new_record_layer(SSL_CONNECTION *s, int version,
     } else {
         *opts++ = OSSL_PARAM_construct_size_t(OSSL_LIBSSL_RECORD_LAYER_PARAM_BLOCK_PADDING,
                                               &s->rlayer.block_padding);
+        if (s->rlayer.app_wbuf != NULL)
+            *opts++ = OSSL_PARAM_construct_octet_ptr(OSSL_LIBSSL_RECORD_LAYER_PARAM_WRITE_BUFFER,
+                                                     &s->rlayer.app_wbuf,
+                                                     s->rlayer.app_wbuf_len);
     }
     *opts = OSSL_PARAM_construct_end();
 
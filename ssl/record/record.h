@@ -93,6 +93,9 @@ typedef struct record_layer_st {
     BIO *rrlnext;
     /* Default read buffer length to be passed to the record layer */
     size_t default_read_buf_len;
+    /* Application buffer to build records in, see SSL_set_write_buffer() */
+    void *app_wbuf;
+    size_t app_wbuf_len;
 
     /*
      * Read as many input bytes as possible (for
@@ -125,6 +128,9 @@ typedef struct record_layer_st {
     size_t curr_rec;
     /* Record layer data to be processed */
     TLS_RECORD tlsrecs[SSL_MAX_PIPELINES];
+    /* Set while the current record is lent out by SSL_borrow_read_buf() */
+    int read_borrowed;
+    size_t read_borrow_len;
 
 } RECORD_LAYER;
 
@@ -148,6 +154,8 @@ int RECORD_LAYER_is_sslv2_record(RECORD_LAYER *rl);
 __owur size_t ssl3_pending(const SSL *s);
 __owur int ssl3_write_bytes(SSL *s, uint8_t type, const void *buf, size_t len,
                             size_t *written);
+__owur int ssl3_writev_bytes(SSL *s, const SSL_IOVEC *iov, size_t numiov,
+                             size_t len, size_t *written);
 __owur int ssl3_read_bytes(SSL *s, uint8_t type, uint8_t *recvd_type,
                            unsigned char *buf, size_t len, int peek,
                            size_t *readbytes);
@@ -198,3 +206,9 @@ OSSL_CORE_MAKE_FUNC(int, rlayer_security, (void *cbarg, int op, int bits,
                                            int nid, void *other))
 # define OSSL_FUNC_RLAYER_PADDING                4
 OSSL_CORE_MAKE_FUNC(size_t, rlayer_padding, (void *cbarg, int type, size_t len))
+# define OSSL_FUNC_RLAYER_BUFFER_ALLOC           5
+OSSL_CORE_MAKE_FUNC(unsigned char *, rlayer_buffer_alloc,
+                    (void *cbarg, size_t len))
+# define OSSL_FUNC_RLAYER_BUFFER_FREE            6
+OSSL_CORE_MAKE_FUNC(void, rlayer_buffer_free,
+                    (void *cbarg, unsigned char *buf, size_t len))
@@ -4511,6 +4511,29 @@ int ssl3_write(SSL *s, const void *buf, size_t len, size_t *written)
                                       written);
 }
 
+int ssl3_writev(SSL *s, const SSL_IOVEC *iov, size_t numiov, size_t *written)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+    size_t i, len = 0;
+
+    if (sc == NULL)
+        return 0;
+
+    for (i = 0; i < numiov; i++) {
+        if (iov[i].data_len > SIZE_MAX - len) {
+            ERR_raise(ERR_LIB_SSL, SSL_R_BAD_LENGTH);
+            return -1;
+        }
+        len += iov[i].data_len;
+    }
+
+    clear_sys_error();
+    if (sc->s3.renegotiate)
+        ssl3_renegotiate_check(s, 0);
+
+    return ssl3_writev_bytes(s, iov, numiov, len, written);
+}
+
 static int ssl3_read_internal(SSL *s, void *buf, size_t len, int peek,
                               size_t *readbytes)
 {
@@ -4556,6 +4579,71 @@ int ssl3_peek(SSL *s, void *buf, size_t len, size_t *readbytes)
     return ssl3_read_internal(s, buf, len, 1, readbytes);
 }
 
+/*
+ * Lends out the decrypted application data of the current record where it
+ * is, in the buffer of the read record layer. Return values are as for
+ * ssl3_read().
+ */
+int ssl3_borrow_read_buf(SSL *s, const unsigned char **buf, size_t *buf_len)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+    TLS_RECORD *rr;
+    size_t readbytes;
+    int ret;
+
+    if (sc == NULL)
+        return 0;
+
+    for (;;) {
+        /*
+         * A zero length peek processes records up to the next one with
+         * application data, or returns <= 0 if there is none. It consumes
+         * empty application data records, so try again after those.
+         */
+        ret = ssl3_read_internal(s, NULL, 0, 1, &readbytes);
+        if (ret < 0 || (sc->shutdown & SSL_RECEIVED_SHUTDOWN) != 0)
+            return ret;
+        if (sc->rlayer.curr_rec >= sc->rlayer.num_recs)
+            continue;
+        rr = &sc->rlayer.tlsrecs[sc->rlayer.curr_rec];
+        if (rr->type == SSL3_RT_APPLICATION_DATA && rr->length > 0)
+            break;
+    }
+
+    *buf = rr->data + rr->off;
+    *buf_len = rr->length;
+    sc->rlayer.read_borrowed = 1;
+    sc->rlayer.read_borrow_len = rr->length;
+
+    return 1;
+}
+
+int ssl3_release_read_buf(SSL *s, size_t consumed)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+    TLS_RECORD *rr;
+
+    if (sc == NULL)
+        return 0;
+
+    if (!sc->rlayer.read_borrowed) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+    if (consumed > sc->rlayer.read_borrow_len) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_INVALID_ARGUMENT);
+        return 0;
+    }
+
+    sc->rlayer.read_borrowed = 0;
+    /* ssl_release_record() takes a length of 0 to mean the whole record */
+    if (consumed == 0)
+        return 1;
+
+    rr = &sc->rlayer.tlsrecs[sc->rlayer.curr_rec];
+    return ssl_release_record(sc, rr, consumed);
+}
+
 int ssl3_renegotiate(SSL *s)
 {
     SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
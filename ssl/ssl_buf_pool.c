@@ -0,0 +1,138 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * A pool of record layer buffers owned by an SSL_CTX.
+ *
+ * Connections using SSL_MODE_RELEASE_BUFFERS give their read and write
+ * buffers back whenever they go idle and need them again as soon as they
+ * have something to read or write, so that many idle connections cost
+ * little memory.  Taking those buffers from a pool instead of from malloc
+ * keeps that cheap for busy connections as well.
+ *
+ * Buffers are only ever plain OPENSSL_malloc() blocks of their class size,
+ * so a buffer taken from the pool may also be freed with OPENSSL_free(), and
+ * a buffer may be given back to a different SSL_CTX than it came from.
+ */
+
+#include <string.h>
+#include "ssl_local.h"
+
+static SSL_BUF_POOL_SHARD *buf_pool_shard(SSL_CTX *ctx)
+{
+    CRYPTO_THREAD_ID tid = CRYPTO_THREAD_get_current_id();
+    const unsigned char *p = (const unsigned char *)&tid;
+    unsigned int h = 0x811c9dc5;    /* FNV-1a */
+    size_t i;
+
+    for (i = 0; i < sizeof(tid); i++)
+        h = (h ^ p[i]) * 0x01000193;
+    return &ctx->buf_pool[h % SSL_BUF_POOL_NUM_SHARDS];
+}
+
+/* Returns the size class of a buffer of |len| bytes, or -1 if not pooled */
+static int buf_pool_class(size_t len)
+{
+    size_t cls;
+
+    if (len == 0)
+        return -1;
+    cls = (len - 1) / SSL_BUF_POOL_CLASS_SIZE;
+    if (cls >= SSL_BUF_POOL_NUM_CLASSES)
+        return -1;
+    return (int)cls;
+}
+
+int ssl_buf_pool_new(SSL_CTX *ctx)
+{
+    size_t i;
+
+    ctx->buf_pool = OPENSSL_zalloc(sizeof(*ctx->buf_pool)
+                                   * SSL_BUF_POOL_NUM_SHARDS);
+    if (ctx->buf_pool == NULL)
+        return 0;
+    for (i = 0; i < SSL_BUF_POOL_NUM_SHARDS; i++) {
+        ctx->buf_pool[i].lock = CRYPTO_THREAD_lock_new();
+        if (ctx->buf_pool[i].lock == NULL) {
+            ssl_buf_pool_free(ctx);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void ssl_buf_pool_free(SSL_CTX *ctx)
+{
+    SSL_BUF_POOL_SHARD *shard;
+    unsigned char *buf;
+    size_t i, cls;
+
+    if (ctx->buf_pool == NULL)
+        return;
+
+    for (i = 0; i < SSL_BUF_POOL_NUM_SHARDS; i++) {
+        shard = &ctx->buf_pool[i];
+        for (cls = 0; cls < SSL_BUF_POOL_NUM_CLASSES; cls++) {
+            while ((buf = shard->free[cls]) != NULL) {
+                memcpy(&shard->free[cls], buf, sizeof(buf));
+                OPENSSL_free(buf);
+            }
+        }
+        CRYPTO_THREAD_lock_free(shard->lock);
+    }
+    OPENSSL_free(ctx->buf_pool);
+    ctx->buf_pool = NULL;
+}
+
+unsigned char *ssl_buf_pool_alloc(SSL_CTX *ctx, size_t len)
+{
+    SSL_BUF_POOL_SHARD *shard;
+    unsigned char *buf = NULL;
+    int cls = buf_pool_class(len);
+
+    if (cls < 0 || ctx->buf_pool == NULL)
+        return OPENSSL_malloc(len);
+
+    shard = buf_pool_shard(ctx);
+    if (CRYPTO_THREAD_write_lock(shard->lock)) {
+        if ((buf = shard->free[cls]) != NULL) {
+            memcpy(&shard->free[cls], buf, sizeof(buf));
+            shard->num_free[cls]--;
+        }
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+    if (buf == NULL)
+        buf = OPENSSL_malloc(((size_t)cls + 1) * SSL_BUF_POOL_CLASS_SIZE);
+    return buf;
+}
+
+void ssl_buf_pool_release(SSL_CTX *ctx, unsigned char *buf, size_t len)
+{
+    SSL_BUF_POOL_SHARD *shard;
+    int cls = buf_pool_class(len);
+
+    if (buf == NULL)
+        return;
+    if (cls < 0 || ctx->buf_pool == NULL) {
+        OPENSSL_free(buf);
+        return;
+    }
+
+    shard = buf_pool_shard(ctx);
+    if (CRYPTO_THREAD_write_lock(shard->lock)) {
+        if (shard->num_free[cls] < SSL_BUF_POOL_MAX_FREE) {
+            memcpy(buf, &shard->free[cls], sizeof(buf));
+            shard->free[cls] = buf;
+            shard->num_free[cls]++;
+            buf = NULL;
+        }
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+    OPENSSL_free(buf);
+}
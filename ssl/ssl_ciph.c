@@ -17,6 +17,8 @@
 #include <openssl/crypto.h>
 #include <openssl/conf.h>
 #include <openssl/trace.h>
+#include <openssl/kdf.h>
+#include <openssl/core_names.h>
 #include "internal/nelem.h"
 #include "ssl_local.h"
 #include "internal/thread_once.h"
@@ -319,6 +321,11 @@ static int get_optional_pkey_id(const char *pkey_name)
 
 #endif
 
+static const char *const ssl_kdf_names[SSL_KDF_NUM_IDX] = {
+    OSSL_KDF_NAME_TLS1_PRF,     /* SSL_KDF_TLS1_PRF_IDX */
+    OSSL_KDF_NAME_TLS1_3_KDF    /* SSL_KDF_TLS1_3_KDF_IDX */
+};
+
 int ssl_load_ciphers(SSL_CTX *ctx)
 {
     size_t i;
@@ -361,6 +368,11 @@ int ssl_load_ciphers(SSL_CTX *ctx)
      * if these algorithms are not available.
      */
     ERR_set_mark();
+    for (i = 0; i < SSL_KDF_NUM_IDX; i++)
+        ctx->ssl_kdf_methods[i] = EVP_KDF_fetch(ctx->libctx, ssl_kdf_names[i],
+                                                ctx->propq);
+    ctx->ssl_hmac = EVP_MAC_fetch(ctx->libctx, OSSL_MAC_NAME_HMAC, ctx->propq);
+
     sig = EVP_SIGNATURE_fetch(ctx->libctx, "DSA", ctx->propq);
     if (sig == NULL)
         ctx->disabled_auth_mask |= SSL_aDSS;
@@ -22,6 +22,7 @@
 #include <openssl/ct.h>
 #include <openssl/trace.h>
 #include <openssl/core_names.h>
+#include <openssl/kdf.h>
 #include "internal/cryptlib.h"
 #include "internal/nelem.h"
 #include "internal/refcount.h"
@@ -79,10 +80,11 @@ struct ssl_async_args {
     SSL *s;
     void *buf;
     size_t num;
-    enum { READFUNC, WRITEFUNC, OTHERFUNC } type;
+    enum { READFUNC, WRITEFUNC, WRITEVFUNC, OTHERFUNC } type;
     union {
         int (*func_read) (SSL *, void *, size_t, size_t *);
         int (*func_write) (SSL *, const void *, size_t, size_t *);
+        int (*func_writev) (SSL *, const SSL_IOVEC *, size_t, size_t *);
         int (*func_other) (SSL *);
     } f;
 };
@@ -960,7 +962,8 @@ int SSL_is_tls(const SSL *s)
 int SSL_is_quic(const SSL *s)
 {
 #ifndef OPENSSL_NO_QUIC
-    if (s->type == SSL_TYPE_QUIC_CONNECTION || s->type == SSL_TYPE_QUIC_XSO)
+    if (s->type == SSL_TYPE_QUIC_CONNECTION || s->type == SSL_TYPE_QUIC_XSO
+        || s->type == SSL_TYPE_QUIC_LISTENER)
         return 1;
 #endif
     return 0;
@@ -1049,6 +1052,9 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
     r.session_id_length = id_len;
     memcpy(r.session_id, id, id_len);
 
+    if (sc->session_ctx->sess_shards != NULL)
+        return ssl_session_cache_has_id(sc->session_ctx, &r);
+
     if (!CRYPTO_THREAD_read_lock(sc->session_ctx->lock))
         return 0;
     p = lh_SSL_SESSION_retrieve(sc->session_ctx->sessions, &r);
@@ -2258,6 +2264,8 @@ static int ssl_io_intern(void *vargs)
         return args->f.func_read(s, buf, num, &sc->asyncrw);
     case WRITEFUNC:
         return args->f.func_write(s, buf, num, &sc->asyncrw);
+    case WRITEVFUNC:
+        return args->f.func_writev(s, buf, num, &sc->asyncrw);
     case OTHERFUNC:
         return args->f.func_other(s);
     }
@@ -2287,7 +2295,8 @@ int ssl_read_internal(SSL *s, void *buf, size_t num, size_t *readbytes)
     }
 
     if (sc->early_data_state == SSL_EARLY_DATA_CONNECT_RETRY
-                || sc->early_data_state == SSL_EARLY_DATA_ACCEPT_RETRY) {
+                || sc->early_data_state == SSL_EARLY_DATA_ACCEPT_RETRY
+                || sc->rlayer.read_borrowed) {
         ERR_raise(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
         return 0;
     }
@@ -2404,9 +2413,8 @@ int SSL_read_early_data(SSL *s, void *buf, size_t num, size_t *readbytes)
 
 int SSL_get_early_data_status(const SSL *s)
 {
-    const SSL_CONNECTION *sc = SSL_CONNECTION_FROM_CONST_SSL_ONLY(s);
+    const SSL_CONNECTION *sc = SSL_CONNECTION_FROM_CONST_SSL(s);
 
-    /* TODO(QUIC 0RTT): 0-RTT support */
     if (sc == NULL)
         return 0;
 
@@ -2433,6 +2441,12 @@ static int ssl_peek_internal(SSL *s, void *buf, size_t num, size_t *readbytes)
     if (sc->shutdown & SSL_RECEIVED_SHUTDOWN) {
         return 0;
     }
+
+    if (sc->rlayer.read_borrowed) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+
     if ((sc->mode & SSL_MODE_ASYNC) && ASYNC_get_current_job() == NULL) {
         struct ssl_async_args args;
         int ret;
@@ -2644,6 +2658,101 @@ int SSL_write_ex2(SSL *s, const void *buf, size_t num, uint64_t flags,
     return ret;
 }
 
+int SSL_writev_ex(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                  size_t *written)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+    int ret;
+
+    *written = 0;
+
+    /* QUIC has SSL_write_ref() for writing without a copy */
+    if (sc == NULL || SSL_CONNECTION_IS_DTLS(sc)) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_WRONG_SSL_VERSION);
+        return 0;
+    }
+
+    if (sc->handshake_func == NULL) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_UNINITIALIZED);
+        return 0;
+    }
+
+    if (sc->shutdown & SSL_SENT_SHUTDOWN) {
+        sc->rwstate = SSL_NOTHING;
+        ERR_raise(ERR_LIB_SSL, SSL_R_PROTOCOL_IS_SHUTDOWN);
+        return 0;
+    }
+
+    if (sc->early_data_state == SSL_EARLY_DATA_CONNECT_RETRY
+                || sc->early_data_state == SSL_EARLY_DATA_ACCEPT_RETRY
+                || sc->early_data_state == SSL_EARLY_DATA_READ_RETRY) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+    /* If we are a client and haven't sent the Finished we better do that */
+    ossl_statem_check_finish_init(sc, 1);
+
+    if ((sc->mode & SSL_MODE_ASYNC) && ASYNC_get_current_job() == NULL) {
+        struct ssl_async_args args;
+
+        args.s = s;
+        args.buf = (void *)iov;
+        args.num = iovcnt;
+        args.type = WRITEVFUNC;
+        args.f.func_writev = ssl3_writev;
+
+        ret = ssl_start_async_job(s, &args, ssl_io_intern);
+        *written = sc->asyncrw;
+    } else {
+        ret = ssl3_writev(s, iov, iovcnt, written);
+    }
+
+    return ret > 0;
+}
+
+int SSL_readv_ex(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                 size_t *readbytes)
+{
+    const unsigned char *data;
+    size_t i = 0, off = 0, total = 0, avail, done, n;
+
+    *readbytes = 0;
+
+    /* Skip any empty buffers at the start */
+    while (i < iovcnt && iov[i].data_len == 0)
+        i++;
+    if (i == iovcnt)
+        return SSL_read_ex(s, NULL, 0, readbytes);
+
+    /*
+     * Copy the data straight out of the decrypted records, going on to the
+     * next record for as long as there is one that is ready.
+     */
+    do {
+        if (!SSL_borrow_read_buf(s, &data, &avail))
+            break;
+
+        for (done = 0; done < avail && i < iovcnt; done += n) {
+            n = iov[i].data_len - off;
+            if (n > avail - done)
+                n = avail - done;
+            memcpy((unsigned char *)iov[i].data + off, data + done, n);
+            off += n;
+            while (i < iovcnt && off == iov[i].data_len) {
+                i++;
+                off = 0;
+            }
+        }
+
+        if (!SSL_release_read_buf(s, done))
+            return 0;
+        total += done;
+    } while (i < iovcnt && SSL_pending(s) > 0);
+
+    *readbytes = total;
+    return total > 0;
+}
+
 int SSL_write_early_data(SSL *s, const void *buf, size_t num, size_t *written)
 {
     int ret, early_data_state;
@@ -2651,7 +2760,11 @@ int SSL_write_early_data(SSL *s, const void *buf, size_t num, size_t *written)
     uint32_t partialwrite;
     SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
 
-    /* TODO(QUIC 0RTT): This will need special handling for QUIC */
+#ifndef OPENSSL_NO_QUIC
+    if (IS_QUIC(s))
+        return ossl_quic_write_early_data(s, buf, num, written);
+#endif
+
     if (sc == NULL)
         return 0;
 
@@ -2983,6 +3096,8 @@ long ossl_ctrl_internal(SSL *s, int cmd, long larg, void *parg, int no_quic)
         sc->max_pipelines = larg;
         if (sc->rlayer.rrlmethod->set_max_pipelines != NULL)
             sc->rlayer.rrlmethod->set_max_pipelines(sc->rlayer.rrl, (size_t)larg);
+        if (sc->rlayer.wrlmethod->set_max_pipelines != NULL)
+            sc->rlayer.wrlmethod->set_max_pipelines(sc->rlayer.wrl, (size_t)larg);
         return 1;
     case SSL_CTRL_GET_RI_SUPPORT:
         return sc->s3.send_connection_binding;
@@ -3098,13 +3213,18 @@ long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
         return (long)ctx->session_cache_size;
     case SSL_CTRL_SET_SESS_CACHE_MODE:
         l = ctx->session_cache_mode;
+        /* Switching to or from a sharded cache only works while it's empty */
+        if (((l ^ larg) & SSL_SESS_CACHE_SHARDED) != 0
+                && !ssl_session_cache_set_sharded(ctx,
+                        (larg & SSL_SESS_CACHE_SHARDED) != 0))
+            larg ^= SSL_SESS_CACHE_SHARDED;
         ctx->session_cache_mode = larg;
         return l;
     case SSL_CTRL_GET_SESS_CACHE_MODE:
         return ctx->session_cache_mode;
 
     case SSL_CTRL_SESS_NUMBER:
-        return lh_SSL_SESSION_num_items(ctx->sessions);
+        return ssl_session_cache_num(ctx);
     case SSL_CTRL_SESS_CONNECT:
         return ssl_tsan_load(ctx, &ctx->stats.sess_connect);
     case SSL_CTRL_SESS_CONNECT_GOOD:
@@ -3788,7 +3908,7 @@ int SSL_export_keying_material_early(SSL *s, unsigned char *out, size_t olen,
                                               context, contextlen);
 }
 
-static unsigned long ssl_session_hash(const SSL_SESSION *a)
+unsigned long ssl_session_hash(const SSL_SESSION *a)
 {
     const unsigned char *session_id = a->session_id;
     unsigned long l;
@@ -3815,7 +3935,7 @@ static unsigned long ssl_session_hash(const SSL_SESSION *a)
  * being able to construct an SSL_SESSION that will collide with any existing
  * session with a matching session ID.
  */
-static int ssl_session_cmp(const SSL_SESSION *a, const SSL_SESSION *b)
+int ssl_session_cmp(const SSL_SESSION *a, const SSL_SESSION *b)
 {
     if (a->ssl_version != b->ssl_version)
         return 1;
@@ -3900,6 +4020,10 @@ SSL_CTX *SSL_CTX_new_ex(OSSL_LIB_CTX *libctx, const char *propq,
         ERR_raise(ERR_LIB_SSL, ERR_R_CRYPTO_LIB);
         goto err;
     }
+    if (!ssl_buf_pool_new(ret)) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_CRYPTO_LIB);
+        goto err;
+    }
     ret->cert_store = X509_STORE_new();
     if (ret->cert_store == NULL) {
         ERR_raise(ERR_LIB_SSL, ERR_R_X509_LIB);
@@ -4146,6 +4270,9 @@ void SSL_CTX_free(SSL_CTX *a)
 
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_SSL_CTX, a, &a->ex_data);
     lh_SSL_SESSION_free(a->sessions);
+    ssl_session_cache_set_sharded(a, 0);
+    ssl_shm_sess_cache_free(a);
+    ssl_buf_pool_free(a);
     X509_STORE_free(a->cert_store);
 #ifndef OPENSSL_NO_CT
     CTLOG_STORE_free(a->ctlog_store);
@@ -4181,6 +4308,9 @@ void SSL_CTX_free(SSL_CTX *a)
         ssl_evp_cipher_free(a->ssl_cipher_methods[j]);
     for (j = 0; j < SSL_MD_NUM_IDX; j++)
         ssl_evp_md_free(a->ssl_digest_methods[j]);
+    for (j = 0; j < SSL_KDF_NUM_IDX; j++)
+        EVP_KDF_free(a->ssl_kdf_methods[j]);
+    EVP_MAC_free(a->ssl_hmac);
     for (j = 0; j < a->group_list_len; j++) {
         OPENSSL_free(a->group_list[j].tlsname);
         OPENSSL_free(a->group_list[j].realname);
@@ -7445,6 +7575,117 @@ int SSL_stream_conclude(SSL *ssl, uint64_t flags)
 #endif
 }
 
+int SSL_write_ref(SSL *s, const void *buf, size_t len, uint64_t flags,
+                  SSL_write_ref_release_cb_fn release_cb, void *arg)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_write_ref(s, buf, len, flags, release_cb, arg);
+#else
+    return 0;
+#endif
+}
+
+int SSL_borrow_read_buf(SSL *s, const unsigned char **buf, size_t *buf_len)
+{
+    SSL_CONNECTION *sc;
+
+#ifndef OPENSSL_NO_QUIC
+    if (IS_QUIC(s))
+        return ossl_quic_borrow_read_buf(s, buf, buf_len);
+#endif
+
+    *buf = NULL;
+    *buf_len = 0;
+
+    sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+    if (sc == NULL || SSL_CONNECTION_IS_DTLS(sc)) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_WRONG_SSL_VERSION);
+        return 0;
+    }
+
+    if (sc->handshake_func == NULL) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_UNINITIALIZED);
+        return 0;
+    }
+
+    if (sc->shutdown & SSL_RECEIVED_SHUTDOWN) {
+        sc->rwstate = SSL_NOTHING;
+        return 0;
+    }
+
+    if (sc->early_data_state == SSL_EARLY_DATA_CONNECT_RETRY
+                || sc->early_data_state == SSL_EARLY_DATA_ACCEPT_RETRY
+                || sc->rlayer.read_borrowed) {
+        /* Only one buffer can be borrowed at a time. */
+        ERR_raise(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+    ossl_statem_check_finish_init(sc, 0);
+
+    return ssl3_borrow_read_buf(s, buf, buf_len) > 0;
+}
+
+int SSL_release_read_buf(SSL *s, size_t consumed)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (IS_QUIC(s))
+        return ossl_quic_release_read_buf(s, consumed);
+#endif
+
+    return ssl3_release_read_buf(s, consumed);
+}
+
+int SSL_set_max_datagram_frame_size(SSL *s, uint64_t max_size)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_set_max_datagram_frame_size(s, max_size);
+#else
+    return 0;
+#endif
+}
+
+size_t SSL_get_max_datagram_size(SSL *s)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_get_max_datagram_size(s);
+#else
+    return 0;
+#endif
+}
+
+int SSL_send_datagram(SSL *s, const void *buf, size_t len)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_send_datagram(s, buf, len);
+#else
+    return 0;
+#endif
+}
+
+int SSL_recv_datagram(SSL *s, void *buf, size_t len, size_t *readbytes)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_recv_datagram(s, buf, len, readbytes);
+#else
+    return 0;
+#endif
+}
+
 SSL *SSL_new_stream(SSL *s, uint64_t flags)
 {
 #ifndef OPENSSL_NO_QUIC
@@ -7510,6 +7751,30 @@ int SSL_is_stream_local(SSL *s)
 #endif
 }
 
+int SSL_set_stream_priority(SSL *s, unsigned int urgency, int incremental)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_set_stream_priority(s, urgency, incremental);
+#else
+    return 0;
+#endif
+}
+
+int SSL_get_stream_priority(SSL *s, unsigned int *urgency, int *incremental)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_get_stream_priority(s, urgency, incremental);
+#else
+    return 0;
+#endif
+}
+
 int SSL_set_default_stream_mode(SSL *s, uint32_t mode)
 {
 #ifndef OPENSSL_NO_QUIC
@@ -7522,6 +7787,18 @@ int SSL_set_default_stream_mode(SSL *s, uint32_t mode)
 #endif
 }
 
+int SSL_set_quic_congestion_control(SSL *s, const char *name)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_set_congestion_control(s, name);
+#else
+    return 0;
+#endif
+}
+
 int SSL_set_incoming_stream_policy(SSL *s, int policy, uint64_t aec)
 {
 #ifndef OPENSSL_NO_QUIC
@@ -7558,6 +7835,106 @@ size_t SSL_get_accept_stream_queue_len(SSL *s)
 #endif
 }
 
+SSL *SSL_new_listener(SSL_CTX *ctx, uint64_t flags)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (ctx == NULL || !IS_QUIC_CTX(ctx)) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_INVALID_ARGUMENT);
+        return NULL;
+    }
+
+    return ossl_quic_new_listener(ctx, flags);
+#else
+    ERR_raise(ERR_LIB_SSL, ERR_R_UNSUPPORTED);
+    return NULL;
+#endif
+}
+
+int SSL_is_listener(SSL *s)
+{
+#ifndef OPENSSL_NO_QUIC
+    return s != NULL && s->type == SSL_TYPE_QUIC_LISTENER;
+#else
+    return 0;
+#endif
+}
+
+int SSL_listen(SSL *s)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_listen(s);
+#else
+    return 0;
+#endif
+}
+
+SSL *SSL_accept_connection(SSL *s, uint64_t flags)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return NULL;
+
+    return ossl_quic_accept_connection(s, flags);
+#else
+    return NULL;
+#endif
+}
+
+size_t SSL_get_accept_connection_queue_len(SSL *s)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_get_accept_connection_queue_len(s);
+#else
+    return 0;
+#endif
+}
+
+int SSL_set_max_accept_connection_queue_len(SSL *s, size_t max_len)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_set_max_accept_connection_queue_len(s, max_len);
+#else
+    return 0;
+#endif
+}
+
+int SSL_add_listener_worker(SSL *s, BIO *rbio, BIO *wbio)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_add_listener_worker(s, rbio, wbio);
+#else
+    return 0;
+#endif
+}
+
+int SSL_set_quic_lb_config(SSL *s, unsigned int config_id,
+                           const unsigned char *server_id,
+                           size_t server_id_len, size_t nonce_len,
+                           const unsigned char *key, size_t key_len)
+{
+#ifndef OPENSSL_NO_QUIC
+    if (!IS_QUIC(s))
+        return 0;
+
+    return ossl_quic_set_lb_config(s, config_id, server_id, server_id_len,
+                                   nonce_len, key, key_len);
+#else
+    return 0;
+#endif
+}
+
 int SSL_stream_reset(SSL *s,
                      const SSL_STREAM_RESET_ARGS *args,
                      size_t args_len)
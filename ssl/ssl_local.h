@@ -363,6 +363,11 @@
 # define SSL_ENC_KUZNYECHIK_IDX  23
 # define SSL_ENC_NUM_IDX         24
 
+/* Indexes of the KDFs pre-fetched by ssl_load_ciphers() */
+# define SSL_KDF_TLS1_PRF_IDX    0
+# define SSL_KDF_TLS1_3_KDF_IDX  1
+# define SSL_KDF_NUM_IDX         2
+
 /*-
  * SSL_kRSA <- RSA_ENC
  * SSL_kDH  <- DH_ENC & (RSA_ENC | RSA_SIGN | DSA_SIGN)
@@ -544,7 +549,8 @@ struct ssl_session_st {
     CRYPTO_EX_DATA ex_data;     /* application specific data */
     /*
      * These are used to make removal of session-ids more efficient and to
-     * implement a maximum cache size.
+     * implement a maximum cache size.  In a sharded cache they link the
+     * session into a timing wheel bucket of its shard instead.
      */
     struct ssl_session_st *prev, *next;
 
@@ -568,6 +574,12 @@ struct ssl_session_st {
          * performed at all.
          */
         uint8_t max_fragment_len_mode;
+        /*
+         * The QUIC transport parameters sent by the server, remembered by a
+         * client for use with 0-RTT (RFC 9000 s. 7.4.1)
+         */
+        unsigned char *quic_tparams;
+        size_t quic_tparams_len;
     } ext;
 # ifndef OPENSSL_NO_SRP
     char *srp_username;
@@ -804,6 +816,45 @@ typedef struct {
 
 # define TLS_GROUP_FFDHE_FOR_TLS1_3 (TLS_GROUP_FFDHE|TLS_GROUP_ONLY_FOR_TLS1_3)
 
+/*
+ * A sharded session cache (SSL_SESS_CACHE_SHARDED) spreads the sessions over
+ * SSL_SESS_CACHE_NUM_SHARDS shards by session ID hash, each with its own lock
+ * and hash table.  Instead of a list sorted by timeout, each shard keeps a
+ * hashed timing wheel: sessions are put in the bucket for the second they
+ * expire in, so adding and removing are O(1) and a flush only visits the
+ * buckets for the seconds that have passed since the previous one.
+ */
+# define SSL_SESS_CACHE_NUM_SHARDS      16
+# define SSL_SESS_CACHE_WHEEL_SLOTS     256
+
+typedef struct ssl_sess_shard_st {
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(SSL_SESSION) *sessions;
+    SSL_SESSION *wheel[SSL_SESS_CACHE_WHEEL_SLOTS];
+    /* The second up to which the wheel has been flushed */
+    uint64_t flushed;
+} SSL_SESS_SHARD;
+
+/*
+ * Record layer buffers released by connections are kept for reuse in a pool
+ * owned by the SSL_CTX.  Buffers are grouped in classes by their size rounded
+ * up to a multiple of SSL_BUF_POOL_CLASS_SIZE, and each class is a free list
+ * of at most SSL_BUF_POOL_MAX_FREE buffers.  The pool is split into
+ * SSL_BUF_POOL_NUM_SHARDS shards by thread, so that threads serving different
+ * connections rarely contend for a lock.
+ */
+# define SSL_BUF_POOL_NUM_SHARDS        16
+# define SSL_BUF_POOL_CLASS_SIZE        1024
+# define SSL_BUF_POOL_NUM_CLASSES       32
+# define SSL_BUF_POOL_MAX_FREE          16
+
+typedef struct ssl_buf_pool_shard_st {
+    CRYPTO_RWLOCK *lock;
+    /* Free buffers each start with a pointer to the next one in their list */
+    unsigned char *free[SSL_BUF_POOL_NUM_CLASSES];
+    size_t num_free[SSL_BUF_POOL_NUM_CLASSES];
+} SSL_BUF_POOL_SHARD;
+
 struct ssl_ctx_st {
     OSSL_LIB_CTX *libctx;
 
@@ -822,6 +873,13 @@ struct ssl_ctx_st {
     size_t session_cache_size;
     struct ssl_session_st *session_cache_head;
     struct ssl_session_st *session_cache_tail;
+    /* The shards of the cache if SSL_SESS_CACHE_SHARDED is in use, or NULL */
+    SSL_SESS_SHARD *sess_shards;
+    /* The slots of the shared session cache, see ssl_sess_shm.c */
+    void *shm_sess_slots;
+    size_t shm_sess_num_slots;
+    /* Record layer buffers available for reuse, see ssl_buf_pool.c */
+    SSL_BUF_POOL_SHARD *buf_pool;
     /*
      * This can have one of 2 values, ored together, SSL_SESS_CACHE_CLIENT,
      * SSL_SESS_CACHE_SERVER, Default is SSL_SESSION_CACHE_SERVER, which
@@ -1158,6 +1216,12 @@ struct ssl_ctx_st {
     const EVP_CIPHER *ssl_cipher_methods[SSL_ENC_NUM_IDX];
     const EVP_MD *ssl_digest_methods[SSL_MD_NUM_IDX];
     size_t ssl_mac_secret_size[SSL_MD_NUM_IDX];
+    /*
+     * KDFs and the HMAC used on every handshake, fetched once here rather
+     * than by each connection.  Entries are NULL if unavailable.
+     */
+    EVP_KDF *ssl_kdf_methods[SSL_KDF_NUM_IDX];
+    EVP_MAC *ssl_hmac;
 
     size_t tls12_sigalgs_len;
     /* Cache of all sigalgs we know and whether they are available or not */
@@ -1196,6 +1260,7 @@ typedef struct cert_pkey_st CERT_PKEY;
 #define SSL_TYPE_SSL_CONNECTION  0
 #define SSL_TYPE_QUIC_CONNECTION 1
 #define SSL_TYPE_QUIC_XSO        2
+#define SSL_TYPE_QUIC_LISTENER   3
 
 struct ssl_st {
     int type;
@@ -2609,6 +2674,11 @@ void ssl3_free(SSL *s);
 __owur int ssl3_read(SSL *s, void *buf, size_t len, size_t *readbytes);
 __owur int ssl3_peek(SSL *s, void *buf, size_t len, size_t *readbytes);
 __owur int ssl3_write(SSL *s, const void *buf, size_t len, size_t *written);
+__owur int ssl3_writev(SSL *s, const SSL_IOVEC *iov, size_t numiov,
+                       size_t *written);
+__owur int ssl3_borrow_read_buf(SSL *s, const unsigned char **buf,
+                                size_t *buf_len);
+__owur int ssl3_release_read_buf(SSL *s, size_t consumed);
 __owur int ssl3_shutdown(SSL *s);
 int ssl3_clear(SSL *s);
 __owur long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg);
@@ -2949,6 +3019,16 @@ int ssl_srp_calc_a_param_intern(SSL_CONNECTION *s);
 int ssl_srp_server_param_with_username_intern(SSL_CONNECTION *s, int *ad);
 
 void ssl_session_calculate_timeout(SSL_SESSION *ss);
+unsigned long ssl_session_hash(const SSL_SESSION *a);
+int ssl_session_cmp(const SSL_SESSION *a, const SSL_SESSION *b);
+int ssl_session_cache_set_sharded(SSL_CTX *ctx, int sharded);
+size_t ssl_session_cache_num(SSL_CTX *ctx);
+int ssl_session_cache_has_id(SSL_CTX *ctx, SSL_SESSION *r);
+void ssl_shm_sess_cache_free(SSL_CTX *ctx);
+int ssl_buf_pool_new(SSL_CTX *ctx);
+void ssl_buf_pool_free(SSL_CTX *ctx);
+unsigned char *ssl_buf_pool_alloc(SSL_CTX *ctx, size_t len);
+void ssl_buf_pool_release(SSL_CTX *ctx, unsigned char *buf, size_t len);
 
 # else /* OPENSSL_UNIT_TEST */
 
@@ -40,6 +40,169 @@ __owur static ossl_inline int timeoutcmp(SSL_SESSION *a, SSL_SESSION *b)
     return ossl_time_compare(a->calc_timeout, b->calc_timeout);
 }
 
+/*
+ * Returns the shard of |ctx|'s session cache that holds sessions with the ID
+ * of |s|, or NULL if the cache isn't sharded.  The low bits of the hash pick
+ * the bucket within the shard's hash table, so use the high bits here.
+ */
+static SSL_SESS_SHARD *sess_shard(const SSL_CTX *ctx, const SSL_SESSION *s)
+{
+    if (ctx->sess_shards == NULL)
+        return NULL;
+    return &ctx->sess_shards[(ssl_session_hash(s) >> 24)
+                             % SSL_SESS_CACHE_NUM_SHARDS];
+}
+
+static CRYPTO_RWLOCK *sess_cache_lock(const SSL_CTX *ctx, const SSL_SESSION *s)
+{
+    SSL_SESS_SHARD *shard = sess_shard(ctx, s);
+
+    return shard != NULL ? shard->lock : ctx->lock;
+}
+
+static LHASH_OF(SSL_SESSION) *sess_cache_hash(const SSL_CTX *ctx,
+                                              const SSL_SESSION *s)
+{
+    SSL_SESS_SHARD *shard = sess_shard(ctx, s);
+
+    return shard != NULL ? shard->sessions : ctx->sessions;
+}
+
+static size_t sess_wheel_slot(const SSL_SESSION *s)
+{
+    return (size_t)(ossl_time2seconds(s->calc_timeout)
+                    % SSL_SESS_CACHE_WHEEL_SLOTS);
+}
+
+/* locked by the shard in the calling function */
+static void sess_wheel_remove(SSL_SESS_SHARD *shard, SSL_SESSION *s)
+{
+    if (s->owner == NULL)
+        return;
+
+    if (s->prev != NULL)
+        s->prev->next = s->next;
+    else
+        shard->wheel[sess_wheel_slot(s)] = s->next;
+    if (s->next != NULL)
+        s->next->prev = s->prev;
+    s->prev = s->next = NULL;
+    s->owner = NULL;
+}
+
+/*
+ * locked by the shard in the calling function
+ * The session must not be in the wheel, as its bucket is derived from its
+ * timeout: remove it before changing that.
+ */
+static void sess_wheel_add(SSL_CTX *ctx, SSL_SESS_SHARD *shard, SSL_SESSION *s)
+{
+    size_t slot = sess_wheel_slot(s);
+
+    s->prev = NULL;
+    s->next = shard->wheel[slot];
+    if (s->next != NULL)
+        s->next->prev = s;
+    shard->wheel[slot] = s;
+    s->owner = ctx;
+}
+
+/*
+ * Returns the session with the earliest timeout in the first non-empty bucket
+ * after the last flush.  That is the oldest session in the shard unless some
+ * timeouts are more than a turn of the wheel apart, which is close enough for
+ * picking a session to evict from a full cache.
+ */
+static SSL_SESSION *sess_wheel_oldest(SSL_SESS_SHARD *shard)
+{
+    SSL_SESSION *s, *oldest = NULL;
+    size_t i;
+
+    for (i = 0; i < SSL_SESS_CACHE_WHEEL_SLOTS && oldest == NULL; i++) {
+        s = shard->wheel[(shard->flushed + i) % SSL_SESS_CACHE_WHEEL_SLOTS];
+        for (; s != NULL; s = s->next)
+            if (oldest == NULL || timeoutcmp(s, oldest) < 0)
+                oldest = s;
+    }
+    return oldest;
+}
+
+static void sess_shards_free(SSL_SESS_SHARD *shards)
+{
+    size_t i;
+
+    if (shards == NULL)
+        return;
+    for (i = 0; i < SSL_SESS_CACHE_NUM_SHARDS; i++) {
+        lh_SSL_SESSION_free(shards[i].sessions);
+        CRYPTO_THREAD_lock_free(shards[i].lock);
+    }
+    OPENSSL_free(shards);
+}
+
+/*
+ * Switches |ctx|'s session cache to or from being sharded.  This can only be
+ * done while the cache is empty.  Returns 1 on success or 0 on failure.
+ */
+int ssl_session_cache_set_sharded(SSL_CTX *ctx, int sharded)
+{
+    SSL_SESS_SHARD *shards;
+    size_t i;
+
+    if (sharded == (ctx->sess_shards != NULL))
+        return 1;
+    if (ssl_session_cache_num(ctx) != 0)
+        return 0;
+
+    if (!sharded) {
+        sess_shards_free(ctx->sess_shards);
+        ctx->sess_shards = NULL;
+        return 1;
+    }
+
+    shards = OPENSSL_zalloc(sizeof(*shards) * SSL_SESS_CACHE_NUM_SHARDS);
+    if (shards == NULL)
+        return 0;
+    for (i = 0; i < SSL_SESS_CACHE_NUM_SHARDS; i++) {
+        shards[i].lock = CRYPTO_THREAD_lock_new();
+        shards[i].sessions = lh_SSL_SESSION_new(ssl_session_hash,
+                                                ssl_session_cmp);
+        if (shards[i].lock == NULL || shards[i].sessions == NULL) {
+            sess_shards_free(shards);
+            return 0;
+        }
+    }
+    ctx->sess_shards = shards;
+    return 1;
+}
+
+size_t ssl_session_cache_num(SSL_CTX *ctx)
+{
+    size_t i, n = 0;
+
+    if (ctx->sess_shards == NULL)
+        return lh_SSL_SESSION_num_items(ctx->sessions);
+    for (i = 0; i < SSL_SESS_CACHE_NUM_SHARDS; i++)
+        n += lh_SSL_SESSION_num_items(ctx->sess_shards[i].sessions);
+    return n;
+}
+
+/*
+ * Returns 1 if a session matching |r| is in |ctx|'s sharded session cache,
+ * or 0 otherwise.
+ */
+int ssl_session_cache_has_id(SSL_CTX *ctx, SSL_SESSION *r)
+{
+    SSL_SESS_SHARD *shard = sess_shard(ctx, r);
+    SSL_SESSION *p;
+
+    if (shard == NULL || !CRYPTO_THREAD_read_lock(shard->lock))
+        return 0;
+    p = lh_SSL_SESSION_retrieve(shard->sessions, r);
+    CRYPTO_THREAD_unlock(shard->lock);
+    return p != NULL;
+}
+
 /*
  * Calculates effective timeout
  * Locking must be done by the caller of this function
@@ -156,6 +319,7 @@ SSL_SESSION *ssl_session_dup(const SSL_SESSION *src, int ticket)
     dest->ext.hostname = NULL;
     dest->ext.tick = NULL;
     dest->ext.alpn_selected = NULL;
+    dest->ext.quic_tparams = NULL;
 #ifndef OPENSSL_NO_SRP
     dest->srp_username = NULL;
 #endif
@@ -244,6 +408,13 @@ SSL_SESSION *ssl_session_dup(const SSL_SESSION *src, int ticket)
             goto err;
     }
 
+    if (src->ext.quic_tparams != NULL) {
+        dest->ext.quic_tparams = OPENSSL_memdup(src->ext.quic_tparams,
+                                                src->ext.quic_tparams_len);
+        if (dest->ext.quic_tparams == NULL)
+            goto err;
+    }
+
 #ifndef OPENSSL_NO_SRP
     if (src->srp_username) {
         dest->srp_username = OPENSSL_strdup(src->srp_username);
@@ -476,6 +647,7 @@ SSL_SESSION *lookup_sess_in_cache(SSL_CONNECTION *s,
     if ((s->session_ctx->session_cache_mode
          & SSL_SESS_CACHE_NO_INTERNAL_LOOKUP) == 0) {
         SSL_SESSION data;
+        CRYPTO_RWLOCK *lock;
 
         data.ssl_version = s->version;
         if (!ossl_assert(sess_id_len <= SSL_MAX_SSL_SESSION_ID_LENGTH))
@@ -484,14 +656,16 @@ SSL_SESSION *lookup_sess_in_cache(SSL_CONNECTION *s,
         memcpy(data.session_id, sess_id, sess_id_len);
         data.session_id_length = sess_id_len;
 
-        if (!CRYPTO_THREAD_read_lock(s->session_ctx->lock))
+        lock = sess_cache_lock(s->session_ctx, &data);
+        if (!CRYPTO_THREAD_read_lock(lock))
             return NULL;
-        ret = lh_SSL_SESSION_retrieve(s->session_ctx->sessions, &data);
+        ret = lh_SSL_SESSION_retrieve(sess_cache_hash(s->session_ctx, &data),
+                                      &data);
         if (ret != NULL) {
             /* don't allow other threads to steal it: */
             SSL_SESSION_up_ref(ret);
         }
-        CRYPTO_THREAD_unlock(s->session_ctx->lock);
+        CRYPTO_THREAD_unlock(lock);
         if (ret == NULL)
             ssl_tsan_counter(s->session_ctx, &s->session_ctx->stats.sess_miss);
     }
@@ -691,6 +865,10 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 {
     int ret = 0;
     SSL_SESSION *s;
+    SSL_SESS_SHARD *shard = sess_shard(ctx, c);
+    CRYPTO_RWLOCK *lock = shard != NULL ? shard->lock : ctx->lock;
+    LHASH_OF(SSL_SESSION) *sessions
+        = shard != NULL ? shard->sessions : ctx->sessions;
 
     /*
      * add just 1 reference count for the SSL_CTX's session cache even though
@@ -702,11 +880,11 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
      * if session c is in already in cache, we take back the increment later
      */
 
-    if (!CRYPTO_THREAD_write_lock(ctx->lock)) {
+    if (!CRYPTO_THREAD_write_lock(lock)) {
         SSL_SESSION_free(c);
         return 0;
     }
-    s = lh_SSL_SESSION_insert(ctx->sessions, c);
+    s = lh_SSL_SESSION_insert(sessions, c);
 
     /*
      * s != NULL iff we already had a session with the given PID. In this
@@ -725,7 +903,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
          */
         s = NULL;
     } else if (s == NULL &&
-               lh_SSL_SESSION_retrieve(ctx->sessions, c) == NULL) {
+               lh_SSL_SESSION_retrieve(sessions, c) == NULL) {
         /* s == NULL can also mean OOM error in lh_SSL_SESSION_insert ... */
 
         /*
@@ -737,6 +915,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 
     /* Adjust last used time, and add back into the cache at the appropriate spot */
     if (ctx->session_cache_mode & SSL_SESS_CACHE_UPDATE_TIME) {
+        SSL_SESSION_list_remove(ctx, c);
         c->time = ossl_time_now();
         ssl_session_calculate_timeout(c);
     }
@@ -749,7 +928,19 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 
         ret = 1;
 
-        if (SSL_CTX_sess_get_cache_size(ctx) > 0) {
+        if (shard != NULL && ctx->session_cache_size > 0) {
+            /* Each shard gets an equal part of the cache */
+            size_t max = (ctx->session_cache_size
+                          + SSL_SESS_CACHE_NUM_SHARDS - 1)
+                         / SSL_SESS_CACHE_NUM_SHARDS;
+
+            while (lh_SSL_SESSION_num_items(sessions) >= max) {
+                if (!remove_session_lock(ctx, sess_wheel_oldest(shard), 0))
+                    break;
+                else
+                    ssl_tsan_counter(ctx, &ctx->stats.sess_cache_full);
+            }
+        } else if (SSL_CTX_sess_get_cache_size(ctx) > 0) {
             while (SSL_CTX_sess_number(ctx) >= SSL_CTX_sess_get_cache_size(ctx)) {
                 if (!remove_session_lock(ctx, ctx->session_cache_tail, 0))
                     break;
@@ -770,7 +961,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
         SSL_SESSION_free(s);    /* s == c */
         ret = 0;
     }
-    CRYPTO_THREAD_unlock(ctx->lock);
+    CRYPTO_THREAD_unlock(lock);
     return ret;
 }
 
@@ -782,22 +973,26 @@ int SSL_CTX_remove_session(SSL_CTX *ctx, SSL_SESSION *c)
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck)
 {
     SSL_SESSION *r;
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(SSL_SESSION) *sessions;
     int ret = 0;
 
     if ((c != NULL) && (c->session_id_length != 0)) {
+        lock = sess_cache_lock(ctx, c);
+        sessions = sess_cache_hash(ctx, c);
         if (lck) {
-            if (!CRYPTO_THREAD_write_lock(ctx->lock))
+            if (!CRYPTO_THREAD_write_lock(lock))
                 return 0;
         }
-        if ((r = lh_SSL_SESSION_retrieve(ctx->sessions, c)) != NULL) {
+        if ((r = lh_SSL_SESSION_retrieve(sessions, c)) != NULL) {
             ret = 1;
-            r = lh_SSL_SESSION_delete(ctx->sessions, r);
+            r = lh_SSL_SESSION_delete(sessions, r);
             SSL_SESSION_list_remove(ctx, r);
         }
         c->not_resumable = 1;
 
         if (lck)
-            CRYPTO_THREAD_unlock(ctx->lock);
+            CRYPTO_THREAD_unlock(lock);
 
         if (ctx->remove_session_cb != NULL)
             ctx->remove_session_cb(ctx, c);
@@ -837,6 +1032,7 @@ void SSL_SESSION_free(SSL_SESSION *ss)
     OPENSSL_free(ss->srp_username);
 #endif
     OPENSSL_free(ss->ext.alpn_selected);
+    OPENSSL_free(ss->ext.quic_tparams);
     OPENSSL_free(ss->ticket_appdata);
     CRYPTO_FREE_REF(&ss->references);
     OPENSSL_clear_free(ss, sizeof(*ss));
@@ -897,12 +1093,16 @@ long SSL_SESSION_set_timeout(SSL_SESSION *s, long t)
     if (s == NULL || t < 0)
         return 0;
     if (s->owner != NULL) {
-        if (!CRYPTO_THREAD_write_lock(s->owner->lock))
+        SSL_CTX *owner = s->owner;
+        CRYPTO_RWLOCK *lock = sess_cache_lock(owner, s);
+
+        if (!CRYPTO_THREAD_write_lock(lock))
             return 0;
+        SSL_SESSION_list_remove(owner, s);
         s->timeout = new_timeout;
         ssl_session_calculate_timeout(s);
-        SSL_SESSION_list_add(s->owner, s);
-        CRYPTO_THREAD_unlock(s->owner->lock);
+        SSL_SESSION_list_add(owner, s);
+        CRYPTO_THREAD_unlock(lock);
     } else {
         s->timeout = new_timeout;
         ssl_session_calculate_timeout(s);
@@ -931,12 +1131,16 @@ long SSL_SESSION_set_time(SSL_SESSION *s, long t)
     if (s == NULL)
         return 0;
     if (s->owner != NULL) {
-        if (!CRYPTO_THREAD_write_lock(s->owner->lock))
+        SSL_CTX *owner = s->owner;
+        CRYPTO_RWLOCK *lock = sess_cache_lock(owner, s);
+
+        if (!CRYPTO_THREAD_write_lock(lock))
             return 0;
+        SSL_SESSION_list_remove(owner, s);
         s->time = new_time;
         ssl_session_calculate_timeout(s);
-        SSL_SESSION_list_add(s->owner, s);
-        CRYPTO_THREAD_unlock(s->owner->lock);
+        SSL_SESSION_list_add(owner, s);
+        CRYPTO_THREAD_unlock(lock);
     } else {
         s->time = new_time;
         ssl_session_calculate_timeout(s);
@@ -1149,6 +1353,55 @@ int SSL_set_session_ticket_ext(SSL *s, void *ext_data, int ext_len)
     return 0;
 }
 
+/*
+ * Flushes the sessions that have timed out by |t| from one shard of a sharded
+ * session cache, or all of them if |t| is 0.  The sessions are pushed on |sk|
+ * to be freed by the caller outside the lock.
+ */
+static void flush_shard(SSL_CTX *s, SSL_SESS_SHARD *shard, long t,
+                        STACK_OF(SSL_SESSION) *sk)
+{
+    SSL_SESSION *current, *next;
+    const OSSL_TIME timeout = ossl_time_from_time_t(t);
+    uint64_t sec, last;
+
+    if (!CRYPTO_THREAD_write_lock(shard->lock))
+        return;
+
+    /*
+     * Only the buckets for the seconds since the last flush can hold sessions
+     * that have timed out since, unless the wheel has gone all the way round.
+     */
+    if (t <= 0 || (uint64_t)t < shard->flushed
+            || (uint64_t)t - shard->flushed >= SSL_SESS_CACHE_WHEEL_SLOTS) {
+        sec = 0;
+        last = SSL_SESS_CACHE_WHEEL_SLOTS - 1;
+    } else {
+        sec = shard->flushed;
+        last = (uint64_t)t;
+    }
+
+    for (; sec <= last; sec++) {
+        next = shard->wheel[sec % SSL_SESS_CACHE_WHEEL_SLOTS];
+        while ((current = next) != NULL) {
+            next = current->next;
+            if (t != 0 && !sess_timedout(timeout, current))
+                continue;
+            lh_SSL_SESSION_delete(shard->sessions, current);
+            sess_wheel_remove(shard, current);
+            current->not_resumable = 1;
+            if (s->remove_session_cb != NULL)
+                s->remove_session_cb(s, current);
+            if (sk == NULL || !sk_SSL_SESSION_push(sk, current))
+                SSL_SESSION_free(current);
+        }
+    }
+    if (t > 0)
+        shard->flushed = (uint64_t)t;
+
+    CRYPTO_THREAD_unlock(shard->lock);
+}
+
 void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
 {
     STACK_OF(SSL_SESSION) *sk;
@@ -1156,6 +1409,14 @@ void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
     unsigned long i;
     const OSSL_TIME timeout = ossl_time_from_time_t(t);
 
+    if (s->sess_shards != NULL) {
+        sk = sk_SSL_SESSION_new_null();
+        for (i = 0; i < SSL_SESS_CACHE_NUM_SHARDS; i++)
+            flush_shard(s, &s->sess_shards[i], t, sk);
+        sk_SSL_SESSION_pop_free(sk, SSL_SESSION_free);
+        return;
+    }
+
     if (!CRYPTO_THREAD_write_lock(s->lock))
         return;
 
@@ -1213,6 +1474,13 @@ int ssl_clear_bad_session(SSL_CONNECTION *s)
 /* locked by SSL_CTX in the calling function */
 static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
 {
+    SSL_SESS_SHARD *shard = sess_shard(ctx, s);
+
+    if (shard != NULL) {
+        sess_wheel_remove(shard, s);
+        return;
+    }
+
     if ((s->next == NULL) || (s->prev == NULL))
         return;
 
@@ -1244,6 +1512,13 @@ static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
 static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s)
 {
     SSL_SESSION *next;
+    SSL_SESS_SHARD *shard = sess_shard(ctx, s);
+
+    if (shard != NULL) {
+        sess_wheel_remove(shard, s);
+        sess_wheel_add(ctx, shard, s);
+        return;
+    }
 
     if ((s->next != NULL) && (s->prev != NULL))
         SSL_SESSION_list_remove(ctx, s);
@@ -0,0 +1,328 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * A server session cache shared between processes.
+ *
+ * The cache is a table of fixed size slots in an anonymous shared mapping,
+ * created before the server forks its worker processes so that all of them
+ * see it.  Sessions are stored DER encoded, in one of a few slots chosen by
+ * a hash of the session ID, through the new, get and remove session
+ * callbacks of the SSL_CTX.
+ *
+ * No lock is shared between the processes.  Each slot is protected by a
+ * sequence counter instead: a writer claims a slot by atomically making its
+ * counter odd and releases it by making it even again, and a reader copies
+ * a slot out and only uses the copy if the counter was even and unchanged
+ * across the copy.  A writer never waits for anyone, and a reader at worst
+ * misses a session that is being overwritten.
+ *
+ * A process that dies while writing to a slot leaves its counter odd.  The
+ * counter therefore also records when the slot was claimed, and a writer
+ * takes over a slot that has been claimed for longer than any write takes.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "internal/e_os.h"
+#include "ssl_local.h"
+
+/*
+ * The processes only share the memory, so the 64-bit atomic operations must
+ * not be implemented with locks, which would be private to each process.
+ */
+#if defined(OPENSSL_SYS_UNIX) && defined(__ATOMIC_ACQUIRE) \
+    && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && __GCC_ATOMIC_LLONG_LOCK_FREE == 2
+# define SHM_SESS_CACHE
+# include <sys/mman.h>
+# if !defined(MAP_ANON) && defined(MAP_ANONYMOUS)
+#  define MAP_ANON MAP_ANONYMOUS
+# endif
+# ifndef MAP_ANON
+#  undef SHM_SESS_CACHE
+# endif
+#endif
+
+#ifdef SHM_SESS_CACHE
+
+/* Each slot takes one page, which is plenty for a server session */
+# define SHM_SESS_SLOT_SIZE  4096
+# define SHM_SESS_MAX_DER    (SHM_SESS_SLOT_SIZE - 2 * sizeof(uint64_t) \
+                              - 2 * sizeof(uint32_t) \
+                              - SSL_MAX_SSL_SESSION_ID_LENGTH)
+/* The number of slots a session may be stored in */
+# define SHM_SESS_PROBES     4
+/* A slot claimed for longer than this, in seconds, was abandoned */
+# define SHM_SESS_STALE_SECS 10
+
+typedef struct {
+    /*
+     * The time in seconds at which the slot was last claimed in the upper 32
+     * bits, and a counter which is odd while the slot is being written in the
+     * lower 32 bits
+     */
+    uint64_t seq;
+    uint64_t expires;   /* in seconds since the epoch */
+    uint32_t id_len;    /* 0 if the slot is empty */
+    uint32_t der_len;
+    unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    unsigned char der[SHM_SESS_MAX_DER];
+} SHM_SESS_SLOT;
+
+static size_t shm_sess_hash(const unsigned char *id, size_t id_len)
+{
+    uint64_t h = 0xcbf29ce484222325;    /* FNV-1a */
+    size_t i;
+
+    for (i = 0; i < id_len; i++)
+        h = (h ^ id[i]) * 0x100000001b3;
+    return (size_t)h;
+}
+
+static SSL_CTX *shm_sess_ctx(SSL *ssl)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL(ssl);
+
+    if (sc == NULL || sc->session_ctx->shm_sess_slots == NULL)
+        return NULL;
+    return sc->session_ctx;
+}
+
+static SHM_SESS_SLOT *shm_sess_slot(SSL_CTX *ctx, size_t hash, size_t i)
+{
+    return (SHM_SESS_SLOT *)ctx->shm_sess_slots
+        + (hash + i) % ctx->shm_sess_num_slots;
+}
+
+static uint64_t shm_sess_next_seq(uint64_t cur, uint64_t now, uint32_t inc)
+{
+    return ((uint64_t)(uint32_t)now << 32) | (uint32_t)((uint32_t)cur + inc);
+}
+
+/*
+ * Claims |slot| for writing at time |now|, returning the sequence to release
+ * it with.  A slot that another writer claimed too long ago is taken over.
+ */
+static int shm_sess_claim(SHM_SESS_SLOT *slot, uint64_t now, uint64_t *seq)
+{
+    uint64_t cur = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+    uint64_t next;
+
+    if ((cur & 1) == 0)
+        next = shm_sess_next_seq(cur, now, 1);
+    else if ((uint32_t)((uint32_t)now - (uint32_t)(cur >> 32))
+             > SHM_SESS_STALE_SECS)
+        next = shm_sess_next_seq(cur, now, 2);
+    else
+        return 0;
+    if (!__atomic_compare_exchange_n(&slot->seq, &cur, next, 0,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        return 0;
+    /* Make the claim visible before anything written to the slot */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    *seq = next;
+    return 1;
+}
+
+static void shm_sess_release(SHM_SESS_SLOT *slot, uint64_t seq)
+{
+    /* If the slot was taken over from us, it isn't ours to release */
+    (void)__atomic_compare_exchange_n(&slot->seq, &seq, seq + 1, 0,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+
+static int shm_sess_id_eq(const SHM_SESS_SLOT *slot, const unsigned char *id,
+                          size_t id_len)
+{
+    return __atomic_load_n(&slot->id_len, __ATOMIC_RELAXED) == id_len
+        && memcmp(slot->id, id, id_len) == 0;
+}
+
+static int shm_sess_new_cb(SSL *ssl, SSL_SESSION *sess)
+{
+    SSL_CTX *ctx = shm_sess_ctx(ssl);
+    SHM_SESS_SLOT *slot, *victim = NULL;
+    unsigned char *p;
+    uint64_t seq, expires, victim_expires = 0;
+    uint64_t now = ossl_time2seconds(ossl_time_now());
+    size_t hash, i;
+    int der_len;
+
+    if (ctx == NULL || sess->session_id_length == 0)
+        return 0;
+    der_len = i2d_SSL_SESSION(sess, NULL);
+    if (der_len <= 0 || (size_t)der_len > SHM_SESS_MAX_DER)
+        return 0;
+
+    /*
+     * Overwrite the slot holding this session if there is one, otherwise an
+     * empty or expired slot, otherwise the slot that expires first.  This is
+     * only a guess, as other processes may be writing to these slots.
+     */
+    hash = shm_sess_hash(sess->session_id, sess->session_id_length);
+    for (i = 0; i < SHM_SESS_PROBES; i++) {
+        slot = shm_sess_slot(ctx, hash, i);
+        if (shm_sess_id_eq(slot, sess->session_id, sess->session_id_length)) {
+            victim = slot;
+            break;
+        }
+        expires = __atomic_load_n(&slot->expires, __ATOMIC_RELAXED);
+        if (__atomic_load_n(&slot->id_len, __ATOMIC_RELAXED) == 0
+                || expires <= now)
+            expires = 0;
+        if (victim == NULL || expires < victim_expires) {
+            victim = slot;
+            victim_expires = expires;
+        }
+    }
+
+    /* If another process is writing to the slot, let it have it */
+    if (!shm_sess_claim(victim, now, &seq))
+        return 0;
+    __atomic_store_n(&victim->id_len, 0, __ATOMIC_RELAXED);
+    p = victim->der;
+    if (i2d_SSL_SESSION(sess, &p) == der_len) {
+        __atomic_store_n(&victim->der_len, (uint32_t)der_len,
+                         __ATOMIC_RELAXED);
+        __atomic_store_n(&victim->expires,
+                         ossl_time2seconds(sess->calc_timeout),
+                         __ATOMIC_RELAXED);
+        memcpy(victim->id, sess->session_id, sess->session_id_length);
+        __atomic_store_n(&victim->id_len, (uint32_t)sess->session_id_length,
+                         __ATOMIC_RELAXED);
+    }
+    shm_sess_release(victim, seq);
+
+    /* We didn't keep a reference to |sess| */
+    return 0;
+}
+
+static SSL_SESSION *shm_sess_get_cb(SSL *ssl, const unsigned char *id,
+                                    int id_len, int *copy)
+{
+    SSL_CTX *ctx = shm_sess_ctx(ssl);
+    SHM_SESS_SLOT *slot;
+    SSL_SESSION *ret = NULL;
+    unsigned char *der = NULL;
+    const unsigned char *p;
+    uint64_t seq, expires;
+    size_t hash, i, der_len = 0;
+
+    *copy = 0;
+    if (ctx == NULL || id_len <= 0 || id_len > SSL_MAX_SSL_SESSION_ID_LENGTH)
+        return NULL;
+
+    hash = shm_sess_hash(id, (size_t)id_len);
+    for (i = 0; i < SHM_SESS_PROBES && der_len == 0; i++) {
+        slot = shm_sess_slot(ctx, hash, i);
+        seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if ((seq & 1) != 0 || !shm_sess_id_eq(slot, id, (size_t)id_len))
+            continue;
+
+        expires = __atomic_load_n(&slot->expires, __ATOMIC_RELAXED);
+        der_len = __atomic_load_n(&slot->der_len, __ATOMIC_RELAXED);
+        if (expires <= ossl_time2seconds(ossl_time_now())
+                || der_len == 0 || der_len > SHM_SESS_MAX_DER
+                || (der = OPENSSL_malloc(der_len)) == NULL) {
+            der_len = 0;
+            continue;
+        }
+        memcpy(der, slot->der, der_len);
+
+        /* Discard the copy if the slot was written to while we copied it */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq
+                || !shm_sess_id_eq(slot, id, (size_t)id_len)) {
+            OPENSSL_free(der);
+            der = NULL;
+            der_len = 0;
+        }
+    }
+    if (der == NULL)
+        return NULL;
+
+    p = der;
+    ret = d2i_SSL_SESSION_ex(NULL, &p, (long)der_len, ctx->libctx, ctx->propq);
+    OPENSSL_free(der);
+    return ret;
+}
+
+static void shm_sess_remove_cb(SSL_CTX *ctx, SSL_SESSION *sess)
+{
+    SHM_SESS_SLOT *slot;
+    uint64_t seq, now = ossl_time2seconds(ossl_time_now());
+    size_t hash, i;
+
+    if (ctx->shm_sess_slots == NULL || sess->session_id_length == 0)
+        return;
+
+    hash = shm_sess_hash(sess->session_id, sess->session_id_length);
+    for (i = 0; i < SHM_SESS_PROBES; i++) {
+        slot = shm_sess_slot(ctx, hash, i);
+        if (!shm_sess_id_eq(slot, sess->session_id, sess->session_id_length)
+                || !shm_sess_claim(slot, now, &seq))
+            continue;
+        if (shm_sess_id_eq(slot, sess->session_id, sess->session_id_length))
+            __atomic_store_n(&slot->id_len, 0, __ATOMIC_RELAXED);
+        shm_sess_release(slot, seq);
+    }
+}
+
+#endif
+
+void ssl_shm_sess_cache_free(SSL_CTX *ctx)
+{
+#ifdef SHM_SESS_CACHE
+    if (ctx->shm_sess_slots != NULL)
+        munmap(ctx->shm_sess_slots,
+               ctx->shm_sess_num_slots * sizeof(SHM_SESS_SLOT));
+    ctx->shm_sess_slots = NULL;
+    ctx->shm_sess_num_slots = 0;
+#endif
+}
+
+int SSL_CTX_set_shared_session_cache(SSL_CTX *ctx, size_t num_slots)
+{
+#ifdef SHM_SESS_CACHE
+    void *slots;
+
+    if (!__atomic_always_lock_free(sizeof(uint64_t), 0)) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_UNSUPPORTED);
+        return 0;
+    }
+    if (num_slots > SIZE_MAX / sizeof(SHM_SESS_SLOT)) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_INVALID_ARGUMENT);
+        return 0;
+    }
+
+    ssl_shm_sess_cache_free(ctx);
+    if (num_slots == 0) {
+        SSL_CTX_sess_set_new_cb(ctx, NULL);
+        SSL_CTX_sess_set_get_cb(ctx, NULL);
+        SSL_CTX_sess_set_remove_cb(ctx, NULL);
+        return 1;
+    }
+
+    slots = mmap(NULL, num_slots * sizeof(SHM_SESS_SLOT),
+                 PROT_READ | PROT_WRITE, MAP_ANON | MAP_SHARED, -1, 0);
+    if (slots == MAP_FAILED) {
+        ERR_raise_data(ERR_LIB_SYS, get_last_sys_error(), "calling mmap()");
+        return 0;
+    }
+    ctx->shm_sess_slots = slots;
+    ctx->shm_sess_num_slots = num_slots;
+    SSL_CTX_sess_set_new_cb(ctx, shm_sess_new_cb);
+    SSL_CTX_sess_set_get_cb(ctx, shm_sess_get_cb);
+    SSL_CTX_sess_set_remove_cb(ctx, shm_sess_remove_cb);
+    return 1;
+#else
+    ERR_raise(ERR_LIB_SSL, ERR_R_UNSUPPORTED);
+    return 0;
+#endif
+}
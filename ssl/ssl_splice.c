@@ -0,0 +1,79 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * SSL_splice() lives in a file of its own because splice() is only declared
+ * by the C library if _GNU_SOURCE is defined before any system header.
+ */
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+
+#include "ssl_local.h"
+#include "internal/e_os.h"
+#include "internal/ktls.h"
+
+ossl_ssize_t SSL_splice(SSL *s, int fd, size_t size, int flags)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL_ONLY(s);
+#ifdef OPENSSL_KTLS_SPLICE
+    ossl_ssize_t ret;
+#endif
+
+    if (sc == NULL)
+        return -1;
+
+    if (sc->handshake_func == NULL) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_UNINITIALIZED);
+        return -1;
+    }
+
+    if (sc->shutdown & SSL_RECEIVED_SHUTDOWN) {
+        sc->rwstate = SSL_NOTHING;
+        return 0;
+    }
+
+    if (!BIO_get_ktls_recv(sc->rbio)) {
+        ERR_raise(ERR_LIB_SSL, SSL_R_UNINITIALIZED);
+        return -1;
+    }
+
+    /* Anything already read into our buffers must be read with SSL_read() */
+    if (SSL_has_pending(s)) {
+        ERR_raise_data(ERR_LIB_SSL, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                       "data is pending, call SSL_read()");
+        return -1;
+    }
+
+#ifndef OPENSSL_KTLS_SPLICE
+    ERR_raise_data(ERR_LIB_SSL, ERR_R_UNSUPPORTED,
+                   "can't call ktls_splice(), not supported");
+    return -1;
+#else
+    sc->rwstate = SSL_READING;
+    ret = ktls_splice(SSL_get_rfd(s), fd, size, flags);
+    if (ret < 0) {
+        if (get_last_sys_error() == EAGAIN || get_last_sys_error() == EINTR) {
+            BIO_set_retry_read(sc->rbio);
+        } else if (get_last_sys_error() == EINVAL) {
+            /* Not application data: SSL_read() can process the record */
+            sc->rwstate = SSL_NOTHING;
+            ERR_raise_data(ERR_LIB_SSL, SSL_R_UNEXPECTED_RECORD,
+                           "call SSL_read()");
+        } else {
+            sc->rwstate = SSL_NOTHING;
+            ERR_raise_data(ERR_LIB_SYS, get_last_sys_error(),
+                           "calling splice()");
+        }
+        return ret;
+    }
+    sc->rwstate = SSL_NOTHING;
+    return ret;
+#endif
+}
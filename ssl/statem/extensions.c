@@ -1718,7 +1718,8 @@ static int final_early_data(SSL_CONNECTION *s, unsigned int context, int sent)
 
     if (s->max_early_data == 0
             || !s->hit
-            || s->early_data_state != SSL_EARLY_DATA_ACCEPTING
+            || (s->early_data_state != SSL_EARLY_DATA_ACCEPTING
+                && !SSL_IS_QUIC_HANDSHAKE(s))
             || !s->ext.early_data_ok
             || s->hello_retry_request != SSL_HRR_NONE
             || (s->allow_early_data_cb != NULL
@@ -489,7 +489,9 @@ static WRITE_TRAN ossl_statem_client13_write_transition(SSL_CONNECTION *s)
         return WRITE_TRAN_CONTINUE;
 
     case TLS_ST_PENDING_EARLY_DATA_END:
-        if (s->ext.early_data == SSL_EARLY_DATA_ACCEPTED) {
+        /* QUIC does not use EndOfEarlyData (RFC 9001 s. 8.3) */
+        if (s->ext.early_data == SSL_EARLY_DATA_ACCEPTED
+                && !SSL_IS_QUIC_HANDSHAKE(s)) {
             st->hand_state = TLS_ST_CW_END_OF_EARLY_DATA;
             return WRITE_TRAN_CONTINUE;
         }
@@ -1795,10 +1797,12 @@ MSG_PROCESS_RETURN tls_process_server_hello(SSL_CONNECTION *s, PACKET *pkt)
          * immediately. Otherwise we have to defer this until after all possible
          * early data is written. We could just always defer until the last
          * moment except QUIC needs it done at the same time as the read keys
-         * are changed. Since QUIC doesn't do TLS early data or need middlebox
-         * compat this doesn't cause a problem.
+         * are changed. QUIC early data does not go through the TLS record
+         * layer and QUIC never uses middlebox compat, so this doesn't cause a
+         * problem.
          */
-        if (s->early_data_state == SSL_EARLY_DATA_NONE
+        if ((s->early_data_state == SSL_EARLY_DATA_NONE
+             || SSL_IS_QUIC_HANDSHAKE(s))
                 && (s->options & SSL_OP_ENABLE_MIDDLEBOX_COMPAT) == 0
                 && !ssl->method->ssl3_enc->change_cipher_state(s,
                     SSL3_CC_HANDSHAKE | SSL3_CHANGE_CIPHER_CLIENT_WRITE)) {
@@ -2688,7 +2692,7 @@ MSG_PROCESS_RETURN tls_process_new_session_ticket(SSL_CONNECTION *s,
     unsigned int sess_len;
     RAW_EXTENSION *exts = NULL;
     PACKET nonce;
-    EVP_MD *sha256 = NULL;
+    const EVP_MD *sha256;
     SSL_CTX *sctx = SSL_CONNECTION_GET_CTX(s);
 
     PACKET_null_init(&nonce);
@@ -2799,10 +2803,9 @@ MSG_PROCESS_RETURN tls_process_new_session_ticket(SSL_CONNECTION *s,
      * elsewhere in OpenSSL. The session ID is set to the SHA256 hash of the
      * ticket.
      */
-    sha256 = EVP_MD_fetch(sctx->libctx, "SHA2-256", sctx->propq);
+    sha256 = ssl_md(sctx, SSL_MD_SHA256_IDX);
     if (sha256 == NULL) {
-        /* Error is already recorded */
-        SSLfatal_alert(s, SSL_AD_INTERNAL_ERROR);
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR, ERR_R_EVP_LIB);
         goto err;
     }
     /*
@@ -2815,8 +2818,6 @@ MSG_PROCESS_RETURN tls_process_new_session_ticket(SSL_CONNECTION *s,
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, ERR_R_EVP_LIB);
         goto err;
     }
-    EVP_MD_free(sha256);
-    sha256 = NULL;
     s->session->session_id_length = sess_len;
     s->session->not_resumable = 0;
 
@@ -2853,7 +2854,6 @@ MSG_PROCESS_RETURN tls_process_new_session_ticket(SSL_CONNECTION *s,
 
     return MSG_PROCESS_CONTINUE_READING;
  err:
-    EVP_MD_free(sha256);
     OPENSSL_free(exts);
     return MSG_PROCESS_ERROR;
 }
@@ -3796,7 +3796,8 @@ CON_FUNC_RETURN tls_construct_client_certificate(SSL_CONNECTION *s,
      */
     if (SSL_CONNECTION_IS_TLS13(s)
             && SSL_IS_FIRST_HANDSHAKE(s)
-            && (s->early_data_state != SSL_EARLY_DATA_NONE
+            && ((s->early_data_state != SSL_EARLY_DATA_NONE
+                 && !SSL_IS_QUIC_HANDSHAKE(s))
                 || (s->options & SSL_OP_ENABLE_MIDDLEBOX_COMPAT) != 0)
             && (!ssl->method->ssl3_enc->change_cipher_state(s,
                     SSL3_CC_HANDSHAKE | SSL3_CHANGE_CIPHER_CLIENT_WRITE))) {
@@ -3885,7 +3886,8 @@ CON_FUNC_RETURN tls_construct_client_compressed_certificate(SSL_CONNECTION *sc,
      * moment. We need to do it now.
      */
     if (SSL_IS_FIRST_HANDSHAKE(sc)
-            && (sc->early_data_state != SSL_EARLY_DATA_NONE
+            && ((sc->early_data_state != SSL_EARLY_DATA_NONE
+                 && !SSL_IS_QUIC_HANDSHAKE(sc))
                 || (sc->options & SSL_OP_ENABLE_MIDDLEBOX_COMPAT) != 0)
             && (!ssl->method->ssl3_enc->change_cipher_state(sc,
                     SSL3_CC_HANDSHAKE | SSL3_CHANGE_CIPHER_CLIENT_WRITE))) {
@@ -2297,7 +2297,8 @@ SSL_TICKET_STATUS tls_decrypt_ticket(SSL_CONNECTION *s,
         if (rv == 2)
             renew_ticket = 1;
     } else {
-        EVP_CIPHER *aes256cbc = NULL;
+        const EVP_CIPHER *aes256cbc
+            = sctx->ssl_cipher_methods[SSL_ENC_AES256_IDX];
 
         /* Check key name matches */
         if (memcmp(etick, tctx->ext.tick_key_name,
@@ -2306,8 +2307,6 @@ SSL_TICKET_STATUS tls_decrypt_ticket(SSL_CONNECTION *s,
             goto end;
         }
 
-        aes256cbc = EVP_CIPHER_fetch(sctx->libctx, "AES-256-CBC",
-                                     sctx->propq);
         if (aes256cbc == NULL
             || ssl_hmac_init(hctx, tctx->ext.secure->tick_hmac_key,
                              sizeof(tctx->ext.secure->tick_hmac_key),
@@ -2315,11 +2314,9 @@ SSL_TICKET_STATUS tls_decrypt_ticket(SSL_CONNECTION *s,
             || EVP_DecryptInit_ex(ctx, aes256cbc, NULL,
                                   tctx->ext.secure->tick_aes_key,
                                   etick + TLSEXT_KEYNAME_LENGTH) <= 0) {
-            EVP_CIPHER_free(aes256cbc);
             ret = SSL_TICKET_FATAL_ERR_OTHER;
             goto end;
         }
-        EVP_CIPHER_free(aes256cbc);
         if (SSL_CONNECTION_IS_TLS13(s))
             renew_ticket = 1;
     }
@@ -3882,7 +3879,6 @@ uint8_t SSL_SESSION_get_max_fragment_length(const SSL_SESSION *session)
 SSL_HMAC *ssl_hmac_new(const SSL_CTX *ctx)
 {
     SSL_HMAC *ret = OPENSSL_zalloc(sizeof(*ret));
-    EVP_MAC *mac = NULL;
 
     if (ret == NULL)
         return NULL;
@@ -3894,14 +3890,12 @@ SSL_HMAC *ssl_hmac_new(const SSL_CTX *ctx)
         return ret;
     }
 #endif
-    mac = EVP_MAC_fetch(ctx->libctx, "HMAC", ctx->propq);
-    if (mac == NULL || (ret->ctx = EVP_MAC_CTX_new(mac)) == NULL)
+    if (ctx->ssl_hmac == NULL
+            || (ret->ctx = EVP_MAC_CTX_new(ctx->ssl_hmac)) == NULL)
         goto err;
-    EVP_MAC_free(mac);
     return ret;
  err:
     EVP_MAC_CTX_free(ret->ctx);
-    EVP_MAC_free(mac);
     OPENSSL_free(ret);
     return NULL;
 }
@@ -24,19 +24,18 @@ static const unsigned char label_prefix[] = "\x74\x6C\x73\x31\x33\x20";
 /*
  * Given a |secret|; a |label| of length |labellen|; and |data| of length
  * |datalen| (e.g. typically a hash of the handshake messages), derive a new
- * secret |outlen| bytes long and store it in the location pointed to be |out|.
- * The |data| value may be zero length. Any errors will be treated as fatal if
- * |fatal| is set. Returns 1 on success  0 on failure.
+ * secret |outlen| bytes long using the TLS1-3-KDF |kdf| and store it in the
+ * location pointed to be |out|. The |data| value may be zero length.
+ * Returns 1 on success  0 on failure.
  * If |raise_error| is set, ERR_raise is called on failure.
  */
-int tls13_hkdf_expand_ex(OSSL_LIB_CTX *libctx, const char *propq,
-                         const EVP_MD *md,
-                         const unsigned char *secret,
-                         const unsigned char *label, size_t labellen,
-                         const unsigned char *data, size_t datalen,
-                         unsigned char *out, size_t outlen, int raise_error)
+static int tls13_hkdf_expand_kdf(EVP_KDF *kdf, const EVP_MD *md,
+                                 const unsigned char *secret,
+                                 const unsigned char *label, size_t labellen,
+                                 const unsigned char *data, size_t datalen,
+                                 unsigned char *out, size_t outlen,
+                                 int raise_error)
 {
-    EVP_KDF *kdf = EVP_KDF_fetch(libctx, OSSL_KDF_NAME_TLS1_3_KDF, propq);
     EVP_KDF_CTX *kctx;
     OSSL_PARAM params[7], *p = params;
     int mode = EVP_PKEY_HKDEF_MODE_EXPAND_ONLY;
@@ -45,7 +44,6 @@ int tls13_hkdf_expand_ex(OSSL_LIB_CTX *libctx, const char *propq,
     size_t hashlen;
 
     kctx = EVP_KDF_CTX_new(kdf);
-    EVP_KDF_free(kdf);
     if (kctx == NULL)
         return 0;
 
@@ -96,6 +94,30 @@ int tls13_hkdf_expand_ex(OSSL_LIB_CTX *libctx, const char *propq,
     return ret == 0;
 }
 
+/*
+ * As tls13_hkdf_expand_kdf(), but fetching the KDF from |libctx|, for callers
+ * that don't have an SSL_CTX.
+ */
+int tls13_hkdf_expand_ex(OSSL_LIB_CTX *libctx, const char *propq,
+                         const EVP_MD *md,
+                         const unsigned char *secret,
+                         const unsigned char *label, size_t labellen,
+                         const unsigned char *data, size_t datalen,
+                         unsigned char *out, size_t outlen, int raise_error)
+{
+    EVP_KDF *kdf = EVP_KDF_fetch(libctx, OSSL_KDF_NAME_TLS1_3_KDF, propq);
+    int ret;
+
+    ret = tls13_hkdf_expand_kdf(kdf, md, secret, label, labellen, data, datalen,
+                                out, outlen, raise_error);
+    EVP_KDF_free(kdf);
+    return ret;
+}
+
+/*
+ * As tls13_hkdf_expand_kdf(), using the KDF pre-fetched in |s|'s SSL_CTX. Any
+ * errors will be treated as fatal if |fatal| is set.
+ */
 int tls13_hkdf_expand(SSL_CONNECTION *s, const EVP_MD *md,
                       const unsigned char *secret,
                       const unsigned char *label, size_t labellen,
@@ -105,9 +127,9 @@ int tls13_hkdf_expand(SSL_CONNECTION *s, const EVP_MD *md,
     int ret;
     SSL_CTX *sctx = SSL_CONNECTION_GET_CTX(s);
 
-    ret = tls13_hkdf_expand_ex(sctx->libctx, sctx->propq, md,
-                               secret, label, labellen, data, datalen,
-                               out, outlen, !fatal);
+    ret = tls13_hkdf_expand_kdf(sctx->ssl_kdf_methods[SSL_KDF_TLS1_3_KDF_IDX],
+                                md, secret, label, labellen, data, datalen,
+                                out, outlen, !fatal);
     if (ret == 0 && fatal)
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
 
@@ -169,7 +191,6 @@ int tls13_generate_secret(SSL_CONNECTION *s, const EVP_MD *md,
     size_t mdlen;
     int mdleni;
     int ret;
-    EVP_KDF *kdf;
     EVP_KDF_CTX *kctx;
     OSSL_PARAM params[7], *p = params;
     int mode = EVP_PKEY_HKDEF_MODE_EXTRACT_ONLY;
@@ -178,9 +199,7 @@ int tls13_generate_secret(SSL_CONNECTION *s, const EVP_MD *md,
     static const char derived_secret_label[] = "\x64\x65\x72\x69\x76\x65\x64";
     SSL_CTX *sctx = SSL_CONNECTION_GET_CTX(s);
 
-    kdf = EVP_KDF_fetch(sctx->libctx, OSSL_KDF_NAME_TLS1_3_KDF, sctx->propq);
-    kctx = EVP_KDF_CTX_new(kdf);
-    EVP_KDF_free(kdf);
+    kctx = EVP_KDF_CTX_new(sctx->ssl_kdf_methods[SSL_KDF_TLS1_3_KDF_IDX]);
     if (kctx == NULL) {
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
         return 0;
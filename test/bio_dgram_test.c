@@ -10,6 +10,7 @@
 #include <string.h>
 #include <openssl/bio.h>
 #include <openssl/rand.h>
+#include <openssl/err.h>
 #include "testutil.h"
 #include "internal/sockets.h"
 #include "internal/bio_addr.h"
@@ -452,6 +453,132 @@ static int test_bio_dgram(int idx)
                                bio_dgram_cases[idx].local);
 }
 
+#define SEG_TEST_SEG_LEN        1200
+
+/* Test UDP segmentation offload over the loopback interface. */
+static int test_bio_dgram_segment_offload(void)
+{
+    int testresult = 0;
+    BIO *b1 = NULL, *b2 = NULL;
+    int fd1 = -1, fd2 = -1;
+    BIO_ADDR *addr1 = NULL, *addr2 = NULL;
+    struct in_addr ina;
+    union BIO_sock_info_u info2 = {0};
+    unsigned char *tx_buf = NULL, *rx_buf = NULL;
+    BIO_MSG msg[1];
+    size_t i, off, len, tx_len = 10 * SEG_TEST_SEG_LEN + 500;
+    size_t num_processed;
+    uint32_t cap;
+
+    ina.s_addr = htonl(0x7f000001UL);
+
+    if (!TEST_ptr(addr1 = BIO_ADDR_new())
+        || !TEST_ptr(addr2 = BIO_ADDR_new())
+        || !TEST_int_eq(BIO_ADDR_rawmake(addr1, AF_INET, &ina, sizeof(ina), 0), 1)
+        || !TEST_int_eq(BIO_ADDR_rawmake(addr2, AF_INET, &ina, sizeof(ina), 0), 1)
+        || !TEST_ptr(tx_buf = OPENSSL_malloc(65535))
+        || !TEST_ptr(rx_buf = OPENSSL_malloc(65535)))
+        goto err;
+
+    for (i = 0; i < 65535; ++i)
+        tx_buf[i] = (unsigned char)(i % 251);
+
+    fd1 = BIO_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP, 0);
+    fd2 = BIO_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP, 0);
+    if (!TEST_int_ge(fd1, 0) || !TEST_int_ge(fd2, 0)
+        || !TEST_int_gt(BIO_bind(fd1, addr1, 0), 0)
+        || !TEST_int_gt(BIO_bind(fd2, addr2, 0), 0))
+        goto err;
+
+    info2.addr = addr2;
+    if (!TEST_int_gt(BIO_sock_info(fd2, BIO_SOCK_INFO_ADDRESS, &info2), 0)
+        || !TEST_ptr(b1 = BIO_new_dgram(fd1, 0))
+        || !TEST_ptr(b2 = BIO_new_dgram(fd2, 0)))
+        goto err;
+
+    cap = BIO_dgram_get_segment_offload_cap(b1);
+    if ((cap & BIO_DGRAM_SEGMENT_OFFLOAD_TX) == 0
+        || (cap & BIO_DGRAM_SEGMENT_OFFLOAD_RX) == 0) {
+        testresult = TEST_skip("UDP segmentation offload is not supported");
+        goto err;
+    }
+
+    /* Nothing is enabled by default */
+    if (!TEST_uint_eq(BIO_dgram_get_segment_offload(b1), 0)
+        || !TEST_true(BIO_dgram_set_segment_offload(b1,
+                                                    BIO_DGRAM_SEGMENT_OFFLOAD_TX))
+        || !TEST_uint_eq(BIO_dgram_get_segment_offload(b1),
+                         BIO_DGRAM_SEGMENT_OFFLOAD_TX))
+        goto err;
+
+    /* Send ten full segments and a shorter one in a single message */
+    memset(msg, 0, sizeof(msg));
+    msg[0].data         = tx_buf;
+    msg[0].data_len     = tx_len;
+    msg[0].peer         = addr2;
+    msg[0].segment_size = SEG_TEST_SEG_LEN;
+    if (!TEST_true(BIO_sendmmsg(b1, msg, sizeof(BIO_MSG), 1, 0, &num_processed))
+        || !TEST_size_t_eq(num_processed, 1)
+        || !TEST_size_t_eq(msg[0].data_len, tx_len))
+        goto err;
+
+    /* Without GRO, they are received as separate datagrams */
+    for (off = 0; off < tx_len; off += len) {
+        len = tx_len - off < SEG_TEST_SEG_LEN ? tx_len - off : SEG_TEST_SEG_LEN;
+        memset(msg, 0, sizeof(msg));
+        msg[0].data     = rx_buf;
+        msg[0].data_len = 65535;
+        if (!TEST_true(BIO_recvmmsg(b2, msg, sizeof(BIO_MSG), 1, 0,
+                                    &num_processed))
+            || !TEST_size_t_eq(num_processed, 1)
+            || !TEST_mem_eq(rx_buf, msg[0].data_len, tx_buf + off, len)
+            || !TEST_size_t_eq(msg[0].segment_size, 0))
+            goto err;
+    }
+
+    /* With GRO, they may be received as a single message again */
+    if (!TEST_true(BIO_dgram_set_segment_offload(b2,
+                                                 BIO_DGRAM_SEGMENT_OFFLOAD_RX)))
+        goto err;
+
+    memset(msg, 0, sizeof(msg));
+    msg[0].data         = tx_buf;
+    msg[0].data_len     = tx_len;
+    msg[0].peer         = addr2;
+    msg[0].segment_size = SEG_TEST_SEG_LEN;
+    if (!TEST_true(BIO_sendmmsg(b1, msg, sizeof(BIO_MSG), 1, 0, &num_processed))
+        || !TEST_size_t_eq(num_processed, 1))
+        goto err;
+
+    for (off = 0; off < tx_len; off += msg[0].data_len) {
+        memset(msg, 0, sizeof(msg));
+        msg[0].data     = rx_buf;
+        msg[0].data_len = 65535;
+        if (!TEST_true(BIO_recvmmsg(b2, msg, sizeof(BIO_MSG), 1, 0,
+                                    &num_processed))
+            || !TEST_size_t_eq(num_processed, 1)
+            || !TEST_mem_eq(rx_buf, msg[0].data_len,
+                            tx_buf + off, msg[0].data_len)
+            || (msg[0].segment_size != 0
+                && !TEST_size_t_eq(msg[0].segment_size, SEG_TEST_SEG_LEN)))
+            goto err;
+    }
+
+    testresult = 1;
+err:
+    BIO_free(b1);
+    BIO_free(b2);
+    if (fd1 >= 0)
+        BIO_closesocket(fd1);
+    if (fd2 >= 0)
+        BIO_closesocket(fd2);
+    BIO_ADDR_free(addr1);
+    BIO_ADDR_free(addr2);
+    OPENSSL_free(tx_buf);
+    OPENSSL_free(rx_buf);
+    return testresult;
+}
+
 # if !defined(OPENSSL_NO_CHACHA)
 static int random_data(const uint32_t *key, uint8_t *data, size_t data_len, size_t offset)
 {
@@ -785,6 +912,7 @@ int setup_tests(void)
 
 #if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
     ADD_ALL_TESTS(test_bio_dgram, OSSL_NELEM(bio_dgram_cases));
+    ADD_TEST(test_bio_dgram_segment_offload);
 # if !defined(OPENSSL_NO_CHACHA)
     ADD_ALL_TESTS(test_bio_dgram_pair, 3);
 # endif
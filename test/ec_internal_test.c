@@ -433,6 +433,42 @@ end:
     return testresult;
 }
 
+static const int mul_multi_nids[] = {
+    NID_X9_62_prime256v1, NID_secp384r1, NID_secp521r1
+};
+
+/*
+ * Multi-buffer multiplication may use tables for the standard generator, so
+ * it must not be offered for a named curve with a different generator.
+ */
+static int mul_multi_generator_test(int idx)
+{
+    EC_GROUP *group = NULL;
+    EC_POINT *g2 = NULL;
+    BN_CTX *ctx = NULL;
+    int testresult = 0;
+
+    if (!TEST_ptr(ctx = BN_CTX_new())
+        || !TEST_ptr(group = EC_GROUP_new_by_curve_name(mul_multi_nids[idx]))
+        || !TEST_size_t_ge(ossl_ec_group_mul_multi_lanes(group), 1)
+        || !TEST_ptr(g2 = EC_POINT_new(group))
+        || !TEST_true(EC_POINT_dbl(group, g2, EC_GROUP_get0_generator(group),
+                                   ctx))
+        || !TEST_true(EC_GROUP_set_generator(group, g2,
+                                             EC_GROUP_get0_order(group),
+                                             EC_GROUP_get0_cofactor(group)))
+        || !TEST_int_eq(EC_GROUP_get_curve_name(group), mul_multi_nids[idx])
+        || !TEST_size_t_eq(ossl_ec_group_mul_multi_lanes(group), 1))
+        goto err;
+
+    testresult = 1;
+ err:
+    EC_POINT_free(g2);
+    EC_GROUP_free(group);
+    BN_CTX_free(ctx);
+    return testresult;
+}
+
 int setup_tests(void)
 {
     crv_len = EC_get_builtin_curves(NULL, 0);
@@ -452,6 +488,7 @@ int setup_tests(void)
     ADD_TEST(set_private_key);
     ADD_TEST(decoded_flag_test);
     ADD_ALL_TESTS(ecpkparams_i2d2i_test, crv_len);
+    ADD_ALL_TESTS(mul_multi_generator_test, OSSL_NELEM(mul_multi_nids));
 
     return 1;
 }
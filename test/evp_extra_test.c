@@ -28,6 +28,7 @@
 #include <openssl/dsa.h>
 #include <openssl/dh.h>
 #include <openssl/aes.h>
+#include <openssl/async.h>
 #include <openssl/decoder.h>
 #include <openssl/rsa.h>
 #include <openssl/engine.h>
@@ -38,6 +39,10 @@
 #include "crypto/evp.h"
 #include "fake_rsaprov.h"
 
+#if defined(OPENSSL_SYS_UNIX)
+# include <poll.h>
+#endif
+
 #ifdef STATIC_LEGACY
 OSSL_provider_init_fn ossl_legacy_provider_init;
 #endif
@@ -3730,6 +3735,78 @@ err:
 }
 #endif
 
+#if !defined(OPENSSL_NO_EC) || !defined(OPENSSL_NO_ECX)
+/*
+ * Resumes paused ASYNC jobs until all of them have finished. With |use_fds|
+ * set, a job is only resumed once its wait fd is readable, as it would be
+ * by an event loop, so a job that pauses without waking its caller fails
+ * the test instead of being resumed anyway.
+ */
+static int resume_async_jobs(ASYNC_JOB **jobs, ASYNC_WAIT_CTX **waitctxs,
+                             size_t num, int (*func)(void *), int use_fds)
+{
+    size_t i, numfds, pending = 0;
+    int funcret, ret, testresult = 0;
+# if defined(OPENSSL_SYS_UNIX)
+    struct pollfd *pfds = NULL;
+
+    if (use_fds && !TEST_ptr(pfds = OPENSSL_zalloc(num * sizeof(*pfds))))
+        return 0;
+# else
+    if (!TEST_false(use_fds))
+        return 0;
+# endif
+
+    for (i = 0; i < num; i++)
+        if (jobs[i] != NULL)
+            pending++;
+
+    while (pending > 0) {
+# if defined(OPENSSL_SYS_UNIX)
+        if (use_fds) {
+            for (i = 0; i < num; i++) {
+                pfds[i].fd = -1;
+                pfds[i].events = POLLIN;
+                pfds[i].revents = 0;
+                if (jobs[i] == NULL)
+                    continue;
+                if (!TEST_true(ASYNC_WAIT_CTX_get_all_fds(waitctxs[i], NULL,
+                                                          &numfds))
+                        || !TEST_size_t_eq(numfds, 1)
+                        || !TEST_true(ASYNC_WAIT_CTX_get_all_fds(waitctxs[i],
+                                                                 &pfds[i].fd,
+                                                                 &numfds)))
+                    goto err;
+            }
+            if (!TEST_int_gt(poll(pfds, num, 10000), 0))
+                goto err;
+        }
+# endif
+        for (i = 0; i < num; i++) {
+            if (jobs[i] == NULL)
+                continue;
+# if defined(OPENSSL_SYS_UNIX)
+            if (use_fds && (pfds[i].revents & POLLIN) == 0)
+                continue;
+# endif
+            ret = ASYNC_start_job(&jobs[i], waitctxs[i], &funcret, func,
+                                  NULL, 0);
+            if (ret == ASYNC_FINISH)
+                pending--;
+            else if (!TEST_int_eq(ret, ASYNC_PAUSE))
+                goto err;
+        }
+    }
+
+    testresult = 1;
+ err:
+# if defined(OPENSSL_SYS_UNIX)
+    OPENSSL_free(pfds);
+# endif
+    return testresult;
+}
+#endif
+
 #ifndef OPENSSL_NO_EC
 static int ecpub_nids[] = {
     NID_brainpoolP256r1, NID_X9_62_prime256v1,
@@ -3804,6 +3881,118 @@ static int test_ecpub(int idx)
 # endif
     return ret;
 }
+
+# define ECDSA_ASYNC_JOBS 11
+
+typedef struct {
+    EVP_PKEY *pkey;
+    unsigned char tbs[32];
+    unsigned char sig[256];
+    size_t siglen;
+    int sign_ret, verify_ret, bad_verify_ret;
+} ECDSA_SIGNVERIFY_ARGS;
+
+static int ecdsa_signverify_job(void *arg)
+{
+    ECDSA_SIGNVERIFY_ARGS *args = *(ECDSA_SIGNVERIFY_ARGS **)arg;
+    EVP_PKEY_CTX *ctx;
+
+    args->sign_ret = args->verify_ret = args->bad_verify_ret = 0;
+    if ((ctx = EVP_PKEY_CTX_new_from_pkey(testctx, args->pkey,
+                                          testpropq)) == NULL)
+        return 0;
+    args->siglen = sizeof(args->sig);
+    if (EVP_PKEY_sign_init(ctx) > 0)
+        args->sign_ret = EVP_PKEY_sign(ctx, args->sig, &args->siglen,
+                                       args->tbs, sizeof(args->tbs));
+    if (args->sign_ret > 0 && EVP_PKEY_verify_init(ctx) > 0) {
+        args->verify_ret = EVP_PKEY_verify(ctx, args->sig, args->siglen,
+                                           args->tbs, sizeof(args->tbs));
+        args->tbs[0] ^= 1;
+        args->bad_verify_ret = EVP_PKEY_verify(ctx, args->sig, args->siglen,
+                                               args->tbs, sizeof(args->tbs));
+        args->tbs[0] ^= 1;
+    }
+    EVP_PKEY_CTX_free(ctx);
+    return 1;
+}
+
+static const char *ecdsa_async_curves[] = { "P-256", "P-384", "P-521" };
+
+/*
+ * ECDSA signatures created or verified inside ASYNC jobs may be queued and
+ * computed together. Check that they verify normally, and that a corrupted
+ * digest is rejected, also when keys of different curves are mixed. The
+ * second half of the iterations only resumes the paused jobs through their
+ * wait fds.
+ */
+static int test_ecdsa_async_signverify(int idx)
+{
+    size_t ncurves = OSSL_NELEM(ecdsa_async_curves);
+    const char *curve = ecdsa_async_curves[idx % ncurves];
+    const char *other = ecdsa_async_curves[(idx + 1) % ncurves];
+    int use_fds = (size_t)idx >= ncurves;
+    ECDSA_SIGNVERIFY_ARGS args[ECDSA_ASYNC_JOBS], *argp;
+    ASYNC_JOB *jobs[ECDSA_ASYNC_JOBS] = { NULL };
+    ASYNC_WAIT_CTX *waitctxs[ECDSA_ASYNC_JOBS] = { NULL };
+    EVP_PKEY_CTX *ctx = NULL;
+    size_t i;
+    int funcret, ret, testresult = 0;
+
+    if (!ASYNC_is_capable())
+        return TEST_skip("ASYNC is not supported");
+# if !defined(OPENSSL_SYS_UNIX)
+    if (use_fds)
+        return TEST_skip("Waiting on ASYNC fds is not supported");
+# endif
+
+    memset(args, 0, sizeof(args));
+    for (i = 0; i < ECDSA_ASYNC_JOBS; i++) {
+        if (!TEST_ptr(args[i].pkey = EVP_PKEY_Q_keygen(testctx, testpropq,
+                                                       "EC", i == 5 ? other
+                                                                    : curve))
+                || !TEST_ptr(waitctxs[i] = ASYNC_WAIT_CTX_new()))
+            goto err;
+        memset(args[i].tbs, (int)i + 1, sizeof(args[i].tbs));
+    }
+
+    for (i = 0; i < ECDSA_ASYNC_JOBS; i++) {
+        argp = &args[i];
+        ret = ASYNC_start_job(&jobs[i], waitctxs[i], &funcret,
+                              ecdsa_signverify_job, &argp, sizeof(argp));
+        if (ret != ASYNC_PAUSE && !TEST_int_eq(ret, ASYNC_FINISH))
+            goto err;
+    }
+    if (!TEST_true(resume_async_jobs(jobs, waitctxs, ECDSA_ASYNC_JOBS,
+                                     ecdsa_signverify_job, use_fds)))
+        goto err;
+
+    for (i = 0; i < ECDSA_ASYNC_JOBS; i++) {
+        if (!TEST_int_gt(args[i].sign_ret, 0)
+                || !TEST_int_eq(args[i].verify_ret, 1)
+                || !TEST_int_le(args[i].bad_verify_ret, 0)
+                || !TEST_ptr(ctx = EVP_PKEY_CTX_new_from_pkey(testctx,
+                                                              args[i].pkey,
+                                                              testpropq))
+                || !TEST_int_gt(EVP_PKEY_verify_init(ctx), 0)
+                || !TEST_int_eq(EVP_PKEY_verify(ctx, args[i].sig,
+                                                args[i].siglen, args[i].tbs,
+                                                sizeof(args[i].tbs)), 1))
+            goto err;
+        EVP_PKEY_CTX_free(ctx);
+        ctx = NULL;
+    }
+
+    testresult = 1;
+ err:
+    for (i = 0; i < ECDSA_ASYNC_JOBS; i++) {
+        EVP_PKEY_free(args[i].pkey);
+        ASYNC_WAIT_CTX_free(waitctxs[i]);
+    }
+    EVP_PKEY_CTX_free(ctx);
+    ERR_clear_error();
+    return testresult;
+}
 #endif
 
 static int test_EVP_rsa_pss_with_keygen_bits(void)
@@ -5271,6 +5460,437 @@ static int test_ecx_not_private_key(int tst)
 
     return testresult;
 }
+
+/*
+ * Test batch verification of Ed25519 signatures, including batches that
+ * span more than one internal group and batches with invalid members.
+ */
+static int test_ed25519_verify_batch(int tst)
+{
+    size_t num = tst == 0 ? 7 : 300;
+    EVP_PKEY *pkey = NULL;
+    EVP_MD_CTX *ctx = NULL;
+    unsigned char *sigbuf = NULL, *msgbuf = NULL;
+    const unsigned char **sigs = NULL, **tbs = NULL;
+    size_t *siglens = NULL, *tbslens = NULL, i;
+    int *results = NULL;
+    int testresult = 0;
+
+    if (!TEST_ptr(pkey = load_example_key("ED25519", kExampleED25519KeyDER,
+                                          sizeof(kExampleED25519KeyDER)))
+            || !TEST_ptr(ctx = EVP_MD_CTX_new())
+            || !TEST_ptr(sigbuf = OPENSSL_malloc(num * 64))
+            || !TEST_ptr(msgbuf = OPENSSL_malloc(num * 4))
+            || !TEST_ptr(sigs = OPENSSL_malloc(num * sizeof(*sigs)))
+            || !TEST_ptr(tbs = OPENSSL_malloc(num * sizeof(*tbs)))
+            || !TEST_ptr(siglens = OPENSSL_malloc(num * sizeof(*siglens)))
+            || !TEST_ptr(tbslens = OPENSSL_malloc(num * sizeof(*tbslens)))
+            || !TEST_ptr(results = OPENSSL_malloc(num * sizeof(*results))))
+        goto err;
+
+    for (i = 0; i < num; i++) {
+        msgbuf[4 * i] = (unsigned char)i;
+        msgbuf[4 * i + 1] = (unsigned char)(i >> 8);
+        msgbuf[4 * i + 2] = 0x5a;
+        msgbuf[4 * i + 3] = 0xa5;
+        tbs[i] = msgbuf + 4 * i;
+        tbslens[i] = 4;
+        sigs[i] = sigbuf + 64 * i;
+        siglens[i] = 64;
+        if (!TEST_true(EVP_DigestSignInit_ex(ctx, NULL, NULL, testctx,
+                                             testpropq, pkey, NULL))
+                || !TEST_true(EVP_DigestSign(ctx, sigbuf + 64 * i, &siglens[i],
+                                             tbs[i], tbslens[i]))
+                || !TEST_size_t_eq(siglens[i], 64))
+            goto err;
+    }
+
+    if (!TEST_true(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                           testpropq, pkey, NULL))
+            || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, sigs, siglens, tbs,
+                                                  tbslens, num, results), 1))
+        goto err;
+    for (i = 0; i < num; i++)
+        if (!TEST_int_eq(results[i], 1))
+            goto err;
+
+    /* Invalidate a signature, a message and a signature length */
+    sigbuf[64 * (num / 2) + 40] ^= 1;
+    tbslens[num - 1] = 3;
+    siglens[0] = 63;
+    if (!TEST_true(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                           testpropq, pkey, NULL))
+            || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, sigs, siglens, tbs,
+                                                  tbslens, num, results), 0))
+        goto err;
+    for (i = 0; i < num; i++)
+        if (!TEST_int_eq(results[i],
+                         i != 0 && i != num / 2 && i != num - 1))
+            goto err;
+
+    /* The results array is optional */
+    if (!TEST_true(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                           testpropq, pkey, NULL))
+            || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, sigs, siglens, tbs,
+                                                  tbslens, num, NULL), 0))
+        goto err;
+
+    testresult = 1;
+ err:
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    OPENSSL_free(sigbuf);
+    OPENSSL_free(msgbuf);
+    OPENSSL_free(sigs);
+    OPENSSL_free(tbs);
+    OPENSSL_free(siglens);
+    OPENSSL_free(tbslens);
+    OPENSSL_free(results);
+    return testresult;
+}
+
+/*
+ * Helpers to craft Ed25519 signatures with small order components. Points are
+ * handled as their 32-byte encodings, scalars as BIGNUMs reduced mod l.
+ */
+# define ED25519_L_HEX \
+    "1000000000000000000000000000000014DEF9DEA2F79CD65812631A5CF5D3ED"
+
+/* The public key of |seed| and its secret scalar a, so that pub = [a]B */
+static int ed25519_key_from_seed(const unsigned char seed[32],
+                                 unsigned char pub[32], BIGNUM *a,
+                                 const BIGNUM *l, BN_CTX *bnctx)
+{
+    EVP_PKEY *pkey = NULL;
+    unsigned char md[64];
+    size_t len = 32;
+    int ret = 0;
+
+    if (!TEST_ptr(pkey = EVP_PKEY_new_raw_private_key_ex(testctx, "ED25519",
+                                                         testpropq, seed, 32))
+            || !TEST_true(EVP_PKEY_get_raw_public_key(pkey, pub, &len))
+            || !TEST_true(EVP_Q_digest(testctx, "SHA512", testpropq, seed, 32,
+                                       md, NULL)))
+        goto err;
+    md[0] &= 248;
+    md[31] &= 63;
+    md[31] |= 64;
+    ret = TEST_ptr(BN_lebin2bn(md, 32, a))
+          && TEST_true(BN_mod(a, a, l, bnctx));
+ err:
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+
+/* out = in + T2, where T2 = (0, -1) is the point of order 2: (x, y) -> (-x, -y) */
+static int ed25519_add_order2(unsigned char out[32], const unsigned char in[32])
+{
+    unsigned char tmp[32];
+    BIGNUM *p = NULL, *y = NULL;
+    int ret = 0;
+
+    memcpy(tmp, in, 32);
+    tmp[31] &= 0x7f;
+    if (!TEST_ptr(p = BN_new())
+            || !TEST_true(BN_set_bit(p, 255))
+            || !TEST_true(BN_sub_word(p, 19))
+            || !TEST_ptr(y = BN_lebin2bn(tmp, 32, NULL))
+            || !TEST_true(BN_sub(y, p, y))
+            || !TEST_int_eq(BN_bn2lebinpad(y, out, 32), 32))
+        goto err;
+    out[31] |= ~in[31] & 0x80;
+    ret = 1;
+ err:
+    BN_free(p);
+    BN_free(y);
+    return ret;
+}
+
+/* sig = (R, r + H(R || A || msg) * a mod l) */
+static int ed25519_craft_sig(unsigned char sig[64], const unsigned char R[32],
+                             const BIGNUM *r, const unsigned char A[32],
+                             const BIGNUM *a, const unsigned char *msg,
+                             size_t msglen, const BIGNUM *l, BN_CTX *bnctx)
+{
+    EVP_MD_CTX *mdctx = NULL;
+    EVP_MD *sha512 = NULL;
+    unsigned char md[64];
+    BIGNUM *h = NULL;
+    int ret = 0;
+
+    if (!TEST_ptr(mdctx = EVP_MD_CTX_new())
+            || !TEST_ptr(sha512 = EVP_MD_fetch(testctx, "SHA512", testpropq))
+            || !TEST_true(EVP_DigestInit_ex(mdctx, sha512, NULL))
+            || !TEST_true(EVP_DigestUpdate(mdctx, R, 32))
+            || !TEST_true(EVP_DigestUpdate(mdctx, A, 32))
+            || !TEST_true(EVP_DigestUpdate(mdctx, msg, msglen))
+            || !TEST_true(EVP_DigestFinal_ex(mdctx, md, NULL))
+            || !TEST_ptr(h = BN_lebin2bn(md, 64, NULL))
+            || !TEST_true(BN_mod_mul(h, h, a, l, bnctx))
+            || !TEST_true(BN_mod_add(h, h, r, l, bnctx))
+            || !TEST_int_eq(BN_bn2lebinpad(h, sig + 32, 32), 32))
+        goto err;
+    memcpy(sig, R, 32);
+    ret = 1;
+ err:
+    EVP_MD_CTX_free(mdctx);
+    EVP_MD_free(sha512);
+    BN_free(h);
+    return ret;
+}
+
+# define TORSION_SIGS 8
+
+/*
+ * Test that batch verification of Ed25519 signatures with small order
+ * components gives the same result for each signature as EVP_DigestVerify(),
+ * whichever other signatures are in the batch.
+ * Test 0: The neutral element as public key, with R values of small or mixed
+ *         order. The cofactored batch equation accepts all the signatures.
+ * Test 1: A public key of mixed order. The cofactored batch equation accepts
+ *         all the signatures, the cofactorless one about half of them.
+ */
+static int test_ed25519_verify_batch_torsion(int tst)
+{
+    static const unsigned char seed1[32] = { 1 }, seed2[32] = { 2 };
+    unsigned char sigbuf[TORSION_SIGS][64], msgbuf[TORSION_SIGS][4];
+    unsigned char pub[32], A[32], R[32];
+    const unsigned char *sigs[TORSION_SIGS], *tbs[TORSION_SIGS];
+    const unsigned char *bsigs[TORSION_SIGS], *btbs[TORSION_SIGS];
+    size_t siglens[TORSION_SIGS], tbslens[TORSION_SIGS], i, j, k, n;
+    int expected[TORSION_SIGS], results[TORSION_SIGS], all, num_valid = 0;
+    size_t order[TORSION_SIGS];
+    EVP_PKEY *pkey = NULL;
+    EVP_MD_CTX *ctx = NULL;
+    BN_CTX *bnctx = NULL;
+    BIGNUM *l = NULL, *a = NULL, *r = NULL, *zero = NULL;
+    int testresult = 0;
+
+    if (!TEST_ptr(bnctx = BN_CTX_new_ex(testctx))
+            || !TEST_ptr(a = BN_new())
+            || !TEST_ptr(r = BN_new())
+            || !TEST_ptr(zero = BN_new())
+            || !TEST_true(BN_hex2bn(&l, ED25519_L_HEX))
+            || !TEST_true(ed25519_key_from_seed(seed1, pub, a, l, bnctx))
+            || !TEST_true(ed25519_key_from_seed(seed2, R, r, l, bnctx))
+            || !TEST_ptr(ctx = EVP_MD_CTX_new()))
+        goto err;
+    BN_zero(zero);
+
+    for (i = 0; i < TORSION_SIGS; i++) {
+        msgbuf[i][0] = (unsigned char)i;
+        msgbuf[i][1] = (unsigned char)tst;
+        msgbuf[i][2] = 0x5a;
+        msgbuf[i][3] = 0xa5;
+        tbs[i] = msgbuf[i];
+        tbslens[i] = sizeof(msgbuf[i]);
+        sigs[i] = sigbuf[i];
+        siglens[i] = sizeof(sigbuf[i]);
+    }
+
+    if (tst == 0) {
+        /*
+         * With A the neutral element, (R, s) is valid if and only if
+         * R = [s]B. The signatures alternate between R = O with s = 0,
+         * R = T2 (of order 2) with s = 0, R = [a]B with s = a and
+         * R = [a]B + T2 with s = a.
+         */
+        memset(A, 0, sizeof(A));
+        A[0] = 1;
+        for (i = 0; i < TORSION_SIGS; i++) {
+            const BIGNUM *s = (i & 2) != 0 ? a : zero;
+
+            memcpy(R, (i & 2) != 0 ? pub : A, sizeof(R));
+            if ((i & 1) != 0 && !ed25519_add_order2(R, R))
+                goto err;
+            if (!ed25519_craft_sig(sigbuf[i], R, s, A, zero, tbs[i],
+                                   tbslens[i], l, bnctx))
+                goto err;
+        }
+    } else {
+        /* A = [a]B + T2, and R = [r]B: valid if and only if h is even */
+        if (!ed25519_add_order2(A, pub))
+            goto err;
+        for (i = 0; i < TORSION_SIGS; i++)
+            if (!ed25519_craft_sig(sigbuf[i], R, r, A, a, tbs[i], tbslens[i],
+                                   l, bnctx))
+                goto err;
+    }
+
+    if (!TEST_ptr(pkey = EVP_PKEY_new_raw_public_key_ex(testctx, "ED25519",
+                                                        testpropq, A,
+                                                        sizeof(A))))
+        goto err;
+
+    for (i = 0; i < TORSION_SIGS; i++) {
+        if (!TEST_true(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                               testpropq, pkey, NULL)))
+            goto err;
+        expected[i] = EVP_DigestVerify(ctx, sigs[i], siglens[i], tbs[i],
+                                       tbslens[i]) == 1;
+        num_valid += expected[i];
+    }
+    ERR_clear_error();
+    /* Make sure that there is something to tell apart */
+    if (!TEST_int_gt(num_valid, 0) || !TEST_int_lt(num_valid, TORSION_SIGS))
+        goto err;
+
+    /*
+     * Verify all the signatures in order, in reverse order, and every pair of
+     * them, so that invalid signatures are batched both with valid ones and
+     * with other invalid ones.
+     */
+    for (k = 0; k < 2 + TORSION_SIGS * TORSION_SIGS; k++) {
+        if (k < 2) {
+            n = TORSION_SIGS;
+            for (i = 0; i < n; i++)
+                order[i] = k == 0 ? i : n - 1 - i;
+        } else {
+            n = 2;
+            order[0] = (k - 2) / TORSION_SIGS;
+            order[1] = (k - 2) % TORSION_SIGS;
+        }
+
+        all = 1;
+        for (i = 0; i < n; i++) {
+            bsigs[i] = sigs[order[i]];
+            btbs[i] = tbs[order[i]];
+            all &= expected[order[i]];
+        }
+        if (!TEST_true(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                               testpropq, pkey, NULL))
+                || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, bsigs, siglens,
+                                                      btbs, tbslens, n,
+                                                      results), all))
+            goto err;
+        for (j = 0; j < n; j++)
+            if (!TEST_int_eq(results[j], expected[order[j]])) {
+                TEST_info("signature %zu in batch %zu", order[j], k);
+                goto err;
+            }
+    }
+    ERR_clear_error();
+
+    testresult = 1;
+ err:
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    BN_CTX_free(bnctx);
+    BN_free(l);
+    BN_free(a);
+    BN_free(r);
+    BN_free(zero);
+    return testresult;
+}
+
+# define X25519_ASYNC_JOBS 11
+
+typedef struct {
+    EVP_PKEY_CTX *ctx;
+    unsigned char secret[32];
+    size_t secretlen;
+    int ret;
+} X25519_DERIVE_ARGS;
+
+static int x25519_derive_job(void *arg)
+{
+    X25519_DERIVE_ARGS *args = *(X25519_DERIVE_ARGS **)arg;
+
+    args->secretlen = sizeof(args->secret);
+    args->ret = EVP_PKEY_derive(args->ctx, args->secret, &args->secretlen);
+    return 1;
+}
+
+/*
+ * X25519 derivations performed inside ASYNC jobs may be queued and
+ * computed together. Check that they produce the same results as plain
+ * derivations, including for a peer key of small order. With |idx| 1 the
+ * paused jobs are only resumed through their wait fds.
+ */
+static int test_x25519_async_derive(int idx)
+{
+    static const unsigned char zero_point[32] = { 0 };
+    X25519_DERIVE_ARGS args[X25519_ASYNC_JOBS], *argp;
+    ASYNC_JOB *jobs[X25519_ASYNC_JOBS] = { NULL };
+    ASYNC_WAIT_CTX *waitctxs[X25519_ASYNC_JOBS] = { NULL };
+    EVP_PKEY *job_keys[X25519_ASYNC_JOBS] = { NULL }, *peer = NULL;
+    EVP_PKEY *bad_peer = NULL;
+    unsigned char expected[X25519_ASYNC_JOBS][32];
+    size_t i, len;
+    int funcret, ret, testresult = 0;
+
+    if (!ASYNC_is_capable())
+        return TEST_skip("ASYNC is not supported");
+# if !defined(OPENSSL_SYS_UNIX)
+    if (idx == 1)
+        return TEST_skip("Waiting on ASYNC fds is not supported");
+# endif
+
+    memset(args, 0, sizeof(args));
+    if (!TEST_ptr(peer = EVP_PKEY_Q_keygen(testctx, testpropq, "X25519"))
+            || !TEST_ptr(bad_peer = EVP_PKEY_new_raw_public_key_ex(testctx,
+                                                                   "X25519",
+                                                                   testpropq,
+                                                                   zero_point,
+                                                                   32)))
+        goto err;
+
+    for (i = 0; i < X25519_ASYNC_JOBS; i++) {
+        if (!TEST_ptr(job_keys[i] = EVP_PKEY_Q_keygen(testctx, testpropq,
+                                                      "X25519"))
+                || !TEST_ptr(waitctxs[i] = ASYNC_WAIT_CTX_new())
+                || !TEST_ptr(args[i].ctx =
+                             EVP_PKEY_CTX_new_from_pkey(testctx, job_keys[i],
+                                                        testpropq))
+                || !TEST_int_gt(EVP_PKEY_derive_init(args[i].ctx), 0)
+                || !TEST_int_gt(EVP_PKEY_derive_set_peer_ex(args[i].ctx,
+                                                            i == 3 ? bad_peer
+                                                                   : peer,
+                                                            0), 0))
+            goto err;
+        if (i == 3)
+            continue;
+        len = sizeof(expected[i]);
+        if (!TEST_int_gt(EVP_PKEY_derive(args[i].ctx, expected[i], &len), 0)
+                || !TEST_size_t_eq(len, 32))
+            goto err;
+    }
+
+    for (i = 0; i < X25519_ASYNC_JOBS; i++) {
+        argp = &args[i];
+        ret = ASYNC_start_job(&jobs[i], waitctxs[i], &funcret,
+                              x25519_derive_job, &argp, sizeof(argp));
+        if (ret != ASYNC_PAUSE && !TEST_int_eq(ret, ASYNC_FINISH))
+            goto err;
+    }
+    if (!TEST_true(resume_async_jobs(jobs, waitctxs, X25519_ASYNC_JOBS,
+                                     x25519_derive_job, idx == 1)))
+        goto err;
+
+    for (i = 0; i < X25519_ASYNC_JOBS; i++) {
+        if (i == 3) {
+            if (!TEST_int_le(args[i].ret, 0))
+                goto err;
+            continue;
+        }
+        if (!TEST_int_gt(args[i].ret, 0)
+                || !TEST_mem_eq(args[i].secret, args[i].secretlen,
+                                expected[i], sizeof(expected[i])))
+            goto err;
+    }
+
+    testresult = 1;
+ err:
+    for (i = 0; i < X25519_ASYNC_JOBS; i++) {
+        EVP_PKEY_CTX_free(args[i].ctx);
+        EVP_PKEY_free(job_keys[i]);
+        ASYNC_WAIT_CTX_free(waitctxs[i]);
+    }
+    EVP_PKEY_free(peer);
+    EVP_PKEY_free(bad_peer);
+    ERR_clear_error();
+    return testresult;
+}
 #endif /* OPENSSL_NO_ECX */
 
 static int test_sign_continuation(void)
@@ -5704,6 +6324,8 @@ int setup_tests(void)
     ADD_TEST(test_EVP_rsa_pss_set_saltlen);
 #ifndef OPENSSL_NO_EC
     ADD_ALL_TESTS(test_ecpub, OSSL_NELEM(ecpub_nids));
+    ADD_ALL_TESTS(test_ecdsa_async_signverify,
+                  2 * OSSL_NELEM(ecdsa_async_curves));
 #endif
 
     ADD_TEST(test_names_do_all);
@@ -5739,6 +6361,9 @@ int setup_tests(void)
 #ifndef OPENSSL_NO_ECX
     ADD_ALL_TESTS(test_ecx_short_keys, OSSL_NELEM(ecxnids));
     ADD_ALL_TESTS(test_ecx_not_private_key, OSSL_NELEM(keys));
+    ADD_ALL_TESTS(test_ed25519_verify_batch, 2);
+    ADD_ALL_TESTS(test_ed25519_verify_batch_torsion, 2);
+    ADD_ALL_TESTS(test_x25519_async_derive, 2);
 #endif
 
     ADD_TEST(test_sign_continuation);
@@ -32,6 +32,12 @@ static long noisy_dgram_ctrl(BIO *bio, int cmd, long num, void *ptr)
     case BIO_CTRL_DUP:
         ret = 0L;
         break;
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD_CAP:
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD:
+    case BIO_CTRL_DGRAM_SET_SEGMENT_OFFLOAD:
+        /* We drop and delay single datagrams, which must not be coalesced */
+        ret = 0L;
+        break;
     case BIO_CTRL_NOISE_BACK_OFF: {
             struct noisy_dgram_st *data;
 
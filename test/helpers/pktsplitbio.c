@@ -23,6 +23,12 @@ static long pkt_split_dgram_ctrl(BIO *bio, int cmd, long num, void *ptr)
     case BIO_CTRL_DUP:
         ret = 0L;
         break;
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD_CAP:
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD:
+    case BIO_CTRL_DGRAM_SET_SEGMENT_OFFLOAD:
+        /* We split individual datagrams, so they must not be coalesced */
+        ret = 0L;
+        break;
     default:
         ret = BIO_ctrl(next, cmd, num, ptr);
         break;
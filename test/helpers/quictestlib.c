@@ -1146,6 +1146,12 @@ static long pcipher_ctrl(BIO *b, int cmd, long larg, void *parg)
     if (next == NULL)
         return -1;
 
+    /* Faults are injected into individual datagrams, so do not coalesce them */
+    if (cmd == BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD_CAP
+            || cmd == BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD
+            || cmd == BIO_CTRL_DGRAM_SET_SEGMENT_OFFLOAD)
+        return 0;
+
     return BIO_ctrl(next, cmd, larg, parg);
 }
 
@@ -619,7 +619,9 @@ enum {
     RX_OPK_CHECK_ACKS,       /* check ACK ranges */
     RX_OPK_TX,               /* TX packet */
     RX_OPK_RX_ACK,           /* RX ACK frame */
-    RX_OPK_SKIP_IF_PN_SPACE  /* skip for a given PN space */
+    RX_OPK_SKIP_IF_PN_SPACE, /* skip for a given PN space */
+    RX_OPK_SET_ACK_FREQ,     /* apply ACK_FREQUENCY parameters */
+    RX_OPK_IMMEDIATE_ACK     /* RX IMMEDIATE_ACK frame */
 };
 
 struct rx_test_op {
@@ -692,6 +694,18 @@ struct rx_test_op {
       0, 0, NULL, 0, 0                                              \
     },
 
+#define RX_OP_SET_ACK_FREQ(threshold, reordering_threshold)         \
+    {                                                               \
+      RX_OPK_SET_ACK_FREQ, 0, (threshold), (reordering_threshold),  \
+      0, 0, NULL, 0, 0                                              \
+    },
+
+#define RX_OP_IMMEDIATE_ACK(advance)                                \
+    {                                                               \
+      RX_OPK_IMMEDIATE_ACK, (advance) * OSSL_TIME_MS, 0, 0,         \
+      0, 0, NULL, 0, 0                                              \
+    },
+
 #define RX_OP_END                                                   \
     { RX_OPK_END }
 
@@ -887,11 +901,75 @@ static const struct rx_test_op rx_script_4[] = {
     RX_OP_END
 };
 
+/* RX 5. ACK Frequency Thresholds and IMMEDIATE_ACK (1-RTT) */
+static const OSSL_QUIC_ACK_RANGE rx_ack_ranges_5a[] = {
+    { 0, 0 }
+};
+
+static const OSSL_QUIC_ACK_RANGE rx_ack_ranges_5b[] = {
+    { 0, 4 }
+};
+
+static const OSSL_QUIC_ACK_RANGE rx_ack_ranges_5c[] = {
+    { 7, 7 },
+    { 0, 4 }
+};
+
+static const OSSL_QUIC_ACK_RANGE rx_ack_ranges_5d[] = {
+    { 10, 10 },
+    { 7, 7 },
+    { 0, 4 }
+};
+
+static const struct rx_test_op rx_script_5[] = {
+    /* ACK_FREQUENCY frames are only used in the application PN space. */
+    RX_OP_SKIP_IF_PN_SPACE(QUIC_PN_SPACE_INITIAL)
+    RX_OP_SKIP_IF_PN_SPACE(QUIC_PN_SPACE_HANDSHAKE)
+
+    /* ACK every fourth packet, ignoring reordering. */
+    RX_OP_SET_ACK_FREQ  (3, 0)
+
+    /* First packet always generates an ACK so get it out of the way. */
+    RX_OP_PKT           (0, 0, 1)
+    RX_OP_CHECK_STATE   (0, 1, 0)   /* first packet always causes ACK */
+    RX_OP_CHECK_ACKS    (0, rx_ack_ranges_5a) /* clears packet counter */
+    RX_OP_CHECK_STATE   (0, 0, 0)
+
+    RX_OP_PKT           (0, 1, 3)   /* three packets, threshold is 3 */
+    RX_OP_CHECK_STATE   (0, 0, 1)   /* threshold not yet exceeded */
+    RX_OP_PKT           (0, 4, 1)   /* fourth packet exceeds threshold */
+    RX_OP_CHECK_STATE   (0, 1, 0)
+    RX_OP_CHECK_ACKS    (0, rx_ack_ranges_5b)
+
+    /* A gap does not cause an immediate ACK as reordering is ignored. */
+    RX_OP_PKT           (0, 7, 1)
+    RX_OP_CHECK_STATE   (0, 0, 1)
+
+    /* IMMEDIATE_ACK overrides the threshold. */
+    RX_OP_IMMEDIATE_ACK (0)
+    RX_OP_CHECK_STATE   (0, 1, 0)
+    RX_OP_CHECK_ACKS    (0, rx_ack_ranges_5c)
+    RX_OP_CHECK_STATE   (0, 0, 0)
+
+    /* With a reordering threshold of 1, a new gap causes an immediate ACK. */
+    RX_OP_SET_ACK_FREQ  (3, 1)
+    RX_OP_PKT           (0, 10, 1)
+    RX_OP_CHECK_STATE   (0, 1, 0)
+    RX_OP_CHECK_ACKS    (0, rx_ack_ranges_5d)
+
+    RX_OP_TX            (0, 0, 10)  /* ACKs all */
+    RX_OP_RX_ACK        (0, 0, 1)
+    RX_OP_CHECK_NO_ACKS (0)
+
+    RX_OP_END
+};
+
 static const struct rx_test_op *const rx_test_scripts[] = {
     rx_script_1,
     rx_script_2,
     rx_script_3,
-    rx_script_4
+    rx_script_4,
+    rx_script_5
 };
 
 static void on_ack_deadline_callback(OSSL_TIME deadline,
@@ -1063,6 +1141,15 @@ static int test_rx_ack_actual(int tidx, int space)
 
             break;
 
+        case RX_OPK_SET_ACK_FREQ:
+            ossl_ackm_set_ack_frequency(h.ackm, s->pn, ossl_ms2time(25),
+                                        s->num_pn);
+            break;
+
+        case RX_OPK_IMMEDIATE_ACK:
+            ossl_ackm_on_rx_immediate_ack(h.ackm, space);
+            break;
+
         default:
             goto err;
         }
@@ -12,6 +12,7 @@
 
 #include "testutil.h"
 #include <openssl/ssl.h>
+#include "internal/nelem.h"
 #include "internal/quic_cc.h"
 #include "internal/priority_queue.h"
 
@@ -46,6 +47,14 @@ static void step_time(uint32_t ms)
  * congestion controller of ack/loss events automatically but the caller is
  * responsible for querying the congestion controller and choosing the size of
  * simulated transmitted packets.
+ *
+ * Optionally, the network can instead be modelled as a bottleneck link with a
+ * given rate and buffer size. Packets are sent over the link one after the
+ * other and queue in the buffer while the link is busy, so that a congestion
+ * controller which overfills the link causes queueing delay, and packets which
+ * do not fit in the buffer are dropped. ACKs can also be aggregated, so that
+ * they reach the sender in bursts at fixed intervals, as happens with delayed
+ * ACKs and on some link layers.
  */
 typedef struct net_pkt_st {
     /*
@@ -101,7 +110,17 @@ struct net_sim {
     uint64_t spare_capacity;
     PRIORITY_QUEUE_OF(NET_PKT) *pkts;
 
+    /* Bottleneck link model, used if rate is nonzero. */
+    uint64_t rate;      /* bytes/s */
+    uint64_t buf_len;   /* bytes */
+    OSSL_TIME ack_interval;
+    OSSL_TIME link_free_time;
+
     uint64_t total_acked, total_lost; /* bytes */
+
+    /* Queueing delay statistics for the bottleneck link model. */
+    OSSL_TIME total_queue_delay, max_queue_delay;
+    uint64_t num_queued;
 };
 
 static int net_sim_init(struct net_sim *s,
@@ -116,15 +135,84 @@ static int net_sim_init(struct net_sim *s,
 
     s->spare_capacity   = capacity;
 
+    s->rate             = 0;
+    s->buf_len          = 0;
+    s->ack_interval     = ossl_time_zero();
+    s->link_free_time   = ossl_time_zero();
+
     s->total_acked      = 0;
     s->total_lost       = 0;
 
+    s->total_queue_delay    = ossl_time_zero();
+    s->max_queue_delay      = ossl_time_zero();
+    s->num_queued           = 0;
+
     if (!TEST_ptr(s->pkts = ossl_pqueue_NET_PKT_new(net_pkt_cmp)))
         return 0;
 
     return 1;
 }
 
+/*
+ * Switches the simulator to the bottleneck link model, with a link of |rate|
+ * bytes/s and a buffer of |buf_len| bytes in front of it. If |ack_interval_ms|
+ * is nonzero, ACKs are delivered only at multiples of that interval.
+ */
+static void net_sim_set_bottleneck(struct net_sim *s, uint64_t rate,
+                                   uint64_t buf_len, uint32_t ack_interval_ms)
+{
+    s->rate         = rate;
+    s->buf_len      = buf_len;
+    s->ack_interval = ossl_ms2time(ack_interval_ms);
+}
+
+/* Decides the fate of a packet sent over the bottleneck link. */
+static int net_sim_send_bottleneck(struct net_sim *s, NET_PKT *pkt)
+{
+    OSSL_TIME queue_delay = ossl_time_zero(), start;
+    uint64_t queued = 0;
+
+    if (ossl_time_compare(s->link_free_time, pkt->tx_time) > 0) {
+        queue_delay = ossl_time_subtract(s->link_free_time, pkt->tx_time);
+        queued = ossl_time2ticks(queue_delay) * s->rate / OSSL_TIME_SECOND;
+    }
+
+    if (queued + pkt->size > s->buf_len) {
+        /* The buffer is full, so the packet is dropped. */
+        pkt->arrive_time        = ossl_time_add(pkt->tx_time,
+                                                ossl_ms2time(s->latency));
+        pkt->determination_time = ossl_time_add(pkt->tx_time, queue_delay);
+        pkt->determination_time = ossl_time_add(pkt->determination_time,
+                                                ossl_ms2time(3 * s->latency));
+        pkt->next_time          = pkt->determination_time;
+        return 0;
+    }
+
+    start = ossl_time_max(pkt->tx_time, s->link_free_time);
+    s->link_free_time = ossl_time_add(start,
+                                      ossl_ticks2time(pkt->size * OSSL_TIME_SECOND
+                                                      / s->rate));
+
+    s->total_queue_delay = ossl_time_add(s->total_queue_delay, queue_delay);
+    s->max_queue_delay   = ossl_time_max(s->max_queue_delay, queue_delay);
+    ++s->num_queued;
+
+    pkt->arrive_time        = ossl_time_add(s->link_free_time,
+                                            ossl_ms2time(s->latency));
+    pkt->determination_time = ossl_time_add(pkt->arrive_time,
+                                            ossl_ms2time(s->latency));
+    if (!ossl_time_is_zero(s->ack_interval)) {
+        uint64_t interval = ossl_time2ticks(s->ack_interval);
+
+        pkt->determination_time
+            = ossl_ticks2time((ossl_time2ticks(pkt->determination_time)
+                               + interval - 1) / interval * interval);
+    }
+
+    pkt->next_time          = pkt->arrive_time;
+    return 1;
+}
+
 static void do_free(NET_PKT *pkt)
 {
     OPENSSL_free(pkt);
@@ -152,10 +240,17 @@ static int net_sim_send(struct net_sim *s, size_t sz)
     if (!TEST_true(net_sim_process(s, 0)))
         goto err;
 
+    pkt->tx_time = fake_time;
+    pkt->size = sz;
+
+    if (s->rate != 0) {
+        pkt->success = net_sim_send_bottleneck(s, pkt);
+        goto sent;
+    }
+
     /* Do we have room for the packet in the network? */
     success = (sz <= s->spare_capacity);
 
-    pkt->tx_time = fake_time;
     pkt->success = success;
     if (success) {
         /* This packet will arrive successfully after |latency| time. */
@@ -182,8 +277,7 @@ static int net_sim_send(struct net_sim *s, size_t sz)
         pkt->next_time          = pkt->determination_time;
     }
 
-    pkt->size = sz;
-
+sent:
     if (!TEST_true(s->ccm->on_data_sent(s->cc, sz)))
         goto err;
 
@@ -271,6 +365,18 @@ static int net_sim_process(struct net_sim *s, size_t skip_forward)
     return rc;
 }
 
+static const OSSL_CC_METHOD *cc_methods[] = {
+    &ossl_cc_newreno_method,
+    &ossl_cc_cubic_method,
+    &ossl_cc_bbr_method,
+};
+
+static const char *cc_method_names[] = {
+    "NewReno",
+    "CUBIC",
+    "BBR",
+};
+
 /*
  * State Dumping Utilities
  * =======================
@@ -325,12 +431,12 @@ static int dump_state(const OSSL_CC_METHOD *ccm, OSSL_CC_DATA *cc,
  * capacity. The average estimated channel capacity should not be too far from
  * the actual channel capacity.
  */
-static int test_simulate(void)
+static int test_simulate(int idx)
 {
     int testresult = 0;
     int rc;
     int have_sim = 0;
-    const OSSL_CC_METHOD *ccm = &ossl_cc_newreno_method;
+    const OSSL_CC_METHOD *ccm = cc_methods[idx];
     OSSL_CC_DATA *cc = NULL;
     size_t mdpl = 1472;
     uint64_t total_sent = 0, total_to_send, allowance;
@@ -474,17 +580,235 @@ err:
     return testresult;
 }
 
+/*
+ * Bottleneck Comparison Test
+ * ==========================
+ *
+ * Simulates a transfer over a path with a high bandwidth-delay product and a
+ * bottleneck buffer of a quarter of the BDP with each congestion controller,
+ * paced as the TXP paces it, and compares the goodput they achieve and the
+ * queueing delay they cause.
+ */
+#define BN_RATE         12500000    /* B/s - 100 Mb/s */
+#define BN_LATENCY      50          /* ms, one way */
+#define BN_BDP          (BN_RATE * 2 * BN_LATENCY / 1000)
+#define BN_BUF_LEN      (BN_BDP / 4)
+#define BN_DURATION     30          /* s */
+
+struct bn_result {
+    uint64_t    goodput;        /* B/s */
+    uint64_t    lost;           /* bytes */
+    OSSL_TIME   avg_queue_delay, max_queue_delay;
+};
+
+/*
+ * Like the TXP, the pacer lets through a burst of 10 datagrams, or 2 ms of
+ * transmission at the pacing rate if that is more.
+ */
+#define BN_PACING_MIN_BURST     10
+#define BN_PACING_QUANTUM_MS    2
+
+static int run_bottleneck(const OSSL_CC_METHOD *ccm, uint64_t buf_len,
+                          uint32_t ack_interval_ms, int paced,
+                          struct bn_result *res)
+{
+    int testresult = 0;
+    int have_sim = 0;
+    OSSL_CC_DATA *cc = NULL;
+    size_t mdpl = 1472;
+    uint64_t allowance, sz, rate, burst, tokens = 0;
+    OSSL_TIME end_time, pacing_time = ossl_time_zero(), next_send;
+    NET_PKT *next_pkt;
+    struct net_sim sim;
+    OSSL_PARAM params[2], *p = params;
+
+    fake_time = TIME_BASE;
+    end_time = ossl_time_add(fake_time, ossl_seconds2time(BN_DURATION));
+
+    if (!TEST_ptr(cc = ccm->new(fake_now, NULL)))
+        goto err;
+
+    if (!TEST_true(net_sim_init(&sim, ccm, cc, 0, BN_LATENCY)))
+        goto err;
+
+    have_sim = 1;
+    net_sim_set_bottleneck(&sim, BN_RATE, buf_len, ack_interval_ms);
+
+    *p++ = OSSL_PARAM_construct_size_t(OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                                       &mdpl);
+    *p++ = OSSL_PARAM_construct_end();
+
+    if (!TEST_true(ccm->set_input_params(cc, params)))
+        goto err;
+
+    ccm->reset(cc);
+
+    while (ossl_time_compare(fake_time, end_time) < 0) {
+        /* Fill the token bucket. */
+        rate = paced ? ccm->get_pacing_rate(cc) : 0;
+        burst = rate * BN_PACING_QUANTUM_MS / 1000;
+        if (burst < BN_PACING_MIN_BURST * mdpl)
+            burst = BN_PACING_MIN_BURST * mdpl;
+
+        if (rate == 0)
+            tokens = burst;
+        else
+            tokens += rate * ossl_time2ticks(ossl_time_subtract(fake_time,
+                                                                pacing_time))
+                      / OSSL_TIME_SECOND;
+
+        if (tokens > burst)
+            tokens = burst;
+
+        pacing_time = fake_time;
+
+        /* Fill the entire TX allowance, as far as pacing lets us. */
+        while ((allowance = ccm->get_tx_allowance(cc)) >= 30
+               && (rate == 0 || tokens >= mdpl)) {
+            sz = allowance > mdpl ? mdpl : allowance;
+            if (!TEST_true(net_sim_send(&sim, (size_t)sz)))
+                goto err;
+
+            if (rate != 0)
+                tokens -= sz;
+        }
+
+        /*
+         * Skip to the next event, which is when pacing lets us send again if
+         * that comes before anything happens in the network.
+         */
+        if (rate != 0 && allowance >= 30 && tokens < mdpl) {
+            next_send = ossl_time_add(pacing_time,
+                                      ossl_ticks2time((mdpl - tokens)
+                                                      * OSSL_TIME_SECOND
+                                                      / rate + 1));
+            next_pkt = ossl_pqueue_NET_PKT_peek(sim.pkts);
+
+            if (next_pkt == NULL
+                || ossl_time_compare(next_send, next_pkt->next_time) < 0) {
+                fake_time = next_send;
+                if (!TEST_int_gt(net_sim_process(&sim, 0), 0))
+                    goto err;
+                continue;
+            }
+        }
+
+        if (!TEST_int_gt(net_sim_process(&sim, 1), 0))
+            goto err;
+    }
+
+    res->goodput = sim.total_acked / BN_DURATION;
+    res->lost    = sim.total_lost;
+    res->avg_queue_delay
+        = ossl_ticks2time(ossl_time2ticks(sim.total_queue_delay)
+                          / (sim.num_queued > 0 ? sim.num_queued : 1));
+    res->max_queue_delay = sim.max_queue_delay;
+
+    testresult = 1;
+err:
+    if (have_sim)
+        net_sim_cleanup(&sim);
+
+    if (cc != NULL)
+        ccm->free(cc);
+
+    return testresult;
+}
+
+static int test_bottleneck_compare(void)
+{
+    struct bn_result res[OSSL_NELEM(cc_methods)];
+    size_t i;
+
+    for (i = 0; i < OSSL_NELEM(cc_methods); i++) {
+        if (!TEST_true(run_bottleneck(cc_methods[i], BN_BUF_LEN, 0, 1,
+                                      &res[i])))
+            return 0;
+
+        TEST_info("%-8s goodput %6.2f Mb/s, queueing delay avg %3llu ms "
+                  "max %3llu ms, lost %llu kB",
+                  cc_method_names[i],
+                  (double)res[i].goodput * 8 / 1000000,
+                  (unsigned long long)ossl_time2ms(res[i].avg_queue_delay),
+                  (unsigned long long)ossl_time2ms(res[i].max_queue_delay),
+                  (unsigned long long)res[i].lost / 1000);
+
+        /* Every controller should make reasonable use of the link. */
+        if (!TEST_uint64_t_ge(res[i].goodput, BN_RATE / 2))
+            return 0;
+    }
+
+    /*
+     * After the loss at the end of slow start, NewReno takes much longer than
+     * the test to grow its window back to the BDP, so both CUBIC and BBR get
+     * more out of the link.
+     */
+    if (!TEST_uint64_t_gt(res[1].goodput, res[0].goodput)
+        || !TEST_uint64_t_gt(res[2].goodput, res[0].goodput))
+        return 0;
+
+    /* BBR fills the link while keeping a shorter queue than CUBIC. */
+    if (!TEST_uint64_t_lt(ossl_time2ticks(res[2].avg_queue_delay),
+                          ossl_time2ticks(res[1].avg_queue_delay)))
+        return 0;
+
+    return 1;
+}
+
+/*
+ * Pacing Test
+ * ===========
+ *
+ * Runs the bottleneck simulation with and without pacing, with ACKs which
+ * arrive in bursts and a shallow bottleneck buffer. Without pacing, each burst
+ * of ACKs releases a burst of packets, much of which is dropped when it is
+ * larger than the space left in the buffer. Pacing spreads the transmissions
+ * out so that the buffer absorbs them.
+ */
+#define BN_SHALLOW_BUF_LEN  (64 * 1024)
+#define BN_ACK_INTERVAL     10          /* ms */
+
+static int test_bottleneck_pacing(int idx)
+{
+    struct bn_result unpaced, paced;
+
+    if (!TEST_true(run_bottleneck(cc_methods[idx], BN_SHALLOW_BUF_LEN,
+                                  BN_ACK_INTERVAL, 0, &unpaced))
+        || !TEST_true(run_bottleneck(cc_methods[idx], BN_SHALLOW_BUF_LEN,
+                                     BN_ACK_INTERVAL, 1, &paced)))
+        return 0;
+
+    TEST_info("%-8s unpaced: goodput %6.2f Mb/s, queueing delay max %3llu ms, "
+              "lost %llu kB",
+              cc_method_names[idx],
+              (double)unpaced.goodput * 8 / 1000000,
+              (unsigned long long)ossl_time2ms(unpaced.max_queue_delay),
+              (unsigned long long)unpaced.lost / 1000);
+    TEST_info("%-8s paced:   goodput %6.2f Mb/s, queueing delay max %3llu ms, "
+              "lost %llu kB",
+              cc_method_names[idx],
+              (double)paced.goodput * 8 / 1000000,
+              (unsigned long long)ossl_time2ms(paced.max_queue_delay),
+              (unsigned long long)paced.lost / 1000);
+
+    if (!TEST_uint64_t_ge(paced.goodput, BN_RATE / 2)
+        || !TEST_uint64_t_gt(paced.goodput, 2 * unpaced.goodput))
+        return 0;
+
+    return 1;
+}
+
 /*
  * Sanity Test
  * ===========
  *
  * Basic test of the congestion control APIs.
  */
-static int test_sanity(void)
+static int test_sanity(int idx)
 {
     int testresult = 0;
     OSSL_CC_DATA *cc = NULL;
-    const OSSL_CC_METHOD *ccm = &ossl_cc_newreno_method;
+    const OSSL_CC_METHOD *ccm = cc_methods[idx];
     OSSL_CC_LOSS_INFO loss_info = {0};
     OSSL_CC_ACK_INFO ack_info = {0};
     uint64_t allowance, allowance2;
@@ -521,6 +845,10 @@ static int test_sanity(void)
     if (!TEST_uint64_t_ge(allowance = ccm->get_tx_allowance(cc), 1472))
         goto err;
 
+    /* We cannot pace without an RTT estimate. */
+    if (!TEST_uint64_t_eq(ccm->get_pacing_rate(cc), 0))
+        goto err;
+
     /* There is TX allowance so wakeup should be immediate */
     if (!TEST_true(ossl_time_is_zero(ccm->get_wakeup_deadline(cc))))
         goto err;
@@ -623,7 +951,9 @@ int setup_tests(void)
         "\"State\"\n");
 #endif
 
-    ADD_TEST(test_simulate);
-    ADD_TEST(test_sanity);
+    ADD_ALL_TESTS(test_simulate, OSSL_NELEM(cc_methods));
+    ADD_ALL_TESTS(test_sanity, OSSL_NELEM(cc_methods));
+    ADD_TEST(test_bottleneck_compare);
+    ADD_ALL_TESTS(test_bottleneck_pacing, OSSL_NELEM(cc_methods));
     return 1;
 }
@@ -0,0 +1,249 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <openssl/rand.h>
+#include "internal/nelem.h"
+#include "internal/quic_lb.h"
+#include "testutil.h"
+
+static const unsigned char server_id[QUIC_LB_MAX_SERVER_ID_LEN] = {
+    0xed, 0x79, 0x3a, 0x51, 0xd4, 0x9b, 0x8f, 0x5f,
+    0xab, 0x65, 0xc1, 0xf8, 0x3e, 0x70, 0x12
+};
+
+static const unsigned char key[QUIC_LB_KEY_LEN] = {
+    0xfd, 0xf7, 0x26, 0xa9, 0x89, 0x3e, 0xc0, 0x5c,
+    0x06, 0x32, 0xd3, 0x95, 0x66, 0x80, 0xba, 0xf0
+};
+
+struct lb_test {
+    const char      *name;
+    unsigned int    config_id;
+    size_t          server_id_len, nonce_len;
+    int             encrypted;
+};
+
+static const struct lb_test tests[] = {
+    { "plaintext",          0, 3, 4,  0 },
+    { "plaintext, max",     6, 15, 4, 0 },
+    { "single pass",        1, 4, 12, 1 },
+    { "four pass, even",    2, 3, 5,  1 },
+    { "four pass, odd",     3, 3, 4,  1 },
+    { "four pass, 19",      4, 1, 18, 1 },
+    { "four pass, 15",      5, 7, 8,  1 },
+};
+
+static QUIC_LB_CONFIG *lb_new(const struct lb_test *t)
+{
+    return ossl_quic_lb_config_new(NULL, NULL, t->config_id,
+                                   server_id, t->server_id_len, t->nonce_len,
+                                   t->encrypted ? key : NULL, sizeof(key));
+}
+
+/* Check CIDs decode to the server ID and nonce they were encoded from. */
+static int test_lb_roundtrip(int idx)
+{
+    int testresult = 0;
+    const struct lb_test *t = &tests[idx];
+    QUIC_LB_CONFIG *lb = NULL, *other = NULL;
+    QUIC_CONN_ID cid, bad;
+    unsigned char nonce[QUIC_LB_MAX_NONCE_LEN], nonce2[QUIC_LB_MAX_NONCE_LEN];
+    unsigned char sid[QUIC_LB_MAX_SERVER_ID_LEN];
+    size_t cid_len = 1 + t->server_id_len + t->nonce_len;
+    int i;
+
+    if (!TEST_ptr(lb = lb_new(t))
+        || !TEST_size_t_eq(ossl_quic_lb_config_get_cid_len(lb), cid_len)
+        || !TEST_size_t_eq(ossl_quic_lb_config_get_nonce_len(lb), t->nonce_len))
+        goto err;
+
+    for (i = 0; i < 64; i++) {
+        if (!TEST_int_eq(RAND_bytes(nonce, (int)t->nonce_len), 1)
+            || !TEST_true(ossl_quic_lb_encode_cid(lb, nonce, &cid))
+            || !TEST_size_t_eq(cid.id_len, cid_len)
+            || !TEST_uint_eq(cid.id[0] >> 5, t->config_id)
+            || !TEST_size_t_eq((cid.id[0] & 0x1f) + 1, cid_len)
+            || !TEST_true(ossl_quic_lb_decode_cid(lb, &cid, sid, nonce2))
+            || !TEST_mem_eq(sid, t->server_id_len, server_id, t->server_id_len)
+            || !TEST_mem_eq(nonce2, t->nonce_len, nonce, t->nonce_len))
+            goto err;
+
+        /* Only an unencrypted CID shows the server ID and nonce. */
+        if (!TEST_int_eq(memcmp(cid.id + 1, server_id, t->server_id_len) == 0
+                         && memcmp(cid.id + 1 + t->server_id_len, nonce,
+                                   t->nonce_len) == 0,
+                         !t->encrypted))
+            goto err;
+    }
+
+    /* A CID of another length or config ID does not belong to us. */
+    bad = cid;
+    --bad.id_len;
+    if (!TEST_false(ossl_quic_lb_decode_cid(lb, &bad, sid, NULL)))
+        goto err;
+
+    bad = cid;
+    bad.id[0] ^= 0x20;
+    if (!TEST_false(ossl_quic_lb_decode_cid(lb, &bad, sid, NULL)))
+        goto err;
+
+    /* The same nonce always encodes to the same CID. */
+    if (!TEST_true(ossl_quic_lb_encode_cid(lb, nonce, &bad))
+        || !TEST_mem_eq(bad.id, bad.id_len, cid.id, cid.id_len))
+        goto err;
+
+    /* Without the key, the server ID cannot be recovered. */
+    if (t->encrypted) {
+        if (!TEST_ptr(other = ossl_quic_lb_config_new(NULL, NULL, t->config_id,
+                                                      server_id,
+                                                      t->server_id_len,
+                                                      t->nonce_len,
+                                                      NULL, 0))
+            || !TEST_true(ossl_quic_lb_decode_cid(other, &cid, sid, NULL))
+            || !TEST_int_ne(memcmp(sid, server_id, t->server_id_len), 0))
+            goto err;
+    }
+
+    testresult = 1;
+err:
+    ossl_quic_lb_config_free(lb);
+    ossl_quic_lb_config_free(other);
+    return testresult;
+}
+
+/* Known answer test for the unencrypted encoding. */
+static int test_lb_plaintext(void)
+{
+    int testresult = 0;
+    QUIC_LB_CONFIG *lb = NULL;
+    static const unsigned char nonce[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    static const unsigned char expect[] = {
+        0x47, 0xed, 0x79, 0x01, 0x02, 0x03, 0x04, 0x05
+    };
+    QUIC_CONN_ID cid;
+
+    if (!TEST_ptr(lb = ossl_quic_lb_config_new(NULL, NULL, 2, server_id, 2,
+                                               sizeof(nonce), NULL, 0))
+        || !TEST_true(ossl_quic_lb_encode_cid(lb, nonce, &cid))
+        || !TEST_mem_eq(cid.id, cid.id_len, expect, sizeof(expect)))
+        goto err;
+
+    testresult = 1;
+err:
+    ossl_quic_lb_config_free(lb);
+    return testresult;
+}
+
+/*
+ * Known answer tests for the encrypted encodings, from the test vectors of
+ * draft-ietf-quic-load-balancers. They cover the single pass encryption of a
+ * 16 byte plaintext and the four pass encryption of even and odd lengths.
+ */
+static const unsigned char draft_key[QUIC_LB_KEY_LEN] = {
+    0x8f, 0x95, 0xf0, 0x92, 0x45, 0x76, 0x5f, 0x80,
+    0x25, 0x69, 0x34, 0xe5, 0x0c, 0x66, 0x20, 0x7f
+};
+
+static const unsigned char draft_server_id[] = {
+    0xed, 0x79, 0x3a, 0x51, 0xd4, 0x9b, 0x8f, 0x5f, 0xab
+};
+
+static const unsigned char draft_nonce[] = {
+    0xee, 0x08, 0x0d, 0xbf, 0x48, 0xc0, 0xd1, 0xe5, 0x5d
+};
+
+static const struct {
+    unsigned int        config_id;
+    size_t              server_id_len, nonce_len;
+    const char          *cid;
+} lb_kats[] = {
+    /* Four pass, odd length */
+    { 0, 3, 4, "0720b1d07b359d3c" },
+    /* Single pass */
+    { 2, 8, 8, "504dd2d05a7b0de9b2b9907afb5ecf8cc3" },
+    /* Four pass, even length */
+    { 0, 9, 9, "125779c9cc86beb3a3a4a3ca96fce4bfe0cdbc" },
+};
+
+static int test_lb_encrypted_kat(int idx)
+{
+    int testresult = 0;
+    QUIC_LB_CONFIG *lb = NULL;
+    QUIC_CONN_ID cid, expect;
+    unsigned char sid[QUIC_LB_MAX_SERVER_ID_LEN];
+    unsigned char nonce[QUIC_LB_MAX_NONCE_LEN];
+    unsigned char *buf = NULL;
+    long buf_len = 0;
+
+    if (!TEST_ptr(buf = OPENSSL_hexstr2buf(lb_kats[idx].cid, &buf_len))
+        || !TEST_long_le(buf_len, QUIC_MAX_CONN_ID_LEN))
+        goto err;
+    memcpy(expect.id, buf, buf_len);
+    expect.id_len = (unsigned char)buf_len;
+
+    if (!TEST_ptr(lb = ossl_quic_lb_config_new(NULL, NULL,
+                                               lb_kats[idx].config_id,
+                                               draft_server_id,
+                                               lb_kats[idx].server_id_len,
+                                               lb_kats[idx].nonce_len,
+                                               draft_key, sizeof(draft_key)))
+        || !TEST_true(ossl_quic_lb_encode_cid(lb, draft_nonce, &cid))
+        || !TEST_mem_eq(cid.id, cid.id_len, expect.id, expect.id_len)
+        || !TEST_true(ossl_quic_lb_decode_cid(lb, &expect, sid, nonce))
+        || !TEST_mem_eq(sid, lb_kats[idx].server_id_len,
+                        draft_server_id, lb_kats[idx].server_id_len)
+        || !TEST_mem_eq(nonce, lb_kats[idx].nonce_len,
+                        draft_nonce, lb_kats[idx].nonce_len))
+        goto err;
+
+    testresult = 1;
+err:
+    OPENSSL_free(buf);
+    ossl_quic_lb_config_free(lb);
+    return testresult;
+}
+
+static int test_lb_invalid(void)
+{
+    static const struct {
+        unsigned int    config_id;
+        size_t          server_id_len, nonce_len, key_len;
+    } bad[] = {
+        { 7, 3, 4, 16 },    /* config ID reserved for unroutable CIDs */
+        { 0, 0, 4, 16 },    /* server ID too short */
+        { 0, 16, 4, 16 },   /* server ID too long */
+        { 0, 3, 3, 16 },    /* nonce too short */
+        { 0, 1, 19, 16 },   /* nonce too long */
+        { 0, 15, 5, 16 },   /* CID too long */
+        { 0, 3, 4, 15 },    /* bad key length */
+    };
+    size_t i;
+
+    for (i = 0; i < OSSL_NELEM(bad); i++)
+        if (!TEST_ptr_null(ossl_quic_lb_config_new(NULL, NULL,
+                                                   bad[i].config_id,
+                                                   server_id,
+                                                   bad[i].server_id_len,
+                                                   bad[i].nonce_len,
+                                                   key, bad[i].key_len))) {
+            TEST_note("bad configuration %zu accepted", i);
+            return 0;
+        }
+
+    return 1;
+}
+
+int setup_tests(void)
+{
+    ADD_ALL_TESTS(test_lb_roundtrip, OSSL_NELEM(tests));
+    ADD_TEST(test_lb_plaintext);
+    ADD_ALL_TESTS(test_lb_encrypted_kat, OSSL_NELEM(lb_kats));
+    ADD_TEST(test_lb_invalid);
+    return 1;
+}
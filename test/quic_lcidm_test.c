@@ -7,6 +7,7 @@
  * https://www.openssl.org/source/license.html
  */
 
+#include "internal/nelem.h"
 #include "internal/quic_lcidm.h"
 #include "testutil.h"
 
@@ -99,8 +100,117 @@ err:
     return testresult;
 }
 
+static const size_t shard_counts[] = { 1, 2, 3, 7, 100, 129, 256 };
+
+/* Check LCIDs generated for each shard identify that shard. */
+static int test_lcidm_shard(int idx)
+{
+    int testresult = 0;
+    QUIC_LCIDM *lcidm = NULL;
+    size_t num_shards = shard_counts[idx], shard_idx, i;
+    QUIC_CONN_ID lcid;
+    OSSL_QUIC_FRAME_NEW_CONN_ID ncid_frame;
+
+    if (!TEST_ptr(lcidm = ossl_quic_lcidm_new(NULL, 10))
+        || !TEST_false(ossl_quic_lcidm_set_shard(lcidm, num_shards,
+                                                 num_shards))
+        || !TEST_false(ossl_quic_lcidm_set_shard(lcidm, 0,
+                                                 QUIC_LCIDM_MAX_SHARDS + 1))
+        || !TEST_size_t_eq(ossl_quic_lcidm_get_shard(lcidm, &cid8_5), 0))
+        goto err;
+
+    for (shard_idx = 0; shard_idx < num_shards; shard_idx += 1 + shard_idx / 4) {
+        if (!TEST_true(ossl_quic_lcidm_set_shard(lcidm, shard_idx, num_shards))
+            || !TEST_true(ossl_quic_lcidm_generate_initial(lcidm, ptrs + 0,
+                                                           &lcid))
+            || !TEST_size_t_eq(ossl_quic_lcidm_get_shard(lcidm, &lcid),
+                               shard_idx))
+            goto err;
+
+        for (i = 0; i < 16; i++)
+            if (!TEST_true(ossl_quic_lcidm_generate(lcidm, ptrs + 0,
+                                                    &ncid_frame))
+                || !TEST_size_t_eq(ossl_quic_lcidm_get_shard(lcidm,
+                                                             &ncid_frame.conn_id),
+                                   shard_idx))
+                goto err;
+
+        if (!TEST_true(ossl_quic_lcidm_cull(lcidm, ptrs + 0)))
+            goto err;
+    }
+
+    /* A peer-chosen ODCID of another length never identifies a shard. */
+    if (!TEST_size_t_eq(ossl_quic_lcidm_get_shard(lcidm, &cid8_5), 0))
+        goto err;
+
+    testresult = 1;
+err:
+    ossl_quic_lcidm_free(lcidm);
+    return testresult;
+}
+
+/* Check LCIDs are routable by a load balancer and still identify the shard. */
+static int test_lcidm_lb(void)
+{
+    int testresult = 0;
+    QUIC_LCIDM *lcidm = NULL;
+    QUIC_LB_CONFIG *lb = NULL;
+    static const unsigned char server_id[] = { 0x12, 0x34 };
+    static const unsigned char key[QUIC_LB_KEY_LEN] = { 1, 2, 3, 4 };
+    unsigned char sid[QUIC_LB_MAX_SERVER_ID_LEN];
+    QUIC_CONN_ID lcid;
+    OSSL_QUIC_FRAME_NEW_CONN_ID ncid_frame;
+    size_t i;
+
+    if (!TEST_ptr(lcidm = ossl_quic_lcidm_new(NULL, 8))
+        || !TEST_ptr(lb = ossl_quic_lb_config_new(NULL, NULL, 1, server_id,
+                                                  sizeof(server_id), 6,
+                                                  key, sizeof(key)))
+        || !TEST_true(ossl_quic_lcidm_set_lb_config(lcidm, lb))
+        || !TEST_size_t_eq(ossl_quic_lcidm_get_lcid_len(lcidm), 9)
+        || !TEST_true(ossl_quic_lcidm_set_shard(lcidm, 2, 3))
+        || !TEST_true(ossl_quic_lcidm_generate_initial(lcidm, ptrs + 0,
+                                                       &lcid))
+        || !TEST_size_t_eq(lcid.id_len, 9))
+        goto err;
+
+    /* The configuration cannot change once LCIDs have been issued. */
+    if (!TEST_ptr(lb = ossl_quic_lb_config_new(NULL, NULL, 1, server_id,
+                                               sizeof(server_id), 6,
+                                               NULL, 0))
+        || !TEST_false(ossl_quic_lcidm_set_lb_config(lcidm, lb)))
+        goto err;
+    ossl_quic_lb_config_free(lb);
+    lb = NULL;
+
+    if (!TEST_ptr(lb = ossl_quic_lb_config_new(NULL, NULL, 1, server_id,
+                                               sizeof(server_id), 6,
+                                               key, sizeof(key))))
+        goto err;
+
+    for (i = 0; i < 16; i++) {
+        if (!TEST_true(ossl_quic_lcidm_generate(lcidm, ptrs + 0, &ncid_frame))
+            || !TEST_size_t_eq(ossl_quic_lcidm_get_shard(lcidm,
+                                                         &ncid_frame.conn_id),
+                               2)
+            || !TEST_true(ossl_quic_lb_decode_cid(lb, &ncid_frame.conn_id,
+                                                  sid, NULL))
+            || !TEST_mem_eq(sid, sizeof(server_id),
+                            server_id, sizeof(server_id)))
+            goto err;
+    }
+
+    testresult = 1;
+err:
+    ossl_quic_lb_config_free(lb);
+    ossl_quic_lcidm_free(lcidm);
+    return testresult;
+}
+
 int setup_tests(void)
 {
     ADD_TEST(test_lcidm);
+    ADD_ALL_TESTS(test_lcidm_shard, OSSL_NELEM(shard_counts));
+    ADD_TEST(test_lcidm_lb);
     return 1;
 }
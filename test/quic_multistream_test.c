@@ -5103,6 +5103,185 @@ static const struct script_op script_79[] = {
     OP_END
 };
 
+/*
+ * 80. Stream priorities: a small stream of a high priority is not held up
+ *     behind bulk streams which were queued at the same time
+ * 81. As for 80, but with every stream at the default priority, for comparison
+ */
+#define PRIO_BULK_STREAMS   4
+#define PRIO_BULK_LEN       8192
+#define PRIO_URGENT_LEN     4096
+
+static unsigned char prio_buf[PRIO_BULK_LEN];
+static SSL *prio_c_streams[PRIO_BULK_STREAMS + 1];
+static size_t prio_c_num_streams;
+static uint64_t prio_urgent_id;
+static size_t prio_urgent_read, prio_bulk_frames;
+static int prio_urgent_started, prio_urgent_fin;
+
+/* Counts the bulk STREAM frames received while the urgent stream is sent. */
+static void prio_msg_cb(int write_p, int version, int content_type,
+                        const void *buf, size_t len, SSL *ssl, void *arg)
+{
+    PACKET pkt;
+    uint64_t frame_type;
+    OSSL_QUIC_FRAME_STREAM f;
+
+    if (write_p || content_type != SSL3_RT_QUIC_FRAME_HEADER
+        || !PACKET_buf_init(&pkt, buf, len)
+        || !ossl_quic_wire_peek_frame_header(&pkt, &frame_type, NULL)
+        || !OSSL_QUIC_FRAME_TYPE_IS_STREAM(frame_type)
+        || !ossl_quic_wire_decode_frame_stream(&pkt, 1, &f))
+        return;
+
+    if (f.stream_id == prio_urgent_id) {
+        prio_urgent_started = 1;
+        if (f.is_fin)
+            prio_urgent_fin = 1;
+    } else if (prio_urgent_started && !prio_urgent_fin) {
+        ++prio_bulk_frames;
+    }
+}
+
+static int script_80_check_api(struct helper *h, struct helper_local *hl)
+{
+    SSL *c_a = helper_local_get_c_stream(hl, "a");
+    unsigned int urgency = 0;
+    int incremental = 0;
+
+    if (!TEST_true(SSL_get_stream_priority(c_a, &urgency, &incremental))
+        || !TEST_uint_eq(urgency, SSL_STREAM_URGENCY_DEFAULT)
+        || !TEST_true(incremental)
+        || !TEST_false(SSL_set_stream_priority(c_a,
+                                               SSL_STREAM_URGENCY_MAX + 1, 0))
+        || !TEST_true(SSL_set_stream_priority(c_a, 0, 0))
+        || !TEST_true(SSL_get_stream_priority(c_a, &urgency, &incremental))
+        || !TEST_uint_eq(urgency, 0)
+        || !TEST_false(incremental)
+        /* No default stream */
+        || !TEST_false(SSL_set_stream_priority(h->c_conn, 0, 0)))
+        return 0;
+
+    ERR_clear_error();
+    return 1;
+}
+
+static int script_80_send(struct helper *h, struct helper_local *hl)
+{
+    QUIC_TSERVER *s = ACQUIRE_S();
+    QUIC_ENGINE *eng
+        = ossl_quic_channel_get0_engine(ossl_quic_tserver_get_channel(s));
+    uint64_t id;
+    size_t i, written;
+    int ok = 0;
+
+    prio_c_num_streams  = 0;
+    prio_urgent_read    = 0;
+    prio_bulk_frames    = 0;
+    prio_urgent_started = 0;
+    prio_urgent_fin     = 0;
+    SSL_set_msg_callback(h->c_conn, prio_msg_cb);
+
+    /* Queue all of the data before any of it is sent. */
+    ossl_quic_engine_set_inhibit_tick(eng, 1);
+
+    for (i = 0; i < PRIO_BULK_STREAMS; ++i)
+        if (!TEST_true(ossl_quic_tserver_stream_new(s, /*is_uni=*/0, &id))
+            || !TEST_true(ossl_quic_tserver_write(s, id, prio_buf,
+                                                  sizeof(prio_buf), &written))
+            || !TEST_size_t_eq(written, sizeof(prio_buf))
+            || !TEST_true(ossl_quic_tserver_conclude(s, id)))
+            goto err;
+
+    if (!TEST_true(ossl_quic_tserver_stream_new(s, /*is_uni=*/0,
+                                                &prio_urgent_id))
+        || (hl->check_op->arg2 != 0
+            && !TEST_true(ossl_quic_tserver_set_stream_priority(s,
+                                                                prio_urgent_id,
+                                                                0, 0)))
+        || !TEST_true(ossl_quic_tserver_write(s, prio_urgent_id, prio_buf,
+                                              PRIO_URGENT_LEN, &written))
+        || !TEST_size_t_eq(written, PRIO_URGENT_LEN)
+        || !TEST_true(ossl_quic_tserver_conclude(s, prio_urgent_id)))
+        goto err;
+
+    ok = 1;
+err:
+    ossl_quic_engine_set_inhibit_tick(eng, 0);
+    return ok;
+}
+
+static int script_80_recv(struct helper *h, struct helper_local *hl)
+{
+    unsigned char buf[1024];
+    size_t i, readbytes;
+    SSL *c_s;
+
+    while (prio_c_num_streams < OSSL_NELEM(prio_c_streams)
+           && (c_s = SSL_accept_stream(h->c_conn,
+                                       SSL_ACCEPT_STREAM_NO_BLOCK)) != NULL)
+        prio_c_streams[prio_c_num_streams++] = c_s;
+
+    /* Only read what is available, so as not to block. */
+    for (i = 0; i < prio_c_num_streams; ++i) {
+        c_s = prio_c_streams[i];
+        while (SSL_pending(c_s) > 0) {
+            if (!TEST_true(SSL_read_ex(c_s, buf, sizeof(buf), &readbytes)))
+                return 0;
+
+            if (SSL_get_stream_id(c_s) == prio_urgent_id)
+                prio_urgent_read += readbytes;
+        }
+    }
+
+    if (prio_urgent_read < PRIO_URGENT_LEN || !prio_urgent_fin) {
+        h->check_spin_again = 1;
+        return 0;
+    }
+
+    TEST_info("%s priority: %zu bulk STREAM frames received while the urgent stream was sent",
+              hl->check_op->arg2 != 0 ? "high" : "default", prio_bulk_frames);
+
+    SSL_set_msg_callback(h->c_conn, NULL);
+    for (i = 0; i < prio_c_num_streams; ++i)
+        SSL_free(prio_c_streams[i]);
+    prio_c_num_streams = 0;
+
+    /* The urgent stream must not have shared the packets with bulk streams. */
+    if (hl->check_op->arg2 != 0 && !TEST_size_t_eq(prio_bulk_frames, 0))
+        return 0;
+
+    return 1;
+}
+
+static const struct script_op script_80[] = {
+    OP_C_SET_ALPN           ("ossltest")
+    OP_C_CONNECT_WAIT       ()
+    OP_C_SET_DEFAULT_STREAM_MODE(SSL_DEFAULT_STREAM_MODE_NONE)
+    OP_C_SET_INCOMING_STREAM_POLICY(SSL_INCOMING_STREAM_POLICY_ACCEPT)
+
+    OP_C_NEW_STREAM_BIDI    (a, C_BIDI_ID(0))
+    OP_CHECK                (script_80_check_api, 0)
+    OP_C_FREE_STREAM        (a)
+
+    OP_CHECK                (script_80_send, 1)
+    OP_CHECK                (script_80_recv, 1)
+
+    OP_END
+};
+
+static const struct script_op script_81[] = {
+    OP_C_SET_ALPN           ("ossltest")
+    OP_C_CONNECT_WAIT       ()
+    OP_C_SET_DEFAULT_STREAM_MODE(SSL_DEFAULT_STREAM_MODE_NONE)
+    OP_C_SET_INCOMING_STREAM_POLICY(SSL_INCOMING_STREAM_POLICY_ACCEPT)
+
+    OP_CHECK                (script_80_send, 0)
+    OP_CHECK                (script_80_recv, 0)
+
+    OP_END
+};
+
 static const struct script_op *const scripts[] = {
     script_1,
     script_2,
@@ -5182,7 +5361,9 @@ static const struct script_op *const scripts[] = {
     script_76,
     script_77,
     script_78,
-    script_79
+    script_79,
+    script_80,
+    script_81
 };
 
 static int test_script(int idx)
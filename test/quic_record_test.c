@@ -33,6 +33,7 @@ static const QUIC_CONN_ID empty_conn_id = {0, {0}};
 #define RX_TEST_OP_SET_INIT_KEY_PHASE     12 /* initial Key Phase bit value */
 #define RX_TEST_OP_CHECK_PKT_EPOCH        13 /* check read key epoch matches */
 #define RX_TEST_OP_ALLOW_1RTT             14 /* allow 1RTT packet processing */
+#define RX_TEST_OP_CHECK_NO_FORGED        15 /* check no packet failed to decrypt */
 
 struct rx_test_op {
     unsigned char op;
@@ -84,6 +85,8 @@ struct rx_test_op {
     { RX_TEST_OP_CHECK_PKT_EPOCH, 0, NULL, 0, NULL, 0, 0, (expected), NULL },
 #define RX_OP_ALLOW_1RTT() \
     { RX_TEST_OP_ALLOW_1RTT, 0, NULL, 0, NULL, 0, 0, 0, NULL },
+#define RX_OP_CHECK_NO_FORGED() \
+    { RX_TEST_OP_CHECK_NO_FORGED, 0, NULL, 0, NULL, 0, 0, 0, NULL },
 
 #define RX_OP_INJECT_N(n)                                          \
     RX_OP_INJECT(rx_script_##n##_in)
@@ -178,6 +181,7 @@ static const struct rx_test_op rx_script_2[] = {
                          rx_script_2_secret)
     RX_OP_INJECT_CHECK(2)
     RX_OP_CHECK_NO_PKT()
+    RX_OP_CHECK_NO_FORGED()
     RX_OP_END
 };
 #endif /* !defined(OPENSSL_NO_CHACHA) && !defined(OPENSSL_NO_POLY1305) */
@@ -1594,6 +1598,7 @@ static const struct rx_test_op rx_script_8[] = {
     /* Now the injected packet is successfully returned */
     RX_OP_CHECK_PKT_N(8a)
     RX_OP_CHECK_NO_PKT()
+    RX_OP_CHECK_NO_FORGED()
     RX_OP_CHECK_KEY_EPOCH(0)
     RX_OP_CHECK_PKT_EPOCH(0)
 
@@ -1921,6 +1926,15 @@ static int rx_run_script(const struct rx_test_op *script)
                 if (!TEST_true(rx_state_ensure(&s)))
                     goto err;
 
+                break;
+            case RX_TEST_OP_CHECK_NO_FORGED:
+                if (!TEST_true(rx_state_ensure(&s)))
+                    goto err;
+
+                if (!TEST_uint64_t_eq(ossl_qrx_get_cur_forged_pkt_count(s.qrx),
+                                      0))
+                    goto err;
+
                 break;
             default:
                 OPENSSL_assert(0);
@@ -2993,6 +3007,102 @@ static int test_wire_pkt_hdr(int idx)
     return test_wire_pkt_hdr_inner(tidx, repeat, cipher);
 }
 
+/*
+ * Header protection removed from a batch of packets must match that removed
+ * from each of the packets individually.
+ */
+#define HPR_BATCH_PKT_LEN   40
+#define HPR_BATCH_PN_OFFSET 9
+
+static int test_hdr_prot_batch(int cipher)
+{
+    int testresult = 0, have_hpr = 0;
+    uint32_t hpr_cipher_id = QUIC_HDR_PROT_CIPHER_AES_128;
+    size_t hpr_key_len = 16, i, j;
+    unsigned char hpr_key[32] = {0,1,2,3,4,5,6,7};
+    unsigned char orig[QUIC_HDR_PROT_MAX_BATCH + 1][HPR_BATCH_PKT_LEN];
+    unsigned char bufs[QUIC_HDR_PROT_MAX_BATCH + 1][HPR_BATCH_PKT_LEN];
+    QUIC_PKT_HDR_PTRS ptrs[QUIC_HDR_PROT_MAX_BATCH + 1];
+    QUIC_HDR_PROTECTOR hpr;
+
+    switch (cipher) {
+    case 0:
+        break;
+    case 1:
+        hpr_cipher_id = QUIC_HDR_PROT_CIPHER_AES_256;
+        hpr_key_len   = 32;
+        break;
+    case 2:
+#if !defined(OPENSSL_NO_CHACHA) && !defined(OPENSSL_NO_POLY1305)
+        hpr_cipher_id = QUIC_HDR_PROT_CIPHER_CHACHA;
+#else
+        hpr_cipher_id = QUIC_HDR_PROT_CIPHER_AES_256;
+#endif
+        hpr_key_len   = 32;
+        break;
+    default:
+        goto err;
+    }
+
+    if (!TEST_true(ossl_quic_hdr_protector_init(&hpr, NULL, NULL,
+                                                hpr_cipher_id,
+                                                hpr_key, hpr_key_len)))
+        goto err;
+
+    have_hpr = 1;
+
+    /* Build and protect a set of distinct 1-RTT packets. */
+    for (i = 0; i < OSSL_NELEM(orig); ++i) {
+        for (j = 0; j < HPR_BATCH_PKT_LEN; ++j)
+            orig[i][j] = (unsigned char)(i * 31 + j * 7);
+
+        orig[i][0] = 0x40 | (unsigned char)(i & 0x3);
+        memcpy(bufs[i], orig[i], HPR_BATCH_PKT_LEN);
+
+        ptrs[i].raw_start       = bufs[i];
+        ptrs[i].raw_pn          = bufs[i] + HPR_BATCH_PN_OFFSET;
+        ptrs[i].raw_sample      = bufs[i] + HPR_BATCH_PN_OFFSET + 4;
+        ptrs[i].raw_sample_len  = HPR_BATCH_PKT_LEN - HPR_BATCH_PN_OFFSET - 4;
+
+        if (!TEST_true(ossl_quic_hdr_protector_encrypt(&hpr, &ptrs[i])))
+            goto err;
+    }
+
+    /* Too many packets is refused without modifying any of them. */
+    ERR_set_mark();
+    if (!TEST_false(ossl_quic_hdr_protector_decrypt_batch(&hpr, ptrs,
+                                                          OSSL_NELEM(ptrs))))
+        goto err;
+    ERR_pop_to_mark();
+
+    for (i = 0; i < OSSL_NELEM(orig); ++i)
+        if (!TEST_mem_ne(bufs[i], HPR_BATCH_PKT_LEN,
+                         orig[i], HPR_BATCH_PKT_LEN))
+            goto err;
+
+    /* An empty batch is a no-op. */
+    if (!TEST_true(ossl_quic_hdr_protector_decrypt_batch(&hpr, ptrs, 0)))
+        goto err;
+
+    /* Remove protection from all but the last packet in one batch. */
+    if (!TEST_true(ossl_quic_hdr_protector_decrypt_batch(&hpr, ptrs,
+                                                         QUIC_HDR_PROT_MAX_BATCH))
+        || !TEST_true(ossl_quic_hdr_protector_decrypt(&hpr,
+                                                      &ptrs[QUIC_HDR_PROT_MAX_BATCH])))
+        goto err;
+
+    for (i = 0; i < OSSL_NELEM(orig); ++i)
+        if (!TEST_mem_eq(bufs[i], HPR_BATCH_PKT_LEN,
+                         orig[i], HPR_BATCH_PKT_LEN))
+            goto err;
+
+    testresult = 1;
+err:
+    if (have_hpr)
+        ossl_quic_hdr_protector_cleanup(&hpr);
+    return testresult;
+}
+
 /* TX Tests */
 #define TX_TEST_OP_END                     0 /* end of script */
 #define TX_TEST_OP_WRITE                   1 /* write packet */
@@ -3700,6 +3810,238 @@ static int test_tx_script(int idx)
     return tx_run_script(tx_scripts[idx]);
 }
 
+/*
+ * TX Segmentation Offload Tests
+ * =============================
+ *
+ * A datagram sink BIO which reports support for segmentation offload on
+ * transmission and records the datagrams it is given, splitting segmented
+ * messages. If told to reject segmented messages, it fails to send them with a
+ * fatal error, as when the kernel or the network interface cannot segment them.
+ */
+#define GSO_TEST_NUM_PKTS   10
+#define GSO_TEST_BODY_LEN   1000
+
+struct gso_sink {
+    int reject;
+    uint32_t offload;
+    size_t num_msgs, num_segmented, num_rejected, num_dgrams;
+    unsigned char dgrams[GSO_TEST_NUM_PKTS][1472];
+    size_t dgram_len[GSO_TEST_NUM_PKTS];
+};
+
+static BIO_METHOD *gso_sink_method = NULL;
+
+static int gso_sink_sendmmsg(BIO *bio, BIO_MSG *msg, size_t stride,
+                             size_t num_msg, uint64_t flags,
+                             size_t *msgs_processed)
+{
+    struct gso_sink *sink = BIO_get_data(bio);
+    size_t i, off, len, seg_len;
+
+    for (i = 0; i < num_msg; i++) {
+        BIO_MSG *m = (BIO_MSG *)((unsigned char *)msg + i * stride);
+
+        if (m->segment_size != 0 && sink->reject) {
+            /* Only an error on the first message fails the whole call */
+            if (i == 0) {
+                ++sink->num_rejected;
+                ERR_raise(ERR_LIB_BIO, BIO_R_UNSUPPORTED_METHOD);
+                *msgs_processed = 0;
+                return 0;
+            }
+            break;
+        }
+
+        seg_len = m->segment_size != 0 ? m->segment_size : m->data_len;
+        for (off = 0; off < m->data_len; off += len) {
+            len = m->data_len - off < seg_len ? m->data_len - off : seg_len;
+            if (!TEST_size_t_lt(sink->num_dgrams, GSO_TEST_NUM_PKTS)
+                    || !TEST_size_t_le(len, sizeof(sink->dgrams[0]))) {
+                ERR_raise(ERR_LIB_BIO, BIO_R_UNSUPPORTED_METHOD);
+                *msgs_processed = i;
+                return i > 0;
+            }
+            memcpy(sink->dgrams[sink->num_dgrams],
+                   (unsigned char *)m->data + off, len);
+            sink->dgram_len[sink->num_dgrams++] = len;
+        }
+
+        ++sink->num_msgs;
+        if (m->segment_size != 0)
+            ++sink->num_segmented;
+    }
+
+    *msgs_processed = i;
+    return 1;
+}
+
+static long gso_sink_ctrl(BIO *bio, int cmd, long num, void *ptr)
+{
+    struct gso_sink *sink = BIO_get_data(bio);
+
+    switch (cmd) {
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD_CAP:
+        return BIO_DGRAM_SEGMENT_OFFLOAD_TX;
+    case BIO_CTRL_DGRAM_GET_SEGMENT_OFFLOAD:
+        return sink->offload;
+    case BIO_CTRL_DGRAM_SET_SEGMENT_OFFLOAD:
+        sink->offload = (uint32_t)num;
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int gso_sink_new(BIO *bio)
+{
+    BIO_set_init(bio, 1);
+    return 1;
+}
+
+static const BIO_METHOD *bio_s_gso_sink(void)
+{
+    if (gso_sink_method == NULL) {
+        gso_sink_method = BIO_meth_new(BIO_TYPE_SOURCE_SINK, "GSO sink");
+        if (gso_sink_method == NULL
+            || !BIO_meth_set_sendmmsg(gso_sink_method, gso_sink_sendmmsg)
+            || !BIO_meth_set_ctrl(gso_sink_method, gso_sink_ctrl)
+            || !BIO_meth_set_create(gso_sink_method, gso_sink_new)) {
+            BIO_meth_free(gso_sink_method);
+            gso_sink_method = NULL;
+        }
+    }
+
+    return gso_sink_method;
+}
+
+/*
+ * Writes |num| packets of the same size but the last to both |qtx| and |ref|,
+ * starting at PN |pn|.
+ */
+static int gso_write_pkts(OSSL_QTX *qtx, OSSL_QTX *ref, QUIC_PN pn, size_t num)
+{
+    static const unsigned char body[GSO_TEST_BODY_LEN] = { 0 };
+    QUIC_PKT_HDR hdr;
+    OSSL_QTX_IOVEC iovec;
+    OSSL_QTX_PKT pkt;
+    size_t i;
+
+    for (i = 0; i < num; i++) {
+        hdr = tx_script_4a_hdr;
+        iovec.buf = body;
+        iovec.buf_len = i == num - 1 ? sizeof(body) / 2 : sizeof(body);
+        pkt = tx_script_4a_pkt;
+        pkt.hdr = &hdr;
+        pkt.iovec = &iovec;
+        pkt.num_iovec = 1;
+        pkt.pn = pn + i;
+
+        if (!TEST_true(ossl_qtx_write_pkt(qtx, &pkt)))
+            return 0;
+
+        hdr = tx_script_4a_hdr;
+        if (!TEST_true(ossl_qtx_write_pkt(ref, &pkt)))
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Checks that the datagrams the sink got are those which a QTX without a BIO
+ * produced for the same packets.
+ */
+static int gso_check_dgrams(struct gso_sink *sink, OSSL_QTX *ref, size_t num)
+{
+    BIO_MSG msg;
+    size_t i;
+
+    if (!TEST_size_t_eq(sink->num_dgrams, num))
+        return 0;
+
+    for (i = 0; i < num; i++)
+        if (!TEST_true(ossl_qtx_pop_net(ref, &msg))
+                || !TEST_mem_eq(sink->dgrams[i], sink->dgram_len[i],
+                                msg.data, msg.data_len))
+            return 0;
+
+    sink->num_dgrams = 0;
+    return TEST_false(ossl_qtx_pop_net(ref, &msg));
+}
+
+/*
+ * Test that the QTX sends datagrams of the same size in one segmented message
+ * if the BIO supports segmentation offload, and that it falls back to sending
+ * them separately if the BIO then fails to send a segmented message.
+ * Test 0: The BIO accepts segmented messages
+ * Test 1: The BIO rejects segmented messages
+ */
+static int test_tx_gso(int idx)
+{
+    int testresult = 0;
+    struct gso_sink sink = { 0 };
+    OSSL_QTX *qtx = NULL, *ref = NULL;
+    OSSL_QTX_ARGS args = { 0 };
+    BIO *bio = NULL;
+
+    sink.reject = idx;
+    if (!TEST_ptr(bio_s_gso_sink())
+            || !TEST_ptr(bio = BIO_new(bio_s_gso_sink())))
+        goto err;
+    BIO_set_data(bio, &sink);
+
+    args.mdpl = 1472;
+    if (!TEST_ptr(ref = ossl_qtx_new(&args)))
+        goto err;
+    args.bio = bio;
+    if (!TEST_ptr(qtx = ossl_qtx_new(&args))
+            || !TEST_uint_eq(sink.offload, BIO_DGRAM_SEGMENT_OFFLOAD_TX))
+        goto err;
+
+    if (!TEST_true(ossl_qtx_provide_secret(qtx, QUIC_ENC_LEVEL_1RTT,
+                                           QRL_SUITE_AES128GCM, NULL,
+                                           tx_script_4_secret,
+                                           sizeof(tx_script_4_secret)))
+            || !TEST_true(ossl_qtx_provide_secret(ref, QUIC_ENC_LEVEL_1RTT,
+                                                  QRL_SUITE_AES128GCM, NULL,
+                                                  tx_script_4_secret,
+                                                  sizeof(tx_script_4_secret))))
+        goto err;
+
+    if (!gso_write_pkts(qtx, ref, 0, GSO_TEST_NUM_PKTS)
+            || !TEST_int_eq(ossl_qtx_flush_net(qtx), QTX_FLUSH_NET_RES_OK)
+            || !gso_check_dgrams(&sink, ref, GSO_TEST_NUM_PKTS)
+            || !TEST_ulong_eq(ERR_peek_error(), 0))
+        goto err;
+
+    if (idx == 0) {
+        if (!TEST_size_t_eq(sink.num_msgs, 1)
+                || !TEST_size_t_eq(sink.num_segmented, 1))
+            goto err;
+    } else {
+        if (!TEST_size_t_eq(sink.num_rejected, 1)
+                || !TEST_size_t_eq(sink.num_msgs, GSO_TEST_NUM_PKTS)
+                || !TEST_size_t_eq(sink.num_segmented, 0))
+            goto err;
+
+        /* Once a segmented message failed, it must not try again */
+        if (!gso_write_pkts(qtx, ref, GSO_TEST_NUM_PKTS, GSO_TEST_NUM_PKTS)
+                || !TEST_int_eq(ossl_qtx_flush_net(qtx), QTX_FLUSH_NET_RES_OK)
+                || !gso_check_dgrams(&sink, ref, GSO_TEST_NUM_PKTS)
+                || !TEST_size_t_eq(sink.num_rejected, 1)
+                || !TEST_size_t_eq(sink.num_segmented, 0))
+            goto err;
+    }
+
+    testresult = 1;
+err:
+    ossl_qtx_free(qtx);
+    ossl_qtx_free(ref);
+    BIO_free(bio);
+    return testresult;
+}
+
 int setup_tests(void)
 {
     ADD_ALL_TESTS(test_rx_script, OSSL_NELEM(rx_scripts));
@@ -3713,6 +4055,13 @@ int setup_tests(void)
      * and otherwise random test ordering will cause itt to randomly fail.
      */
     ADD_ALL_TESTS(test_wire_pkt_hdr, NUM_WIRE_PKT_HDR_TESTS + 1);
+    ADD_ALL_TESTS(test_hdr_prot_batch, HPR_CIPHER_COUNT);
     ADD_ALL_TESTS(test_tx_script, OSSL_NELEM(tx_scripts));
+    ADD_ALL_TESTS(test_tx_gso, 2);
     return 1;
 }
+
+void cleanup_tests(void)
+{
+    BIO_meth_free(gso_sink_method);
+}
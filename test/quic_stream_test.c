@@ -338,6 +338,124 @@ static int test_sstream_bulk(int idx)
     return testresult;
 }
 
+static size_t ref_released;
+
+static void ref_release_cb(const void *buf, size_t buf_len, void *arg)
+{
+    ref_released += buf_len;
+    *(const void **)arg = buf;
+}
+
+static int test_sstream_ref(void)
+{
+    int testresult = 0;
+    QUIC_SSTREAM *sstream = NULL;
+    OSSL_QUIC_FRAME_STREAM hdr;
+    OSSL_QTX_IOVEC iov[2];
+    size_t num_iov, wr = 0;
+    const void *released = NULL;
+    uint64_t final_size = 0;
+
+    ref_released = 0;
+
+    if (!TEST_ptr(sstream = ossl_quic_sstream_new(64)))
+        goto err;
+
+    /* Copied data followed by two referenced buffers */
+    if (!TEST_true(ossl_quic_sstream_append(sstream, data_1, 4, &wr))
+        || !TEST_size_t_eq(wr, 4)
+        || !TEST_true(ossl_quic_sstream_append_ref(sstream, data_1 + 4, 4,
+                                                   ref_release_cb, &released))
+        || !TEST_true(ossl_quic_sstream_append_ref(sstream, data_1 + 8,
+                                                   sizeof(data_1) - 8,
+                                                   ref_release_cb, &released))
+        || !TEST_uint64_t_eq(ossl_quic_sstream_get_cur_size(sstream),
+                             sizeof(data_1)))
+        goto err;
+
+    /* Copying is refused until the referenced buffers are released */
+    if (!TEST_true(ossl_quic_sstream_append(sstream, data_1, 4, &wr))
+        || !TEST_size_t_eq(wr, 0))
+        goto err;
+
+    /* A frame spans the ring buffer and the first referenced buffer */
+    num_iov = OSSL_NELEM(iov);
+    if (!TEST_true(ossl_quic_sstream_get_stream_frame(sstream, 0, &hdr, iov,
+                                                      &num_iov))
+        || !TEST_size_t_eq(num_iov, 2)
+        || !TEST_uint64_t_eq(hdr.offset, 0)
+        || !TEST_uint64_t_eq(hdr.len, 8)
+        || !TEST_ptr_eq(iov[1].buf, data_1 + 4)
+        || !TEST_true(compare_iov(data_1, 8, iov, num_iov))
+        || !TEST_true(ossl_quic_sstream_mark_transmitted(sstream, 0, 7)))
+        goto err;
+
+    /* The rest is the second referenced buffer, in place */
+    num_iov = OSSL_NELEM(iov);
+    if (!TEST_true(ossl_quic_sstream_get_stream_frame(sstream, 0, &hdr, iov,
+                                                      &num_iov))
+        || !TEST_size_t_eq(num_iov, 1)
+        || !TEST_uint64_t_eq(hdr.offset, 8)
+        || !TEST_ptr_eq(iov[0].buf, data_1 + 8)
+        || !TEST_true(compare_iov(data_1 + 8, sizeof(data_1) - 8,
+                                  iov, num_iov))
+        || !TEST_true(ossl_quic_sstream_mark_transmitted(sstream, 8,
+                                                         sizeof(data_1) - 1)))
+        goto err;
+
+    /* Acking the second buffer alone does not release anything */
+    if (!TEST_true(ossl_quic_sstream_mark_acked(sstream, 8,
+                                                sizeof(data_1) - 1))
+        || !TEST_size_t_eq(ref_released, 0))
+        goto err;
+
+    /* Acking everything before it releases both, in order */
+    if (!TEST_true(ossl_quic_sstream_mark_acked(sstream, 0, 7))
+        || !TEST_size_t_eq(ref_released, sizeof(data_1) - 4)
+        || !TEST_ptr_eq(released, data_1 + 8)
+        || !TEST_true(ossl_quic_sstream_is_totally_acked(sstream)))
+        goto err;
+
+    /* Copying resumes at the end of the released buffers */
+    if (!TEST_true(ossl_quic_sstream_append(sstream, data_1, 4, &wr))
+        || !TEST_size_t_eq(wr, 4)
+        || !TEST_uint64_t_eq(ossl_quic_sstream_get_cur_size(sstream),
+                             sizeof(data_1) + 4))
+        goto err;
+
+    num_iov = OSSL_NELEM(iov);
+    if (!TEST_true(ossl_quic_sstream_get_stream_frame(sstream, 0, &hdr, iov,
+                                                      &num_iov))
+        || !TEST_uint64_t_eq(hdr.offset, sizeof(data_1))
+        || !TEST_true(compare_iov(data_1, 4, iov, num_iov)))
+        goto err;
+
+    /* A buffer still referenced when the stream is freed is released */
+    ref_released = 0;
+    if (!TEST_true(ossl_quic_sstream_append_ref(sstream, data_1, 2,
+                                                ref_release_cb, &released)))
+        goto err;
+
+    ossl_quic_sstream_fin(sstream);
+    if (!TEST_true(ossl_quic_sstream_get_final_size(sstream, &final_size))
+        || !TEST_uint64_t_eq(final_size, sizeof(data_1) + 6)
+        || !TEST_false(ossl_quic_sstream_append_ref(sstream, data_1, 2,
+                                                    ref_release_cb,
+                                                    &released)))
+        goto err;
+
+    ossl_quic_sstream_free(sstream);
+    sstream = NULL;
+    if (!TEST_size_t_eq(ref_released, 2)
+        || !TEST_ptr_eq(released, data_1))
+        goto err;
+
+    testresult = 1;
+ err:
+    ossl_quic_sstream_free(sstream);
+    return testresult;
+}
+
 static int test_single_copy_read(QUIC_RSTREAM *qrs,
                                  unsigned char *buf, size_t size,
                                  size_t *readbytes, int *fin)
@@ -599,6 +717,7 @@ int setup_tests(void)
 {
     ADD_TEST(test_sstream_simple);
     ADD_ALL_TESTS(test_sstream_bulk, 100);
+    ADD_TEST(test_sstream_ref);
     ADD_ALL_TESTS(test_rstream_simple, 4);
     ADD_ALL_TESTS(test_rstream_random, 100);
     return 1;
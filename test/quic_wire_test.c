@@ -1187,6 +1187,156 @@ static const unsigned char encode_case_23_expect[] = {
     0x80, 0x00, 0x45, 0x45,
 };
 
+/* 24. ACK_FREQUENCY */
+static int encode_case_24_enc(WPACKET *pkt)
+{
+    OSSL_QUIC_FRAME_ACK_FREQUENCY f = {0};
+
+    f.seq_num                   = 0x1234;
+    f.ack_eliciting_threshold   = 3;
+    f.max_ack_delay             = ossl_ms2time(25);
+    f.reordering_threshold      = 1;
+
+    if (!TEST_int_eq(ossl_quic_wire_encode_frame_ack_frequency(pkt, &f), 1))
+        return 0;
+
+    return 1;
+}
+
+static int encode_case_24_dec(PACKET *pkt, ossl_ssize_t fail)
+{
+    OSSL_QUIC_FRAME_ACK_FREQUENCY f = {0};
+
+    if (!TEST_int_eq(ossl_quic_wire_decode_frame_ack_frequency(pkt, &f),
+                     fail < 0))
+        return 0;
+
+    if (fail >= 0)
+        return 1;
+
+    if (!TEST_uint64_t_eq(f.seq_num, 0x1234)
+            || !TEST_uint64_t_eq(f.ack_eliciting_threshold, 3)
+            || !TEST_uint64_t_eq(ossl_time2ms(f.max_ack_delay), 25)
+            || !TEST_uint64_t_eq(f.reordering_threshold, 1))
+        return 0;
+
+    return 1;
+}
+
+static const unsigned char encode_case_24_expect[] = {
+    0x40, 0xAF,                     /* Type */
+    0x52, 0x34,                     /* Sequence Number */
+    0x03,                           /* Ack-Eliciting Threshold */
+    0x80, 0x00, 0x61, 0xA8,         /* Request Max Ack Delay (us) */
+    0x01,                           /* Reordering Threshold */
+};
+
+/* 25. IMMEDIATE_ACK */
+static int encode_case_25_enc(WPACKET *pkt)
+{
+    if (!TEST_int_eq(ossl_quic_wire_encode_frame_immediate_ack(pkt), 1))
+        return 0;
+
+    return 1;
+}
+
+static int encode_case_25_dec(PACKET *pkt, ossl_ssize_t fail)
+{
+    if (!TEST_int_eq(ossl_quic_wire_decode_frame_immediate_ack(pkt), fail < 0))
+        return 0;
+
+    return 1;
+}
+
+static const unsigned char encode_case_25_expect[] = {
+    0x1F
+};
+
+/* 26. DATAGRAM with Length */
+static const unsigned char encode_case_26_data[] = {
+    0x51, 0x52, 0x53, 0x54, 0x55
+};
+
+static int encode_case_26_enc(WPACKET *pkt)
+{
+    OSSL_QUIC_FRAME_DATAGRAM f = {0};
+
+    f.data              = encode_case_26_data;
+    f.len               = sizeof(encode_case_26_data);
+    f.has_explicit_len  = 1;
+
+    if (!TEST_int_eq(ossl_quic_wire_encode_frame_datagram(pkt, &f), 1))
+        return 0;
+
+    return 1;
+}
+
+static int encode_case_26_dec(PACKET *pkt, ossl_ssize_t fail)
+{
+    OSSL_QUIC_FRAME_DATAGRAM f = {0};
+
+    if (!TEST_int_eq(ossl_quic_wire_decode_frame_datagram(pkt, &f), fail < 0))
+        return 0;
+
+    if (fail >= 0)
+        return 1;
+
+    if (!TEST_true(f.has_explicit_len)
+            || !TEST_mem_eq(f.data, (size_t)f.len,
+                            encode_case_26_data, sizeof(encode_case_26_data)))
+        return 0;
+
+    return 1;
+}
+
+static const unsigned char encode_case_26_expect[] = {
+    0x31,                           /* Type */
+    0x05,                           /* Length */
+    0x51, 0x52, 0x53, 0x54, 0x55    /* Data */
+};
+
+/* 27. DATAGRAM without Length */
+static int encode_case_27_enc(WPACKET *pkt)
+{
+    OSSL_QUIC_FRAME_DATAGRAM f = {0};
+
+    f.data              = encode_case_26_data;
+    f.len               = sizeof(encode_case_26_data);
+
+    if (!TEST_int_eq(ossl_quic_wire_encode_frame_datagram(pkt, &f), 1))
+        return 0;
+
+    return 1;
+}
+
+static int encode_case_27_dec(PACKET *pkt, ossl_ssize_t fail)
+{
+    OSSL_QUIC_FRAME_DATAGRAM f = {0};
+
+    /*
+     * Without a length field the frame extends to the end of the packet, so
+     * any truncation which leaves the type intact still decodes.
+     */
+    if (!TEST_int_eq(ossl_quic_wire_decode_frame_datagram(pkt, &f), fail != 0))
+        return 0;
+
+    if (fail == 0)
+        return 1;
+
+    if (!TEST_false(f.has_explicit_len)
+            || !TEST_mem_eq(f.data, (size_t)f.len, encode_case_26_data,
+                            fail < 0 ? sizeof(encode_case_26_data)
+                                     : (size_t)fail - 1))
+        return 0;
+
+    return 1;
+}
+
+static const unsigned char encode_case_27_expect[] = {
+    0x30,                           /* Type */
+    0x51, 0x52, 0x53, 0x54, 0x55    /* Data */
+};
+
 #define ENCODE_CASE(n)                          \
     {                                           \
       encode_case_##n##_enc,                    \
@@ -1220,6 +1370,10 @@ static const struct encode_test_case encode_cases[] = {
     ENCODE_CASE(21)
     ENCODE_CASE(22)
     ENCODE_CASE(23)
+    ENCODE_CASE(24)
+    ENCODE_CASE(25)
+    ENCODE_CASE(26)
+    ENCODE_CASE(27)
 };
 
 static int test_wire_encode(int idx)
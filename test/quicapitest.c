@@ -20,6 +20,7 @@
 #include "testutil/output.h"
 #include "../ssl/ssl_local.h"
 #include "internal/quic_error.h"
+#include "internal/quic_lb.h"
 
 static OSSL_LIB_CTX *libctx = NULL;
 static OSSL_PROVIDER *defctxnull = NULL;
@@ -1000,6 +1001,115 @@ static int test_back_pressure(void)
     return testresult;
 }
 
+static size_t zero_copy_released;
+
+static void zero_copy_release_cb(const void *buf, size_t buf_len, void *arg)
+{
+    zero_copy_released += buf_len;
+}
+
+/*
+ * Test SSL_write_ref(), SSL_borrow_read_buf() and SSL_release_read_buf().
+ */
+static int test_zero_copy(void)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    int testresult = 0, i;
+    static const char msg1[] = "Hello, ", msg2[] = "zero-copy world";
+    const size_t msglen = sizeof(msg1) - 1 + sizeof(msg2) - 1;
+    const unsigned char *rbuf = NULL;
+    unsigned char buf[64];
+    size_t readbytes = 0, rlen = 0, written = 0;
+
+    zero_copy_released = 0;
+
+    if (!TEST_ptr(cctx)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, NULL, cert,
+                                                    privkey, 0, &qtserv,
+                                                    &clientquic, NULL, NULL))
+            || !TEST_true(qtest_create_quic_connection(qtserv, clientquic)))
+        goto err;
+
+    /* Send two referenced buffers from the client */
+    if (!TEST_true(SSL_write_ref(clientquic, msg1, sizeof(msg1) - 1, 0,
+                                 zero_copy_release_cb, NULL))
+            || !TEST_true(SSL_write_ref(clientquic, msg2, sizeof(msg2) - 1, 0,
+                                        zero_copy_release_cb, NULL))
+            || !TEST_false(SSL_write_ref(clientquic, msg1, 0, 0,
+                                         zero_copy_release_cb, NULL)))
+        goto err;
+
+    /* Copying writes are held back while the buffers are referenced */
+    if (!TEST_false(SSL_write_ex(clientquic, msg1, 1, &written))
+            || !TEST_int_eq(SSL_get_error(clientquic, 0), SSL_ERROR_WANT_WRITE))
+        goto err;
+
+    /* The buffers are released once the server has acknowledged them */
+    for (i = 0; i < 1000 && zero_copy_released < msglen; i++) {
+        ossl_quic_tserver_tick(qtserv);
+        if (!TEST_true(ossl_quic_tserver_read(qtserv, 0, buf + readbytes,
+                                              sizeof(buf) - readbytes, &rlen)))
+            goto err;
+        readbytes += rlen;
+        SSL_handle_events(clientquic);
+        if (zero_copy_released < msglen)
+            OSSL_sleep(1);
+    }
+
+    if (!TEST_size_t_eq(zero_copy_released, msglen)
+            || !TEST_mem_eq(buf, readbytes, "Hello, zero-copy world", msglen))
+        goto err;
+
+    /* Retrying the held back write now succeeds */
+    if (!TEST_true(SSL_write_ex(clientquic, msg1, 1, &written))
+            || !TEST_size_t_eq(written, 1))
+        goto err;
+
+    /* Send data from the server and borrow it at the client */
+    if (!TEST_true(ossl_quic_tserver_write(qtserv, 0,
+                                           (const unsigned char *)msg2,
+                                           sizeof(msg2) - 1, &written))
+            || !TEST_true(ossl_quic_tserver_conclude(qtserv, 0)))
+        goto err;
+
+    ossl_quic_tserver_tick(qtserv);
+
+    if (!TEST_false(SSL_release_read_buf(clientquic, 0))
+            || !TEST_true(SSL_borrow_read_buf(clientquic, &rbuf, &rlen))
+            || !TEST_mem_eq(rbuf, rlen, msg2, sizeof(msg2) - 1))
+        goto err;
+
+    /* Nothing else may read the stream until the buffer is released */
+    if (!TEST_false(SSL_read_ex(clientquic, buf, sizeof(buf), &readbytes))
+            || !TEST_false(SSL_borrow_read_buf(clientquic, &rbuf, &rlen))
+            || !TEST_false(SSL_release_read_buf(clientquic, sizeof(msg2))))
+        goto err;
+
+    /* Consume part of it; the rest is returned again */
+    if (!TEST_true(SSL_release_read_buf(clientquic, 5))
+            || !TEST_size_t_eq(SSL_pending(clientquic), sizeof(msg2) - 1 - 5)
+            || !TEST_true(SSL_borrow_read_buf(clientquic, &rbuf, &rlen))
+            || !TEST_mem_eq(rbuf, rlen, msg2 + 5, sizeof(msg2) - 1 - 5)
+            || !TEST_true(SSL_release_read_buf(clientquic, rlen)))
+        goto err;
+
+    /* Then the end of the stream is reported */
+    if (!TEST_false(SSL_borrow_read_buf(clientquic, &rbuf, &rlen))
+            || !TEST_int_eq(SSL_get_error(clientquic, 0), SSL_ERROR_ZERO_RETURN)
+            || !TEST_int_eq(SSL_get_stream_read_state(clientquic),
+                            SSL_STREAM_STATE_FINISHED))
+        goto err;
+
+    testresult = 1;
+ err:
+    SSL_free(clientquic);
+    ossl_quic_tserver_free(qtserv);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
 
 static int dgram_ctr = 0;
 
@@ -1046,7 +1156,482 @@ static int test_multiple_dgrams(void)
 
     testresult = 1;
  err:
-    OPENSSL_free(buf);
+    OPENSSL_free(buf);
+    SSL_free(clientquic);
+    ossl_quic_tserver_free(qtserv);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+static const char *cc_names[] = { "newreno", "cubic", "bbr" };
+
+/* Test that we can select the congestion controller of a connection */
+static int test_congestion_control(int idx)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    int testresult = 0;
+    unsigned char *buf;
+    const size_t buflen = 32 * 1024;
+    size_t written;
+
+    buf = OPENSSL_zalloc(buflen);
+
+    if (!TEST_ptr(cctx)
+            || !TEST_ptr(buf)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, NULL, cert,
+                                                    privkey, 0, &qtserv,
+                                                    &clientquic, NULL, NULL)))
+        goto err;
+
+    if (!TEST_false(SSL_set_quic_congestion_control(clientquic, "unknown"))
+            || !TEST_true(SSL_set_quic_congestion_control(clientquic,
+                                                          cc_names[idx]))
+            || !TEST_true(qtest_create_quic_connection(qtserv, clientquic)))
+        goto err;
+
+    /* It is too late to change it once the connection has started */
+    if (!TEST_false(SSL_set_quic_congestion_control(clientquic,
+                                                    cc_names[idx])))
+        goto err;
+
+    ERR_clear_error();
+    if (!TEST_true(SSL_write_ex(clientquic, buf, buflen, &written))
+            || !TEST_size_t_eq(written, buflen))
+        goto err;
+
+    testresult = 1;
+ err:
+    OPENSSL_free(buf);
+    SSL_free(clientquic);
+    ossl_quic_tserver_free(qtserv);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+static int ack_freq_ctr = 0;
+
+static void ack_freq_cb(int write_p, int version, int content_type,
+                        const void *buf, size_t msglen, SSL *ssl, void *arg)
+{
+    const unsigned char *p = buf;
+
+    if (write_p || content_type != SSL3_RT_QUIC_FRAME_FULL || msglen < 2)
+        return;
+
+    /* ACK_FREQUENCY is encoded as the two byte varint 0x40 0xAF */
+    if (p[0] == 0x40 && p[1] == 0xAF)
+        ack_freq_ctr++;
+}
+
+/*
+ * Test that a sender asks the peer to ACK less often once its congestion
+ * window has grown during a bulk transfer.
+ */
+static int test_ack_frequency(void)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    int testresult = 0;
+    unsigned char *msg = NULL;
+    const size_t msglen = 16 * 1024;
+    unsigned char buf[4096];
+    size_t readbytes, written;
+    int i;
+
+    if (!TEST_ptr(cctx)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, NULL, cert,
+                                                    privkey, 0, &qtserv,
+                                                    &clientquic, NULL, NULL))
+            || !TEST_true(qtest_create_quic_connection(qtserv, clientquic)))
+        goto err;
+
+    msg = OPENSSL_zalloc(msglen);
+    if (!TEST_ptr(msg))
+        goto err;
+
+    /* The frame is sent by the client, so watch for it at the server */
+    ack_freq_ctr = 0;
+    ossl_quic_tserver_set_msg_callback(qtserv, ack_freq_cb, NULL);
+
+    for (i = 0; i < 64 && ack_freq_ctr == 0; i++) {
+        if (!TEST_true(SSL_write_ex(clientquic, msg, msglen, &written)))
+            goto err;
+
+        /* Drain the data at the server so flow control never blocks us */
+        do {
+            ossl_quic_tserver_tick(qtserv);
+            if (!TEST_true(ossl_quic_tserver_read(qtserv, 0, buf, sizeof(buf),
+                                                  &readbytes)))
+                goto err;
+            SSL_handle_events(clientquic);
+        } while (readbytes > 0);
+    }
+
+    if (!TEST_int_gt(ack_freq_ctr, 0))
+        goto err;
+
+    testresult = 1;
+ err:
+    SSL_free(clientquic);
+    ossl_quic_tserver_free(qtserv);
+    SSL_CTX_free(cctx);
+    OPENSSL_free(msg);
+
+    return testresult;
+}
+
+/*
+ * Sends msg on the default stream, and drives the connection until the server
+ * has read it, returning the number of round trips this took, or 0 on failure.
+ * The message is sent as 0-RTT data if early is set.
+ */
+static int rtts_to_first_byte(QUIC_TSERVER *qtserv, SSL *clientquic,
+                              const char *msg, int early)
+{
+    unsigned char buf[64];
+    size_t msglen = strlen(msg), written = 0, readbytes = 0, total = 0;
+    int rtts, sent = 0;
+
+    for (rtts = 1; rtts <= MAXLOOPS; rtts++) {
+        if (!sent) {
+            if (early)
+                sent = SSL_write_early_data(clientquic, msg, msglen, &written);
+            else
+                sent = SSL_write_ex(clientquic, msg, msglen, &written);
+
+            if (!sent && SSL_get_error(clientquic, 0) != SSL_ERROR_WANT_READ)
+                return 0;
+        }
+
+        SSL_handle_events(clientquic);
+        ossl_quic_tserver_tick(qtserv);
+
+        if (!ossl_quic_tserver_read(qtserv, 0, buf + total,
+                                    sizeof(buf) - total, &readbytes))
+            return 0;
+
+        total += readbytes;
+        if (total == msglen)
+            return TEST_mem_eq(buf, total, msg, msglen) ? rtts : 0;
+
+        qtest_add_time(1);
+    }
+
+    return 0;
+}
+
+static int reject_early_data_cb(SSL *s, void *arg)
+{
+    return 0;
+}
+
+/*
+ * Test 0-RTT data.
+ * Test 0: 0-RTT data is accepted
+ * Test 1: 0-RTT data is rejected by the server and resent as 1-RTT data
+ * Test 2: 0-RTT data is rejected because the session ticket was replayed
+ */
+static int test_quic_0rtt(int idx)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL_CTX *sctx = NULL;
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    SSL_SESSION *sess = NULL;
+    static const char *msg = "A test message";
+    unsigned char buf[20];
+    size_t numbytes;
+    int testresult = 0, full_rtts = 0, early_rtts = 0, i;
+
+    /* Do a full handshake to get a session ticket which allows 0-RTT */
+    if (!TEST_ptr(cctx)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, NULL, cert,
+                                                    privkey, 0, &qtserv,
+                                                    &clientquic, NULL, NULL))
+            || !TEST_true(ossl_quic_tserver_set_max_early_data(qtserv,
+                                                               0xffffffff)))
+        goto err;
+
+    /* Using 0-RTT requires a session */
+    if (!TEST_false(SSL_write_early_data(clientquic, msg, strlen(msg),
+                                         &numbytes)))
+        goto err;
+    ERR_clear_error();
+
+    if (!TEST_int_gt(full_rtts = rtts_to_first_byte(qtserv, clientquic, msg,
+                                                    0), 0)
+            || !TEST_int_eq(SSL_get_early_data_status(clientquic),
+                            SSL_EARLY_DATA_NOT_SENT))
+        goto err;
+
+    /* Have the server reply so that the client gets its session tickets */
+    if (!TEST_true(ossl_quic_tserver_write(qtserv, 0, (unsigned char *)msg,
+                                           strlen(msg), &numbytes)))
+        goto err;
+    ossl_quic_tserver_tick(qtserv);
+    if (!TEST_true(SSL_read_ex(clientquic, buf, sizeof(buf), &numbytes))
+            || !TEST_mem_eq(buf, numbytes, msg, strlen(msg))
+            || !TEST_ptr(sess = SSL_get1_session(clientquic))
+            || !TEST_uint_eq(SSL_SESSION_get_max_early_data(sess), 0xffffffff))
+        goto err;
+
+    /* 0-RTT can only be started before the connection is */
+    if (!TEST_false(SSL_write_early_data(clientquic, msg, strlen(msg),
+                                         &numbytes)))
+        goto err;
+    ERR_clear_error();
+
+    sctx = ossl_quic_tserver_get0_ssl_ctx(qtserv);
+    if (!TEST_true(SSL_CTX_up_ref(sctx))) {
+        sctx = NULL;
+        goto err;
+    }
+
+    if (idx == 1)
+        SSL_CTX_set_allow_early_data_cb(sctx, reject_early_data_cb, NULL);
+
+    for (i = 0; i < (idx == 2 ? 2 : 1); i++) {
+        /*
+         * Shut down cleanly, as otherwise the session is treated as bad and
+         * the server drops its single use ticket from the session cache.
+         */
+        if (!TEST_true(qtest_shutdown(qtserv, clientquic)))
+            goto err;
+        ossl_quic_tserver_shutdown(qtserv, 0);
+
+        SSL_free(clientquic);
+        clientquic = NULL;
+        ossl_quic_tserver_free(qtserv);
+        qtserv = NULL;
+
+        if (!TEST_true(qtest_create_quic_objects(libctx, cctx, sctx, cert,
+                                                 privkey, 0, &qtserv,
+                                                 &clientquic, NULL, NULL))
+                || !TEST_true(ossl_quic_tserver_set_max_early_data(qtserv,
+                                                                   0xffffffff))
+                || !TEST_true(SSL_set_session(clientquic, sess))
+                || !TEST_int_gt(early_rtts = rtts_to_first_byte(qtserv,
+                                                                clientquic,
+                                                                msg, 1), 0)
+                || !TEST_true(qtest_create_quic_connection(qtserv, clientquic))
+                /* A replayed ticket is not found, so it is a full handshake */
+                || !TEST_int_eq(SSL_session_reused(clientquic), i == 0))
+            goto err;
+    }
+
+    if (idx == 0) {
+        if (!TEST_int_eq(SSL_get_early_data_status(clientquic),
+                         SSL_EARLY_DATA_ACCEPTED)
+                || !TEST_int_lt(early_rtts, full_rtts))
+            goto err;
+
+        TEST_info("round trips to first byte: full handshake %d, 0-RTT %d",
+                  full_rtts, early_rtts);
+    } else {
+        if (!TEST_int_eq(SSL_get_early_data_status(clientquic),
+                         SSL_EARLY_DATA_REJECTED))
+            goto err;
+    }
+
+    /* The connection is usable afterwards in both directions */
+    if (!TEST_true(SSL_write_ex(clientquic, msg, strlen(msg), &numbytes))
+            || !TEST_true(ossl_quic_tserver_write(qtserv, 0,
+                                                  (unsigned char *)msg,
+                                                  strlen(msg), &numbytes)))
+        goto err;
+    ossl_quic_tserver_tick(qtserv);
+    if (!TEST_true(SSL_read_ex(clientquic, buf, sizeof(buf), &numbytes))
+            || !TEST_mem_eq(buf, numbytes, msg, strlen(msg)))
+        goto err;
+
+    testresult = 1;
+ err:
+    SSL_SESSION_free(sess);
+    SSL_free(clientquic);
+    ossl_quic_tserver_free(qtserv);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+static int corrupt_next_dgram;
+
+static int corrupt_dgram_cb(QTEST_FAULT *fault, BIO_MSG *m, size_t stride,
+                            void *cbarg)
+{
+    if (!corrupt_next_dgram || m->data_len == 0)
+        return 1;
+
+    /* A truncated datagram fails to decrypt, so is effectively lost */
+    if (qtest_fault_resize_datagram(fault, m->data_len - 1))
+        corrupt_next_dgram = 0;
+
+    return 1;
+}
+
+/*
+ * Test 0: Exchange datagrams in both directions
+ * Test 1: Only the client accepts datagrams
+ * Test 2: A lost packet holds up stream data, but not a datagram sent after it
+ */
+static int test_quic_datagram(int idx)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    QTEST_FAULT *fault = NULL;
+    static const char *msg = "A test message";
+    static unsigned char big[1200];
+    unsigned char buf[1200];
+    size_t msglen = strlen(msg), maxlen, numbytes, total = 0;
+    uint64_t sid;
+    int testresult = 0, ms;
+
+    if (!TEST_ptr(cctx)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, NULL, cert,
+                                                    privkey,
+                                                    idx == 2 ? QTEST_FLAG_FAKE_TIME
+                                                             : 0,
+                                                    &qtserv, &clientquic,
+                                                    &fault, NULL))
+            || !TEST_true(SSL_set_max_datagram_frame_size(clientquic,
+                                                          sizeof(buf)))
+            || (idx != 1
+                && !TEST_true(ossl_quic_tserver_set_max_datagram_frame_size(qtserv,
+                                                                            sizeof(buf))))
+            || !TEST_size_t_eq(SSL_get_max_datagram_size(clientquic), 0)
+            || !TEST_true(qtest_create_quic_connection(qtserv, clientquic)))
+        goto err;
+
+    /* The transport parameter has been sent, so can no longer be changed */
+    if (!TEST_false(SSL_set_max_datagram_frame_size(clientquic, 0)))
+        goto err;
+    ERR_clear_error();
+
+    if (idx == 1) {
+        if (!TEST_size_t_eq(SSL_get_max_datagram_size(clientquic), 0)
+                || !TEST_false(SSL_send_datagram(clientquic, msg, msglen)))
+            goto err;
+        ERR_clear_error();
+
+        /* The server may still send datagrams to the client */
+        if (!TEST_true(ossl_quic_tserver_send_datagram(qtserv,
+                                                       (unsigned char *)msg,
+                                                       msglen))
+                || !TEST_true(SSL_recv_datagram(clientquic, buf, sizeof(buf),
+                                                &numbytes))
+                || !TEST_mem_eq(buf, numbytes, msg, msglen))
+            goto err;
+
+        testresult = 1;
+        goto err;
+    }
+
+    /* A datagram and its frame must fit both in a packet and the peer limit */
+    maxlen = SSL_get_max_datagram_size(clientquic);
+    if (!TEST_size_t_gt(maxlen, msglen)
+            || !TEST_size_t_lt(maxlen, sizeof(buf))
+            || !TEST_false(SSL_send_datagram(clientquic, big, maxlen + 1)))
+        goto err;
+    ERR_clear_error();
+
+    if (idx == 0) {
+        if (!TEST_false(SSL_recv_datagram(clientquic, buf, sizeof(buf),
+                                          &numbytes))
+                || !TEST_int_eq(SSL_get_error(clientquic, 0),
+                                SSL_ERROR_WANT_READ))
+            goto err;
+
+        memset(big, 'x', maxlen);
+        if (!TEST_true(SSL_send_datagram(clientquic, msg, msglen))
+                || !TEST_true(SSL_send_datagram(clientquic, big, maxlen))
+                || !TEST_true(SSL_send_datagram(clientquic, NULL, 0)))
+            goto err;
+
+        ossl_quic_tserver_tick(qtserv);
+        if (!TEST_true(ossl_quic_tserver_recv_datagram(qtserv, buf, sizeof(buf),
+                                                       &numbytes))
+                || !TEST_mem_eq(buf, numbytes, msg, msglen)
+                || !TEST_true(ossl_quic_tserver_recv_datagram(qtserv, buf,
+                                                              sizeof(buf),
+                                                              &numbytes))
+                || !TEST_mem_eq(buf, numbytes, big, maxlen)
+                || !TEST_true(ossl_quic_tserver_recv_datagram(qtserv, buf,
+                                                              sizeof(buf),
+                                                              &numbytes))
+                || !TEST_size_t_eq(numbytes, 0)
+                || !TEST_false(ossl_quic_tserver_recv_datagram(qtserv, buf,
+                                                               sizeof(buf),
+                                                               &numbytes)))
+            goto err;
+
+        /* A datagram is truncated to fit the buffer */
+        if (!TEST_true(ossl_quic_tserver_send_datagram(qtserv,
+                                                       (unsigned char *)msg,
+                                                       msglen))
+                || !TEST_true(SSL_recv_datagram(clientquic, buf, 4, &numbytes))
+                || !TEST_mem_eq(buf, numbytes, msg, 4))
+            goto err;
+
+        testresult = 1;
+        goto err;
+    }
+
+    /* Lose the packet carrying the start of a stream */
+    if (!TEST_true(qtest_fault_set_datagram_listener(fault, corrupt_dgram_cb,
+                                                     NULL))
+            || !TEST_true(ossl_quic_tserver_stream_new(qtserv, /*is_uni=*/0,
+                                                       &sid)))
+        goto err;
+
+    corrupt_next_dgram = 1;
+    if (!TEST_true(ossl_quic_tserver_write(qtserv, sid, (unsigned char *)msg,
+                                           5, &numbytes))
+            || !TEST_false(corrupt_next_dgram)
+            || !TEST_true(ossl_quic_tserver_write(qtserv, sid,
+                                                  (unsigned char *)msg + 5,
+                                                  msglen - 5, &numbytes))
+            || !TEST_true(ossl_quic_tserver_send_datagram(qtserv,
+                                                          (unsigned char *)msg,
+                                                          msglen)))
+        goto err;
+
+    /* The datagram arrives at once, while the stream waits for the resend */
+    if (!TEST_true(SSL_recv_datagram(clientquic, buf, sizeof(buf), &numbytes))
+            || !TEST_mem_eq(buf, numbytes, msg, msglen)
+            || !TEST_false(SSL_read_ex(clientquic, buf, sizeof(buf), &numbytes))
+            || !TEST_int_eq(SSL_get_error(clientquic, 0), SSL_ERROR_WANT_READ))
+        goto err;
+
+    for (ms = 0; total < msglen; ms++) {
+        if (!TEST_int_lt(ms, 1000))
+            goto err;
+
+        qtest_add_time(1);
+        ossl_quic_tserver_tick(qtserv);
+        if (SSL_read_ex(clientquic, buf + total, sizeof(buf) - total,
+                        &numbytes))
+            total += numbytes;
+        else if (!TEST_int_eq(SSL_get_error(clientquic, 0),
+                              SSL_ERROR_WANT_READ))
+            goto err;
+    }
+
+    if (!TEST_mem_eq(buf, total, msg, msglen))
+        goto err;
+
+    TEST_info("after a packet loss: datagram delivered at once, stream data after %d ms",
+              ms);
+
+    testresult = 1;
+ err:
+    qtest_fault_free(fault);
     SSL_free(clientquic);
     ossl_quic_tserver_free(qtserv);
     SSL_CTX_free(cctx);
@@ -1882,188 +2467,930 @@ static int tparam_handle(struct tparam_ctx *ctx,
                                                                   data, data_len)))
             return 0;
 
-        if (id == t->id)
-            data[0] ^= 1;
+        if (id == t->id)
+            data[0] ^= 1;
+
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+
+static int tparam_on_enc_ext(QTEST_FAULT *qtf, QTEST_ENCRYPTED_EXTENSIONS *ee,
+                             size_t ee_len, void *arg)
+{
+    int rc = 0;
+    struct tparam_ctx *ctx = arg;
+    PACKET pkt = {0};
+    WPACKET wpkt;
+    int have_wpkt = 0;
+    BUF_MEM *old_bufm = NULL, *new_bufm = NULL;
+    unsigned char *tp_p;
+    size_t tp_len, written, old_len, eb_len;
+    uint64_t id;
+
+    if (!TEST_ptr(old_bufm = BUF_MEM_new()))
+        goto err;
+
+    /*
+     * Delete transport parameters TLS extension and capture the contents of the
+     * extension which was removed.
+     */
+    if (!TEST_true(qtest_fault_delete_extension(qtf, TLSEXT_TYPE_quic_transport_parameters,
+                                                ee->extensions, &ee->extensionslen,
+                                                old_bufm)))
+        goto err;
+
+    if (!TEST_true(PACKET_buf_init(&pkt, (unsigned char *)old_bufm->data, old_bufm->length))
+        || !TEST_ptr(new_bufm = BUF_MEM_new())
+        || !TEST_true(WPACKET_init(&wpkt, new_bufm)))
+        goto err;
+
+    have_wpkt = 1;
+
+    /*
+     * Open transport parameters TLS extension:
+     *
+     *   u16  Extension ID (quic_transport_parameters)
+     *   u16  Extension Data Length
+     *   ...  Extension Data
+     *
+     */
+    if (!TEST_true(WPACKET_put_bytes_u16(&wpkt,
+                                         TLSEXT_TYPE_quic_transport_parameters))
+        || !TEST_true(WPACKET_start_sub_packet_u16(&wpkt)))
+        goto err;
+
+    for (; PACKET_remaining(&pkt) > 0; ) {
+        tp_p = (unsigned char *)ossl_quic_wire_decode_transport_param_bytes(&pkt,
+                                                                            &id,
+                                                                            &tp_len);
+        if (!TEST_ptr(tp_p)) {
+            TEST_mem_eq(PACKET_data(&pkt), PACKET_remaining(&pkt), NULL, 0);
+            goto err;
+        }
+
+        if (!TEST_true(tparam_handle(ctx, id, tp_p, tp_len, &wpkt)))
+            goto err;
+    }
+
+    if (ctx->t->op == TPARAM_OP_INJECT || ctx->t->op == TPARAM_OP_DROP_INJECT
+        || ctx->t->op == TPARAM_OP_INJECT_TWICE) {
+        if (!TEST_ptr(ossl_quic_wire_encode_transport_param_bytes(&wpkt, ctx->t->id,
+                                                                  ctx->t->buf,
+                                                                  ctx->t->buf_len)))
+            goto err;
+
+        if (ctx->t->op == TPARAM_OP_INJECT_TWICE
+            && !TEST_ptr(ossl_quic_wire_encode_transport_param_bytes(&wpkt, ctx->t->id,
+                                                                     ctx->t->buf,
+                                                                     ctx->t->buf_len)))
+            goto err;
+    } else if (ctx->t->op == TPARAM_OP_INJECT_RAW) {
+        if (!TEST_true(WPACKET_memcpy(&wpkt, ctx->t->buf, ctx->t->buf_len)))
+            goto err;
+    }
+
+    if (!TEST_true(WPACKET_close(&wpkt))) /* end extension data, set length */
+        goto err;
+
+    if (!TEST_true(WPACKET_get_total_written(&wpkt, &written)))
+        goto err;
+
+    WPACKET_finish(&wpkt);
+    have_wpkt = 0;
+
+    /*
+     * Append the constructed extension blob to the extension block.
+     */
+    old_len = ee->extensionslen;
+
+    if (!qtest_fault_resize_message(qtf, ee->extensionslen + written))
+        goto err;
+
+    memcpy(ee->extensions + old_len, new_bufm->data, written);
+
+    /* Fixup the extension block header (u16 length of entire block). */
+    eb_len = (((uint16_t)ee->extensions[0]) << 8) + (uint16_t)ee->extensions[1];
+    eb_len += written;
+    ee->extensions[0] = (unsigned char)((eb_len >> 8) & 0xFF);
+    ee->extensions[1] = (unsigned char)( eb_len       & 0xFF);
+
+    rc = 1;
+err:
+    if (have_wpkt)
+        WPACKET_cleanup(&wpkt);
+    BUF_MEM_free(old_bufm);
+    BUF_MEM_free(new_bufm);
+    return rc;
+}
+
+static int test_tparam(int idx)
+{
+    int testresult = 0;
+    SSL_CTX *c_ctx = NULL;
+    SSL *c_ssl = NULL;
+    QUIC_TSERVER *s = NULL;
+    QTEST_FAULT *qtf = NULL;
+    struct tparam_ctx ctx = {0};
+
+    ctx.t = &tparam_tests[idx];
+
+    if (!TEST_ptr(c_ctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method())))
+        goto err;
+
+    if (!TEST_true(qtest_create_quic_objects(libctx, c_ctx, NULL, cert,
+                                             privkey, 0, &s,
+                                             &c_ssl, &qtf, NULL)))
+        goto err;
+
+    if (!TEST_true(qtest_fault_set_hand_enc_ext_listener(qtf, tparam_on_enc_ext,
+                                                         &ctx)))
+        goto err;
+
+    if (!TEST_true(qtest_create_quic_connection_ex(s, c_ssl,
+                                                   ctx.t->expect_fail != NULL)))
+        goto err;
+
+    if (ctx.t->expect_fail != NULL) {
+        SSL_CONN_CLOSE_INFO info = {0};
+
+        if (!TEST_true(SSL_get_conn_close_info(c_ssl, &info, sizeof(info))))
+            goto err;
+
+        if (!TEST_true((info.flags & SSL_CONN_CLOSE_FLAG_TRANSPORT) != 0)
+            || !TEST_uint64_t_eq(info.error_code, QUIC_ERR_TRANSPORT_PARAMETER_ERROR)
+            || !TEST_ptr(strstr(info.reason, ctx.t->expect_fail))) {
+            TEST_error("expected connection closure information mismatch"
+                       " during TPARAM test: flags=%llu ec=%llu reason='%s'",
+                       (unsigned long long)info.flags,
+                       (unsigned long long)info.error_code,
+                       info.reason);
+            goto err;
+        }
+    }
+
+    testresult = 1;
+err:
+    if (!testresult) {
+        if (ctx.t->expect_fail != NULL)
+            TEST_info("failed during test for id=%llu, op=%d, bl=%zu, "
+                      "expected failure='%s'", (unsigned long long)ctx.t->id,
+                      ctx.t->op, ctx.t->buf_len, ctx.t->expect_fail);
+        else
+            TEST_info("failed during test for id=%llu, op=%d, bl=%zu",
+                      (unsigned long long)ctx.t->id, ctx.t->op, ctx.t->buf_len);
+    }
+
+    ossl_quic_tserver_free(s);
+    SSL_free(c_ssl);
+    SSL_CTX_free(c_ctx);
+    qtest_fault_free(qtf);
+    return testresult;
+}
+
+static int listener_alpn_select_cb(SSL *ssl, const unsigned char **out,
+                                   unsigned char *outlen,
+                                   const unsigned char *in, unsigned int inlen,
+                                   void *arg)
+{
+    static const unsigned char alpn[] = { 8, 'o', 's', 's', 'l', 't', 'e', 's', 't' };
+
+    if (SSL_select_next_proto((unsigned char **)out, outlen, alpn,
+                              sizeof(alpn), in, inlen) != OPENSSL_NPN_NEGOTIATED)
+        return SSL_TLSEXT_ERR_ALERT_FATAL;
+
+    return SSL_TLSEXT_ERR_OK;
+}
+
+#define NUM_LISTENER_CLIENTS    100
+
+/*
+ * Send a message naming the client from each of |num| connected clients, and
+ * check that each of the |num| accepted connections receives the message of
+ * a different client. Then answer each message on the connection it arrived
+ * on, and check that the answer gets back to the client which sent it.
+ */
+static int listener_check_data(SSL **clients, SSL **conns, size_t num,
+                               OSSL_TIME deadline)
+{
+    static const char prefix[] = "Hello from client ";
+    int seen[NUM_LISTENER_CLIENTS] = { 0 };
+    int received[NUM_LISTENER_CLIENTS] = { 0 };
+    size_t i, num_received = 0, written, readbytes, len;
+    unsigned long k;
+    char msg[64], buf[64], *end;
+
+    if (!TEST_size_t_le(num, NUM_LISTENER_CLIENTS))
+        return 0;
+
+    for (i = 0; i < num; i++) {
+        len = BIO_snprintf(msg, sizeof(msg), "%s%u", prefix, (unsigned int)i);
+        if (!TEST_true(SSL_write_ex(clients[i], msg, len, &written))
+                || !TEST_size_t_eq(written, len))
+            return 0;
+    }
+
+    while (num_received < num) {
+        if (!TEST_true(ossl_time_compare(ossl_time_now(), deadline) < 0))
+            return 0;
+
+        for (i = 0; i < num; i++) {
+            if (received[i])
+                continue;
+
+            if (SSL_read_ex(conns[i], buf, sizeof(buf) - 1, &readbytes)) {
+                buf[readbytes] = '\0';
+                if (!TEST_size_t_gt(readbytes, sizeof(prefix) - 1)
+                        || !TEST_strn_eq(buf, prefix, sizeof(prefix) - 1))
+                    return 0;
+                k = strtoul(buf + sizeof(prefix) - 1, &end, 10);
+                if (!TEST_char_eq(*end, '\0')
+                        || !TEST_ulong_lt(k, num)
+                        || !TEST_false(seen[k]))
+                    return 0;
+                seen[k] = 1;
+                received[i] = 1;
+                num_received++;
+
+                /* Echo the message back to its client */
+                if (!TEST_true(SSL_write_ex(conns[i], buf, readbytes,
+                                            &written))
+                        || !TEST_size_t_eq(written, readbytes))
+                    return 0;
+            } else if (!TEST_int_eq(SSL_get_error(conns[i], 0),
+                                    SSL_ERROR_WANT_READ)) {
+                return 0;
+            }
+
+            if (!TEST_true(SSL_handle_events(clients[i])))
+                return 0;
+        }
+    }
+
+    memset(received, 0, sizeof(received));
+    for (num_received = 0; num_received < num;) {
+        if (!TEST_true(ossl_time_compare(ossl_time_now(), deadline) < 0))
+            return 0;
+
+        for (i = 0; i < num; i++) {
+            if (received[i])
+                continue;
+
+            if (SSL_read_ex(clients[i], buf, sizeof(buf), &readbytes)) {
+                len = BIO_snprintf(msg, sizeof(msg), "%s%u", prefix,
+                                   (unsigned int)i);
+                if (!TEST_mem_eq(buf, readbytes, msg, len))
+                    return 0;
+                received[i] = 1;
+                num_received++;
+            } else if (!TEST_int_eq(SSL_get_error(clients[i], 0),
+                                    SSL_ERROR_WANT_READ)) {
+                return 0;
+            }
+
+            if (!TEST_true(SSL_handle_events(conns[i])))
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Test that a listener accepts many connections over a single UDP socket, and
+ * that data gets from each client to its own connection and back.
+ */
+static int test_quic_listener(void)
+{
+    static const unsigned char alpn[] = { 8, 'o', 's', 's', 'l', 't', 'e', 's', 't' };
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *listener = NULL;
+    SSL *clients[NUM_LISTENER_CLIENTS] = { NULL };
+    SSL *conns[NUM_LISTENER_CLIENTS] = { NULL };
+    int connected[NUM_LISTENER_CLIENTS] = { 0 };
+    BIO_ADDR *saddr = NULL;
+    BIO *bio;
+    int cfd = -1, sfd = -1, fd, ret, testresult = 0;
+    size_t i, num_conns = 0, num_connected = 0, loops;
+
+    if (!TEST_ptr(sctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_server_method()))
+            || !TEST_ptr(cctx = SSL_CTX_new_ex(libctx, NULL,
+                                               OSSL_QUIC_client_method())))
+        goto err;
+
+    if (!TEST_int_eq(SSL_CTX_use_certificate_file(sctx, cert,
+                                                  SSL_FILETYPE_PEM), 1)
+            || !TEST_int_eq(SSL_CTX_use_PrivateKey_file(sctx, privkey,
+                                                        SSL_FILETYPE_PEM), 1))
+        goto err;
+    SSL_CTX_set_alpn_select_cb(sctx, listener_alpn_select_cb, NULL);
+
+    /* Server connections can only be obtained from a listener */
+    if (!TEST_ptr_null(SSL_new(sctx))
+            || !TEST_ptr_null(SSL_new_listener(cctx, 0)))
+        goto err;
+    ERR_clear_error();
+
+    if (!TEST_ptr(saddr = BIO_ADDR_new())
+            || !TEST_true(create_test_sockets(&cfd, &sfd, SOCK_DGRAM, saddr)))
+        goto err;
+
+    if (!TEST_ptr(listener = SSL_new_listener(sctx, 0))
+            || !TEST_true(SSL_is_listener(listener))
+            || !TEST_true(SSL_is_quic(listener)))
+        goto err;
+
+    /* Listening requires the network BIOs to be set */
+    if (!TEST_false(SSL_listen(listener)))
+        goto err;
+    ERR_clear_error();
+
+    if (!TEST_ptr(bio = BIO_new_dgram(sfd, BIO_CLOSE))) {
+        BIO_closesocket(sfd);
+        goto err;
+    }
+    SSL_set_bio(listener, bio, bio);
+    if (!TEST_true(SSL_set_blocking_mode(listener, 0))
+            || !TEST_true(SSL_listen(listener))
+            || !TEST_ptr_null(SSL_accept_connection(listener, 0))
+            || !TEST_size_t_eq(SSL_get_accept_connection_queue_len(listener), 0))
+        goto err;
+
+    for (i = 0; i < NUM_LISTENER_CLIENTS; i++) {
+        if (i == 0) {
+            fd = cfd;
+            cfd = -1;
+        } else if (!TEST_int_ge(fd = BIO_socket(AF_INET, SOCK_DGRAM,
+                                                IPPROTO_UDP, 0), 0)) {
+            goto err;
+        }
+
+        if (!TEST_ptr(clients[i] = SSL_new(cctx))
+                || !TEST_ptr(bio = BIO_new_dgram(fd, BIO_CLOSE))) {
+            BIO_closesocket(fd);
+            goto err;
+        }
+        SSL_set_bio(clients[i], bio, bio);
+
+        if (!TEST_true(SSL_set_blocking_mode(clients[i], 0))
+                || !TEST_true(SSL_set1_initial_peer_addr(clients[i], saddr))
+                /* SSL_set_alpn_protos returns 0 for success */
+                || !TEST_false(SSL_set_alpn_protos(clients[i], alpn,
+                                                   sizeof(alpn))))
+            goto err;
+    }
+
+    /*
+     * Connect all the clients at once, and accept their connections as they
+     * come in.
+     */
+    for (loops = 0; num_conns < NUM_LISTENER_CLIENTS
+                    || num_connected < NUM_LISTENER_CLIENTS; loops++) {
+        if (!TEST_size_t_lt(loops, 100000))
+            goto err;
+
+        for (i = 0; i < NUM_LISTENER_CLIENTS; i++) {
+            if (connected[i])
+                continue;
+
+            ret = SSL_connect(clients[i]);
+            if (ret == 1) {
+                connected[i] = 1;
+                num_connected++;
+            } else if (!TEST_int_eq(SSL_get_error(clients[i], ret),
+                                    SSL_ERROR_WANT_READ)) {
+                goto err;
+            }
+        }
+
+        while (num_conns < NUM_LISTENER_CLIENTS
+               && (conns[num_conns] = SSL_accept_connection(listener, 0)) != NULL)
+            num_conns++;
 
-        return 1;
+        if (!TEST_true(SSL_handle_events(listener)))
+            goto err;
+    }
 
-    default:
-        return 0;
+    /* Check data gets from each client to its own connection */
+    if (!TEST_true(listener_check_data(clients, conns, NUM_LISTENER_CLIENTS,
+                                       ossl_time_add(ossl_time_now(),
+                                                     ossl_seconds2time(30)))))
+        goto err;
+
+    testresult = 1;
+ err:
+    for (i = 0; i < NUM_LISTENER_CLIENTS; i++) {
+        SSL_free(conns[i]);
+        SSL_free(clients[i]);
     }
+    SSL_free(listener);
+    if (cfd >= 0)
+        BIO_closesocket(cfd);
+    BIO_ADDR_free(saddr);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
 }
 
-static int tparam_on_enc_ext(QTEST_FAULT *qtf, QTEST_ENCRYPTED_EXTENSIONS *ee,
-                             size_t ee_len, void *arg)
+#define NUM_QUEUE_LIMIT_CLIENTS 3
+
+/*
+ * Test that a listener does not queue more incoming connections than its
+ * accept queue limit, and that a queued connection closed by its client makes
+ * room for another one.
+ */
+static int test_quic_listener_queue_limit(void)
 {
-    int rc = 0;
-    struct tparam_ctx *ctx = arg;
-    PACKET pkt = {0};
-    WPACKET wpkt;
-    int have_wpkt = 0;
-    BUF_MEM *old_bufm = NULL, *new_bufm = NULL;
-    unsigned char *tp_p;
-    size_t tp_len, written, old_len, eb_len;
-    uint64_t id;
+    static const unsigned char alpn[] = { 8, 'o', 's', 's', 'l', 't', 'e', 's', 't' };
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *listener = NULL, *conn = NULL, *late;
+    SSL *clients[NUM_QUEUE_LIMIT_CLIENTS] = { NULL };
+    int connected[NUM_QUEUE_LIMIT_CLIENTS] = { 0 };
+    BIO_ADDR *saddr = NULL;
+    BIO *bio;
+    int cfd = -1, sfd = -1, fd, ret, testresult = 0;
+    size_t i, num_connected = 0;
+    OSSL_TIME start, deadline;
 
-    if (!TEST_ptr(old_bufm = BUF_MEM_new()))
+    if (!TEST_ptr(sctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_server_method()))
+            || !TEST_ptr(cctx = SSL_CTX_new_ex(libctx, NULL,
+                                               OSSL_QUIC_client_method())))
         goto err;
 
-    /*
-     * Delete transport parameters TLS extension and capture the contents of the
-     * extension which was removed.
-     */
-    if (!TEST_true(qtest_fault_delete_extension(qtf, TLSEXT_TYPE_quic_transport_parameters,
-                                                ee->extensions, &ee->extensionslen,
-                                                old_bufm)))
+    if (!TEST_int_eq(SSL_CTX_use_certificate_file(sctx, cert,
+                                                  SSL_FILETYPE_PEM), 1)
+            || !TEST_int_eq(SSL_CTX_use_PrivateKey_file(sctx, privkey,
+                                                        SSL_FILETYPE_PEM), 1))
         goto err;
+    SSL_CTX_set_alpn_select_cb(sctx, listener_alpn_select_cb, NULL);
 
-    if (!TEST_true(PACKET_buf_init(&pkt, (unsigned char *)old_bufm->data, old_bufm->length))
-        || !TEST_ptr(new_bufm = BUF_MEM_new())
-        || !TEST_true(WPACKET_init(&wpkt, new_bufm)))
+    if (!TEST_ptr(saddr = BIO_ADDR_new())
+            || !TEST_true(create_test_sockets(&cfd, &sfd, SOCK_DGRAM, saddr))
+            || !TEST_ptr(listener = SSL_new_listener(sctx, 0)))
         goto err;
 
-    have_wpkt = 1;
+    if (!TEST_ptr(bio = BIO_new_dgram(sfd, BIO_CLOSE))) {
+        BIO_closesocket(sfd);
+        goto err;
+    }
+    SSL_set_bio(listener, bio, bio);
 
-    /*
-     * Open transport parameters TLS extension:
-     *
-     *   u16  Extension ID (quic_transport_parameters)
-     *   u16  Extension Data Length
-     *   ...  Extension Data
-     *
-     */
-    if (!TEST_true(WPACKET_put_bytes_u16(&wpkt,
-                                         TLSEXT_TYPE_quic_transport_parameters))
-        || !TEST_true(WPACKET_start_sub_packet_u16(&wpkt)))
+    /* The queue must have room for at least one connection */
+    if (!TEST_false(SSL_set_max_accept_connection_queue_len(listener, 0)))
         goto err;
+    ERR_clear_error();
 
-    for (; PACKET_remaining(&pkt) > 0; ) {
-        tp_p = (unsigned char *)ossl_quic_wire_decode_transport_param_bytes(&pkt,
-                                                                            &id,
-                                                                            &tp_len);
-        if (!TEST_ptr(tp_p)) {
-            TEST_mem_eq(PACKET_data(&pkt), PACKET_remaining(&pkt), NULL, 0);
+    if (!TEST_true(SSL_set_max_accept_connection_queue_len(listener,
+                                                NUM_QUEUE_LIMIT_CLIENTS - 1))
+            || !TEST_true(SSL_set_blocking_mode(listener, 0))
+            || !TEST_true(SSL_listen(listener))
+            || !TEST_false(SSL_set_max_accept_connection_queue_len(listener,
+                                                                   1)))
+        goto err;
+    ERR_clear_error();
+
+    for (i = 0; i < NUM_QUEUE_LIMIT_CLIENTS; i++) {
+        if (i == 0) {
+            fd = cfd;
+            cfd = -1;
+        } else if (!TEST_int_ge(fd = BIO_socket(AF_INET, SOCK_DGRAM,
+                                                IPPROTO_UDP, 0), 0)) {
             goto err;
         }
 
-        if (!TEST_true(tparam_handle(ctx, id, tp_p, tp_len, &wpkt)))
+        if (!TEST_ptr(clients[i] = SSL_new(cctx))
+                || !TEST_ptr(bio = BIO_new_dgram(fd, BIO_CLOSE))) {
+            BIO_closesocket(fd);
+            goto err;
+        }
+        SSL_set_bio(clients[i], bio, bio);
+
+        if (!TEST_true(SSL_set_blocking_mode(clients[i], 0))
+                || !TEST_true(SSL_set1_initial_peer_addr(clients[i], saddr))
+                /* SSL_set_alpn_protos returns 0 for success */
+                || !TEST_false(SSL_set_alpn_protos(clients[i], alpn,
+                                                   sizeof(alpn))))
             goto err;
     }
 
-    if (ctx->t->op == TPARAM_OP_INJECT || ctx->t->op == TPARAM_OP_DROP_INJECT
-        || ctx->t->op == TPARAM_OP_INJECT_TWICE) {
-        if (!TEST_ptr(ossl_quic_wire_encode_transport_param_bytes(&wpkt, ctx->t->id,
-                                                                  ctx->t->buf,
-                                                                  ctx->t->buf_len)))
+    /*
+     * Connect all the clients without accepting any connection. The first
+     * clients fill the queue and the Initial packets of the last one are
+     * dropped.
+     */
+    deadline = ossl_time_add(ossl_time_now(), ossl_seconds2time(5));
+    while (num_connected < NUM_QUEUE_LIMIT_CLIENTS - 1) {
+        if (!TEST_true(ossl_time_compare(ossl_time_now(), deadline) < 0))
             goto err;
 
-        if (ctx->t->op == TPARAM_OP_INJECT_TWICE
-            && !TEST_ptr(ossl_quic_wire_encode_transport_param_bytes(&wpkt, ctx->t->id,
-                                                                     ctx->t->buf,
-                                                                     ctx->t->buf_len)))
+        for (i = 0; i < NUM_QUEUE_LIMIT_CLIENTS; i++) {
+            if (connected[i])
+                continue;
+
+            ret = SSL_connect(clients[i]);
+            if (ret == 1) {
+                connected[i] = 1;
+                num_connected++;
+            } else if (!TEST_int_eq(SSL_get_error(clients[i], ret),
+                                    SSL_ERROR_WANT_READ)) {
+                goto err;
+            }
+        }
+
+        if (!TEST_true(SSL_handle_events(listener)))
             goto err;
-    } else if (ctx->t->op == TPARAM_OP_INJECT_RAW) {
-        if (!TEST_true(WPACKET_memcpy(&wpkt, ctx->t->buf, ctx->t->buf_len)))
+    }
+
+    late = clients[NUM_QUEUE_LIMIT_CLIENTS - 1];
+    if (!TEST_true(connected[0])
+            || !TEST_true(connected[1])
+            || !TEST_int_le(SSL_connect(late), 0)
+            || !TEST_size_t_eq(SSL_get_accept_connection_queue_len(listener),
+                               NUM_QUEUE_LIMIT_CLIENTS - 1))
+        goto err;
+
+    /*
+     * Close the first connection while it is still queued. Once the server
+     * side of it terminates, it leaves the queue, and the retransmitted
+     * Initial packets of the last client are accepted. The client is given
+     * some time to process HANDSHAKE_DONE first, so that it closes the
+     * connection with a 1-RTT packet the server can still read. Otherwise the
+     * server side only terminates when it times out.
+     */
+    start = ossl_time_now();
+    deadline = ossl_time_add(start, ossl_seconds2time(60));
+    while (!connected[NUM_QUEUE_LIMIT_CLIENTS - 1]) {
+        if (!TEST_true(ossl_time_compare(ossl_time_now(), deadline) < 0))
+            goto err;
+
+        if (ossl_time_compare(ossl_time_subtract(ossl_time_now(), start),
+                              ossl_ms2time(200)) < 0) {
+            if (!TEST_true(SSL_handle_events(clients[0])))
+                goto err;
+        } else {
+            SSL_shutdown(clients[0]);
+        }
+
+        ret = SSL_connect(late);
+        if (ret == 1)
+            connected[NUM_QUEUE_LIMIT_CLIENTS - 1] = 1;
+        else if (!TEST_int_eq(SSL_get_error(late, ret), SSL_ERROR_WANT_READ))
             goto err;
+
+        if (!TEST_true(SSL_handle_events(listener)))
+            goto err;
+        OSSL_sleep(1);
     }
 
-    if (!TEST_true(WPACKET_close(&wpkt))) /* end extension data, set length */
+    if (!TEST_size_t_eq(SSL_get_accept_connection_queue_len(listener),
+                        NUM_QUEUE_LIMIT_CLIENTS - 1))
         goto err;
 
-    if (!TEST_true(WPACKET_get_total_written(&wpkt, &written)))
+    for (i = 0; i < NUM_QUEUE_LIMIT_CLIENTS - 1; i++) {
+        if (!TEST_ptr(conn = SSL_accept_connection(listener, 0)))
+            goto err;
+        SSL_free(conn);
+        conn = NULL;
+    }
+
+    if (!TEST_ptr_null(SSL_accept_connection(listener, 0)))
         goto err;
 
-    WPACKET_finish(&wpkt);
-    have_wpkt = 0;
+    testresult = 1;
+ err:
+    SSL_free(conn);
+    for (i = 0; i < NUM_QUEUE_LIMIT_CLIENTS; i++)
+        SSL_free(clients[i]);
+    SSL_free(listener);
+    if (cfd >= 0)
+        BIO_closesocket(cfd);
+    BIO_ADDR_free(saddr);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
 
-    /*
-     * Append the constructed extension blob to the extension block.
-     */
-    old_len = ee->extensionslen;
+#if defined(OPENSSL_THREADS)
+/*
+ * A datagram filter BIO which sends every datagram to redirect_addr instead of
+ * its destination, if redirect_addr is set. Used to deliver datagrams to the
+ * wrong shard of a listener.
+ */
+static BIO_METHOD *redirect_method = NULL;
+static BIO_ADDR *redirect_addr = NULL;
 
-    if (!qtest_fault_resize_message(qtf, ee->extensionslen + written))
-        goto err;
+static int redirect_sendmmsg(BIO *bio, BIO_MSG *msg, size_t stride,
+                             size_t num_msg, uint64_t flags,
+                             size_t *msgs_processed)
+{
+    BIO_ADDR *peers[16];
+    size_t i;
+    int ret;
 
-    memcpy(ee->extensions + old_len, new_bufm->data, written);
+    if (redirect_addr == NULL)
+        return BIO_sendmmsg(BIO_next(bio), msg, stride, num_msg, flags,
+                            msgs_processed);
 
-    /* Fixup the extension block header (u16 length of entire block). */
-    eb_len = (((uint16_t)ee->extensions[0]) << 8) + (uint16_t)ee->extensions[1];
-    eb_len += written;
-    ee->extensions[0] = (unsigned char)((eb_len >> 8) & 0xFF);
-    ee->extensions[1] = (unsigned char)( eb_len       & 0xFF);
+    if (num_msg > OSSL_NELEM(peers))
+        num_msg = OSSL_NELEM(peers);
 
-    rc = 1;
-err:
-    if (have_wpkt)
-        WPACKET_cleanup(&wpkt);
-    BUF_MEM_free(old_bufm);
-    BUF_MEM_free(new_bufm);
-    return rc;
+    for (i = 0; i < num_msg; i++) {
+        BIO_MSG *m = (BIO_MSG *)((unsigned char *)msg + i * stride);
+
+        peers[i] = m->peer;
+        m->peer = redirect_addr;
+    }
+
+    ret = BIO_sendmmsg(BIO_next(bio), msg, stride, num_msg, flags,
+                       msgs_processed);
+
+    for (i = 0; i < num_msg; i++)
+        ((BIO_MSG *)((unsigned char *)msg + i * stride))->peer = peers[i];
+
+    return ret;
 }
 
-static int test_tparam(int idx)
+static int redirect_recvmmsg(BIO *bio, BIO_MSG *msg, size_t stride,
+                             size_t num_msg, uint64_t flags,
+                             size_t *msgs_processed)
 {
-    int testresult = 0;
-    SSL_CTX *c_ctx = NULL;
-    SSL *c_ssl = NULL;
-    QUIC_TSERVER *s = NULL;
-    QTEST_FAULT *qtf = NULL;
-    struct tparam_ctx ctx = {0};
+    return BIO_recvmmsg(BIO_next(bio), msg, stride, num_msg, flags,
+                        msgs_processed);
+}
 
-    ctx.t = &tparam_tests[idx];
+static long redirect_ctrl(BIO *bio, int cmd, long num, void *ptr)
+{
+    return BIO_ctrl(BIO_next(bio), cmd, num, ptr);
+}
 
-    if (!TEST_ptr(c_ctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method())))
+static int redirect_new(BIO *bio)
+{
+    BIO_set_init(bio, 1);
+    return 1;
+}
+
+static const BIO_METHOD *bio_f_redirect_filter(void)
+{
+    if (redirect_method == NULL) {
+        redirect_method = BIO_meth_new(BIO_TYPE_FILTER, "Redirect filter");
+        if (redirect_method == NULL
+            || !BIO_meth_set_sendmmsg(redirect_method, redirect_sendmmsg)
+            || !BIO_meth_set_recvmmsg(redirect_method, redirect_recvmmsg)
+            || !BIO_meth_set_ctrl(redirect_method, redirect_ctrl)
+            || !BIO_meth_set_create(redirect_method, redirect_new)) {
+            BIO_meth_free(redirect_method);
+            redirect_method = NULL;
+        }
+    }
+
+    return redirect_method;
+}
+
+# define NUM_LISTENER_WORKERS    3
+
+static const unsigned char lb_server_id[] = { 0x31, 0x41, 0x59 };
+static const unsigned char lb_key[QUIC_LB_KEY_LEN] = {
+    0x8f, 0x95, 0xf0, 0x92, 0x45, 0x76, 0x5f, 0x80,
+    0x25, 0x69, 0x34, 0xe5, 0x0c, 0x66, 0x20, 0x7f
+};
+# define LB_NONCE_LEN   6
+# define LB_CID_LEN     (1 + sizeof(lb_server_id) + LB_NONCE_LEN)
+
+static QUIC_CONN_ID lb_dcid;
+
+/* Records the DCID of the short header packets sent by a client. */
+static void lb_dcid_cb(int write_p, int version, int content_type,
+                       const void *buf, size_t msglen, SSL *ssl, void *arg)
+{
+    const unsigned char *p = buf;
+
+    if (!write_p || content_type != SSL3_RT_QUIC_PACKET
+            || msglen < 1 + LB_CID_LEN || (p[0] & 0x80) != 0)
+        return;
+
+    lb_dcid.id_len = LB_CID_LEN;
+    memcpy(lb_dcid.id, p + 1, LB_CID_LEN);
+}
+
+/*
+ * Test that a listener with workers spreads connections over several sockets,
+ * each serviced by its own thread without the application handling events on
+ * the listener, and forwards datagrams received by the wrong shard.
+ *
+ * Test 0: Default connection IDs
+ * Test 1: QUIC-LB connection IDs, identifying the shard in their nonce
+ */
+static int test_quic_listener_workers(int idx)
+{
+    static const unsigned char alpn[] = { 8, 'o', 's', 's', 'l', 't', 'e', 's', 't' };
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *listener = NULL;
+    SSL *clients[NUM_LISTENER_CLIENTS] = { NULL };
+    SSL *conns[NUM_LISTENER_CLIENTS] = { NULL };
+    int connected[NUM_LISTENER_CLIENTS] = { 0 };
+    BIO_ADDR *saddrs[NUM_LISTENER_WORKERS + 1] = { NULL };
+    int cfds[NUM_LISTENER_WORKERS + 1];
+    BIO *bio, *filter;
+    int sfd, fd, ret, testresult = 0;
+    size_t i, shard, num_conns = 0, num_connected = 0;
+    OSSL_TIME deadline;
+    QUIC_LB_CONFIG *lb = NULL;
+    unsigned char server_id[sizeof(lb_server_id)];
+
+    for (i = 0; i <= NUM_LISTENER_WORKERS; i++)
+        cfds[i] = -1;
+    memset(&lb_dcid, 0, sizeof(lb_dcid));
+
+    if (!TEST_ptr(sctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_server_method()))
+            || !TEST_ptr(cctx = SSL_CTX_new_ex(libctx, NULL,
+                                               OSSL_QUIC_client_method()))
+            || !TEST_int_eq(SSL_CTX_use_certificate_file(sctx, cert,
+                                                         SSL_FILETYPE_PEM), 1)
+            || !TEST_int_eq(SSL_CTX_use_PrivateKey_file(sctx, privkey,
+                                                        SSL_FILETYPE_PEM), 1)
+            || !TEST_ptr(listener = SSL_new_listener(sctx, 0)))
+        goto err;
+    SSL_CTX_set_alpn_select_cb(sctx, listener_alpn_select_cb, NULL);
+
+    /*
+     * Shard 0 uses the network BIOs of the listener, and each worker is
+     * another shard with a socket of its own.
+     */
+    for (shard = 0; shard <= NUM_LISTENER_WORKERS; shard++) {
+        if (!TEST_ptr(saddrs[shard] = BIO_ADDR_new())
+                || !TEST_true(create_test_sockets(&cfds[shard], &sfd,
+                                                  SOCK_DGRAM, saddrs[shard])))
+            goto err;
+
+        if (!TEST_ptr(bio = BIO_new_dgram(sfd, BIO_CLOSE))) {
+            BIO_closesocket(sfd);
+            goto err;
+        }
+
+        if (shard == 0) {
+            SSL_set_bio(listener, bio, bio);
+        } else if (!TEST_true(SSL_add_listener_worker(listener, bio, bio))) {
+            BIO_free(bio);
+            goto err;
+        }
+    }
+
+    if (idx == 1
+            && (!TEST_false(SSL_set_quic_lb_config(listener, 7, lb_server_id,
+                                                   sizeof(lb_server_id),
+                                                   LB_NONCE_LEN, lb_key,
+                                                   sizeof(lb_key)))
+                || !TEST_false(SSL_set_quic_lb_config(listener, 1,
+                                                      lb_server_id,
+                                                      sizeof(lb_server_id),
+                                                      LB_NONCE_LEN, lb_key,
+                                                      sizeof(lb_key) - 1))
+                || !TEST_true(SSL_set_quic_lb_config(listener, 1,
+                                                     lb_server_id,
+                                                     sizeof(lb_server_id),
+                                                     LB_NONCE_LEN, lb_key,
+                                                     sizeof(lb_key)))))
         goto err;
+    ERR_clear_error();
 
-    if (!TEST_true(qtest_create_quic_objects(libctx, c_ctx, NULL, cert,
-                                             privkey, 0, &s,
-                                             &c_ssl, &qtf, NULL)))
+    if (!TEST_true(SSL_set_blocking_mode(listener, 0))
+            || !TEST_true(SSL_listen(listener))
+            || !TEST_ptr_null(SSL_accept_connection(listener, 0)))
         goto err;
 
-    if (!TEST_true(qtest_fault_set_hand_enc_ext_listener(qtf, tparam_on_enc_ext,
-                                                         &ctx)))
+    if (idx == 1
+            && !TEST_false(SSL_set_quic_lb_config(listener, 1, lb_server_id,
+                                                  sizeof(lb_server_id),
+                                                  LB_NONCE_LEN, lb_key,
+                                                  sizeof(lb_key))))
         goto err;
+    ERR_clear_error();
 
-    if (!TEST_true(qtest_create_quic_connection_ex(s, c_ssl,
-                                                   ctx.t->expect_fail != NULL)))
+    /* Workers cannot be added once listening */
+    if (!TEST_ptr(bio = BIO_new(BIO_s_dgram_mem())))
         goto err;
+    if (!TEST_false(SSL_add_listener_worker(listener, bio, bio))) {
+        BIO_free(bio);
+        goto err;
+    }
+    BIO_free(bio);
+    ERR_clear_error();
 
-    if (ctx.t->expect_fail != NULL) {
-        SSL_CONN_CLOSE_INFO info = {0};
+    /* Spread the clients over the sockets of the shards. */
+    for (i = 0; i < NUM_LISTENER_CLIENTS; i++) {
+        shard = i % (NUM_LISTENER_WORKERS + 1);
 
-        if (!TEST_true(SSL_get_conn_close_info(c_ssl, &info, sizeof(info))))
+        if (i == shard) {
+            fd = cfds[shard];
+            cfds[shard] = -1;
+        } else if (!TEST_int_ge(fd = BIO_socket(AF_INET, SOCK_DGRAM,
+                                                IPPROTO_UDP, 0), 0)) {
             goto err;
+        }
 
-        if (!TEST_true((info.flags & SSL_CONN_CLOSE_FLAG_TRANSPORT) != 0)
-            || !TEST_uint64_t_eq(info.error_code, QUIC_ERR_TRANSPORT_PARAMETER_ERROR)
-            || !TEST_ptr(strstr(info.reason, ctx.t->expect_fail))) {
-            TEST_error("expected connection closure information mismatch"
-                       " during TPARAM test: flags=%llu ec=%llu reason='%s'",
-                       (unsigned long long)info.flags,
-                       (unsigned long long)info.error_code,
-                       info.reason);
+        if (!TEST_ptr(clients[i] = SSL_new(cctx))
+                || !TEST_ptr(bio = BIO_new_dgram(fd, BIO_CLOSE))) {
+            BIO_closesocket(fd);
             goto err;
         }
+
+        /* The first client can have its datagrams sent to another shard. */
+        if (i == 0) {
+            if (!TEST_ptr(filter = BIO_new(bio_f_redirect_filter()))) {
+                BIO_free(bio);
+                goto err;
+            }
+            bio = BIO_push(filter, bio);
+            if (idx == 1)
+                SSL_set_msg_callback(clients[i], lb_dcid_cb);
+        }
+        SSL_set_bio(clients[i], bio, bio);
+
+        if (!TEST_true(SSL_set_blocking_mode(clients[i], 0))
+                || !TEST_true(SSL_set1_initial_peer_addr(clients[i],
+                                                         saddrs[shard]))
+                /* SSL_set_alpn_protos returns 0 for success */
+                || !TEST_false(SSL_set_alpn_protos(clients[i], alpn,
+                                                   sizeof(alpn))))
+            goto err;
     }
 
-    testresult = 1;
-err:
-    if (!testresult) {
-        if (ctx.t->expect_fail != NULL)
-            TEST_info("failed during test for id=%llu, op=%d, bl=%zu, "
-                      "expected failure='%s'", (unsigned long long)ctx.t->id,
-                      ctx.t->op, ctx.t->buf_len, ctx.t->expect_fail);
-        else
-            TEST_info("failed during test for id=%llu, op=%d, bl=%zu",
-                      (unsigned long long)ctx.t->id, ctx.t->op, ctx.t->buf_len);
+    /*
+     * Connect all the clients at once, and accept their connections as they
+     * come in. The listener is serviced by its worker threads.
+     */
+    deadline = ossl_time_add(ossl_time_now(), ossl_seconds2time(30));
+    while (num_conns < NUM_LISTENER_CLIENTS
+           || num_connected < NUM_LISTENER_CLIENTS) {
+        if (!TEST_true(ossl_time_compare(ossl_time_now(), deadline) < 0))
+            goto err;
+
+        for (i = 0; i < NUM_LISTENER_CLIENTS; i++) {
+            if (connected[i])
+                continue;
+
+            ret = SSL_connect(clients[i]);
+            if (ret == 1) {
+                connected[i] = 1;
+                num_connected++;
+            } else if (!TEST_int_eq(SSL_get_error(clients[i], ret),
+                                    SSL_ERROR_WANT_READ)) {
+                goto err;
+            }
+        }
+
+        while (num_conns < NUM_LISTENER_CLIENTS
+               && (conns[num_conns] = SSL_accept_connection(listener, 0)) != NULL)
+            num_conns++;
     }
 
-    ossl_quic_tserver_free(s);
-    SSL_free(c_ssl);
-    SSL_CTX_free(c_ctx);
-    qtest_fault_free(qtf);
+    if (!TEST_size_t_eq(SSL_get_accept_connection_queue_len(listener), 0))
+        goto err;
+
+    /*
+     * Check data gets from each client to its own connection and back. The
+     * datagrams of the first client go to the wrong shard, which must forward
+     * them.
+     */
+    redirect_addr = saddrs[1];
+    if (!TEST_true(listener_check_data(clients, conns, NUM_LISTENER_CLIENTS,
+                                       deadline)))
+        goto err;
+
+    /* A load balancer can recover our server ID from the client's DCID. */
+    if (idx == 1
+            && (!TEST_ptr(lb = ossl_quic_lb_config_new(libctx, NULL, 1,
+                                                       lb_server_id,
+                                                       sizeof(lb_server_id),
+                                                       LB_NONCE_LEN, lb_key,
+                                                       sizeof(lb_key)))
+                || !TEST_true(ossl_quic_lb_decode_cid(lb, &lb_dcid,
+                                                      server_id, NULL))
+                || !TEST_mem_eq(server_id, sizeof(server_id),
+                                lb_server_id, sizeof(lb_server_id))))
+        goto err;
+
+    testresult = 1;
+ err:
+    ossl_quic_lb_config_free(lb);
+    redirect_addr = NULL;
+    for (i = 0; i < NUM_LISTENER_CLIENTS; i++) {
+        SSL_free(conns[i]);
+        SSL_free(clients[i]);
+    }
+    SSL_free(listener);
+    for (i = 0; i <= NUM_LISTENER_WORKERS; i++) {
+        if (cfds[i] >= 0)
+            BIO_closesocket(cfds[i]);
+        BIO_ADDR_free(saddrs[i]);
+    }
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
     return testresult;
 }
+#endif
 /***********************************************************************************/
 
 OPT_TEST_DECLARE_USAGE("provider config certsdir datadir\n")
@@ -2147,7 +3474,12 @@ int setup_tests(void)
     ADD_ALL_TESTS(test_quic_set_fd, 3);
     ADD_TEST(test_bio_ssl);
     ADD_TEST(test_back_pressure);
+    ADD_TEST(test_zero_copy);
     ADD_TEST(test_multiple_dgrams);
+    ADD_ALL_TESTS(test_congestion_control, OSSL_NELEM(cc_names));
+    ADD_TEST(test_ack_frequency);
+    ADD_ALL_TESTS(test_quic_0rtt, 3);
+    ADD_ALL_TESTS(test_quic_datagram, 3);
     ADD_ALL_TESTS(test_non_io_retry, 2);
     ADD_TEST(test_quic_psk);
     ADD_ALL_TESTS(test_client_auth, 3);
@@ -2155,6 +3487,11 @@ int setup_tests(void)
     ADD_ALL_TESTS(test_noisy_dgram, 2);
     ADD_TEST(test_get_shutdown);
     ADD_ALL_TESTS(test_tparam, OSSL_NELEM(tparam_tests));
+    ADD_TEST(test_quic_listener);
+    ADD_TEST(test_quic_listener_queue_limit);
+#if defined(OPENSSL_THREADS)
+    ADD_ALL_TESTS(test_quic_listener_workers, 2);
+#endif
 
     return 1;
  err:
@@ -2166,6 +3503,9 @@ void cleanup_tests(void)
 {
     bio_f_noisy_dgram_filter_free();
     bio_f_pkt_split_dgram_filter_free();
+#if defined(OPENSSL_THREADS)
+    BIO_meth_free(redirect_method);
+#endif
     OPENSSL_free(cert);
     OPENSSL_free(privkey);
     OPENSSL_free(ccert);
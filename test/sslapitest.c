@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include <openssl/opensslconf.h>
 #include <openssl/bio.h>
@@ -34,6 +35,10 @@
 #include <openssl/x509v3.h>
 #include <openssl/dh.h>
 #include <openssl/engine.h>
+#if defined(OPENSSL_SYS_UNIX)
+# include <unistd.h>
+# include <sys/wait.h>
+#endif
 
 #include "helpers/ssltestlib.h"
 #include "testutil.h"
@@ -1506,6 +1511,209 @@ static int test_ktls_sendfile(int test)
     return execute_test_ktls_sendfile(cipher->tls_version, cipher->cipher,
                                       test & 1);
 }
+
+#define KTLS_BENCH_SZ                   (4 * 1024 * 1024)
+#define KTLS_BENCH_CHUNK                16384
+
+/*
+ * Transfer data over loopback and report the CPU time it took, to compare
+ * user space records with KTLS:
+ * method 0: SSL_write() to SSL_read() without KTLS
+ * method 1: SSL_sendfile() to SSL_read()
+ * method 2: SSL_write() to SSL_splice() into a pipe, read from the pipe
+ */
+static int execute_test_ktls_transfer(int tls_version, const char *cipher,
+                                      int method)
+{
+    static const char *methods[] = { "user space", "SSL_sendfile", "SSL_splice" };
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    unsigned char *buf = NULL, *buf_dst = NULL;
+    BIO *out = NULL, *in = NULL;
+    int cfd = -1, sfd = -1, ffd = -1, pipefd[2] = { -1, -1 };
+    ossl_ssize_t ret;
+    size_t off, chunk_size, got, n;
+    ssize_t r;
+    int testresult = 0;
+    FILE *ffdp;
+    clock_t start;
+    double secs;
+
+    buf = OPENSSL_malloc(KTLS_BENCH_SZ);
+    buf_dst = OPENSSL_zalloc(KTLS_BENCH_SZ);
+    if (!TEST_ptr(buf) || !TEST_ptr(buf_dst)
+        || !TEST_int_gt(RAND_bytes_ex(libctx, buf, KTLS_BENCH_SZ, 0), 0)
+        || !TEST_true(create_test_sockets(&cfd, &sfd, SOCK_STREAM, NULL)))
+        goto end;
+
+    /* Skip this test if the platform does not support ktls */
+    if (method != 0 && !ktls_chk_platform(sfd)) {
+        testresult = TEST_skip("Kernel does not support KTLS");
+        goto end;
+    }
+
+    if (is_fips && strstr(cipher, "CHACHA") != NULL) {
+        testresult = TEST_skip("CHACHA is not supported in FIPS");
+        goto end;
+    }
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(),
+                                       tls_version, tls_version,
+                                       &sctx, &cctx, cert, privkey)))
+        goto end;
+
+    if (tls_version == TLS1_3_VERSION) {
+        if (!TEST_true(SSL_CTX_set_ciphersuites(cctx, cipher))
+            || !TEST_true(SSL_CTX_set_ciphersuites(sctx, cipher)))
+            goto end;
+    } else {
+        if (!TEST_true(SSL_CTX_set_cipher_list(cctx, cipher))
+            || !TEST_true(SSL_CTX_set_cipher_list(sctx, cipher)))
+            goto end;
+    }
+
+    /* No tickets, so that only application data follows the handshake */
+    if (!TEST_true(SSL_CTX_set_num_tickets(sctx, 0))
+        || !TEST_true(create_ssl_objects2(sctx, cctx, &serverssl,
+                                          &clientssl, sfd, cfd)))
+        goto end;
+
+    if (method == 1
+        && !TEST_true(SSL_set_options(serverssl, SSL_OP_ENABLE_KTLS)))
+        goto end;
+    if (method == 2
+        && !TEST_true(SSL_set_options(clientssl, SSL_OP_ENABLE_KTLS)))
+        goto end;
+
+    if (!TEST_true(create_ssl_connection(serverssl, clientssl,
+                                         SSL_ERROR_NONE)))
+        goto end;
+
+    if ((method == 1 && !BIO_get_ktls_send(SSL_get_wbio(serverssl)))
+        || (method == 2 && !BIO_get_ktls_recv(SSL_get_rbio(clientssl)))) {
+        testresult = TEST_skip("Failed to enable KTLS for %s cipher %s",
+                               tls_version == TLS1_3_VERSION ? "TLS 1.3" :
+                               "TLS 1.2", cipher);
+        goto end;
+    }
+
+    if (method == 1) {
+        out = BIO_new_file(tmpfilename, "wb");
+        if (!TEST_ptr(out)
+            || !TEST_int_eq(BIO_write(out, buf, KTLS_BENCH_SZ), KTLS_BENCH_SZ))
+            goto end;
+        BIO_free(out);
+        out = NULL;
+        in = BIO_new_file(tmpfilename, "rb");
+        if (!TEST_ptr(in))
+            goto end;
+        BIO_get_fp(in, &ffdp);
+        ffd = fileno(ffdp);
+    }
+    if (method == 2) {
+        if (!TEST_int_eq(pipe(pipefd), 0))
+            goto end;
+        /* libssl only provides SSL_splice() where splice() is available */
+        if (SSL_splice(clientssl, pipefd[1], 0, 0) < 0
+                && ERR_GET_REASON(ERR_peek_last_error()) == ERR_R_UNSUPPORTED) {
+            testresult = TEST_skip("splice() is not supported with KTLS");
+            goto end;
+        }
+        ERR_clear_error();
+    }
+
+    start = clock();
+    for (off = 0; off < KTLS_BENCH_SZ; off += chunk_size) {
+        chunk_size = min(KTLS_BENCH_CHUNK, KTLS_BENCH_SZ - off);
+
+        if (method == 1) {
+            for (got = 0; got < chunk_size; got += ret) {
+                ret = SSL_sendfile(serverssl, ffd, off + got, chunk_size - got,
+                                   0);
+                if (ret < 0) {
+                    if (!TEST_int_eq(SSL_get_error(serverssl, (int)ret),
+                                     SSL_ERROR_WANT_WRITE))
+                        goto end;
+                    ret = 0;
+                }
+            }
+        } else {
+            while (!SSL_write_ex(serverssl, buf + off, chunk_size, &n)) {
+                if (!TEST_int_eq(SSL_get_error(serverssl, 0),
+                                 SSL_ERROR_WANT_WRITE))
+                    goto end;
+            }
+        }
+
+        for (got = 0; got < chunk_size; got += n) {
+            n = 0;
+            if (method != 2) {
+                if (!SSL_read_ex(clientssl, buf_dst + off + got,
+                                 chunk_size - got, &n)
+                    && !TEST_int_eq(SSL_get_error(clientssl, 0),
+                                    SSL_ERROR_WANT_READ))
+                    goto end;
+                continue;
+            }
+            ret = SSL_splice(clientssl, pipefd[1], chunk_size - got, 0);
+            if (ret < 0) {
+                if (!TEST_int_eq(SSL_get_error(clientssl, (int)ret),
+                                 SSL_ERROR_WANT_READ))
+                    goto end;
+                continue;
+            }
+            if (!TEST_int_gt((int)ret, 0))
+                goto end;
+            for (n = 0; n < (size_t)ret; n += (size_t)r) {
+                r = read(pipefd[0], buf_dst + off + got + n, (size_t)ret - n);
+                if (!TEST_int_gt((int)r, 0))
+                    goto end;
+            }
+        }
+    }
+    secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (!TEST_mem_eq(buf, KTLS_BENCH_SZ, buf_dst, KTLS_BENCH_SZ))
+        goto end;
+
+    TEST_info("%s, %s, %s: %.1f MB/s",
+              tls_version == TLS1_3_VERSION ? "TLS 1.3" : "TLS 1.2", cipher,
+              methods[method],
+              secs > 0 ? KTLS_BENCH_SZ / (secs * 1024 * 1024) : 0.0);
+
+    testresult = 1;
+end:
+    SSL_free(clientssl);
+    SSL_free(serverssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    BIO_free(out);
+    BIO_free(in);
+    if (pipefd[0] != -1)
+        close(pipefd[0]);
+    if (pipefd[1] != -1)
+        close(pipefd[1]);
+    if (cfd != -1)
+        close(cfd);
+    if (sfd != -1)
+        close(sfd);
+    OPENSSL_free(buf);
+    OPENSSL_free(buf_dst);
+    return testresult;
+}
+
+static int test_ktls_transfer(int test)
+{
+    struct ktls_test_cipher *cipher;
+    int tst = test / 3;
+
+    OPENSSL_assert(tst < (int)NUM_KTLS_TEST_CIPHERS);
+    cipher = &ktls_test_ciphers[tst];
+
+    return execute_test_ktls_transfer(cipher->tls_version, cipher->cipher,
+                                      test % 3);
+}
 #endif
 
 static int test_large_message_tls(void)
@@ -9332,6 +9540,295 @@ static int test_session_timeout(int test)
     return testresult;
 }
 
+#define SHARDED_SESSIONS 64
+
+/*
+ * Test the sharded session cache
+ * Test 0: Adding, expiring and evicting sessions
+ * Test 1: Session ID resumption from the sharded cache
+ */
+static int test_session_cache_sharded(int tst)
+{
+    SSL_SESSION *sess[SHARDED_SESSIONS] = { NULL };
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    SSL_SESSION *clntsess = NULL;
+    int testresult = 0, i;
+    long now = (long)time(NULL);
+
+    if (tst == 1) {
+#ifdef OPENSSL_NO_TLS1_2
+        return TEST_skip("TLSv1.2 is disabled");
+#else
+        if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                           TLS_client_method(), TLS1_VERSION,
+                                           TLS1_2_VERSION, &sctx, &cctx,
+                                           cert, privkey)))
+            goto end;
+        SSL_CTX_set_options(sctx, SSL_OP_NO_TICKET);
+        SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER
+                                             | SSL_SESS_CACHE_SHARDED);
+        if (!TEST_ptr(sctx->sess_shards)
+                || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                                 &clientssl, NULL, NULL))
+                || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                    SSL_ERROR_NONE))
+                || !TEST_ptr(clntsess = SSL_get1_session(clientssl))
+                || !TEST_long_eq(SSL_CTX_sess_number(sctx), 1))
+            goto end;
+        shutdown_ssl_connection(serverssl, clientssl);
+        serverssl = clientssl = NULL;
+
+        if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                          NULL, NULL))
+                || !TEST_true(SSL_set_session(clientssl, clntsess))
+                || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                    SSL_ERROR_NONE))
+                || !TEST_true(SSL_session_reused(clientssl))
+                || !TEST_long_eq(SSL_CTX_sess_hits(sctx), 1))
+            goto end;
+        testresult = 1;
+        goto end;
+#endif
+    }
+
+    if (!TEST_ptr(sctx = SSL_CTX_new_ex(libctx, NULL, TLS_method())))
+        goto end;
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER
+                                         | SSL_SESS_CACHE_SHARDED);
+    if (!TEST_ptr(sctx->sess_shards)
+            || !TEST_long_eq(SSL_CTX_get_session_cache_mode(sctx),
+                             SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_SHARDED))
+        goto end;
+
+    for (i = 0; i < SHARDED_SESSIONS; i++) {
+        if (!TEST_ptr(sess[i] = SSL_SESSION_new()))
+            goto end;
+        sess[i]->session_id_length = SSL3_SSL_SESSION_ID_LENGTH;
+        memset(sess[i]->session_id, i, SSL3_SSL_SESSION_ID_LENGTH);
+        if (!TEST_int_eq(SSL_CTX_add_session(sctx, sess[i]), 1)
+                || !TEST_ptr_eq(sess[i]->owner, sctx))
+            goto end;
+    }
+    if (!TEST_long_eq(SSL_CTX_sess_number(sctx), SHARDED_SESSIONS))
+        goto end;
+
+    /* Can't switch back to an unsharded cache while there are sessions */
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER);
+    if (!TEST_long_eq(SSL_CTX_get_session_cache_mode(sctx),
+                      SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_SHARDED))
+        goto end;
+
+    /* Let every other session time out 10 seconds earlier */
+    for (i = 0; i < SHARDED_SESSIONS; i++) {
+        if (!TEST_int_ne(SSL_SESSION_set_time(sess[i],
+                                              i % 2 == 0 ? now - 10 : now + 10),
+                         0)
+                || !TEST_int_ne(SSL_SESSION_set_timeout(sess[i], TIMEOUT), 0))
+            goto end;
+    }
+
+    /* This should remove the sessions that time out first */
+    SSL_CTX_flush_sessions(sctx, now + TIMEOUT - 1);
+    for (i = 0; i < SHARDED_SESSIONS; i++)
+        if (!TEST_true((sess[i]->owner != NULL) == (i % 2 == 1)))
+            goto end;
+    if (!TEST_long_eq(SSL_CTX_sess_number(sctx), SHARDED_SESSIONS / 2))
+        goto end;
+
+    /* Flushing the same time again should be a no-op */
+    SSL_CTX_flush_sessions(sctx, now + TIMEOUT - 1);
+    if (!TEST_long_eq(SSL_CTX_sess_number(sctx), SHARDED_SESSIONS / 2))
+        goto end;
+
+    /* This should remove all of them */
+    SSL_CTX_flush_sessions(sctx, 0);
+    if (!TEST_long_eq(SSL_CTX_sess_number(sctx), 0))
+        goto end;
+    for (i = 0; i < SHARDED_SESSIONS; i++)
+        if (!TEST_ptr_null(sess[i]->owner))
+            goto end;
+
+    /* A full cache evicts sessions rather than growing */
+    SSL_CTX_sess_set_cache_size(sctx, SHARDED_SESSIONS / 4);
+    for (i = 0; i < SHARDED_SESSIONS; i++)
+        if (!TEST_int_eq(SSL_CTX_add_session(sctx, sess[i]), 1))
+            goto end;
+    if (!TEST_long_le(SSL_CTX_sess_number(sctx), SHARDED_SESSIONS / 4)
+            || !TEST_long_gt(SSL_CTX_sess_cache_full(sctx), 0))
+        goto end;
+
+    /* Once empty the cache can be switched back */
+    SSL_CTX_flush_sessions(sctx, 0);
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER);
+    if (!TEST_ptr_null(sctx->sess_shards))
+        goto end;
+
+    testresult = 1;
+ end:
+    for (i = 0; i < SHARDED_SESSIONS; i++)
+        SSL_SESSION_free(sess[i]);
+    SSL_SESSION_free(clntsess);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+#if defined(OPENSSL_SYS_UNIX) && !defined(OPENSSL_NO_TLS1_2)
+/*
+ * Test that a session established by a forked child process can be resumed by
+ * the parent through the shared session cache
+ */
+static int test_shared_session_cache(void)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    SSL_SESSION *sess = NULL;
+    unsigned char buf[SSL3_RT_MAX_PLAIN_LENGTH], *p;
+    const unsigned char *cp;
+    int testresult = 0, fds[2] = { -1, -1 }, status, len;
+    ssize_t n;
+    pid_t pid;
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION,
+                                       TLS1_2_VERSION, &sctx, &cctx, cert,
+                                       privkey)))
+        goto end;
+    SSL_CTX_set_options(sctx, SSL_OP_NO_TICKET);
+    if (!TEST_true(SSL_CTX_set_shared_session_cache(sctx, 64))
+            || !TEST_int_eq(pipe(fds), 0)
+            || !TEST_int_ge(pid = fork(), 0))
+        goto end;
+
+    if (pid == 0) {
+        /* The child makes the session and hands it to the parent */
+        close(fds[0]);
+        p = buf;
+        if (!create_ssl_objects(sctx, cctx, &serverssl, &clientssl, NULL,
+                                NULL)
+                || !create_ssl_connection(serverssl, clientssl,
+                                          SSL_ERROR_NONE)
+                || (sess = SSL_get1_session(clientssl)) == NULL
+                || (len = i2d_SSL_SESSION(sess, NULL)) <= 0
+                || len > (int)sizeof(buf)
+                || i2d_SSL_SESSION(sess, &p) != len
+                || write(fds[1], buf, len) != len)
+            _exit(1);
+        _exit(0);
+    }
+
+    close(fds[1]);
+    fds[1] = -1;
+    len = 0;
+    while ((n = read(fds[0], buf + len, sizeof(buf) - len)) > 0)
+        len += (int)n;
+    if (!TEST_int_eq(waitpid(pid, &status, 0), pid)
+            || !TEST_true(WIFEXITED(status))
+            || !TEST_int_eq(WEXITSTATUS(status), 0)
+            || !TEST_int_gt(len, 0))
+        goto end;
+
+    /* The session is only in the shared cache, not in our internal one */
+    cp = buf;
+    if (!TEST_ptr(sess = d2i_SSL_SESSION_ex(NULL, &cp, len, libctx, NULL))
+            || !TEST_long_eq(SSL_CTX_sess_number(sctx), 0)
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(SSL_set_session(clientssl, sess))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(SSL_session_reused(clientssl))
+            || !TEST_long_eq(SSL_CTX_sess_cb_hits(sctx), 1))
+        goto end;
+
+    /* Once removed, the session can't be resumed any more */
+    shutdown_ssl_connection(serverssl, clientssl);
+    serverssl = clientssl = NULL;
+    if (!TEST_true(SSL_CTX_remove_session(sctx, sess))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(SSL_set_session(clientssl, sess))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_false(SSL_session_reused(clientssl)))
+        goto end;
+
+    testresult = 1;
+ end:
+    if (fds[0] >= 0)
+        close(fds[0]);
+    if (fds[1] >= 0)
+        close(fds[1]);
+    SSL_SESSION_free(sess);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * Test that a slot of the shared session cache left claimed by a process
+ * that died while writing to it is taken over once the claim is old enough.
+ * The sequence counter is the first field of each 4096 byte slot, and holds
+ * the time of the claim in its upper 32 bits.
+ * Test 0: Every slot was claimed just now, so no session can be stored
+ * Test 1: Every slot was claimed long ago, so sessions are stored anyway
+ */
+static int test_shared_session_cache_stale(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    SSL_SESSION *sess = NULL;
+    uint64_t claim_time = tst == 0 ? (uint64_t)time(NULL) : 0;
+    size_t i;
+    int testresult = 0;
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION,
+                                       TLS1_2_VERSION, &sctx, &cctx, cert,
+                                       privkey)))
+        goto end;
+    SSL_CTX_set_options(sctx, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER
+                                         | SSL_SESS_CACHE_NO_INTERNAL);
+    if (!TEST_true(SSL_CTX_set_shared_session_cache(sctx, 8)))
+        goto end;
+    for (i = 0; i < sctx->shm_sess_num_slots; i++)
+        *(uint64_t *)((unsigned char *)sctx->shm_sess_slots + i * 4096)
+            = (claim_time << 32) | 1;
+
+    if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                      NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_ptr(sess = SSL_get1_session(clientssl)))
+        goto end;
+    shutdown_ssl_connection(serverssl, clientssl);
+    serverssl = clientssl = NULL;
+
+    if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                      NULL, NULL))
+            || !TEST_true(SSL_set_session(clientssl, sess))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_int_eq(SSL_session_reused(clientssl), tst == 1))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_SESSION_free(sess);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+#endif
+
 /*
  * Test 0: Client sets servername and server acknowledges it (TLSv1.2)
  * Test 1: Client sets servername and server does not acknowledge it (TLSv1.2)
@@ -11461,6 +11958,339 @@ end:
     return testresult;
 }
 
+#define PREFETCH_HANDSHAKES 50
+
+/*
+ * Test that the algorithms used on every handshake are fetched once by the
+ * SSL_CTX, and that connections using them work, both with full handshakes
+ * and with resumption from a ticket.  The CPU time per handshake is reported
+ * for comparison between builds.
+ * Test 0: TLSv1.2
+ * Test 1: TLSv1.3
+ */
+static int test_prefetched_algs(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    SSL_SESSION *sess = NULL;
+    int testresult = 0, i;
+    clock_t start;
+    double usecs;
+
+#ifdef OPENSSL_NO_TLS1_2
+    if (tst == 0)
+        return TEST_skip("TLSv1.2 is disabled");
+#endif
+#ifdef OSSL_NO_USABLE_TLS1_3
+    if (tst == 1)
+        return TEST_skip("TLSv1.3 is disabled");
+#endif
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION,
+                                       tst == 0 ? TLS1_2_VERSION
+                                                : TLS1_3_VERSION,
+                                       &sctx, &cctx, cert, privkey)))
+        goto end;
+
+    if (!TEST_ptr(sctx->ssl_hmac)
+            || !TEST_ptr(cctx->ssl_kdf_methods[tst == 0 ? SSL_KDF_TLS1_PRF_IDX
+                                                       : SSL_KDF_TLS1_3_KDF_IDX])
+            || !TEST_ptr(cctx->ssl_digest_methods[SSL_MD_SHA256_IDX])
+            || !TEST_ptr(sctx->ssl_cipher_methods[SSL_ENC_AES256_IDX]))
+        goto end;
+
+    start = clock();
+    for (i = 0; i < PREFETCH_HANDSHAKES; i++) {
+        if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                          NULL, NULL))
+                || (sess != NULL
+                    && !TEST_true(SSL_set_session(clientssl, sess)))
+                || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                    SSL_ERROR_NONE)))
+            goto end;
+        /* Every other handshake resumes the session of the one before */
+        if (sess != NULL) {
+            if (!TEST_true(SSL_session_reused(clientssl)))
+                goto end;
+            SSL_SESSION_free(sess);
+            sess = NULL;
+        } else if (!TEST_ptr(sess = SSL_get1_session(clientssl))) {
+            goto end;
+        }
+        shutdown_ssl_connection(serverssl, clientssl);
+        serverssl = clientssl = NULL;
+    }
+    usecs = (double)(clock() - start) * 1000000 / CLOCKS_PER_SEC;
+    TEST_info("%s: %d handshakes, %.0f us CPU time per handshake",
+              tst == 0 ? "TLSv1.2" : "TLSv1.3", PREFETCH_HANDSHAKES,
+              usecs / PREFETCH_HANDSHAKES);
+
+    testresult = 1;
+ end:
+    SSL_SESSION_free(sess);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+#ifndef OSSL_NO_USABLE_TLS1_3
+/*
+ * Checks that the TLSv1.3 application data records pending in |bio| hold
+ * |numrecs| fragments of the lengths in |fraglens|, not counting the content
+ * type and tag.
+ */
+static int check_tls13_records(BIO *bio, const size_t *fraglens,
+                               size_t numrecs)
+{
+    unsigned char *data;
+    long len = BIO_get_mem_data(bio, &data);
+    size_t reclen, i;
+
+    for (i = 0; len > 0; i++) {
+        if (!TEST_size_t_lt(i, numrecs)
+                || !TEST_long_ge(len, SSL3_RT_HEADER_LENGTH)
+                || !TEST_int_eq(data[0], SSL3_RT_APPLICATION_DATA)
+                || !TEST_int_eq((data[1] << 8) | data[2], TLS1_2_VERSION))
+            return 0;
+        reclen = ((size_t)data[3] << 8) | data[4];
+        if (!TEST_size_t_eq(reclen, fraglens[i] + 1 + EVP_GCM_TLS_TAG_LEN)
+                || !TEST_long_ge(len, (long)(SSL3_RT_HEADER_LENGTH + reclen)))
+            return 0;
+        data += SSL3_RT_HEADER_LENGTH + reclen;
+        len -= (long)(SSL3_RT_HEADER_LENGTH + reclen);
+    }
+    return TEST_size_t_eq(i, numrecs);
+}
+
+/*
+ * Test that a TLSv1.3 write is split evenly over pipelines with any cipher,
+ * rather than in fragments of split_send_fragment bytes as without
+ * pipelining. The records of a write, and of successive writes, must have
+ * consecutive sequence numbers, or the peer could not decrypt them.
+ * Test 0: TLS_AES_128_GCM_SHA256
+ * Test 1: TLS_CHACHA20_POLY1305_SHA256
+ */
+static int test_tls13_pipelining(int idx)
+{
+    static const size_t piped_lens[] = { 875, 875, 875, 875 };
+    static const size_t plain_lens[] = { 1000, 1000, 1000, 500 };
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    const char *ciphersuite = idx == 0 ? "TLS_AES_128_GCM_SHA256"
+                                       : "TLS_CHACHA20_POLY1305_SHA256";
+    unsigned char msg[3500], buf[sizeof(msg)];
+    size_t written, readbytes, offset;
+    int testresult = 0, i, piped;
+
+# ifdef OPENSSL_NO_CHACHA
+    if (idx == 1)
+        return TEST_skip("ChaCha20 is disabled");
+# endif
+    if (is_fips && idx == 1)
+        return TEST_skip("ChaCha20 is not available in the FIPS provider");
+
+    if (!TEST_int_gt(RAND_bytes_ex(libctx, msg, sizeof(msg), 0), 0)
+            || !TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                              TLS_client_method(),
+                                              TLS1_3_VERSION, TLS1_3_VERSION,
+                                              &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_ciphersuites(sctx, ciphersuite))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(SSL_set_split_send_fragment(clientssl, 1000)))
+        goto end;
+
+    /* Alternate between pipelined and plain writes */
+    for (i = 0; i < 4; i++) {
+        piped = i % 2 == 0;
+        if (!TEST_true(SSL_set_max_pipelines(clientssl, piped ? 4 : 1))
+                || !TEST_true(SSL_write_ex(clientssl, msg, sizeof(msg),
+                                           &written))
+                || !TEST_size_t_eq(written, sizeof(msg))
+                || !TEST_true(check_tls13_records(SSL_get_rbio(serverssl),
+                                                  piped ? piped_lens
+                                                        : plain_lens,
+                                                  OSSL_NELEM(piped_lens))))
+            goto end;
+
+        for (offset = 0; offset < written; offset += readbytes) {
+            if (!TEST_true(SSL_read_ex(serverssl, buf + offset,
+                                       written - offset, &readbytes)))
+                goto end;
+        }
+        if (!TEST_mem_eq(msg, written, buf, offset))
+            goto end;
+    }
+
+    testresult = 1;
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * Test SSL_writev_ex() into a buffer set with SSL_set_write_buffer(), and
+ * SSL_readv_ex() and SSL_borrow_read_buf() on a TLSv1.3 connection. The data
+ * is split over buffers so that some records are gathered from several of
+ * them and some come from just one.
+ * Test 0: TLS_AES_128_GCM_SHA256
+ * Test 1: TLS_CHACHA20_POLY1305_SHA256
+ * Test 2: TLS_AES_128_CCM_SHA256, which needs the data in the write buffer
+ * Test 3: TLS_AES_128_GCM_SHA256, retrying a failed write with the data moved
+ *         to other buffers (SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER)
+ */
+static int test_tls13_iov(int idx)
+{
+    static const size_t fraglens[] = { 1000, 1000, 1000, 1000, 1000 };
+    static const size_t wlens[] = { 1, 700, 0, 1800, 2499 };
+    static const size_t rlens[] = { 600, 0, 250, 4150 };
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    BIO *bretry = NULL, *tmp = NULL;
+    const char *ciphersuite = idx == 1 ? "TLS_CHACHA20_POLY1305_SHA256"
+                              : idx == 2 ? "TLS_AES_128_CCM_SHA256"
+                              : "TLS_AES_128_GCM_SHA256";
+    unsigned char msg[5000], moved[sizeof(msg)], buf[sizeof(msg)];
+    unsigned char wbuf[20000];
+    unsigned char *recs;
+    const unsigned char *data;
+    SSL_IOVEC wiov[OSSL_NELEM(wlens)], riov[OSSL_NELEM(rlens)];
+    size_t written, readbytes, len, offset, i;
+    long recslen;
+    int testresult = 0;
+
+# ifdef OPENSSL_NO_CHACHA
+    if (idx == 1)
+        return TEST_skip("ChaCha20 is disabled");
+# endif
+    if (is_fips && idx == 1)
+        return TEST_skip("ChaCha20 is not available in the FIPS provider");
+
+    if (!TEST_int_gt(RAND_bytes_ex(libctx, msg, sizeof(msg), 0), 0)
+            || !TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                              TLS_client_method(),
+                                              TLS1_3_VERSION, TLS1_3_VERSION,
+                                              &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_ciphersuites(sctx, ciphersuite))
+            || !TEST_true(SSL_CTX_set_ciphersuites(cctx, ciphersuite))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(SSL_set_split_send_fragment(clientssl, 1000))
+            || !TEST_true(SSL_set_write_buffer(clientssl, wbuf, sizeof(wbuf))))
+        goto end;
+
+    for (i = 0, offset = 0; i < OSSL_NELEM(wlens); offset += wlens[i++]) {
+        wiov[i].data = msg + offset;
+        wiov[i].data_len = wlens[i];
+    }
+
+    if (idx == 3) {
+        SSL_set_mode(clientssl, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
+        /* Swap the client's write BIO to force a retry */
+        bretry = BIO_new(bio_s_always_retry());
+        tmp = SSL_get_wbio(clientssl);
+        if (!TEST_ptr(bretry) || !TEST_ptr(tmp)
+                || !TEST_true(BIO_up_ref(tmp))) {
+            tmp = NULL;
+            goto end;
+        }
+        SSL_set0_wbio(clientssl, bretry);
+        bretry = NULL;
+
+        if (!TEST_false(SSL_writev_ex(clientssl, wiov, OSSL_NELEM(wiov),
+                                      &written))
+                || !TEST_int_eq(SSL_get_error(clientssl, 0),
+                                SSL_ERROR_WANT_WRITE))
+            goto end;
+
+        SSL_set0_wbio(clientssl, tmp);
+        tmp = NULL;
+
+        /* Retry with the same data in other buffers */
+        memcpy(moved, msg, sizeof(msg));
+        for (i = 0, offset = 0; i < OSSL_NELEM(wlens); offset += wlens[i++])
+            wiov[i].data = moved + offset;
+    }
+
+    if (!TEST_true(SSL_writev_ex(clientssl, wiov, OSSL_NELEM(wiov), &written))
+            || !TEST_size_t_eq(written, sizeof(msg))
+            || !TEST_true(check_tls13_records(SSL_get_rbio(serverssl),
+                                              fraglens, OSSL_NELEM(fraglens))))
+        goto end;
+
+    /* The last record must have been built in our buffer */
+    recslen = BIO_get_mem_data(SSL_get_rbio(serverssl), &recs);
+    len = SSL3_RT_HEADER_LENGTH + fraglens[0] + 1 + EVP_GCM_TLS_TAG_LEN;
+    if (!TEST_long_ge(recslen, (long)len))
+        goto end;
+    recs += recslen - len;
+    for (offset = 0; offset < 64; offset++)
+        if (memcmp(wbuf + offset, recs, len) == 0)
+            break;
+    if (!TEST_size_t_lt(offset, 64))
+        goto end;
+
+    /* Scatter the first record */
+    for (i = 0, offset = 0; i < OSSL_NELEM(rlens); offset += rlens[i++]) {
+        riov[i].data = buf + offset;
+        riov[i].data_len = rlens[i];
+    }
+    if (!TEST_true(SSL_readv_ex(serverssl, riov, OSSL_NELEM(riov),
+                                &readbytes))
+            || !TEST_size_t_eq(readbytes, fraglens[0]))
+        goto end;
+    offset = readbytes;
+
+    /* Borrow the second one, and give it back in two goes */
+    if (!TEST_true(SSL_borrow_read_buf(serverssl, &data, &len))
+            || !TEST_size_t_eq(len, fraglens[1])
+            || !TEST_false(SSL_read_ex(serverssl, buf + offset, 1,
+                                       &readbytes))
+            || !TEST_false(SSL_release_read_buf(serverssl, len + 1))
+            || !TEST_true(SSL_release_read_buf(serverssl, 300))
+            || !TEST_false(SSL_release_read_buf(serverssl, 0)))
+        goto end;
+    memcpy(buf + offset, data, 300);
+    offset += 300;
+    if (!TEST_true(SSL_borrow_read_buf(serverssl, &data, &len))
+            || !TEST_size_t_eq(len, fraglens[1] - 300))
+        goto end;
+    memcpy(buf + offset, data, len);
+    offset += len;
+    if (!TEST_true(SSL_release_read_buf(serverssl, len)))
+        goto end;
+
+    for (; offset < sizeof(msg); offset += readbytes) {
+        if (!TEST_true(SSL_read_ex(serverssl, buf + offset,
+                                   sizeof(buf) - offset, &readbytes)))
+            goto end;
+    }
+    if (!TEST_mem_eq(msg, sizeof(msg), buf, offset))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    BIO_free(bretry);
+    BIO_free(tmp);
+    return testresult;
+}
+#endif
+
 OPT_TEST_DECLARE_USAGE("certfile privkeyfile srpvfile tmpfile provider config dhfile\n")
 
 int setup_tests(void)
@@ -11608,6 +12438,7 @@ int setup_tests(void)
 # if !defined(OPENSSL_NO_TLS1_2) || !defined(OSSL_NO_USABLE_TLS1_3)
     ADD_ALL_TESTS(test_ktls, NUM_KTLS_TEST_CIPHERS * 4);
     ADD_ALL_TESTS(test_ktls_sendfile, NUM_KTLS_TEST_CIPHERS * 2);
+    ADD_ALL_TESTS(test_ktls_transfer, NUM_KTLS_TEST_CIPHERS * 3);
 # endif
 #endif
     ADD_TEST(test_large_message_tls);
@@ -11756,6 +12587,11 @@ int setup_tests(void)
     ADD_TEST(test_set_verify_cert_store_ssl_ctx);
     ADD_TEST(test_set_verify_cert_store_ssl);
     ADD_ALL_TESTS(test_session_timeout, 1);
+    ADD_ALL_TESTS(test_session_cache_sharded, 2);
+#if defined(OPENSSL_SYS_UNIX) && !defined(OPENSSL_NO_TLS1_2)
+    ADD_TEST(test_shared_session_cache);
+    ADD_ALL_TESTS(test_shared_session_cache_stale, 2);
+#endif
     ADD_TEST(test_load_dhfile);
 #ifndef OSSL_NO_USABLE_TLS1_3
     ADD_TEST(test_read_ahead_key_change);
@@ -11771,6 +12607,11 @@ int setup_tests(void)
     ADD_TEST(test_rstate_string);
     ADD_ALL_TESTS(test_handshake_retry, 16);
     ADD_TEST(test_data_retry);
+    ADD_ALL_TESTS(test_prefetched_algs, 2);
+#ifndef OSSL_NO_USABLE_TLS1_3
+    ADD_ALL_TESTS(test_tls13_pipelining, 2);
+    ADD_ALL_TESTS(test_tls13_iov, 4);
+#endif
     return 1;
 
  err:
@@ -31,6 +31,8 @@ struct async_ctrs {
 
 static SSL_CTX *serverctx = NULL;
 static SSL_CTX *clientctx = NULL;
+static char *cert = NULL;
+static char *pkey = NULL;
 
 #define MAX_ATTEMPTS    100
 
@@ -175,12 +177,75 @@ static int test_func(int test)
     return result;
 }
 
+/*
+ * Check that buffers released by a connection are taken from the pool of its
+ * SSL_CTX when it needs buffers again
+ */
+static int test_buffer_pool(void)
+{
+    int result = 0;
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *serverssl = NULL, *clientssl = NULL;
+    SSL_CONNECTION *sc;
+    unsigned char *rbuf, *wbuf, *newrbuf, *newwbuf;
+    const char testdata[] = "Test data";
+    char buf[sizeof(testdata)];
+    size_t written, readbytes;
+
+    /* Use new SSL_CTXs so that their pools are empty */
+    if (!TEST_true(create_ssl_ctx_pair(NULL, TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION, 0,
+                                       &sctx, &cctx, cert, pkey))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(SSL_write_ex(clientssl, testdata, sizeof(testdata),
+                                       &written))
+            || !TEST_true(SSL_read_ex(serverssl, buf, sizeof(buf),
+                                      &readbytes))
+            || !TEST_true(checkbuffers(clientssl, 1)))
+        goto end;
+
+    sc = SSL_CONNECTION_FROM_SSL(clientssl);
+    rbuf = sc->rlayer.rrl->rbuf.buf;
+    wbuf = sc->rlayer.wrl->wbuf[0].buf;
+
+    if (!TEST_true(SSL_free_buffers(clientssl))
+            || !TEST_true(checkbuffers(clientssl, 0))
+            || !TEST_true(SSL_alloc_buffers(clientssl))
+            || !TEST_true(checkbuffers(clientssl, 1)))
+        goto end;
+
+    /* Both buffers are the same size, so they may have swapped places */
+    newrbuf = sc->rlayer.rrl->rbuf.buf;
+    newwbuf = sc->rlayer.wrl->wbuf[0].buf;
+    if (!TEST_true((newrbuf == rbuf && newwbuf == wbuf)
+                   || (newrbuf == wbuf && newwbuf == rbuf)))
+        goto end;
+
+    /* Check that the connection still works */
+    if (!TEST_true(SSL_write_ex(clientssl, testdata, sizeof(testdata),
+                                &written))
+            || !TEST_true(SSL_read_ex(serverssl, buf, sizeof(buf),
+                                      &readbytes))
+            || !TEST_mem_eq(buf, readbytes, testdata, sizeof(testdata)))
+        goto end;
+
+    result = 1;
+ end:
+    SSL_free(clientssl);
+    SSL_free(serverssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return result;
+}
+
 OPT_TEST_DECLARE_USAGE("certfile privkeyfile\n")
 
 int setup_tests(void)
 {
-    char *cert, *pkey;
-
     if (!test_skip_common_options()) {
         TEST_error("Error parsing test options\n");
         return 0;
@@ -198,6 +263,7 @@ int setup_tests(void)
     }
 
     ADD_ALL_TESTS(test_func, 9);
+    ADD_TEST(test_buffer_pool);
     return 1;
 }
 
@@ -29,6 +29,8 @@
 #include <openssl/evp.h>
 #include "internal/tsan_assist.h"
 #include "internal/nelem.h"
+#include "internal/rcu.h"
+#include "internal/time.h"
 #include "testutil.h"
 #include "threadstest.h"
 
@@ -256,6 +258,76 @@ static int test_atomic(void)
     return testresult;
 }
 
+static CRYPTO_RCU_LOCK *rcu_lock = NULL;
+static int *rcu_shared = NULL;
+static int rcu_reader_failed = 0;
+
+#define RCU_WRITER_ITERATIONS   1000
+#define RCU_READER_ITERATIONS   100000
+
+static void rcu_reader_cb(void)
+{
+    CRYPTO_RCU_TOKEN token;
+    int *p, i;
+
+    for (i = 0; i < RCU_READER_ITERATIONS; i++) {
+        if (!ossl_rcu_read_lock(rcu_lock, &token)) {
+            rcu_reader_failed = 1;
+            return;
+        }
+        p = ossl_rcu_deref(&rcu_shared);
+        /* The writer zeroes the old value before freeing it */
+        if (p != NULL && *p == 0)
+            rcu_reader_failed = 1;
+        ossl_rcu_read_unlock(rcu_lock, token);
+    }
+}
+
+static int test_rcu(void)
+{
+    thread_t t[4];
+    int *new, *old;
+    size_t i;
+    int testresult = 0, started = 0;
+
+    if (!TEST_ptr(rcu_lock = ossl_rcu_lock_new()))
+        return 0;
+    rcu_reader_failed = 0;
+
+    for (i = 0; i < OSSL_NELEM(t); i++, started++)
+        if (!TEST_true(run_thread(&t[i], rcu_reader_cb)))
+            goto err;
+
+    for (i = 1; i <= RCU_WRITER_ITERATIONS; i++) {
+        if (!TEST_ptr(new = OPENSSL_malloc(sizeof(*new))))
+            goto err;
+        *new = (int)i;
+        if (!TEST_true(ossl_rcu_write_lock(rcu_lock))) {
+            OPENSSL_free(new);
+            goto err;
+        }
+        old = rcu_shared;
+        ossl_rcu_assign_ptr(&rcu_shared, new);
+        ossl_rcu_write_unlock(rcu_lock);
+        ossl_synchronize_rcu(rcu_lock);
+        if (old != NULL)
+            *old = 0;
+        OPENSSL_free(old);
+    }
+    testresult = 1;
+ err:
+    for (i = 0; i < (size_t)started; i++)
+        if (!TEST_true(wait_for_thread(t[i])))
+            testresult = 0;
+    if (!TEST_false(rcu_reader_failed))
+        testresult = 0;
+    OPENSSL_free(rcu_shared);
+    rcu_shared = NULL;
+    ossl_rcu_lock_free(rcu_lock);
+    rcu_lock = NULL;
+    return testresult;
+}
+
 static OSSL_LIB_CTX *multi_libctx = NULL;
 static int multi_success;
 static OSSL_PROVIDER *multi_provider[MAXIMUM_PROVIDERS + 1];
@@ -438,6 +510,30 @@ static void thread_multi_simple_fetch(void)
         multi_set_success(0);
 }
 
+#define CONTENDED_FETCHES 20000
+
+/*
+ * Repeatedly fetch already cached algorithms so that the threads contend on
+ * the method store query cache and nothing else.
+ */
+static void thread_contended_fetch(void)
+{
+    EVP_MD *md;
+    EVP_CIPHER *ciph;
+    int i;
+
+    for (i = 0; i < CONTENDED_FETCHES; i++) {
+        md = EVP_MD_fetch(multi_libctx, "SHA2-256", NULL);
+        ciph = EVP_CIPHER_fetch(multi_libctx, "AES-128-GCM", "provider=default");
+        EVP_MD_free(md);
+        EVP_CIPHER_free(ciph);
+        if (md == NULL || ciph == NULL) {
+            multi_set_success(0);
+            return;
+        }
+    }
+}
+
 static EVP_PKEY *shared_evp_pkey = NULL;
 
 static void thread_shared_evp_pkey(void)
@@ -518,6 +614,42 @@ static int test_multi_fetch_worker(void)
                            2, &thread_multi_simple_fetch, 1, default_provider);
 }
 
+/*
+ * Not a pass/fail benchmark: report the throughput of cached fetches for an
+ * increasing number of threads, so that scaling of the lock free cache
+ * lookups can be checked by looking at the test output.
+ */
+static int test_multi_fetch_contention(int idx)
+{
+    size_t threads = idx == 0 ? 1 : (size_t)idx * 3;
+    OSSL_TIME start, duration;
+    uint64_t us;
+    int testresult = 0;
+
+    multi_intialise();
+    if (!thread_setup_libctx(1, default_provider))
+        goto err;
+
+    /* Populate the query cache before starting the clock */
+    thread_contended_fetch();
+    start = ossl_time_now();
+    if (!start_threads(threads, &thread_contended_fetch)
+            || !teardown_threads()
+            || !TEST_true(multi_success))
+        goto err;
+    duration = ossl_time_subtract(ossl_time_now(), start);
+    us = ossl_time2us(duration);
+    TEST_info("%zu threads: %d cached fetches per thread in %llu us"
+              " (%llu fetches/ms)", threads, 2 * CONTENDED_FETCHES,
+              (unsigned long long)us,
+              (unsigned long long)(us == 0 ? 0
+                                   : 2000ULL * CONTENDED_FETCHES * threads / us));
+    testresult = 1;
+ err:
+    thead_teardown_libctx();
+    return testresult;
+}
+
 static int test_multi_shared_pkey_common(void (*worker)(void))
 {
     int testresult = 0;
@@ -853,10 +985,12 @@ int setup_tests(void)
     ADD_TEST(test_once);
     ADD_TEST(test_thread_local);
     ADD_TEST(test_atomic);
+    ADD_TEST(test_rcu);
     ADD_TEST(test_multi_load);
     ADD_TEST(test_multi_general_worker_default_provider);
     ADD_TEST(test_multi_general_worker_fips_provider);
     ADD_TEST(test_multi_fetch_worker);
+    ADD_ALL_TESTS(test_multi_fetch_contention, 4);
     ADD_TEST(test_multi_shared_pkey);
 #ifndef OPENSSL_NO_DEPRECATED_3_0
     ADD_TEST(test_multi_downgrade_shared_pkey);